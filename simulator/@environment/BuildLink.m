@@ -121,6 +121,9 @@ elseif ~isempty(reciprocalLink)
        channel.riceMatrix = channel.riceMatrix.';
        channel.powerProfile = channel.powerProfile.';
        channel.chanstates = channel.chanstates.';
+       if isfield(channel,'zhengStates')
+           channel.zhengStates = PackZhengStates(channel.chanstates);
+       end
    end
 
 else
@@ -218,7 +221,7 @@ load antiAliasFilterTaps B
 % Channel information
 k.channel = channel;
 k.pathLoss = pathLoss;
-k.chanTail = [];
+k.chanTail = [];  % Transmit samples carried to the next contiguous receive block
 k.propParams = propParams;
 
 % Inband filter information
@@ -111,6 +111,14 @@ blockLengthRxChan = blockLengthRx + ...
     (delayFiltLen - 1) + ...
     antSepSamps;
 
+% Samples at the start of the channel block that the previous receive
+% block already read: the channel memory plus the filter lengths
+nHist = blockLengthRxChan - blockLengthRx;
+
+% The tail of the last block is only kept for the next one
+chanTail = linkobj.chanTail;
+linkobj.chanTail = [];
+
 fs = GetFs(modTx);
 taps = linkobj.antialiasTaps;
 [result, ft] = AllSameTxFc(modTx, startRxChan, blockLengthRxChan, fr); % If tx blocks have same fc
@@ -118,9 +126,30 @@ if isempty(result)
     source = [];  % source is empty if all wait blocks or all out of band
 
 elseif result
-    [source, blockLen] = ReadContiguousData(modTx, startRxChan, blockLengthRxChan, fr);
+    % When this block directly follows the last one and the transmit
+    % signal is used as read (same tx and rx fc), only the new samples
+    % are read and the carried tail supplies the channel history.
+    % Otherwise the whole channel block is read.
+    source = [];
+    if ft == fr && ~isempty(chanTail) && chanTail.start == startRxChan ...
+            && size(chanTail.samples, 2) == nHist
+        source = ReadContiguousData(modTx, startRxChan + nHist, blockLengthRx, fr);
+        if ~isempty(source)
+            source = [chanTail.samples, source];
+        end
+    end
+    if isempty(source)
+        source = ReadContiguousData(modTx, startRxChan, blockLengthRxChan, fr);
+    end
+    blockLen = size(source, 2);
     %ft = GetFc(modTx);
 
+    % Carry the end of the block over to the next contiguous block
+    if ft == fr && nHist > 0 && blockLen == blockLengthRxChan
+        linkobj.chanTail.start = startRxChan + blockLengthRx;
+        linkobj.chanTail.samples = source(:, end-nHist+1:end);
+    end
+
     % Check for sufficient length
     if (size(source, 2) < length(taps)) && ~isempty(source)
 
@@ -0,0 +1,224 @@
+function ExportGoldenVectors(fileName)
+
+% Function simulator/channel/ExportGoldenVectors.m:
+% Writes the golden-vector fixture read by llamachanGolden: randomized
+% inputs of the channel kernels with the outputs of their MATLAB
+% references, TVConv.m, Stackzs.m and the zheng subfunction of jakes4.m.
+% The references are copied to a temporary folder and run from there, so
+% that they shadow any MEX functions on the path, and a zhengFunLUT that
+% always fails sends jakes4 to its zheng subfunction.  See
+% llamachanGolden.c for the file format and the error budget of each
+% kernel variant.  The checked-in llamachanGolden.bin was written by the
+% C port instead ("llamachanGolden --export"); running this replaces it
+% with MATLAB reference outputs.
+%
+% USAGE: ExportGoldenVectors(fileName)
+%
+% Input argument:
+%  fileName  (string) Fixture to write, llamachanGolden.bin in this
+%            folder by default
+
+%
+% This material is based upon work supported by the Defense Advanced Research
+% Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+% findings, conclusions or recommendations expressed in this material are those
+% of the author(s) and do not necessarily reflect the views of the Defense
+% Advanced Research Projects Agency.
+%
+% © 2019 Massachusetts Institute of Technology.
+%
+%
+% This program is free software; you can redistribute it and/or modify
+% it under the terms of the GNU General Public License version 2 as
+% published by the Free Software Foundation;
+%
+% THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+% AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+% IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+% ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+% LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+% CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+% SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+% INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+% CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+% ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+% POSSIBILITY OF SUCH DAMAGE.
+%
+% Delivered to the U.S. Government with Unlimited Rights, as defined in DFARS
+% Part 252.227-7013 or 7014 (Feb 2014). Notwithstanding any copyright notice,
+% U.S. Government rights in this work are defined by DFARS 252.227-7013 or
+% DFARS 252.227-7014 as detailed above. Use of this work other than as
+% specifically authorized by the U.S. Government may violate any copyrights
+% that exist in this work.
+
+chanDir = fileparts(mfilename('fullpath'));
+if nargin < 1
+    fileName = fullfile(chanDir, 'llamachanGolden.bin');
+end
+
+% Record kinds, as in llamachanGolden.c
+GOLDEN_TVCONV  = 1;
+GOLDEN_STACKZS = 2;
+GOLDEN_ZHENG   = 3;
+GOLDEN_JAKES   = 4;
+
+% Run the references from a folder of their own
+refDir = tempname;
+mkdir(refDir);
+for refFile = {'TVConv.m', 'Stackzs.m', 'cycle.m', 'jakes4.m'}
+    copyfile(fullfile(chanDir, refFile{1}), refDir);
+end
+stubFid = fopen(fullfile(refDir, 'zhengFunLUT.m'), 'w');
+fprintf(stubFid, 'function h = zhengFunLUT(varargin) %%#ok\nerror(''golden:reference'', ''use zheng'');\n');
+fclose(stubFid);
+
+% Open the fixture first, as a relative fileName is relative to here
+fid = fopen(fileName, 'w', 'ieee-le');
+if fid < 0
+    error('ExportGoldenVectors: cannot write %s', fileName);
+end
+fwrite(fid, 'LLCGOLD1', 'uint8'); % Marks MATLAB reference outputs, see llamachanGolden.c
+
+oldDir = cd(refDir);
+cleanup = onCleanup(@() RemoveRefDir(oldDir, refDir)); %#ok - runs on return or error
+rehash;
+rng(19);
+
+% nS, nLags, longestLag, complex H, complex source
+tvCases = [256 1 0 1 1; 300 4 6 0 1; 300 4 6 1 0; 300 4 6 0 0; ...
+           600 5 9 1 1; 256 20 24 1 1; 400 12 40 1 1];
+for cLoop = 1:size(tvCases, 1)
+    nS = tvCases(cLoop, 1);
+    nLags = tvCases(cLoop, 2);
+    longestLag = tvCases(cLoop, 3);
+    lags = sort([randperm(longestLag, nLags-1) - 1, longestLag]);
+    H = RandArray(nS, nLags, tvCases(cLoop, 4));
+    src = RandArray(nS + longestLag, 1, tvCases(cLoop, 5));
+    out = TVConv(H, lags, src, longestLag);
+    WriteRecord(fid, GOLDEN_TVCONV, [nS, nLags, longestLag], ...
+                {lags, real(H), ImagPart(H), real(src), ImagPart(src), ...
+                 real(out), ImagPart(out)});
+end
+
+% nr, nc, nShifts, complex, largest |shift|
+szCases = [1 64 1 0 10; 4 100 5 1 99; 4 24 21 1 20; 2 20 65 0 19; 2 16 7 1 40];
+for cLoop = 1:size(szCases, 1)
+    nShifts = szCases(cLoop, 3);
+    maxShift = szCases(cLoop, 5);
+    shifts = randi([-maxShift, maxShift], 1, nShifts);
+    z = RandArray(szCases(cLoop, 1), szCases(cLoop, 2), szCases(cLoop, 4));
+    Z = Stackzs(z, shifts);
+    WriteRecord(fid, GOLDEN_STACKZS, szCases(cLoop, 1:3), ...
+                {shifts, real(z), ImagPart(z), real(Z), ImagPart(Z)});
+end
+
+% M, nS, nTaps, doppf, start
+zhCases = [8 1024 3 1e-2 0; 4 600 2 5e-2 12345; 16 1024 2 1e-3 1e5; 8 1024 2 1e-4 1000];
+for cLoop = 1:size(zhCases, 1)
+    M = zhCases(cLoop, 1);
+    nS = zhCases(cLoop, 2);
+    doppf = zhCases(cLoop, 4);
+    start = zhCases(cLoop, 5);
+    cs = ZhengStates(M, doppf, zhCases(cLoop, 3));
+    h = jakes4(start, nS, cs);
+    WriteRecord(fid, GOLDEN_ZHENG, zhCases(cLoop, 1:3), ...
+                {[doppf, start], [cs.alph], [cs.phi], [cs.sphi], real(h), imag(h)});
+end
+
+% nS, nLags, longestLag, M, doppf, start
+jkCases = [1000 5 9 8 1e-2 500; 2000 3 4 8 1e-4 0];
+for cLoop = 1:size(jkCases, 1)
+    nS = jkCases(cLoop, 1);
+    nLags = jkCases(cLoop, 2);
+    longestLag = jkCases(cLoop, 3);
+    M = jkCases(cLoop, 4);
+    doppf = jkCases(cLoop, 5);
+    start = jkCases(cLoop, 6);
+    lags = sort([randperm(longestLag, nLags-1) - 1, longestLag]);
+    gains = sqrt(rand(1, nLags)/nLags);
+    cs = ZhengStates(M, doppf, nLags);
+    src = RandArray(nS + longestLag, 1, true);
+    H = struct('chanstates', {cs}, 'gains', gains, 'start', start, 'nSamples', nS);
+    out = TVConv(H, lags, src, longestLag);
+    WriteRecord(fid, GOLDEN_JAKES, jkCases(cLoop, 1:4), ...
+                {[doppf, start], lags, gains, [cs.alph], [cs.phi], [cs.sphi], ...
+                 real(src), imag(src), real(out), imag(out)});
+end
+
+fclose(fid);
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+function RemoveRefDir(oldDir, refDir)
+% Leave the folder of the references and delete it
+cd(oldDir);
+rmdir(refDir, 's');
+
+function WriteRecord(fid, kind, ints, arrays)
+% int32 kind, nInts, nArrays, the ints, then each array as an int32
+% length and its doubles
+fwrite(fid, [kind, numel(ints), numel(arrays), ints], 'int32');
+for aLoop = 1:numel(arrays)
+    fwrite(fid, numel(arrays{aLoop}), 'int32');
+    fwrite(fid, arrays{aLoop}(:), 'double');
+end
+
+function x = RandArray(nr, nc, isComplex)
+% Uniform in [-1, 1), complex when asked for
+x = 2*rand(nr, nc) - 1;
+if isComplex
+    x = complex(x, 2*rand(nr, nc) - 1);
+end
+
+function x = ImagPart(y)
+% Imaginary part, empty for real data
+if isreal(y)
+    x = [];
+else
+    x = imag(y);
+end
+
+function cs = ZhengStates(M, doppf, nTaps)
+% nTaps 'zheng' chanstates, as GetWssusChannel makes them
+for tLoop = nTaps:-1:1
+    cs(tLoop).method = 'zheng';
+    cs(tLoop).doppf  = doppf;
+    cs(tLoop).M      = M;
+    cs(tLoop).theta  = 2*pi*rand;
+    cs(tLoop).alph   = (2*pi*(1:M)' - pi + cs(tLoop).theta)/(4*M);
+    cs(tLoop).phi    = 2*pi*rand(M, 1);
+    cs(tLoop).sphi   = 2*pi*rand(M, 1);
+end
+
+%
+% This material is based upon work supported by the Defense Advanced Research
+% Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+% findings, conclusions or recommendations expressed in this material are those
+% of the author(s) and do not necessarily reflect the views of the Defense
+% Advanced Research Projects Agency.
+%
+% © 2019 Massachusetts Institute of Technology.
+%
+%
+% This program is free software; you can redistribute it and/or modify
+% it under the terms of the GNU General Public License version 2 as
+% published by the Free Software Foundation;
+%
+% THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+% AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+% IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+% ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+% LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+% CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+% SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+% INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+% CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+% ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+% POSSIBILITY OF SUCH DAMAGE.
+%
+% Delivered to the U.S. Government with Unlimited Rights, as defined in DFARS
+% Part 252.227-7013 or 7014 (Feb 2014). Notwithstanding any copyright notice,
+% U.S. Government rights in this work are defined by DFARS 252.227-7013 or
+% DFARS 252.227-7014 as detailed above. Use of this work other than as
+% specifically authorized by the U.S. Government may violate any copyrights
+% that exist in this work.
+
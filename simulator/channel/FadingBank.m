@@ -0,0 +1,257 @@
+function out = FadingBank(cmd, arg, t)
+
+% Function simulator/channel/FadingBank.m:
+% Keeps a bank of precomputed Jakes fading sequences, per Doppler bin, so
+% that the taps of large scenarios read their fading from memory instead
+% of summing sinusoids every sample.  A banked tap is a 'bank' chanstate:
+% a sequence of the bank, read from a random offset and rotated by a
+% random phase.  It is used when the global fadingBankMode is set.
+%
+% Each sequence is a 'zheng' sum of sinusoids whose frequencies are
+% rounded to multiples of 1/L, so that it repeats exactly every L
+% samples and can be read cyclically without a seam.  Only every decim-th
+% sample of it is stored, fadingBankLength in all, with decim the power
+% of two that leaves 32 to 64 stored samples per Doppler cycle; the taps
+% are interpolated in between with cubics, as jakesInterp.h does.  So L
+% grows as the Doppler falls, and a bin holds over a thousand Doppler
+% cycles for the default fadingBankLength at any Doppler down to about
+% 1e-6.  Taps whose Doppler is too slow even for the largest decim
+% (fewer than 64 cycles in L samples) are left as 'zheng' taps, which a
+% nonzero jakesInterpTol makes cheap.  A sequence is generated from a
+% seed given by its bin and index, so a saved chanstate gives the same
+% fading in a later session.
+%
+% USAGE: chanstates = FadingBank('assign', chanstates)
+%        seq        = FadingBank('sequence', chanstate)
+%        h          = FadingBank('tap', chanstate, t)
+%        FadingBank('clear')
+%
+% Input arguments:
+%  chanstates (nR x nT cell) Struct array of the chanstates of each lag,
+%             for each antenna pair, as made by the Get*Channel functions
+%  chanstate  (struct) A 'bank' chanstate
+%  t          (vector) Sample times
+%
+% Output arguments:
+%  chanstates (nR x nT cell) The same, with every tap of the link made a
+%             'bank' chanstate.  Unchanged unless every tap is 'zheng'
+%             with the same Doppler and the bin has room for them all
+%             within fadingBankSize sequences of fadingBankMaxUses taps.
+%  seq        (1 x L/decim complex) The stored samples of the sequence
+%             of a 'bank' chanstate, which TVConv interpolates itself
+%  h          (1 x length(t) complex) The tap of a 'bank' chanstate at
+%             the times t
+%
+% 'clear' frees the bank and forgets how often each sequence is used.
+
+%
+% This material is based upon work supported by the Defense Advanced Research
+% Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+% findings, conclusions or recommendations expressed in this material are those
+% of the author(s) and do not necessarily reflect the views of the Defense
+% Advanced Research Projects Agency.
+%
+% © 2019 Massachusetts Institute of Technology.
+%
+%
+% This program is free software; you can redistribute it and/or modify
+% it under the terms of the GNU General Public License version 2 as
+% published by the Free Software Foundation;
+%
+% THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+% AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+% IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+% ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+% LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+% CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+% SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+% INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+% CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+% ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+% POSSIBILITY OF SUCH DAMAGE.
+%
+% Delivered to the U.S. Government with Unlimited Rights, as defined in DFARS
+% Part 252.227-7013 or 7014 (Feb 2014). Notwithstanding any copyright notice,
+% U.S. Government rights in this work are defined by DFARS 252.227-7013 or
+% DFARS 252.227-7014 as detailed above. Use of this work other than as
+% specifically authorized by the U.S. Government may violate any copyrights
+% that exist in this work.
+
+global fadingBankLength
+global fadingBankSize
+global fadingBankMaxUses
+global fadingBankBinRes
+
+persistent bank % Bins keyed by bin, stored length and decimation
+
+minCycles = 64;      % Doppler cycles in a sequence, at least
+nSin = 8;            % Sinusoids in a sequence, as a 'zheng' chanstate
+stepCycles = 1/32;   % Doppler cycles per stored sample, at most
+maxDecim = 65536;    % JAKESINTERP_MAX_DECIM of jakesInterp.h
+
+if isempty(bank)
+    bank = containers.Map('KeyType', 'char', 'ValueType', 'any');
+end
+
+switch lower(cmd)
+  case 'assign'
+    out = arg;
+    chanstates = arg;
+    nTaps = sum(cellfun(@length, chanstates(:)));
+    if nTaps == 0 || ~strcmpi(chanstates{1}(1).method, 'zheng')
+        return
+    end
+    doppf = chanstates{1}(1).doppf;
+    for pairLoop = 1:numel(chanstates)
+        if any(~strcmpi({chanstates{pairLoop}.method}, 'zheng')) ...
+                || any([chanstates{pairLoop}.doppf] ~= doppf)
+            return
+        end
+    end
+
+    % Doppler bins are fadingBankBinRes wide, relative to their center.
+    % Their sequences store fadingBankLength samples, decim apart
+    Lc = fadingBankLength;
+    bin = round(log(doppf)/log(1 + fadingBankBinRes));
+    binDoppf = (1 + fadingBankBinRes)^bin;
+    decim = 2^min(log2(maxDecim), max(0, floor(log2(stepCycles/binDoppf))));
+    L = Lc*decim;
+    if binDoppf*L < minCycles
+        return
+    end
+    key = sprintf('%d/%d/%d', bin, Lc, decim);
+    if isKey(bank, key)
+        entry = bank(key);
+    else
+        entry = struct('seqs', {{}}, 'uses', zeros(0, 1));
+    end
+    if nTaps > fadingBankSize*fadingBankMaxUses - sum(entry.uses)
+        return
+    end
+
+    for pairLoop = 1:numel(chanstates)
+        cs = struct('doppf', binDoppf, 'bin', bin, 'seqLen', L, ...
+                    'decim', decim, 'seq', 0, 'offset', 0, 'rot', 1, ...
+                    'method', 'bank');
+        cs = repmat(cs, 1, length(chanstates{pairLoop}));
+        for lLoop = 1:length(cs)
+            % Spread the taps over as many sequences as the bank holds
+            [nUses, seq] = min(entry.uses);
+            if isempty(seq) || (nUses > 0 && length(entry.uses) < fadingBankSize)
+                seq = length(entry.uses) + 1;
+                entry.seqs{seq} = BankSequence(binDoppf, bin, seq, Lc, decim, nSin);
+                entry.uses(seq, 1) = 0;
+            end
+            entry.uses(seq) = entry.uses(seq) + 1;
+            cs(lLoop).seq    = seq;
+            cs(lLoop).offset = floor(L*rand);
+            cs(lLoop).rot    = exp(1j*2*pi*rand);
+        end
+        out{pairLoop} = cs;
+    end
+    bank(key) = entry;
+
+  case 'sequence'
+    cs = arg;
+    decim = BankDecim(cs);
+    Lc = cs.seqLen/decim;
+    key = sprintf('%d/%d/%d', cs.bin, Lc, decim);
+    if isKey(bank, key)
+        entry = bank(key);
+    else
+        entry = struct('seqs', {{}}, 'uses', zeros(0, 1));
+    end
+    % A chanstate saved by an earlier session has to rebuild its sequence
+    for seq = length(entry.seqs)+1:cs.seq
+        entry.seqs{seq} = BankSequence(cs.doppf, cs.bin, seq, Lc, decim, nSin);
+        entry.uses(seq, 1) = 0;
+        bank(key) = entry;
+    end
+    out = entry.seqs{cs.seq};
+
+  case 'tap'
+    % Cubic through the 4 stored samples around each time, as TVConv
+    % interpolates them
+    cs = arg;
+    seq = FadingBank('sequence', cs);
+    Lc = length(seq);
+    u = mod(cs.offset + t, cs.seqLen)/BankDecim(cs);
+    j = floor(u);
+    x = u - j;
+    out = cs.rot*(-x.*(x - 1).*(x - 2)/6.*seq(mod(j - 1, Lc) + 1) ...
+                  + (x + 1).*(x - 1).*(x - 2)/2.*seq(mod(j, Lc) + 1) ...
+                  - (x + 1).*x.*(x - 2)/2.*seq(mod(j + 1, Lc) + 1) ...
+                  + (x + 1).*x.*(x - 1)/6.*seq(mod(j + 2, Lc) + 1));
+
+  case 'clear'
+    bank = [];
+
+  otherwise
+    error('FadingBank: unknown command %s', cmd);
+end
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+function decim = BankDecim(cs)
+% Samples between the stored samples of a 'bank' chanstate; those saved
+% before sequences were decimated stored every sample
+
+if isfield(cs, 'decim')
+    decim = cs.decim;
+else
+    decim = 1;
+end
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+function h = BankSequence(doppf, bin, seq, Lc, decim, M)
+% The 'zheng' sum of M sinusoids, its frequencies rounded to multiples of
+% 1/L, over one period of L = Lc*decim samples, at every decim-th sample.
+% Each sinusoid is a pair of frequency bins, so the stored samples are
+% the inverse FFT of a sparse spectrum of Lc bins.
+
+rs = RandStream('mt19937ar', 'Seed', mod(bin*65537 + seq, 2^32));
+theta = 2*pi*rand(rs, 1, 1);
+alph  = (2*pi*(1:M)' - pi + theta)/(4*M);
+phi   = 2*pi*rand(rs, M, 1);
+sphi  = 2*pi*rand(rs, M, 1);
+
+L = Lc*decim;
+kc = round(doppf*cos(alph)*L);
+ks = round(doppf*sin(alph)*L);
+bins = mod([kc; -kc; ks; -ks], Lc) + 1;
+amps = Lc*[exp(1j*phi); exp(-1j*phi); 1j*exp(1j*sphi); 1j*exp(-1j*sphi)];
+X = accumarray(bins, amps, [Lc, 1]);
+h = sqrt(1/(4*M))*ifft(X).';
+
+%
+% This material is based upon work supported by the Defense Advanced Research
+% Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+% findings, conclusions or recommendations expressed in this material are those
+% of the author(s) and do not necessarily reflect the views of the Defense
+% Advanced Research Projects Agency.
+%
+% © 2019 Massachusetts Institute of Technology.
+%
+%
+% This program is free software; you can redistribute it and/or modify
+% it under the terms of the GNU General Public License version 2 as
+% published by the Free Software Foundation;
+%
+% THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+% AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+% IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+% ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+% LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+% CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+% SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+% INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+% CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+% ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+% POSSIBILITY OF SUCH DAMAGE.
+%
+% Delivered to the U.S. Government with Unlimited Rights, as defined in DFARS
+% Part 252.227-7013 or 7014 (Feb 2014). Notwithstanding any copyright notice,
+% U.S. Government rights in this work are defined by DFARS 252.227-7013 or
+% DFARS 252.227-7014 as detailed above. Use of this work other than as
+% specifically authorized by the U.S. Government may violate any copyrights
+% that exist in this work.
+
@@ -0,0 +1,354 @@
+function [pass, results] = FadingConformance(doppf, nRuns, nCycles)
+
+% Function simulator/channel/FadingConformance.m:
+% Headless statistical check of every way the simulator can generate
+% 'zheng' Jakes fading.  For each generator mode it makes nRuns
+% independent taps and computes what the Plot branch of jakes4 shows,
+% numerically and without pausing:
+%   - the autocorrelation, against J0(2 pi doppf tau), up to three
+%     Doppler periods, and those of the in-phase and quadrature parts,
+%     against the exact sum's
+%   - the I/Q cross-correlation, against zero
+%   - the mean power, against one
+%   - the envelope distribution, against Rayleigh (Kolmogorov-Smirnov
+%     distance)
+%   - the power outside 1.1 doppf of the (Hann-windowed) spectrum
+% and passes or fails each against a tolerance band.  The modes are the
+% exact sum of sinusoids, the cosine tables of the MEX generators at
+% several sizes, their polynomial NCO, decimated-interpolated taps, the
+% sequence bank (see FadingBank), which is cleared before and after, and
+% the taps TVConv generates itself from a Jakes channel struct, as
+% ProcessIidChannel passes them, both from 'zheng' and 'bank'
+% chanstates.  Without the MEX functions every mode but the bank falls
+% back to the exact sum.
+%
+% By default every mode runs twice: at doppf = 0.01, a wide-band check
+% that is quick and sees every generator's spectrum at a coarse scale,
+% and at doppf = 1e-5, the Doppler of production scenarios, where the
+% taps run for 1e7 samples, decimated taps and bank sequences skip
+% thousands of samples between evaluations and the phases grow large.
+% The bank's period grows with 1/doppf on its own (see FadingBank), so
+% fadingBankLength keeps its default in both.
+%
+% USAGE: [pass, results] = FadingConformance(doppf, nRuns, nCycles)
+%
+% Input arguments:
+%  doppf    (double) Doppler frequency over the sample rate; both 0.01
+%           and 1e-5 by default
+%  nRuns    (int) Independent taps per mode, 32 by default
+%  nCycles  (int) Doppler cycles per tap, 200 by default (100 at
+%           doppf = 1e-5)
+%
+% Output arguments:
+%  pass     (logical) True if every mode is within every band
+%  results  (struct array) For each Doppler and mode its doppf, name,
+%           the statistics acErr, difErr, iqErr, powErr, ksErr and
+%           oobPow, and pass
+
+%
+% This material is based upon work supported by the Defense Advanced Research
+% Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+% findings, conclusions or recommendations expressed in this material are those
+% of the author(s) and do not necessarily reflect the views of the Defense
+% Advanced Research Projects Agency.
+%
+% © 2019 Massachusetts Institute of Technology.
+%
+%
+% This program is free software; you can redistribute it and/or modify
+% it under the terms of the GNU General Public License version 2 as
+% published by the Free Software Foundation;
+%
+% THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+% AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+% IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+% ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+% LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+% CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+% SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+% INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+% CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+% ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+% POSSIBILITY OF SUCH DAMAGE.
+%
+% Delivered to the U.S. Government with Unlimited Rights, as defined in DFARS
+% Part 252.227-7013 or 7014 (Feb 2014). Notwithstanding any copyright notice,
+% U.S. Government rights in this work are defined by DFARS 252.227-7013 or
+% DFARS 252.227-7014 as detailed above. Use of this work other than as
+% specifically authorized by the U.S. Government may violate any copyrights
+% that exist in this work.
+
+global fadingBankLength
+global fadingBankSize
+global fadingBankMaxUses
+global fadingBankBinRes
+
+% Doppler and cycles per tap of each run of the modes
+if nargin < 1 || isempty(doppf)
+    regimes = [0.01, 200; ...  % Wide-band
+               1e-5, 100];     % Production
+else
+    regimes = [doppf, 200];
+end
+if nargin < 2 || isempty(nRuns)
+    nRuns = 32;
+end
+if nargin >= 3 && ~isempty(nCycles)
+    regimes(:, 2) = nCycles;
+end
+
+% Tolerance bands.  With the defaults the exact sum is well within
+% them: they leave room for the variance of the estimates and for M = 8
+% sinusoids only approaching Jakes, and flag a generator whose Doppler,
+% balance or envelope is visibly off.  The in-phase and quadrature parts
+% of the chanstates GetWssusChannel makes are not each J0/2 (theta spans
+% [0, 2 pi) rather than [-pi, pi)), so only their sum is held to J0 and
+% the parts are held to those of the exact sum over the same chanstates.
+acTol  = 0.03;  % max |Rii + Rqq - J0(2 pi f tau)|, for unit power
+difTol = 0.01;  % max |Rii - Rii exact|, |Rqq - Rqq exact|, times 2
+iqTol  = 0.05;  % max |Riq(tau)|, times 2
+powTol = 0.05;  % |mean power - 1|
+ksTol  = 0.04;  % Kolmogorov-Smirnov distance of |h| from Rayleigh
+oobTol = 1e-3;  % Power fraction beyond 1.1 doppf
+
+% The bank's defaults, when InitGlobals has not been run
+if isempty(fadingBankLength),  fadingBankLength  = 2^16; end
+if isempty(fadingBankSize),    fadingBankSize    = 16;   end
+if isempty(fadingBankMaxUses), fadingBankMaxUses = 32;   end
+if isempty(fadingBankBinRes),  fadingBankBinRes  = 0.05; end
+
+% Mode name, then jakes4's (or TVConv's) tol, cosTol, lutSize and
+% lutInterp
+modes = {'exact',                  [],   [],   [],    ''; ...
+         'table nearest 256',      0,    0,    256,   'nearest'; ...
+         'table nearest 4096',     0,    0,    4096,  'nearest'; ...
+         'table linear 64',        0,    0,    64,    'linear'; ...
+         'table linear 1024',      0,    0,    1024,  'linear'; ...
+         'polynomial NCO 1e-6',    0,    1e-6, 1024,  'linear'; ...
+         'decimated 1e-3',         1e-3, 1e-9, 1024,  'linear'; ...
+         'decimated 1e-6',         1e-6, 1e-9, 1024,  'linear'; ...
+         'TVConv struct',          0,    [],   [],    ''; ...
+         'TVConv struct 1e-3',     1e-3, [],   [],    ''; ...
+         'bank',                   [],   [],   [],    ''; ...
+         'TVConv struct bank',     0,    [],   [],    ''};
+
+start = 1000;
+M = 8;
+
+results = struct('doppf', {}, 'mode', {}, 'acErr', {}, 'difErr', {}, ...
+                 'iqErr', {}, 'powErr', {}, 'ksErr', {}, 'oobPow', {}, ...
+                 'pass', {});
+for gLoop = 1:size(regimes, 1)
+    doppf = regimes(gLoop, 1);
+    nS = round(regimes(gLoop, 2)/doppf);
+    cs = ZhengStates(M, doppf, nRuns);
+
+    % The same taps, banked
+    FadingBank('clear');
+    bcs = FadingBank('assign', {cs});
+    bcs = bcs{1};
+    if ~strcmpi(bcs(1).method, 'bank')
+        error('FadingConformance: doppf %g is too slow for the bank', doppf);
+    end
+
+    fprintf(1, '\ndoppf %g, %d taps of %d samples\n', doppf, nRuns, nS);
+    fprintf(1, '%-22s %9s %9s %9s %9s %9s %9s\n', 'mode', 'acErr', 'difErr', ...
+            'iqErr', 'powErr', 'ksErr', 'oobPow');
+    for mLoop = 1:size(modes, 1)
+        mode = modes{mLoop, 1};
+        banked = ~isempty(strfind(mode, 'bank'));
+        if banked
+            f = bcs(1).doppf; % The bin center
+        else
+            f = doppf;
+        end
+
+        % One tap at a time, since at production Dopplers they are long
+        sums = [];
+        for rLoop = 1:nRuns
+            switch mode
+              case 'exact'
+                h = ZhengExact(start, nS, cs(rLoop));
+              case 'bank'
+                h = jakes4(start, nS, bcs(rLoop));
+              case {'TVConv struct', 'TVConv struct 1e-3'}
+                H = struct('chanstates', cs(rLoop), 'gains', 1, ...
+                           'start', start, 'nSamples', nS, ...
+                           'tol', modes{mLoop, 2});
+                h = TVConv(H, 0, ones(nS, 1), 0);
+              case 'TVConv struct bank'
+                seqs = {FadingBank('sequence', bcs(rLoop))};
+                H = struct('chanstates', bcs(rLoop), 'gains', 1, ...
+                           'start', start, 'nSamples', nS, ...
+                           'tol', modes{mLoop, 2}, 'seqs', {seqs});
+                h = TVConv(H, 0, ones(nS, 1), 0);
+              otherwise
+                h = jakes4(start, nS, cs(rLoop), 0, modes{mLoop, 2:5});
+            end
+            sums = FadingSums(sums, h, f);
+        end
+
+        % The parts are held to those of the exact sum, or of the bank for
+        % a banked mode, over the same chanstates
+        [r, Rii, Rqq] = FadingStats(sums, f);
+        if strcmp(mode, 'exact')
+            RiiExact = Rii;
+            RqqExact = Rqq;
+        elseif strcmp(mode, 'bank')
+            RiiBank = Rii;
+            RqqBank = Rqq;
+        end
+        if strcmp(mode, 'bank')
+            r.difErr = NaN; % Other sequences than the exact sum's
+        elseif banked
+            r.difErr = 2*max(max(abs(Rii - RiiBank)), max(abs(Rqq - RqqBank)));
+        else
+            r.difErr = 2*max(max(abs(Rii - RiiExact)), max(abs(Rqq - RqqExact)));
+        end
+
+        r.doppf = doppf;
+        r.mode = mode;
+        r.pass = r.acErr <= acTol && ~(r.difErr > difTol) && r.iqErr <= iqTol ...
+                 && r.powErr <= powTol && r.ksErr <= ksTol && r.oobPow <= oobTol;
+        results(end+1) = orderfields(r, {'doppf', 'mode', 'acErr', 'difErr', ...
+                                         'iqErr', 'powErr', 'ksErr', ...
+                                         'oobPow', 'pass'}); %#ok<AGROW>
+        fprintf(1, '%-22s %9.2e %9.2e %9.2e %9.2e %9.2e %9.2e  %s\n', r.mode, ...
+                r.acErr, r.difErr, r.iqErr, r.powErr, r.ksErr, r.oobPow, ...
+                PassStr(r.pass));
+    end
+    FadingBank('clear');
+end
+pass = all([results.pass]);
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+function sums = FadingSums(sums, h, f)
+% Add the tap h (a row) at Doppler f to the sums of its statistics,
+% [] to start.  Only 20 envelope samples per Doppler cycle are kept for
+% the Kolmogorov-Smirnov distance, which bounds its memory at production
+% Dopplers
+
+nS = length(h);
+maxLag = ceil(3/f);
+nfft = 2^nextpow2(nS + maxLag);
+tau = 0:maxLag;
+if isempty(sums)
+    sums = struct('n', 0, 'Rii', zeros(1, maxLag+1), ...
+                  'Rqq', zeros(1, maxLag+1), 'Riq', zeros(1, 2*maxLag+1), ...
+                  'oob', 0, 'pow', 0, 'env', []);
+end
+
+% Unbiased correlations, by FFT rather than xcorr so that no toolbox is
+% needed
+I = fft(real(h), nfft);
+Q = fft(imag(h), nfft);
+rii = real(ifft(I.*conj(I)));
+rqq = real(ifft(Q.*conj(Q)));
+riq = real(ifft(I.*conj(Q)));
+clear I Q
+sums.Rii = sums.Rii + rii(1:maxLag+1)./(nS - tau);
+sums.Rqq = sums.Rqq + rqq(1:maxLag+1)./(nS - tau);
+sums.Riq = sums.Riq + [riq(end-maxLag+1:end)./(nS - (maxLag:-1:1)), ...
+                       riq(1:maxLag+1)./(nS - tau)];
+clear rii rqq riq
+
+win = 0.5 - 0.5*cos(2*pi*(0:nS-1)/nS); % Hann
+nu = (0:nfft-1)/nfft;
+nu(nu >= 0.5) = nu(nu >= 0.5) - 1;
+S = abs(fft(win.*h, nfft)).^2;
+sums.oob = sums.oob + sum(S(abs(nu) > 1.1*f))/sum(S);
+
+sums.pow = sums.pow + sum(abs(h).^2)/nS;
+sums.env = [sums.env, abs(h(1:max(1, floor(0.05/f)):end))];
+sums.n = sums.n + 1;
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+function [r, Rii, Rqq] = FadingStats(sums, f)
+% Statistics of the taps summed by FadingSums at Doppler f, and the
+% autocorrelations of their parts, averaged over the taps
+
+maxLag = ceil(3/f);
+J0 = besselj(0, 2*pi*f*(0:maxLag));
+Rii = sums.Rii/sums.n;
+Rqq = sums.Rqq/sums.n;
+Riq = sums.Riq/sums.n;
+
+r.acErr  = max(abs(Rii + Rqq - J0));
+r.iqErr  = 2*max(abs(Riq));
+r.powErr = abs(sums.pow/sums.n - 1);
+env = sort(sums.env(:));
+n = numel(env);
+cdf = 1 - exp(-env.^2); % Rayleigh of unit power
+r.ksErr  = max(max((1:n)'/n - cdf), max(cdf - (0:n-1)'/n));
+r.oobPow = sums.oob/sums.n;
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+function h = ZhengExact(start, nS, cs)
+% The exact sum of sinusoids of each 'zheng' chanstate, as the zheng
+% subfunction of jakes4
+t = start:start+nS-1;
+h = zeros(length(cs), nS);
+for tLoop = 1:length(cs)
+    c = cs(tLoop);
+    for mLoop = 1:c.M
+        h(tLoop, :) = h(tLoop, :) ...
+            + 2*cos(2*pi*c.doppf*cos(c.alph(mLoop))*t + c.phi(mLoop)) ...
+            + 1j*2*cos(2*pi*c.doppf*sin(c.alph(mLoop))*t + c.sphi(mLoop));
+    end
+    h(tLoop, :) = sqrt(1/(4*c.M))*h(tLoop, :);
+end
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+function cs = ZhengStates(M, doppf, nTaps)
+% nTaps 'zheng' chanstates, as GetWssusChannel makes them
+for tLoop = nTaps:-1:1
+    cs(tLoop).doppf  = doppf;
+    cs(tLoop).M      = M;
+    cs(tLoop).theta  = 2*pi*rand;
+    cs(tLoop).alph   = (2*pi*(1:M)' - pi + cs(tLoop).theta)/(4*M);
+    cs(tLoop).phi    = 2*pi*rand(M, 1);
+    cs(tLoop).sphi   = 2*pi*rand(M, 1);
+    cs(tLoop).method = 'zheng';
+end
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+function s = PassStr(pass)
+if pass
+    s = 'pass';
+else
+    s = 'FAIL';
+end
+
+%
+% This material is based upon work supported by the Defense Advanced Research
+% Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+% findings, conclusions or recommendations expressed in this material are those
+% of the author(s) and do not necessarily reflect the views of the Defense
+% Advanced Research Projects Agency.
+%
+% © 2019 Massachusetts Institute of Technology.
+%
+%
+% This program is free software; you can redistribute it and/or modify
+% it under the terms of the GNU General Public License version 2 as
+% published by the Free Software Foundation;
+%
+% THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+% AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+% IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+% ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+% LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+% CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+% SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+% INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+% CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+% ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+% POSSIBILITY OF SUCH DAMAGE.
+%
+% Delivered to the U.S. Government with Unlimited Rights, as defined in DFARS
+% Part 252.227-7013 or 7014 (Feb 2014). Notwithstanding any copyright notice,
+% U.S. Government rights in this work are defined by DFARS 252.227-7013 or
+% DFARS 252.227-7014 as detailed above. Use of this work other than as
+% specifically authorized by the U.S. Government may violate any copyrights
+% that exist in this work.
+
@@ -55,6 +55,7 @@ function channel = GetIidChannel(nodeTx, modTx, nodeRx, modRx, ...
 
 global includePropagationDelay
 global includeFractionalDelay
+global fadingBankMode
 
 % Build transmitter node struct
 txnode.location = nodeTx.location;
@@ -245,6 +246,11 @@ riceMatrix = exp( 1j*(phase + ricePhaseRad) ) / sqrt(totalPathLossLin);
 %fakeHpow = 1;
 %riceMatrix = sqrt(fakeHpow)/norm(riceMatrix, 'fro')*riceMatrix;
 
+% Read the fading of the taps from the precomputed bank, if enabled
+if fadingBankMode
+  chanstates = FadingBank('assign', chanstates);
+end
+
 % Build the output struct
 channel.chanType        = propParams.chanType;
 channel.powerProfile    = powerProfile;
@@ -252,6 +258,7 @@ channel.longestLag      = FindLongestLag(powerProfile);
 channel.riceMatrix      = riceMatrix;
 channel.riceKdB         = pathLoss.riceKdB;
 channel.chanstates      = chanstates;
+channel.zhengStates     = PackZhengStates(chanstates); % Packed for zhengBatch
 channel.nPropDelaySamp  = nPropDelaySamp;
 channel.dopplerSpreadHz = dopSpread; % (Hz)
 channel.ricePhaseRad    = ricePhaseRad;
@@ -56,6 +56,7 @@ function channel = GetWssusChannel(nodeTx, modTx, nodeRx, modRx, ...
 global includePropagationDelay
 global includeFractionalDelay
 global DisplayLLAMACommWarnings
+global fadingBankMode
 
 % Build transmitter node struct
 txnode.location = nodeTx.location;
@@ -288,6 +289,11 @@ riceMatrix = exp( 1j*(phase + ricePhaseRad) ) / sqrt(totalPathLossLin);
 %fakeHpow = 1;
 %riceMatrix = sqrt(fakeHpow)/norm(riceMatrix, 'fro')*riceMatrix;
 
+% Read the fading of the taps from the precomputed bank, if enabled
+if fadingBankMode
+  chanstates = FadingBank('assign', chanstates);
+end
+
 % Build the output struct
 channel.chanType        = propParams.chanType;
 channel.powerProfile    = powerProfile;
@@ -295,11 +301,13 @@ channel.longestLag      = FindLongestLag(powerProfile);
 channel.riceMatrix      = riceMatrix;
 channel.riceKdB         = pathLoss.riceKdB;
 channel.chanstates      = chanstates;
+channel.zhengStates     = PackZhengStates(chanstates); % Packed for zhengBatch
 channel.nPropDelaySamp  = nPropDelaySamp;
 channel.dopplerSpreadHz = dopSpread; % (Hz)
 channel.ricePhaseRad    = ricePhaseRad;
 channel.rxCorrMat       = rxCorrMat;
 channel.txCorrMat       = txCorrMat;
+channel.tvconvWs        = TVConv('workspace'); % Scratch reused by every block of this link
 
 if exist('fracDelayFilter', 'var')
   channel.fracDelayFilter = fracDelayFilter;
@@ -57,6 +57,7 @@ function channel = GetWssusWBChannel(nodeTx, modTx, nodeRx, modRx, ...
 %global includePropagationDelay
 %global includeFractionalDelay
 global DisplayLLAMACommWarnings
+global fadingBankMode
 
 % Build transmitter node struct
 txnode.location = nodeTx.location;
@@ -278,6 +279,11 @@ riceMatrix = exp( 1j*(phase + ricePhaseRad) ) / sqrt(totalPathLossLin);
 % Specify Rice matrix (with fixed for r^2 variation between antennas):
 %riceMatrix = exp( 1j*(phase + ricePhaseRad) ) .* ((txRxNodeDelay_samps/sqrt(totalPathLossLin))./delayMatrix);
 
+% Read the fading of the taps from the precomputed bank, if enabled
+if fadingBankMode
+  chanstates = FadingBank('assign', chanstates);
+end
+
 % Build the output struct
 channel.chanType          = propParams.chanType;
 channel.delayMatrix       = delayMatrix;                   % Delays (in samples) between tx/tx pairs
@@ -291,10 +297,12 @@ channel.longestLag        = FindLongestLag(powerProfile);
 channel.riceMatrix        = riceMatrix;
 channel.riceKdB           = pathLoss.riceKdB;
 channel.chanstates        = chanstates;
+channel.zhengStates       = PackZhengStates(chanstates); % Packed for zhengBatch
 channel.dopplerSpreadHz   = dopSpread; % (Hz)
 channel.ricePhaseRad      = ricePhaseRad;
 channel.rxCorrMat         = rxCorrMat;
 channel.txCorrMat         = txCorrMat;
+channel.tvconvWs          = TVConv('workspace');           % Scratch reused by every block of this link
 
 if exist('fracDelayFilter', 'var')
   channel.fracDelayFilter = fracDelayFilter;
@@ -0,0 +1,120 @@
+function zs = PackZhengStates(chanstates)
+
+% Function simulator/channel/PackZhengStates.m:
+% Packs the chanstates of a link into the struct-of-arrays form read by
+% zhengBatch, which makes every Jakes tap of the link in one call.  It is
+% called by the Get*Channel functions, and again by BuildLink when a
+% reciprocal link transposes the chanstates.
+%
+% USAGE: zs = PackZhengStates(chanstates)
+%
+% Input argument:
+%  chanstates (nR x nT cell) Struct array of the chanstates of each lag,
+%             for each antenna pair
+%
+% Output argument:
+%  zs         (struct) M and doppf, shared by all the chanstates, the
+%             M x maxLags x nR x nT arrays alph, phi and sphi, and nLags
+%             (nR x nT), the lags of each pair; lags past nLags are zero
+%             padding.  [] unless every chanstate is 'zheng' with the same
+%             M and doppf.
+
+%
+% This material is based upon work supported by the Defense Advanced Research
+% Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+% findings, conclusions or recommendations expressed in this material are those
+% of the author(s) and do not necessarily reflect the views of the Defense
+% Advanced Research Projects Agency.
+%
+% © 2019 Massachusetts Institute of Technology.
+%
+%
+% This program is free software; you can redistribute it and/or modify
+% it under the terms of the GNU General Public License version 2 as
+% published by the Free Software Foundation;
+%
+% THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+% AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+% IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+% ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+% LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+% CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+% SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+% INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+% CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+% ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+% POSSIBILITY OF SUCH DAMAGE.
+%
+% Delivered to the U.S. Government with Unlimited Rights, as defined in DFARS
+% Part 252.227-7013 or 7014 (Feb 2014). Notwithstanding any copyright notice,
+% U.S. Government rights in this work are defined by DFARS 252.227-7013 or
+% DFARS 252.227-7014 as detailed above. Use of this work other than as
+% specifically authorized by the U.S. Government may violate any copyrights
+% that exist in this work.
+
+zs = [];
+if isempty(chanstates)
+    return
+end
+
+[nR, nT] = size(chanstates);
+nLags = cellfun(@length, chanstates);
+cs1 = chanstates{1}(1);
+if ~strcmpi(cs1.method, 'zheng')
+    return
+end
+M = cs1.M;
+doppf = cs1.doppf;
+
+alph = zeros(M, max(nLags(:)), nR, nT);
+phi = alph;
+sphi = alph;
+for pairLoop = 1:nR*nT
+    cs = chanstates{pairLoop};
+    for lLoop = 1:nLags(pairLoop)
+        if ~strcmpi(cs(lLoop).method, 'zheng') || cs(lLoop).M ~= M ...
+                || cs(lLoop).doppf ~= doppf
+            return
+        end
+        alph(:, lLoop, pairLoop) = cs(lLoop).alph;
+        phi(:, lLoop, pairLoop)  = cs(lLoop).phi;
+        sphi(:, lLoop, pairLoop) = cs(lLoop).sphi;
+    end
+end
+
+zs = struct('M', M, 'doppf', doppf, 'alph', alph, 'phi', phi, ...
+            'sphi', sphi, 'nLags', nLags);
+
+%
+% This material is based upon work supported by the Defense Advanced Research
+% Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+% findings, conclusions or recommendations expressed in this material are those
+% of the author(s) and do not necessarily reflect the views of the Defense
+% Advanced Research Projects Agency.
+%
+% © 2019 Massachusetts Institute of Technology.
+%
+%
+% This program is free software; you can redistribute it and/or modify
+% it under the terms of the GNU General Public License version 2 as
+% published by the Free Software Foundation;
+%
+% THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+% AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+% IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+% ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+% LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+% CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+% SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+% INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+% CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+% ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+% POSSIBILITY OF SUCH DAMAGE.
+%
+% Delivered to the U.S. Government with Unlimited Rights, as defined in DFARS
+% Part 252.227-7013 or 7014 (Feb 2014). Notwithstanding any copyright notice,
+% U.S. Government rights in this work are defined by DFARS 252.227-7013 or
+% DFARS 252.227-7014 as detailed above. Use of this work other than as
+% specifically authorized by the U.S. Government may violate any copyrights
+% that exist in this work.
+
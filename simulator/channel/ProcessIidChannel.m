@@ -47,6 +47,12 @@ function [rxsig] = ProcessIidChannel(startSamp, channel, source)
 % specifically authorized by the U.S. Government may violate any copyrights
 % that exist in this work.
 
+global channelKernelThreads
+global jakesInterpTol
+global jakesCosTol
+global jakesLutSize
+global jakesLutInterp
+
 % Specify the number of receivers and transmitters
 [nR, nT] = size(channel.powerProfile);
 
@@ -82,12 +88,22 @@ if nS < 1
 end
 
 chanstates = channel.chanstates;
+if isfield(channel, 'tvconvWs')
+    tvconvWs = channel.tvconvWs; % Scratch memory kept by the TVConv MEX
+else
+    tvconvWs = [];
+end
 riceKlin   = 10^(0.1*channel.riceKdB);
 if isinf(riceKlin)
     inds = (1:nS) + channel.longestLag - channel.powerProfile(1, 1).riceLag;
     rxsig = channel.riceMatrix*source(:, inds);
 else
 
+    % Start from the Rice tap; the diffuse taps are accumulated onto it
+    inds = (1:nS) + channel.longestLag - channel.powerProfile(1, 1).riceLag;
+    riceMat = sqrt(riceKlin/(riceKlin + 1))*channel.riceMatrix;
+    rxsig = riceMat*source(:, inds);
+
     % transpose the source so multiplication works out
     source = source.';
 
@@ -96,75 +112,99 @@ else
     powerProf = channel.powerProfile;
 
     rxtxDOF = nR*nT;
-    allSigs = zeros(rxtxDOF, nS);
 
     % obtain the first antenna-pair power profile for initialization
     pprofInit = powerProf(1, 1);
-    Hagg = zeros(rxtxDOF, length(pprofInit.lags)*nS);
 
     if(flagCorrTx || flagCorrRx)
 
         numLags = length(pprofInit.lags);
-        for rxtxLoop = 1:rxtxDOF
-
-            chanstateC = chanstates{rxtxLoop};
+        if isfield(channel, 'zhengStates') && ~isempty(channel.zhengStates)
+            % Generate every pair's Jakes processes in one call, one
+            % column per pair
+            Hagg = zhengBatch(channel.zhengStates, startSamp, nS, ...
+                              jakesInterpTol, jakesCosTol, jakesLutSize, ...
+                              jakesLutInterp, channelKernelThreads);
+        else
+            Hagg = zeros(numLags*nS, rxtxDOF);
+            for rxtxLoop = 1:rxtxDOF
 
-            % Get transmitter and receiver out of the combined rxtx indexing
-            rxIndx = 1 + mod(rxtxLoop-1, nR);
-            txIndx = 1 + floor((rxtxLoop-1)/nR);
+                chanstateC = chanstates{rxtxLoop};
 
-            % Generate time-varying channel
-            Hj = jakes4(startSamp, nS, chanstateC);
+                % Generate time-varying channel
+                Hj = jakes4(startSamp, nS, chanstateC, 0, jakesInterpTol, ...
+                            jakesCosTol, jakesLutSize, jakesLutInterp);
 
-            % Aggregate Jakes processes in MIMO-Jakes matrix
-            Hagg(rxtxLoop, :) = Hj(:).';
+                % Aggregate Jakes processes in MIMO-Jakes matrix
+                Hagg(:, rxtxLoop) = Hj(:);
+            end
         end
 
-        Hcorr = sqrtm(Rf)*Hagg; % correlate the Jakes processes
+        % correlate the Jakes processes, which are the columns of Hagg
+        Hcorr = Hagg*sqrtm(Rf).';
+        Hagg = []; %#ok - Hagg no longer needed
 
     end
 
-    %parfor rxtxLoop = 1:rxtxDOF
-    for rxtxLoop = 1:rxtxDOF
-        rxIndx = 1 + mod(rxtxLoop-1, nR);
-        txIndx = 1 + floor((rxtxLoop-1)/nR);
-
-        % Generate time-varying channel
-        if(flagCorrTx || flagCorrRx) % if spatial-correlation is on
-
-            H = reshape(Hcorr(rxtxLoop, :), numLags, nS);
-            pprof = pprofInit;
-        else
-            chanstate = chanstates{rxtxLoop};
-            pprof = powerProf(rxtxLoop);
-            % rLoop = 1+ mod(rxtxLoop-1, nR);
-
-            H = jakes4(startSamp, nS, chanstate);
-        end
-
-        tLoop = 1+floor((rxtxLoop-1)/nR);
-        % Apply power profile
-        %pows = pprof.pows /sqrt(riceKlin + 1);
-        pows = pprof.pows /(riceKlin + 1);
-
-        % H = H.*repmat(sqrt(pows(:)), 1, nS);
-        % H = bsxfun(@times, H, sqrt(pows(:)));
-        H = H.*(sqrt(pows(:))*nS_ones);
-
-        % Get ready for convolution
-        H = H.';
+    % Convolve each receive antenna's channels with all of the transmit
+    % signals in one call, which sums over transmitters natively and adds
+    % the result onto the Rice tap
+    Hs = cell(1, nT);
+    lagsTx = cell(1, nT);
+    for rxLoop = 1:nR
+        for tLoop = 1:nT
+            rxtxLoop = rxLoop + (tLoop-1)*nR;
 
-        allSigs(rxtxLoop, :) = TVConv(H, pprof.lags, source(:, tLoop), longestLag);
-    end % END rLoop
-
-    rxsig = reshape(sum(reshape(allSigs, [nR, nT, nS]), 2), [nR, nS]);
-    allSigs = []; %#ok - allSigs no longer needed
-
-    % Do the Rice tap
-    inds = (1:nS) + channel.longestLag - channel.powerProfile(1, 1).riceLag;
-    source = source.';  % Flip the source back
-    riceMat = sqrt(riceKlin/(riceKlin + 1))*channel.riceMatrix;
-    rxsig = rxsig + riceMat*source(:, inds);
+            % Generate time-varying channel
+            if(flagCorrTx || flagCorrRx) % if spatial-correlation is on
+
+                H = reshape(Hcorr(:, rxtxLoop), numLags, nS);
+                pprof = pprofInit;
+
+                % Apply power profile
+                %pows = pprof.pows /sqrt(riceKlin + 1);
+                pows = pprof.pows /(riceKlin + 1);
+
+                % H = H.*repmat(sqrt(pows(:)), 1, nS);
+                % H = bsxfun(@times, H, sqrt(pows(:)));
+                H = H.*(sqrt(pows(:))*nS_ones);
+            else
+                chanstate = chanstates{rxtxLoop};
+                pprof = powerProf(rxtxLoop);
+
+                % Apply power profile
+                pows = pprof.pows /(riceKlin + 1);
+
+                tapMethods = lower({chanstate.method});
+                if ~all(ismember(tapMethods, {'zheng', 'constant', 'bank'}))
+                    % TVConv only generates 'zheng', 'constant' and 'bank'
+                    % taps: any other method goes through jakes4
+                    H = jakes4(startSamp, nS, chanstate);
+                    H = H.*(sqrt(pows(:))*nS_ones);
+                else
+                    % TVConv generates the Jakes taps as it convolves, so
+                    % the nLags x nS matrix jakes4 would give is never
+                    % built; banked taps interpolate their stored sequences
+                    seqs = cell(1, length(chanstate));
+                    for lLoop = find(strcmp(tapMethods, 'bank'))
+                        seqs{lLoop} = FadingBank('sequence', chanstate(lLoop));
+                    end
+                    H = struct('chanstates', chanstate, 'gains', sqrt(pows(:)), ...
+                               'start', startSamp, 'nSamples', nS, ...
+                               'tol', jakesInterpTol, 'seqs', {seqs});
+                end
+            end
+
+            % TVConv reads the nLags x nS matrix directly, no transpose needed
+            Hs{tLoop} = H;
+            lagsTx{tLoop} = pprof.lags;
+        end % END tLoop
+
+        rxsig(rxLoop, :) = TVConv(Hs, lagsTx, source, longestLag, ...
+                                  channelKernelThreads, 'lagMajor', ...
+                                  rxsig(rxLoop, :), [], tvconvWs);
+    end % END rxLoop
+    Hs = []; %#ok - Hs no longer needed
 end
 
 %
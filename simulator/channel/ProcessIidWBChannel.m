@@ -48,6 +48,12 @@ function [rxsig] = ProcessIidWBChannel(startSamp, channel, source)
 % that exist in this work.
 
 
+global channelKernelThreads
+global jakesInterpTol
+global jakesCosTol
+global jakesLutSize
+global jakesLutInterp
+
 % Specify the number of receivers and transmitters
 [nR, nT] = size(channel.powerProfile);
 
@@ -85,6 +91,11 @@ if nS < 1
 end
 
 chanstates = channel.chanstates;
+if isfield(channel, 'tvconvWs')
+    tvconvWs = channel.tvconvWs; % Scratch memory kept by the TVConv MEX
+else
+    tvconvWs = [];
+end
 riceKlin   = 10^(0.1*channel.riceKdB);
 if riceKlin > 1e8
     % This is a hack so that riceKlin -> infinity is handled
@@ -105,103 +116,142 @@ delayFiltHalfLen = (nDelayFiltLen-1)/2;
 tDelayFilt = -delayFiltHalfLen:delayFiltHalfLen;
 
 rxtxDOF = nR*nT;
-allSigs = zeros(rxtxDOF, nS);
 
 % obtain the first antenna-pair power profile for initialization
 pprofInit = powerProf(1, 1);
 
-Hagg = zeros(rxtxDOF, length(pprofInit.lags)*nS);
-
 if(flagCorrTx || flagCorrRx)
 
     numLags = length(pprofInit.lags);
-    for rxtxLoop = 1:rxtxDOF
-
-        chanstateC = chanstates{rxtxLoop};
+    if isfield(channel, 'zhengStates') && ~isempty(channel.zhengStates)
+        % Generate every pair's Jakes processes in one call, one column
+        % per pair
+        Hagg = zhengBatch(channel.zhengStates, startSamp, nS, ...
+                          jakesInterpTol, jakesCosTol, jakesLutSize, ...
+                          jakesLutInterp, channelKernelThreads);
+    else
+        Hagg = zeros(numLags*nS, rxtxDOF);
+        for rxtxLoop = 1:rxtxDOF
 
-        % Get transmitter and receiver out of the combined rxtx indexing
-        rxIndx = 1 + mod(rxtxLoop-1, nR);
-        txIndx = 1 + floor((rxtxLoop-1)/nR);
+            chanstateC = chanstates{rxtxLoop};
 
-        % Generate time-varying channel
-        Hj = jakes4(startSamp, nS, chanstateC);
+            % Generate time-varying channel
+            Hj = jakes4(startSamp, nS, chanstateC, 0, jakesInterpTol, ...
+                        jakesCosTol, jakesLutSize, jakesLutInterp);
 
-        % Aggregate Jakes processes in MIMO-Jakes matrix
-        Hagg(rxtxLoop, :) = Hj(:).';
+            % Aggregate Jakes processes in MIMO-Jakes matrix
+            Hagg(:, rxtxLoop) = Hj(:);
+        end
     end
 
-    Hcorr = sqrtm(Rf)*Hagg; % correlate the Jakes processes
+    % correlate the Jakes processes, which are the columns of Hagg
+    Hcorr = Hagg*sqrtm(Rf).';
+    Hagg = []; %#ok - Hagg no longer needed
 
 end
 
 
-% Loop over transmit/receive pairs
-for rxtxLoop = 1:rxtxDOF
-
-    % Get transmitter and receiver out of the combined rxtx indexing
-    rxIndx = 1 + mod(rxtxLoop-1, nR);
-    txIndx = 1 + floor((rxtxLoop-1)/nR);
-
-    % Generate time-varying channel
-    if(flagCorrTx || flagCorrRx) % if spatial-correlation is on
-
-        H = reshape(Hcorr(rxtxLoop, :), numLags, nS);
-        pprof = pprofInit;
-    else
-        chanstate = chanstates{rxtxLoop};
-        pprof = powerProf(rxtxLoop);
-        % rLoop = 1+ mod(rxtxLoop-1, nR);
-
-        H = jakes4(startSamp, nS, chanstate);
-    end
+% Convolve each receive antenna's channels with the per-pair transmit
+% signals in one call, which sums over transmitters natively
+rxsig = zeros(nR, nS);
+Hs = cell(1, nT);
+lagsTx = cell(1, nT);
+srcs = cell(1, nT);
+for rxIndx = 1:nR
+    for txIndx = 1:nT
+        rxtxLoop = rxIndx + (txIndx-1)*nR;
 
-    % Apply power profile
-    pows = pprof.pows /(riceKlin + 1);
-    H = H.*(sqrt(pows(:))*nS_ones);
-
-    % Add the Rice tap
-    H(1+pprof.riceLag, :) = H(1+pprof.riceLag, :) + riceMat(rxIndx, txIndx);
-
-    % Get ready for convolution
-    H = H.';
-
-    % offsetDelaySamp is the delay (in samples) to the antenna with the bulk
-    % (integer part of the smallest delay) removed:
-    offsetDelaySamp = channel.offsetDelayMatrix(rxIndx, txIndx);
-
-    % Decompose offsetDelaySamp into integer and fractional parts:
-    dFix = fix(offsetDelaySamp); % Integer part of the delay (0 for the closest antenna)
-    dFrac = offsetDelaySamp - dFix; % Fractional part of the delay
-
-    % Construct fractional delay filter
-    fracDelayFilter = sinc(tDelayFilt - dFrac);
-
-    %% Apply fractional delay filter
-    %src = conv(source(:, txIndx), fracDelayFilter);
-    %
-    %% Keep the "valid" portion by stripping off (nDelayFiltLen-1)
-    %% samples from both sides added by performing the convolution,
-    %% Note the extra 0.5*(nDelayFiltLen-1) early samples fetched
-    %% in "PropagateToReceiver" guarantee that the first and last
-    %% outputs of filtering+trimming correspond to the first and
-    %% last filtered samples.
-    %src = src((1+(2*delayFiltHalfLen)):end-(2*delayFiltHalfLen));
-
-    % Apply fractional delay filter and strip off 'invalid' portion
-    % (This is equivalent to the conv and chop commented out above)
-    src = conv(source(:, txIndx), fracDelayFilter, 'valid');
-
-    % Remove extra samples added to the beginning
-    % (Antennas with later delays have fewer samples removed)
-    src = src(1+(nodeAntSepSamps-dFix):end);
-
-    % Apply channel matrix
-    allSigs(rxtxLoop, :) = TVConv(H, pprof.lags, src, longestLag);
-
-end % END rxtxLoop
-
-rxsig = reshape(sum(reshape(allSigs, [nR, nT, nS]), 2), [nR, nS]);
-allSigs = []; %#ok - allSigs no longer needed
+        % Generate time-varying channel
+        if(flagCorrTx || flagCorrRx) % if spatial-correlation is on
+
+            H = reshape(Hcorr(:, rxtxLoop), numLags, nS);
+            pprof = pprofInit;
+
+            % Apply power profile
+            pows = pprof.pows /(riceKlin + 1);
+            H = H.*(sqrt(pows(:))*nS_ones);
+
+            % Add the Rice tap
+            H(1+pprof.riceLag, :) = H(1+pprof.riceLag, :) + riceMat(rxIndx, txIndx);
+        else
+            chanstate = chanstates{rxtxLoop};
+            pprof = powerProf(rxtxLoop);
+            % rLoop = 1+ mod(rxtxLoop-1, nR);
+
+            % Apply power profile
+            pows = pprof.pows /(riceKlin + 1);
+
+            tapMethods = lower({chanstate.method});
+            if ~all(ismember(tapMethods, {'zheng', 'constant', 'bank'}))
+                % TVConv only generates 'zheng', 'constant' and 'bank'
+                % taps: any other method goes through jakes4
+                H = jakes4(startSamp, nS, chanstate);
+                H = H.*(sqrt(pows(:))*nS_ones);
+
+                % Add the Rice tap
+                H(1+pprof.riceLag, :) = H(1+pprof.riceLag, :) + riceMat(rxIndx, txIndx);
+            else
+                % Add the Rice tap
+                riceOffsets = zeros(length(pprof.lags), 1);
+                riceOffsets(1+pprof.riceLag) = riceMat(rxIndx, txIndx);
+
+                % TVConv generates the Jakes taps as it convolves, so the
+                % nLags x nS matrix jakes4 would give is never built;
+                % banked taps interpolate their stored sequences
+                seqs = cell(1, length(chanstate));
+                for lLoop = find(strcmp(tapMethods, 'bank'))
+                    seqs{lLoop} = FadingBank('sequence', chanstate(lLoop));
+                end
+                H = struct('chanstates', chanstate, 'gains', sqrt(pows(:)), ...
+                           'start', startSamp, 'nSamples', nS, ...
+                           'tol', jakesInterpTol, ...
+                           'offsets', riceOffsets, 'seqs', {seqs});
+            end
+        end
+
+        % TVConv reads the nLags x nS matrix directly, no transpose needed
+        Hs{txIndx} = H;
+        lagsTx{txIndx} = pprof.lags;
+
+        % offsetDelaySamp is the delay (in samples) to the antenna with the bulk
+        % (integer part of the smallest delay) removed:
+        offsetDelaySamp = channel.offsetDelayMatrix(rxIndx, txIndx);
+
+        % Decompose offsetDelaySamp into integer and fractional parts:
+        dFix = fix(offsetDelaySamp); % Integer part of the delay (0 for the closest antenna)
+        dFrac = offsetDelaySamp - dFix; % Fractional part of the delay
+
+        % Construct fractional delay filter
+        fracDelayFilter = sinc(tDelayFilt - dFrac);
+
+        %% Apply fractional delay filter
+        %src = conv(source(:, txIndx), fracDelayFilter);
+        %
+        %% Keep the "valid" portion by stripping off (nDelayFiltLen-1)
+        %% samples from both sides added by performing the convolution,
+        %% Note the extra 0.5*(nDelayFiltLen-1) early samples fetched
+        %% in "PropagateToReceiver" guarantee that the first and last
+        %% outputs of filtering+trimming correspond to the first and
+        %% last filtered samples.
+        %src = src((1+(2*delayFiltHalfLen)):end-(2*delayFiltHalfLen));
+
+        % Apply fractional delay filter and strip off 'invalid' portion
+        % (This is equivalent to the conv and chop commented out above)
+        src = conv(source(:, txIndx), fracDelayFilter, 'valid');
+
+        % Remove extra samples added to the beginning
+        % (Antennas with later delays have fewer samples removed)
+        srcs{txIndx} = src(1+(nodeAntSepSamps-dFix):end);
+    end % END txIndx
+
+    % Apply channel matrices
+    rxsig(rxIndx, :) = TVConv(Hs, lagsTx, srcs, longestLag, ...
+                              channelKernelThreads, 'lagMajor', ...
+                              [], [], tvconvWs);
+
+end % END rxIndx
+Hs = []; %#ok - Hs no longer needed
+srcs = []; %#ok - srcs no longer needed
 
 % Do the Rice tap
 %inds = (1:nS) + channel.longestLag - channel.powerProfile(1, 1).riceLag;
@@ -49,35 +49,22 @@ function rxsig = ProcessSampledChannel(startSamp, channel, source)
 
 DEBUGGING = 0;
 
+global channelKernelThreads
+
 hTensor         = channel.chanTensor;
 %tMax            = linkobj.propParams.longestCoherBlock;
 freqOffs        = channel.freqOffs;
 phiOffs         = channel.phiOffs;
 %overSamp        = linkobj.propParams.stfcsChannelOversamp;
-[nR, nT, nDop, nDelay] = size(hTensor);
 % nDop            = length(freqOffs);
 % nDelay          = size(hTensor, 4);
 
-%nSamp = blockLengthRx + nDelay - 1;
-nSamp = size(source, 2);
-
-blockLengthRx = nSamp - nDelay + 1;
-
-% Choose computation method: 'fftfilt' or 'filter'
-if log2(nSamp) < nDelay
-  computationMethod = 'fftfilt';
-else
-  computationMethod = 'filter';
-end
-
 if DEBUGGING
   1; %#ok if this line is unreachable
   fprintf(1, '   ''%s:%s''->''%s:%s:%.2fMHz''\n', ...
           linkobj.fromID{1}, linkobj.fromID{2}, ...
           linkobj.toID{1}, linkobj.toID{2}, linkobj.toID{3}/1e6);
-  fprintf(1, ...
-          ['      Building receiver data using ''', computationMethod, ''' method.'])
-  fprintf(1, '\n         ')
+  fprintf(1, '      Building receiver data using StfcsFilter.\n')
 end % END DEGUBBING
 
 %samps = cols(source);
@@ -88,75 +75,16 @@ end % END DEGUBBING
 %else
 %    freqOffs = 0;
 %end
-rxsig = zeros(nR, blockLengthRx);
-switch lower(computationMethod)
-  case 'fftfilt'
-    % Alternate computation of the STF channel using MATLAB's built-in
-    % fftfilt command.
-    for rxLoop = 1:nR % loop through receive antennas
-      for txLoop = 1:nT % loop through transmit antennas
-        for dopLoop = 1:nDop % loop through Doppler taps
-                             % Extract channel impulse response
-          h = squeeze(hTensor(rxLoop, txLoop, dopLoop, :));
-          h = h(:).';  % Make a row vector
-                       % Calculate convolution with the channel
-          if freqOffs(dopLoop) == 0
-            zModFilt = fftfilt(h, source(txLoop, :));
-          else
-            % Modulate the data
-            zMod = exp(1j*(2*pi*freqOffs(dopLoop) ...
-                           *(startSamp:startSamp + nSamp - 1) + phiOffs(dopLoop)))...
-                   .* source(txLoop, :);
-            %                         % Modulate the data
-            %                         zMod = exp(2*pi*freqOffs(dopLoop)*i/samps ...
-            %                             *[startSamp:startSamp + nSamp - 1])...
-            %                             .* source(txLoop, :);
-            zModFilt = fftfilt(h, zMod);
-          end
-          rxsig(rxLoop, :) = rxsig(rxLoop, :) + zModFilt(nDelay:end);
-        end % End loop through doppler taps
-        if DEBUGGING, fprintf(1, '.'), end; %#ok if this line is unreachable
-      end % end TX antenna loop
-        if DEBUGGING, fprintf(1, '\n         '), end; %#ok if this line is unreachable
-    end % end RX antenna loop
-      if DEBUGGING, fprintf(1, '\n'), end; %#ok if this line is unreachable
-      % End fft computation method.
-  case 'filter'
-    % Alternate computation of the STF channel using MATLAB's built-in
-    % filter command.
-    for rxLoop = 1:nR % loop through receive antennas
-      for txLoop = 1:nT % loop through transmit antennas
-        for dopLoop = 1:nDop % loop through Doppler taps
-                             % Extract channel impulse response
-          h = squeeze(hTensor(rxLoop, txLoop, dopLoop, :));
-          h = h(:).';  % Make a row vector
-          nDelay = length(h);
-          % Calculate convolution with the channel
-          if freqOffs(dopLoop) == 0
-            zModFilt = filter(h, 1, source(txLoop, :));
-          else
-            % Modulate the data
-            zMod = exp(1j*(2*pi*freqOffs(dopLoop) ...
-                           *(startSamp:startSamp + nSamp - 1)+ phiOffs(dopLoop)))...
-                   .* source(txLoop, :);
-            %                        % Modulate the data
-            %                         zMod = exp(2*pi*freqOffs(dopLoop)*i/samps ...
-            %                             *[startSamp:startSamp + nSamp - 1])...
-            %                             .* source(txLoop, :);
-            zModFilt = filter(h, 1, zMod);
-          end
-          rxsig(rxLoop, :) = rxsig(rxLoop, :) + zModFilt(nDelay:end);
-        end % End loop through doppler taps
-        if DEBUGGING, fprintf(1, '.'), end; %#ok if this line is unreachable
-      end % end TX antenna loop
-        if DEBUGGING, fprintf(1, '\n         '), end; %#ok if this line is unreachable
-    end % end RX antenna loop
-      if DEBUGGING
-        fprintf(1, '\n'), end; %#ok if this line is unreachable
-      % End filter computation method.
-  otherwise
-    error('Incorrect computation method in propToAn.m: must be either ''fftfilt'' or ''filter''')
-end % END switch over computation method
+
+% Modulate each Doppler tap, filter and sum per receive antenna.  Long
+% filters go through fftfilt (StfcsFftfilt.m), the rest through the
+% direct filter of StfcsFilter (see StfcsFilter.m for the .m version)
+if log2(size(source, 2)) < size(hTensor, 4)
+  rxsig = StfcsFftfilt(startSamp, hTensor, freqOffs, phiOffs, source);
+else
+  rxsig = StfcsFilter(startSamp, hTensor, freqOffs, phiOffs, source, ...
+                      channelKernelThreads);
+end
 
 %
 % This material is based upon work supported by the Defense Advanced Research
@@ -25,73 +25,206 @@
   POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <stdlib.h>
 #include <stdio.h>
-#ifdef MATLAB_MEX_FILE
-#include "mex.h"
+#include <string.h>
 
-void mexFunction(int nlhs, mxArray *plhs[],
-                 int nrhs, const mxArray *prhs[])
-{
-  
+#include "llamachan.h"
+#include "parallelFor.h"
 
-  mwSize dims[2];
-  int nRowsIn, nColsIn, complexIn, classIn;
-  int nRowsOut, nColsOut;
-  int nShifts;
-  double *shifts;
+/* Below this many elements copied stackzsCopy stays single-threaded */
+#define STACKZS_MT_MIN_WORK (1<<20)
 
-  /* Gather Information */
-  classIn = mxGetClassID(*prhs);
-  complexIn = mxIsComplex(*prhs);
-  nRowsIn = mxGetM(*prhs);
-  nColsIn = mxGetN(*prhs);
-  nShifts = mxGetNumberOfElements(prhs[1]);
-  shifts = mxGetPr(prhs[1]);
+/* Output columns per task, for each shift (shift-major) or all of them (stacked) */
+#define STACKZS_BLOCK 4096
+#define STACKZS_STACKED_BLOCK 256
+
+/*
+  One stackzsCopy() call.  A task is one block of output columns, of one
+  shift in the shift-major layout, so the tasks write disjoint parts of
+  the output.
+*/
+typedef struct {
+  char *pOut[2];                              /* Real and imaginary parts, or one */
+  const char *pIn[2];
+  int nParts;
+  size_t elSize;                              /* Bytes per element */
+  int nr, nc, nShifts;
+  const int *pCyc;                            /* First input column of each shift */
+  int layout;
+  int nBlocks;                                /* Blocks per shift, or in all */
+} stackzsJob;
+
+/* Each shift-major page is a cyclic shift of the input: copy it in runs that do not wrap */
+static void stackzsShiftMajorTask(const stackzsJob *job, int iTask)
+{
+  int a = iTask/job->nBlocks;                 /* Shift */
+  int j = (iTask % job->nBlocks)*STACKZS_BLOCK;
+  int jEnd = (job->nc - j < STACKZS_BLOCK) ? job->nc : j + STACKZS_BLOCK;
+  size_t colBytes = job->elSize*job->nr;
+  int m, len, part;
+
+  /* Output column j is input column j + cyc, cyclically */
+  m = (int)(((long)j + job->pCyc[a]) % job->nc);
+  while (j < jEnd)
+    {
+      len = (job->nc - m < jEnd - j) ? job->nc - m : jEnd - j;
+      for (part = 0; part < job->nParts; part++)
+	{
+	  memcpy(job->pOut[part] + colBytes*((size_t)a*job->nc + j),
+		 job->pIn[part] + colBytes*m, colBytes*len);
+	}
+      j += len;
+      m = 0;
+    }
+}
 
-  nRowsOut = nRowsIn*nShifts;
-  nColsOut = nColsIn;
+/* Stacked output columns are written in order, one input column per shift */
+static void stackzsStackedTask(const stackzsJob *job, int iTask)
+{
+  int j = iTask*STACKZS_STACKED_BLOCK;
+  int jEnd = (job->nc - j < STACKZS_STACKED_BLOCK) ? job->nc : j + STACKZS_STACKED_BLOCK;
+  size_t colBytes = job->elSize*job->nr;
+  int a, m, part;
+  char *dst;
 
+  for (part = 0; part < job->nParts; part++)
+    {
+      dst = job->pOut[part] + colBytes*job->nShifts*j;
+      for (; j < jEnd; j++)
+	{
+	  for (a = 0; a < job->nShifts; a++, dst += colBytes)
+	    {
+	      m = j + job->pCyc[a];
+	      m -= (m >= job->nc) ? job->nc : 0;
+	      memcpy(dst, job->pIn[part] + colBytes*m, colBytes);
+	    }
+	}
+      j = iTask*STACKZS_STACKED_BLOCK;
+    }
+}
 
-  /* (int)(*(double *)mxGetData(prhs[1])); */
+static void stackzsTask(void *arg, int iTask)
+{
+  const stackzsJob *job = (const stackzsJob *)arg;
 
-  /* Checks */
-  if ((nRowsOut < 1) || (nColsOut < 1) || (nShifts < 1))
+  if (job->layout == STACKZS_LAYOUT_SHIFT_MAJOR)
     {
-      /* Match corner cases */
-      dims[0] = (nRowsOut > 1 ? nRowsOut: 0);
-      dims[1] = (nColsOut > 0 ? nColsOut: 0);
-      plhs[0] = mxCreateNumericArray(2, dims, classIn, complexIn);
-      return;
+      stackzsShiftMajorTask(job, iTask);
     }
-  if (classIn!=mxDOUBLE_CLASS)
+  else
     {
-      mexErrMsgTxt("One designed to work with double");
+      stackzsStackedTask(job, iTask);
     }
+}
 
-  /* Allocate output space */
-  dims[0] = nRowsOut;
-  dims[1] = nColsOut;
-  plhs[0] = mxCreateNumericArray(2, dims, classIn, complexIn);
+/*
+  Z = Stackzs(z, shifts, layout, nThreads)
+
+  Stack the nShifts circular shifts of the nrIn x ncIn input z: block s
+  of the output is z with its columns cycled by -shifts[s], that is
+  column j of the block is column j - shifts[s] of z, as in Stackzs.m.
+  With layout STACKZS_LAYOUT_STACKED the blocks are the row blocks of an
+  nrIn*nShifts x ncIn output, as Stackzs.m returns them; with
+  STACKZS_LAYOUT_SHIFT_MAJOR they are the consecutive nrIn x ncIn pages
+  of an nrIn x ncIn x nShifts output, each copied in one or two runs.
+
+  The elements are elSize bytes and only copied, so any type works:
+  sizeof(double) or sizeof(float), twice that for (re, im) pairs.  Split
+  complex data is given as pIn_im and pOut_im, copied in the same pass
+  as the real parts; both are NULL otherwise.
+
+  nThreads: 1 runs on the calling thread only, 0 uses one thread per
+  core.  Calls of fewer than STACKZS_MT_MIN_WORK elements always run on
+  the calling thread.
+*/
+int stackzsCopy(void *pOut_re, void *pOut_im, const void *pIn_re, const void *pIn_im,
+		size_t elSize, int nrIn, int ncIn, int nShifts, const double *shifts,
+		int layout, int nThreads)
+{
+  stackzsJob job;
+  int *pCyc;
+  double work;
+  int nTasks, iTask, a;
 
+  if ((NULL == pIn_re) || (NULL == pOut_re) || ((NULL == pIn_im) != (NULL == pOut_im)))
+    {
+      return(1);
+    }
+  if (nrIn < 0)
+    {
+      return(2);
+    }
+  if ((ncIn < 0) || (nShifts < 0))
+    {
+      return(3);
+    }
+  if ((layout != STACKZS_LAYOUT_STACKED) && (layout != STACKZS_LAYOUT_SHIFT_MAJOR))
+    {
+      return(4);
+    }
+  if ((nrIn < 1) || (ncIn < 1) || (nShifts < 1))
+    {
+      return(0);
+    }
+  if (NULL == shifts)
+    {
+      return(1);
+    }
 
-  /* Note: Return values ignored - could add error checks here */
-  (void)Stackzs(mxGetPr(*plhs),
-		mxGetPr(*prhs),
-		nRowsIn, nColsIn,
-		nShifts, shifts);
-  if (complexIn)
+  pCyc = (int *)malloc(nShifts*sizeof(int));
+  if (NULL == pCyc)
     {
-      (void)Stackzs(mxGetPi(*plhs),
-		    mxGetPi(*prhs),
-		    nRowsIn, nColsIn,
-		    nShifts, shifts);
+      return(5);
+    }
+  for (a = 0; a < nShifts; a++)
+    {
+      pCyc[a] = (int)(-((long)shifts[a]) % ncIn);
+      pCyc[a] += (pCyc[a] < 0) ? ncIn : 0;
+    }
 
+  job.pOut[0] = (char *)pOut_re;
+  job.pOut[1] = (char *)pOut_im;
+  job.pIn[0] = (const char *)pIn_re;
+  job.pIn[1] = (const char *)pIn_im;
+  job.nParts = (NULL != pIn_im) ? 2 : 1;
+  job.elSize = elSize;
+  job.nr = nrIn;
+  job.nc = ncIn;
+  job.nShifts = nShifts;
+  job.pCyc = pCyc;
+  job.layout = layout;
+  if (layout == STACKZS_LAYOUT_SHIFT_MAJOR)
+    {
+      job.nBlocks = (ncIn + STACKZS_BLOCK - 1)/STACKZS_BLOCK;
+      nTasks = nShifts*job.nBlocks;
+    }
+  else
+    {
+      job.nBlocks = (ncIn + STACKZS_STACKED_BLOCK - 1)/STACKZS_STACKED_BLOCK;
+      nTasks = job.nBlocks;
+    }
+  work = (double)nrIn*ncIn*nShifts*job.nParts;
+  if ((nThreads != 1) && (nTasks > 1) && (work >= (double)STACKZS_MT_MIN_WORK))
+    {
+      (void)parallelFor(nTasks, nThreads, stackzsTask, &job);
+    }
+  else
+    {
+      for (iTask = 0; iTask < nTasks; iTask++)
+	{
+	  stackzsTask(&job, iTask);
+	}
     }
 
+  free(pCyc);
+  return(0);
 }
-#endif
 
-/*************************************************************************/
+/*
+  Stackzs.m on doubles, stacked and single-threaded: see stackzsCopy()
+  above.
+*/
 int Stackzs(double *ptrOut,
 	    double *ptrIn,
 	    int nrIn,
@@ -99,103 +232,126 @@ int Stackzs(double *ptrOut,
 	    int nShifts,
 	    double *shifts)
 {
+  return(stackzsCopy(ptrOut, NULL, ptrIn, NULL, sizeof(double), nrIn, ncIn, nShifts, shifts,
+		     STACKZS_LAYOUT_STACKED, 1));
+}
 
-  double *inPtr1, *inPtr2;
-  double *outPtr1, *outPtr2, *outPtr3;
-  double *endInPtr;
-  double *endPtr2;
-  double *shiftPtr, *endShifts;
-  int cyc;
-  int nrOut = nrIn*nShifts;
-  /* int ncOut = ncIn; */
+#ifdef MATLAB_MEX_FILE
+#include <mex.h>
 
-  /*
-    function Z=Stackzs(z,shifts)
+#if MX_HAS_INTERLEAVED_COMPLEX
+#define GETDOUBLES mxGetDoubles
+#else
+#define GETDOUBLES mxGetPr
+#endif
 
-    shifts = -shifts ;
-    Z=zeros(size(z,1)*length(shifts),size(z,2));
-    for cnt=1:length(shifts)
-    perm=cycle(size(z,2),shifts(cnt));
-    Z((cnt-1)*size(z,1)+1:cnt*size(z,1),:)=z(:,perm);
-    end
-  */
+/*
+  Z = Stackzs(z, shifts, layout, nThreads)
 
-  /* Some Argument Checks */
-  if ((ptrIn==NULL) || (ptrOut==NULL))
-    {
-      return(1); /*Error */
-    }
-  if (nrIn < 0)
-    {
-      return(2); /*Error */
-    }
-  if (ncIn < 0)
+  z is double or single, real or complex, and Z is of the same type.
+  layout (optional): 'stacked' (the default) for the
+  size(z, 1)*length(shifts) x size(z, 2) stack of Stackzs.m, or
+  'shiftMajor' for a size(z, 1) x size(z, 2) x length(shifts) array
+  whose page s is block s of the stack.
+
+  nThreads (optional): 1 (the default) runs on the calling thread only,
+  0 uses one thread per core, see stackzsCopy() above.
+
+  Built with "mex -R2018a" complex arrays are interleaved (re, im)
+  pairs, copied as elements of twice the size in one pass.
+*/
+void mexFunction(int nlhs, mxArray *plhs[],
+                 int nrhs, const mxArray *prhs[])
+{
+  mwSize dims[3];
+  mxClassID classIn;
+  mxComplexity complexIn;
+  char layoutName[16];
+  size_t elSize;
+  void *pOut_im;
+  const void *pIn_im;
+  int nRowsIn, nColsIn, nShifts;
+  int layout, nThreads, status;
+
+  (void)nlhs;
+  if ((nrhs < 2) || !mxIsDouble(prhs[1]) || mxIsComplex(prhs[1]))
     {
-      return(3); /*Error */
+      mexErrMsgTxt("Stackzs: usage Z = Stackzs(z, shifts, layout, nThreads), shifts double");
     }
-  if (nShifts < 0)
+
+  /* Gather Information */
+  classIn = mxGetClassID(prhs[0]);
+  complexIn = mxIsComplex(prhs[0]) ? mxCOMPLEX : mxREAL;
+  nRowsIn = (int)mxGetM(prhs[0]);
+  nColsIn = (int)mxGetN(prhs[0]);
+  nShifts = (int)mxGetNumberOfElements(prhs[1]);
+  if ((classIn != mxDOUBLE_CLASS) && (classIn != mxSINGLE_CLASS))
     {
-      return(3); /*Error */
+      mexErrMsgTxt("Stackzs: z must be double or single");
     }
 
-  endInPtr = ptrIn+(nrIn*ncIn);
-
-  /* Loop over shifts */
-  for(shiftPtr = shifts, endShifts = shifts+nShifts, outPtr1 = ptrOut;
-      shiftPtr < endShifts;
-      shiftPtr++, outPtr1+=nrIn)
+  layout = STACKZS_LAYOUT_STACKED;
+  if ((nrhs > 2) && !mxIsEmpty(prhs[2]))
     {
-
-      /* Index in to the correct starting column */
-      cyc = -((int) (*shiftPtr))%ncIn;
-      if (cyc < 0)
+      if (!mxIsChar(prhs[2]) || mxGetString(prhs[2], layoutName, sizeof(layoutName)))
 	{
-	  cyc+=ncIn;
+	  mexErrMsgTxt("Stackzs: layout must be 'stacked' or 'shiftMajor'");
 	}
-
-      inPtr1 = ptrIn + (cyc*nrIn);
-      /* Loop ove columns */
-      for(outPtr2 = outPtr1, endPtr2 = outPtr1 + nrIn, inPtr2 = inPtr1;
-	  inPtr2 < endInPtr;
-	  outPtr2+=nrOut, endPtr2+=nrOut)
+      if (!strcmp(layoutName, "shiftMajor"))
 	{
-
-	  /* Loop down rows */
-	  for(outPtr3 = outPtr2;
-	      outPtr3 < endPtr2;
-	      outPtr3++)
-	    {
-	      *outPtr3 = *inPtr2++;
-	    }
+	  layout = STACKZS_LAYOUT_SHIFT_MAJOR;
 	}
-
-      /* Start back at the start of the input, loop over columns */
-      for(inPtr2 = ptrIn;
-	  inPtr2 < inPtr1;
-	  outPtr2+=nrOut, endPtr2+=nrOut)
+      else if (strcmp(layoutName, "stacked"))
 	{
-
-	  /* Loop down rows */
-	  for(outPtr3 = outPtr2;
-	      outPtr3 < endPtr2;
-	      outPtr3++)
-	    {
-	      *outPtr3 = *inPtr2++;
-	    }
+	  mexErrMsgTxt("Stackzs: layout must be 'stacked' or 'shiftMajor'");
 	}
     }
+  nThreads = ((nrhs > 3) && !mxIsEmpty(prhs[3])) ? (int)mxGetScalar(prhs[3]) : 1;
+
+  /* Allocate output space, matching the corner cases of Stackzs.m */
+  if (layout == STACKZS_LAYOUT_SHIFT_MAJOR)
+    {
+      dims[0] = nRowsIn;
+      dims[1] = nColsIn;
+      dims[2] = nShifts;
+      plhs[0] = mxCreateNumericArray(3, dims, classIn, complexIn);
+    }
+  else
+    {
+      dims[0] = (mwSize)nRowsIn*nShifts;
+      dims[1] = nColsIn;
+      plhs[0] = mxCreateNumericArray(2, dims, classIn, complexIn);
+    }
+  if ((nRowsIn < 1) || (nColsIn < 1) || (nShifts < 1))
+    {
+      return;
+    }
 
+  elSize = (classIn == mxSINGLE_CLASS) ? sizeof(float) : sizeof(double);
+#if MX_HAS_INTERLEAVED_COMPLEX
+  elSize *= (complexIn == mxCOMPLEX) ? 2 : 1;
+  pIn_im = NULL;
+  pOut_im = NULL;
+#else
+  pIn_im = (complexIn == mxCOMPLEX) ? mxGetImagData(prhs[0]) : NULL;
+  pOut_im = (complexIn == mxCOMPLEX) ? mxGetImagData(plhs[0]) : NULL;
+#endif
 
-  return(0);
-}
-/*************************************************************************/
-#ifndef MATLAB_MEX_FILE
-/* This is just for testing */
-int main(void)
-{
-  return(0);
+  status = stackzsCopy(mxGetData(plhs[0]), pOut_im, mxGetData(prhs[0]), pIn_im,
+		       elSize, nRowsIn, nColsIn, nShifts, GETDOUBLES(prhs[1]),
+		       layout, nThreads);
+  if (5 == status)
+    {
+      mexErrMsgTxt("Stackzs: out of memory");
+    }
 }
-#endif
+
+#undef GETDOUBLES
+#endif /* MATLAB_MEX_FILE */
+
+#undef STACKZS_MT_MIN_WORK
+#undef STACKZS_BLOCK
+#undef STACKZS_STACKED_BLOCK
 
 
 /*
@@ -1,4 +1,4 @@
-function Z=Stackzs(z, shifts)
+function Z=Stackzs(z, shifts, layout, nThreads) %#ok nThreads only used by the MEX
 % Function: stackzs: Form
 %   z_{1, 1+shift_1} \ldots z_{1, m+shift_1}
 %   z_{1, 1+shift_2} \ldots z_{1, m+shift_2}
@@ -12,6 +12,11 @@ function Z=Stackzs(z, shifts)
 %       Z                       as above (out)
 %       z                       as above (in)
 %       shifts                  [shift_1 \ldots shift_s] (in)
+%       layout                  'stacked' (default) as above, or 'shiftMajor'
+%                               for size(z,1) x size(z,2) x s, page k
+%                               holding the shift_k rows (in, optional)
+%       nThreads                Threads of the MEX, 0 for one per core
+%                               (in, optional, default 1)
 
 %
 % This material is based upon work supported by the Defense Advanced Research
@@ -48,11 +53,14 @@ function Z=Stackzs(z, shifts)
 
 [nr, nc] = size(z);
 shifts = -shifts ;
-Z = zeros(nr*length(shifts), nc);
+Z = zeros(nr*length(shifts), nc, 'like', z);
 for cnt=1:length(shifts)
   perm = cycle(nc, shifts(cnt));
   Z((cnt-1)*nr+1:cnt*nr, :) = z(:, perm);
 end
+if nargin > 2 && strcmp(layout, 'shiftMajor')
+  Z = permute(reshape(Z, nr, length(shifts), nc), [1 3 2]);
+end
 
 
 %
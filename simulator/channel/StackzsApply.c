@@ -0,0 +1,385 @@
+/*
+  This material is based upon work supported by the Defense Advanced Research
+  Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+  findings, conclusions or recommendations expressed in this material are those
+  of the author(s) and do not necessarily reflect the views of the Defense
+  Advanced Research Projects Agency.
+
+  © 2019 Massachusetts Institute of Technology.
+
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License version 2 as
+  published by the Free Software Foundation;
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+  POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "llamachan.h"
+#include "parallelFor.h"
+
+/* Below this many multiply-adds stackzsApply stays single-threaded */
+#define STACKZSAPPLY_MT_MIN_WORK (1<<20)
+
+/* Output samples per task */
+#define STACKZSAPPLY_BLOCK 1024
+
+/* Shifts summed per pass over a block */
+#define STACKZSAPPLY_MAX_SHIFTS 64
+
+/*
+  One stackzsApply() call.  A task is one block of STACKZSAPPLY_BLOCK
+  output samples, for every weight vector, so the tasks write disjoint
+  runs of the output.
+*/
+typedef struct {
+  double *pY_re, *pY_im;                      /* nW x nc, pY_im NULL if real */
+  int yStep;                                  /* Doubles between elements of y */
+  const double *pWc;                          /* conj(w), nr*nShifts x nW (re, im) pairs */
+  int nW;
+  const double *pZ_re, *pZ_im;                /* nr x nc, pZ_im NULL if real */
+  int zStep;
+  int nr, nc, nShifts;
+  const int *pShifts;                         /* nShifts shifts, in [0, nc) */
+} stackzsApplyJob;
+
+/*
+  y(r, j) += sum over shifts a0 <= a < aEnd of conj(w) z(j - shifts[a]),
+  j0 <= j < j0 + len, for columns of z that do not wrap within the run:
+  each sample's sum stays in registers, and each shift is summed on its
+  own first so that the shifts do not wait on each other.
+*/
+static void stackzsApplyRun(const stackzsApplyJob *job, int r, int a0, int aEnd,
+			    int j0, int len)
+{
+  const double *pz_re[STACKZSAPPLY_MAX_SHIFTS], *pz_im[STACKZSAPPLY_MAX_SHIFTS];
+  const double *w0 = job->pWc + 2*((size_t)r*job->nr*job->nShifts + (size_t)a0*job->nr);
+  const double *w, *z_re, *z_im;
+  size_t zCol = (size_t)job->zStep*job->nr;
+  size_t el;
+  int nr = job->nr, zStep = job->zStep, nA = aEnd - a0;
+  int a, i, n, m;
+  double sr, si, tr, ti;
+
+  for (a = 0; a < nA; a++)
+    {
+      m = j0 - job->pShifts[a0 + a];
+      m += (m < 0) ? job->nc : 0;
+      pz_re[a] = job->pZ_re + zCol*m;
+      pz_im[a] = (NULL != job->pZ_im) ? job->pZ_im + zCol*m : NULL;
+    }
+
+  for (n = 0, el = r + (size_t)j0*job->nW; n < len; n++, el += job->nW)
+    {
+      sr = si = 0.;
+      if (NULL != job->pZ_im)
+	{
+	  for (a = 0, w = w0; a < nA; a++, w += 2*nr)
+	    {
+	      z_re = pz_re[a] + zCol*n;
+	      z_im = pz_im[a] + zCol*n;
+	      for (i = 0, tr = ti = 0.; i < nr; i++)
+		{
+		  tr += w[2*i]*z_re[zStep*i] - w[2*i + 1]*z_im[zStep*i];
+		  ti += w[2*i]*z_im[zStep*i] + w[2*i + 1]*z_re[zStep*i];
+		}
+	      sr += tr;
+	      si += ti;
+	    }
+	}
+      else
+	{
+	  for (a = 0, w = w0; a < nA; a++, w += 2*nr)
+	    {
+	      z_re = pz_re[a] + zCol*n;
+	      for (i = 0, tr = ti = 0.; i < nr; i++)
+		{
+		  tr += w[2*i]*z_re[zStep*i];
+		  ti += w[2*i + 1]*z_re[zStep*i];
+		}
+	      sr += tr;
+	      si += ti;
+	    }
+	}
+      if (a0 > 0)
+	{
+	  sr += job->pY_re[job->yStep*el];
+	  si += (NULL != job->pY_im) ? job->pY_im[job->yStep*el] : 0.;
+	}
+      job->pY_re[job->yStep*el] = sr;
+      if (NULL != job->pY_im)
+	{
+	  job->pY_im[job->yStep*el] = si;
+	}
+    }
+}
+
+/*
+  y(r, j) for j0 <= j < j0 + len and every r, split into runs at the
+  samples where the column of z of a shift wraps around
+*/
+static void stackzsApplyTask(void *arg, int iTask)
+{
+  const stackzsApplyJob *job = (const stackzsApplyJob *)arg;
+  int j0 = iTask*STACKZSAPPLY_BLOCK;
+  int jEnd = (job->nc - j0 < STACKZSAPPLY_BLOCK) ? job->nc : j0 + STACKZSAPPLY_BLOCK;
+  int r, a, a0, aEnd, j, jNext;
+
+  for (r = 0; r < job->nW; r++)
+    {
+      /* Shifts are taken STACKZSAPPLY_MAX_SHIFTS at a time */
+      for (a0 = 0; a0 < job->nShifts; a0 += STACKZSAPPLY_MAX_SHIFTS)
+	{
+	  aEnd = (job->nShifts - a0 < STACKZSAPPLY_MAX_SHIFTS) ?
+	    job->nShifts : a0 + STACKZSAPPLY_MAX_SHIFTS;
+	  for (j = j0; j < jEnd; j = jNext)
+	    {
+	      /* Shift a wraps from column nc - 1 to 0 at sample shifts[a] */
+	      for (a = a0, jNext = jEnd; a < aEnd; a++)
+		{
+		  jNext = ((job->pShifts[a] > j) && (job->pShifts[a] < jNext)) ? job->pShifts[a] : jNext;
+		}
+	      stackzsApplyRun(job, r, a0, aEnd, j, jNext - j);
+	    }
+	}
+    }
+}
+
+/*
+  y = StackzsApply(z, shifts, w, nThreads)
+
+  With Z = Stackzs(z, shifts), the nW x nc output y = w'*Z of the
+  nr*nShifts x nW space-time weights w, for z nr x nc, without forming
+  Z: each output sample is the sum over shifts a and rows i of
+  conj(w(a nr + i)) z(i, j - shifts[a]), the index of z taken
+  cyclically.
+
+  Each array is given as its real and imaginary parts, elements xStep
+  doubles apart: 1 for separate parts, 2 for (re, im) pairs with
+  pX_im = pX_re + 1.  pW_im and pZ_im are NULL for real inputs, and
+  pY_im may be NULL when both are.
+
+  nThreads: 1 runs on the calling thread only, 0 uses one thread per
+  core.  Calls of fewer than STACKZSAPPLY_MT_MIN_WORK multiply-adds
+  always run on the calling thread.  The result does not depend on the
+  number of threads.
+*/
+int stackzsApply(double *pY_re, double *pY_im, int yStep,
+		 const double *pW_re, const double *pW_im, int wStep, int nW,
+		 const double *pZ_re, const double *pZ_im, int zStep,
+		 int nr, int nc, int nShifts, const double *shifts,
+		 int nThreads)
+{
+  stackzsApplyJob job;
+  int *pShifts;
+  double *pWc;
+  double work;
+  size_t el, nWts = (size_t)nr*nShifts*nW;
+  int nTasks, iTask, a;
+
+  if ((nr < 0) || (nc < 0) || (nShifts < 0) || (nW < 0))
+    {
+      return(2);
+    }
+  if ((nc < 1) || (nW < 1))
+    {
+      return(0);
+    }
+  if ((NULL == pY_re) || (NULL == pW_re) || (NULL == pZ_re) || (NULL == shifts))
+    {
+      return(1);
+    }
+  if ((nr < 1) || (nShifts < 1))
+    {
+      /* Sums over no weights */
+      for (el = 0; el < (size_t)nW*nc; el++)
+	{
+	  pY_re[yStep*el] = 0.;
+	  if (NULL != pY_im)
+	    {
+	      pY_im[yStep*el] = 0.;
+	    }
+	}
+      return(0);
+    }
+
+  pShifts = (int *)malloc(nShifts*sizeof(int));
+  pWc = (double *)malloc(2*nWts*sizeof(double));
+  if ((NULL == pShifts) || (NULL == pWc))
+    {
+      free(pShifts);
+      free(pWc);
+      return(3);
+    }
+  for (el = 0; el < nWts; el++)
+    {
+      pWc[2*el] = pW_re[wStep*el];
+      pWc[2*el + 1] = (NULL != pW_im) ? -pW_im[wStep*el] : 0.;
+    }
+  for (a = 0; a < nShifts; a++)
+    {
+      pShifts[a] = (int)(((long)shifts[a]) % nc);
+      pShifts[a] += (pShifts[a] < 0) ? nc : 0;
+    }
+
+  job.pY_re = pY_re;
+  job.pY_im = pY_im;
+  job.yStep = yStep;
+  job.pWc = pWc;
+  job.nW = nW;
+  job.pZ_re = pZ_re;
+  job.pZ_im = pZ_im;
+  job.zStep = zStep;
+  job.nr = nr;
+  job.nc = nc;
+  job.nShifts = nShifts;
+  job.pShifts = pShifts;
+
+  nTasks = (nc + STACKZSAPPLY_BLOCK - 1)/STACKZSAPPLY_BLOCK;
+  work = (double)nr*nShifts*nW*nc;
+  if ((nThreads != 1) && (nTasks > 1) && (work >= (double)STACKZSAPPLY_MT_MIN_WORK))
+    {
+      (void)parallelFor(nTasks, nThreads, stackzsApplyTask, &job);
+    }
+  else
+    {
+      for (iTask = 0; iTask < nTasks; iTask++)
+	{
+	  stackzsApplyTask(&job, iTask);
+	}
+    }
+
+  free(pShifts);
+  free(pWc);
+  return(0);
+}
+
+#ifdef MATLAB_MEX_FILE
+#include <mex.h>
+
+/*
+  Built with "mex -R2018a" complex arrays are interleaved (re, im)
+  pairs, read and written in place.
+*/
+#if MX_HAS_INTERLEAVED_COMPLEX
+#define GETDOUBLES mxGetDoubles
+#else
+#define GETDOUBLES mxGetPr
+#endif
+
+static void stackzsApplyParts(const mxArray *a, double **pRe, double **pIm, int *pStep)
+{
+  *pStep = 1;
+  if (!mxIsComplex(a))
+    {
+      *pRe = GETDOUBLES(a);
+      *pIm = NULL;
+      return;
+    }
+#if MX_HAS_INTERLEAVED_COMPLEX
+  *pRe = (double *)mxGetComplexDoubles(a);
+  *pIm = *pRe + 1;
+  *pStep = 2;
+#else
+  *pRe = mxGetPr(a);
+  *pIm = mxGetPi(a);
+#endif
+}
+
+/*
+  y = StackzsApply(z, shifts, w, nThreads)
+
+  y = w'*Stackzs(z, shifts), without forming the stack.  w is
+  size(z, 1)*length(shifts) x nW, and y nW x size(z, 2), complex if
+  either z or w is.
+
+  nThreads (optional): 1 (the default) runs on the calling thread only,
+  0 uses one thread per core, see stackzsApply() above.
+*/
+void mexFunction(int nlhs, mxArray *plhs[],
+		 int nrhs, const mxArray *prhs[])
+{
+  double *pZ_re, *pZ_im, *pW_re, *pW_im, *pY_re, *pY_im;
+  int zStep, wStep, yStep;
+  int nr, nc, nShifts, nW, nThreads;
+  int status;
+
+  (void)nlhs;
+  if ((nrhs < 3) || !mxIsDouble(prhs[0]) || !mxIsDouble(prhs[1]) || mxIsComplex(prhs[1]) ||
+      !mxIsDouble(prhs[2]))
+    {
+      mexErrMsgTxt("StackzsApply: usage y = StackzsApply(z, shifts, w, nThreads), all double");
+    }
+  nr = (int)mxGetM(prhs[0]);
+  nc = (int)mxGetN(prhs[0]);
+  nShifts = (int)mxGetNumberOfElements(prhs[1]);
+  if ((int)mxGetM(prhs[2]) != nr*nShifts)
+    {
+      mexErrMsgTxt("StackzsApply: w must have size(z, 1)*length(shifts) rows");
+    }
+  nW = (int)mxGetN(prhs[2]);
+  stackzsApplyParts(prhs[0], &pZ_re, &pZ_im, &zStep);
+  stackzsApplyParts(prhs[2], &pW_re, &pW_im, &wStep);
+  nThreads = ((nrhs > 3) && !mxIsEmpty(prhs[3])) ? (int)mxGetScalar(prhs[3]) : 1;
+
+  plhs[0] = mxCreateDoubleMatrix((mwSize)nW, (mwSize)nc,
+				 ((NULL != pZ_im) || (NULL != pW_im)) ? mxCOMPLEX : mxREAL);
+  stackzsApplyParts(plhs[0], &pY_re, &pY_im, &yStep);
+
+  status = stackzsApply(pY_re, pY_im, yStep, pW_re, pW_im, wStep, nW,
+			pZ_re, pZ_im, zStep, nr, nc, nShifts, GETDOUBLES(prhs[1]),
+			nThreads);
+  if (3 == status)
+    {
+      mexErrMsgTxt("StackzsApply: out of memory");
+    }
+}
+
+#undef GETDOUBLES
+#endif /* MATLAB_MEX_FILE */
+
+#undef STACKZSAPPLY_MT_MIN_WORK
+#undef STACKZSAPPLY_BLOCK
+#undef STACKZSAPPLY_MAX_SHIFTS
+
+
+/*
+  This material is based upon work supported by the Defense Advanced Research
+  Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+  findings, conclusions or recommendations expressed in this material are those
+  of the author(s) and do not necessarily reflect the views of the Defense
+  Advanced Research Projects Agency.
+
+  © 2019 Massachusetts Institute of Technology.
+
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License version 2 as
+  published by the Free Software Foundation;
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+  POSSIBILITY OF SUCH DAMAGE.
+*/
@@ -0,0 +1,551 @@
+/*
+  This material is based upon work supported by the Defense Advanced Research
+  Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+  findings, conclusions or recommendations expressed in this material are those
+  of the author(s) and do not necessarily reflect the views of the Defense
+  Advanced Research Projects Agency.
+
+  © 2019 Massachusetts Institute of Technology.
+
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License version 2 as
+  published by the Free Software Foundation;
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+  POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "llamachan.h"
+#include "parallelFor.h"
+
+/* Below this many multiply-adds stackzsCov stays single-threaded */
+#define STACKZSCOV_MT_MIN_WORK (1<<20)
+
+/* Columns of z correlated at a time */
+#define STACKZSCOV_BLOCK 256
+
+/*
+  One stackzsCov() call.  Task u < nDiffs correlates the rows of z at
+  the u-th distinct shift difference, task nDiffs + a correlates them
+  with the reference at shift a; each accumulates into its own block of
+  pCov or pCross, (re, im) pairs, so the tasks are independent.
+*/
+typedef struct {
+  const double *pZ_re, *pZ_im;                /* nr x nc, pZ_im NULL if real */
+  int zStep;                                  /* Doubles between elements of z */
+  const double *pRef_re, *pRef_im;            /* nRef x nc, pRef_im NULL if real */
+  int refStep;
+  int nr, nc, nRef;
+  const int *pShifts;                         /* nShifts shifts, in [0, nc) */
+  const int *pDiffs;                          /* nDiffs differences, in [0, nc/2] */
+  int nDiffs;
+  double *pCov;                               /* nr x nr per difference */
+  double *pCross;                             /* nr x nRef per shift */
+} stackzsCovJob;
+
+/*
+  pSum[0] + j pSum[1] += sum_n a(n) conj(b(n)), n < len, for a and b
+  strided aStride and bStride doubles, a_im or b_im NULL if real.  The
+  sums stay in registers rather than in pSum.
+*/
+static void stackzsCovDot(const double *a_re, const double *a_im, size_t aStride,
+			  const double *b_re, const double *b_im, size_t bStride,
+			  int len, double *pSum)
+{
+  double sr = 0., si = 0.;
+  int n;
+
+  if ((NULL != a_im) && (NULL != b_im))
+    {
+      for (n = 0; n < len; n++, a_re += aStride, a_im += aStride, b_re += bStride, b_im += bStride)
+	{
+	  sr += *a_re * *b_re + *a_im * *b_im;
+	  si += *a_im * *b_re - *a_re * *b_im;
+	}
+    }
+  else if (NULL != a_im)
+    {
+      for (n = 0; n < len; n++, a_re += aStride, a_im += aStride, b_re += bStride)
+	{
+	  sr += *a_re * *b_re;
+	  si += *a_im * *b_re;
+	}
+    }
+  else if (NULL != b_im)
+    {
+      for (n = 0; n < len; n++, a_re += aStride, b_re += bStride, b_im += bStride)
+	{
+	  sr += *a_re * *b_re;
+	  si -= *a_re * *b_im;
+	}
+    }
+  else
+    {
+      for (n = 0; n < len; n++, a_re += aStride, b_re += bStride)
+	{
+	  sr += *a_re * *b_re;
+	}
+    }
+  pSum[0] += sr;
+  pSum[1] += si;
+}
+
+/*
+  pAcc[i + k nRowsB] += sum_m z(i, m) conj(b(k, m + d)), m < nc, indices
+  taken cyclically, for b either z itself or the reference.  The columns
+  are taken STACKZSCOV_BLOCK at a time, so that every (i, k) pair reads
+  them from cache, and each block is cut where m + d wraps.  With
+  upper set only i <= k is summed.
+*/
+static void stackzsCovCorr(const stackzsCovJob *job, int d,
+			   const double *b_re, const double *b_im, int bStep, int nRowsB,
+			   int upper, double *pAcc)
+{
+  const double *z_re = job->pZ_re, *z_im = job->pZ_im;
+  size_t aCol = (size_t)job->zStep*job->nr;   /* Doubles between columns */
+  size_t bCol = (size_t)bStep*nRowsB;
+  size_t aOff, bOff;
+  int nr = job->nr, nc = job->nc;
+  int m0, mb0, len, seg, iEnd, i, k;
+
+  for (m0 = 0; m0 < nc; m0 += len)
+    {
+      len = (nc - m0 < STACKZSCOV_BLOCK) ? nc - m0 : STACKZSCOV_BLOCK;
+      mb0 = (int)(((long)m0 + d) % nc);
+      seg = (nc - mb0 < len) ? nc - mb0 : len;
+      for (k = 0; k < nRowsB; k++)
+	{
+	  iEnd = upper ? k + 1 : nr;
+	  for (i = 0; i < iEnd; i++)
+	    {
+	      aOff = aCol*m0 + (size_t)job->zStep*i;
+	      bOff = bCol*mb0 + (size_t)bStep*k;
+	      stackzsCovDot(z_re + aOff, (NULL != z_im) ? z_im + aOff : NULL, aCol,
+			    b_re + bOff, (NULL != b_im) ? b_im + bOff : NULL, bCol,
+			    seg, pAcc + 2*(i + (size_t)k*nr));
+	      if (seg < len)
+		{
+		  aOff += aCol*seg;
+		  bOff = (size_t)bStep*k;
+		  stackzsCovDot(z_re + aOff, (NULL != z_im) ? z_im + aOff : NULL, aCol,
+				b_re + bOff, (NULL != b_im) ? b_im + bOff : NULL, bCol,
+				len - seg, pAcc + 2*(i + (size_t)k*nr));
+		}
+	    }
+	}
+    }
+}
+
+static void stackzsCovTask(void *arg, int iTask)
+{
+  const stackzsCovJob *job = (const stackzsCovJob *)arg;
+  double *pAcc;
+  int nr = job->nr, d, i, k;
+
+  if (iTask < job->nDiffs)
+    {
+      /* At d = -d (mod nc) the correlation is Hermitian: fill in i > k */
+      d = job->pDiffs[iTask];
+      pAcc = job->pCov + 2*(size_t)nr*nr*iTask;
+      stackzsCovCorr(job, d, job->pZ_re, job->pZ_im, job->zStep, nr,
+		     (d == 0) || (2*d == job->nc), pAcc);
+      if ((d == 0) || (2*d == job->nc))
+	{
+	  for (k = 0; k < nr; k++)
+	    {
+	      for (i = k + 1; i < nr; i++)
+		{
+		  pAcc[2*(i + k*nr)] = pAcc[2*(k + i*nr)];
+		  pAcc[2*(i + k*nr) + 1] = -pAcc[2*(k + i*nr) + 1];
+		}
+	    }
+	}
+    }
+  else
+    {
+      iTask -= job->nDiffs;
+      stackzsCovCorr(job, job->pShifts[iTask], job->pRef_re, job->pRef_im,
+		     job->refStep, job->nRef, 0,
+		     job->pCross + 2*(size_t)nr*job->nRef*iTask);
+    }
+}
+
+static int stackzsCovCompareInt(const void *a, const void *b)
+{
+  return((*(const int *)a > *(const int *)b) - (*(const int *)a < *(const int *)b));
+}
+
+/*
+  [R, C] = StackzsCov(z, shifts, ref, nThreads)
+
+  With Z = Stackzs(z, shifts), the nr*nShifts x nr*nShifts covariance
+  R = Z*Z' and the nr*nShifts x nRef cross-covariance C = Z*ref', for z
+  nr x nc and ref nRef x nc, without forming Z.
+
+  As the shifts are cyclic, block (a, b) of R is the nr x nr circular
+  correlation of z with itself at lag shifts[a] - shifts[b], so R takes
+  one correlation per distinct difference of shifts (2 nShifts - 1 for
+  a range of shifts) rather than a product of nr*nShifts rows, and half
+  of those by symmetry.  Block a of C is the correlation of z with ref
+  at lag shifts[a].
+
+  Each array is given as its real and imaginary parts, elements xStep
+  doubles apart: 1 for separate parts, 2 for (re, im) pairs with
+  pX_im = pX_re + 1.  pZ_im and pRef_im are NULL for real inputs, and
+  pR_im or pC_im may be NULL when that output is real.  R is skipped for
+  pR_re NULL, and C for pC_re NULL or nRef 0.
+
+  nThreads: 1 runs on the calling thread only, 0 uses one thread per
+  core.  Calls of fewer than STACKZSCOV_MT_MIN_WORK multiply-adds always
+  run on the calling thread.  The result does not depend on the number
+  of threads.
+*/
+int stackzsCov(double *pR_re, double *pR_im, int rStep,
+	       double *pC_re, double *pC_im, int cStep,
+	       const double *pZ_re, const double *pZ_im, int zStep,
+	       int nr, int nc, int nShifts, const double *shifts,
+	       const double *pRef_re, const double *pRef_im, int refStep, int nRef,
+	       int nThreads)
+{
+  stackzsCovJob job;
+  int *pShifts, *pDiffs, *pIdx;
+  double *pBuf, *acc;
+  double work;
+  size_t nRows, el;
+  int nDiffs, nTasks, iTask;
+  int a, b, i, k, r, d, u;
+
+  if ((nr < 0) || (nc < 0) || (nShifts < 0) || (nRef < 0))
+    {
+      return(2);
+    }
+  if ((NULL == pC_re) || (NULL == pRef_re))
+    {
+      pC_re = NULL;
+      nRef = 0;
+    }
+  if ((nr < 1) || (nShifts < 1) || ((NULL == pR_re) && (nRef < 1)))
+    {
+      return(0);
+    }
+  if ((NULL == pZ_re) || (NULL == shifts))
+    {
+      return(1);
+    }
+
+  nRows = (size_t)nr*nShifts;
+  if (nc < 1)
+    {
+      /* Sums over no samples */
+      for (el = 0; (NULL != pR_re) && (el < nRows*nRows); el++)
+	{
+	  pR_re[rStep*el] = 0.;
+	  if (NULL != pR_im)
+	    {
+	      pR_im[rStep*el] = 0.;
+	    }
+	}
+      for (el = 0; el < nRows*nRef; el++)
+	{
+	  pC_re[cStep*el] = 0.;
+	  if (NULL != pC_im)
+	    {
+	      pC_im[cStep*el] = 0.;
+	    }
+	}
+      return(0);
+    }
+
+  pShifts = (int *)malloc(((size_t)3*nShifts*nShifts + nShifts)*sizeof(int));
+  if (NULL == pShifts)
+    {
+      return(3);
+    }
+  pDiffs = pShifts + nShifts;                 /* nShifts^2 */
+  pIdx = pDiffs + (size_t)nShifts*nShifts;    /* 2 nShifts^2: difference, conjugate */
+
+  /* Shifts and their differences a - b taken into [0, nc) */
+  for (a = 0; a < nShifts; a++)
+    {
+      pShifts[a] = (int)(((long)shifts[a]) % nc);
+      pShifts[a] += (pShifts[a] < 0) ? nc : 0;
+    }
+  nDiffs = 0;
+  if (NULL != pR_re)
+    {
+      for (b = 0; b < nShifts; b++)
+	{
+	  for (a = 0; a < nShifts; a++)
+	    {
+	      d = pShifts[a] - pShifts[b];
+	      d += (d < 0) ? nc : 0;
+	      pDiffs[nDiffs++] = (d <= nc - d) ? d : nc - d;
+	    }
+	}
+      qsort(pDiffs, nDiffs, sizeof(int), stackzsCovCompareInt);
+      for (a = 1, u = 1; a < nDiffs; a++)
+	{
+	  if (pDiffs[a] != pDiffs[u - 1])
+	    {
+	      pDiffs[u++] = pDiffs[a];
+	    }
+	}
+      nDiffs = u;
+    }
+
+  pBuf = (double *)calloc(2*((size_t)nr*nr*nDiffs + nRows*nRef), sizeof(double));
+  if (NULL == pBuf)
+    {
+      free(pShifts);
+      return(3);
+    }
+
+  job.pZ_re = pZ_re;
+  job.pZ_im = pZ_im;
+  job.zStep = zStep;
+  job.pRef_re = pRef_re;
+  job.pRef_im = pRef_im;
+  job.refStep = refStep;
+  job.nr = nr;
+  job.nc = nc;
+  job.nRef = nRef;
+  job.pShifts = pShifts;
+  job.pDiffs = pDiffs;
+  job.nDiffs = nDiffs;
+  job.pCov = pBuf;
+  job.pCross = pBuf + 2*(size_t)nr*nr*nDiffs;
+
+  nTasks = nDiffs + ((nRef > 0) ? nShifts : 0);
+  work = ((double)nr*nr*nDiffs + (double)nRows*nRef)*nc;
+  if ((nThreads != 1) && (nTasks > 1) && (work >= (double)STACKZSCOV_MT_MIN_WORK))
+    {
+      (void)parallelFor(nTasks, nThreads, stackzsCovTask, &job);
+    }
+  else
+    {
+      for (iTask = 0; iTask < nTasks; iTask++)
+	{
+	  stackzsCovTask(&job, iTask);
+	}
+    }
+
+  /* Block (a, b) of R is the correlation at shifts[a] - shifts[b] */
+  if (NULL != pR_re)
+    {
+      for (b = 0; b < nShifts; b++)
+	{
+	  for (a = 0; a < nShifts; a++)
+	    {
+	      d = pShifts[a] - pShifts[b];
+	      d += (d < 0) ? nc : 0;
+	      u = (d <= nc - d) ? d : nc - d;
+	      pIdx[2*(a + b*nShifts)] = (int)((const int *)bsearch(&u, pDiffs, nDiffs, sizeof(int),
+								   stackzsCovCompareInt) - pDiffs);
+	      pIdx[2*(a + b*nShifts) + 1] = (d != u);
+	    }
+	}
+      for (b = 0; b < nShifts; b++)
+	{
+	  for (k = 0; k < nr; k++)
+	    {
+	      for (a = 0; a < nShifts; a++)
+		{
+		  u = pIdx[2*(a + b*nShifts)];
+		  el = (size_t)a*nr + ((size_t)b*nr + k)*nRows;
+		  for (i = 0; i < nr; i++, el++)
+		    {
+		      /* At -d the correlation is the conjugate transpose of that at d */
+		      if (pIdx[2*(a + b*nShifts) + 1])
+			{
+			  acc = job.pCov + 2*((size_t)u*nr*nr + k + (size_t)i*nr);
+			  pR_re[rStep*el] = acc[0];
+			  if (NULL != pR_im)
+			    {
+			      pR_im[rStep*el] = -acc[1];
+			    }
+			}
+		      else
+			{
+			  acc = job.pCov + 2*((size_t)u*nr*nr + i + (size_t)k*nr);
+			  pR_re[rStep*el] = acc[0];
+			  if (NULL != pR_im)
+			    {
+			      pR_im[rStep*el] = acc[1];
+			    }
+			}
+		    }
+		}
+	    }
+	}
+    }
+
+  /* Block a of C is the cross-correlation at shifts[a] */
+  for (r = 0; r < nRef; r++)
+    {
+      for (a = 0; a < nShifts; a++)
+	{
+	  acc = job.pCross + 2*((size_t)a*nr*nRef + (size_t)r*nr);
+	  el = (size_t)a*nr + (size_t)r*nRows;
+	  for (i = 0; i < nr; i++, el++, acc += 2)
+	    {
+	      pC_re[cStep*el] = acc[0];
+	      if (NULL != pC_im)
+		{
+		  pC_im[cStep*el] = acc[1];
+		}
+	    }
+	}
+    }
+
+  free(pBuf);
+  free(pShifts);
+  return(0);
+}
+
+#ifdef MATLAB_MEX_FILE
+#include <mex.h>
+
+/*
+  Built with "mex -R2018a" complex arrays are interleaved (re, im)
+  pairs, read and written in place.
+*/
+#if MX_HAS_INTERLEAVED_COMPLEX
+#define GETDOUBLES mxGetDoubles
+#else
+#define GETDOUBLES mxGetPr
+#endif
+
+static void stackzsCovParts(const mxArray *a, double **pRe, double **pIm, int *pStep)
+{
+  *pStep = 1;
+  if (!mxIsComplex(a))
+    {
+      *pRe = GETDOUBLES(a);
+      *pIm = NULL;
+      return;
+    }
+#if MX_HAS_INTERLEAVED_COMPLEX
+  *pRe = (double *)mxGetComplexDoubles(a);
+  *pIm = *pRe + 1;
+  *pStep = 2;
+#else
+  *pRe = mxGetPr(a);
+  *pIm = mxGetPi(a);
+#endif
+}
+
+/*
+  [R, C] = StackzsCov(z, shifts, ref, nThreads)
+
+  Z = Stackzs(z, shifts), R = Z*Z' and C = Z*ref' in one pass over z,
+  without forming Z.  ref (optional, nRef x size(z, 2)) is only read
+  when C is asked for.  R is complex if z is, and C if either z or ref
+  is.
+
+  nThreads (optional): 1 (the default) runs on the calling thread only,
+  0 uses one thread per core, see stackzsCov() above.
+*/
+void mexFunction(int nlhs, mxArray *plhs[],
+		 int nrhs, const mxArray *prhs[])
+{
+  double *pZ_re, *pZ_im, *pRef_re, *pRef_im;
+  double *pR_re, *pR_im, *pC_re, *pC_im;
+  int zStep, refStep, rStep, cStep;
+  int nr, nc, nShifts, nRef, nThreads;
+  int status;
+
+  if ((nrhs < 2) || !mxIsDouble(prhs[0]) || !mxIsDouble(prhs[1]) || mxIsComplex(prhs[1]))
+    {
+      mexErrMsgTxt("StackzsCov: usage [R, C] = StackzsCov(z, shifts, ref, nThreads), z and shifts double");
+    }
+  nr = (int)mxGetM(prhs[0]);
+  nc = (int)mxGetN(prhs[0]);
+  nShifts = (int)mxGetNumberOfElements(prhs[1]);
+  stackzsCovParts(prhs[0], &pZ_re, &pZ_im, &zStep);
+
+  pRef_re = pRef_im = NULL;
+  refStep = 1;
+  nRef = 0;
+  if ((nlhs > 1) && (nrhs > 2) && !mxIsEmpty(prhs[2]))
+    {
+      if (!mxIsDouble(prhs[2]) || ((int)mxGetN(prhs[2]) != nc))
+	{
+	  mexErrMsgTxt("StackzsCov: ref must be a double matrix with as many columns as z");
+	}
+      nRef = (int)mxGetM(prhs[2]);
+      stackzsCovParts(prhs[2], &pRef_re, &pRef_im, &refStep);
+    }
+  else if (nlhs > 1)
+    {
+      mexErrMsgTxt("StackzsCov: C needs ref");
+    }
+  nThreads = ((nrhs > 3) && !mxIsEmpty(prhs[3])) ? (int)mxGetScalar(prhs[3]) : 1;
+
+  plhs[0] = mxCreateDoubleMatrix((mwSize)nr*nShifts, (mwSize)nr*nShifts,
+				 (NULL != pZ_im) ? mxCOMPLEX : mxREAL);
+  stackzsCovParts(plhs[0], &pR_re, &pR_im, &rStep);
+  pC_re = pC_im = NULL;
+  cStep = 1;
+  if (nlhs > 1)
+    {
+      plhs[1] = mxCreateDoubleMatrix((mwSize)nr*nShifts, (mwSize)nRef,
+				     ((NULL != pZ_im) || (NULL != pRef_im)) ? mxCOMPLEX : mxREAL);
+      stackzsCovParts(plhs[1], &pC_re, &pC_im, &cStep);
+    }
+
+  status = stackzsCov(pR_re, pR_im, rStep, pC_re, pC_im, cStep,
+		      pZ_re, pZ_im, zStep, nr, nc, nShifts, GETDOUBLES(prhs[1]),
+		      pRef_re, pRef_im, refStep, nRef, nThreads);
+  if (3 == status)
+    {
+      mexErrMsgTxt("StackzsCov: out of memory");
+    }
+}
+
+#undef GETDOUBLES
+#endif /* MATLAB_MEX_FILE */
+
+#undef STACKZSCOV_MT_MIN_WORK
+#undef STACKZSCOV_BLOCK
+
+
+/*
+  This material is based upon work supported by the Defense Advanced Research
+  Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+  findings, conclusions or recommendations expressed in this material are those
+  of the author(s) and do not necessarily reflect the views of the Defense
+  Advanced Research Projects Agency.
+
+  © 2019 Massachusetts Institute of Technology.
+
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License version 2 as
+  published by the Free Software Foundation;
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+  POSSIBILITY OF SUCH DAMAGE.
+*/
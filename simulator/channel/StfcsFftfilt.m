@@ -0,0 +1,112 @@
+function rxsig = StfcsFftfilt(startSamp, hTensor, freqOffs, phiOffs, source)
+
+% Function simulator/channel/StfcsFftfilt.m:
+% Applies the sampled ('stfcs') channel tensor to the transmitted
+% signal with fftfilt, for the long filters (log2(nSamp) < nDelay)
+% where an FFT beats the direct filter of StfcsFilter.c.  Each source
+% is modulated once per transmit antenna and Doppler tap and filtered
+% for all the receive antennas together.
+%
+% USAGE: rxsig = StfcsFftfilt(startSamp, hTensor, freqOffs, phiOffs, source)
+%
+% Input arguments:
+%  startSamp (int) Channel sample number start
+%  hTensor   (nR x nT x nDop x nDelay) Channel tensor
+%  freqOffs  (1 x nDop) Doppler frequency of each tap, cycles per sample
+%  phiOffs   (1 x nDop) Phase of each tap (unused where freqOffs is 0)
+%  source    (nT x blockLength + nDelay complex) Transmitted signal
+%
+% Output argument:
+%  rxsig     (nR x blockLength complex) Received signal
+
+%
+% This material is based upon work supported by the Defense Advanced Research
+% Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+% findings, conclusions or recommendations expressed in this material are those
+% of the author(s) and do not necessarily reflect the views of the Defense
+% Advanced Research Projects Agency.
+%
+% © 2019 Massachusetts Institute of Technology.
+%
+%
+% This program is free software; you can redistribute it and/or modify
+% it under the terms of the GNU General Public License version 2 as
+% published by the Free Software Foundation;
+%
+% THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+% AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+% IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+% ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+% LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+% CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+% SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+% INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+% CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+% ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+% POSSIBILITY OF SUCH DAMAGE.
+%
+% Delivered to the U.S. Government with Unlimited Rights, as defined in DFARS
+% Part 252.227-7013 or 7014 (Feb 2014). Notwithstanding any copyright notice,
+% U.S. Government rights in this work are defined by DFARS 252.227-7013 or
+% DFARS 252.227-7014 as detailed above. Use of this work other than as
+% specifically authorized by the U.S. Government may violate any copyrights
+% that exist in this work.
+
+[nR, nT, nDop, nDelay] = size(hTensor);
+nSamp = size(source, 2);
+blockLengthRx = nSamp - nDelay + 1;
+
+% Each source is modulated once per transmit antenna and Doppler tap,
+% and filtered by the impulse responses of all receive antennas
+rxsig = zeros(nR, blockLengthRx);
+for txLoop = 1:nT % loop through transmit antennas
+  for dopLoop = 1:nDop % loop through Doppler taps
+    if freqOffs(dopLoop) == 0
+      zMod = source(txLoop, :);
+    else
+      % Modulate the data
+      zMod = exp(1j*(2*pi*freqOffs(dopLoop) ...
+                     *(startSamp:startSamp + nSamp - 1) + phiOffs(dopLoop)))...
+             .* source(txLoop, :);
+    end
+    % Extract the channel impulse responses, one column per rx antenna
+    hAll = reshape(hTensor(:, txLoop, dopLoop, :), nR, nDelay).';
+    % fftfilt transforms zMod once for all the columns of hAll
+    zModFilt = fftfilt(hAll, zMod(:));
+    rxsig = rxsig + zModFilt(nDelay:end, :).';
+  end % End loop through doppler taps
+end % end TX antenna loop
+
+%
+% This material is based upon work supported by the Defense Advanced Research
+% Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+% findings, conclusions or recommendations expressed in this material are those
+% of the author(s) and do not necessarily reflect the views of the Defense
+% Advanced Research Projects Agency.
+%
+% © 2019 Massachusetts Institute of Technology.
+%
+%
+% This program is free software; you can redistribute it and/or modify
+% it under the terms of the GNU General Public License version 2 as
+% published by the Free Software Foundation;
+%
+% THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+% AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+% IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+% ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+% LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+% CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+% SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+% INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+% CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+% ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+% POSSIBILITY OF SUCH DAMAGE.
+%
+% Delivered to the U.S. Government with Unlimited Rights, as defined in DFARS
+% Part 252.227-7013 or 7014 (Feb 2014). Notwithstanding any copyright notice,
+% U.S. Government rights in this work are defined by DFARS 252.227-7013 or
+% DFARS 252.227-7014 as detailed above. Use of this work other than as
+% specifically authorized by the U.S. Government may violate any copyrights
+% that exist in this work.
+
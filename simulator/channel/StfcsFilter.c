@@ -0,0 +1,482 @@
+/*
+  This material is based upon work supported by the Defense Advanced Research
+  Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+  findings, conclusions or recommendations expressed in this material are those
+  of the author(s) and do not necessarily reflect the views of the Defense
+  Advanced Research Projects Agency.
+
+  © 2019 Massachusetts Institute of Technology.
+
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License version 2 as
+  published by the Free Software Foundation;
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+  POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "llamachan.h"
+#include "parallelFor.h"
+
+#define STFCS_TWOPI (6.283185307179586)
+
+/* Below this many multiply-adds stfcsFilter stays single-threaded */
+#define STFCS_MT_MIN_WORK (1<<20)
+
+/*
+  Output samples per task: at most STFCS_BLOCK, fewer when the block's
+  modulated sources would not fit in about STFCS_CACHE_BYTES, but at
+  least STFCS_MIN_BLOCK
+*/
+#define STFCS_BLOCK 512
+#define STFCS_MIN_BLOCK 64
+#define STFCS_CACHE_BYTES (1<<18)
+
+/* The rotator restarts from the exact phase this often, bounding its drift */
+#define STFCS_ROT_SEED 128
+
+/*
+  One stfcsFilter() call.  A task is one block of blockLen output
+  samples, for every receive antenna, so the tasks write disjoint
+  columns of the output.
+*/
+typedef struct {
+  double *pY_re, *pY_im;                      /* nR x nOut */
+  int yStep;                                  /* Doubles between elements of y */
+  const double *pH_re, *pH_im;                /* nR x nT x nDop x nDelay, pH_im NULL if real */
+  int hStep;
+  int nR, nT, nDop, nDelay;
+  const double *freqOffs, *phiOffs;
+  double startSamp;
+  const double *pS_re, *pS_im;                /* nT x nSamp, pS_im NULL if real */
+  int sStep;
+  int nSamp, nOut;
+  int blockLen;
+  double *pWork;                              /* workLen doubles per worker */
+  size_t workLen;
+  int nWorkers;
+} stfcsJob;
+
+/* Task i runs on worker i % nWorkers, see parallelFor() */
+#define STFCS_WORKER_SCRATCH(job, iTask) \
+  ((job)->pWork + ((iTask) % (job)->nWorkers)*(job)->workLen)
+
+/*
+  z[i] = exp(1j*(2 pi f (startSamp + m0 + i) + phi)) s[m0 + i], i < len,
+  s strided sCol doubles, or just s where f is 0, as
+  ProcessSampledChannel.m leaves those taps unmodulated.  The rotator
+  steps by exp(2 pi j f) from the exact phase every STFCS_ROT_SEED
+  samples.
+*/
+static void stfcsModulate(double *z_re, double *z_im, const double *s_re, const double *s_im,
+			  size_t sCol, int m0, int len, double f, double phi, double startSamp)
+{
+  double c, sn, w_re, w_im, t, x_re, x_im, phase;
+  int i;
+
+  for (i = 0; i < len; i++)
+    {
+      z_re[i] = s_re[sCol*(m0 + i)];
+      z_im[i] = (NULL != s_im) ? s_im[sCol*(m0 + i)] : 0.;
+    }
+  if (f == 0.)
+    {
+      return;
+    }
+
+  w_re = cos(STFCS_TWOPI*f);
+  w_im = sin(STFCS_TWOPI*f);
+  c = sn = 0.;
+  for (i = 0; i < len; i++)
+    {
+      if (0 == i % STFCS_ROT_SEED)
+	{
+	  phase = STFCS_TWOPI*f*(startSamp + m0 + i) + phi;
+	  c = cos(phase);
+	  sn = sin(phase);
+	}
+      x_re = z_re[i];
+      x_im = z_im[i];
+      z_re[i] = c*x_re - sn*x_im;
+      z_im[i] = c*x_im + sn*x_re;
+      t = c*w_re - sn*w_im;
+      sn = c*w_im + sn*w_re;
+      c = t;
+    }
+}
+
+/*
+  acc[i] += sum over k of h[k] z[i + nDelay - 1 - k], i < len, with the
+  nonzero taps taken two per pass over acc
+*/
+static void stfcsFir(double *acc_re, double *acc_im, const double *z_re, const double *z_im,
+		     const double *h_re, const double *h_im, int nDelay, int len)
+{
+  const double *z0_re, *z0_im, *z1_re, *z1_im;
+  double h0_re, h0_im, h1_re, h1_im, a_re, a_im;
+  int tap[2];
+  int k, nk, i;
+
+  k = 0;
+  while (k < nDelay)
+    {
+      for (nk = 0; (k < nDelay) && (nk < 2); k++)
+	{
+	  if ((h_re[k] != 0.) || (h_im[k] != 0.))
+	    {
+	      tap[nk++] = k;
+	    }
+	}
+      if (0 == nk)
+	{
+	  break;
+	}
+      h0_re = h_re[tap[0]];
+      h0_im = h_im[tap[0]];
+      z0_re = z_re + (nDelay - 1 - tap[0]);
+      z0_im = z_im + (nDelay - 1 - tap[0]);
+      if (1 == nk)
+	{
+	  for (i = 0; i < len; i++)
+	    {
+	      acc_re[i] += h0_re*z0_re[i] - h0_im*z0_im[i];
+	      acc_im[i] += h0_re*z0_im[i] + h0_im*z0_re[i];
+	    }
+	  continue;
+	}
+      h1_re = h_re[tap[1]];
+      h1_im = h_im[tap[1]];
+      z1_re = z_re + (nDelay - 1 - tap[1]);
+      z1_im = z_im + (nDelay - 1 - tap[1]);
+      for (i = 0; i < len; i++)
+	{
+	  a_re = acc_re[i] + h0_re*z0_re[i] - h0_im*z0_im[i];
+	  a_im = acc_im[i] + h0_re*z0_im[i] + h0_im*z0_re[i];
+	  acc_re[i] = a_re + h1_re*z1_re[i] - h1_im*z1_im[i];
+	  acc_im[i] = a_im + h1_re*z1_im[i] + h1_im*z1_re[i];
+	}
+    }
+}
+
+/*
+  The block's nT*nDop modulated sources are computed once, into the
+  worker's cache, and then every receive antenna in turn runs all of
+  them through its taps into one accumulator.
+*/
+static void stfcsTask(void *arg, int iTask)
+{
+  stfcsJob *job = (stfcsJob *)arg;
+  int nR = job->nR, nT = job->nT, nDop = job->nDop, nDelay = job->nDelay;
+  int n0 = iTask*job->blockLen;
+  int len = (job->nOut - n0 < job->blockLen) ? job->nOut - n0 : job->blockLen;
+  int nZ = len + nDelay - 1;                  /* Source samples the block reads */
+  size_t nCache = (size_t)nT*nDop*nZ;
+  size_t q, el;
+  double *z_re, *z_im, *acc_re, *acc_im, *h_re, *h_im;
+  int r, t, d, k, i, td;
+
+  z_re = STFCS_WORKER_SCRATCH(job, iTask);    /* nZ x nT*nDop each */
+  z_im = z_re + nCache;
+  acc_re = z_im + nCache;
+  acc_im = acc_re + len;
+  h_re = acc_im + len;
+  h_im = h_re + nDelay;
+
+  /* Output n reads source samples n .. n + nDelay - 1 */
+  for (t = 0, td = 0; t < nT; t++)
+    {
+      for (d = 0; d < nDop; d++, td++)
+	{
+	  stfcsModulate(z_re + (size_t)td*nZ, z_im + (size_t)td*nZ,
+			job->pS_re + (size_t)job->sStep*t,
+			(NULL != job->pS_im) ? job->pS_im + (size_t)job->sStep*t : NULL,
+			(size_t)job->sStep*nT, n0, nZ, job->freqOffs[d], job->phiOffs[d],
+			job->startSamp);
+	}
+    }
+
+  for (r = 0; r < nR; r++)
+    {
+      memset(acc_re, 0, 2*(size_t)len*sizeof(double));
+      for (t = 0, td = 0; t < nT; t++)
+	{
+	  for (d = 0; d < nDop; d++, td++)
+	    {
+	      for (k = 0; k < nDelay; k++)
+		{
+		  q = r + (size_t)nR*(t + (size_t)nT*(d + (size_t)nDop*k));
+		  h_re[k] = job->pH_re[job->hStep*q];
+		  h_im[k] = (NULL != job->pH_im) ? job->pH_im[job->hStep*q] : 0.;
+		}
+	      stfcsFir(acc_re, acc_im, z_re + (size_t)td*nZ, z_im + (size_t)td*nZ,
+		       h_re, h_im, nDelay, len);
+	    }
+	}
+      for (i = 0, el = r + (size_t)n0*nR; i < len; i++, el += nR)
+	{
+	  job->pY_re[job->yStep*el] = acc_re[i];
+	  job->pY_im[job->yStep*el] = acc_im[i];
+	}
+    }
+}
+
+/*
+  rxsig = StfcsFilter(startSamp, chanTensor, freqOffs, phiOffs, source, nThreads)
+
+  The sampled ('stfcs') channel of ProcessSampledChannel.m: the
+  nR x nOut output, nOut = nSamp - nDelay + 1, is
+
+    y(r, n) = sum over t, d, k of H(r, t, d, k) z_td(n + nDelay - 1 - k)
+
+  for the nR x nT x nDop x nDelay channel tensor H and the nT x nSamp
+  source s, with z_td(m) = exp(1j*(2 pi freqOffs[d] (startSamp + m)
+  + phiOffs[d])) s(t, m), or just s(t, m) where freqOffs[d] is 0: the
+  filter output of each modulated source from its nDelay-th sample on.
+  The modulation comes from a rotator, restarted from the exact phase
+  every STFCS_ROT_SEED samples.  Each block of output samples modulates
+  every (t, d) source once, into a cache sized to about
+  STFCS_CACHE_BYTES, and feeds it to the filters of all nR receive
+  antennas, two taps per pass over the block.  That direct filter costs
+  O(nDelay) per output, so ProcessSampledChannel.m sends long filters,
+  log2(nSamp) < nDelay, to fftfilt (StfcsFftfilt.m) instead.
+
+  Each array is given as its real and imaginary parts, elements xStep
+  doubles apart: 1 for separate parts, 2 for (re, im) pairs with
+  pX_im = pX_re + 1.  pH_im and pS_im are NULL for real inputs.
+
+  nThreads: 1 runs on the calling thread only, 0 uses one thread per
+  core.  Calls of fewer than STFCS_MT_MIN_WORK multiply-adds always run
+  on the calling thread.  The result does not depend on the number of
+  threads.  The caches of all the threads are allocated once per call.
+
+  Returns 0 on success, 1 for a missing array, 2 for a negative size
+  and 3 when out of memory.
+*/
+int stfcsFilter(double *pY_re, double *pY_im, int yStep,
+		const double *pH_re, const double *pH_im, int hStep,
+		int nR, int nT, int nDop, int nDelay,
+		const double *freqOffs, const double *phiOffs, double startSamp,
+		const double *pS_re, const double *pS_im, int sStep, int nSamp,
+		int nThreads)
+{
+  stfcsJob job;
+  double work, cacheLen;
+  int nTasks, iTask;
+  int nBlockZ;
+
+  if ((nR < 0) || (nT < 0) || (nDop < 0) || (nDelay < 1) || (nSamp < 0))
+    {
+      return(2);
+    }
+  if ((nR < 1) || (nSamp < nDelay))
+    {
+      return(0);
+    }
+  if ((NULL == pY_re) || (NULL == pY_im) ||
+      ((nT > 0) && (nDop > 0) &&
+       ((NULL == pH_re) || (NULL == freqOffs) || (NULL == phiOffs) || (NULL == pS_re))))
+    {
+      return(1);
+    }
+
+  job.pY_re = pY_re;
+  job.pY_im = pY_im;
+  job.yStep = yStep;
+  job.pH_re = pH_re;
+  job.pH_im = pH_im;
+  job.hStep = hStep;
+  job.nR = nR;
+  job.nT = nT;
+  job.nDop = nDop;
+  job.nDelay = nDelay;
+  job.freqOffs = freqOffs;
+  job.phiOffs = phiOffs;
+  job.startSamp = startSamp;
+  job.pS_re = pS_re;
+  job.pS_im = pS_im;
+  job.sStep = sStep;
+  job.nSamp = nSamp;
+  job.nOut = nSamp - nDelay + 1;
+
+  cacheLen = (double)STFCS_CACHE_BYTES/(2.*sizeof(double)*((nT*nDop > 0) ? nT*nDop : 1))
+    - (nDelay - 1);
+  job.blockLen = (cacheLen < STFCS_BLOCK) ? (int)cacheLen : STFCS_BLOCK;
+  job.blockLen = (job.blockLen < STFCS_MIN_BLOCK) ? STFCS_MIN_BLOCK : job.blockLen;
+
+  nTasks = (job.nOut + job.blockLen - 1)/job.blockLen;
+  work = (double)nR*nT*nDop*nDelay*job.nOut;
+  job.nWorkers = ((nThreads != 1) && (nTasks > 1) && (work >= (double)STFCS_MT_MIN_WORK)) ?
+    parallelForThreads(nThreads, nTasks) : 1;
+
+  /* Each worker's cache, accumulator and taps, for its longest block */
+  nBlockZ = job.blockLen + nDelay - 1;
+  job.workLen = 2*(size_t)nT*nDop*nBlockZ + 2*(size_t)job.blockLen + 2*(size_t)nDelay;
+  job.pWork = (double *)malloc(job.nWorkers*job.workLen*sizeof(double));
+  if (NULL == job.pWork)
+    {
+      return(3);
+    }
+
+  if (job.nWorkers > 1)
+    {
+      (void)parallelFor(nTasks, job.nWorkers, stfcsTask, &job);
+    }
+  else
+    {
+      for (iTask = 0; iTask < nTasks; iTask++)
+	{
+	  stfcsTask(&job, iTask);
+	}
+    }
+
+  free(job.pWork);
+  return(0);
+}
+
+#ifdef MATLAB_MEX_FILE
+#include <mex.h>
+
+/*
+  Built with "mex -R2018a" complex arrays are interleaved (re, im)
+  pairs, read and written in place.
+*/
+#if MX_HAS_INTERLEAVED_COMPLEX
+#define GETDOUBLES mxGetDoubles
+#else
+#define GETDOUBLES mxGetPr
+#endif
+
+static void stfcsParts(const mxArray *a, double **pRe, double **pIm, int *pStep)
+{
+  *pStep = 1;
+  if (!mxIsComplex(a))
+    {
+      *pRe = GETDOUBLES(a);
+      *pIm = NULL;
+      return;
+    }
+#if MX_HAS_INTERLEAVED_COMPLEX
+  *pRe = (double *)mxGetComplexDoubles(a);
+  *pIm = *pRe + 1;
+  *pStep = 2;
+#else
+  *pRe = mxGetPr(a);
+  *pIm = mxGetPi(a);
+#endif
+}
+
+/*
+  rxsig = StfcsFilter(startSamp, chanTensor, freqOffs, phiOffs, source, nThreads)
+
+  chanTensor is nR x nT x nDop x nDelay, freqOffs and phiOffs have nDop
+  elements, and source is nT x nSamp.  rxsig is the complex
+  nR x (nSamp - nDelay + 1) output of ProcessSampledChannel.m.
+
+  nThreads (optional): 1 (the default) runs on the calling thread only,
+  0 uses one thread per core, see stfcsFilter() above.
+*/
+void mexFunction(int nlhs, mxArray *plhs[],
+		 int nrhs, const mxArray *prhs[])
+{
+  const mwSize *dims;
+  double *pH_re, *pH_im, *pS_re, *pS_im, *pY_re, *pY_im;
+  int hStep, sStep, yStep;
+  int nR, nT, nDop, nDelay, nSamp, nOut, nThreads;
+  int nDims, status;
+
+  (void)nlhs;
+  if ((nrhs < 5) || !mxIsDouble(prhs[1]) || !mxIsDouble(prhs[2]) || mxIsComplex(prhs[2]) ||
+      !mxIsDouble(prhs[3]) || mxIsComplex(prhs[3]) || !mxIsDouble(prhs[4]))
+    {
+      mexErrMsgTxt("StfcsFilter: usage rxsig = StfcsFilter(startSamp, chanTensor, freqOffs, "
+		   "phiOffs, source, nThreads), all double");
+    }
+  nDims = (int)mxGetNumberOfDimensions(prhs[1]);
+  dims = mxGetDimensions(prhs[1]);
+  if (nDims > 4)
+    {
+      mexErrMsgTxt("StfcsFilter: chanTensor must be nR x nT x nDop x nDelay");
+    }
+  nR = (int)dims[0];
+  nT = (int)dims[1];
+  nDop = (nDims > 2) ? (int)dims[2] : 1;
+  nDelay = (nDims > 3) ? (int)dims[3] : 1;
+  nSamp = (int)mxGetN(prhs[4]);
+  if (((int)mxGetM(prhs[4]) != nT) && (nSamp > 0))
+    {
+      mexErrMsgTxt("StfcsFilter: source must have size(chanTensor, 2) rows");
+    }
+  if (((int)mxGetNumberOfElements(prhs[2]) < nDop) || ((int)mxGetNumberOfElements(prhs[3]) < nDop))
+    {
+      mexErrMsgTxt("StfcsFilter: freqOffs and phiOffs need size(chanTensor, 3) elements");
+    }
+  stfcsParts(prhs[1], &pH_re, &pH_im, &hStep);
+  stfcsParts(prhs[4], &pS_re, &pS_im, &sStep);
+  nThreads = ((nrhs > 5) && !mxIsEmpty(prhs[5])) ? (int)mxGetScalar(prhs[5]) : 1;
+
+  nOut = (nSamp >= nDelay) ? nSamp - nDelay + 1 : 0;
+  plhs[0] = mxCreateDoubleMatrix((mwSize)nR, (mwSize)nOut, mxCOMPLEX);
+  stfcsParts(plhs[0], &pY_re, &pY_im, &yStep);
+
+  status = stfcsFilter(pY_re, pY_im, yStep, pH_re, pH_im, hStep, nR, nT, nDop, nDelay,
+		       GETDOUBLES(prhs[2]), GETDOUBLES(prhs[3]), mxGetScalar(prhs[0]),
+		       pS_re, pS_im, sStep, nSamp, nThreads);
+  if (3 == status)
+    {
+      mexErrMsgTxt("StfcsFilter: out of memory");
+    }
+}
+
+#undef GETDOUBLES
+#endif /* MATLAB_MEX_FILE */
+
+#undef STFCS_TWOPI
+#undef STFCS_MT_MIN_WORK
+#undef STFCS_BLOCK
+#undef STFCS_MIN_BLOCK
+#undef STFCS_CACHE_BYTES
+#undef STFCS_ROT_SEED
+#undef STFCS_WORKER_SCRATCH
+
+
+/*
+  This material is based upon work supported by the Defense Advanced Research
+  Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+  findings, conclusions or recommendations expressed in this material are those
+  of the author(s) and do not necessarily reflect the views of the Defense
+  Advanced Research Projects Agency.
+
+  © 2019 Massachusetts Institute of Technology.
+
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License version 2 as
+  published by the Free Software Foundation;
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+  POSSIBILITY OF SUCH DAMAGE.
+*/
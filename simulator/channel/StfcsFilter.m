@@ -0,0 +1,136 @@
+function rxsig = StfcsFilter(startSamp, hTensor, freqOffs, phiOffs, source, nThreads) %#ok nThreads only used by the MEX
+
+% Function simulator/channel/StfcsFilter.m:
+% Applies the sampled ('stfcs') channel tensor to the transmitted
+% signal, for ProcessSampledChannel.  Each Doppler tap modulates the
+% source and filters it with its impulse response, and the outputs are
+% summed per receive antenna.  This is the slow version of
+% StfcsFilter.c, which modulates with a rotator and fuses it with the
+% filter, without a modulated copy of the source per tap.  Here each
+% source is modulated once per transmit antenna and Doppler tap and
+% filtered for all the receive antennas together.  Long filters
+% (log2(nSamp) < nDelay) are handed to StfcsFftfilt.m.
+%
+% USAGE: rxsig = StfcsFilter(startSamp, hTensor, freqOffs, phiOffs, source, nThreads)
+%
+% Input arguments:
+%  startSamp (int) Channel sample number start
+%  hTensor   (nR x nT x nDop x nDelay) Channel tensor
+%  freqOffs  (1 x nDop) Doppler frequency of each tap, cycles per sample
+%  phiOffs   (1 x nDop) Phase of each tap (unused where freqOffs is 0)
+%  source    (nT x blockLength + nDelay complex) Transmitted signal
+%  nThreads  (optional) Threads of the MEX function, 0 for one per core
+%
+% Output argument:
+%  rxsig     (nR x blockLength complex) Received signal
+
+%
+% This material is based upon work supported by the Defense Advanced Research
+% Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+% findings, conclusions or recommendations expressed in this material are those
+% of the author(s) and do not necessarily reflect the views of the Defense
+% Advanced Research Projects Agency.
+%
+% © 2019 Massachusetts Institute of Technology.
+%
+%
+% This program is free software; you can redistribute it and/or modify
+% it under the terms of the GNU General Public License version 2 as
+% published by the Free Software Foundation;
+%
+% THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+% AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+% IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+% ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+% LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+% CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+% SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+% INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+% CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+% ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+% POSSIBILITY OF SUCH DAMAGE.
+%
+% Delivered to the U.S. Government with Unlimited Rights, as defined in DFARS
+% Part 252.227-7013 or 7014 (Feb 2014). Notwithstanding any copyright notice,
+% U.S. Government rights in this work are defined by DFARS 252.227-7013 or
+% DFARS 252.227-7014 as detailed above. Use of this work other than as
+% specifically authorized by the U.S. Government may violate any copyrights
+% that exist in this work.
+
+persistent calledBefore
+if isempty(calledBefore)
+  fprintf(1, ['\n   WARNING Missing MEX function: StfcsFilter.%s', ...
+              '.\n   You can create the mex function by changing', ...
+              ' the\n   working directory to', ...
+              ' /simulator/channel/\n   and typing "mex', ...
+              ' StfcsFilter.c"\n\n'], mexext);
+  calledBefore = true;
+end
+
+[nR, nT, nDop, nDelay] = size(hTensor);
+nSamp = size(source, 2);
+blockLengthRx = nSamp - nDelay + 1;
+
+% Long filters go through fftfilt, as ProcessSampledChannel.m does
+if log2(nSamp) < nDelay
+  rxsig = StfcsFftfilt(startSamp, hTensor, freqOffs, phiOffs, source);
+  return
+end
+
+% Each modulated source is formed once per transmit antenna and Doppler
+% tap, and filtered by the impulse responses of all receive antennas
+rxsig = zeros(nR, blockLengthRx);
+for txLoop = 1:nT % loop through transmit antennas
+  for dopLoop = 1:nDop % loop through Doppler taps
+    if freqOffs(dopLoop) == 0
+      zMod = source(txLoop, :);
+    else
+      % Modulate the data
+      zMod = exp(1j*(2*pi*freqOffs(dopLoop) ...
+                     *(startSamp:startSamp + nSamp - 1) + phiOffs(dopLoop)))...
+             .* source(txLoop, :);
+    end
+    % Extract the channel impulse responses, one column per rx antenna
+    hAll = reshape(hTensor(:, txLoop, dopLoop, :), nR, nDelay).';
+    % Calculate convolution with the channel
+    zModFilt = zeros(nSamp, nR);
+    for rxLoop = 1:nR % loop through receive antennas
+      zModFilt(:, rxLoop) = filter(hAll(:, rxLoop), 1, zMod(:));
+    end % end RX antenna loop
+    rxsig = rxsig + zModFilt(nDelay:end, :).';
+  end % End loop through doppler taps
+end % end TX antenna loop
+
+%
+% This material is based upon work supported by the Defense Advanced Research
+% Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+% findings, conclusions or recommendations expressed in this material are those
+% of the author(s) and do not necessarily reflect the views of the Defense
+% Advanced Research Projects Agency.
+%
+% © 2019 Massachusetts Institute of Technology.
+%
+%
+% This program is free software; you can redistribute it and/or modify
+% it under the terms of the GNU General Public License version 2 as
+% published by the Free Software Foundation;
+%
+% THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+% AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+% IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+% ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+% LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+% CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+% SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+% INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+% CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+% ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+% POSSIBILITY OF SUCH DAMAGE.
+%
+% Delivered to the U.S. Government with Unlimited Rights, as defined in DFARS
+% Part 252.227-7013 or 7014 (Feb 2014). Notwithstanding any copyright notice,
+% U.S. Government rights in this work are defined by DFARS 252.227-7013 or
+% DFARS 252.227-7014 as detailed above. Use of this work other than as
+% specifically authorized by the U.S. Government may violate any copyrights
+% that exist in this work.
+
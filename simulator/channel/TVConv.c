@@ -28,6 +28,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <math.h>
 
 #ifdef MATLAB_MEX_FILE
 #include <mex.h>
@@ -42,236 +43,2225 @@
 #define ARGSZ size_t
 #endif
 
-/*--- out = TVConv(H, lags, source, longestLag); ---*/
+#include "llamachan.h"
+#include "parallelFor.h"
+#include "jakesInterp.h"
 
-int tvconv(double *pOut_re, double *pOut_im, 
-	    int nS, int nLags, double *pH_re, double *pH_im, 
-	    double *pLags_re, 
+/*
+  SIMD kernels are built with per-function target attributes, so the file
+  still compiles with plain "mex TVConv.c" and runs on CPUs without AVX.
+  The instruction set is chosen at run time from the CPU features.
+*/
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define TVCONV_X86_SIMD
+#include <immintrin.h>
+#endif
+
+/*
+  A bulk kernel computes outputs n0, n0+1, ... of tvconv() up to, but not
+  including, n1, where every tap of every one of these outputs lies inside
+  the source.  Tap ii reads column nLags-1-ii of H and source sample
+  n+pSrcOff[ii], so the loop needs no bounds checks.  pH points at the
+  channel row of output n0 and hStride is the distance between columns,
+  so a block of H copied to scratch works as well as H itself.  Output n
+  times scale is written to pOut[(n-n0)*outEl], or added to it when
+  accumulate is set.  It returns the number of outputs it computed (a
+  multiple of its vector width); the scalar kernel finishes the rest.
+  The taps are summed in the same order as the scalar kernel and without
+  fused multiply-adds, so the results are bit-identical to it.
+
+  Complex source and output samples may be interleaved (re, im) pairs:
+  then srcEl or outEl is 2 and the imaginary pointer is the real one
+  plus 1.  H is always split.  A complex output of a real H and a real
+  source gets (or has added) a zero imaginary part.
+*/
+typedef int (*tvconvBulkFn)(double *pOut_re, double *pOut_im, int outEl,
+			    int n0, int n1, int nS, int nLags,
+			    double *pH_re, double *pH_im, int hStride,
+			    double *pSource_re, double *pSource_im, int srcEl,
+			    const int *pSrcOff, double scale, int accumulate);
+
+/*
+  Scalar loop shared by the bulk kernel and the edges of the output.
+  INBOUNDS(idx) tells whether source sample idx may be used; it is
+  constant 1 in the bulk, where it compiles away.
+*/
+#define TVCONV_SCALAR_BODY(INBOUNDS)					\
+  double *pOutEl_re;                          /* Points to real part of an element of output */ \
+  double *pOutEl_im;                          /* Points to imaginary part of an element of output */ \
+  double *pElH_re;                            /* Points to real part of an element of channel matrix H */ \
+  double *pElH_im;                            /* Points to imaginary part of an element of channel matrix H */ \
+  double elLagSrc_re;                         /* Value of element of lagged source */ \
+  double elLagSrc_im;                         /* Value of element of lagged source */ \
+  double elH_re;                              /* Value of real part of an element of channel matrix H */ \
+  double elH_im;                              /* Value of imaginary part of an element of channel matrix H */ \
+  double sum_re;                              /* Accumulates the real part of multiply and add */ \
+  double sum_im;                              /* Accumulates the imaginary part of multiply and add */ \
+  size_t rowOffset;                           /* Row offset into the channel matrix */ \
+  int n, ii, idx;							\
+									\
+  if ((pOut_im != NULL) && (pH_im != NULL) && (pSource_im != NULL))	\
+    {									\
+      /*								\
+	 Case 1:							\
+	 channel matrix is complex					\
+	 source is complex						\
+      */								\
+      for (n = n0, pOutEl_re = pOut_re, pOutEl_im = pOut_im, rowOffset = (nLags-1)*(size_t)hStride; \
+	   n < n1;							\
+	   n++, pOutEl_re += outEl, pOutEl_im += outEl, rowOffset++)	\
+	{								\
+	  sum_re = 0.;							\
+	  sum_im = 0.;							\
+	  for (ii = 0, pElH_re = pH_re + rowOffset, pElH_im = pH_im + rowOffset; \
+	       ii < nLags;						\
+	       ii++, pElH_re -= hStride, pElH_im -= hStride)			\
+	    {								\
+	      idx = n + pSrcOff[ii];					\
+	      if (INBOUNDS(idx)) {					\
+		elLagSrc_re = pSource_re[idx*(size_t)srcEl];		\
+		elLagSrc_im = pSource_im[idx*(size_t)srcEl];		\
+		elH_re = *pElH_re;					\
+		elH_im = *pElH_im;					\
+									\
+		sum_re += (elH_re*elLagSrc_re - elH_im*elLagSrc_im);	\
+		sum_im += (elH_re*elLagSrc_im + elLagSrc_re*elH_im);	\
+	      }								\
+	    }								\
+	  if (accumulate) {						\
+	    *pOutEl_re += scale*sum_re;					\
+	    *pOutEl_im += scale*sum_im;					\
+	  } else {							\
+	    *pOutEl_re = scale*sum_re;					\
+	    *pOutEl_im = scale*sum_im;					\
+	  }								\
+	}								\
+    }									\
+  else if ((pOut_im != NULL) && (pH_im != NULL))			\
+    {									\
+      /*								\
+	 Case 2:							\
+	 channel matrix is complex					\
+	 source is real							\
+      */								\
+      for (n = n0, pOutEl_re = pOut_re, pOutEl_im = pOut_im, rowOffset = (nLags-1)*(size_t)hStride; \
+	   n < n1;							\
+	   n++, pOutEl_re += outEl, pOutEl_im += outEl, rowOffset++)	\
+	{								\
+	  sum_re = 0.;							\
+	  sum_im = 0.;							\
+	  for (ii = 0, pElH_re = pH_re + rowOffset, pElH_im = pH_im + rowOffset; \
+	       ii < nLags;						\
+	       ii++, pElH_re -= hStride, pElH_im -= hStride)			\
+	    {								\
+	      idx = n + pSrcOff[ii];					\
+	      if (INBOUNDS(idx)) {					\
+		elLagSrc_re = pSource_re[idx*(size_t)srcEl];		\
+		elH_re = *pElH_re;					\
+		elH_im = *pElH_im;					\
+									\
+		sum_re += (elH_re*elLagSrc_re);				\
+		sum_im += (elLagSrc_re*elH_im);				\
+	      }								\
+	    }								\
+	  if (accumulate) {						\
+	    *pOutEl_re += scale*sum_re;					\
+	    *pOutEl_im += scale*sum_im;					\
+	  } else {							\
+	    *pOutEl_re = scale*sum_re;					\
+	    *pOutEl_im = scale*sum_im;					\
+	  }								\
+	}								\
+    }									\
+  else if ((pOut_im != NULL) && (pSource_im != NULL))			\
+    {									\
+      /*								\
+	 Case 3:							\
+	 channel matrix is real						\
+	 source is complex						\
+      */								\
+      for (n = n0, pOutEl_re = pOut_re, pOutEl_im = pOut_im, rowOffset = (nLags-1)*(size_t)hStride; \
+	   n < n1;							\
+	   n++, pOutEl_re += outEl, pOutEl_im += outEl, rowOffset++)	\
+	{								\
+	  sum_re = 0.;							\
+	  sum_im = 0.;							\
+	  for (ii = 0, pElH_re = pH_re + rowOffset;			\
+	       ii < nLags;						\
+	       ii++, pElH_re -= hStride)					\
+	    {								\
+	      idx = n + pSrcOff[ii];					\
+	      if (INBOUNDS(idx)) {					\
+		elLagSrc_re = pSource_re[idx*(size_t)srcEl];		\
+		elLagSrc_im = pSource_im[idx*(size_t)srcEl];		\
+		elH_re = *pElH_re;					\
+									\
+		sum_re += (elH_re*elLagSrc_re);				\
+		sum_im += (elH_re*elLagSrc_im);				\
+	      }								\
+	    }								\
+	  if (accumulate) {						\
+	    *pOutEl_re += scale*sum_re;					\
+	    *pOutEl_im += scale*sum_im;					\
+	  } else {							\
+	    *pOutEl_re = scale*sum_re;					\
+	    *pOutEl_im = scale*sum_im;					\
+	  }								\
+	}								\
+    }									\
+  else									\
+    {									\
+      /*								\
+	 Case 4:							\
+	 channel matrix is real						\
+	 source is real							\
+      */								\
+      for (n = n0, pOutEl_re = pOut_re, rowOffset = (nLags-1)*(size_t)hStride; \
+	   n < n1;							\
+	   n++, pOutEl_re += outEl, rowOffset++)			\
+	{								\
+	  sum_re = 0.;							\
+	  for (ii = 0, pElH_re = pH_re + rowOffset;			\
+	       ii < nLags;						\
+	       ii++, pElH_re -= hStride)					\
+	    {								\
+	      idx = n + pSrcOff[ii];					\
+	      if (INBOUNDS(idx)) {					\
+		elLagSrc_re = pSource_re[idx*(size_t)srcEl];		\
+		elH_re = *pElH_re;					\
+		sum_re += (elH_re*elLagSrc_re);				\
+	      }								\
+	    }								\
+	  if (accumulate) {						\
+	    *pOutEl_re += scale*sum_re;					\
+	  } else {							\
+	    *pOutEl_re = scale*sum_re;					\
+	  }								\
+	  /* A complex output gets a zero imaginary part */		\
+	  if (pOut_im != NULL) {					\
+	    pOutEl_im = pOut_im + (n - n0)*(size_t)outEl;		\
+	    if (accumulate) {						\
+	      *pOutEl_im += scale*0.;					\
+	    } else {							\
+	      *pOutEl_im = scale*0.;					\
+	    }								\
+	  }								\
+	}								\
+    }									\
+  (void)pOutEl_im; (void)pElH_im; (void)elLagSrc_im; (void)elH_im; (void)sum_im; \
+  (void)nS;
+
+#define TVCONV_ALWAYS(idx) 1
+#define TVCONV_INSIDE(idx) (((idx) >= 0) && ((idx) < nS))
+
+static int tvconvBulkScalar(double *pOut_re, double *pOut_im, int outEl,
+			    int n0, int n1, int nS, int nLags,
+			    double *pH_re, double *pH_im, int hStride,
+			    double *pSource_re, double *pSource_im, int srcEl,
+			    const int *pSrcOff, double scale, int accumulate)
+{
+  TVCONV_SCALAR_BODY(TVCONV_ALWAYS)
+  return(n1 - n0);
+}
+
+/*
+  Outputs near the ends of the block, where some taps fall outside the
+  source and are skipped.  Only source samples [0, nS) are used, which
+  is the range the original kernel checked its lagged pointers against.
+*/
+static void tvconvEdge(double *pOut_re, double *pOut_im, int outEl,
+		       int n0, int n1, int nS, int nLags,
+		       double *pH_re, double *pH_im, int hStride,
+		       double *pSource_re, double *pSource_im, int srcEl,
+		       const int *pSrcOff, double scale, int accumulate)
+{
+  TVCONV_SCALAR_BODY(TVCONV_INSIDE)
+}
+
+#undef TVCONV_SCALAR_BODY
+#undef TVCONV_ALWAYS
+#undef TVCONV_INSIDE
+
+#ifdef TVCONV_X86_SIMD
+
+/*
+  Vectorized across output samples: lane k of a vector holds output n+k.
+  For a fixed tap the channel column and the lagged source are both
+  contiguous in n, so all loads are unit stride.
+
+  TVCONV_BULK_BODY expands into the four complex/real cases.  VT is the
+  vector type, W the width, and LD/MUL/ADD/SUB/ST/SET1 the intrinsics.
+  LDX loads W complex source samples and STX stores W complex outputs,
+  either from split arrays or from interleaved pairs.
+*/
+#define TVCONV_BULK_STORE(LD, ST, MUL, ADD, P, SUM)			\
+  if (accumulate)							\
+    {									\
+      ST((P), ADD(LD(P), MUL(vScale, (SUM))));				\
+    }									\
+  else									\
+    {									\
+      ST((P), MUL(vScale, (SUM)));					\
+    }
+#define TVCONV_LDX_SPLIT(LD, X_RE, X_IM, IDX)				\
+  X_RE = LD(pSource_re + (IDX));					\
+  X_IM = LD(pSource_im + (IDX));
+#define TVCONV_STX_SPLIT(LD, ST, MUL, ADD, IDX, SUM_RE, SUM_IM)	\
+  TVCONV_BULK_STORE(LD, ST, MUL, ADD, pOut_re + (IDX), SUM_RE);	\
+  TVCONV_BULK_STORE(LD, ST, MUL, ADD, pOut_im + (IDX), SUM_IM);
+#define TVCONV_BULK_BODY(VT, W, LD, ST, MUL, ADD, SUB, ZERO, SET1, LDX, STX) \
+  int n, ii;								\
+  int nVec = n1 - ((n1 - n0) % (W));					\
+  double *pCol_re, *pCol_im;						\
+  VT h_re, h_im, x_re, x_im, sum_re, sum_im;				\
+  VT vLo, vHi;                        /* Interleaved pairs */		\
+  VT vScale = SET1(scale);						\
+									\
+  if ((pOut_im != NULL) && (pH_im != NULL) && (pSource_im != NULL))	\
+    {									\
+      /* Case 1: complex channel, complex source */			\
+      for (n = n0; n < nVec; n += (W))					\
+	{								\
+	  sum_re = ZERO;						\
+	  sum_im = ZERO;						\
+	  for (ii = 0, pCol_re = pH_re + (nLags-1)*(size_t)hStride + (n - n0),	\
+		 pCol_im = pH_im + (nLags-1)*(size_t)hStride + (n - n0);		\
+	       ii < nLags; ii++, pCol_re -= hStride, pCol_im -= hStride)		\
+	    {								\
+	      h_re = LD(pCol_re);					\
+	      h_im = LD(pCol_im);					\
+	      LDX(LD, x_re, x_im, pSrcOff[ii] + n)			\
+	      sum_re = ADD(sum_re, SUB(MUL(h_re, x_re), MUL(h_im, x_im))); \
+	      sum_im = ADD(sum_im, ADD(MUL(h_re, x_im), MUL(x_re, h_im))); \
+	    }								\
+	  STX(LD, ST, MUL, ADD, n - n0, sum_re, sum_im)			\
+	}								\
+    }									\
+  else if ((pOut_im != NULL) && (pH_im != NULL))			\
+    {									\
+      /* Case 2: complex channel, real source */			\
+      for (n = n0; n < nVec; n += (W))					\
+	{								\
+	  sum_re = ZERO;						\
+	  sum_im = ZERO;						\
+	  for (ii = 0, pCol_re = pH_re + (nLags-1)*(size_t)hStride + (n - n0),	\
+		 pCol_im = pH_im + (nLags-1)*(size_t)hStride + (n - n0);		\
+	       ii < nLags; ii++, pCol_re -= hStride, pCol_im -= hStride)		\
+	    {								\
+	      h_re = LD(pCol_re);					\
+	      h_im = LD(pCol_im);					\
+	      x_re = LD(pSource_re + pSrcOff[ii] + n);			\
+	      sum_re = ADD(sum_re, MUL(h_re, x_re));			\
+	      sum_im = ADD(sum_im, MUL(x_re, h_im));			\
+	    }								\
+	  STX(LD, ST, MUL, ADD, n - n0, sum_re, sum_im)			\
+	}								\
+    }									\
+  else if ((pOut_im != NULL) && (pSource_im != NULL))			\
+    {									\
+      /* Case 3: real channel, complex source */			\
+      for (n = n0; n < nVec; n += (W))					\
+	{								\
+	  sum_re = ZERO;						\
+	  sum_im = ZERO;						\
+	  for (ii = 0, pCol_re = pH_re + (nLags-1)*(size_t)hStride + (n - n0);	\
+	       ii < nLags; ii++, pCol_re -= hStride)				\
+	    {								\
+	      h_re = LD(pCol_re);					\
+	      LDX(LD, x_re, x_im, pSrcOff[ii] + n)			\
+	      sum_re = ADD(sum_re, MUL(h_re, x_re));			\
+	      sum_im = ADD(sum_im, MUL(h_re, x_im));			\
+	    }								\
+	  STX(LD, ST, MUL, ADD, n - n0, sum_re, sum_im)			\
+	}								\
+    }									\
+  else									\
+    {									\
+      /* Case 4: real channel, real source */				\
+      for (n = n0; n < nVec; n += (W))					\
+	{								\
+	  sum_re = ZERO;						\
+	  for (ii = 0, pCol_re = pH_re + (nLags-1)*(size_t)hStride + (n - n0);	\
+	       ii < nLags; ii++, pCol_re -= hStride)				\
+	    {								\
+	      h_re = LD(pCol_re);					\
+	      x_re = LD(pSource_re + pSrcOff[ii] + n);			\
+	      sum_re = ADD(sum_re, MUL(h_re, x_re));			\
+	    }								\
+	  if (pOut_im != NULL)						\
+	    {								\
+	      /* Complex output: the pairs need their zero imaginary part */ \
+	      STX(LD, ST, MUL, ADD, n - n0, sum_re, ZERO)		\
+	    }								\
+	  else								\
+	    {								\
+	      TVCONV_BULK_STORE(LD, ST, MUL, ADD, pOut_re + (n - n0), sum_re); \
+	    }								\
+	}								\
+    }									\
+  (void)h_im; (void)x_im; (void)sum_im; (void)pCol_im; (void)nS;	\
+  (void)vLo; (void)vHi; (void)outEl; (void)srcEl;			\
+  return(nVec - n0);
+
+/*
+  AVX2 interleaved pairs: unpacking two vectors of pairs gives the real
+  and imaginary parts in lane order 0 2 1 3, which a cross-lane permute
+  puts right, and the other way round for a store.
+*/
+#define TVCONV_LDX_AVX2(LD, X_RE, X_IM, IDX)				\
+  vLo = LD(pSource_re + 2*(size_t)(IDX));				\
+  vHi = LD(pSource_re + 2*(size_t)(IDX) + 4);				\
+  X_RE = _mm256_permute4x64_pd(_mm256_unpacklo_pd(vLo, vHi), 0xD8);	\
+  X_IM = _mm256_permute4x64_pd(_mm256_unpackhi_pd(vLo, vHi), 0xD8);
+#define TVCONV_STX_AVX2(LD, ST, MUL, ADD, IDX, SUM_RE, SUM_IM)		\
+  vLo = _mm256_permute4x64_pd(MUL(vScale, (SUM_RE)), 0xD8);		\
+  vHi = _mm256_permute4x64_pd(MUL(vScale, (SUM_IM)), 0xD8);		\
+  TVCONV_STX_PAIRS(LD, ST, ADD, pOut_re + 2*(size_t)(IDX), 4,		\
+		   _mm256_unpacklo_pd(vLo, vHi), _mm256_unpackhi_pd(vLo, vHi))
+#define TVCONV_STX_PAIRS(LD, ST, ADD, P, W, LO, HI)			\
+  if (accumulate)							\
+    {									\
+      ST((P), ADD(LD(P), (LO)));					\
+      ST((P) + (W), ADD(LD((P) + (W)), (HI)));				\
+    }									\
+  else									\
+    {									\
+      ST((P), (LO));							\
+      ST((P) + (W), (HI));						\
+    }
+
+/* AVX2 without FMA: keeps the compiler from contracting MUL+ADD */
+__attribute__((target("avx2")))
+static int tvconvBulkAvx2(double *pOut_re, double *pOut_im, int outEl,
+			  int n0, int n1, int nS, int nLags,
+			  double *pH_re, double *pH_im, int hStride,
+			  double *pSource_re, double *pSource_im, int srcEl,
+			  const int *pSrcOff, double scale, int accumulate)
+{
+  TVCONV_BULK_BODY(__m256d, 4, _mm256_loadu_pd, _mm256_storeu_pd,
+		   _mm256_mul_pd, _mm256_add_pd, _mm256_sub_pd,
+		   _mm256_setzero_pd(), _mm256_set1_pd,
+		   TVCONV_LDX_SPLIT, TVCONV_STX_SPLIT)
+}
+
+__attribute__((target("avx2")))
+static int tvconvBulkAvx2Interleaved(double *pOut_re, double *pOut_im, int outEl,
+				     int n0, int n1, int nS, int nLags,
+				     double *pH_re, double *pH_im, int hStride,
+				     double *pSource_re, double *pSource_im, int srcEl,
+				     const int *pSrcOff, double scale, int accumulate)
+{
+  TVCONV_BULK_BODY(__m256d, 4, _mm256_loadu_pd, _mm256_storeu_pd,
+		   _mm256_mul_pd, _mm256_add_pd, _mm256_sub_pd,
+		   _mm256_setzero_pd(), _mm256_set1_pd,
+		   TVCONV_LDX_AVX2, TVCONV_STX_AVX2)
+}
+
+/*
+  AVX-512F always carries FMA, so contraction has to be switched off
+  explicitly to stay bit-compatible with the scalar loop.
+*/
+#if defined(__clang__)
+#define TVCONV_NO_CONTRACT _Pragma("clang fp contract(off)")
+#define TVCONV_AVX512_ATTR __attribute__((target("avx512f")))
+#else
+#define TVCONV_NO_CONTRACT
+#define TVCONV_AVX512_ATTR __attribute__((target("avx512f"), optimize("fp-contract=off")))
+#endif
+
+/* AVX-512 interleaved pairs: two-source permutes gather and scatter them */
+#define TVCONV_LDX_AVX512(LD, X_RE, X_IM, IDX)				\
+  vLo = LD(pSource_re + 2*(size_t)(IDX));				\
+  vHi = LD(pSource_re + 2*(size_t)(IDX) + 8);				\
+  X_RE = _mm512_permutex2var_pd(vLo, _mm512_set_epi64(14, 12, 10, 8, 6, 4, 2, 0), vHi); \
+  X_IM = _mm512_permutex2var_pd(vLo, _mm512_set_epi64(15, 13, 11, 9, 7, 5, 3, 1), vHi);
+#define TVCONV_STX_AVX512(LD, ST, MUL, ADD, IDX, SUM_RE, SUM_IM)	\
+  vLo = MUL(vScale, (SUM_RE));						\
+  vHi = MUL(vScale, (SUM_IM));						\
+  TVCONV_STX_PAIRS(LD, ST, ADD, pOut_re + 2*(size_t)(IDX), 8,		\
+		   _mm512_permutex2var_pd(vLo, _mm512_set_epi64(11, 3, 10, 2, 9, 1, 8, 0), vHi), \
+		   _mm512_permutex2var_pd(vLo, _mm512_set_epi64(15, 7, 14, 6, 13, 5, 12, 4), vHi))
+
+TVCONV_AVX512_ATTR
+static int tvconvBulkAvx512(double *pOut_re, double *pOut_im, int outEl,
+			    int n0, int n1, int nS, int nLags,
+			    double *pH_re, double *pH_im, int hStride,
+			    double *pSource_re, double *pSource_im, int srcEl,
+			    const int *pSrcOff, double scale, int accumulate)
+{
+  TVCONV_NO_CONTRACT
+  TVCONV_BULK_BODY(__m512d, 8, _mm512_loadu_pd, _mm512_storeu_pd,
+		   _mm512_mul_pd, _mm512_add_pd, _mm512_sub_pd,
+		   _mm512_setzero_pd(), _mm512_set1_pd,
+		   TVCONV_LDX_SPLIT, TVCONV_STX_SPLIT)
+}
+
+TVCONV_AVX512_ATTR
+static int tvconvBulkAvx512Interleaved(double *pOut_re, double *pOut_im, int outEl,
+				       int n0, int n1, int nS, int nLags,
+				       double *pH_re, double *pH_im, int hStride,
+				       double *pSource_re, double *pSource_im, int srcEl,
+				       const int *pSrcOff, double scale, int accumulate)
+{
+  TVCONV_NO_CONTRACT
+  TVCONV_BULK_BODY(__m512d, 8, _mm512_loadu_pd, _mm512_storeu_pd,
+		   _mm512_mul_pd, _mm512_add_pd, _mm512_sub_pd,
+		   _mm512_setzero_pd(), _mm512_set1_pd,
+		   TVCONV_LDX_AVX512, TVCONV_STX_AVX512)
+}
+
+#undef TVCONV_BULK_BODY
+#undef TVCONV_BULK_STORE
+#undef TVCONV_LDX_SPLIT
+#undef TVCONV_STX_SPLIT
+#undef TVCONV_LDX_AVX2
+#undef TVCONV_STX_AVX2
+#undef TVCONV_LDX_AVX512
+#undef TVCONV_STX_AVX512
+#undef TVCONV_STX_PAIRS
+#endif /* TVCONV_X86_SIMD */
+
+/* Best instruction set supported by this CPU */
+static int tvconvCpuIsa(void)
+{
+#ifdef TVCONV_X86_SIMD
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f"))
+    {
+      return(TVCONV_ISA_AVX512);
+    }
+  if (__builtin_cpu_supports("avx2"))
+    {
+      return(TVCONV_ISA_AVX2);
+    }
+#endif
+  return(TVCONV_ISA_SCALAR);
+}
+
+/* The bulk kernels of one instruction set */
+typedef struct {
+  tvconvBulkFn bulk;
+  tvconvBulkFn bulkInterleaved;               /* For interleaved complex outputs */
+} tvconvKernels;
+
+static const tvconvKernels tvconvKernelsScalar = {tvconvBulkScalar, tvconvBulkScalar};
+#ifdef TVCONV_X86_SIMD
+static const tvconvKernels tvconvKernelsAvx2 = {tvconvBulkAvx2, tvconvBulkAvx2Interleaved};
+static const tvconvKernels tvconvKernelsAvx512 = {tvconvBulkAvx512, tvconvBulkAvx512Interleaved};
+#endif
+
+/*
+  The selected kernels, set by one pointer store so that a concurrent
+  first call sees either NULL or a complete set
+*/
+static const tvconvKernels *volatile tvconvKernelsSel = NULL;
+
+/*
+  Select the instruction set used by tvconv().  TVCONV_ISA_AUTO picks the
+  best one for this CPU, which can be overridden by setting the environment
+  variable LLAMACOMM_TVCONV_ISA to "scalar", "avx2" or "avx512".  Requests
+  for an instruction set the CPU lacks fall back to the best available.
+  Returns the instruction set actually selected.
+*/
+int tvconvSelectIsa(int isa)
+{
+  int cpuIsa = tvconvCpuIsa();
+  char *env;
+
+  if (isa == TVCONV_ISA_AUTO)
+    {
+      isa = cpuIsa;
+      if (NULL != (env = getenv("LLAMACOMM_TVCONV_ISA")))
+	{
+	  if (0 == strcmp(env, "scalar"))
+	    {
+	      isa = TVCONV_ISA_SCALAR;
+	    }
+	  else if (0 == strcmp(env, "avx2"))
+	    {
+	      isa = TVCONV_ISA_AVX2;
+	    }
+	  else if (0 == strcmp(env, "avx512"))
+	    {
+	      isa = TVCONV_ISA_AVX512;
+	    }
+	}
+    }
+  if (isa > cpuIsa)
+    {
+      isa = cpuIsa;
+    }
+
+  switch (isa)
+    {
+#ifdef TVCONV_X86_SIMD
+    case TVCONV_ISA_AVX512:
+      tvconvKernelsSel = &tvconvKernelsAvx512;
+      break;
+    case TVCONV_ISA_AVX2:
+      tvconvKernelsSel = &tvconvKernelsAvx2;
+      break;
+#endif
+    default:
+      isa = TVCONV_ISA_SCALAR;
+      tvconvKernelsSel = &tvconvKernelsScalar;
+      break;
+    }
+  return(isa);
+}
+
+/*
+  One (H, lags, source) triple of a tvconv() call.  Tiles only read from
+  it, so they can run concurrently.
+
+  Tap ii multiplies column nLags-1-ii of H with the source delayed by
+  lags[nLags-1-ii], i.e. output n reads source sample
+  n + longestLag - lags[nLags-1-ii] = n + pSrcOff[ii].
+
+  Interleaved complex H and sources have an element stride (hEl, srcEl)
+  of 2, and their imaginary pointer is the real one plus 1.
+*/
+typedef struct {
+  int nS;
+  int nLags;
+  int hLayout;                                /* TVCONV_H_SAMPLE_MAJOR, _LAG_MAJOR or _JAKES */
+  double *pH_re;
+  double *pH_im;                              /* NULL if H is real (or the output is) */
+  int hEl;                                    /* Doubles per element of H */
+  double *pSource_re;
+  double *pSource_im;                         /* NULL if the source is real (or the output is) */
+  int srcEl;                                  /* Doubles per source sample */
+  const tvconvJakesTap *pTaps;                /* TVCONV_H_JAKES: the nLags taps, H is NULL */
+  double tStart;                              /* TVCONV_H_JAKES: time of output 0 */
+  int *pSrcOff;                               /* Source offset of each tap */
+  int nHead;                                  /* Outputs before nHead have a tap before the source */
+  int nBulk;                                  /* Outputs in [nHead, nBulk) have every tap inside it */
+} tvconvTask;
+
+/*
+  Outputs per tile.  A tile of complex data reads about
+  tileLen*nLags*32 bytes of H and source, so tiles of a few thousand
+  outputs keep each thread's lagged source windows in its own cache.
+*/
+#define TVCONV_TILE_LEN 4096
+
+/*
+  Elements of a lag-major H (per real/imaginary part) that are turned
+  into a sample-major block at a time, small enough to stay in cache
+  between the transpose and the kernels reading it.
+*/
+#define TVCONV_HBLOCK_LEN 4096
+
+/* Below this many multiply-adds tvconv() stays single-threaded */
+#define TVCONV_MT_MIN_WORK (1<<20)
+
+/*
+  Doubles of scratch each worker thread needs: a MIMO tile of split or
+  interleaved complex outputs, a block of H (real and imaginary parts)
+  and the coarse evaluations of a decimated Jakes tap.  About 150 kB,
+  kept in the workspace rather than on the workers' stacks, which may
+  be as small as 512 kB or less.
+*/
+#define TVCONV_COARSE_LEN (TVCONV_HBLOCK_LEN/2 + JAKESINTERP_MAX_ORDER + 2)
+#define TVCONV_SCRATCH_LEN (2*TVCONV_TILE_LEN + 2*TVCONV_HBLOCK_LEN + TVCONV_COARSE_LEN)
+
+/*
+  Fill in a task, including the in-bounds range of outputs.  Source
+  samples [0, nS) are usable, so tap ii is inside the source for
+  -pSrcOff[ii] <= n < nS - pSrcOff[ii].  pSrcOff is room for nLags
+  offsets, owned by the caller.  Interleaved complex inputs need a
+  complex output, as their real parts are not contiguous.  A Jakes task
+  has no H (the caller sets its taps), and at most TVCONV_HBLOCK_LEN
+  lags, so that a whole sample of taps fits in a block.
+
+  Returns 0 on success, or the tvconv() error code.
+*/
+static int tvconvTaskInit(tvconvTask *task, int *pSrcOff,
+			  int nS, int nLags, double *pH_re, double *pH_im,
+			  int hLayout, int cplxLayout,
+			  double *pLags_re,
+			  double *pSource_re, double *pSource_im,
+			  int longestLag, int output_isComplex)
+{
+  int interleaved = (cplxLayout == TVCONV_CPLX_INTERLEAVED);
+  int ii;
+  int off;
+  int maxOff;                                 /* Largest source offset */
+  int minOff;                                 /* Smallest source offset */
+
+  if (((NULL == pH_re) && (hLayout != TVCONV_H_JAKES)) ||
+      (NULL == pSource_re) ||
+      (NULL == pLags_re) ||
+      ((hLayout != TVCONV_H_SAMPLE_MAJOR) && (hLayout != TVCONV_H_LAG_MAJOR) &&
+       (hLayout != TVCONV_H_JAKES)) ||
+      ((hLayout == TVCONV_H_JAKES) && (nLags > TVCONV_HBLOCK_LEN)) ||
+      ((cplxLayout != TVCONV_CPLX_SPLIT) && !interleaved) ||
+      (interleaved && !output_isComplex && ((pH_im != NULL) || (pSource_im != NULL)))){
+    return(1);
+  }
+
+  task->pSrcOff = pSrcOff;
+  maxOff = minOff = (nLags > 0) ? longestLag - (int)pLags_re[nLags-1] : 0;
+  for (ii = 0; ii < nLags; ii++)
+    {
+      off = longestLag - (int)pLags_re[nLags-1-ii];
+      task->pSrcOff[ii] = off;
+      maxOff = (off > maxOff) ? off : maxOff;
+      minOff = (off < minOff) ? off : minOff;
+    }
+
+  task->nS = nS;
+  task->nLags = nLags;
+  task->hLayout = hLayout;
+  task->pH_re = pH_re;
+  task->pH_im = (output_isComplex && (pH_im != NULL)) ? pH_im : NULL;
+  task->hEl = (interleaved && (task->pH_im != NULL)) ? 2 : 1;
+  task->pSource_re = pSource_re;
+  task->pSource_im = (output_isComplex && (pSource_im != NULL)) ? pSource_im : NULL;
+  task->srcEl = (interleaved && (task->pSource_im != NULL)) ? 2 : 1;
+  task->pTaps = NULL;
+  task->tStart = 0.;
+
+  task->nHead = (minOff < 0) ? -minOff : 0;
+  task->nHead = (task->nHead > nS) ? nS : task->nHead;
+  task->nBulk = nS - maxOff;
+  task->nBulk = (task->nBulk < task->nHead) ? task->nHead : task->nBulk;
+
+  return(0);
+}
+
+/*
+  Scratch memory of tvconv() and tvconvMimo(): the tasks, their source
+  offsets, TVCONV_SCRATCH_LEN doubles per worker thread, and the
+  per-pair argument arrays and Jakes taps of the MEX gateway.  It only
+  ever grows, so a workspace kept across calls of the same shape stops
+  allocating after the first call.  A persistent workspace outlives the
+  MEX call that created it, and must be freed with
+  tvconvWorkspaceDestroy().
+*/
+struct tvconvWorkspace {
+  int persistent;                             /* Memory survives the MEX call */
+  tvconvTask *tasks;
+  int maxTasks;
+  int *pSrcOff;
+  size_t maxSrcOff;
+  double *pScratch;                           /* TVCONV_SCRATCH_LEN doubles per worker */
+  int maxWorkers;
+  int *pNLags;                                /* Gateway: lags per pair */
+  double **pPairPtrs;                         /* Gateway: TVCONV_PAIR_PTRS arrays of pair pointers */
+  int maxPairs;
+  tvconvJakesTap *pTaps;                      /* Gateway: Jakes taps of all pairs */
+  size_t maxTaps;
+};
+
+/* Pointer arrays per pair used by the MIMO gateway (H, lags, source, re and im) */
+#define TVCONV_PAIR_PTRS 5
+
+/* Replace a scratch array by a bigger one; the contents are not kept */
+static void *tvconvWorkspaceGrow(const tvconvWorkspace *ws, void *p, size_t nBytes)
+{
+  if (p != NULL)
+    {
+      FREE(p);
+    }
+  p = MALLOC((ARGSZ)nBytes);
+#ifdef MATLAB_MEX_FILE
+  if ((p != NULL) && ws->persistent)
+    {
+      mexMakeMemoryPersistent(p);
+    }
+#else
+  (void)ws;
+#endif
+  return(p);
+}
+
+/*
+  Make room for nTasks tasks with nSrcOff source offsets between them,
+  the scratch of nWorkers worker threads, and (for the gateway) nPairs
+  pairs with nTaps Jakes taps.  Returns 0, or 2 if out of memory.
+*/
+static int tvconvWorkspaceReserve(tvconvWorkspace *ws, int nTasks, size_t nSrcOff,
+				  int nWorkers, int nPairs, size_t nTaps)
+{
+  if (nTasks > ws->maxTasks)
+    {
+      ws->tasks = (tvconvTask *)tvconvWorkspaceGrow(ws, ws->tasks,
+						    nTasks*sizeof(tvconvTask));
+      ws->maxTasks = (ws->tasks != NULL) ? nTasks : 0;
+    }
+  if ((nSrcOff > ws->maxSrcOff) || (NULL == ws->pSrcOff))
+    {
+      /* Never empty, so that pSrcOff is valid even for tasks without lags */
+      nSrcOff = (nSrcOff > 0) ? nSrcOff : 1;
+      ws->pSrcOff = (int *)tvconvWorkspaceGrow(ws, ws->pSrcOff, nSrcOff*sizeof(int));
+      ws->maxSrcOff = (ws->pSrcOff != NULL) ? nSrcOff : 0;
+    }
+  if (nWorkers > ws->maxWorkers)
+    {
+      ws->pScratch = (double *)tvconvWorkspaceGrow(ws, ws->pScratch,
+						   nWorkers*(size_t)TVCONV_SCRATCH_LEN*sizeof(double));
+      ws->maxWorkers = (ws->pScratch != NULL) ? nWorkers : 0;
+    }
+  if (nPairs > ws->maxPairs)
+    {
+      ws->pNLags = (int *)tvconvWorkspaceGrow(ws, ws->pNLags, nPairs*sizeof(int));
+      ws->pPairPtrs = (double **)tvconvWorkspaceGrow(ws, ws->pPairPtrs,
+						     TVCONV_PAIR_PTRS*(size_t)nPairs*sizeof(double *));
+      ws->maxPairs = ((ws->pNLags != NULL) && (ws->pPairPtrs != NULL)) ? nPairs : 0;
+    }
+  if (nTaps > ws->maxTaps)
+    {
+      ws->pTaps = (tvconvJakesTap *)tvconvWorkspaceGrow(ws, ws->pTaps,
+							nTaps*sizeof(tvconvJakesTap));
+      ws->maxTaps = (ws->pTaps != NULL) ? nTaps : 0;
+    }
+  return(((nTasks > ws->maxTasks) || (nSrcOff > ws->maxSrcOff) ||
+	  (nWorkers > ws->maxWorkers) ||
+	  (nPairs > ws->maxPairs) || (nTaps > ws->maxTaps)) ? 2 : 0);
+}
+
+/* Free the scratch of a workspace, leaving it empty */
+static void tvconvWorkspaceClear(tvconvWorkspace *ws)
+{
+  int persistent;
+
+  if (ws->tasks != NULL)
+    {
+      FREE(ws->tasks);
+    }
+  if (ws->pSrcOff != NULL)
+    {
+      FREE(ws->pSrcOff);
+    }
+  if (ws->pScratch != NULL)
+    {
+      FREE(ws->pScratch);
+    }
+  if (ws->pNLags != NULL)
+    {
+      FREE(ws->pNLags);
+    }
+  if (ws->pPairPtrs != NULL)
+    {
+      FREE(ws->pPairPtrs);
+    }
+  if (ws->pTaps != NULL)
+    {
+      FREE(ws->pTaps);
+    }
+  persistent = ws->persistent;
+  memset(ws, 0, sizeof(*ws));
+  ws->persistent = persistent;
+}
+
+/* A new, empty workspace to pass to tvconv() or tvconvMimo() across calls */
+tvconvWorkspace *tvconvWorkspaceCreate(void)
+{
+  tvconvWorkspace *ws = (tvconvWorkspace *)CALLOC((ARGSZ)1, (ARGSZ)sizeof(tvconvWorkspace));
+
+  if (ws != NULL)
+    {
+#ifdef MATLAB_MEX_FILE
+      mexMakeMemoryPersistent(ws);
+#endif
+      ws->persistent = 1;
+    }
+  return(ws);
+}
+
+void tvconvWorkspaceDestroy(tvconvWorkspace *ws)
+{
+  if (ws != NULL)
+    {
+      tvconvWorkspaceClear(ws);
+      FREE(ws);
+    }
+}
+
+/*
+  Compute outputs [n0, n1) of a task from sample-major channel rows: pH
+  points at the row of output n0 and hStride is the distance between
+  columns.  Output n times scale is written to pSpan[(n-n0)*outEl], or
+  added to it when accumulate is set.  pSpan_im is NULL for a real
+  output.
+
+  The outputs are split into a head and a tail, which check every tap
+  against the ends of the source, and the steady state in between, which
+  runs without any checks.
+*/
+static void tvconvSpan(const tvconvTask *task, int n0, int n1,
+		       double *pH_re, double *pH_im, int hStride,
+		       double *pSpan_re, double *pSpan_im, int outEl,
+		       double scale, int accumulate)
+{
+  int nS = task->nS;
+  int nLags = task->nLags;
+  int nHeadEnd = (n1 < task->nHead) ? n1 : task->nHead;
+  int nBulkEnd = (n1 < task->nBulk) ? n1 : task->nBulk;
+  int nStart = n0;
+  int n = n0;
+  const tvconvKernels *kernels = tvconvKernelsSel;
+  tvconvBulkFn bulk = (outEl == 2) ? kernels->bulkInterleaved : kernels->bulk;
+
+#define TVCONV_SPAN_AT(P, N, EL) (((P) != NULL) ? (P) + ((N) - nStart)*(size_t)(EL) : NULL)
+
+  /* Head */
+  if (n < nHeadEnd)
+    {
+      tvconvEdge(pSpan_re, pSpan_im, outEl, n, nHeadEnd, nS, nLags,
+		 pH_re, pH_im, hStride,
+		 task->pSource_re, task->pSource_im, task->srcEl,
+		 task->pSrcOff, scale, accumulate);
+      n = nHeadEnd;
+    }
+
+  /* Steady state, vectorized with a scalar remainder */
+  if (n < nBulkEnd)
+    {
+      n += bulk(TVCONV_SPAN_AT(pSpan_re, n, outEl), TVCONV_SPAN_AT(pSpan_im, n, outEl), outEl,
+		n, nBulkEnd, nS, nLags,
+		TVCONV_SPAN_AT(pH_re, n, 1), TVCONV_SPAN_AT(pH_im, n, 1), hStride,
+		task->pSource_re, task->pSource_im, task->srcEl,
+		task->pSrcOff, scale, accumulate);
+    }
+  if (n < nBulkEnd)
+    {
+      n += tvconvBulkScalar(TVCONV_SPAN_AT(pSpan_re, n, outEl), TVCONV_SPAN_AT(pSpan_im, n, outEl), outEl,
+			    n, nBulkEnd, nS, nLags,
+			    TVCONV_SPAN_AT(pH_re, n, 1), TVCONV_SPAN_AT(pH_im, n, 1), hStride,
+			    task->pSource_re, task->pSource_im, task->srcEl,
+			    task->pSrcOff, scale, accumulate);
+    }
+
+  /* Tail */
+  if (n < n1)
+    {
+      tvconvEdge(TVCONV_SPAN_AT(pSpan_re, n, outEl), TVCONV_SPAN_AT(pSpan_im, n, outEl), outEl,
+		 n, n1, nS, nLags,
+		 TVCONV_SPAN_AT(pH_re, n, 1), TVCONV_SPAN_AT(pH_im, n, 1), hStride,
+		 task->pSource_re, task->pSource_im, task->srcEl,
+		 task->pSrcOff, scale, accumulate);
+    }
+
+#undef TVCONV_SPAN_AT
+}
+
+/*
+  Copy H of samples [b0, b1) into a sample-major block with nBlk rows.
+  Element (n, col) of H is at pH[n*sampleStep + col*lagStep]; the loops
+  run along whichever of the two is contiguous.
+*/
+static void tvconvCopyBlock(double *pBlk, int nBlk, const double *pH,
+			    int b0, int b1, int nLags,
+			    size_t sampleStep, size_t lagStep)
+{
+  const double *pElH;
+  int n, col;
+
+  if (lagStep < sampleStep)
+    {
+      for (n = b0; n < b1; n++)
+	{
+	  for (col = 0, pElH = pH + n*sampleStep; col < nLags; col++, pElH += lagStep)
+	    {
+	      pBlk[col*nBlk + (n - b0)] = *pElH;
+	    }
+	}
+    }
+  else
+    {
+      for (col = 0; col < nLags; col++)
+	{
+	  for (n = b0, pElH = pH + b0*sampleStep + col*lagStep; n < b1; n++, pElH += sampleStep)
+	    {
+	      pBlk[col*nBlk + (n - b0)] = *pElH;
+	    }
+	}
+    }
+}
+
+/* Sinusoids of a Jakes tap advanced together, for instruction-level parallelism */
+#define TVCONV_JAKES_CHUNK 8
+
+#define TVCONV_TWOPI (6.283185307179586)
+
+/*
+  Add sum_m 2 cos(w_m (t0 + k*step) + pPhase[m]) to pAcc[k], k < len,
+  where w_m = 2 pi doppf cos(pAlph[m]), or sin(pAlph[m]) when useSin is
+  set.  Each sinusoid is a phasor seeded exactly at t0 and rotated by
+  w_m*step per sample, which keeps the error within a few ulps per
+  thousand samples.
+*/
+static void tvconvJakesSum(double *pAcc, int len, double t0, double step, double doppf,
+			   const double *pAlph, const double *pPhase, int M, int useSin)
+{
+  double c[TVCONV_JAKES_CHUNK], s[TVCONV_JAKES_CHUNK];   /* Phasors */
+  double cw[TVCONV_JAKES_CHUNK], sw[TVCONV_JAKES_CHUNK]; /* Rotation per sample */
+  double w, theta, tmp, sum;
+  int m0, nm, m, k;
+
+  for (m0 = 0; m0 < M; m0 += TVCONV_JAKES_CHUNK)
+    {
+      nm = (M - m0 < TVCONV_JAKES_CHUNK) ? M - m0 : TVCONV_JAKES_CHUNK;
+      for (m = 0; m < nm; m++)
+	{
+	  w = TVCONV_TWOPI*doppf*(useSin ? sin(pAlph[m0 + m]) : cos(pAlph[m0 + m]));
+	  theta = w*t0 + pPhase[m0 + m];
+	  c[m] = cos(theta);
+	  s[m] = sin(theta);
+	  cw[m] = cos(w*step);
+	  sw[m] = sin(w*step);
+	}
+      for (k = 0; k < len; k++)
+	{
+	  for (m = 0, sum = 0.; m < nm; m++)
+	    {
+	      sum += c[m];
+	      tmp = c[m]*cw[m] - s[m]*sw[m];
+	      s[m] = s[m]*cw[m] + c[m]*sw[m];
+	      c[m] = tmp;
+	    }
+	  pAcc[k] += 2.*sum;
+	}
+    }
+}
+
+/*
+  Add sum_m 2 cos(w_m t + pPhase[m]) at the times t = t0 + k, k < len,
+  to pCol[k], sampled at a decimated tap's evaluation times and then
+  interpolated.  coarse holds the evaluations.
+*/
+static void tvconvJakesInterp(double *pCol, int len, double t0,
+			      const tvconvJakesTap *tap, const double *pPhase, int useSin,
+			      double *coarse)
+{
+  double j0;
+  int nCoarse = jakesInterpSpan(t0, len, tap->decim, tap->order, &j0);
+
+  memset(coarse, 0, nCoarse*sizeof(double));
+  tvconvJakesSum(coarse, nCoarse, j0*tap->decim, tap->decim, tap->doppf,
+		 tap->pAlph, pPhase, tap->M, useSin);
+  jakesInterpRun(pCol, 1, len, t0, coarse, j0, tap->decim, tap->order);
+}
+
+/*
+  Write the 'bank' tap at the times t0 + k, k < len, to pCol_re[k] and
+  pCol_im[k] (pCol_im NULL for a real output).  The stored samples lie
+  decim samples apart and repeat every seqLen of them; each output is
+  interpolated from the 4 nearest, rotated by gain*coeff and offset.
+  The outputs are made TVCONV_HBLOCK_LEN/2 at a time, so that their
+  stored samples fit in coarse even when decim is 1.
+*/
+static void tvconvBankTap(double *pCol_re, double *pCol_im, int len, double t0,
+			  const tvconvJakesTap *tap, double *coarse)
+{
+  double period = (double)tap->seqLen*tap->decim;
+  double rot_re = tap->gain*tap->coeff_re;
+  double rot_im = tap->gain*tap->coeff_im;
+  double t, j0;
+  const double *pSeq_re, *pSeq_im;
+  long j;                                     /* Stored sample of coarse[i] */
+  int nCoarse, chunk, k0, k, i;
+
+  for (k0 = 0; k0 < len; k0 += chunk)
+    {
+      chunk = (len - k0 < TVCONV_HBLOCK_LEN/2) ? len - k0 : TVCONV_HBLOCK_LEN/2;
+      t = fmod(t0 + k0 + tap->seqOffset, period);
+      t = (t < 0.) ? t + period : t;
+      nCoarse = jakesInterpSpan(t, chunk, tap->decim, 4, &j0);
+
+      j = (long)fmod(j0, (double)tap->seqLen);
+      j = (j < 0) ? j + tap->seqLen : j;
+      for (i = 0; i < nCoarse; i++, j = (j + 1 < tap->seqLen) ? j + 1 : 0)
+	{
+	  pSeq_re = tap->pSeq_re + j*(size_t)tap->seqEl;
+	  pSeq_im = (tap->pSeq_im != NULL) ? tap->pSeq_im + j*(size_t)tap->seqEl : NULL;
+	  coarse[i] = rot_re**pSeq_re - ((pSeq_im != NULL) ? rot_im**pSeq_im : 0.);
+	}
+      jakesInterpRun(pCol_re + k0, 1, chunk, t, coarse, j0, tap->decim, 4);
+      for (k = k0; k < k0 + chunk; k++)
+	{
+	  pCol_re[k] += tap->offset_re;
+	}
+      if (NULL == pCol_im)
+	{
+	  continue;
+	}
+
+      j = (long)fmod(j0, (double)tap->seqLen);
+      j = (j < 0) ? j + tap->seqLen : j;
+      for (i = 0; i < nCoarse; i++, j = (j + 1 < tap->seqLen) ? j + 1 : 0)
+	{
+	  pSeq_re = tap->pSeq_re + j*(size_t)tap->seqEl;
+	  pSeq_im = (tap->pSeq_im != NULL) ? tap->pSeq_im + j*(size_t)tap->seqEl : NULL;
+	  coarse[i] = rot_im**pSeq_re + ((pSeq_im != NULL) ? rot_re**pSeq_im : 0.);
+	}
+      jakesInterpRun(pCol_im + k0, 1, chunk, t, coarse, j0, tap->decim, 4);
+      for (k = k0; k < k0 + chunk; k++)
+	{
+	  pCol_im[k] += tap->offset_im;
+	}
+    }
+}
+
+/*
+  Generate the taps of samples [b0, b1) of a Jakes task into a
+  sample-major block with nBlk rows.  pBlk_im is NULL for a real output.
+  coarse is room for TVCONV_COARSE_LEN doubles.
+*/
+static void tvconvJakesBlock(const tvconvTask *task, int b0, int b1,
+			     double *pBlk_re, double *pBlk_im, int nBlk, double *coarse)
+{
+  const tvconvJakesTap *tap;
+  double *pCol_re, *pCol_im;
+  double t0 = task->tStart + b0;
+  double amp;
+  int len = b1 - b0;
+  int col, k;
+
+  for (col = 0, tap = task->pTaps; col < task->nLags; col++, tap++)
+    {
+      pCol_re = pBlk_re + col*(size_t)nBlk;
+      pCol_im = (pBlk_im != NULL) ? pBlk_im + col*(size_t)nBlk : NULL;
+      if (tap->pSeq_re != NULL)
+	{
+	  tvconvBankTap(pCol_re, pCol_im, len, t0, tap, coarse);
+	  continue;
+	}
+      if (tap->M < 1)
+	{
+	  for (k = 0; k < len; k++)
+	    {
+	      pCol_re[k] = tap->gain*tap->coeff_re + tap->offset_re;
+	    }
+	  for (k = 0; (pCol_im != NULL) && (k < len); k++)
+	    {
+	      pCol_im[k] = tap->gain*tap->coeff_im + tap->offset_im;
+	    }
+	  continue;
+	}
+
+      amp = tap->gain*sqrt(1./(4.*tap->M));
+      if (tap->decim > 1)
+	{
+	  tvconvJakesInterp(pCol_re, len, t0, tap, tap->pPhi, 0, coarse);
+	}
+      else
+	{
+	  memset(pCol_re, 0, len*sizeof(double));
+	  tvconvJakesSum(pCol_re, len, t0, 1., tap->doppf, tap->pAlph, tap->pPhi, tap->M, 0);
+	}
+      for (k = 0; k < len; k++)
+	{
+	  pCol_re[k] = amp*pCol_re[k] + tap->offset_re;
+	}
+      if (pCol_im != NULL)
+	{
+	  if (tap->decim > 1)
+	    {
+	      tvconvJakesInterp(pCol_im, len, t0, tap, tap->pSphi, 1, coarse);
+	    }
+	  else
+	    {
+	      memset(pCol_im, 0, len*sizeof(double));
+	      tvconvJakesSum(pCol_im, len, t0, 1., tap->doppf, tap->pAlph, tap->pSphi, tap->M, 1);
+	    }
+	  for (k = 0; k < len; k++)
+	    {
+	      pCol_im[k] = amp*pCol_im[k] + tap->offset_im;
+	    }
+	}
+    }
+}
+
+/*
+  Compute outputs [n0, n1) of a task into pTile[(n-n0)*outEl], as
+  tvconvSpan().
+
+  A split sample-major H is read in place.  Otherwise, H is copied a
+  block of whole samples at a time into a small split sample-major
+  buffer, which the kernels then read with unit stride: a lag-major H
+  holds the taps of each output next to each other, so it is read front
+  to back, and an interleaved H is split into its real and imaginary
+  parts.  With more taps than fit in a block, each output is computed
+  straight from H with the scalar kernel.  Jakes taps are generated
+  straight into the blocks, so H never exists as a whole.
+
+  pScratch is the blocks and coarse Jakes evaluations of the calling
+  worker, 2*TVCONV_HBLOCK_LEN + TVCONV_COARSE_LEN doubles.
+*/
+static void tvconvTile(const tvconvTask *task, int n0, int n1,
+		       double *pTile_re, double *pTile_im, int outEl,
+		       double scale, int accumulate, double *pScratch)
+{
+  int nLags = task->nLags;
+  double *blk_re = pScratch;
+  double *blk_im = blk_re + TVCONV_HBLOCK_LEN;
+  double *coarse = blk_im + TVCONV_HBLOCK_LEN;
+  double *pBlk_im = (task->pH_im != NULL) ? blk_im : NULL;
+  size_t sampleStep, lagStep;                 /* Doubles between samples and lags of H */
+  int nBlk;                                   /* Samples per transposed block */
+  int b0, b1, n;
+
+  if ((task->hLayout == TVCONV_H_SAMPLE_MAJOR) && (task->hEl == 1))
+    {
+      tvconvSpan(task, n0, n1, task->pH_re + n0,
+		 (task->pH_im != NULL) ? task->pH_im + n0 : NULL, task->nS,
+		 pTile_re, pTile_im, outEl, scale, accumulate);
+      return;
+    }
+
+  if (task->hLayout == TVCONV_H_LAG_MAJOR)
+    {
+      sampleStep = nLags*(size_t)task->hEl;
+      lagStep = task->hEl;
+    }
+  else
+    {
+      sampleStep = task->hEl;
+      lagStep = task->nS*(size_t)task->hEl;
+    }
+
+  nBlk = (nLags > 0) ? TVCONV_HBLOCK_LEN/nLags : TVCONV_HBLOCK_LEN;
+  nBlk -= (nBlk > 8) ? nBlk % 8 : 0;          /* Whole vectors per block */
+  if (task->hLayout == TVCONV_H_JAKES)
+    {
+      pBlk_im = (pTile_im != NULL) ? blk_im : NULL;
+      for (b0 = n0; b0 < n1; b0 = b1)
+	{
+	  b1 = (b0 + nBlk < n1) ? b0 + nBlk : n1;
+	  tvconvJakesBlock(task, b0, b1, blk_re, pBlk_im, nBlk, coarse);
+	  tvconvSpan(task, b0, b1, blk_re, pBlk_im, nBlk,
+		     pTile_re + (b0 - n0)*(size_t)outEl,
+		     (pTile_im != NULL) ? pTile_im + (b0 - n0)*(size_t)outEl : NULL, outEl,
+		     scale, accumulate);
+	}
+      return;
+    }
+  if (nBlk < 2)
+    {
+      for (n = n0; n < n1; n++)
+	{
+	  tvconvSpan(task, n, n + 1, task->pH_re + n*sampleStep,
+		     (task->pH_im != NULL) ? task->pH_im + n*sampleStep : NULL, (int)lagStep,
+		     pTile_re + (n - n0)*(size_t)outEl,
+		     (pTile_im != NULL) ? pTile_im + (n - n0)*(size_t)outEl : NULL, outEl,
+		     scale, accumulate);
+	}
+      return;
+    }
+
+  for (b0 = n0; b0 < n1; b0 = b1)
+    {
+      b1 = (b0 + nBlk < n1) ? b0 + nBlk : n1;
+      tvconvCopyBlock(blk_re, nBlk, task->pH_re, b0, b1, nLags, sampleStep, lagStep);
+      if (pBlk_im != NULL)
+	{
+	  tvconvCopyBlock(blk_im, nBlk, task->pH_im, b0, b1, nLags, sampleStep, lagStep);
+	}
+      tvconvSpan(task, b0, b1, blk_re, pBlk_im, nBlk,
+		 pTile_re + (b0 - n0)*(size_t)outEl,
+		 (pTile_im != NULL) ? pTile_im + (b0 - n0)*(size_t)outEl : NULL, outEl,
+		 scale, accumulate);
+    }
+}
+
+/* Everything parallelFor() needs to run the tiles of a call */
+typedef struct {
+  tvconvTask *tasks;                          /* nR*nT tasks, index r + t*nR */
+  int nR;
+  int nT;
+  int nS;
+  int nTiles;                                 /* Tiles per receive row */
+  double *pOut_re;                            /* nR x nS output */
+  double *pOut_im;                            /* NULL for a real output */
+  int outEl;                                  /* Doubles per output element */
+  double scale;                               /* Applied to each output */
+  int accumulate;                             /* Add to the output rather than overwrite it */
+  int nWorkers;                               /* Threads the tasks are dealt to */
+  double *pScratch;                           /* TVCONV_SCRATCH_LEN doubles per worker */
+} tvconvJob;
+
+/*
+  Scratch of the worker running task iTask: parallelFor() deals the
+  tasks round-robin, so that is worker iTask % nWorkers, and no two
+  tasks running at once share it
+*/
+#define TVCONV_WORKER_SCRATCH(job, iTask) \
+  ((job)->pScratch + ((iTask) % (job)->nWorkers)*(size_t)TVCONV_SCRATCH_LEN)
+
+/* parallelFor() callback: one tile of a single-pair call */
+static void tvconvTileTask(void *arg, int iTile)
+{
+  const tvconvJob *job = (const tvconvJob *)arg;
+  int n0 = iTile*TVCONV_TILE_LEN;
+  int n1 = (n0 + TVCONV_TILE_LEN < job->nS) ? n0 + TVCONV_TILE_LEN : job->nS;
+
+  size_t outOff = n0*(size_t)job->outEl;
+
+  tvconvTile(job->tasks, n0, n1, job->pOut_re + outOff,
+	     (job->pOut_im != NULL) ? job->pOut_im + outOff : NULL, job->outEl,
+	     job->scale, job->accumulate, TVCONV_WORKER_SCRATCH(job, iTile));
+}
+
+/*
+  Scale a tile, read with stride tileEl, and store it, or add it, with
+  stride outStride into the output
+*/
+static void tvconvMimoStore(double *pOut, size_t outStride,
+			    const double *pTile, int tileEl, int nTile,
+			    double scale, int accumulate)
+{
+  int n;
+
+  if (accumulate)
+    {
+      for (n = 0; n < nTile; n++)
+	{
+	  pOut[n*outStride] += scale*pTile[n*(size_t)tileEl];
+	}
+    }
+  else
+    {
+      for (n = 0; n < nTile; n++)
+	{
+	  pOut[n*outStride] = scale*pTile[n*(size_t)tileEl];
+	}
+    }
+}
+
+/*
+  parallelFor() callback: one tile of one receive row of a MIMO call.
+  The transmit contributions are summed in a contiguous tile buffer, in
+  transmit order, before being scaled and stored (or added) with stride
+  nR into the output.  The tile holds its complex samples the same way
+  as the output, split or interleaved, at the start of the worker's
+  scratch.
+*/
+static void tvconvMimoTileTask(void *arg, int iTask)
+{
+  const tvconvJob *job = (const tvconvJob *)arg;
+  int rx = iTask / job->nTiles;
+  int n0 = (iTask % job->nTiles)*TVCONV_TILE_LEN;
+  int n1 = (n0 + TVCONV_TILE_LEN < job->nS) ? n0 + TVCONV_TILE_LEN : job->nS;
+  double *tile = TVCONV_WORKER_SCRATCH(job, iTask);
+  int outEl = job->outEl;
+  double *pTile_re = tile;
+  double *pTile_im = NULL;
+  size_t outOff = (rx + n0*(size_t)job->nR)*outEl; /* Output double of sample n0 */
+  int tx;
+
+  memset(tile, 0, (n1 - n0)*(size_t)outEl*sizeof(double));
+  if ((job->pOut_im != NULL) && (outEl == 2))
+    {
+      pTile_im = tile + 1;
+    }
+  else if (job->pOut_im != NULL)
+    {
+      pTile_im = tile + TVCONV_TILE_LEN;
+      memset(pTile_im, 0, (n1 - n0)*sizeof(double));
+    }
+  for (tx = 0; tx < job->nT; tx++)
+    {
+      tvconvTile(job->tasks + rx + tx*job->nR, n0, n1, pTile_re, pTile_im, outEl, 1., 1,
+		 tile + 2*TVCONV_TILE_LEN);
+    }
+
+  tvconvMimoStore(job->pOut_re + outOff, job->nR*(size_t)outEl, pTile_re, outEl, n1 - n0,
+		  job->scale, job->accumulate);
+  if (job->pOut_im != NULL)
+    {
+      tvconvMimoStore(job->pOut_im + outOff, job->nR*(size_t)outEl, pTile_im, outEl, n1 - n0,
+		      job->scale, job->accumulate);
+    }
+}
+
+/* Worker threads of nTasks tiles of work: 1 unless the call is big enough */
+static int tvconvWorkers(int nTasks, double work, int nThreads)
+{
+  if ((nThreads != 1) && (nTasks > 1) && (work >= (double)TVCONV_MT_MIN_WORK))
+    {
+      return(parallelForThreads(nThreads, nTasks));
+    }
+  return(1);
+}
+
+/* Run nTasks tiles of work on job->nWorkers threads */
+static void tvconvRun(parallelForFn fn, tvconvJob *job, int nTasks)
+{
+  int iTask;
+
+  if (job->nWorkers > 1)
+    {
+      (void)parallelFor(nTasks, job->nWorkers, fn, job);
+    }
+  else
+    {
+      for (iTask = 0; iTask < nTasks; iTask++)
+	{
+	  fn(job, iTask);
+	}
+    }
+}
+
+static void tvconvInitIsa(void)
+{
+  if (NULL == tvconvKernelsSel)
+    {
+      (void)tvconvSelectIsa(TVCONV_ISA_AUTO);
+    }
+}
+
+/*--- out = TVConv(H, lags, source, longestLag, nThreads, layout, acc, scale, ws); ---*/
+
+/*
+  hLayout: TVCONV_H_SAMPLE_MAJOR for an nS x nLags H, or
+  TVCONV_H_LAG_MAJOR for an nLags x nS H (both column-major).
+  cplxLayout: TVCONV_CPLX_SPLIT for separate real and imaginary arrays,
+  or TVCONV_CPLX_INTERLEAVED for (re, im) pairs.  Interleaved complex
+  arrays are passed as pX_re pointing at the pairs and pX_im = pX_re + 1;
+  real arrays are passed as usual, with pX_im NULL.
+  scale: multiplies every output (1 leaves them unchanged).
+  accumulate: 0 overwrites pOut, 1 adds the scaled outputs to it, so
+  several contributions can be summed into one buffer in place.
+  ws: workspace from tvconvWorkspaceCreate() to reuse the scratch memory
+  of earlier calls, or NULL to allocate it for this call only.
+  nThreads: 1 runs on the calling thread only, 0 uses one thread per core.
+  Calls with fewer than TVCONV_MT_MIN_WORK multiply-adds always run on the
+  calling thread.  The result does not depend on the number of threads.
+*/
+int tvconv(double *pOut_re, double *pOut_im,
+	    int nS, int nLags, double *pH_re, double *pH_im,
+	    int hLayout, int cplxLayout,
+	    double *pLags_re,
 	    double *pSource_re, double *pSource_im,
-	    int longestLag)
+	    int longestLag, double scale, int accumulate,
+	    tvconvWorkspace *ws, int nThreads)
+{
+  int output_isComplex = (pOut_im !=NULL);
+  tvconvWorkspace local;
+  tvconvJob job;
+  int nTiles = (nS + TVCONV_TILE_LEN - 1)/TVCONV_TILE_LEN;
+  int nWorkers = tvconvWorkers(nTiles, (double)nS*(double)nLags, nThreads);
+  int status;
+
+  if ((NULL == pOut_re) || (hLayout == TVCONV_H_JAKES))
+    {
+      return(1);
+    }
+  memset(&local, 0, sizeof(local));
+  ws = (ws != NULL) ? ws : &local;
+
+  if ((0 == (status = tvconvWorkspaceReserve(ws, 1, (size_t)nLags, nWorkers, 0, 0))) &&
+      (0 == (status = tvconvTaskInit(ws->tasks, ws->pSrcOff,
+				     nS, nLags, pH_re, pH_im, hLayout, cplxLayout, pLags_re,
+				     pSource_re, pSource_im,
+				     longestLag, output_isComplex))))
+    {
+      tvconvInitIsa();
+
+      job.tasks = ws->tasks;
+      job.nR = 1;
+      job.nT = 1;
+      job.nS = nS;
+      job.nTiles = nTiles;
+      job.pOut_re = pOut_re;
+      job.pOut_im = output_isComplex ? pOut_im : NULL;
+      job.outEl = (output_isComplex && (cplxLayout == TVCONV_CPLX_INTERLEAVED)) ? 2 : 1;
+      job.scale = scale;
+      job.accumulate = accumulate;
+      job.nWorkers = nWorkers;
+      job.pScratch = ws->pScratch;
+
+      tvconvRun(tvconvTileTask, &job, nTiles);
+    }
+
+  tvconvWorkspaceClear(&local);
+  return(status);
+
+}
+
+/*--- out = TVConv(Hs, lags, sources, longestLag, nThreads, layout, acc, scale, ws); ---*/
+
+/*
+  tvconvMimo() and tvconvJakesMimo(): the channel of pair p is either
+  matrices pH_re[p], pH_im[p] in layout hLayout, or (for pH_re NULL and
+  TVCONV_H_JAKES) the pNLags[p] Jakes taps starting at pTaps plus the
+  lags of all earlier pairs, with output 0 at time tStart.
+*/
+static int tvconvMimoRun(double *pOut_re, double *pOut_im,
+			 int nR, int nT, int nS, int *pNLags,
+			 double **pH_re, double **pH_im, int hLayout, int cplxLayout,
+			 const tvconvJakesTap *pTaps, double tStart,
+			 double **pLags_re,
+			 double **pSource_re, double **pSource_im,
+			 int longestLag, double scale, int accumulate,
+			 tvconvWorkspace *ws, int nThreads)
+{
+  int output_isComplex = (pOut_im !=NULL);
+  tvconvWorkspace local;
+  tvconvJob job;
+  const tvconvJakesTap *tap;
+  double work = 0.;
+  size_t nSrcOff = 0;                         /* Offsets (and taps) of all pairs */
+  int nPairs = nR*nT;
+  int nTiles, nWorkers;
+  int pair, ii;
+  int status;
+
+  if ((NULL == pOut_re) || (nR < 1) || (nT < 1) ||
+      ((NULL == pH_re) && (NULL == pTaps)))
+    {
+      return(1);
+    }
+  memset(&local, 0, sizeof(local));
+  ws = (ws != NULL) ? ws : &local;
+
+  for (pair = 0; pair < nPairs; pair++)
+    {
+      nSrcOff += (size_t)pNLags[pair];
+    }
+  status = tvconvWorkspaceReserve(ws, nPairs, nSrcOff, 0, 0, 0);
+
+  for (pair = 0, nSrcOff = 0; (pair < nPairs) && (0 == status); pair++)
+    {
+      status = tvconvTaskInit(ws->tasks + pair, ws->pSrcOff + nSrcOff,
+			      nS, pNLags[pair],
+			      (pH_re != NULL) ? pH_re[pair] : NULL,
+			      (pH_im != NULL) ? pH_im[pair] : NULL,
+			      hLayout, cplxLayout, pLags_re[pair],
+			      pSource_re[pair], (pSource_im != NULL) ? pSource_im[pair] : NULL,
+			      longestLag, output_isComplex);
+      work += (double)nS*(double)pNLags[pair];
+      if (pTaps != NULL)
+	{
+	  /*
+	    Generating a tap costs about as much as two multiply-adds per
+	    sinusoid per evaluation, and one per point interpolated; a
+	    bank tap only interpolates
+	  */
+	  ws->tasks[pair].pTaps = pTaps + nSrcOff;
+	  ws->tasks[pair].tStart = tStart;
+	  for (ii = 0; ii < pNLags[pair]; ii++)
+	    {
+	      tap = pTaps + nSrcOff + ii;
+	      work += ((tap->decim > 1) || (tap->pSeq_re != NULL)) ?
+		(double)nS*(4.*tap->M/tap->decim + 2.*tap->order) : 4.*(double)nS*(double)tap->M;
+	    }
+	}
+      nSrcOff += (size_t)pNLags[pair];
+    }
+
+  /* The worker count, and so the scratch, depends on the total work */
+  nTiles = (nS + TVCONV_TILE_LEN - 1)/TVCONV_TILE_LEN;
+  nWorkers = tvconvWorkers(nR*nTiles, work, nThreads);
+  if (0 == status)
+    {
+      status = tvconvWorkspaceReserve(ws, nPairs, nSrcOff, nWorkers, 0, 0);
+    }
+
+  if (0 == status)
+    {
+      tvconvInitIsa();
+
+      job.tasks = ws->tasks;
+      job.nR = nR;
+      job.nT = nT;
+      job.nS = nS;
+      job.nTiles = nTiles;
+      job.pOut_re = pOut_re;
+      job.pOut_im = output_isComplex ? pOut_im : NULL;
+      job.outEl = (output_isComplex && (cplxLayout == TVCONV_CPLX_INTERLEAVED)) ? 2 : 1;
+      job.scale = scale;
+      job.accumulate = accumulate;
+      job.nWorkers = nWorkers;
+      job.pScratch = ws->pScratch;
+
+      tvconvRun(tvconvMimoTileTask, &job, nR*nTiles);
+    }
+
+  tvconvWorkspaceClear(&local);
+  return(status);
+}
+
+/*--- out = TVConv(Hs, lags, sources, longestLag, nThreads, layout, acc, scale, ws); ---*/
+
+/*
+  MIMO form of tvconv(): out(r, :) = sum over t of tvconv(H{r,t}, ...)
+  written straight into the nR x nS (column-major) output, with no
+  per-pair output.  The per-pair arguments are arrays indexed by
+  r + t*nR, as for an nR x nT MATLAB cell array.  pH_im[p] or
+  pSource_im[p] may be NULL for real data, and pOut_im must be non-NULL
+  if any of them is complex.  cplxLayout, scale, accumulate and ws are
+  as for tvconv(), with scale and accumulate applied to the summed rows.
+*/
+int tvconvMimo(double *pOut_re, double *pOut_im,
+	       int nR, int nT, int nS, int *pNLags,
+	       double **pH_re, double **pH_im, int hLayout, int cplxLayout,
+	       double **pLags_re,
+	       double **pSource_re, double **pSource_im,
+	       int longestLag, double scale, int accumulate,
+	       tvconvWorkspace *ws, int nThreads)
 {
-  
-  double *pOutEnd_re;                         /* Sentinel pointer for the end of the output */
-
-  /********** Internally allocated values **********/
-  double **pLagSrc_re;                        /* lagSrc real part */
-  double **pLagSrc_im;                        /* lagSrc imaginary part */
-  double **pLagSrcEnd_re;                     /* Sentinel pointer for the end of lagSrc */
-
-  /********** "Working" values, used for loops **********/
-  double *pElLags;                            /* Points to an element of lags */
-  int elLags;                                 /* Value of element of lags */
-  double **pElLagSrc_re;                      /* Points to real part of an element of lagSrc */
-  double **pElLagSrc_im;                      /* Points to imaginary part of an element of lagSrc */
-  double elLagSrc_re;                         /* Value of element of lagSrc[][] */
-  double elLagSrc_im;                         /* Value of element of lagSrc[][] */
-  double *pElH_re;                            /* Points to real part of an element of channel matrix H */
-  double *pElH_im;                            /* Points to imaginary part of an element of channel matrix H */
-  double elH_re;                              /* Value of real part of an element of channel matrix H */
-  double elH_im;                              /* Value of imaginary part of an element of channel matrix H */
-  double *pOutEl_re;                          /* Points to real part of an element of output */
-  double *pOutEl_im;                          /* Points to imaginary part of an element of output */
-  int rowOffset;                              /* Row offset into the channel matrix */
-  double sum_re;                              /* Accumulates the real part of multiply and add */
-  double sum_im;                              /* Accumulates the imaginary part of multiply and add */
-
-  int nLagsm1 = nLags - 1;
-
-  double *pSrcLongLag_re;                     /* source pointer offset real part by longestLag */
-  double *pSrcLongLag_im;                     /* source pointer offset imaginary part by longestLag */
+  if ((NULL == pH_re) || (hLayout == TVCONV_H_JAKES))
+    {
+      return(1);
+    }
+  return(tvconvMimoRun(pOut_re, pOut_im, nR, nT, nS, pNLags,
+		       pH_re, pH_im, hLayout, cplxLayout, NULL, 0.,
+		       pLags_re, pSource_re, pSource_im,
+		       longestLag, scale, accumulate, ws, nThreads));
+}
 
-  int output_isComplex = (pOut_im !=NULL);
-  int source_isComplex = output_isComplex && (pSource_im != NULL);
-  int H_isComplex = output_isComplex && (pH_im != NULL);       /* Flag set if channel matrix H is complex */
+/*--- out = TVConv(chans, lags, sources, longestLag, nThreads, [], acc, scale, ws); ---*/
 
-  double *pSourceEnd_re = pSource_re+nS;
-  double *ptr_re;
+/*
+  tvconvMimo() with Jakes channels generated on the fly: pTaps holds the
+  pNLags[p] taps of each pair p in turn, and output 0 is at time tStart
+  (jakes4's starttime).  Only a block of taps per thread exists at a
+  time, instead of an nLags x nS H per pair.  Each pair has at most
+  TVCONV_HBLOCK_LEN lags.
+*/
+int tvconvJakesMimo(double *pOut_re, double *pOut_im,
+		    int nR, int nT, int nS, int *pNLags,
+		    const tvconvJakesTap *pTaps, double tStart, int cplxLayout,
+		    double **pLags_re,
+		    double **pSource_re, double **pSource_im,
+		    int longestLag, double scale, int accumulate,
+		    tvconvWorkspace *ws, int nThreads)
+{
+  if (NULL == pTaps)
+    {
+      return(1);
+    }
+  return(tvconvMimoRun(pOut_re, pOut_im, nR, nT, nS, pNLags,
+		       NULL, NULL, TVCONV_H_JAKES, cplxLayout, pTaps, tStart,
+		       pLags_re, pSource_re, pSource_im,
+		       longestLag, scale, accumulate, ws, nThreads));
+}
 
-  pOutEnd_re = pOut_re + nS; /* output array (real part) sentinel value */
+/*
+  Plan the decimation of a 'zheng' tap for tvconvJakesMimo(): with
+  tol > 0, a slow tap is evaluated every tap->decim samples and
+  interpolated, within tol of its gain (see jakesInterpPlan()).  A
+  'bank' tap keeps the decimation of its stored sequence.
+*/
+void tvconvJakesTapPlan(tvconvJakesTap *tap, double tol)
+{
+  if (tap->pSeq_re != NULL)
+    {
+      tap->order = 4;
+      return;
+    }
+  tap->decim = jakesInterpPlan(tap->doppf, tap->M, tol, &tap->order);
+}
 
-  /* 
-     Build laggedSource so that:
-     lagSrc[ii][jj] = Source[jj + longestLag - lags[nLags-ii-1]] 
+#ifdef MATLAB_MEX_FILE
+/*
+  Data of a double mxArray.  Built with "mex -R2018a" MATLAB stores
+  complex arrays as interleaved pairs, which the kernels read in place;
+  the imaginary parts are then the pairs plus one.
+*/
+#if MX_HAS_INTERLEAVED_COMPLEX
+#define TVCONV_MX_CPLX TVCONV_CPLX_INTERLEAVED
+#define TVCONV_MX_EL(A) (mxIsComplex(A) ? 2 : 1)
+#define TVCONV_MX_RE(A) (mxIsComplex(A) ? (double *)mxGetComplexDoubles(A) : mxGetDoubles(A))
+#define TVCONV_MX_IM(A) (mxIsComplex(A) ? (double *)mxGetComplexDoubles(A) + 1 : NULL)
+#else
+#define TVCONV_MX_CPLX TVCONV_CPLX_SPLIT
+#define TVCONV_MX_EL(A) 1
+#define TVCONV_MX_RE(A) mxGetPr(A)
+#define TVCONV_MX_IM(A) mxGetPi(A)
+#endif
 
-     pElLags starts at the last element of lags and moves to the start
-  */
+/*
+  Layout of the channel matrices from the optional sixth argument:
+  'sampleMajor' (the default) for nS x nLags, 'lagMajor' for nLags x nS.
+*/
+static int tvconvLayoutArg(int nrhs, const mxArray *prhs[])
+{
+  char layout[16];
 
-  if ((NULL == pOut_re) || 
-      (NULL == pH_re) || 
-      (NULL == pSource_re) || 
-      (NULL == pLags_re)){
-    return(1);
-  }
-                 
-  if (NULL == (pLagSrc_re = (double **)CALLOC((ARGSZ)nLags, (ARGSZ)sizeof(double *))))
+  if ((nrhs < 6) || mxIsEmpty(prhs[5]))
+    {
+      return(TVCONV_H_SAMPLE_MAJOR);
+    }
+  if (!mxIsChar(prhs[5]) || (0 != mxGetString(prhs[5], layout, sizeof(layout))))
     {
-      return(2); /* Error */
+      mexErrMsgTxt("TVConv: layout must be 'sampleMajor' or 'lagMajor'");
     }
-  pLagSrcEnd_re = pLagSrc_re + nLags;
+  if (0 == strcmp(layout, "lagMajor"))
+    {
+      return(TVCONV_H_LAG_MAJOR);
+    }
+  if (0 != strcmp(layout, "sampleMajor"))
+    {
+      mexErrMsgTxt("TVConv: layout must be 'sampleMajor' or 'lagMajor'");
+    }
+  return(TVCONV_H_SAMPLE_MAJOR);
+}
 
-  if ( source_isComplex )
+/*
+  Optional seventh argument: the output starts from a copy of acc, an
+  nRows x nS matrix, instead of zeros.  Returns NULL if it is absent or
+  empty.
+*/
+static const mxArray *tvconvAccArg(int nrhs, const mxArray *prhs[],
+				   int nRows, int nS)
+{
+  if ((nrhs < 7) || mxIsEmpty(prhs[6]))
     {
-      if (NULL == (pLagSrc_im = (double **)CALLOC((ARGSZ)nLags, (ARGSZ)sizeof(double *))))
-	{
-	  FREE(pLagSrc_re);
-	  return(3); /* Error */
-	}
-      
-      pSrcLongLag_re = pSource_re + longestLag;
-      pSrcLongLag_im = pSource_im + longestLag;
-      for (pElLags = pLags_re + nLagsm1, pElLagSrc_re = pLagSrc_re, pElLagSrc_im = pLagSrc_im; 
-	   pElLagSrc_re < pLagSrcEnd_re; 
-	   pElLags--, pElLagSrc_re++, pElLagSrc_im++){
-	elLags = (int)*pElLags;
-	*pElLagSrc_re = pSrcLongLag_re - elLags; 
-	*pElLagSrc_im = pSrcLongLag_im - elLags;
-      }
-    } 
-  else 
+      return(NULL);
+    }
+  if (!mxIsDouble(prhs[6]) ||
+      (mxGetM(prhs[6]) != (size_t)nRows) || (mxGetN(prhs[6]) != (size_t)nS))
     {
-      pLagSrc_im = (double **)NULL; /* Safe for free */
+      mexErrMsgTxt("TVConv: acc must be a double matrix the size of the output");
+    }
+  return(prhs[6]);
+}
 
-      pSrcLongLag_re = pSource_re + longestLag;
-      for (pElLags = pLags_re + nLagsm1, pElLagSrc_re = pLagSrc_re; 
-	   pElLagSrc_re < pLagSrcEnd_re; 
-	   pElLagSrc_re++, pElLags--){
-	elLags = (int)*pElLags;
-	*pElLagSrc_re = pSrcLongLag_re - elLags;      
-      }
+/* Optional eighth argument: scale applied to the convolution (default 1) */
+static double tvconvScaleArg(int nrhs, const mxArray *prhs[])
+{
+  if ((nrhs < 8) || mxIsEmpty(prhs[7]))
+    {
+      return(1.);
     }
-  
+  return(mxGetScalar(prhs[7]));
+}
+
+/*
+  Create the nRows x nS output.  It is complex if any input is, and
+  holds a copy of acc when one is given.
+*/
+static mxArray *tvconvCreateOutput(int nRows, int nS, int out_isComplex,
+				   const mxArray *pAcc_mxArr)
+{
+  mxArray *pOut_mxArr;
+  size_t nEl = (size_t)nRows*(size_t)nS;
+
+  out_isComplex |= ((pAcc_mxArr != NULL) && mxIsComplex(pAcc_mxArr));
+  pOut_mxArr = mxCreateNumericMatrix((mwSize)nRows, (mwSize)nS, mxDOUBLE_CLASS,
+				     out_isComplex ? mxCOMPLEX : mxREAL);
+  if (pAcc_mxArr != NULL)
+    {
+#if MX_HAS_INTERLEAVED_COMPLEX
+      double *pOut = TVCONV_MX_RE(pOut_mxArr);
+      double *pAcc = TVCONV_MX_RE(pAcc_mxArr);
+      size_t k;
 
-  /*
-    Now used laggedSource to do the multiply and add operations
-  */
-  if ( H_isComplex && source_isComplex )
-    {
-      /* 
-	 Case 1: 
-	 channel matrix is complex
-	 source is complex 
-      */    
-      for (pOutEl_re = pOut_re, pOutEl_im = pOut_im, rowOffset = (nLagsm1*nS); 
-	   pOutEl_re < pOutEnd_re; 
-	   pOutEl_re++, pOutEl_im++, rowOffset++ )
-	{
-	  sum_re=0.;
-	  sum_im=0.; 
-	  for (pElLagSrc_re = pLagSrc_re, pElLagSrc_im = pLagSrc_im, pElH_re = pH_re + rowOffset, pElH_im = pH_im + rowOffset;
-	       pElLagSrc_re < pLagSrcEnd_re; 
-	       pElLagSrc_re++, pElLagSrc_im++, pElH_re-=nS, pElH_im-=nS)
-	    {	
-
-	      ptr_re = ((*pElLagSrc_re)++);
-	      if (ptr_re < pSourceEnd_re) {
-		elLagSrc_re = *ptr_re;
-		elLagSrc_im = *((*pElLagSrc_im)++);
-		elH_re = *pElH_re;
-		elH_im = *pElH_im;
-
-		sum_re += (elH_re*elLagSrc_re - elH_im*elLagSrc_im);
-		sum_im += (elH_re*elLagSrc_im + elLagSrc_re*elH_im);
-	      }
-	    }      
-	  *pOutEl_re = sum_re;
-	  *pOutEl_im = sum_im; 
+      if (mxIsComplex(pOut_mxArr) && !mxIsComplex(pAcc_mxArr))
+	{
+	  /* Real acc into the real parts of the pairs */
+	  for (k = 0; k < nEl; k++)
+	    {
+	      pOut[2*k] = pAcc[k];
+	    }
+	}
+      else
+	{
+	  memcpy(pOut, pAcc, nEl*TVCONV_MX_EL(pAcc_mxArr)*sizeof(double));
+	}
+#else
+      memcpy(mxGetPr(pOut_mxArr), mxGetPr(pAcc_mxArr), nEl*sizeof(double));
+      if (mxIsComplex(pAcc_mxArr))
+	{
+	  memcpy(mxGetPi(pOut_mxArr), mxGetPi(pAcc_mxArr), nEl*sizeof(double));
 	}
+#endif
+    }
+  return(pOut_mxArr);
+}
 
-    } 
-  else if ( H_isComplex && !source_isComplex ) 
-    {
-      /* 
-	 Case 2: 
-	 channel matrix is complex 
-	 source is real 
-      */
-      for (pOutEl_re = pOut_re, pOutEl_im = pOut_im, rowOffset = (nLagsm1*nS); pOutEl_re < pOutEnd_re; pOutEl_re++, pOutEl_im++, rowOffset++ )
-	{
-	  sum_re = 0.;
-	  sum_im = 0.; 
-	  for (pElLagSrc_re = pLagSrc_re, pElH_re =pH_re + rowOffset, pElH_im = pH_im + rowOffset;
-	       pElLagSrc_re<pLagSrcEnd_re; 
-	       pElLagSrc_re++, pElH_re-=nS, pElH_im-=nS) {
-
-	    ptr_re = ((*pElLagSrc_re)++);
-	    if (ptr_re < pSourceEnd_re) {
-	      elLagSrc_re = *ptr_re;
-	      elH_re = *pElH_re;
-	      elH_im = *pElH_im;
-
-	      sum_re += (elH_re*elLagSrc_re);
-	      sum_im += (elLagSrc_re*elH_im);
+/*
+  Workspaces handed out to MATLAB.  A handle is an index into this table
+  plus one; released entries are NULL and get reused.
+*/
+static tvconvWorkspace **tvconvHandles = NULL;
+static int tvconvNHandles = 0;
+
+/* Free every workspace when the MEX file is cleared or MATLAB exits */
+static void tvconvAtExit(void)
+{
+  int h;
+
+  for (h = 0; h < tvconvNHandles; h++)
+    {
+      tvconvWorkspaceDestroy(tvconvHandles[h]);
+    }
+  if (tvconvHandles != NULL)
+    {
+      mxFree(tvconvHandles);
+    }
+  tvconvHandles = NULL;
+  tvconvNHandles = 0;
+}
+
+/* Workspace of a handle, or an error if it is not a live one */
+static tvconvWorkspace *tvconvHandleWorkspace(const mxArray *pHandle_mxArr)
+{
+  int h;
+
+  if (!mxIsNumeric(pHandle_mxArr) || (mxGetNumberOfElements(pHandle_mxArr) != 1))
+    {
+      mexErrMsgTxt("TVConv: a workspace handle must be a scalar");
+    }
+  h = (int)mxGetScalar(pHandle_mxArr) - 1;
+  if ((h < 0) || (h >= tvconvNHandles) || (NULL == tvconvHandles[h]))
+    {
+      mexErrMsgTxt("TVConv: invalid or released workspace handle");
+    }
+  return(tvconvHandles[h]);
+}
+
+/*
+  Optional ninth argument: workspace handle.  Returns NULL, so the call
+  allocates its own scratch, if it is absent or empty, or if it is stale,
+  e.g. saved before "clear mex" freed every workspace.
+*/
+static tvconvWorkspace *tvconvWorkspaceArg(int nrhs, const mxArray *prhs[])
+{
+  int h;
+
+  if ((nrhs < 9) || mxIsEmpty(prhs[8]) || !mxIsNumeric(prhs[8]))
+    {
+      return(NULL);
+    }
+  h = (int)mxGetScalar(prhs[8]) - 1;
+  if ((h < 0) || (h >= tvconvNHandles))
+    {
+      return(NULL);
+    }
+  return(tvconvHandles[h]);
+}
+
+/*
+  ws = TVConv('workspace')    create a workspace and return its handle
+  TVConv('release', ws)       free it
+*/
+static void tvconvCommand(int nlhs, mxArray *plhs[],
+			  int nrhs, const mxArray *prhs[])
+{
+  char command[16];
+  tvconvWorkspace **pNewHandles;
+  int h;
+
+  (void)nlhs;
+
+  if (0 != mxGetString(prhs[0], command, sizeof(command)))
+    {
+      mexErrMsgTxt("TVConv: unknown command");
+    }
+
+  if (0 == strcmp(command, "workspace"))
+    {
+      mexAtExit(tvconvAtExit);
+      h = 0;
+      while ((h < tvconvNHandles) && (tvconvHandles[h] != NULL))
+	{
+	  h++;
+	}
+      if (h == tvconvNHandles)
+	{
+	  /* Grow the table */
+	  pNewHandles = (tvconvWorkspace **)mxCalloc((mwSize)(2*tvconvNHandles + 8),
+						     (mwSize)sizeof(tvconvWorkspace *));
+	  mexMakeMemoryPersistent(pNewHandles);
+	  if (tvconvHandles != NULL)
+	    {
+	      memcpy(pNewHandles, tvconvHandles, tvconvNHandles*sizeof(tvconvWorkspace *));
+	      mxFree(tvconvHandles);
 	    }
-	  }
-	  *pOutEl_re = sum_re;
-	  *pOutEl_im = sum_im;
+	  tvconvHandles = pNewHandles;
+	  tvconvNHandles = 2*tvconvNHandles + 8;
 	}
-    } 
-  else if ( !H_isComplex && source_isComplex ) 
-    {
-      /* 
-	 Case 3: 
-	 channel matrix is real
-	 source is complex
-      */
-      for (pOutEl_re = pOut_re, pOutEl_im = pOut_im, rowOffset = (nLagsm1*nS); 
-	   pOutEl_re < pOutEnd_re; 
-	   pOutEl_re++, pOutEl_im++, rowOffset++ )
-	{
-	  sum_re=0.;
-	  sum_im=0.;
-	  for (pElLagSrc_re = pLagSrc_re, pElLagSrc_im = pLagSrc_im, pElH_re =pH_re + rowOffset; 
-	       pElLagSrc_re < pLagSrcEnd_re; 
-	       pElLagSrc_re++, pElLagSrc_im++, pElH_re-=nS)
+      if (NULL == (tvconvHandles[h] = tvconvWorkspaceCreate()))
+	{
+	  mexErrMsgTxt("TVConv: could not allocate a workspace");
+	}
+      plhs[0] = mxCreateDoubleScalar((double)(h + 1));
+    }
+  else if (0 == strcmp(command, "release"))
+    {
+      if (nrhs < 2)
+	{
+	  mexErrMsgTxt("TVConv: release needs a workspace handle");
+	}
+      tvconvWorkspaceDestroy(tvconvHandleWorkspace(prhs[1]));
+      tvconvHandles[(int)mxGetScalar(prhs[1]) - 1] = NULL;
+    }
+  else
+    {
+      mexErrMsgTxt("TVConv: unknown command");
+    }
+}
+
+/* Real scalar field name of chanstate lag, or the error errMsg */
+static double tvconvJakesScalarField(const mxArray *pStates_mxArr, int lag, const char *name,
+				     const char *errMsg)
+{
+  const mxArray *pField_mxArr = mxGetField(pStates_mxArr, (mwIndex)lag, name);
+
+  if ((NULL == pField_mxArr) || !mxIsNumeric(pField_mxArr) || mxIsComplex(pField_mxArr) ||
+      mxIsEmpty(pField_mxArr))
+    {
+      mexErrMsgTxt(errMsg);
+    }
+  return(mxGetScalar(pField_mxArr));
+}
+
+/*
+  Jakes tap lag of a chanstate struct array, as made by GetWssusChannel
+  for jakes4, with amplitude gain and the offset pOffset_mxArr(lag) (if
+  not NULL).  The 'zheng', 'constant' and 'bank' methods are generated
+  natively; a 'bank' tap reads its stored sequence from the cell
+  pSeqs_mxArr(lag), as returned by FadingBank('sequence', chanstate).
+*/
+static void tvconvJakesTapArg(tvconvJakesTap *tap, const mxArray *pStates_mxArr,
+			      int lag, double gain, const mxArray *pOffset_mxArr,
+			      const mxArray *pSeqs_mxArr)
+{
+  static const char *bankErr =
+    "TVConv: a 'bank' chanstate needs seqLen, decim, offset and rot, and its sequence in seqs";
+  static const char *zhengErr =
+    "TVConv: a 'zheng' chanstate needs M, doppf, alph, phi and sphi";
+  const mxArray *pField_mxArr;
+  char method[16];
+  double period;
+  int ii;
+
+  pField_mxArr = mxGetField(pStates_mxArr, (mwIndex)lag, "method");
+  if ((NULL == pField_mxArr) || (0 != mxGetString(pField_mxArr, method, sizeof(method))))
+    {
+      mexErrMsgTxt("TVConv: every chanstate needs a method");
+    }
+  for (ii = 0; method[ii] != '\0'; ii++)
+    {
+      method[ii] = (char)(((method[ii] >= 'A') && (method[ii] <= 'Z')) ?
+			  method[ii] - 'A' + 'a' : method[ii]);
+    }
+
+  memset(tap, 0, sizeof(*tap));
+  tap->gain = gain;
+  if (pOffset_mxArr != NULL)
+    {
+      tap->offset_re = TVCONV_MX_RE(pOffset_mxArr)[lag*TVCONV_MX_EL(pOffset_mxArr)];
+      tap->offset_im = mxIsComplex(pOffset_mxArr) ?
+	TVCONV_MX_IM(pOffset_mxArr)[lag*TVCONV_MX_EL(pOffset_mxArr)] : 0.;
+    }
+  if (0 == strcmp(method, "constant"))
+    {
+      pField_mxArr = mxGetField(pStates_mxArr, (mwIndex)lag, "coeff");
+      if ((NULL == pField_mxArr) || mxIsEmpty(pField_mxArr))
+	{
+	  mexErrMsgTxt("TVConv: a 'constant' chanstate needs a coeff");
+	}
+      tap->coeff_re = mxGetScalar(pField_mxArr);
+      tap->coeff_im = mxIsComplex(pField_mxArr) ? *TVCONV_MX_IM(pField_mxArr) : 0.;
+      return;
+    }
+  if (0 == strcmp(method, "bank"))
+    {
+      period = tvconvJakesScalarField(pStates_mxArr, lag, "seqLen", bankErr);
+      tap->decim = (int)tvconvJakesScalarField(pStates_mxArr, lag, "decim", bankErr);
+      tap->seqOffset = tvconvJakesScalarField(pStates_mxArr, lag, "offset", bankErr);
+      pField_mxArr = mxGetField(pStates_mxArr, (mwIndex)lag, "rot");
+      if ((NULL == pField_mxArr) || !mxIsDouble(pField_mxArr) || mxIsEmpty(pField_mxArr))
+	{
+	  mexErrMsgTxt(bankErr);
+	}
+      tap->coeff_re = mxGetScalar(pField_mxArr);
+      tap->coeff_im = mxIsComplex(pField_mxArr) ? *TVCONV_MX_IM(pField_mxArr) : 0.;
+
+      pField_mxArr = ((pSeqs_mxArr != NULL) && mxIsCell(pSeqs_mxArr) &&
+		      (mxGetNumberOfElements(pSeqs_mxArr) > (size_t)lag)) ?
+	mxGetCell(pSeqs_mxArr, (mwIndex)lag) : NULL;
+      if ((NULL == pField_mxArr) || !mxIsDouble(pField_mxArr) ||
+	  (tap->decim < 1) || (tap->decim > JAKESINTERP_MAX_DECIM) ||
+	  ((double)mxGetNumberOfElements(pField_mxArr)*tap->decim != period))
+	{
+	  mexErrMsgTxt(bankErr);
+	}
+      tap->pSeq_re = TVCONV_MX_RE(pField_mxArr);
+      tap->pSeq_im = TVCONV_MX_IM(pField_mxArr);
+      tap->seqEl = TVCONV_MX_EL(pField_mxArr);
+      tap->seqLen = (int)mxGetNumberOfElements(pField_mxArr);
+      tap->order = 4;
+      return;
+    }
+  if (0 != strcmp(method, "zheng"))
+    {
+      mexErrMsgTxt("TVConv: only 'zheng', 'constant' and 'bank' chanstates can be generated");
+    }
+
+  tap->M = (int)tvconvJakesScalarField(pStates_mxArr, lag, "M", zhengErr);
+  tap->doppf = tvconvJakesScalarField(pStates_mxArr, lag, "doppf", zhengErr);
+  pField_mxArr = mxGetField(pStates_mxArr, (mwIndex)lag, "alph");
+  tap->pAlph = ((pField_mxArr != NULL) &&
+		(mxGetNumberOfElements(pField_mxArr) >= (size_t)tap->M)) ? TVCONV_MX_RE(pField_mxArr) : NULL;
+  pField_mxArr = mxGetField(pStates_mxArr, (mwIndex)lag, "phi");
+  tap->pPhi = ((pField_mxArr != NULL) &&
+	       (mxGetNumberOfElements(pField_mxArr) >= (size_t)tap->M)) ? TVCONV_MX_RE(pField_mxArr) : NULL;
+  pField_mxArr = mxGetField(pStates_mxArr, (mwIndex)lag, "sphi");
+  tap->pSphi = ((pField_mxArr != NULL) &&
+		(mxGetNumberOfElements(pField_mxArr) >= (size_t)tap->M)) ? TVCONV_MX_RE(pField_mxArr) : NULL;
+  if ((tap->M < 1) || (NULL == tap->pAlph) || (NULL == tap->pPhi) || (NULL == tap->pSphi))
+    {
+      mexErrMsgTxt(zhengErr);
+    }
+}
+
+/*
+  out = TVConv(Hs, lags, sources, longestLag, nThreads, layout, acc, scale, ws)
+
+  Hs      (nR x nT cell) nS x nLags channel matrix of each pair, or
+          nLags x nS with layout 'lagMajor'; or a Jakes channel struct
+          for each pair (a single struct for one pair), whose taps are
+          generated on the fly, as by jakes4(start, nSamples, chanstates):
+            .chanstates  (1 x nLags struct) jakes4 chanstate of each lag
+            .gains       (nLags vector) amplitude of each lag
+            .start       time of the first output (the same for every pair)
+            .nSamples    number of outputs, nS
+            .offsets     (nLags vector, optional) added to each lag
+            .seqs        (1 x nLags cell, for 'bank' chanstates) the
+                         FadingBank('sequence', ...) of each 'bank' lag
+            .tol         (optional) error allowed, relative to each lag's
+                         gain, to evaluate slow taps at a decimated rate
+                         and interpolate them; 0 or absent evaluates
+                         every sample
+  lags    (nR x nT cell, or one vector shared by all pairs)
+  sources (nS+longestLag x nT matrix, one column per transmitter, or an
+           nR x nT cell with a source vector for each pair, or a single
+           source vector for a single Jakes channel)
+  acc     (nR x nS, optional) added to the output
+  scale   (optional) multiplies the sum over transmitters
+  ws      (optional) workspace handle from TVConv('workspace')
+  out     (nR x nS) acc + scale * the sum over transmitters of each
+          pair's TVConv output
+*/
+static void tvconvMimoGateway(int nlhs, mxArray *plhs[],
+			      int nrhs, const mxArray *prhs[])
+{
+  const mxArray *pHs_mxArr = prhs[0];
+  const mxArray *pLags_mxArr = prhs[1];
+  const mxArray *pSource_mxArr = prhs[2];
+  const mxArray *pEl_mxArr;
+  const mxArray *pStates_mxArr;
+  const mxArray *pGains_mxArr;
+  const mxArray *pOffsets_mxArr;
+  const mxArray *pAcc_mxArr;
+
+  int nR, nT, nS, nPairs, pair, tx, lag;
+  int longestLag, nThreads, status;
+  int hLayout = tvconvLayoutArg(nrhs, prhs);
+  int out_isComplex = 0;
+  int hIsCell = mxIsCell(pHs_mxArr);
+  int isJakes;                                /* Channels are Jakes structs */
+  int sourceIsCell = mxIsCell(pSource_mxArr);
+  int sourcePerPair;                          /* A source array per pair */
+  int lagsIsCell = mxIsCell(pLags_mxArr);
+  size_t srcRows;
+  size_t srcOff;                              /* Start of a column of the source matrix */
+  size_t nSEl;
+  size_t nTaps;                               /* Jakes taps of all pairs */
+  double tStart = 0.;
+  double tol;
+
+  int *pNLags;
+  double **pH_re, **pH_im, **pLags_re, **pSource_re, **pSource_im;
+  tvconvJakesTap *pTap;
+  tvconvWorkspace *ws = tvconvWorkspaceArg(nrhs, prhs);
+  tvconvWorkspace local;
+
+  (void)nlhs;
+
+#define TVCONV_PAIR_H(PAIR) (hIsCell ? mxGetCell(pHs_mxArr, (mwIndex)(PAIR)) : pHs_mxArr)
+
+  nR = (int)mxGetM(pHs_mxArr);
+  nT = (int)mxGetN(pHs_mxArr);
+  nPairs = nR*nT;
+  if (nPairs < 1)
+    {
+      mexErrMsgTxt("TVConv: the cell array of channel matrices is empty");
+    }
+  pEl_mxArr = TVCONV_PAIR_H(0);
+  isJakes = (pEl_mxArr != NULL) && mxIsStruct(pEl_mxArr);
+  sourcePerPair = sourceIsCell || !hIsCell;
+  if (lagsIsCell && (mxGetNumberOfElements(pLags_mxArr) != (size_t)nPairs))
+    {
+      mexErrMsgTxt("TVConv: the lags cell array must be the same size as the channel cell array");
+    }
+  if (sourceIsCell && (mxGetNumberOfElements(pSource_mxArr) != (size_t)nPairs))
+    {
+      mexErrMsgTxt("TVConv: the sources cell array must be the same size as the channel cell array");
+    }
+  if (!sourcePerPair && (mxGetN(pSource_mxArr) != (size_t)nT))
+    {
+      mexErrMsgTxt("TVConv: the source matrix must have one column per transmitter");
+    }
+
+  longestLag = (int)mxGetScalar(prhs[3]);
+  nThreads = ((nrhs > 4) && !mxIsEmpty(prhs[4])) ? (int)mxGetScalar(prhs[4]) : 1;
+
+  /* Jakes taps of all pairs, one after the other */
+  nTaps = 0;
+  for (pair = 0; isJakes && (pair < nPairs); pair++)
+    {
+      pEl_mxArr = TVCONV_PAIR_H(pair);
+      if ((NULL == pEl_mxArr) || !mxIsStruct(pEl_mxArr) ||
+	  (NULL == (pStates_mxArr = mxGetField(pEl_mxArr, 0, "chanstates"))) ||
+	  !mxIsStruct(pStates_mxArr))
+	{
+	  mexErrMsgTxt("TVConv: every Jakes channel must be a struct with chanstates");
+	}
+      nTaps += mxGetNumberOfElements(pStates_mxArr);
+    }
+
+  /* The per-pair arrays come from the workspace, or one just for this call */
+  memset(&local, 0, sizeof(local));
+  ws = (ws != NULL) ? ws : &local;
+  if (0 != tvconvWorkspaceReserve(ws, 0, 0, 0, nPairs, nTaps))
+    {
+      mexErrMsgTxt("TVConv: could not allocate the per-pair arguments");
+    }
+  pNLags = ws->pNLags;
+  pH_re = ws->pPairPtrs;
+  pH_im = pH_re + nPairs;
+  pLags_re = pH_im + nPairs;
+  pSource_re = pLags_re + nPairs;
+  pSource_im = pSource_re + nPairs;
+  pTap = ws->pTaps;
+
+  nS = -1;
+  srcRows = mxGetM(pSource_mxArr);
+  for (pair = 0; pair < nPairs; pair++)
+    {
+      tx = pair / nR;
+
+      /* Source */
+      if (sourcePerPair)
+	{
+	  pEl_mxArr = sourceIsCell ? mxGetCell(pSource_mxArr, (mwIndex)pair) : pSource_mxArr;
+	  if ((NULL == pEl_mxArr) || !mxIsDouble(pEl_mxArr))
 	    {
-	      ptr_re = ((*pElLagSrc_re)++);
-	      if (ptr_re < pSourceEnd_re) {
-		elLagSrc_re = *ptr_re;
-		elLagSrc_im = *((*pElLagSrc_im)++);
-		elH_re = *pElH_re;       
-
-		sum_re += (elH_re*elLagSrc_re);
-		sum_im += (elH_re*elLagSrc_im);
-	      }
+	      mexErrMsgTxt("TVConv: every source must be a double vector");
 	    }
-	  *pOutEl_re = sum_re;
-	  *pOutEl_im = sum_im;
+	  pSource_re[pair] = TVCONV_MX_RE(pEl_mxArr);
+	  pSource_im[pair] = mxIsComplex(pEl_mxArr) ? TVCONV_MX_IM(pEl_mxArr) : NULL;
 	}
-    } 
-  else if ( !H_isComplex && !source_isComplex ) 
-    {
-      /* 
-	 Case 4: 
-	 channel matrix is real
-	 source is real
-      */
-      for (pOutEl_re = pOut_re, rowOffset = (nLagsm1*nS); 
-	   pOutEl_re < pOutEnd_re; 
-	   pOutEl_re++, rowOffset++ )
-	{
-	  sum_re=0.; 
-	  for (pElLagSrc_re = pLagSrc_re, pElH_re = pH_re + rowOffset;
-	       pElLagSrc_re < pLagSrcEnd_re; 
-	       pElLagSrc_re++, pElH_re-=nS) 
+      else
+	{
+	  srcOff = tx*srcRows*TVCONV_MX_EL(pSource_mxArr);
+	  pSource_re[pair] = TVCONV_MX_RE(pSource_mxArr) + srcOff;
+	  pSource_im[pair] = mxIsComplex(pSource_mxArr) ? TVCONV_MX_IM(pSource_mxArr) + srcOff : NULL;
+	}
+      out_isComplex |= (pSource_im[pair] != NULL);
+
+      /* Channel: a matrix, or Jakes taps */
+      pEl_mxArr = TVCONV_PAIR_H(pair);
+      if (isJakes)
+	{
+	  pStates_mxArr = mxGetField(pEl_mxArr, 0, "chanstates");
+	  pGains_mxArr = mxGetField(pEl_mxArr, 0, "gains");
+	  pOffsets_mxArr = mxGetField(pEl_mxArr, 0, "offsets");
+	  pNLags[pair] = (int)mxGetNumberOfElements(pStates_mxArr);
+	  if ((NULL == pGains_mxArr) ||
+	      (mxGetNumberOfElements(pGains_mxArr) != (size_t)pNLags[pair]))
+	    {
+	      mexErrMsgTxt("TVConv: a Jakes channel needs one gain per chanstate");
+	    }
+	  if ((pOffsets_mxArr != NULL) && mxIsEmpty(pOffsets_mxArr))
+	    {
+	      pOffsets_mxArr = NULL;
+	    }
+	  if ((pOffsets_mxArr != NULL) &&
+	      (mxGetNumberOfElements(pOffsets_mxArr) != (size_t)pNLags[pair]))
+	    {
+	      mexErrMsgTxt("TVConv: a Jakes channel needs one offset per chanstate");
+	    }
+	  tol = (mxGetField(pEl_mxArr, 0, "tol") != NULL) ?
+	    mxGetScalar(mxGetField(pEl_mxArr, 0, "tol")) : 0.;
+	  for (lag = 0; lag < pNLags[pair]; lag++, pTap++)
+	    {
+	      tvconvJakesTapArg(pTap, pStates_mxArr, lag, TVCONV_MX_RE(pGains_mxArr)[lag],
+				pOffsets_mxArr, mxGetField(pEl_mxArr, 0, "seqs"));
+	      tvconvJakesTapPlan(pTap, tol);
+	    }
+	  if (NULL == mxGetField(pEl_mxArr, 0, "nSamples"))
 	    {
-	      ptr_re = ((*pElLagSrc_re)++);
-	      if (ptr_re < pSourceEnd_re) {
-		elLagSrc_re = *ptr_re;
-		elH_re = *pElH_re;
-		sum_re += (elH_re*elLagSrc_re);
-	      }
+	      mexErrMsgTxt("TVConv: a Jakes channel needs nSamples");
 	    }
-	  *pOutEl_re = sum_re;
+	  nSEl = (size_t)mxGetScalar(mxGetField(pEl_mxArr, 0, "nSamples"));
+	  if (0 == pair)
+	    {
+	      pEl_mxArr = mxGetField(pEl_mxArr, 0, "start");
+	      tStart = (pEl_mxArr != NULL) ? mxGetScalar(pEl_mxArr) : 0.;
+	    }
+	  pH_re[pair] = NULL;
+	  pH_im[pair] = NULL;
+	  out_isComplex = 1;
+	}
+      else
+	{
+	  if ((NULL == pEl_mxArr) || !mxIsDouble(pEl_mxArr))
+	    {
+	      mexErrMsgTxt("TVConv: every channel matrix must be a double matrix");
+	    }
+	  nSEl = (hLayout == TVCONV_H_LAG_MAJOR) ? mxGetN(pEl_mxArr) : mxGetM(pEl_mxArr);
+	  pNLags[pair] = (int)((hLayout == TVCONV_H_LAG_MAJOR) ? mxGetM(pEl_mxArr) : mxGetN(pEl_mxArr));
+	  pH_re[pair] = TVCONV_MX_RE(pEl_mxArr);
+	  pH_im[pair] = mxIsComplex(pEl_mxArr) ? TVCONV_MX_IM(pEl_mxArr) : NULL;
+	  out_isComplex |= (pH_im[pair] != NULL);
+	}
+      if (nS < 0)
+	{
+	  nS = (int)nSEl;
 	}
+      else if (nSEl != (size_t)nS)
+	{
+	  mexErrMsgTxt("TVConv: every channel matrix must have the same number of samples");
+	}
+
+      /* Lags */
+      pEl_mxArr = lagsIsCell ? mxGetCell(pLags_mxArr, (mwIndex)pair) : pLags_mxArr;
+      if ((NULL == pEl_mxArr) || (mxGetNumberOfElements(pEl_mxArr) != (size_t)pNLags[pair]))
+	{
+	  mexErrMsgTxt("TVConv: each lags vector must have one entry per channel matrix column");
+	}
+      pLags_re[pair] = TVCONV_MX_RE(pEl_mxArr);
     }
 
-  FREE(pLagSrc_re);
-  FREE(pLagSrc_im);
-  return(0);
-  
+#undef TVCONV_PAIR_H
+
+  pAcc_mxArr = tvconvAccArg(nrhs, prhs, nR, nS);
+  plhs[0] = tvconvCreateOutput(nR, nS, out_isComplex, pAcc_mxArr);
+  if (isJakes)
+    {
+      status = tvconvJakesMimo(TVCONV_MX_RE(plhs[0]), TVCONV_MX_IM(plhs[0]),
+			       nR, nT, nS, pNLags, ws->pTaps, tStart, TVCONV_MX_CPLX, pLags_re,
+			       pSource_re, pSource_im, longestLag,
+			       tvconvScaleArg(nrhs, prhs), (pAcc_mxArr != NULL), ws, nThreads);
+    }
+  else
+    {
+      status = tvconvMimo(TVCONV_MX_RE(plhs[0]), mxIsComplex(plhs[0]) ? TVCONV_MX_IM(plhs[0]) : NULL,
+			  nR, nT, nS, pNLags, pH_re, pH_im, hLayout, TVCONV_MX_CPLX, pLags_re,
+			  pSource_re, pSource_im, longestLag,
+			  tvconvScaleArg(nrhs, prhs), (pAcc_mxArr != NULL), ws, nThreads);
+    }
+
+  tvconvWorkspaceClear(&local);
+
+  if (status != 0)
+    {
+      mexErrMsgTxt(isJakes ?
+		   "TVConv: too many Jakes lags, or could not allocate the lagged source pointers" :
+		   "TVConv: could not allocate the lagged source pointers");
+    }
 }
 
-#ifdef MATLAB_MEX_FILE
 void mexFunction(int nlhs, mxArray *plhs[], 
 		 int nrhs, const mxArray *prhs[])
 {
@@ -286,9 +2276,8 @@ void mexFunction(int nlhs, mxArray *plhs[],
   double *pH_re;                              /* Pointer to the real part of the channel matrix H */
   double *pH_im;                              /* Pointer to the imaginary part of the channel matrix H */
   int H_isComplex;                            /* Flag set if channel matrix H is complex */
-  int nS;                                     /* Number of rows of the channel matrix */
-  int nLags;                                  /* Number of columns of the channel matrix */
-  int nLagsm1;                                /* Number of columns of the channel matrix minus 1 */
+  int nS;                                     /* Number of samples (rows of a sample-major H) */
+  int nLags;                                  /* Number of lags (columns of a sample-major H) */
 
 
   double *pLags_re;                           /* Pointer to the real part of the lags array */
@@ -298,32 +2287,60 @@ void mexFunction(int nlhs, mxArray *plhs[],
   int source_isComplex;                       /* Flag set if channel matrix H is complex */
 
   int longestLag;                             /* Scalar value of longestLag */
+  int nThreads;                               /* Worker threads, 0 for one per core (optional) */
+  int hLayout;                                /* Memory layout of H (optional) */
+  const mxArray *pAcc_mxArr;                  /* Output to accumulate into (optional) */
+  double scale;                               /* Scale applied to the convolution (optional) */
 
   double *pOut_re;                            /* Pointer to the real part of the output */
   double *pOut_im;                            /* Pointer to the imaginary part of the output */
+  int status;                                 /* tvconv() error code */
+
+
+  /* Workspace commands */
+  if ((nrhs > 0) && mxIsChar(pH_mxArr))
+    {
+      tvconvCommand(nlhs, plhs, nrhs, prhs);
+      return;
+    }
 
+  /* A cell array of channel matrices selects the MIMO form, which also
+     generates Jakes channels */
+  if (mxIsCell(pH_mxArr) || mxIsStruct(pH_mxArr))
+    {
+      tvconvMimoGateway(nlhs, plhs, nrhs, prhs);
+      return;
+    }
 
   /* Get Channel Matrix info */
-  nS = mxGetM(pH_mxArr);
-  nLags = mxGetN(pH_mxArr);
-  nLagsm1 = nLags - 1;                               /* nLags minus 1 */
+  hLayout = tvconvLayoutArg(nrhs, prhs);
+  if (hLayout == TVCONV_H_LAG_MAJOR)
+    {
+      nS = mxGetN(pH_mxArr);
+      nLags = mxGetM(pH_mxArr);
+    }
+  else
+    {
+      nS = mxGetM(pH_mxArr);
+      nLags = mxGetN(pH_mxArr);
+    }
   H_isComplex = mxIsComplex(pH_mxArr);               /* Flag checking if 'H' is complex */
-  pH_re = mxGetPr(pH_mxArr);                         /* Pointer to the real part of 'H' */
+  pH_re = TVCONV_MX_RE(pH_mxArr);                    /* Pointer to the real part of 'H' */
   if ( H_isComplex ){
-    pH_im = mxGetPi(pH_mxArr);                       /* Pointer to the imaginary part of 'H' */
+    pH_im = TVCONV_MX_IM(pH_mxArr);                  /* Pointer to the imaginary part of 'H' */
   } else {
     pH_im = NULL;
   }
 
   /* Get Lags info */
-  pLags_re = mxGetPr(pLags_mxArr);                   /* Pointer to the real part of 'lags' */
+  pLags_re = TVCONV_MX_RE(pLags_mxArr);              /* Pointer to the real part of 'lags' */
 
   /* Get Source info */
-  pSource_re = mxGetPr(pSource_mxArr);               /* Pointer to real part of source */
+  pSource_re = TVCONV_MX_RE(pSource_mxArr);          /* Pointer to real part of source */
   source_isComplex = mxIsComplex(pSource_mxArr);     /* Flag check if 'source' is complex */
   if ( source_isComplex )
     {
-      pSource_im = mxGetPi(pSource_mxArr);             /* Pointer to imaginary part of source */
+      pSource_im = TVCONV_MX_IM(pSource_mxArr);        /* Pointer to imaginary part of source */
     } 
   else 
     {
@@ -333,35 +2350,50 @@ void mexFunction(int nlhs, mxArray *plhs[],
   /* Get longestLag */
   longestLag = (int)mxGetScalar(pLongestLag_mxArr);  /* Value for longestLag */
 
+  /* Get nThreads, single-threaded unless asked for */
+  if ((nrhs > 4) && !mxIsEmpty(prhs[4]))
+    {
+      nThreads = (int)mxGetScalar(prhs[4]);
+    }
+  else
+    {
+      nThreads = 1;
+    }
+
+  /* Get the optional accumulator and scale */
+  pAcc_mxArr = tvconvAccArg(nrhs, prhs, 1, nS);
+  scale = tvconvScaleArg(nrhs, prhs);
+
   /* Allocate space for the output and get info */
-  if ( H_isComplex || source_isComplex )
+  plhs[0] = tvconvCreateOutput(1, nS, H_isComplex || source_isComplex, pAcc_mxArr);
+  pOut_re = TVCONV_MX_RE(plhs[0]);
+  if ( mxIsComplex(plhs[0]) )
     {
-      plhs[0] = mxCreateNumericMatrix(1, nS, mxDOUBLE_CLASS, mxCOMPLEX);
-      pOut_re = mxGetPr(plhs[0]);
-      pOut_im = mxGetPi(plhs[0]);
+      pOut_im = TVCONV_MX_IM(plhs[0]);
     } 
   else 
     {
-      plhs[0] = mxCreateNumericMatrix(1, nS, mxDOUBLE_CLASS, mxREAL);
-      pOut_re = mxGetPr(plhs[0]);
       pOut_im = NULL;
     }
   
 
-  tvconv(pOut_re, pOut_im, 
-	 nS, nLags, pH_re, pH_im, 
-	 pLags_re, 
-	 pSource_re, pSource_im,
-	 longestLag);
+  status = tvconv(pOut_re, pOut_im, 
+		  nS, nLags, pH_re, pH_im, 
+		  hLayout, TVCONV_MX_CPLX,
+		  pLags_re, 
+		  pSource_re, pSource_im,
+		  longestLag, scale, (pAcc_mxArr != NULL),
+		  tvconvWorkspaceArg(nrhs, prhs), nThreads);
+  if (status != 0)
+    {
+      mexErrMsgTxt((2 == status) ?
+		   "TVConv: could not allocate the lagged source offsets or the tile scratch" :
+		   "TVConv: invalid arguments");
+    }
   
   return;
 } /*--- end of mexFunction ---*/
-#else
-int main(void)
-{
-  return(0);
-}
-#endif
+#endif /* MATLAB_MEX_FILE */
 
 /*
   This material is based upon work supported by the Defense Advanced Research
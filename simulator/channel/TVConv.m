@@ -1,4 +1,4 @@
-function output = TVConv(H, lags, src, longestLag)
+function output = TVConv(H, lags, src, longestLag, nThreads, layout, acc, scale, ws) %#ok nThreads, ws only used by the MEX
 % Approved for public release: distribution unlimited.
 % 
 % This material is based upon work supported by the Defense Advanced Research 
@@ -29,32 +29,100 @@ if isempty(calledBefore)
   calledBefore = true;                                                
 end                                                                   
 
+% Workspace commands: there is no scratch memory to keep here, so
+% TVConv('workspace') returns an empty handle and TVConv('release', ws)
+% does nothing
+if ischar(H)
+    output = [];
+    return
+end
+
+if nargin < 6
+    layout = '';
+end
+
+% A struct H (or a cell array of them) describes a Jakes channel, which
+% the MEX generates block by block; here it is expanded to the matrix
+% jakes4 gives
+if isstruct(H)
+    H = JakesMatrix(H);
+    layout = 'lagMajor';
+elseif iscell(H) && isstruct(H{1})
+    H = cellfun(@JakesMatrix, H, 'UniformOutput', false);
+    layout = 'lagMajor';
+end
+
+% layout 'lagMajor' gives H as nLags x nS (as jakes4 returns it) instead
+% of nS x nLags
+lagMajor = strcmp(layout, 'lagMajor');
+
+% The output is acc + scale*(convolution), acc being optional
+if nargin > 6
+    if nargin < 8 || isempty(scale)
+        scale = 1;
+    end
+    output = scale*TVConv(H, lags, src, longestLag, [], layout);
+    if ~isempty(acc)
+        output = acc + output;
+    end
+    return
+end
+
+if iscell(H)
+    % MIMO form: H and lags are nR x nT cell arrays (lags may also be one
+    % vector shared by all pairs), src holds one column per transmitter or
+    % is an nR x nT cell array of per-pair sources.  Each output row is
+    % the sum over transmitters of the per-pair outputs.
+    [nR, nT] = size(H);
+    if lagMajor
+        H = cellfun(@transpose, H, 'UniformOutput', false);
+    end
+    output = zeros(nR, size(H{1, 1}, 1));
+    for txLoop = 1:nT
+        for rxLoop = 1:nR
+            if iscell(lags)
+                pairLags = lags{rxLoop, txLoop};
+            else
+                pairLags = lags;
+            end
+            if iscell(src)
+                pairSrc = src{rxLoop, txLoop};
+            else
+                pairSrc = src(:, txLoop);
+            end
+            output(rxLoop, :) = output(rxLoop, :) ...
+                + TVConv(H{rxLoop, txLoop}, pairLags, pairSrc, longestLag);
+        end
+    end
+    return
+end
+
+if lagMajor
+    H = H.';
+end
+
+% output(n) = sum over lags of H(n, lag)*src(n + longestLag - lag), the
+% samples of src from index frmLen on counting as zero, as in the MEX
 frmLen = size(H, 1); % obtain the number of samples
-%%numLags = size(H, 2); % obtain the number of lags
-multAddIndices = longestLag - lags + 1; % compute indices in signal buffer corresponding to non-zero channel filter tap values
-Hf = flipud(H); % convolutional flip of filter taps
-
-innerProduct = zeros(1, frmLen);
-
-for n = 1:min(frmLen, longestLag) % loop through the sample index
-    firstIndx = 1;
-    sigBuffer = src(firstIndx:n).';
-    
-    sigFilt = Hf(n, :); % obtain the current channel taps
-    culledIndices = multAddIndices <= length(sigBuffer); % obtain the indices over which the multiply-add is to be performed
-    innerProduct(n) = sum(sigFilt(culledIndices).*sigBuffer(multAddIndices(culledIndices))); % perform the multiply-add   
-end
-for n = longestLag+1:frmLen % loop through the sample index
-    firstIndx = n - longestLag;    
-    sigBuffer = src(firstIndx:n).';
-    
-    sigFilt = Hf(n, :); % obtain the current channel taps
-    culledIndices = multAddIndices <= length(sigBuffer); % obtain the indices over which the multiply-add is to be performed
-    innerProduct(n) = sum(sigFilt(culledIndices).*sigBuffer(multAddIndices(culledIndices))); % perform the multiply-add   
-end
-
-
-% obtain the "valid" convolution output by taking off the first longestLag samples 
-output = zeros(size(innerProduct));
-temp = innerProduct(longestLag+1:end);
-output(1:length(temp)) = temp;
+src = src(:).';
+nSrc = min(frmLen, length(src));
+output = zeros(1, frmLen);
+for lagLoop = 1:length(lags)
+    srcInds = (1:frmLen) + longestLag - lags(lagLoop);
+    valid = srcInds >= 1 & srcInds <= nSrc;
+    output(valid) = output(valid) + H(valid, lagLoop).'.*src(srcInds(valid));
+end
+
+
+function H = JakesMatrix(chan)
+% nLags x nSamples channel matrix of a Jakes channel struct:
+%   gains(lag)*jakes4(start, nSamples, chanstates)(lag, :) + offsets(lag)
+tol = 0;
+if isfield(chan, 'tol')
+    tol = chan.tol;
+end
+H = jakes4(chan.start, chan.nSamples, chan.chanstates, 0, tol);
+H = H.*(chan.gains(:)*ones(1, chan.nSamples));
+if isfield(chan, 'offsets') && ~isempty(chan.offsets)
+    H = H + chan.offsets(:)*ones(1, chan.nSamples);
+end
@@ -0,0 +1,253 @@
+/*
+  This material is based upon work supported by the Defense Advanced Research
+  Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+  findings, conclusions or recommendations expressed in this material are those
+  of the author(s) and do not necessarily reflect the views of the Defense
+  Advanced Research Projects Agency.
+
+  © 2019 Massachusetts Institute of Technology.
+
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License version 2 as
+  published by the Free Software Foundation;
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+  POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  Cosine table shared by the channel MEX functions, generated at run
+  time rather than compiled in.
+
+  The table samples cos(2 pi i/N) for a power of two N from
+  COSLUT_MIN_SIZE to COSLUT_MAX_SIZE.  A phase is a 64-bit fraction of a
+  turn whose top log2(N) bits index the table.  The lookup either rounds
+  to the nearest entry, with error up to pi/N, or interpolates linearly
+  with the remaining bits, with error up to (2 pi/N)^2/8.  A 1024-entry
+  linear table (16 kB, so it stays in L1) is thus accurate to 4.7e-6,
+  ten times better than a rounded 65536-entry one.
+
+  For linear interpolation entry i holds the pair cos(2 pi i/N) and
+  cos(2 pi (i+1)/N) - cos(2 pi i/N), so that a lookup reads one cache
+  line.
+
+  Each (size, interpolation) table is built once, on first use, and
+  never changed or freed afterwards.  cosLutInit() hands the caller a
+  cosLut that points to it, so calls asking for different tables can
+  run concurrently.  A table is published with one compare-and-swap:
+  threads racing to build the same one all end up using the first
+  table published.
+
+  uint64_t and int64_t must be defined before this file is included.
+  Everything is static so that each MEX file can still be built on its
+  own with "mex <file>.c".
+*/
+
+#ifndef COSLUT_H
+#define COSLUT_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#if defined(_WIN32) || defined(_WIN32_) || defined (__WIN32__)
+#include <windows.h>
+#define COSLUT_PUBLISH(PP, NEW) \
+  (NULL == InterlockedCompareExchangePointer((PVOID volatile *)(PP), (PVOID)(NEW), NULL))
+#else
+#define COSLUT_PUBLISH(PP, NEW) __sync_bool_compare_and_swap((PP), (double *)NULL, (NEW))
+#endif
+
+#define COSLUT_NEAREST 0
+#define COSLUT_LINEAR  1
+
+#define COSLUT_MIN_BITS 4
+#define COSLUT_MAX_BITS 16
+#define COSLUT_MIN_SIZE (1 << COSLUT_MIN_BITS)
+#define COSLUT_MAX_SIZE (1 << COSLUT_MAX_BITS)
+
+#define COSLUT_DEFAULT_SIZE 1024
+
+/* Not every file that includes this one reads phases given in turns */
+#if defined(__GNUC__) || defined(__clang__)
+#define COSLUT_MAYBE_UNUSED __attribute__((unused))
+#else
+#define COSLUT_MAYBE_UNUSED
+#endif
+
+/*
+  Fraction of a step in the bits of a phase below the table index: its
+  top 52 bits become 1 + frac when given the exponent of 1.
+*/
+static double cosLutFrac(uint64_t phase, int bits)
+{
+  uint64_t w = ((phase << bits) >> 12) | ((uint64_t)1023 << 52);
+  double d;
+
+  memcpy(&d, &w, sizeof(d));
+  return(d - 1.);
+}
+
+/* One table, as handed out by cosLutInit() */
+typedef struct {
+  const double *tab;
+  int bits;                                   /* log2 of the table size */
+  int interp;
+} cosLut;
+
+/* Every table built so far, by interpolation and log2 of the size */
+static double *volatile cosLutTabs[2][COSLUT_MAX_BITS + 1];
+
+/*
+  Point lut to the table of this size and interpolation, building it
+  if no call has yet.  A size that is not a power of two is rounded up
+  to one, and clamped to [COSLUT_MIN_SIZE, COSLUT_MAX_SIZE].  Returns
+  the size used, or 0 if out of memory.
+*/
+static int cosLutInit(int size, int interp, cosLut *lut)
+{
+  double *tab;
+  int bits, ii, n;
+
+  for (bits = COSLUT_MIN_BITS; (bits < COSLUT_MAX_BITS) && ((1 << bits) < size); bits++)
+    ;
+  n = 1 << bits;
+  interp = (interp == COSLUT_LINEAR) ? COSLUT_LINEAR : COSLUT_NEAREST;
+
+  if (NULL == cosLutTabs[interp][bits])
+    {
+      tab = (double *)malloc(((interp == COSLUT_LINEAR) ? 2 : 1)*(size_t)n*sizeof(double));
+      if (NULL == tab)
+	{
+	  return(0);
+	}
+      for (ii = 0; ii < n; ii++)
+	{
+	  if (interp == COSLUT_LINEAR)
+	    {
+	      tab[2*ii] = cos(6.283185307179586*ii/n);
+	      tab[2*ii + 1] = cos(6.283185307179586*(ii + 1)/n) - tab[2*ii];
+	    }
+	  else
+	    {
+	      tab[ii] = cos(6.283185307179586*ii/n);
+	    }
+	}
+      if (!COSLUT_PUBLISH(&cosLutTabs[interp][bits], tab))
+	{
+	  free(tab);                          /* Another thread published it first */
+	}
+    }
+
+  lut->tab = cosLutTabs[interp][bits];
+  lut->bits = bits;
+  lut->interp = interp;
+  return(n);
+}
+
+/*
+  cos(2 pi turns), |turns| < 2^63, from the table lut, for phases that
+  are not run as NCOs
+*/
+static COSLUT_MAYBE_UNUSED double cosLutTurns(double turns, const cosLut *lut)
+{
+  const double *tab = lut->tab;
+  int n = 1 << lut->bits;
+  double u = turns - (double)(int64_t)turns;  /* In (-1, 1), without calling floor() */
+  int ii;
+  double frac;
+
+  u = ((u < 0.) ? u + 1. : u)*n;              /* In [0, n] */
+  ii = (int)u;
+  frac = u - ii;
+
+  if (lut->interp == COSLUT_LINEAR)
+    {
+      ii &= n - 1;
+      return(tab[2*ii] + frac*tab[2*ii + 1]);
+    }
+  return(tab[(ii + (frac >= 0.5)) & (n - 1)]);
+}
+
+/*
+  Add sum_m cos(2 pi (pAcc[m] + k pInc[m]) 2^-64) to pSum[k], k < len,
+  for the nSin sinusoids of phases pAcc and increments pInc, then advance
+  each pAcc[m] by len increments.  As the cosPoly.h sum kernels, with the
+  cosines read from the table lut.
+*/
+static void cosLutSum(double *pSum, int len, uint64_t *pAcc,
+		      const uint64_t *pInc, int nSin, const cosLut *lut)
+{
+  const double *tab = lut->tab;
+  const double *p;
+  int bits = lut->bits;
+  int shift = 64 - bits;
+  uint64_t half = (uint64_t)1 << (shift - 1);
+  uint64_t acc, inc;
+  int k, m;
+
+  /* One sinusoid at a time, so that the phase stays in a register */
+  for (m = 0; m < nSin; m++)
+    {
+      inc = pInc[m];
+      if (lut->interp == COSLUT_LINEAR)
+	{
+	  for (k = 0, acc = pAcc[m]; k < len; k++, acc += inc)
+	    {
+	      p = tab + 2*(acc >> shift);
+	      pSum[k] += p[0] + cosLutFrac(acc, bits)*p[1];
+	    }
+	}
+      else
+	{
+	  /* Round to the nearest entry by running the phase half a step ahead */
+	  for (k = 0, acc = pAcc[m] + half; k < len; k++, acc += inc)
+	    {
+	      pSum[k] += tab[acc >> shift];
+	    }
+	  acc -= half;
+	}
+      pAcc[m] = acc;
+    }
+}
+
+#undef COSLUT_PUBLISH
+
+#endif /* COSLUT_H */
+
+/*
+  This material is based upon work supported by the Defense Advanced Research
+  Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+  findings, conclusions or recommendations expressed in this material are those
+  of the author(s) and do not necessarily reflect the views of the Defense
+  Advanced Research Projects Agency.
+
+  © 2019 Massachusetts Institute of Technology.
+
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License version 2 as
+  published by the Free Software Foundation;
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+  POSSIBILITY OF SUCH DAMAGE.
+*/
@@ -0,0 +1,328 @@
+/*
+  This material is based upon work supported by the Defense Advanced Research
+  Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+  findings, conclusions or recommendations expressed in this material are those
+  of the author(s) and do not necessarily reflect the views of the Defense
+  Advanced Research Projects Agency.
+
+  © 2019 Massachusetts Institute of Technology.
+
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License version 2 as
+  published by the Free Software Foundation;
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+  POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  Sums of cosines of NCO phases, evaluated with a minimax polynomial
+  rather than looked up, shared by the channel MEX functions.
+
+  A phase is a 64-bit fraction of a turn.  Its top 52 bits become the
+  double x in [0, 1), and with a = min(x, 1 - x) and z = 1/4 - a,
+
+    cos(2 pi x) = sin(2 pi z) ~= z P(z^2),  |z| <= 1/4,
+
+  P being the minimax polynomial of the chosen accuracy level.  The
+  vector kernels evaluate 4 (AVX2) or 8 (AVX-512) samples of a sinusoid
+  per instruction, with no table to miss in the cache.  The kernel is
+  chosen at run time from the CPU features, and can be overridden by
+  setting the environment variable LLAMACOMM_COSPOLY_ISA to "scalar",
+  "avx2" or "avx512".
+
+  uint64_t must be defined before this file is included.  Everything is
+  static so that each MEX file can still be built on its own with
+  "mex <file>.c".
+*/
+
+#ifndef COSPOLY_H
+#define COSPOLY_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define COSPOLY_X86_SIMD
+#include <immintrin.h>
+#endif
+
+#define COSPOLY_ISA_AUTO   -1
+#define COSPOLY_ISA_SCALAR  0
+#define COSPOLY_ISA_AVX2    1
+#define COSPOLY_ISA_AVX512  2
+
+/* Accuracy levels, from the fastest to the most accurate */
+#define COSPOLY_LEVELS    5
+#define COSPOLY_MAX_TERMS 8
+
+/* Terms of P at each level */
+static const int cosPolyTerms[COSPOLY_LEVELS] = {4, 5, 6, 7, 8};
+
+/*
+  Largest error at each level, as measured by cosPolyBench.c; at the last
+  one it comes from the phase being cut to 52 bits
+*/
+static const double cosPolyErr[COSPOLY_LEVELS] = {5.9e-7, 3.4e-9, 1.4e-11, 4.1e-14, 1.1e-15};
+
+/* Coefficients of P at each level, from the constant term up (Remez fits) */
+static const double cosPolyCoef[COSPOLY_LEVELS][COSPOLY_MAX_TERMS] = {
+  {6.28316404430887054e+00, -4.13371423722487208e+01, 8.13407689280092256e+01,
+   -7.09934336418234437e+01},
+  {6.28318516008950567e+00, -4.13416550314261144e+01, 8.16010040739586486e+01,
+   -7.65497823093505190e+01, 3.95367061769940946e+01},
+  {6.28318530648750695e+00, -4.13417019297733432e+01, 8.16052094311433223e+01,
+   -7.67036678301715256e+01, 4.19999898700821674e+01, -1.43370249509219239e+01},
+  {6.28318530717722812e+00, -4.13417022389895479e+01, 8.16052490320569177e+01,
+   -7.67058411298128675e+01, 4.20579638765957000e+01, -1.50792949361631017e+01,
+   3.65508403089442968e+00},
+  {6.28318530717958001e+00, -4.13417022403950796e+01, 8.16052492750262957e+01,
+   -7.67058596474696515e+01, 4.20586883053948100e+01, -1.50944716167313544e+01,
+   3.81699742935553754e+00, -6.90935886658961884e-01}
+};
+
+/* Fastest level within tol of cos, the most accurate one if none is */
+static int cosPolyLevel(double tol)
+{
+  int level;
+
+  for (level = 0; level < COSPOLY_LEVELS - 1; level++)
+    {
+      if (cosPolyErr[level] <= tol)
+	{
+	  break;
+	}
+    }
+  return(level);
+}
+
+/* cos(2 pi phase 2^-64) */
+static double cosPolyEval(uint64_t phase, int level)
+{
+  const double *c = cosPolyCoef[level];
+  double x = (double)(phase >> 12)*(1./4503599627370496.);
+  double z, z2, p;
+  int ii;
+
+  z = 0.25 - ((x < 1. - x) ? x : 1. - x);
+  z2 = z*z;
+  for (ii = cosPolyTerms[level] - 1, p = c[ii]; ii > 0; ii--)
+    {
+      p = p*z2 + c[ii - 1];
+    }
+  return(z*p);
+}
+
+/*
+  A sum kernel adds sum_m cos(2 pi (pAcc[m] + k pInc[m]) 2^-64) to
+  pSum[k], k < len, for the nSin sinusoids of phases pAcc and increments
+  pInc, then advances each pAcc[m] by len increments.  nSin is at most
+  COSPOLY_MAX_SIN.
+*/
+#define COSPOLY_MAX_SIN 8
+
+typedef void (*cosPolySumFn)(double *pSum, int len, uint64_t *pAcc,
+			     const uint64_t *pInc, int nSin, int level);
+
+static void cosPolySumScalar(double *pSum, int len, uint64_t *pAcc,
+			     const uint64_t *pInc, int nSin, int level)
+{
+  double sum;
+  int k, m;
+
+  for (k = 0; k < len; k++)
+    {
+      for (m = 0, sum = 0.; m < nSin; m++)
+	{
+	  sum += cosPolyEval(pAcc[m], level);
+	  pAcc[m] += pInc[m];
+	}
+      pSum[k] += sum;
+    }
+}
+
+#ifdef COSPOLY_X86_SIMD
+
+/*
+  Vector kernel body: W lanes hold W consecutive samples of a sinusoid.
+  The phase becomes 1 + x by setting the exponent of 2^0 above its top
+  52 bits, and P is evaluated with fused multiply-adds.
+*/
+#define COSPOLY_SUM_BODY(VI, VD, W, SET1D, ADDI, SRLI, ORI, CASTD, CASTI, LOADI, \
+			 ADD, SUB, MUL, MIN, FMADD, LOADU, STOREU)	\
+  const double *c = cosPolyCoef[level];					\
+  int nTerms = cosPolyTerms[level];					\
+  VI ph[COSPOLY_MAX_SIN];                     /* Phases of W samples */ \
+  VI step[COSPOLY_MAX_SIN];                   /* W increments */	\
+  uint64_t lane[W];							\
+  VD x, z, z2, p, sum;							\
+  int k, m, ii, j;							\
+									\
+  for (m = 0; m < nSin; m++)						\
+    {									\
+      for (j = 0; j < (W); j++)						\
+	{								\
+	  lane[j] = pAcc[m] + j*pInc[m];				\
+	}								\
+      ph[m] = LOADI(lane);						\
+      for (j = 0; j < (W); j++)						\
+	{								\
+	  lane[j] = (W)*pInc[m];					\
+	}								\
+      step[m] = LOADI(lane);						\
+    }									\
+  for (k = 0; k + (W) <= len; k += (W))					\
+    {									\
+      sum = SET1D(0.);							\
+      for (m = 0; m < nSin; m++)					\
+	{								\
+	  x = SUB(CASTD(ORI(SRLI(ph[m], 12), CASTI(SET1D(1.)))), SET1D(1.)); \
+	  z = SUB(SET1D(0.25), MIN(x, SUB(SET1D(1.), x)));		\
+	  z2 = MUL(z, z);						\
+	  p = SET1D(c[nTerms - 1]);					\
+	  for (ii = nTerms - 1; ii > 0; ii--)				\
+	    {								\
+	      p = FMADD(p, z2, SET1D(c[ii - 1]));			\
+	    }								\
+	  sum = FMADD(z, p, sum);					\
+	  ph[m] = ADDI(ph[m], step[m]);					\
+	}								\
+      STOREU(pSum + k, ADD(LOADU(pSum + k), sum));			\
+    }									\
+  for (m = 0; m < nSin; m++)						\
+    {									\
+      pAcc[m] += (uint64_t)k*pInc[m];					\
+    }									\
+  cosPolySumScalar(pSum + k, len - k, pAcc, pInc, nSin, level);
+
+__attribute__((target("avx2,fma")))
+static void cosPolySumAvx2(double *pSum, int len, uint64_t *pAcc,
+			   const uint64_t *pInc, int nSin, int level)
+{
+#define COSPOLY_LOADI_AVX2(P) _mm256_loadu_si256((const __m256i *)(P))
+  COSPOLY_SUM_BODY(__m256i, __m256d, 4, _mm256_set1_pd,
+		   _mm256_add_epi64, _mm256_srli_epi64, _mm256_or_si256,
+		   _mm256_castsi256_pd, _mm256_castpd_si256, COSPOLY_LOADI_AVX2,
+		   _mm256_add_pd, _mm256_sub_pd, _mm256_mul_pd, _mm256_min_pd,
+		   _mm256_fmadd_pd, _mm256_loadu_pd, _mm256_storeu_pd)
+#undef COSPOLY_LOADI_AVX2
+}
+
+__attribute__((target("avx512f")))
+static void cosPolySumAvx512(double *pSum, int len, uint64_t *pAcc,
+			     const uint64_t *pInc, int nSin, int level)
+{
+#define COSPOLY_LOADI_AVX512(P) _mm512_loadu_si512((const void *)(P))
+  COSPOLY_SUM_BODY(__m512i, __m512d, 8, _mm512_set1_pd,
+		   _mm512_add_epi64, _mm512_srli_epi64, _mm512_or_si512,
+		   _mm512_castsi512_pd, _mm512_castpd_si512, COSPOLY_LOADI_AVX512,
+		   _mm512_add_pd, _mm512_sub_pd, _mm512_mul_pd, _mm512_min_pd,
+		   _mm512_fmadd_pd, _mm512_loadu_pd, _mm512_storeu_pd)
+#undef COSPOLY_LOADI_AVX512
+}
+
+#undef COSPOLY_SUM_BODY
+#endif /* COSPOLY_X86_SIMD */
+
+static cosPolySumFn cosPolySum = NULL;
+
+/*
+  Select the kernel behind cosPolySum().  COSPOLY_ISA_AUTO picks the best
+  one for this CPU unless LLAMACOMM_COSPOLY_ISA says otherwise; requests
+  for an instruction set the CPU lacks fall back to the best available.
+  Returns the instruction set actually selected.
+*/
+static int cosPolySelectIsa(int isa)
+{
+  int cpuIsa = COSPOLY_ISA_SCALAR;
+  char *env;
+
+#ifdef COSPOLY_X86_SIMD
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f"))
+    {
+      cpuIsa = COSPOLY_ISA_AVX512;
+    }
+  else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+    {
+      cpuIsa = COSPOLY_ISA_AVX2;
+    }
+#endif
+
+  if (isa == COSPOLY_ISA_AUTO)
+    {
+      isa = cpuIsa;
+      if (NULL != (env = getenv("LLAMACOMM_COSPOLY_ISA")))
+	{
+	  isa = (0 == strcmp(env, "scalar")) ? COSPOLY_ISA_SCALAR :
+	    (0 == strcmp(env, "avx2")) ? COSPOLY_ISA_AVX2 :
+	    (0 == strcmp(env, "avx512")) ? COSPOLY_ISA_AVX512 : isa;
+	}
+    }
+  isa = (isa > cpuIsa) ? cpuIsa : isa;
+
+  switch (isa)
+    {
+#ifdef COSPOLY_X86_SIMD
+    case COSPOLY_ISA_AVX512:
+      cosPolySum = cosPolySumAvx512;
+      break;
+    case COSPOLY_ISA_AVX2:
+      cosPolySum = cosPolySumAvx2;
+      break;
+#endif
+    default:
+      isa = COSPOLY_ISA_SCALAR;
+      cosPolySum = cosPolySumScalar;
+      break;
+    }
+  return(isa);
+}
+
+static void cosPolyInitIsa(void)
+{
+  if (NULL == cosPolySum)
+    {
+      (void)cosPolySelectIsa(COSPOLY_ISA_AUTO);
+    }
+}
+
+#endif /* COSPOLY_H */
+
+/*
+  This material is based upon work supported by the Defense Advanced Research
+  Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+  findings, conclusions or recommendations expressed in this material are those
+  of the author(s) and do not necessarily reflect the views of the Defense
+  Advanced Research Projects Agency.
+
+  © 2019 Massachusetts Institute of Technology.
+
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License version 2 as
+  published by the Free Software Foundation;
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+  POSSIBILITY OF SUCH DAMAGE.
+*/
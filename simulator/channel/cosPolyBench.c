@@ -0,0 +1,203 @@
+/*
+  This material is based upon work supported by the Defense Advanced Research
+  Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+  findings, conclusions or recommendations expressed in this material are those
+  of the author(s) and do not necessarily reflect the views of the Defense
+  Advanced Research Projects Agency.
+
+  © 2019 Massachusetts Institute of Technology.
+
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License version 2 as
+  published by the Free Software Foundation;
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+  POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  Throughput and accuracy of the cosPoly.h kernels and of the cosLut.h
+  tables of zhengFunLUT, against libm cos.  Not a MEX function:
+
+    cc -O2 cosPolyBench.c -o cosPolyBench -lm
+    ./cosPolyBench [samples]
+
+  Each kernel sums 8 sinusoids over the samples, with the slow phase
+  increments of Jakes taps (doppf up to 1e-3) and with random ones.  The
+  error is the largest over one sinusoid against cos(2 pi phase 2^-64).
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#if defined(_WIN32) || defined(_WIN32_) || defined (__WIN32__)
+typedef unsigned __int64 uint64_t;
+typedef __int64 int64_t;
+#else
+#include <stdint.h>
+#endif
+
+#include "cosPoly.h"
+#include "cosLut.h"
+
+#define NSIN 8
+
+/* Random 64-bit phase word */
+static uint64_t benchWord(void)
+{
+  uint64_t w = 0;
+  int ii;
+
+  for (ii = 0; ii < 4; ii++)
+    {
+      w = (w << 16) ^ (uint64_t)(rand() & 0xFFFF);
+    }
+  return(w);
+}
+
+/* The table of the current run, set up by cosLutInit() */
+static cosLut benchLut;
+
+/* Table sum, level being the table size */
+static void benchLutSum(double *pSum, int len, uint64_t *pAcc,
+			const uint64_t *pInc, int nSin, int level)
+{
+  (void)level;
+  cosLutSum(pSum, len, pAcc, pInc, nSin, &benchLut);
+}
+
+/* As benchLutSum, with each phase looked up as zhengFunLUT's direct path does */
+static void benchTurnsSum(double *pSum, int len, uint64_t *pAcc,
+			  const uint64_t *pInc, int nSin, int level)
+{
+  int k, m;
+
+  (void)level;
+  for (m = 0; m < nSin; m++)
+    {
+      for (k = 0; k < len; k++, pAcc[m] += pInc[m])
+	{
+	  pSum[k] += cosLutTurns(ldexp((double)(pAcc[m] >> 11), -53), &benchLut);
+	}
+    }
+}
+
+/* Millions of cosines per second and largest error of a kernel */
+static void benchRun(const char *name, cosPolySumFn fn, int level,
+		     double *pSum, int nSamp, int slow)
+{
+  uint64_t acc[NSIN], inc[NSIN], acc0;
+  double err = 0., ref, secs;
+  clock_t c0;
+  int m, k, reps = 0;
+
+  srand(1);
+  for (m = 0; m < NSIN; m++)
+    {
+      acc[m] = benchWord();
+      inc[m] = slow ? (uint64_t)(ldexp((double)rand()/RAND_MAX*1e-3, 64)) : benchWord();
+    }
+
+  c0 = clock();
+  do
+    {
+      memset(pSum, 0, nSamp*sizeof(double));
+      fn(pSum, nSamp, acc, inc, NSIN, level);
+      reps++;
+    }
+  while ((secs = (double)(clock() - c0)/CLOCKS_PER_SEC) < 0.5);
+
+  /* One sinusoid against libm */
+  acc0 = acc[0];
+  memset(pSum, 0, nSamp*sizeof(double));
+  fn(pSum, nSamp, acc, inc, 1, level);
+  for (k = 0; k < nSamp; k++, acc0 += inc[0])
+    {
+      ref = cos(6.283185307179586*ldexp((double)(acc0 >> 11), -53));
+      err = (fabs(pSum[k] - ref) > err) ? fabs(pSum[k] - ref) : err;
+    }
+
+  printf("%-8s %-7s %6d %10.1f %12.2e\n", name, slow ? "slow" : "random",
+	 ((fn == benchLutSum) || (fn == benchTurnsSum)) ? level : cosPolyTerms[level],
+	 (double)reps*nSamp*NSIN/secs*1e-6, err);
+}
+
+int main(int argc, char *argv[])
+{
+  static const char *isaName[3] = {"scalar", "avx2", "avx512"};
+  static const char *lutName[2] = {"nearest", "linear"};
+  static const int lutSize[5] = {65536, 256, 1024, 4096, 65536};
+  static const int lutInterp[5] = {COSLUT_NEAREST, COSLUT_LINEAR, COSLUT_LINEAR,
+				   COSLUT_LINEAR, COSLUT_LINEAR};
+  int nSamp = (argc > 1) ? atoi(argv[1]) : 65536;
+  double *pSum = (double *)malloc(nSamp*sizeof(double));
+  int isa, ii, slow;
+
+  cosPolyInitIsa();
+  printf("zhengFunLUT would use %s\n\n",
+	 isaName[(cosPolySum == cosPolySumScalar) ? 0 : (cosPolySum == cosPolySumAvx2) ? 1 : 2]);
+  printf("%-8s %-7s %6s %10s %12s\n", "kernel", "phases", "size", "Mcos/s", "max error");
+  for (slow = 1; slow >= 0; slow--)
+    {
+      for (ii = 0; ii < 5; ii++)
+	{
+	  benchRun(lutName[lutInterp[ii]],
+		   benchLutSum, cosLutInit(lutSize[ii], lutInterp[ii], &benchLut), pSum, nSamp, slow);
+	}
+      benchRun("turns", benchTurnsSum, cosLutInit(COSLUT_DEFAULT_SIZE, COSLUT_LINEAR, &benchLut),
+	       pSum, nSamp, slow);
+      for (isa = COSPOLY_ISA_SCALAR; isa <= COSPOLY_ISA_AVX512; isa++)
+	{
+	  if (cosPolySelectIsa(isa) != isa)
+	    {
+	      continue;
+	    }
+	  for (ii = 0; ii < COSPOLY_LEVELS; ii++)
+	    {
+	      benchRun(isaName[isa], cosPolySum, cosPolyLevel(cosPolyErr[ii]), pSum, nSamp, slow);
+	    }
+	}
+    }
+
+  free(pSum);
+  return(0);
+}
+
+/*
+  This material is based upon work supported by the Defense Advanced Research
+  Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+  findings, conclusions or recommendations expressed in this material are those
+  of the author(s) and do not necessarily reflect the views of the Defense
+  Advanced Research Projects Agency.
+
+  © 2019 Massachusetts Institute of Technology.
+
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License version 2 as
+  published by the Free Software Foundation;
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+  POSSIBILITY OF SUCH DAMAGE.
+*/
@@ -1,312 +0,0 @@
-/*
-  This material is based upon work supported by the Defense Advanced Research
-  Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
-  findings, conclusions or recommendations expressed in this material are those
-  of the author(s) and do not necessarily reflect the views of the Defense
-  Advanced Research Projects Agency.
-
-  © 2019 Massachusetts Institute of Technology.
-
-
-  This program is free software; you can redistribute it and/or modify
-  it under the terms of the GNU General Public License version 2 as
-  published by the Free Software Foundation;
-
-  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
-  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
-  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
-  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
-  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
-  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
-  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
-  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
-  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
-  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
-  POSSIBILITY OF SUCH DAMAGE.
-*/
-
-#define LUTSIZE 256
-#define STEPSIZE LUTSIZE/360.0
-double coslut[LUTSIZE]={ 1.0000000000000000,
-			 0.9996988186962042,
-			 0.9987954562051724,
-			 0.9972904566786902,
-			 0.9951847266721969,
-			 0.9924795345987100,
-			 0.9891765099647810,
-			 0.9852776423889412,
-			 0.9807852804032304,
-			 0.9757021300385286,
-			 0.9700312531945440,
-			 0.9637760657954398,
-			 0.9569403357322088,
-			 0.9495281805930367,
-			 0.9415440651830208,
-			 0.9329927988347390,
-			 0.9238795325112867,
-			 0.9142097557035307,
-			 0.9039892931234433,
-			 0.8932243011955153,
-			 0.8819212643483550,
-			 0.8700869911087115,
-			 0.8577286100002721,
-			 0.8448535652497071,
-			 0.8314696123025452,
-			 0.8175848131515837,
-			 0.8032075314806449,
-			 0.7883464276266063,
-			 0.7730104533627370,
-			 0.7572088465064846,
-			 0.7409511253549592,
-			 0.7242470829514670,
-			 0.7071067811865476,
-			 0.6895405447370669,
-			 0.6715589548470184,
-			 0.6531728429537769,
-			 0.6343932841636455,
-			 0.6152315905806268,
-			 0.5956993044924335,
-			 0.5758081914178453,
-			 0.5555702330196023,
-			 0.5349976198870973,
-			 0.5141027441932217,
-			 0.4928981922297841,
-			 0.4713967368259978,
-			 0.4496113296546066,
-			 0.4275550934302822,
-			 0.4052413140049899,
-			 0.3826834323650898,
-			 0.3598950365349883,
-			 0.3368898533922201,
-			 0.3136817403988916,
-			 0.2902846772544623,
-			 0.2667127574748984,
-			 0.2429801799032640,
-			 0.2191012401568698,
-			 0.1950903220161283,
-			 0.1709618887603014,
-			 0.1467304744553617,
-			 0.1224106751992163,
-			 0.0980171403295608,
-			 0.0735645635996675,
-			 0.0490676743274181,
-			 0.0245412285229123,
-			 0.0000000000000001,
-			 -0.0245412285229121,
-			 -0.0490676743274180,
-			 -0.0735645635996673,
-			 -0.0980171403295606,
-			 -0.1224106751992162,
-			 -0.1467304744553616,
-			 -0.1709618887603012,
-			 -0.1950903220161282,
-			 -0.2191012401568697,
-			 -0.2429801799032639,
-			 -0.2667127574748983,
-			 -0.2902846772544622,
-			 -0.3136817403988914,
-			 -0.3368898533922199,
-			 -0.3598950365349882,
-			 -0.3826834323650897,
-			 -0.4052413140049897,
-			 -0.4275550934302819,
-			 -0.4496113296546067,
-			 -0.4713967368259977,
-			 -0.4928981922297840,
-			 -0.5141027441932216,
-			 -0.5349976198870970,
-			 -0.5555702330196020,
-			 -0.5758081914178453,
-			 -0.5956993044924334,
-			 -0.6152315905806267,
-			 -0.6343932841636454,
-			 -0.6531728429537765,
-			 -0.6715589548470184,
-			 -0.6895405447370669,
-			 -0.7071067811865475,
-			 -0.7242470829514668,
-			 -0.7409511253549589,
-			 -0.7572088465064847,
-			 -0.7730104533627370,
-			 -0.7883464276266062,
-			 -0.8032075314806448,
-			 -0.8175848131515836,
-			 -0.8314696123025453,
-			 -0.8448535652497071,
-			 -0.8577286100002720,
-			 -0.8700869911087113,
-			 -0.8819212643483549,
-			 -0.8932243011955152,
-			 -0.9039892931234433,
-			 -0.9142097557035307,
-			 -0.9238795325112867,
-			 -0.9329927988347388,
-			 -0.9415440651830207,
-			 -0.9495281805930367,
-			 -0.9569403357322088,
-			 -0.9637760657954398,
-			 -0.9700312531945440,
-			 -0.9757021300385285,
-			 -0.9807852804032304,
-			 -0.9852776423889412,
-			 -0.9891765099647810,
-			 -0.9924795345987100,
-			 -0.9951847266721968,
-			 -0.9972904566786902,
-			 -0.9987954562051724,
-			 -0.9996988186962042,
-			 -1.0000000000000000,
-			 -0.9996988186962042,
-			 -0.9987954562051724,
-			 -0.9972904566786902,
-			 -0.9951847266721969,
-			 -0.9924795345987100,
-			 -0.9891765099647810,
-			 -0.9852776423889413,
-			 -0.9807852804032304,
-			 -0.9757021300385286,
-			 -0.9700312531945440,
-			 -0.9637760657954400,
-			 -0.9569403357322089,
-			 -0.9495281805930368,
-			 -0.9415440651830208,
-			 -0.9329927988347390,
-			 -0.9238795325112868,
-			 -0.9142097557035307,
-			 -0.9039892931234434,
-			 -0.8932243011955153,
-			 -0.8819212643483550,
-			 -0.8700869911087115,
-			 -0.8577286100002721,
-			 -0.8448535652497072,
-			 -0.8314696123025455,
-			 -0.8175848131515837,
-			 -0.8032075314806449,
-			 -0.7883464276266063,
-			 -0.7730104533627371,
-			 -0.7572088465064848,
-			 -0.7409511253549591,
-			 -0.7242470829514670,
-			 -0.7071067811865477,
-			 -0.6895405447370671,
-			 -0.6715589548470187,
-			 -0.6531728429537771,
-			 -0.6343932841636459,
-			 -0.6152315905806273,
-			 -0.5956993044924331,
-			 -0.5758081914178452,
-			 -0.5555702330196022,
-			 -0.5349976198870973,
-			 -0.5141027441932218,
-			 -0.4928981922297842,
-			 -0.4713967368259979,
-			 -0.4496113296546069,
-			 -0.4275550934302825,
-			 -0.4052413140049904,
-			 -0.3826834323650903,
-			 -0.3598950365349879,
-			 -0.3368898533922199,
-			 -0.3136817403988915,
-			 -0.2902846772544624,
-			 -0.2667127574748985,
-			 -0.2429801799032641,
-			 -0.2191012401568701,
-			 -0.1950903220161287,
-			 -0.1709618887603017,
-			 -0.1467304744553623,
-			 -0.1224106751992160,
-			 -0.0980171403295605,
-			 -0.0735645635996674,
-			 -0.0490676743274180,
-			 -0.0245412285229124,
-			 -0.0000000000000002,
-			 0.0245412285229120,
-			 0.0490676743274177,
-			 0.0735645635996670,
-			 0.0980171403295601,
-			 0.1224106751992156,
-			 0.1467304744553619,
-			 0.1709618887603013,
-			 0.1950903220161283,
-			 0.2191012401568697,
-			 0.2429801799032638,
-			 0.2667127574748982,
-			 0.2902846772544621,
-			 0.3136817403988911,
-			 0.3368898533922196,
-			 0.3598950365349876,
-			 0.3826834323650900,
-			 0.4052413140049900,
-			 0.4275550934302821,
-			 0.4496113296546066,
-			 0.4713967368259976,
-			 0.4928981922297839,
-			 0.5141027441932216,
-			 0.5349976198870969,
-			 0.5555702330196018,
-			 0.5758081914178449,
-			 0.5956993044924328,
-			 0.6152315905806270,
-			 0.6343932841636456,
-			 0.6531728429537768,
-			 0.6715589548470183,
-			 0.6895405447370668,
-			 0.7071067811865474,
-			 0.7242470829514667,
-			 0.7409511253549589,
-			 0.7572088465064842,
-			 0.7730104533627365,
-			 0.7883464276266059,
-			 0.8032075314806451,
-			 0.8175848131515837,
-			 0.8314696123025452,
-			 0.8448535652497070,
-			 0.8577286100002720,
-			 0.8700869911087113,
-			 0.8819212643483548,
-			 0.8932243011955151,
-			 0.9039892931234431,
-			 0.9142097557035305,
-			 0.9238795325112865,
-			 0.9329927988347390,
-			 0.9415440651830208,
-			 0.9495281805930367,
-			 0.9569403357322088,
-			 0.9637760657954398,
-			 0.9700312531945440,
-			 0.9757021300385285,
-			 0.9807852804032303,
-			 0.9852776423889411,
-			 0.9891765099647809,
-			 0.9924795345987100,
-			 0.9951847266721969,
-			 0.9972904566786902,
-			 0.9987954562051724,
-			 0.9996988186962042};
-
-/*
-  This material is based upon work supported by the Defense Advanced Research
-  Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
-  findings, conclusions or recommendations expressed in this material are those
-  of the author(s) and do not necessarily reflect the views of the Defense
-  Advanced Research Projects Agency.
-
-  © 2019 Massachusetts Institute of Technology.
-
-
-  This program is free software; you can redistribute it and/or modify
-  it under the terms of the GNU General Public License version 2 as
-  published by the Free Software Foundation;
-
-  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
-  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
-  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
-  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
-  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
-  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
-  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
-  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
-  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
-  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
-  POSSIBILITY OF SUCH DAMAGE.
-*/
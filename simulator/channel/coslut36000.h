@@ -1,36060 +0,0 @@
-/*
-  This material is based upon work supported by the Defense Advanced Research
-  Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
-  findings, conclusions or recommendations expressed in this material are those
-  of the author(s) and do not necessarily reflect the views of the Defense
-  Advanced Research Projects Agency.
-
-  © 2019 Massachusetts Institute of Technology.
-
-
-  This program is free software; you can redistribute it and/or modify
-  it under the terms of the GNU General Public License version 2 as
-  published by the Free Software Foundation;
-
-  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
-  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
-  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
-  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
-  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
-  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
-  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
-  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
-  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
-  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
-  POSSIBILITY OF SUCH DAMAGE.
-*/
-
-#define LUTSIZE 36000
-#define STEPSIZE LUTSIZE/360.0
-double coslut[LUTSIZE]={1.0000000000000000,
-			0.9999999847691291,
-			0.9999999390765166,
-			0.9999998629221643,
-			0.9999997563060741,
-			0.9999996192282494,
-			0.9999994516886945,
-			0.9999992536874144,
-			0.9999990252244151,
-			0.9999987662997035,
-			0.9999984769132877,
-			0.9999981570651764,
-			0.9999978067553793,
-			0.9999974259839071,
-			0.9999970147507714,
-			0.9999965730559848,
-			0.9999961008995606,
-			0.9999955982815133,
-			0.9999950652018582,
-			0.9999945016606114,
-			0.9999939076577904,
-			0.9999932831934130,
-			0.9999926282674982,
-			0.9999919428800662,
-			0.9999912270311376,
-			0.9999904807207345,
-			0.9999897039488793,
-			0.9999888967155960,
-			0.9999880590209089,
-			0.9999871908648437,
-			0.9999862922474267,
-			0.9999853631686856,
-			0.9999844036286483,
-			0.9999834136273441,
-			0.9999823931648033,
-			0.9999813422410571,
-			0.9999802608561371,
-			0.9999791490100767,
-			0.9999780067029094,
-			0.9999768339346702,
-			0.9999756307053947,
-			0.9999743970151198,
-			0.9999731328638829,
-			0.9999718382517224,
-			0.9999705131786779,
-			0.9999691576447897,
-			0.9999677716500991,
-			0.9999663551946484,
-			0.9999649082784806,
-			0.9999634309016400,
-			0.9999619230641713,
-			0.9999603847661206,
-			0.9999588160075348,
-			0.9999572167884616,
-			0.9999555871089498,
-			0.9999539269690489,
-			0.9999522363688097,
-			0.9999505153082835,
-			0.9999487637875227,
-			0.9999469818065809,
-			0.9999451693655121,
-			0.9999433264643717,
-			0.9999414531032158,
-			0.9999395492821014,
-			0.9999376150010865,
-			0.9999356502602301,
-			0.9999336550595920,
-			0.9999316293992330,
-			0.9999295732792147,
-			0.9999274866995999,
-			0.9999253696604520,
-			0.9999232221618356,
-			0.9999210442038161,
-			0.9999188357864599,
-			0.9999165969098341,
-			0.9999143275740070,
-			0.9999120277790478,
-			0.9999096975250265,
-			0.9999073368120139,
-			0.9999049456400823,
-			0.9999025240093042,
-			0.9999000719197535,
-			0.9998975893715050,
-			0.9998950763646340,
-			0.9998925328992174,
-			0.9998899589753325,
-			0.9998873545930577,
-			0.9998847197524724,
-			0.9998820544536569,
-			0.9998793586966922,
-			0.9998766324816606,
-			0.9998738758086451,
-			0.9998710886777297,
-			0.9998682710889991,
-			0.9998654230425394,
-			0.9998625445384374,
-			0.9998596355767804,
-			0.9998566961576574,
-			0.9998537262811577,
-			0.9998507259473718,
-			0.9998476951563913,
-			0.9998446339083082,
-			0.9998415422032160,
-			0.9998384200412088,
-			0.9998352674223817,
-			0.9998320843468308,
-			0.9998288708146529,
-			0.9998256268259461,
-			0.9998223523808090,
-			0.9998190474793415,
-			0.9998157121216442,
-			0.9998123463078188,
-			0.9998089500379678,
-			0.9998055233121944,
-			0.9998020661306034,
-			0.9997985784932998,
-			0.9997950604003900,
-			0.9997915118519811,
-			0.9997879328481812,
-			0.9997843233890994,
-			0.9997806834748455,
-			0.9997770131055305,
-			0.9997733122812661,
-			0.9997695810021652,
-			0.9997658192683413,
-			0.9997620270799091,
-			0.9997582044369840,
-			0.9997543513396826,
-			0.9997504677881222,
-			0.9997465537824209,
-			0.9997426093226983,
-			0.9997386344090743,
-			0.9997346290416701,
-			0.9997305932206075,
-			0.9997265269460098,
-			0.9997224302180006,
-			0.9997183030367047,
-			0.9997141454022479,
-			0.9997099573147569,
-			0.9997057387743591,
-			0.9997014897811831,
-			0.9996972103353584,
-			0.9996929004370153,
-			0.9996885600862851,
-			0.9996841892832999,
-			0.9996797880281931,
-			0.9996753563210985,
-			0.9996708941621513,
-			0.9996664015514872,
-			0.9996618784892434,
-			0.9996573249755573,
-			0.9996527410105678,
-			0.9996481265944145,
-			0.9996434817272380,
-			0.9996388064091798,
-			0.9996341006403823,
-			0.9996293644209887,
-			0.9996245977511435,
-			0.9996198006309919,
-			0.9996149730606797,
-			0.9996101150403544,
-			0.9996052265701637,
-			0.9996003076502565,
-			0.9995953582807828,
-			0.9995903784618934,
-			0.9995853681937397,
-			0.9995803274764746,
-			0.9995752563102516,
-			0.9995701546952250,
-			0.9995650226315503,
-			0.9995598601193840,
-			0.9995546671588833,
-			0.9995494437502062,
-			0.9995441898935119,
-			0.9995389055889605,
-			0.9995335908367129,
-			0.9995282456369311,
-			0.9995228699897779,
-			0.9995174638954168,
-			0.9995120273540129,
-			0.9995065603657316,
-			0.9995010629307393,
-			0.9994955350492036,
-			0.9994899767212930,
-			0.9994843879471766,
-			0.9994787687270248,
-			0.9994731190610087,
-			0.9994674389493003,
-			0.9994617283920728,
-			0.9994559873895001,
-			0.9994502159417572,
-			0.9994444140490196,
-			0.9994385817114643,
-			0.9994327189292689,
-			0.9994268257026119,
-			0.9994209020316729,
-			0.9994149479166323,
-			0.9994089633576715,
-			0.9994029483549729,
-			0.9993969029087195,
-			0.9993908270190958,
-			0.9993847206862865,
-			0.9993785839104777,
-			0.9993724166918566,
-			0.9993662190306108,
-			0.9993599909269292,
-			0.9993537323810014,
-			0.9993474433930183,
-			0.9993411239631712,
-			0.9993347740916527,
-			0.9993283937786562,
-			0.9993219830243762,
-			0.9993155418290078,
-			0.9993090701927474,
-			0.9993025681157919,
-			0.9992960355983396,
-			0.9992894726405892,
-			0.9992828792427410,
-			0.9992762554049955,
-			0.9992696011275547,
-			0.9992629164106211,
-			0.9992562012543986,
-			0.9992494556590916,
-			0.9992426796249055,
-			0.9992358731520469,
-			0.9992290362407229,
-			0.9992221688911420,
-			0.9992152711035133,
-			0.9992083428780468,
-			0.9992013842149537,
-			0.9991943951144460,
-			0.9991873755767364,
-			0.9991803256020390,
-			0.9991732451905683,
-			0.9991661343425401,
-			0.9991589930581710,
-			0.9991518213376787,
-			0.9991446191812813,
-			0.9991373865891984,
-			0.9991301235616503,
-			0.9991228300988584,
-			0.9991155062010446,
-			0.9991081518684322,
-			0.9991007671012450,
-			0.9990933518997082,
-			0.9990859062640476,
-			0.9990784301944899,
-			0.9990709236912629,
-			0.9990633867545954,
-			0.9990558193847169,
-			0.9990482215818578,
-			0.9990405933462496,
-			0.9990329346781247,
-			0.9990252455777164,
-			0.9990175260452590,
-			0.9990097760809875,
-			0.9990019956851380,
-			0.9989941848579477,
-			0.9989863435996542,
-			0.9989784719104966,
-			0.9989705697907147,
-			0.9989626372405491,
-			0.9989546742602414,
-			0.9989466808500344,
-			0.9989386570101713,
-			0.9989306027408966,
-			0.9989225180424558,
-			0.9989144029150950,
-			0.9989062573590616,
-			0.9988980813746036,
-			0.9988898749619700,
-			0.9988816381214108,
-			0.9988733708531770,
-			0.9988650731575204,
-			0.9988567450346937,
-			0.9988483864849507,
-			0.9988399975085459,
-			0.9988315781057349,
-			0.9988231282767742,
-			0.9988146480219211,
-			0.9988061373414341,
-			0.9987975962355722,
-			0.9987890247045957,
-			0.9987804227487659,
-			0.9987717903683445,
-			0.9987631275635946,
-			0.9987544343347802,
-			0.9987457106821659,
-			0.9987369566060175,
-			0.9987281721066018,
-			0.9987193571841863,
-			0.9987105118390394,
-			0.9987016360714307,
-			0.9986927298816305,
-			0.9986837932699102,
-			0.9986748262365419,
-			0.9986658287817988,
-			0.9986568009059550,
-			0.9986477426092855,
-			0.9986386538920661,
-			0.9986295347545738,
-			0.9986203851970865,
-			0.9986112052198827,
-			0.9986019948232421,
-			0.9985927540074452,
-			0.9985834827727736,
-			0.9985741811195098,
-			0.9985648490479369,
-			0.9985554865583393,
-			0.9985460936510022,
-			0.9985366703262117,
-			0.9985272165842549,
-			0.9985177324254199,
-			0.9985082178499952,
-			0.9984986728582710,
-			0.9984890974505379,
-			0.9984794916270877,
-			0.9984698553882129,
-			0.9984601887342071,
-			0.9984504916653646,
-			0.9984407641819810,
-			0.9984310062843526,
-			0.9984212179727765,
-			0.9984113992475510,
-			0.9984015501089750,
-			0.9983916705573488,
-			0.9983817605929732,
-			0.9983718202161501,
-			0.9983618494271823,
-			0.9983518482263735,
-			0.9983418166140283,
-			0.9983317545904524,
-			0.9983216621559523,
-			0.9983115393108354,
-			0.9983013860554101,
-			0.9982912023899855,
-			0.9982809883148720,
-			0.9982707438303807,
-			0.9982604689368237,
-			0.9982501636345139,
-			0.9982398279237653,
-			0.9982294618048926,
-			0.9982190652782118,
-			0.9982086383440394,
-			0.9981981810026931,
-			0.9981876932544915,
-			0.9981771750997539,
-			0.9981666265388009,
-			0.9981560475719538,
-			0.9981454381995347,
-			0.9981347984218669,
-			0.9981241282392745,
-			0.9981134276520827,
-			0.9981026966606170,
-			0.9980919352652047,
-			0.9980811434661735,
-			0.9980703212638521,
-			0.9980594686585701,
-			0.9980485856506581,
-			0.9980376722404478,
-			0.9980267284282716,
-			0.9980157542144626,
-			0.9980047495993554,
-			0.9979937145832851,
-			0.9979826491665879,
-			0.9979715533496006,
-			0.9979604271326616,
-			0.9979492705161096,
-			0.9979380835002845,
-			0.9979268660855271,
-			0.9979156182721790,
-			0.9979043400605829,
-			0.9978930314510823,
-			0.9978816924440219,
-			0.9978703230397468,
-			0.9978589232386035,
-			0.9978474930409392,
-			0.9978360324471022,
-			0.9978245414574415,
-			0.9978130200723071,
-			0.9978014682920500,
-			0.9977898861170221,
-			0.9977782735475763,
-			0.9977666305840662,
-			0.9977549572268466,
-			0.9977432534762729,
-			0.9977315193327018,
-			0.9977197547964907,
-			0.9977079598679978,
-			0.9976961345475827,
-			0.9976842788356053,
-			0.9976723927324269,
-			0.9976604762384097,
-			0.9976485293539166,
-			0.9976365520793113,
-			0.9976245444149590,
-			0.9976125063612252,
-			0.9976004379184767,
-			0.9975883390870813,
-			0.9975762098674072,
-			0.9975640502598242,
-			0.9975518602647026,
-			0.9975396398824137,
-			0.9975273891133296,
-			0.9975151079578237,
-			0.9975027964162700,
-			0.9974904544890437,
-			0.9974780821765206,
-			0.9974656794790776,
-			0.9974532463970924,
-			0.9974407829309440,
-			0.9974282890810118,
-			0.9974157648476766,
-			0.9974032102313197,
-			0.9973906252323237,
-			0.9973780098510718,
-			0.9973653640879485,
-			0.9973526879433389,
-			0.9973399814176290,
-			0.9973272445112061,
-			0.9973144772244581,
-			0.9973016795577739,
-			0.9972888515115433,
-			0.9972759930861571,
-			0.9972631042820070,
-			0.9972501850994857,
-			0.9972372355389866,
-			0.9972242556009041,
-			0.9972112452856339,
-			0.9971982045935720,
-			0.9971851335251157,
-			0.9971720320806634,
-			0.9971589002606139,
-			0.9971457380653674,
-			0.9971325454953248,
-			0.9971193225508880,
-			0.9971060692324597,
-			0.9970927855404437,
-			0.9970794714752446,
-			0.9970661270372679,
-			0.9970527522269202,
-			0.9970393470446089,
-			0.9970259114907425,
-			0.9970124455657300,
-			0.9969989492699817,
-			0.9969854226039088,
-			0.9969718655679232,
-			0.9969582781624380,
-			0.9969446603878670,
-			0.9969310122446251,
-			0.9969173337331280,
-			0.9969036248537924,
-			0.9968898856070358,
-			0.9968761159932769,
-			0.9968623160129350,
-			0.9968484856664305,
-			0.9968346249541847,
-			0.9968207338766200,
-			0.9968068124341591,
-			0.9967928606272266,
-			0.9967788784562471,
-			0.9967648659216468,
-			0.9967508230238523,
-			0.9967367497632916,
-			0.9967226461403932,
-			0.9967085121555869,
-			0.9966943478093030,
-			0.9966801531019732,
-			0.9966659280340299,
-			0.9966516726059063,
-			0.9966373868180366,
-			0.9966230706708561,
-			0.9966087241648008,
-			0.9965943473003078,
-			0.9965799400778151,
-			0.9965655024977614,
-			0.9965510345605866,
-			0.9965365362667313,
-			0.9965220076166375,
-			0.9965074486107472,
-			0.9964928592495044,
-			0.9964782395333531,
-			0.9964635894627391,
-			0.9964489090381082,
-			0.9964341982599080,
-			0.9964194571285864,
-			0.9964046856445924,
-			0.9963898838083761,
-			0.9963750516203883,
-			0.9963601890810808,
-			0.9963452961909064,
-			0.9963303729503188,
-			0.9963154193597725,
-			0.9963004354197230,
-			0.9962854211306268,
-			0.9962703764929413,
-			0.9962553015071247,
-			0.9962401961736361,
-			0.9962250604929360,
-			0.9962098944654851,
-			0.9961946980917455,
-			0.9961794713721802,
-			0.9961642143072529,
-			0.9961489268974284,
-			0.9961336091431725,
-			0.9961182610449516,
-			0.9961028826032333,
-			0.9960874738184862,
-			0.9960720346911794,
-			0.9960565652217835,
-			0.9960410654107695,
-			0.9960255352586098,
-			0.9960099747657771,
-			0.9959943839327459,
-			0.9959787627599905,
-			0.9959631112479873,
-			0.9959474293972128,
-			0.9959317172081449,
-			0.9959159746812619,
-			0.9959002018170435,
-			0.9958843986159703,
-			0.9958685650785236,
-			0.9958527012051857,
-			0.9958368069964398,
-			0.9958208824527701,
-			0.9958049275746618,
-			0.9957889423626006,
-			0.9957729268170739,
-			0.9957568809385692,
-			0.9957408047275753,
-			0.9957246981845821,
-			0.9957085613100801,
-			0.9956923941045610,
-			0.9956761965685170,
-			0.9956599687024419,
-			0.9956437105068296,
-			0.9956274219821757,
-			0.9956111031289763,
-			0.9955947539477282,
-			0.9955783744389299,
-			0.9955619646030800,
-			0.9955455244406786,
-			0.9955290539522262,
-			0.9955125531382248,
-			0.9954960219991770,
-			0.9954794605355862,
-			0.9954628687479571,
-			0.9954462466367950,
-			0.9954295942026062,
-			0.9954129114458982,
-			0.9953961983671789,
-			0.9953794549669573,
-			0.9953626812457439,
-			0.9953458772040494,
-			0.9953290428423857,
-			0.9953121781612654,
-			0.9952952831612025,
-			0.9952783578427117,
-			0.9952614022063083,
-			0.9952444162525090,
-			0.9952273999818312,
-			0.9952103533947931,
-			0.9951932764919141,
-			0.9951761692737146,
-			0.9951590317407152,
-			0.9951418638934383,
-			0.9951246657324069,
-			0.9951074372581447,
-			0.9950901784711764,
-			0.9950728893720282,
-			0.9950555699612262,
-			0.9950382202392984,
-			0.9950208402067733,
-			0.9950034298641800,
-			0.9949859892120491,
-			0.9949685182509117,
-			0.9949510169813002,
-			0.9949334854037475,
-			0.9949159235187879,
-			0.9948983313269562,
-			0.9948807088287882,
-			0.9948630560248208,
-			0.9948453729155919,
-			0.9948276595016400,
-			0.9948099157835046,
-			0.9947921417617265,
-			0.9947743374368467,
-			0.9947565028094080,
-			0.9947386378799533,
-			0.9947207426490270,
-			0.9947028171171742,
-			0.9946848612849409,
-			0.9946668751528741,
-			0.9946488587215216,
-			0.9946308119914323,
-			0.9946127349631561,
-			0.9945946276372433,
-			0.9945764900142456,
-			0.9945583220947156,
-			0.9945401238792068,
-			0.9945218953682733,
-			0.9945036365624706,
-			0.9944853474623547,
-			0.9944670280684830,
-			0.9944486783814133,
-			0.9944302984017045,
-			0.9944118881299167,
-			0.9943934475666106,
-			0.9943749767123480,
-			0.9943564755676915,
-			0.9943379441332046,
-			0.9943193824094519,
-			0.9943007903969989,
-			0.9942821680964118,
-			0.9942635155082579,
-			0.9942448326331054,
-			0.9942261194715235,
-			0.9942073760240820,
-			0.9941886022913522,
-			0.9941697982739057,
-			0.9941509639723154,
-			0.9941320993871551,
-			0.9941132045189992,
-			0.9940942793684235,
-			0.9940753239360046,
-			0.9940563382223196,
-			0.9940373222279471,
-			0.9940182759534661,
-			0.9939991993994570,
-			0.9939800925665009,
-			0.9939609554551797,
-			0.9939417880660765,
-			0.9939225903997749,
-			0.9939033624568601,
-			0.9938841042379174,
-			0.9938648157435338,
-			0.9938454969742966,
-			0.9938261479307944,
-			0.9938067686136166,
-			0.9937873590233535,
-			0.9937679191605964,
-			0.9937484490259374,
-			0.9937289486199696,
-			0.9937094179432872,
-			0.9936898569964848,
-			0.9936702657801585,
-			0.9936506442949051,
-			0.9936309925413221,
-			0.9936113105200084,
-			0.9935915982315634,
-			0.9935718556765875,
-			0.9935520828556822,
-			0.9935322797694498,
-			0.9935124464184935,
-			0.9934925828034175,
-			0.9934726889248269,
-			0.9934527647833276,
-			0.9934328103795266,
-			0.9934128257140318,
-			0.9933928107874518,
-			0.9933727656003964,
-			0.9933526901534763,
-			0.9933325844473029,
-			0.9933124484824886,
-			0.9932922822596469,
-			0.9932720857793921,
-			0.9932518590423394,
-			0.9932316020491049,
-			0.9932113148003057,
-			0.9931909972965598,
-			0.9931706495384860,
-			0.9931502715267043,
-			0.9931298632618354,
-			0.9931094247445008,
-			0.9930889559753233,
-			0.9930684569549263,
-			0.9930479276839342,
-			0.9930273681629727,
-			0.9930067783926675,
-			0.9929861583736463,
-			0.9929655081065369,
-			0.9929448275919686,
-			0.9929241168305712,
-			0.9929033758229756,
-			0.9928826045698137,
-			0.9928618030717181,
-			0.9928409713293225,
-			0.9928201093432615,
-			0.9927992171141706,
-			0.9927782946426862,
-			0.9927573419294455,
-			0.9927363589750871,
-			0.9927153457802497,
-			0.9926943023455738,
-			0.9926732286717003,
-			0.9926521247592710,
-			0.9926309906089290,
-			0.9926098262213179,
-			0.9925886315970824,
-			0.9925674067368684,
-			0.9925461516413220,
-			0.9925248663110910,
-			0.9925035507468237,
-			0.9924822049491694,
-			0.9924608289187784,
-			0.9924394226563017,
-			0.9924179861623914,
-			0.9923965194377007,
-			0.9923750224828832,
-			0.9923534952985940,
-			0.9923319378854887,
-			0.9923103502442241,
-			0.9922887323754577,
-			0.9922670842798480,
-			0.9922454059580544,
-			0.9922236974107375,
-			0.9922019586385583,
-			0.9921801896421792,
-			0.9921583904222633,
-			0.9921365609794744,
-			0.9921147013144779,
-			0.9920928114279393,
-			0.9920708913205255,
-			0.9920489409929042,
-			0.9920269604457442,
-			0.9920049496797150,
-			0.9919829086954870,
-			0.9919608374937318,
-			0.9919387360751214,
-			0.9919166044403294,
-			0.9918944425900297,
-			0.9918722505248975,
-			0.9918500282456088,
-			0.9918277757528405,
-			0.9918054930472706,
-			0.9917831801295777,
-			0.9917608370004416,
-			0.9917384636605427,
-			0.9917160601105629,
-			0.9916936263511843,
-			0.9916711623830904,
-			0.9916486682069655,
-			0.9916261438234949,
-			0.9916035892333646,
-			0.9915810044372617,
-			0.9915583894358742,
-			0.9915357442298909,
-			0.9915130688200017,
-			0.9914903632068973,
-			0.9914676273912694,
-			0.9914448613738104,
-			0.9914220651552140,
-			0.9913992387361745,
-			0.9913763821173874,
-			0.9913534952995487,
-			0.9913305782833558,
-			0.9913076310695066,
-			0.9912846536587002,
-			0.9912616460516365,
-			0.9912386082490164,
-			0.9912155402515417,
-			0.9911924420599151,
-			0.9911693136748401,
-			0.9911461550970212,
-			0.9911229663271640,
-			0.9910997473659748,
-			0.9910764982141609,
-			0.9910532188724305,
-			0.9910299093414927,
-			0.9910065696220577,
-			0.9909831997148363,
-			0.9909597996205404,
-			0.9909363693398828,
-			0.9909129088735774,
-			0.9908894182223387,
-			0.9908658973868822,
-			0.9908423463679246,
-			0.9908187651661832,
-			0.9907951537823761,
-			0.9907715122172229,
-			0.9907478404714436,
-			0.9907241385457592,
-			0.9907004064408920,
-			0.9906766441575645,
-			0.9906528516965010,
-			0.9906290290584258,
-			0.9906051762440649,
-			0.9905812932541447,
-			0.9905573800893929,
-			0.9905334367505378,
-			0.9905094632383088,
-			0.9904854595534363,
-			0.9904614256966512,
-			0.9904373616686859,
-			0.9904132674702733,
-			0.9903891431021473,
-			0.9903649885650430,
-			0.9903408038596959,
-			0.9903165889868428,
-			0.9902923439472214,
-			0.9902680687415704,
-			0.9902437633706288,
-			0.9902194278351374,
-			0.9901950621358374,
-			0.9901706662734709,
-			0.9901462402487812,
-			0.9901217840625122,
-			0.9900972977154090,
-			0.9900727812082175,
-			0.9900482345416844,
-			0.9900236577165575,
-			0.9899990507335856,
-			0.9899744135935180,
-			0.9899497462971054,
-			0.9899250488450991,
-			0.9899003212382514,
-			0.9898755634773158,
-			0.9898507755630461,
-			0.9898259574961976,
-			0.9898011092775262,
-			0.9897762309077890,
-			0.9897513223877435,
-			0.9897263837181489,
-			0.9897014148997646,
-			0.9896764159333512,
-			0.9896513868196702,
-			0.9896263275594841,
-			0.9896012381535563,
-			0.9895761186026509,
-			0.9895509689075334,
-			0.9895257890689695,
-			0.9895005790877264,
-			0.9894753389645721,
-			0.9894500687002754,
-			0.9894247682956061,
-			0.9893994377513348,
-			0.9893740770682332,
-			0.9893486862470739,
-			0.9893232652886302,
-			0.9892978141936766,
-			0.9892723329629883,
-			0.9892468215973416,
-			0.9892212800975134,
-			0.9891957084642820,
-			0.9891701066984261,
-			0.9891444748007259,
-			0.9891188127719618,
-			0.9890931206129159,
-			0.9890673983243705,
-			0.9890416459071093,
-			0.9890158633619168,
-			0.9889900506895783,
-			0.9889642078908802,
-			0.9889383349666097,
-			0.9889124319175547,
-			0.9888864987445046,
-			0.9888605354482491,
-			0.9888345420295792,
-			0.9888085184892867,
-			0.9887824648281645,
-			0.9887563810470058,
-			0.9887302671466056,
-			0.9887041231277591,
-			0.9886779489912628,
-			0.9886517447379141,
-			0.9886255103685110,
-			0.9885992458838527,
-			0.9885729512847394,
-			0.9885466265719720,
-			0.9885202717463525,
-			0.9884938868086836,
-			0.9884674717597689,
-			0.9884410266004133,
-			0.9884145513314223,
-			0.9883880459536023,
-			0.9883615104677607,
-			0.9883349448747060,
-			0.9883083491752471,
-			0.9882817233701945,
-			0.9882550674603591,
-			0.9882283814465528,
-			0.9882016653295888,
-			0.9881749191102805,
-			0.9881481427894430,
-			0.9881213363678918,
-			0.9880944998464434,
-			0.9880676332259154,
-			0.9880407365071262,
-			0.9880138096908951,
-			0.9879868527780424,
-			0.9879598657693891,
-			0.9879328486657574,
-			0.9879058014679702,
-			0.9878787241768515,
-			0.9878516167932261,
-			0.9878244793179196,
-			0.9877973117517589,
-			0.9877701140955714,
-			0.9877428863501856,
-			0.9877156285164309,
-			0.9876883405951378,
-			0.9876610225871372,
-			0.9876336744932616,
-			0.9876062963143438,
-			0.9875788880512180,
-			0.9875514497047189,
-			0.9875239812756824,
-			0.9874964827649454,
-			0.9874689541733453,
-			0.9874413955017208,
-			0.9874138067509114,
-			0.9873861879217575,
-			0.9873585390151003,
-			0.9873308600317822,
-			0.9873031509726462,
-			0.9872754118385365,
-			0.9872476426302981,
-			0.9872198433487767,
-			0.9871920139948192,
-			0.9871641545692734,
-			0.9871362650729879,
-			0.9871083455068123,
-			0.9870803958715970,
-			0.9870524161681935,
-			0.9870244063974540,
-			0.9869963665602319,
-			0.9869682966573812,
-			0.9869401966897569,
-			0.9869120666582151,
-			0.9868839065636126,
-			0.9868557164068072,
-			0.9868274961886578,
-			0.9867992459100239,
-			0.9867709655717660,
-			0.9867426551747457,
-			0.9867143147198253,
-			0.9866859442078680,
-			0.9866575436397383,
-			0.9866291130163011,
-			0.9866006523384224,
-			0.9865721616069694,
-			0.9865436408228099,
-			0.9865150899868125,
-			0.9864865090998470,
-			0.9864578981627842,
-			0.9864292571764954,
-			0.9864005861418533,
-			0.9863718850597311,
-			0.9863431539310030,
-			0.9863143927565444,
-			0.9862856015372314,
-			0.9862567802739409,
-			0.9862279289675510,
-			0.9861990476189403,
-			0.9861701362289889,
-			0.9861411947985772,
-			0.9861122233285871,
-			0.9860832218199008,
-			0.9860541902734020,
-			0.9860251286899749,
-			0.9859960370705050,
-			0.9859669154158781,
-			0.9859377637269816,
-			0.9859085820047033,
-			0.9858793702499323,
-			0.9858501284635585,
-			0.9858208566464723,
-			0.9857915547995658,
-			0.9857622229237314,
-			0.9857328610198625,
-			0.9857034690888535,
-			0.9856740471316000,
-			0.9856445951489980,
-			0.9856151131419448,
-			0.9855856011113384,
-			0.9855560590580777,
-			0.9855264869830628,
-			0.9854968848871943,
-			0.9854672527713743,
-			0.9854375906365049,
-			0.9854078984834901,
-			0.9853781763132342,
-			0.9853484241266427,
-			0.9853186419246217,
-			0.9852888297080786,
-			0.9852589874779214,
-			0.9852291152350593,
-			0.9851992129804021,
-			0.9851692807148609,
-			0.9851393184393472,
-			0.9851093261547739,
-			0.9850793038620546,
-			0.9850492515621038,
-			0.9850191692558368,
-			0.9849890569441702,
-			0.9849589146280211,
-			0.9849287423083078,
-			0.9848985399859495,
-			0.9848683076618659,
-			0.9848380453369782,
-			0.9848077530122080,
-			0.9847774306884783,
-			0.9847470783667127,
-			0.9847166960478358,
-			0.9846862837327730,
-			0.9846558414224508,
-			0.9846253691177964,
-			0.9845948668197383,
-			0.9845643345292053,
-			0.9845337722471278,
-			0.9845031799744366,
-			0.9844725577120637,
-			0.9844419054609417,
-			0.9844112232220046,
-			0.9843805109961867,
-			0.9843497687844239,
-			0.9843189965876524,
-			0.9842881944068098,
-			0.9842573622428342,
-			0.9842265000966649,
-			0.9841956079692419,
-			0.9841646858615064,
-			0.9841337337744002,
-			0.9841027517088662,
-			0.9840717396658482,
-			0.9840406976462909,
-			0.9840096256511397,
-			0.9839785236813414,
-			0.9839473917378432,
-			0.9839162298215935,
-			0.9838850379335417,
-			0.9838538160746376,
-			0.9838225642458326,
-			0.9837912824480786,
-			0.9837599706823283,
-			0.9837286289495359,
-			0.9836972572506558,
-			0.9836658555866438,
-			0.9836344239584562,
-			0.9836029623670509,
-			0.9835714708133859,
-			0.9835399492984206,
-			0.9835083978231153,
-			0.9834768163884310,
-			0.9834452049953297,
-			0.9834135636447744,
-			0.9833818923377290,
-			0.9833501910751581,
-			0.9833184598580276,
-			0.9832866986873039,
-			0.9832549075639546,
-			0.9832230864889481,
-			0.9831912354632536,
-			0.9831593544878415,
-			0.9831274435636830,
-			0.9830955026917499,
-			0.9830635318730154,
-			0.9830315311084534,
-			0.9829995003990385,
-			0.9829674397457466,
-			0.9829353491495543,
-			0.9829032286114390,
-			0.9828710781323792,
-			0.9828388977133543,
-			0.9828066873553447,
-			0.9827744470593314,
-			0.9827421768262965,
-			0.9827098766572230,
-			0.9826775465530950,
-			0.9826451865148971,
-			0.9826127965436152,
-			0.9825803766402359,
-			0.9825479268057468,
-			0.9825154470411362,
-			0.9824829373473939,
-			0.9824503977255098,
-			0.9824178281764752,
-			0.9823852287012823,
-			0.9823525993009241,
-			0.9823199399763947,
-			0.9822872507286887,
-			0.9822545315588020,
-			0.9822217824677313,
-			0.9821890034564742,
-			0.9821561945260291,
-			0.9821233556773956,
-			0.9820904869115739,
-			0.9820575882295652,
-			0.9820246596323717,
-			0.9819917011209965,
-			0.9819587126964436,
-			0.9819256943597179,
-			0.9818926461118250,
-			0.9818595679537718,
-			0.9818264598865658,
-			0.9817933219112157,
-			0.9817601540287307,
-			0.9817269562401214,
-			0.9816937285463989,
-			0.9816604709485753,
-			0.9816271834476640,
-			0.9815938660446787,
-			0.9815605187406343,
-			0.9815271415365469,
-			0.9814937344334329,
-			0.9814602974323101,
-			0.9814268305341971,
-			0.9813933337401133,
-			0.9813598070510789,
-			0.9813262504681156,
-			0.9812926639922451,
-			0.9812590476244909,
-			0.9812254013658768,
-			0.9811917252174278,
-			0.9811580191801696,
-			0.9811242832551292,
-			0.9810905174433341,
-			0.9810567217458128,
-			0.9810228961635949,
-			0.9809890406977108,
-			0.9809551553491915,
-			0.9809212401190697,
-			0.9808872950083781,
-			0.9808533200181510,
-			0.9808193151494231,
-			0.9807852804032304,
-			0.9807512157806098,
-			0.9807171212825986,
-			0.9806829969102356,
-			0.9806488426645603,
-			0.9806146585466130,
-			0.9805804445574351,
-			0.9805462006980689,
-			0.9805119269695572,
-			0.9804776233729444,
-			0.9804432899092753,
-			0.9804089265795957,
-			0.9803745333849524,
-			0.9803401103263931,
-			0.9803056574049664,
-			0.9802711746217219,
-			0.9802366619777098,
-			0.9802021194739814,
-			0.9801675471115890,
-			0.9801329448915860,
-			0.9800983128150260,
-			0.9800636508829642,
-			0.9800289590964565,
-			0.9799942374565596,
-			0.9799594859643310,
-			0.9799247046208296,
-			0.9798898934271147,
-			0.9798550523842469,
-			0.9798201814932873,
-			0.9797852807552982,
-			0.9797503501713428,
-			0.9797153897424851,
-			0.9796803994697900,
-			0.9796453793543235,
-			0.9796103293971523,
-			0.9795752495993441,
-			0.9795401399619674,
-			0.9795050004860918,
-			0.9794698311727877,
-			0.9794346320231264,
-			0.9793994030381801,
-			0.9793641442190220,
-			0.9793288555667261,
-			0.9792935370823674,
-			0.9792581887670216,
-			0.9792228106217657,
-			0.9791874026476773,
-			0.9791519648458350,
-			0.9791164972173182,
-			0.9790809997632074,
-			0.9790454724845838,
-			0.9790099153825298,
-			0.9789743284581284,
-			0.9789387117124637,
-			0.9789030651466206,
-			0.9788673887616850,
-			0.9788316825587436,
-			0.9787959465388842,
-			0.9787601807031953,
-			0.9787243850527664,
-			0.9786885595886878,
-			0.9786527043120510,
-			0.9786168192239481,
-			0.9785809043254721,
-			0.9785449596177173,
-			0.9785089851017784,
-			0.9784729807787514,
-			0.9784369466497330,
-			0.9784008827158209,
-			0.9783647889781136,
-			0.9783286654377106,
-			0.9782925120957123,
-			0.9782563289532200,
-			0.9782201160113360,
-			0.9781838732711631,
-			0.9781476007338057,
-			0.9781112984003684,
-			0.9780749662719572,
-			0.9780386043496789,
-			0.9780022126346410,
-			0.9779657911279522,
-			0.9779293398307218,
-			0.9778928587440603,
-			0.9778563478690789,
-			0.9778198072068899,
-			0.9777832367586061,
-			0.9777466365253419,
-			0.9777100065082119,
-			0.9776733467083322,
-			0.9776366571268191,
-			0.9775999377647907,
-			0.9775631886233652,
-			0.9775264097036622,
-			0.9774896010068019,
-			0.9774527625339058,
-			0.9774158942860959,
-			0.9773789962644952,
-			0.9773420684702279,
-			0.9773051109044187,
-			0.9772681235681935,
-			0.9772311064626789,
-			0.9771940595890025,
-			0.9771569829482930,
-			0.9771198765416796,
-			0.9770827403702927,
-			0.9770455744352636,
-			0.9770083787377244,
-			0.9769711532788081,
-			0.9769338980596487,
-			0.9768966130813810,
-			0.9768592983451408,
-			0.9768219538520648,
-			0.9767845796032907,
-			0.9767471755999566,
-			0.9767097418432024,
-			0.9766722783341679,
-			0.9766347850739946,
-			0.9765972620638246,
-			0.9765597093048008,
-			0.9765221267980673,
-			0.9764845145447686,
-			0.9764468725460508,
-			0.9764092008030604,
-			0.9763714993169449,
-			0.9763337680888527,
-			0.9762960071199334,
-			0.9762582164113370,
-			0.9762203959642148,
-			0.9761825457797189,
-			0.9761446658590023,
-			0.9761067562032187,
-			0.9760688168135231,
-			0.9760308476910711,
-			0.9759928488370193,
-			0.9759548202525252,
-			0.9759167619387474,
-			0.9758786738968450,
-			0.9758405561279784,
-			0.9758024086333085,
-			0.9757642314139975,
-			0.9757260244712084,
-			0.9756877878061050,
-			0.9756495214198520,
-			0.9756112253136150,
-			0.9755728994885607,
-			0.9755345439458566,
-			0.9754961586866709,
-			0.9754577437121731,
-			0.9754192990235332,
-			0.9753808246219224,
-			0.9753423205085127,
-			0.9753037866844769,
-			0.9752652231509890,
-			0.9752266299092234,
-			0.9751880069603560,
-			0.9751493543055633,
-			0.9751106719460225,
-			0.9750719598829122,
-			0.9750332181174115,
-			0.9749944466507005,
-			0.9749556454839604,
-			0.9749168146183730,
-			0.9748779540551212,
-			0.9748390637953889,
-			0.9748001438403605,
-			0.9747611941912218,
-			0.9747222148491591,
-			0.9746832058153599,
-			0.9746441670910125,
-			0.9746050986773060,
-			0.9745660005754306,
-			0.9745268727865771,
-			0.9744877153119377,
-			0.9744485281527049,
-			0.9744093113100725,
-			0.9743700647852352,
-			0.9743307885793885,
-			0.9742914826937288,
-			0.9742521471294534,
-			0.9742127818877605,
-			0.9741733869698493,
-			0.9741339623769198,
-			0.9740945081101731,
-			0.9740550241708108,
-			0.9740155105600358,
-			0.9739759672790517,
-			0.9739363943290630,
-			0.9738967917112752,
-			0.9738571594268948,
-			0.9738174974771289,
-			0.9737778058631857,
-			0.9737380845862744,
-			0.9736983336476048,
-			0.9736585530483880,
-			0.9736187427898355,
-			0.9735789028731603,
-			0.9735390332995757,
-			0.9734991340702964,
-			0.9734592051865377,
-			0.9734192466495161,
-			0.9733792584604485,
-			0.9733392406205531,
-			0.9732991931310491,
-			0.9732591159931562,
-			0.9732190092080953,
-			0.9731788727770883,
-			0.9731387067013575,
-			0.9730985109821265,
-			0.9730582856206200,
-			0.9730180306180630,
-			0.9729777459756820,
-			0.9729374316947040,
-			0.9728970877763570,
-			0.9728567142218701,
-			0.9728163110324730,
-			0.9727758782093966,
-			0.9727354157538723,
-			0.9726949236671331,
-			0.9726544019504120,
-			0.9726138506049435,
-			0.9725732696319630,
-			0.9725326590327066,
-			0.9724920188084113,
-			0.9724513489603152,
-			0.9724106494896569,
-			0.9723699203976766,
-			0.9723291616856147,
-			0.9722883733547127,
-			0.9722475554062133,
-			0.9722067078413599,
-			0.9721658306613966,
-			0.9721249238675687,
-			0.9720839874611222,
-			0.9720430214433043,
-			0.9720020258153627,
-			0.9719610005785463,
-			0.9719199457341047,
-			0.9718788612832885,
-			0.9718377472273494,
-			0.9717966035675396,
-			0.9717554303051126,
-			0.9717142274413223,
-			0.9716729949774241,
-			0.9716317329146740,
-			0.9715904412543287,
-			0.9715491199976461,
-			0.9715077691458851,
-			0.9714663887003051,
-			0.9714249786621668,
-			0.9713835390327314,
-			0.9713420698132614,
-			0.9713005710050200,
-			0.9712590426092713,
-			0.9712174846272803,
-			0.9711758970603129,
-			0.9711342799096361,
-			0.9710926331765174,
-			0.9710509568622256,
-			0.9710092509680301,
-			0.9709675154952015,
-			0.9709257504450111,
-			0.9708839558187310,
-			0.9708421316176344,
-			0.9708002778429954,
-			0.9707583944960889,
-			0.9707164815781908,
-			0.9706745390905777,
-			0.9706325670345273,
-			0.9705905654113183,
-			0.9705485342222299,
-			0.9705064734685425,
-			0.9704643831515374,
-			0.9704222632724968,
-			0.9703801138327036,
-			0.9703379348334419,
-			0.9702957262759965,
-			0.9702534881616530,
-			0.9702112204916983,
-			0.9701689232674198,
-			0.9701265964901058,
-			0.9700842401610460,
-			0.9700418542815303,
-			0.9699994388528501,
-			0.9699569938762973,
-			0.9699145193531650,
-			0.9698720152847468,
-			0.9698294816723376,
-			0.9697869185172331,
-			0.9697443258207298,
-			0.9697017035841251,
-			0.9696590518087175,
-			0.9696163704958060,
-			0.9695736596466910,
-			0.9695309192626732,
-			0.9694881493450549,
-			0.9694453498951389,
-			0.9694025209142287,
-			0.9693596624036293,
-			0.9693167743646459,
-			0.9692738567985852,
-			0.9692309097067544,
-			0.9691879330904618,
-			0.9691449269510165,
-			0.9691018912897286,
-			0.9690588261079089,
-			0.9690157314068695,
-			0.9689726071879230,
-			0.9689294534523829,
-			0.9688862702015639,
-			0.9688430574367816,
-			0.9687998151593519,
-			0.9687565433705924,
-			0.9687132420718210,
-			0.9686699112643569,
-			0.9686265509495200,
-			0.9685831611286311,
-			0.9685397418030119,
-			0.9684962929739851,
-			0.9684528146428742,
-			0.9684093068110037,
-			0.9683657694796987,
-			0.9683222026502856,
-			0.9682786063240915,
-			0.9682349805024444,
-			0.9681913251866732,
-			0.9681476403781077,
-			0.9681039260780788,
-			0.9680601822879179,
-			0.9680164090089576,
-			0.9679726062425312,
-			0.9679287739899732,
-			0.9678849122526186,
-			0.9678410210318038,
-			0.9677971003288655,
-			0.9677531501451416,
-			0.9677091704819712,
-			0.9676651613406938,
-			0.9676211227226499,
-			0.9675770546291812,
-			0.9675329570616299,
-			0.9674888300213395,
-			0.9674446735096540,
-			0.9674004875279185,
-			0.9673562720774791,
-			0.9673120271596826,
-			0.9672677527758768,
-			0.9672234489274103,
-			0.9671791156156329,
-			0.9671347528418948,
-			0.9670903606075474,
-			0.9670459389139432,
-			0.9670014877624351,
-			0.9669570071543773,
-			0.9669124970911246,
-			0.9668679575740331,
-			0.9668233886044594,
-			0.9667787901837611,
-			0.9667341623132969,
-			0.9666895049944262,
-			0.9666448182285092,
-			0.9666001020169073,
-			0.9665553563609826,
-			0.9665105812620980,
-			0.9664657767216176,
-			0.9664209427409062,
-			0.9663760793213293,
-			0.9663311864642539,
-			0.9662862641710471,
-			0.9662413124430776,
-			0.9661963312817148,
-			0.9661513206883285,
-			0.9661062806642902,
-			0.9660612112109715,
-			0.9660161123297457,
-			0.9659709840219864,
-			0.9659258262890683,
-			0.9658806391323670,
-			0.9658354225532588,
-			0.9657901765531215,
-			0.9657449011333329,
-			0.9656995962952725,
-			0.9656542620403202,
-			0.9656088983698570,
-			0.9655635052852647,
-			0.9655180827879262,
-			0.9654726308792251,
-			0.9654271495605458,
-			0.9653816388332739,
-			0.9653360986987957,
-			0.9652905291584983,
-			0.9652449302137701,
-			0.9651993018659999,
-			0.9651536441165777,
-			0.9651079569668942,
-			0.9650622404183413,
-			0.9650164944723114,
-			0.9649707191301983,
-			0.9649249143933961,
-			0.9648790802633002,
-			0.9648332167413068,
-			0.9647873238288130,
-			0.9647414015272168,
-			0.9646954498379169,
-			0.9646494687623133,
-			0.9646034583018065,
-			0.9645574184577981,
-			0.9645113492316906,
-			0.9644652506248873,
-			0.9644191226387925,
-			0.9643729652748113,
-			0.9643267785343497,
-			0.9642805624188147,
-			0.9642343169296140,
-			0.9641880420681566,
-			0.9641417378358517,
-			0.9640954042341101,
-			0.9640490412643432,
-			0.9640026489279632,
-			0.9639562272263832,
-			0.9639097761610175,
-			0.9638632957332810,
-			0.9638167859445895,
-			0.9637702467963598,
-			0.9637236782900097,
-			0.9636770804269577,
-			0.9636304532086230,
-			0.9635837966364262,
-			0.9635371107117885,
-			0.9634903954361321,
-			0.9634436508108799,
-			0.9633968768374559,
-			0.9633500735172849,
-			0.9633032408517925,
-			0.9632563788424054,
-			0.9632094874905512,
-			0.9631625667976582,
-			0.9631156167651556,
-			0.9630686373944737,
-			0.9630216286870436,
-			0.9629745906442970,
-			0.9629275232676672,
-			0.9628804265585876,
-			0.9628333005184930,
-			0.9627861451488189,
-			0.9627389604510017,
-			0.9626917464264788,
-			0.9626445030766884,
-			0.9625972304030695,
-			0.9625499284070623,
-			0.9625025970901077,
-			0.9624552364536473,
-			0.9624078464991239,
-			0.9623604272279811,
-			0.9623129786416633,
-			0.9622655007416160,
-			0.9622179935292854,
-			0.9621704570061185,
-			0.9621228911735635,
-			0.9620752960330694,
-			0.9620276715860859,
-			0.9619800178340637,
-			0.9619323347784546,
-			0.9618846224207109,
-			0.9618368807622861,
-			0.9617891098046345,
-			0.9617413095492113,
-			0.9616934799974726,
-			0.9616456211508753,
-			0.9615977330108773,
-			0.9615498155789373,
-			0.9615018688565149,
-			0.9614538928450708,
-			0.9614058875460664,
-			0.9613578529609640,
-			0.9613097890912268,
-			0.9612616959383189,
-			0.9612135735037053,
-			0.9611654217888519,
-			0.9611172407952255,
-			0.9610690305242938,
-			0.9610207909775255,
-			0.9609725221563896,
-			0.9609242240623570,
-			0.9608758966968985,
-			0.9608275400614866,
-			0.9607791541575941,
-			0.9607307389866950,
-			0.9606822945502641,
-			0.9606338208497771,
-			0.9605853178867105,
-			0.9605367856625420,
-			0.9604882241787498,
-			0.9604396334368132,
-			0.9603910134382123,
-			0.9603423641844283,
-			0.9602936856769431,
-			0.9602449779172394,
-			0.9601962409068011,
-			0.9601474746471127,
-			0.9600986791396597,
-			0.9600498543859287,
-			0.9600010003874067,
-			0.9599521171455820,
-			0.9599032046619437,
-			0.9598542629379817,
-			0.9598052919751869,
-			0.9597562917750511,
-			0.9597072623390667,
-			0.9596582036687274,
-			0.9596091157655277,
-			0.9595599986309626,
-			0.9595108522665287,
-			0.9594616766737227,
-			0.9594124718540429,
-			0.9593632378089878,
-			0.9593139745400575,
-			0.9592646820487525,
-			0.9592153603365743,
-			0.9591660094050254,
-			0.9591166292556090,
-			0.9590672198898296,
-			0.9590177813091918,
-			0.9589683135152021,
-			0.9589188165093669,
-			0.9588692902931945,
-			0.9588197348681931,
-			0.9587701502358723,
-			0.9587205363977428,
-			0.9586708933553157,
-			0.9586212211101034,
-			0.9585715196636188,
-			0.9585217890173758,
-			0.9584720291728897,
-			0.9584222401316760,
-			0.9583724218952513,
-			0.9583225744651332,
-			0.9582726978428403,
-			0.9582227920298917,
-			0.9581728570278079,
-			0.9581228928381096,
-			0.9580728994623192,
-			0.9580228769019593,
-			0.9579728251585539,
-			0.9579227442336274,
-			0.9578726341287056,
-			0.9578224948453149,
-			0.9577723263849826,
-			0.9577221287492368,
-			0.9576719019396066,
-			0.9576216459576222,
-			0.9575713608048144,
-			0.9575210464827150,
-			0.9574707029928565,
-			0.9574203303367727,
-			0.9573699285159978,
-			0.9573194975320672,
-			0.9572690373865173,
-			0.9572185480808849,
-			0.9571680296167082,
-			0.9571174819955262,
-			0.9570669052188783,
-			0.9570162992883053,
-			0.9569656642053489,
-			0.9569149999715514,
-			0.9568643065884562,
-			0.9568135840576074,
-			0.9567628323805502,
-			0.9567120515588305,
-			0.9566612415939952,
-			0.9566104024875921,
-			0.9565595342411698,
-			0.9565086368562778,
-			0.9564577103344667,
-			0.9564067546772876,
-			0.9563557698862929,
-			0.9563047559630354,
-			0.9562537129090695,
-			0.9562026407259495,
-			0.9561515394152317,
-			0.9561004089784724,
-			0.9560492494172291,
-			0.9559980607330605,
-			0.9559468429275255,
-			0.9558955960021847,
-			0.9558443199585989,
-			0.9557930147983301,
-			0.9557416805229412,
-			0.9556903171339959,
-			0.9556389246330589,
-			0.9555875030216955,
-			0.9555360523014722,
-			0.9554845724739565,
-			0.9554330635407161,
-			0.9553815255033205,
-			0.9553299583633393,
-			0.9552783621223436,
-			0.9552267367819051,
-			0.9551750823435960,
-			0.9551233988089903,
-			0.9550716861796621,
-			0.9550199444571866,
-			0.9549681736431401,
-			0.9549163737390997,
-			0.9548645447466430,
-			0.9548126866673490,
-			0.9547607995027975,
-			0.9547088832545688,
-			0.9546569379242446,
-			0.9546049635134071,
-			0.9545529600236397,
-			0.9545009274565261,
-			0.9544488658136520,
-			0.9543967750966026,
-			0.9543446553069651,
-			0.9542925064463270,
-			0.9542403285162768,
-			0.9541881215184042,
-			0.9541358854542992,
-			0.9540836203255531,
-			0.9540313261337580,
-			0.9539790028805069,
-			0.9539266505673936,
-			0.9538742691960129,
-			0.9538218587679603,
-			0.9537694192848326,
-			0.9537169507482269,
-			0.9536644531597417,
-			0.9536119265209759,
-			0.9535593708335299,
-			0.9535067860990044,
-			0.9534541723190012,
-			0.9534015294951232,
-			0.9533488576289738,
-			0.9532961567221576,
-			0.9532434267762799,
-			0.9531906677929470,
-			0.9531378797737660,
-			0.9530850627203449,
-			0.9530322166342925,
-			0.9529793415172189,
-			0.9529264373707343,
-			0.9528735041964507,
-			0.9528205419959803,
-			0.9527675507709366,
-			0.9527145305229334,
-			0.9526614812535863,
-			0.9526084029645109,
-			0.9525552956573243,
-			0.9525021593336441,
-			0.9524489939950889,
-			0.9523957996432784,
-			0.9523425762798328,
-			0.9522893239063733,
-			0.9522360425245224,
-			0.9521827321359029,
-			0.9521293927421387,
-			0.9520760243448547,
-			0.9520226269456766,
-			0.9519692005462309,
-			0.9519157451481453,
-			0.9518622607530478,
-			0.9518087473625678,
-			0.9517552049783354,
-			0.9517016336019817,
-			0.9516480332351382,
-			0.9515944038794382,
-			0.9515407455365150,
-			0.9514870582080032,
-			0.9514333418955382,
-			0.9513795966007562,
-			0.9513258223252946,
-			0.9512720190707913,
-			0.9512181868388854,
-			0.9511643256312163,
-			0.9511104354494253,
-			0.9510565162951535,
-			0.9510025681700437,
-			0.9509485910757391,
-			0.9508945850138839,
-			0.9508405499861233,
-			0.9507864859941033,
-			0.9507323930394708,
-			0.9506782711238735,
-			0.9506241202489600,
-			0.9505699404163800,
-			0.9505157316277837,
-			0.9504614938848226,
-			0.9504072271891487,
-			0.9503529315424153,
-			0.9502986069462761,
-			0.9502442534023859,
-			0.9501898709124007,
-			0.9501354594779767,
-			0.9500810191007717,
-			0.9500265497824439,
-			0.9499720515246525,
-			0.9499175243290576,
-			0.9498629681973204,
-			0.9498083831311025,
-			0.9497537691320669,
-			0.9496991262018770,
-			0.9496444543421975,
-			0.9495897535546937,
-			0.9495350238410318,
-			0.9494802652028792,
-			0.9494254776419039,
-			0.9493706611597746,
-			0.9493158157581613,
-			0.9492609414387346,
-			0.9492060382031662,
-			0.9491511060531284,
-			0.9490961449902946,
-			0.9490411550163390,
-			0.9489861361329366,
-			0.9489310883417635,
-			0.9488760116444965,
-			0.9488209060428134,
-			0.9487657715383927,
-			0.9487106081329140,
-			0.9486554158280575,
-			0.9486001946255046,
-			0.9485449445269375,
-			0.9484896655340390,
-			0.9484343576484932,
-			0.9483790208719848,
-			0.9483236552061993,
-			0.9482682606528235,
-			0.9482128372135447,
-			0.9481573848900511,
-			0.9481019036840320,
-			0.9480463935971775,
-			0.9479908546311783,
-			0.9479352867877264,
-			0.9478796900685145,
-			0.9478240644752361,
-			0.9477684100095857,
-			0.9477127266732586,
-			0.9476570144679510,
-			0.9476012733953600,
-			0.9475455034571837,
-			0.9474897046551207,
-			0.9474338769908710,
-			0.9473780204661350,
-			0.9473221350826142,
-			0.9472662208420111,
-			0.9472102777460288,
-			0.9471543057963716,
-			0.9470983049947443,
-			0.9470422753428529,
-			0.9469862168424041,
-			0.9469301294951057,
-			0.9468740133026660,
-			0.9468178682667945,
-			0.9467616943892014,
-			0.9467054916715981,
-			0.9466492601156964,
-			0.9465929997232092,
-			0.9465367104958504,
-			0.9464803924353345,
-			0.9464240455433774,
-			0.9463676698216952,
-			0.9463112652720053,
-			0.9462548318960258,
-			0.9461983696954759,
-			0.9461418786720754,
-			0.9460853588275453,
-			0.9460288101636072,
-			0.9459722326819836,
-			0.9459156263843980,
-			0.9458589912725747,
-			0.9458023273482390,
-			0.9457456346131168,
-			0.9456889130689352,
-			0.9456321627174221,
-			0.9455753835603061,
-			0.9455185755993168,
-			0.9454617388361847,
-			0.9454048732726411,
-			0.9453479789104183,
-			0.9452910557512494,
-			0.9452341037968682,
-			0.9451771230490098,
-			0.9451201135094098,
-			0.9450630751798048,
-			0.9450060080619324,
-			0.9449489121575309,
-			0.9448917874683395,
-			0.9448346339960982,
-			0.9447774517425483,
-			0.9447202407094315,
-			0.9446630008984905,
-			0.9446057323114690,
-			0.9445484349501115,
-			0.9444911088161634,
-			0.9444337539113709,
-			0.9443763702374811,
-			0.9443189577962420,
-			0.9442615165894026,
-			0.9442040466187126,
-			0.9441465478859227,
-			0.9440890203927842,
-			0.9440314641410498,
-			0.9439738791324724,
-			0.9439162653688065,
-			0.9438586228518069,
-			0.9438009515832294,
-			0.9437432515648311,
-			0.9436855227983694,
-			0.9436277652856028,
-			0.9435699790282908,
-			0.9435121640281936,
-			0.9434543202870724,
-			0.9433964478066892,
-			0.9433385465888069,
-			0.9432806166351893,
-			0.9432226579476010,
-			0.9431646705278075,
-			0.9431066543775752,
-			0.9430486094986715,
-			0.9429905358928645,
-			0.9429324335619231,
-			0.9428743025076173,
-			0.9428161427317179,
-			0.9427579542359964,
-			0.9426997370222254,
-			0.9426414910921784,
-			0.9425832164476295,
-			0.9425249130903541,
-			0.9424665810221280,
-			0.9424082202447281,
-			0.9423498307599323,
-			0.9422914125695191,
-			0.9422329656752682,
-			0.9421744900789598,
-			0.9421159857823752,
-			0.9420574527872967,
-			0.9419988910955073,
-			0.9419403007087906,
-			0.9418816816289317,
-			0.9418230338577162,
-			0.9417643573969303,
-			0.9417056522483618,
-			0.9416469184137987,
-			0.9415881558950302,
-			0.9415293646938463,
-			0.9414705448120380,
-			0.9414116962513968,
-			0.9413528190137156,
-			0.9412939131007877,
-			0.9412349785144076,
-			0.9411760152563706,
-			0.9411170233284727,
-			0.9410580027325109,
-			0.9409989534702832,
-			0.9409398755435882,
-			0.9408807689542255,
-			0.9408216337039956,
-			0.9407624697947001,
-			0.9407032772281410,
-			0.9406440560061214,
-			0.9405848061304454,
-			0.9405255276029177,
-			0.9404662204253442,
-			0.9404068845995315,
-			0.9403475201272870,
-			0.9402881270104189,
-			0.9402287052507367,
-			0.9401692548500502,
-			0.9401097758101706,
-			0.9400502681329097,
-			0.9399907318200801,
-			0.9399311668734955,
-			0.9398715732949703,
-			0.9398119510863197,
-			0.9397523002493601,
-			0.9396926207859084,
-			0.9396329126977827,
-			0.9395731759868017,
-			0.9395134106547851,
-			0.9394536167035534,
-			0.9393937941349282,
-			0.9393339429507317,
-			0.9392740631527871,
-			0.9392141547429184,
-			0.9391542177229504,
-			0.9390942520947091,
-			0.9390342578600211,
-			0.9389742350207139,
-			0.9389141835786159,
-			0.9388541035355563,
-			0.9387939948933653,
-			0.9387338576538741,
-			0.9386736918189142,
-			0.9386134973903187,
-			0.9385532743699212,
-			0.9384930227595559,
-			0.9384327425610585,
-			0.9383724337762650,
-			0.9383120964070126,
-			0.9382517304551394,
-			0.9381913359224842,
-			0.9381309128108865,
-			0.9380704611221872,
-			0.9380099808582275,
-			0.9379494720208500,
-			0.9378889346118976,
-			0.9378283686332147,
-			0.9377677740866460,
-			0.9377071509740375,
-			0.9376464992972356,
-			0.9375858190580882,
-			0.9375251102584435,
-			0.9374643729001509,
-			0.9374036069850605,
-			0.9373428125150235,
-			0.9372819894918915,
-			0.9372211379175175,
-			0.9371602577937551,
-			0.9370993491224588,
-			0.9370384119054840,
-			0.9369774461446870,
-			0.9369164518419248,
-			0.9368554289990555,
-			0.9367943776179378,
-			0.9367332977004317,
-			0.9366721892483977,
-			0.9366110522636970,
-			0.9365498867481924,
-			0.9364886927037467,
-			0.9364274701322243,
-			0.9363662190354899,
-			0.9363049394154094,
-			0.9362436312738495,
-			0.9361822946126778,
-			0.9361209294337626,
-			0.9360595357389733,
-			0.9359981135301800,
-			0.9359366628092538,
-			0.9358751835780664,
-			0.9358136758384908,
-			0.9357521395924006,
-			0.9356905748416702,
-			0.9356289815881750,
-			0.9355673598337912,
-			0.9355057095803960,
-			0.9354440308298673,
-			0.9353823235840840,
-			0.9353205878449258,
-			0.9352588236142733,
-			0.9351970308940077,
-			0.9351352096860117,
-			0.9350733599921682,
-			0.9350114818143614,
-			0.9349495751544762,
-			0.9348876400143984,
-			0.9348256763960144,
-			0.9347636843012121,
-			0.9347016637318797,
-			0.9346396146899064,
-			0.9345775371771824,
-			0.9345154311955987,
-			0.9344532967470471,
-			0.9343911338334203,
-			0.9343289424566120,
-			0.9342667226185166,
-			0.9342044743210295,
-			0.9341421975660468,
-			0.9340798923554655,
-			0.9340175586911836,
-			0.9339551965751001,
-			0.9338928060091143,
-			0.9338303869951268,
-			0.9337679395350391,
-			0.9337054636307536,
-			0.9336429592841731,
-			0.9335804264972017,
-			0.9335178652717444,
-			0.9334552756097069,
-			0.9333926575129956,
-			0.9333300109835181,
-			0.9332673360231827,
-			0.9332046326338985,
-			0.9331419008175759,
-			0.9330791405761253,
-			0.9330163519114588,
-			0.9329535348254890,
-			0.9328906893201295,
-			0.9328278153972945,
-			0.9327649130588994,
-			0.9327019823068603,
-			0.9326390231430941,
-			0.9325760355695187,
-			0.9325130195880528,
-			0.9324499752006160,
-			0.9323869024091287,
-			0.9323238012155122,
-			0.9322606716216887,
-			0.9321975136295813,
-			0.9321343272411138,
-			0.9320711124582109,
-			0.9320078692827986,
-			0.9319445977168028,
-			0.9318812977621515,
-			0.9318179694207724,
-			0.9317546126945950,
-			0.9316912275855489,
-			0.9316278140955653,
-			0.9315643722265755,
-			0.9315009019805123,
-			0.9314374033593090,
-			0.9313738763649000,
-			0.9313103209992203,
-			0.9312467372642059,
-			0.9311831251617939,
-			0.9311194846939218,
-			0.9310558158625283,
-			0.9309921186695529,
-			0.9309283931169358,
-			0.9308646392066182,
-			0.9308008569405423,
-			0.9307370463206508,
-			0.9306732073488878,
-			0.9306093400271976,
-			0.9305454443575261,
-			0.9304815203418192,
-			0.9304175679820246,
-			0.9303535872800900,
-			0.9302895782379647,
-			0.9302255408575982,
-			0.9301614751409415,
-			0.9300973810899460,
-			0.9300332587065641,
-			0.9299691079927491,
-			0.9299049289504552,
-			0.9298407215816373,
-			0.9297764858882515,
-			0.9297122218722541,
-			0.9296479295356032,
-			0.9295836088802568,
-			0.9295192599081745,
-			0.9294548826213165,
-			0.9293904770216437,
-			0.9293260431111180,
-			0.9292615808917024,
-			0.9291970903653602,
-			0.9291325715340562,
-			0.9290680243997554,
-			0.9290034489644244,
-			0.9289388452300301,
-			0.9288742131985405,
-			0.9288095528719242,
-			0.9287448642521511,
-			0.9286801473411918,
-			0.9286154021410173,
-			0.9285506286536003,
-			0.9284858268809135,
-			0.9284209968249313,
-			0.9283561384876281,
-			0.9282912518709799,
-			0.9282263369769633,
-			0.9281613938075555,
-			0.9280964223647349,
-			0.9280314226504806,
-			0.9279663946667727,
-			0.9279013384155919,
-			0.9278362538989200,
-			0.9277711411187396,
-			0.9277060000770342,
-			0.9276408307757882,
-			0.9275756332169864,
-			0.9275104074026151,
-			0.9274451533346613,
-			0.9273798710151125,
-			0.9273145604459575,
-			0.9272492216291857,
-			0.9271838545667874,
-			0.9271184592607539,
-			0.9270530357130771,
-			0.9269875839257500,
-			0.9269221039007663,
-			0.9268565956401208,
-			0.9267910591458089,
-			0.9267254944198270,
-			0.9266599014641722,
-			0.9265942802808427,
-			0.9265286308718373,
-			0.9264629532391560,
-			0.9263972473847992,
-			0.9263315133107687,
-			0.9262657510190666,
-			0.9261999605116964,
-			0.9261341417906620,
-			0.9260682948579684,
-			0.9260024197156214,
-			0.9259365163656276,
-			0.9258705848099947,
-			0.9258046250507311,
-			0.9257386370898458,
-			0.9256726209293492,
-			0.9256065765712521,
-			0.9255405040175664,
-			0.9254744032703046,
-			0.9254082743314805,
-			0.9253421172031084,
-			0.9252759318872036,
-			0.9252097183857821,
-			0.9251434767008609,
-			0.9250772068344580,
-			0.9250109087885920,
-			0.9249445825652823,
-			0.9248782281665496,
-			0.9248118455944150,
-			0.9247454348509007,
-			0.9246789959380295,
-			0.9246125288578254,
-			0.9245460336123131,
-			0.9244795102035183,
-			0.9244129586334671,
-			0.9243463789041869,
-			0.9242797710177060,
-			0.9242131349760533,
-			0.9241464707812586,
-			0.9240797784353525,
-			0.9240130579403668,
-			0.9239463092983338,
-			0.9238795325112867,
-			0.9238127275812599,
-			0.9237458945102881,
-			0.9236790333004073,
-			0.9236121439536543,
-			0.9235452264720665,
-			0.9234782808576822,
-			0.9234113071125412,
-			0.9233443052386829,
-			0.9232772752381490,
-			0.9232102171129809,
-			0.9231431308652215,
-			0.9230760164969143,
-			0.9230088740101037,
-			0.9229417034068350,
-			0.9228745046891543,
-			0.9228072778591088,
-			0.9227400229187460,
-			0.9226727398701149,
-			0.9226054287152649,
-			0.9225380894562464,
-			0.9224707220951107,
-			0.9224033266339100,
-			0.9223359030746973,
-			0.9222684514195263,
-			0.9222009716704518,
-			0.9221334638295293,
-			0.9220659278988153,
-			0.9219983638803668,
-			0.9219307717762424,
-			0.9218631515885005,
-			0.9217955033192013,
-			0.9217278269704055,
-			0.9216601225441744,
-			0.9215923900425705,
-			0.9215246294676572,
-			0.9214568408214985,
-			0.9213890241061592,
-			0.9213211793237054,
-			0.9212533064762035,
-			0.9211854055657211,
-			0.9211174765943269,
-			0.9210495195640896,
-			0.9209815344770798,
-			0.9209135213353680,
-			0.9208454801410263,
-			0.9207774108961272,
-			0.9207093136027442,
-			0.9206411882629518,
-			0.9205730348788251,
-			0.9205048534524404,
-			0.9204366439858742,
-			0.9203684064812047,
-			0.9203001409405102,
-			0.9202318473658704,
-			0.9201635257593656,
-			0.9200951761230769,
-			0.9200267984590864,
-			0.9199583927694770,
-			0.9198899590563326,
-			0.9198214973217377,
-			0.9197530075677777,
-			0.9196844897965389,
-			0.9196159440101086,
-			0.9195473702105748,
-			0.9194787684000263,
-			0.9194101385805529,
-			0.9193414807542452,
-			0.9192727949231945,
-			0.9192040810894931,
-			0.9191353392552344,
-			0.9190665694225122,
-			0.9189977715934213,
-			0.9189289457700576,
-			0.9188600919545175,
-			0.9187912101488983,
-			0.9187223003552984,
-			0.9186533625758171,
-			0.9185843968125540,
-			0.9185154030676101,
-			0.9184463813430872,
-			0.9183773316410876,
-			0.9183082539637147,
-			0.9182391483130729,
-			0.9181700146912670,
-			0.9181008531004031,
-			0.9180316635425881,
-			0.9179624460199295,
-			0.9178932005345357,
-			0.9178239270885162,
-			0.9177546256839811,
-			0.9176852963230415,
-			0.9176159390078092,
-			0.9175465537403971,
-			0.9174771405229186,
-			0.9174076993574883,
-			0.9173382302462214,
-			0.9172687331912341,
-			0.9171992081946434,
-			0.9171296552585672,
-			0.9170600743851240,
-			0.9169904655764337,
-			0.9169208288346165,
-			0.9168511641617935,
-			0.9167814715600870,
-			0.9167117510316201,
-			0.9166420025785162,
-			0.9165722262029005,
-			0.9165024219068979,
-			0.9164325896926353,
-			0.9163627295622396,
-			0.9162928415178390,
-			0.9162229255615623,
-			0.9161529816955393,
-			0.9160830099219006,
-			0.9160130102427778,
-			0.9159429826603031,
-			0.9158729271766095,
-			0.9158028437938314,
-			0.9157327325141033,
-			0.9156625933395611,
-			0.9155924262723413,
-			0.9155222313145813,
-			0.9154520084684193,
-			0.9153817577359947,
-			0.9153114791194471,
-			0.9152411726209175,
-			0.9151708382425476,
-			0.9151004759864798,
-			0.9150300858548575,
-			0.9149596678498249,
-			0.9148892219735270,
-			0.9148187482281096,
-			0.9147482466157199,
-			0.9146777171385050,
-			0.9146071597986135,
-			0.9145365745981949,
-			0.9144659615393992,
-			0.9143953206243775,
-			0.9143246518552813,
-			0.9142539552342637,
-			0.9141832307634781,
-			0.9141124784450788,
-			0.9140416982812212,
-			0.9139708902740612,
-			0.9139000544257559,
-			0.9138291907384630,
-			0.9137582992143412,
-			0.9136873798555498,
-			0.9136164326642493,
-			0.9135454576426009,
-			0.9134744547927665,
-			0.9134034241169090,
-			0.9133323656171922,
-			0.9132612792957807,
-			0.9131901651548396,
-			0.9131190231965356,
-			0.9130478534230354,
-			0.9129766558365072,
-			0.9129054304391199,
-			0.9128341772330428,
-			0.9127628962204467,
-			0.9126915874035028,
-			0.9126202507843834,
-			0.9125488863652613,
-			0.9124774941483107,
-			0.9124060741357062,
-			0.9123346263296233,
-			0.9122631507322384,
-			0.9121916473457290,
-			0.9121201161722730,
-			0.9120485572140494,
-			0.9119769704732382,
-			0.9119053559520197,
-			0.9118337136525758,
-			0.9117620435770886,
-			0.9116903457277413,
-			0.9116186201067180,
-			0.9115468667162037,
-			0.9114750855583839,
-			0.9114032766354453,
-			0.9113314399495753,
-			0.9112595755029622,
-			0.9111876832977951,
-			0.9111157633362640,
-			0.9110438156205597,
-			0.9109718401528738,
-			0.9108998369353988,
-			0.9108278059703281,
-			0.9107557472598559,
-			0.9106836608061771,
-			0.9106115466114877,
-			0.9105394046779844,
-			0.9104672350078649,
-			0.9103950376033273,
-			0.9103228124665711,
-			0.9102505595997963,
-			0.9101782790052039,
-			0.9101059706849957,
-			0.9100336346413743,
-			0.9099612708765432,
-			0.9098888793927068,
-			0.9098164601920701,
-			0.9097440132768393,
-			0.9096715386492210,
-			0.9095990363114232,
-			0.9095265062656543,
-			0.9094539485141238,
-			0.9093813630590418,
-			0.9093087499026195,
-			0.9092361090470685,
-			0.9091634404946021,
-			0.9090907442474334,
-			0.9090180203077772,
-			0.9089452686778488,
-			0.9088724893598640,
-			0.9087996823560401,
-			0.9087268476685948,
-			0.9086539852997469,
-			0.9085810952517157,
-			0.9085081775267219,
-			0.9084352321269863,
-			0.9083622590547311,
-			0.9082892583121792,
-			0.9082162299015545,
-			0.9081431738250813,
-			0.9080700900849852,
-			0.9079969786834923,
-			0.9079238396228299,
-			0.9078506729052257,
-			0.9077774785329087,
-			0.9077042565081084,
-			0.9076310068330553,
-			0.9075577295099808,
-			0.9074844245411169,
-			0.9074110919286967,
-			0.9073377316749541,
-			0.9072643437821237,
-			0.9071909282524410,
-			0.9071174850881423,
-			0.9070440142914650,
-			0.9069705158646469,
-			0.9068969898099272,
-			0.9068234361295454,
-			0.9067498548257421,
-			0.9066762459007588,
-			0.9066026093568377,
-			0.9065289451962220,
-			0.9064552534211554,
-			0.9063815340338829,
-			0.9063077870366499,
-			0.9062340124317032,
-			0.9061602102212899,
-			0.9060863804076580,
-			0.9060125229930568,
-			0.9059386379797358,
-			0.9058647253699460,
-			0.9057907851659387,
-			0.9057168173699662,
-			0.9056428219842818,
-			0.9055687990111396,
-			0.9054947484527943,
-			0.9054206703115016,
-			0.9053465645895183,
-			0.9052724312891015,
-			0.9051982704125096,
-			0.9051240819620016,
-			0.9050498659398374,
-			0.9049756223482778,
-			0.9049013511895844,
-			0.9048270524660196,
-			0.9047527261798465,
-			0.9046783723333296,
-			0.9046039909287334,
-			0.9045295819683241,
-			0.9044551454543680,
-			0.9043806813891327,
-			0.9043061897748865,
-			0.9042316706138986,
-			0.9041571239084391,
-			0.9040825496607784,
-			0.9040079478731885,
-			0.9039333185479418,
-			0.9038586616873117,
-			0.9037839772935722,
-			0.9037092653689985,
-			0.9036345259158666,
-			0.9035597589364528,
-			0.9034849644330348,
-			0.9034101424078911,
-			0.9033352928633008,
-			0.9032604158015439,
-			0.9031855112249014,
-			0.9031105791356550,
-			0.9030356195360871,
-			0.9029606324284815,
-			0.9028856178151219,
-			0.9028105756982937,
-			0.9027355060802829,
-			0.9026604089633758,
-			0.9025852843498606,
-			0.9025101322420254,
-			0.9024349526421593,
-			0.9023597455525527,
-			0.9022845109754964,
-			0.9022092489132822,
-			0.9021339593682028,
-			0.9020586423425515,
-			0.9019832978386227,
-			0.9019079258587115,
-			0.9018325264051138,
-			0.9017570994801264,
-			0.9016816450860471,
-			0.9016061632251742,
-			0.9015306538998069,
-			0.9014551171122457,
-			0.9013795528647913,
-			0.9013039611597456,
-			0.9012283419994114,
-			0.9011526953860919,
-			0.9010770213220916,
-			0.9010013198097157,
-			0.9009255908512701,
-			0.9008498344490616,
-			0.9007740506053981,
-			0.9006982393225879,
-			0.9006224006029403,
-			0.9005465344487658,
-			0.9004706408623750,
-			0.9003947198460800,
-			0.9003187714021935,
-			0.9002427955330289,
-			0.9001667922409007,
-			0.9000907615281238,
-			0.9000147033970147,
-			0.8999386178498898,
-			0.8998625048890672,
-			0.8997863645168650,
-			0.8997101967356029,
-			0.8996340015476010,
-			0.8995577789551803,
-			0.8994815289606628,
-			0.8994052515663711,
-			0.8993289467746287,
-			0.8992526145877601,
-			0.8991762550080904,
-			0.8990998680379456,
-			0.8990234536796529,
-			0.8989470119355396,
-			0.8988705428079345,
-			0.8987940462991670,
-			0.8987175224115671,
-			0.8986409711474662,
-			0.8985643925091958,
-			0.8984877864990889,
-			0.8984111531194788,
-			0.8983344923727001,
-			0.8982578042610880,
-			0.8981810887869784,
-			0.8981043459527085,
-			0.8980275757606156,
-			0.8979507782130386,
-			0.8978739533123167,
-			0.8977971010607901,
-			0.8977202214608001,
-			0.8976433145146883,
-			0.8975663802247975,
-			0.8974894185934714,
-			0.8974124296230542,
-			0.8973354133158912,
-			0.8972583696743285,
-			0.8971812987007128,
-			0.8971042003973920,
-			0.8970270747667146,
-			0.8969499218110299,
-			0.8968727415326883,
-			0.8967955339340407,
-			0.8967182990174390,
-			0.8966410367852359,
-			0.8965637472397849,
-			0.8964864303834406,
-			0.8964090862185579,
-			0.8963317147474930,
-			0.8962543159726027,
-			0.8961768898962448,
-			0.8960994365207778,
-			0.8960219558485610,
-			0.8959444478819547,
-			0.8958669126233199,
-			0.8957893500750184,
-			0.8957117602394129,
-			0.8956341431188669,
-			0.8955564987157448,
-			0.8954788270324119,
-			0.8954011280712340,
-			0.8953234018345780,
-			0.8952456483248117,
-			0.8951678675443034,
-			0.8950900594954226,
-			0.8950122241805396,
-			0.8949343616020251,
-			0.8948564717622510,
-			0.8947785546635901,
-			0.8947006103084157,
-			0.8946226386991024,
-			0.8945446398380251,
-			0.8944666137275599,
-			0.8943885603700835,
-			0.8943104797679736,
-			0.8942323719236087,
-			0.8941542368393681,
-			0.8940760745176320,
-			0.8939978849607813,
-			0.8939196681711976,
-			0.8938414241512638,
-			0.8937631529033632,
-			0.8936848544298801,
-			0.8936065287331997,
-			0.8935281758157078,
-			0.8934497956797912,
-			0.8933713883278376,
-			0.8932929537622353,
-			0.8932144919853736,
-			0.8931360029996426,
-			0.8930574868074331,
-			0.8929789434111370,
-			0.8929003728131468,
-			0.8928217750158559,
-			0.8927431500216586,
-			0.8926644978329499,
-			0.8925858184521255,
-			0.8925071118815823,
-			0.8924283781237179,
-			0.8923496171809305,
-			0.8922708290556195,
-			0.8921920137501848,
-			0.8921131712670270,
-			0.8920343016085482,
-			0.8919554047771509,
-			0.8918764807752380,
-			0.8917975296052141,
-			0.8917185512694840,
-			0.8916395457704535,
-			0.8915605131105293,
-			0.8914814532921188,
-			0.8914023663176305,
-			0.8913232521894733,
-			0.8912441109100572,
-			0.8911649424817931,
-			0.8910857469070924,
-			0.8910065241883679,
-			0.8909272743280324,
-			0.8908479973285004,
-			0.8907686931921865,
-			0.8906893619215066,
-			0.8906100035188773,
-			0.8905306179867158,
-			0.8904512053274407,
-			0.8903717655434706,
-			0.8902922986372257,
-			0.8902128046111265,
-			0.8901332834675947,
-			0.8900537352090525,
-			0.8899741598379231,
-			0.8898945573566306,
-			0.8898149277675997,
-			0.8897352710732562,
-			0.8896555872760266,
-			0.8895758763783380,
-			0.8894961383826187,
-			0.8894163732912975,
-			0.8893365811068045,
-			0.8892567618315699,
-			0.8891769154680254,
-			0.8890970420186032,
-			0.8890171414857364,
-			0.8889372138718589,
-			0.8888572591794054,
-			0.8887772774108115,
-			0.8886972685685136,
-			0.8886172326549489,
-			0.8885371696725552,
-			0.8884570796237717,
-			0.8883769625110380,
-			0.8882968183367946,
-			0.8882166471034827,
-			0.8881364488135446,
-			0.8880562234694231,
-			0.8879759710735622,
-			0.8878956916284064,
-			0.8878153851364013,
-			0.8877350515999931,
-			0.8876546910216288,
-			0.8875743034037564,
-			0.8874938887488247,
-			0.8874134470592833,
-			0.8873329783375824,
-			0.8872524825861733,
-			0.8871719598075082,
-			0.8870914100040397,
-			0.8870108331782217,
-			0.8869302293325086,
-			0.8868495984693558,
-			0.8867689405912195,
-			0.8866882557005565,
-			0.8866075437998248,
-			0.8865268048914828,
-			0.8864460389779901,
-			0.8863652460618070,
-			0.8862844261453946,
-			0.8862035792312147,
-			0.8861227053217301,
-			0.8860418044194044,
-			0.8859608765267019,
-			0.8858799216460879,
-			0.8857989397800282,
-			0.8857179309309899,
-			0.8856368951014407,
-			0.8855558322938489,
-			0.8854747425106839,
-			0.8853936257544159,
-			0.8853124820275157,
-			0.8852313113324553,
-			0.8851501136717070,
-			0.8850688890477445,
-			0.8849876374630419,
-			0.8849063589200743,
-			0.8848250534213176,
-			0.8847437209692485,
-			0.8846623615663445,
-			0.8845809752150839,
-			0.8844995619179461,
-			0.8844181216774109,
-			0.8843366544959591,
-			0.8842551603760723,
-			0.8841736393202332,
-			0.8840920913309248,
-			0.8840105164106312,
-			0.8839289145618376,
-			0.8838472857870294,
-			0.8837656300886934,
-			0.8836839474693169,
-			0.8836022379313880,
-			0.8835205014773958,
-			0.8834387381098301,
-			0.8833569478311816,
-			0.8832751306439417,
-			0.8831932865506028,
-			0.8831114155536579,
-			0.8830295176556010,
-			0.8829475928589270,
-			0.8828656411661311,
-			0.8827836625797100,
-			0.8827016571021608,
-			0.8826196247359815,
-			0.8825375654836711,
-			0.8824554793477291,
-			0.8823733663306561,
-			0.8822912264349533,
-			0.8822090596631229,
-			0.8821268660176678,
-			0.8820446455010917,
-			0.8819623981158994,
-			0.8818801238645961,
-			0.8817978227496881,
-			0.8817154947736825,
-			0.8816331399390870,
-			0.8815507582484102,
-			0.8814683497041619,
-			0.8813859143088522,
-			0.8813034520649922,
-			0.8812209629750940,
-			0.8811384470416702,
-			0.8810559042672345,
-			0.8809733346543012,
-			0.8808907382053855,
-			0.8808081149230036,
-			0.8807254648096722,
-			0.8806427878679091,
-			0.8805600841002325,
-			0.8804773535091620,
-			0.8803945960972176,
-			0.8803118118669202,
-			0.8802290008207916,
-			0.8801461629613544,
-			0.8800632982911319,
-			0.8799804068126484,
-			0.8798974885284289,
-			0.8798145434409992,
-			0.8797315715528858,
-			0.8796485728666165,
-			0.8795655473847194,
-			0.8794824951097235,
-			0.8793994160441589,
-			0.8793163101905562,
-			0.8792331775514471,
-			0.8791500181293639,
-			0.8790668319268397,
-			0.8789836189464084,
-			0.8789003791906052,
-			0.8788171126619654,
-			0.8787338193630254,
-			0.8786504992963229,
-			0.8785671524643954,
-			0.8784837788697822,
-			0.8784003785150228,
-			0.8783169514026578,
-			0.8782334975352285,
-			0.8781500169152771,
-			0.8780665095453466,
-			0.8779829754279805,
-			0.8778994145657238,
-			0.8778158269611217,
-			0.8777322126167204,
-			0.8776485715350670,
-			0.8775649037187093,
-			0.8774812091701960,
-			0.8773974878920766,
-			0.8773137398869014,
-			0.8772299651572214,
-			0.8771461637055887,
-			0.8770623355345560,
-			0.8769784806466767,
-			0.8768945990445054,
-			0.8768106907305970,
-			0.8767267557075077,
-			0.8766427939777942,
-			0.8765588055440143,
-			0.8764747904087262,
-			0.8763907485744893,
-			0.8763066800438636,
-			0.8762225848194100,
-			0.8761384629036901,
-			0.8760543142992665,
-			0.8759701390087026,
-			0.8758859370345623,
-			0.8758017083794106,
-			0.8757174530458134,
-			0.8756331710363372,
-			0.8755488623535493,
-			0.8754645270000179,
-			0.8753801649783119,
-			0.8752957762910015,
-			0.8752113609406570,
-			0.8751269189298498,
-			0.8750424502611525,
-			0.8749579549371377,
-			0.8748734329603797,
-			0.8747888843334528,
-			0.8747043090589327,
-			0.8746197071393957,
-			0.8745350785774191,
-			0.8744504233755805,
-			0.8743657415364589,
-			0.8742810330626336,
-			0.8741962979566852,
-			0.8741115362211948,
-			0.8740267478587445,
-			0.8739419328719168,
-			0.8738570912632956,
-			0.8737722230354652,
-			0.8736873281910109,
-			0.8736024067325187,
-			0.8735174586625755,
-			0.8734324839837688,
-			0.8733474826986872,
-			0.8732624548099202,
-			0.8731774003200575,
-			0.8730923192316903,
-			0.8730072115474101,
-			0.8729220772698097,
-			0.8728369164014822,
-			0.8727517289450218,
-			0.8726665149030235,
-			0.8725812742780831,
-			0.8724960070727972,
-			0.8724107132897629,
-			0.8723253929315788,
-			0.8722400460008437,
-			0.8721546725001574,
-			0.8720692724321206,
-			0.8719838457993347,
-			0.8718983926044019,
-			0.8718129128499253,
-			0.8717274065385089,
-			0.8716418736727571,
-			0.8715563142552756,
-			0.8714707282886706,
-			0.8713851157755491,
-			0.8712994767185192,
-			0.8712138111201894,
-			0.8711281189831696,
-			0.8710424003100695,
-			0.8709566551035008,
-			0.8708708833660754,
-			0.8707850851004058,
-			0.8706992603091057,
-			0.8706134089947895,
-			0.8705275311600722,
-			0.8704416268075700,
-			0.8703556959398997,
-			0.8702697385596787,
-			0.8701837546695257,
-			0.8700977442720597,
-			0.8700117073699007,
-			0.8699256439656696,
-			0.8698395540619882,
-			0.8697534376614787,
-			0.8696672947667645,
-			0.8695811253804697,
-			0.8694949295052190,
-			0.8694087071436382,
-			0.8693224582983538,
-			0.8692361829719930,
-			0.8691498811671839,
-			0.8690635528865556,
-			0.8689771981327374,
-			0.8688908169083602,
-			0.8688044092160553,
-			0.8687179750584547,
-			0.8686315144381913,
-			0.8685450273578988,
-			0.8684585138202120,
-			0.8683719738277660,
-			0.8682854073831971,
-			0.8681988144891423,
-			0.8681121951482391,
-			0.8680255493631265,
-			0.8679388771364436,
-			0.8678521784708305,
-			0.8677654533689284,
-			0.8676787018333790,
-			0.8675919238668250,
-			0.8675051194719098,
-			0.8674182886512775,
-			0.8673314314075731,
-			0.8672445477434425,
-			0.8671576376615323,
-			0.8670707011644900,
-			0.8669837382549639,
-			0.8668967489356028,
-			0.8668097332090566,
-			0.8667226910779762,
-			0.8666356225450129,
-			0.8665485276128189,
-			0.8664614062840472,
-			0.8663742585613519,
-			0.8662870844473874,
-			0.8661998839448095,
-			0.8661126570562742,
-			0.8660254037844387,
-			0.8659381241319608,
-			0.8658508181014994,
-			0.8657634856957137,
-			0.8656761269172643,
-			0.8655887417688121,
-			0.8655013302530190,
-			0.8654138923725477,
-			0.8653264281300620,
-			0.8652389375282258,
-			0.8651514205697045,
-			0.8650638772571639,
-			0.8649763075932707,
-			0.8648887115806925,
-			0.8648010892220975,
-			0.8647134405201551,
-			0.8646257654775350,
-			0.8645380640969079,
-			0.8644503363809455,
-			0.8643625823323200,
-			0.8642748019537048,
-			0.8641869952477734,
-			0.8640991622172010,
-			0.8640113028646628,
-			0.8639234171928353,
-			0.8638355052043957,
-			0.8637475669020219,
-			0.8636596022883927,
-			0.8635716113661874,
-			0.8634835941380867,
-			0.8633955506067716,
-			0.8633074807749241,
-			0.8632193846452270,
-			0.8631312622203637,
-			0.8630431135030188,
-			0.8629549384958771,
-			0.8628667372016250,
-			0.8627785096229490,
-			0.8626902557625367,
-			0.8626019756230765,
-			0.8625136692072575,
-			0.8624253365177698,
-			0.8623369775573040,
-			0.8622485923285518,
-			0.8621601808342055,
-			0.8620717430769584,
-			0.8619832790595042,
-			0.8618947887845380,
-			0.8618062722547550,
-			0.8617177294728520,
-			0.8616291604415258,
-			0.8615405651634744,
-			0.8614519436413968,
-			0.8613632958779924,
-			0.8612746218759617,
-			0.8611859216380057,
-			0.8610971951668264,
-			0.8610084424651265,
-			0.8609196635356098,
-			0.8608308583809804,
-			0.8607420270039436,
-			0.8606531694072054,
-			0.8605642855934724,
-			0.8604753755654524,
-			0.8603864393258535,
-			0.8602974768773848,
-			0.8602084882227565,
-			0.8601194733646793,
-			0.8600304323058647,
-			0.8599413650490251,
-			0.8598522715968735,
-			0.8597631519521238,
-			0.8596740061174911,
-			0.8595848340956906,
-			0.8594956358894388,
-			0.8594064115014527,
-			0.8593171609344503,
-			0.8592278841911504,
-			0.8591385812742725,
-			0.8590492521865367,
-			0.8589598969306643,
-			0.8588705155093774,
-			0.8587811079253985,
-			0.8586916741814511,
-			0.8586022142802595,
-			0.8585127282245489,
-
-			0.8584232160170451,
-			0.8583336776604750,
-			0.8582441131575658,
-			0.8581545225110460,
-			0.8580649057236445,
-			0.8579752627980914,
-			0.8578855937371174,
-			0.8577958985434537,
-			0.8577061772198328,
-			0.8576164297689877,
-			0.8575266561936523,
-			0.8574368564965611,
-			0.8573470306804498,
-			0.8572571787480545,
-			0.8571673007021123,
-			0.8570773965453610,
-			0.8569874662805392,
-			0.8568975099103865,
-			0.8568075274376429,
-			0.8567175188650497,
-			0.8566274841953484,
-			0.8565374234312818,
-			0.8564473365755934,
-			0.8563572236310272,
-			0.8562670846003282,
-			0.8561769194862423,
-			0.8560867282915161,
-			0.8559965110188970,
-			0.8559062676711330,
-			0.8558159982509732,
-			0.8557257027611674,
-			0.8556353812044660,
-			0.8555450335836207,
-			0.8554546599013831,
-			0.8553642601605067,
-			0.8552738343637448,
-			0.8551833825138522,
-			0.8550929046135840,
-			0.8550024006656965,
-			0.8549118706729466,
-			0.8548213146380919,
-			0.8547307325638910,
-			0.8546401244531030,
-			0.8545494903084883,
-			0.8544588301328074,
-			0.8543681439288222,
-			0.8542774316992952,
-			0.8541866934469895,
-			0.8540959291746693,
-			0.8540051388850991,
-			0.8539143225810450,
-			0.8538234802652731,
-			0.8537326119405507,
-			0.8536417176096459,
-			0.8535507972753275,
-			0.8534598509403648,
-			0.8533688786075285,
-			0.8532778802795897,
-			0.8531868559593203,
-			0.8530958056494932,
-			0.8530047293528817,
-			0.8529136270722604,
-			0.8528224988104043,
-			0.8527313445700894,
-			0.8526401643540923,
-			0.8525489581651905,
-			0.8524577260061625,
-			0.8523664678797872,
-			0.8522751837888447,
-			0.8521838737361154,
-			0.8520925377243808,
-			0.8520011757564233,
-			0.8519097878350260,
-			0.8518183739629726,
-			0.8517269341430477,
-			0.8516354683780367,
-			0.8515439766707259,
-			0.8514524590239023,
-			0.8513609154403536,
-			0.8512693459228684,
-			0.8511777504742362,
-			0.8510861290972470,
-			0.8509944817946918,
-			0.8509028085693624,
-			0.8508111094240512,
-			0.8507193843615516,
-			0.8506276333846576,
-			0.8505358564961644,
-			0.8504440536988672,
-			0.8503522249955628,
-			0.8502603703890484,
-			0.8501684898821222,
-			0.8500765834775827,
-			0.8499846511782299,
-			0.8498926929868640,
-			0.8498007089062861,
-			0.8497086989392985,
-			0.8496166630887036,
-			0.8495246013573055,
-			0.8494325137479080,
-			0.8493404002633166,
-			0.8492482609063371,
-			0.8491560956797763,
-			0.8490639045864417,
-			0.8489716876291414,
-			0.8488794448106849,
-			0.8487871761338818,
-			0.8486948816015428,
-			0.8486025612164793,
-			0.8485102149815037,
-			0.8484178428994288,
-			0.8483254449730687,
-			0.8482330212052377,
-			0.8481405715987514,
-			0.8480480961564260,
-			0.8479555948810783,
-			0.8478630677755261,
-			0.8477705148425880,
-			0.8476779360850832,
-			0.8475853315058320,
-			0.8474927011076552,
-			0.8474000448933744,
-			0.8473073628658121,
-			0.8472146550277917,
-			0.8471219213821372,
-			0.8470291619316732,
-			0.8469363766792256,
-			0.8468435656276208,
-			0.8467507287796856,
-			0.8466578661382484,
-			0.8465649777061378,
-			0.8464720634861833,
-			0.8463791234812154,
-			0.8462861576940650,
-			0.8461931661275640,
-			0.8461001487845453,
-			0.8460071056678422,
-			0.8459140367802890,
-			0.8458209421247207,
-			0.8457278217039733,
-			0.8456346755208832,
-			0.8455415035782878,
-			0.8454483058790254,
-			0.8453550824259349,
-			0.8452618332218562,
-			0.8451685582696296,
-			0.8450752575720964,
-			0.8449819311320990,
-			0.8448885789524799,
-			0.8447952010360832,
-			0.8447017973857530,
-			0.8446083680043347,
-			0.8445149128946743,
-			0.8444214320596185,
-			0.8443279255020152,
-			0.8442343932247123,
-			0.8441408352305593,
-			0.8440472515224061,
-			0.8439536421031033,
-			0.8438600069755025,
-			0.8437663461424559,
-			0.8436726596068168,
-			0.8435789473714388,
-			0.8434852094391766,
-			0.8433914458128857,
-			0.8432976564954222,
-			0.8432038414896432,
-			0.8431100007984065,
-			0.8430161344245705,
-			0.8429222423709944,
-			0.8428283246405387,
-			0.8427343812360640,
-			0.8426404121604323,
-			0.8425464174165056,
-			0.8424523970071476,
-			0.8423583509352219,
-			0.8422642792035938,
-			0.8421701818151284,
-			0.8420760587726923,
-			0.8419819100791527,
-			0.8418877357373774,
-			0.8417935357502353,
-			0.8416993101205957,
-			0.8416050588513290,
-			0.8415107819453062,
-			0.8414164794053991,
-			0.8413221512344804,
-			0.8412277974354234,
-			0.8411334180111025,
-			0.8410390129643924,
-			0.8409445822981692,
-			0.8408501260153088,
-			0.8407556441186892,
-			0.8406611366111880,
-			0.8405666034956844,
-			0.8404720447750577,
-			0.8403774604521884,
-			0.8402828505299580,
-			0.8401882150112483,
-			0.8400935538989418,
-			0.8399988671959226,
-			0.8399041549050745,
-			0.8398094170292829,
-			0.8397146535714336,
-			0.8396198645344132,
-			0.8395250499211091,
-			0.8394302097344098,
-			0.8393353439772041,
-			0.8392404526523817,
-			0.8391455357628332,
-			0.8390505933114502,
-			0.8389556253011243,
-			0.8388606317347488,
-			0.8387656126152172,
-			0.8386705679454241,
-			0.8385754977282646,
-			0.8384804019666345,
-			0.8383852806634310,
-			0.8382901338215515,
-			0.8381949614438942,
-			0.8380997635333584,
-			0.8380045400928439,
-			0.8379092911252514,
-			0.8378140166334822,
-			0.8377187166204388,
-			0.8376233910890241,
-			0.8375280400421417,
-			0.8374326634826964,
-			0.8373372614135934,
-			0.8372418338377390,
-			0.8371463807580397,
-			0.8370509021774037,
-			0.8369553980987390,
-			0.8368598685249551,
-			0.8367643134589616,
-			0.8366687329036698,
-			0.8365731268619909,
-			0.8364774953368374,
-			0.8363818383311223,
-			0.8362861558477596,
-			0.8361904478896637,
-			0.8360947144597503,
-			0.8359989555609354,
-			0.8359031711961362,
-			0.8358073613682703,
-			0.8357115260802562,
-			0.8356156653350134,
-			0.8355197791354618,
-			0.8354238674845224,
-			0.8353279303851168,
-			0.8352319678401673,
-			0.8351359798525972,
-			0.8350399664253304,
-			0.8349439275612918,
-			0.8348478632634065,
-			0.8347517735346013,
-			0.8346556583778029,
-			0.8345595177959393,
-			0.8344633517919392,
-			0.8343671603687317,
-			0.8342709435292471,
-			0.8341747012764164,
-			0.8340784336131711,
-			0.8339821405424440,
-			0.8338858220671682,
-			0.8337894781902776,
-			0.8336931089147072,
-			0.8335967142433924,
-			0.8335002941792699,
-			0.8334038487252763,
-			0.8333073778843497,
-			0.8332108816594290,
-			0.8331143600534535,
-			0.8330178130693633,
-			0.8329212407100994,
-			0.8328246429786038,
-			0.8327280198778189,
-			0.8326313714106879,
-			0.8325346975801550,
-			0.8324379983891649,
-			0.8323412738406634,
-			0.8322445239375968,
-			0.8321477486829125,
-			0.8320509480795582,
-			0.8319541221304826,
-			0.8318572708386353,
-			0.8317603942069665,
-			0.8316634922384272,
-			0.8315665649359693,
-			0.8314696123025452,
-			0.8313726343411085,
-			0.8312756310546132,
-			0.8311786024460142,
-			0.8310815485182671,
-			0.8309844692743283,
-			0.8308873647171551,
-			0.8307902348497055,
-			0.8306930796749382,
-			0.8305958991958127,
-			0.8304986934152891,
-			0.8304014623363289,
-			0.8303042059618937,
-			0.8302069242949459,
-			0.8301096173384491,
-			0.8300122850953675,
-			0.8299149275686658,
-			0.8298175447613098,
-			0.8297201366762659,
-			0.8296227033165013,
-			0.8295252446849841,
-			0.8294277607846831,
-			0.8293302516185675,
-			0.8292327171896079,
-			0.8291351575007754,
-			0.8290375725550416,
-			0.8289399623553795,
-			0.8288423269047619,
-			0.8287446662061634,
-			0.8286469802625588,
-			0.8285492690769237,
-			0.8284515326522346,
-			0.8283537709914688,
-			0.8282559840976041,
-			0.8281581719736195,
-			0.8280603346224944,
-			0.8279624720472092,
-			0.8278645842507446,
-			0.8277666712360829,
-			0.8276687330062065,
-			0.8275707695640988,
-			0.8274727809127438,
-			0.8273747670551266,
-			0.8272767279942328,
-			0.8271786637330488,
-			0.8270805742745618,
-			0.8269824596217599,
-			0.8268843197776317,
-			0.8267861547451668,
-			0.8266879645273554,
-			0.8265897491271886,
-			0.8264915085476583,
-			0.8263932427917569,
-			0.8262949518624778,
-			0.8261966357628152,
-			0.8260982944957639,
-			0.8259999280643195,
-			0.8259015364714786,
-			0.8258031197202382,
-			0.8257046778135964,
-			0.8256062107545517,
-			0.8255077185461037,
-			0.8254092011912527,
-			0.8253106586929996,
-			0.8252120910543462,
-			0.8251134982782952,
-			0.8250148803678496,
-			0.8249162373260137,
-			0.8248175691557924,
-			0.8247188758601912,
-			0.8246201574422163,
-			0.8245214139048751,
-			0.8244226452511754,
-			0.8243238514841258,
-			0.8242250326067359,
-			0.8241261886220157,
-			0.8240273195329763,
-			0.8239284253426292,
-			0.8238295060539873,
-			0.8237305616700635,
-			0.8236315921938719,
-			0.8235325976284275,
-			0.8234335779767454,
-			0.8233345332418424,
-			0.8232354634267353,
-			0.8231363685344419,
-			0.8230372485679809,
-			0.8229381035303718,
-			0.8228389334246344,
-			0.8227397382537900,
-			0.8226405180208598,
-			0.8225412727288666,
-			0.8224420023808334,
-			0.8223427069797843,
-			0.8222433865287437,
-			0.8221440410307375,
-			0.8220446704887916,
-			0.8219452749059332,
-			0.8218458542851899,
-			0.8217464086295903,
-			0.8216469379421637,
-			0.8215474422259401,
-			0.8214479214839504,
-			0.8213483757192261,
-			0.8212488049347997,
-			0.8211492091337040,
-			0.8210495883189731,
-			0.8209499424936416,
-			0.8208502716607449,
-			0.8207505758233189,
-			0.8206508549844007,
-			0.8205511091470281,
-			0.8204513383142393,
-			0.8203515424890736,
-			0.8202517216745709,
-			0.8201518758737721,
-			0.8200520050897184,
-			0.8199521093254523,
-			0.8198521885840167,
-			0.8197522428684553,
-			0.8196522721818125,
-			0.8195522765271338,
-			0.8194522559074653,
-			0.8193522103258536,
-			0.8192521397853463,
-			0.8191520442889918,
-			0.8190519238398392,
-			0.8189517784409381,
-			0.8188516080953395,
-			0.8187514128060945,
-			0.8186511925762552,
-			0.8185509474088748,
-			0.8184506773070065,
-			0.8183503822737049,
-			0.8182500623120252,
-			0.8181497174250234,
-			0.8180493476157561,
-			0.8179489528872805,
-			0.8178485332426552,
-			0.8177480886849389,
-			0.8176476192171913,
-			0.8175471248424730,
-			0.8174466055638452,
-			0.8173460613843699,
-			0.8172454923071099,
-			0.8171448983351285,
-			0.8170442794714903,
-			0.8169436357192599,
-			0.8168429670815034,
-			0.8167422735612874,
-			0.8166415551616790,
-			0.8165408118857462,
-			0.8164400437365580,
-			0.8163392507171839,
-			0.8162384328306943,
-			0.8161375900801602,
-			0.8160367224686536,
-			0.8159358299992467,
-			0.8158349126750134,
-			0.8157339704990274,
-			0.8156330034743637,
-			0.8155320116040982,
-			0.8154309948913068,
-			0.8153299533390670,
-			0.8152288869504566,
-			0.8151277957285542,
-			0.8150266796764394,
-			0.8149255387971921,
-			0.8148243730938934,
-			0.8147231825696251,
-			0.8146219672274693,
-			0.8145207270705094,
-			0.8144194621018294,
-			0.8143181723245139,
-			0.8142168577416484,
-			0.8141155183563192,
-			0.8140141541716133,
-			0.8139127651906181,
-			0.8138113514164224,
-			0.8137099128521155,
-			0.8136084495007870,
-			0.8135069613655280,
-			0.8134054484494300,
-			0.8133039107555852,
-			0.8132023482870864,
-			0.8131007610470277,
-			0.8129991490385033,
-			0.8128975122646088,
-			0.8127958507284401,
-			0.8126941644330939,
-			0.8125924533816679,
-			0.8124907175772602,
-			0.8123889570229701,
-			0.8122871717218972,
-			0.8121853616771422,
-			0.8120835268918062,
-			0.8119816673689916,
-			0.8118797831118009,
-			0.8117778741233377,
-			0.8116759404067064,
-			0.8115739819650123,
-			0.8114719988013610,
-			0.8113699909188590,
-			0.8112679583206137,
-			0.8111659010097334,
-			0.8110638189893267,
-			0.8109617122625032,
-			0.8108595808323735,
-			0.8107574247020485,
-			0.8106552438746399,
-			0.8105530383532606,
-			0.8104508081410240,
-			0.8103485532410439,
-			0.8102462736564353,
-			0.8101439693903140,
-			0.8100416404457961,
-			0.8099392868259987,
-			0.8098369085340400,
-			0.8097345055730383,
-			0.8096320779461130,
-			0.8095296256563844,
-			0.8094271487069733,
-			0.8093246471010014,
-			0.8092221208415907,
-			0.8091195699318648,
-			0.8090169943749475,
-			0.8089143941739632,
-			0.8088117693320374,
-			0.8087091198522962,
-			0.8086064457378666,
-			0.8085037469918760,
-			0.8084010236174531,
-			0.8082982756177268,
-			0.8081955029958271,
-			0.8080927057548845,
-			0.8079898838980305,
-			0.8078870374283973,
-			0.8077841663491175,
-			0.8076812706633250,
-			0.8075783503741540,
-			0.8074754054847399,
-			0.8073724359982183,
-			0.8072694419177260,
-			0.8071664232464003,
-			0.8070633799873793,
-			0.8069603121438019,
-			0.8068572197188079,
-			0.8067541027155374,
-			0.8066509611371315,
-			0.8065477949867325,
-			0.8064446042674827,
-			0.8063413889825254,
-			0.8062381491350047,
-			0.8061348847280657,
-			0.8060315957648539,
-			0.8059282822485158,
-			0.8058249441821983,
-			0.8057215815690493,
-			0.8056181944122175,
-			0.8055147827148520,
-			0.8054113464801034,
-			0.8053078857111219,
-			0.8052044004110597,
-			0.8051008905830688,
-			0.8049973562303023,
-			0.8048937973559142,
-			0.8047902139630588,
-			0.8046866060548917,
-			0.8045829736345691,
-			0.8044793167052474,
-			0.8043756352700845,
-			0.8042719293322386,
-			0.8041681988948688,
-			0.8040644439611346,
-			0.8039606645341971,
-			0.8038568606172174,
-			0.8037530322133573,
-			0.8036491793257798,
-			0.8035453019576485,
-			0.8034414001121276,
-			0.8033374737923821,
-			0.8032335230015778,
-			0.8031295477428813,
-			0.8030255480194598,
-			0.8029215238344812,
-			0.8028174751911146,
-			0.8027134020925291,
-			0.8026093045418952,
-			0.8025051825423838,
-			0.8024010360971665,
-			0.8022968652094161,
-			0.8021926698823056,
-			0.8020884501190091,
-			0.8019842059227013,
-			0.8018799372965575,
-			0.8017756442437540,
-			0.8016713267674678,
-			0.8015669848708766,
-			0.8014626185571587,
-			0.8013582278294935,
-			0.8012538126910607,
-			0.8011493731450411,
-			0.8010449091946159,
-			0.8009404208429677,
-			0.8008359080932790,
-			0.8007313709487334,
-			0.8006268094125157,
-			0.8005222234878107,
-			0.8004176131778042,
-			0.8003129784856831,
-			0.8002083194146346,
-			0.8001036359678468,
-			0.7999989281485086,
-			0.7998941959598094,
-			0.7997894394049397,
-			0.7996846584870906,
-			0.7995798532094537,
-			0.7994750235752218,
-			0.7993701695875880,
-			0.7992652912497464,
-			0.7991603885648918,
-			0.7990554615362198,
-			0.7989505101669265,
-			0.7988455344602089,
-			0.7987405344192648,
-			0.7986355100472928,
-			0.7985304613474921,
-			0.7984253883230624,
-			0.7983202909772047,
-			0.7982151693131203,
-			0.7981100233340114,
-			0.7980048530430810,
-			0.7978996584435328,
-			0.7977944395385711,
-			0.7976891963314009,
-			0.7975839288252285,
-			0.7974786370232604,
-			0.7973733209287036,
-			0.7972679805447667,
-			0.7971626158746583,
-			0.7970572269215881,
-			0.7969518136887662,
-			0.7968463761794039,
-			0.7967409143967130,
-			0.7966354283439061,
-			0.7965299180241963,
-			0.7964243834407977,
-			0.7963188245969252,
-			0.7962132414957940,
-			0.7961076341406207,
-			0.7960020025346221,
-			0.7958963466810159,
-			0.7957906665830206,
-			0.7956849622438554,
-			0.7955792336667403,
-			0.7954734808548959,
-			0.7953677038115436,
-			0.7952619025399057,
-			0.7951560770432049,
-			0.7950502273246648,
-			0.7949443533875100,
-			0.7948384552349654,
-			0.7947325328702571,
-			0.7946265862966114,
-			0.7945206155172557,
-			0.7944146205354181,
-			0.7943086013543273,
-			0.7942025579772131,
-			0.7940964904073053,
-			0.7939903986478354,
-			0.7938842827020347,
-			0.7937781425731359,
-			0.7936719782643724,
-			0.7935657897789777,
-			0.7934595771201869,
-			0.7933533402912352,
-			0.7932470792953588,
-			0.7931407941357945,
-			0.7930344848157802,
-			0.7929281513385541,
-			0.7928217937073552,
-			0.7927154119254235,
-			0.7926090059959996,
-			0.7925025759223246,
-			0.7923961217076407,
-			0.7922896433551907,
-			0.7921831408682181,
-			0.7920766142499671,
-			0.7919700635036826,
-			0.7918634886326106,
-			0.7917568896399974,
-			0.7916502665290899,
-			0.7915436193031365,
-			0.7914369479653858,
-			0.7913302525190870,
-			0.7912235329674900,
-			0.7911167893138462,
-			0.7910100215614070,
-			0.7909032297134245,
-			0.7907964137731521,
-			0.7906895737438434,
-			0.7905827096287530,
-			0.7904758214311360,
-			0.7903689091542487,
-			0.7902619728013477,
-			0.7901550123756904,
-			0.7900480278805350,
-			0.7899410193191405,
-			0.7898339866947667,
-			0.7897269300106737,
-			0.7896198492701227,
-			0.7895127444763759,
-			0.7894056156326955,
-			0.7892984627423451,
-			0.7891912858085884,
-			0.7890840848346907,
-			0.7889768598239171,
-			0.7888696107795341,
-			0.7887623377048086,
-			0.7886550406030084,
-			0.7885477194774018,
-			0.7884403743312582,
-			0.7883330051678474,
-			0.7882256119904399,
-			0.7881181948023075,
-			0.7880107536067220,
-			0.7879032884069563,
-			0.7877957992062838,
-			0.7876882860079792,
-			0.7875807488153173,
-			0.7874731876315738,
-			0.7873656024600254,
-			0.7872579933039492,
-			0.7871503601666232,
-			0.7870427030513261,
-			0.7869350219613374,
-			0.7868273168999370,
-			0.7867195878704061,
-			0.7866118348760259,
-			0.7865040579200794,
-			0.7863962570058491,
-			0.7862884321366188,
-			0.7861805833156734,
-			0.7860727105462981,
-			0.7859648138317786,
-			0.7858568931754019,
-			0.7857489485804553,
-			0.7856409800502270,
-			0.7855329875880059,
-			0.7854249711970819,
-			0.7853169308807449,
-			0.7852088666422864,
-			0.7851007784849979,
-			0.7849926664121722,
-			0.7848845304271026,
-			0.7847763705330829,
-			0.7846681867334080,
-			0.7845599790313733,
-			0.7844517474302751,
-			0.7843434919334100,
-			0.7842352125440761,
-			0.7841269092655715,
-			0.7840185821011953,
-			0.7839102310542475,
-			0.7838018561280287,
-			0.7836934573258398,
-			0.7835850346509832,
-			0.7834765881067615,
-			0.7833681176964782,
-			0.7832596234234375,
-			0.7831511052909442,
-			0.7830425633023040,
-			0.7829339974608236,
-			0.7828254077698097,
-			0.7827167942325703,
-			0.7826081568524139,
-			0.7824994956326499,
-			0.7823908105765881,
-			0.7822821016875394,
-			0.7821733689688153,
-			0.7820646124237278,
-			0.7819558320555899,
-			0.7818470278677155,
-			0.7817381998634186,
-			0.7816293480460144,
-			0.7815204724188187,
-			0.7814115729851482,
-			0.7813026497483200,
-			0.7811937027116520,
-			0.7810847318784633,
-			0.7809757372520729,
-			0.7808667188358012,
-			0.7807576766329691,
-			0.7806486106468981,
-			0.7805395208809106,
-			0.7804304073383297,
-			0.7803212700224792,
-			0.7802121089366836,
-			0.7801029240842680,
-			0.7799937154685586,
-			0.7798844830928818,
-			0.7797752269605652,
-			0.7796659470749370,
-			0.7795566434393258,
-			0.7794473160570615,
-			0.7793379649314741,
-			0.7792285900658948,
-			0.7791191914636554,
-			0.7790097691280882,
-			0.7789003230625264,
-			0.7787908532703041,
-			0.7786813597547558,
-			0.7785718425192169,
-			0.7784623015670235,
-			0.7783527369015122,
-			0.7782431485260209,
-			0.7781335364438877,
-			0.7780239006584515,
-			0.7779142411730521,
-			0.7778045579910299,
-			0.7776948511157258,
-			0.7775851205504820,
-			0.7774753662986409,
-			0.7773655883635459,
-			0.7772557867485409,
-			0.7771459614569709,
-			0.7770361124921812,
-			0.7769262398575177,
-			0.7768163435563279,
-			0.7767064235919591,
-			0.7765964799677595,
-			0.7764865126870786,
-			0.7763765217532659,
-			0.7762665071696719,
-			0.7761564689396478,
-			0.7760464070665460,
-			0.7759363215537187,
-			0.7758262124045194,
-			0.7757160796223022,
-			0.7756059232104220,
-			0.7754957431722346,
-			0.7753855395110957,
-			0.7752753122303628,
-			0.7751650613333934,
-			0.7750547868235459,
-			0.7749444887041795,
-			0.7748341669786544,
-			0.7747238216503305,
-			0.7746134527225697,
-			0.7745030601987338,
-			0.7743926440821857,
-			0.7742822043762886,
-			0.7741717410844067,
-			0.7740612542099053,
-			0.7739507437561497,
-			0.7738402097265061,
-			0.7737296521243420,
-			0.7736190709530248,
-			0.7735084662159233,
-			0.7733978379164064,
-			0.7732871860578442,
-			0.7731765106436073,
-			0.7730658116770670,
-			0.7729550891615956,
-			0.7728443431005658,
-			0.7727335734973511,
-			0.7726227803553256,
-			0.7725119636778645,
-			0.7724011234683433,
-			0.7722902597301384,
-			0.7721793724666269,
-			0.7720684616811867,
-			0.7719575273771964,
-			0.7718465695580349,
-			0.7717355882270827,
-			0.7716245833877200,
-			0.7715135550433284,
-			0.7714025031972901,
-			0.7712914278529878,
-			0.7711803290138052,
-			0.7710692066831262,
-			0.7709580608643363,
-			0.7708468915608208,
-			0.7707356987759664,
-			0.7706244825131598,
-			0.7705132427757891,
-			0.7704019795672432,
-			0.7702906928909108,
-			0.7701793827501822,
-			0.7700680491484480,
-			0.7699566920890997,
-			0.7698453115755292,
-			0.7697339076111297,
-			0.7696224801992946,
-			0.7695110293434180,
-			0.7693995550468951,
-			0.7692880573131216,
-			0.7691765361454936,
-			0.7690649915474087,
-			0.7689534235222645,
-			0.7688418320734596,
-			0.7687302172043932,
-			0.7686185789184653,
-			0.7685069172190766,
-			0.7683952321096287,
-			0.7682835235935234,
-			0.7681717916741637,
-			0.7680600363549532,
-			0.7679482576392961,
-			0.7678364555305974,
-			0.7677246300322628,
-			0.7676127811476987,
-			0.7675009088803121,
-			0.7673890132335108,
-			0.7672770942107037,
-			0.7671651518152997,
-			0.7670531860507086,
-			0.7669411969203416,
-			0.7668291844276097,
-			0.7667171485759252,
-			0.7666050893687006,
-			0.7664930068093498,
-			0.7663809009012869,
-			0.7662687716479267,
-			0.7661566190526850,
-			0.7660444431189780,
-			0.7659322438502231,
-			0.7658200212498377,
-			0.7657077753212405,
-			0.7655955060678508,
-			0.7654832134930881,
-			0.7653708976003736,
-			0.7652585583931282,
-			0.7651461958747742,
-			0.7650338100487342,
-			0.7649214009184319,
-			0.7648089684872911,
-			0.7646965127587370,
-			0.7645840337361950,
-			0.7644715314230915,
-			0.7643590058228538,
-			0.7642464569389090,
-			0.7641338847746860,
-			0.7640212893336139,
-			0.7639086706191225,
-			0.7637960286346422,
-			0.7636833633836044,
-			0.7635706748694412,
-			0.7634579630955851,
-			0.7633452280654697,
-			0.7632324697825289,
-			0.7631196882501975,
-			0.7630068834719113,
-			0.7628940554511062,
-			0.7627812041912194,
-			0.7626683296956883,
-			0.7625554319679515,
-			0.7624425110114479,
-			0.7623295668296173,
-			0.7622165994259001,
-			0.7621036088037378,
-			0.7619905949665720,
-			0.7618775579178453,
-			0.7617644976610011,
-			0.7616514141994833,
-			0.7615383075367368,
-			0.7614251776762068,
-			0.7613120246213396,
-			0.7611988483755822,
-			0.7610856489423818,
-			0.7609724263251867,
-			0.7608591805274461,
-			0.7607459115526095,
-			0.7606326194041273,
-			0.7605193040854504,
-			0.7604059656000309,
-			0.7602926039513211,
-			0.7601792191427743,
-			0.7600658111778442,
-			0.7599523800599857,
-			0.7598389257926538,
-			0.7597254483793047,
-			0.7596119478233950,
-			0.7594984241283824,
-			0.7593848772977246,
-			0.7592713073348807,
-			0.7591577142433104,
-			0.7590440980264737,
-			0.7589304586878314,
-			0.7588167962308454,
-			0.7587031106589781,
-			0.7585894019756925,
-			0.7584756701844522,
-			0.7583619152887219,
-			0.7582481372919665,
-			0.7581343361976521,
-			0.7580205120092455,
-			0.7579066647302134,
-			0.7577927943640241,
-			0.7576789009141465,
-			0.7575649843840496,
-			0.7574510447772037,
-			0.7573370820970795,
-			0.7572230963471488,
-			0.7571090875308835,
-			0.7569950556517564,
-			0.7568810007132415,
-			0.7567669227188129,
-			0.7566528216719455,
-			0.7565386975761150,
-			0.7564245504347982,
-			0.7563103802514720,
-			0.7561961870296141,
-			0.7560819707727031,
-			0.7559677314842181,
-			0.7558534691676395,
-			0.7557391838264474,
-			0.7556248754641236,
-			0.7555105440841496,
-			0.7553961896900087,
-			0.7552818122851837,
-			0.7551674118731591,
-			0.7550529884574197,
-			0.7549385420414513,
-			0.7548240726287396,
-			0.7547095802227720,
-			0.7545950648270359,
-			0.7544805264450196,
-			0.7543659650802124,
-			0.7542513807361039,
-			0.7541367734161843,
-			0.7540221431239451,
-			0.7539074898628779,
-			0.7537928136364753,
-			0.7536781144482306,
-
-			0.7535633923016379,
-			0.7534486472001914,
-			0.7533338791473869,
-			0.7532190881467200,
-			0.7531042742016876,
-			0.7529894373157874,
-			0.7528745774925171,
-			0.7527596947353759,
-			0.7526447890478631,
-			0.7525298604334789,
-			0.7524149088957243,
-			0.7522999344381012,
-			0.7521849370641115,
-			0.7520699167772582,
-			0.7519548735810455,
-			0.7518398074789774,
-			0.7517247184745591,
-			0.7516096065712965,
-			0.7514944717726960,
-			0.7513793140822650,
-			0.7512641335035112,
-			0.7511489300399432,
-			0.7510337036950703,
-			0.7509184544724027,
-			0.7508031823754509,
-			0.7506878874077264,
-			0.7505725695727412,
-			0.7504572288740080,
-			0.7503418653150404,
-			0.7502264788993527,
-			0.7501110696304595,
-			0.7499956375118766,
-			0.7498801825471202,
-			0.7497647047397071,
-			0.7496492040931552,
-			0.7495336806109825,
-			0.7494181342967084,
-			0.7493025651538526,
-			0.7491869731859354,
-			0.7490713583964780,
-			0.7489557207890021,
-			0.7488400603670304,
-			0.7487243771340861,
-			0.7486086710936931,
-			0.7484929422493760,
-			0.7483771906046599,
-			0.7482614161630712,
-			0.7481456189281361,
-			0.7480297989033825,
-			0.7479139560923381,
-			0.7477980904985319,
-			0.7476822021254933,
-			0.7475662909767522,
-			0.7474503570558398,
-			0.7473344003662876,
-			0.7472184209116278,
-			0.7471024186953933,
-			0.7469863937211177,
-			0.7468703459923354,
-			0.7467542755125813,
-			0.7466381822853914,
-			0.7465220663143017,
-			0.7464059276028497,
-			0.7462897661545728,
-			0.7461735819730098,
-			0.7460573750616994,
-			0.7459411454241822,
-			0.7458248930639981,
-			0.7457086179846887,
-			0.7455923201897959,
-			0.7454759996828622,
-			0.7453596564674310,
-			0.7452432905470463,
-			0.7451269019252530,
-			0.7450104906055961,
-			0.7448940565916221,
-			0.7447775998868775,
-			0.7446611204949100,
-			0.7445446184192674,
-			0.7444280936634990,
-			0.7443115462311541,
-			0.7441949761257830,
-			0.7440783833509366,
-			0.7439617679101665,
-			0.7438451298070251,
-			0.7437284690450652,
-			0.7436117856278408,
-			0.7434950795589061,
-			0.7433783508418161,
-			0.7432615994801266,
-			0.7431448254773942,
-			0.7430280288371760,
-			0.7429112095630296,
-			0.7427943676585138,
-			0.7426775031271876,
-			0.7425606159726110,
-			0.7424437061983444,
-			0.7423267738079495,
-			0.7422098188049880,
-			0.7420928411930224,
-			0.7419758409756164,
-			0.7418588181563337,
-			0.7417417727387392,
-			0.7416247047263982,
-			0.7415076141228770,
-			0.7413905009317421,
-			0.7412733651565613,
-			0.7411562068009023,
-			0.7410390258683344,
-			0.7409218223624270,
-			0.7408045962867501,
-			0.7406873476448749,
-			0.7405700764403729,
-			0.7404527826768162,
-			0.7403354663577780,
-			0.7402181274868321,
-			0.7401007660675525,
-			0.7399833821035144,
-			0.7398659755982936,
-			0.7397485465554663,
-			0.7396310949786096,
-			0.7395136208713016,
-			0.7393961242371205,
-			0.7392786050796455,
-			0.7391610634024564,
-			0.7390434992091337,
-			0.7389259125032587,
-			0.7388083032884134,
-			0.7386906715681800,
-			0.7385730173461423,
-			0.7384553406258838,
-			0.7383376414109893,
-			0.7382199197050442,
-			0.7381021755116345,
-			0.7379844088343467,
-			0.7378666196767684,
-			0.7377488080424875,
-			0.7376309739350930,
-			0.7375131173581739,
-			0.7373952383153206,
-			0.7372773368101241,
-			0.7371594128461755,
-			0.7370414664270671,
-			0.7369234975563919,
-			0.7368055062377432,
-			0.7366874924747153,
-			0.7365694562709032,
-			0.7364513976299025,
-			0.7363333165553094,
-			0.7362152130507207,
-			0.7360970871197343,
-			0.7359789387659484,
-			0.7358607679929622,
-			0.7357425748043750,
-			0.7356243592037874,
-			0.7355061211948005,
-			0.7353878607810159,
-			0.7352695779660361,
-			0.7351512727534643,
-			0.7350329451469040,
-			0.7349145951499598,
-			0.7347962227662372,
-			0.7346778279993414,
-			0.7345594108528792,
-			0.7344409713304580,
-			0.7343225094356856,
-			0.7342040251721703,
-			0.7340855185435214,
-			0.7339669895533489,
-			0.7338484382052635,
-			0.7337298645028763,
-			0.7336112684497994,
-			0.7334926500496455,
-			0.7333740093060277,
-			0.7332553462225601,
-			0.7331366608028572,
-			0.7330179530505349,
-			0.7328992229692087,
-			0.7327804705624956,
-			0.7326616958340130,
-			0.7325428987873788,
-			0.7324240794262118,
-			0.7323052377541317,
-			0.7321863737747585,
-			0.7320674874917129,
-			0.7319485789086164,
-			0.7318296480290912,
-			0.7317106948567601,
-			0.7315917193952467,
-			0.7314727216481752,
-			0.7313537016191706,
-			0.7312346593118580,
-			0.7311155947298641,
-			0.7309965078768156,
-			0.7308773987563403,
-			0.7307582673720661,
-			0.7306391137276222,
-			0.7305199378266384,
-			0.7304007396727448,
-			0.7302815192695721,
-			0.7301622766207523,
-			0.7300430117299178,
-			0.7299237246007015,
-			0.7298044152367370,
-			0.7296850836416590,
-			0.7295657298191021,
-			0.7294463537727022,
-			0.7293269555060958,
-			0.7292075350229200,
-			0.7290880923268124,
-			0.7289686274214116,
-			0.7288491403103564,
-			0.7287296309972870,
-			0.7286100994858435,
-			0.7284905457796674,
-			0.7283709698824002,
-			0.7282513717976847,
-			0.7281317515291637,
-			0.7280121090804811,
-			0.7278924444552818,
-			0.7277727576572104,
-			0.7276530486899133,
-			0.7275333175570369,
-			0.7274135642622283,
-			0.7272937888091353,
-			0.7271739912014068,
-			0.7270541714426918,
-			0.7269343295366404,
-			0.7268144654869029,
-			0.7266945792971308,
-			0.7265746709709758,
-			0.7264547405120910,
-			0.7263347879241293,
-			0.7262148132107448,
-			0.7260948163755920,
-			0.7259747974223263,
-			0.7258547563546036,
-			0.7257346931760809,
-			0.7256146078904151,
-			0.7254945005012645,
-			0.7253743710122877,
-			0.7252542194271439,
-			0.7251340457494933,
-			0.7250138499829966,
-			0.7248936321313151,
-			0.7247733921981109,
-			0.7246531301870467,
-			0.7245328461017859,
-			0.7244125399459924,
-			0.7242922117233311,
-			0.7241718614374675,
-			0.7240514890920675,
-			0.7239310946907980,
-			0.7238106782373263,
-			0.7236902397353204,
-			0.7235697791884493,
-			0.7234492966003823,
-			0.7233287919747897,
-			0.7232082653153420,
-			0.7230877166257109,
-			0.7229671459095681,
-			0.7228465531705870,
-			0.7227259384124407,
-			0.7226053016388033,
-			0.7224846428533498,
-			0.7223639620597556,
-			0.7222432592616967,
-			0.7221225344628501,
-			0.7220017876668934,
-			0.7218810188775044,
-			0.7217602280983622,
-			0.7216394153331462,
-			0.7215185805855365,
-			0.7213977238592142,
-			0.7212768451578604,
-			0.7211559444851577,
-			0.7210350218447887,
-			0.7209140772404370,
-			0.7207931106757867,
-			0.7206721221545226,
-			0.7205511116803305,
-			0.7204300792568962,
-			0.7203090248879069,
-			0.7201879485770500,
-			0.7200668503280137,
-			0.7199457301444867,
-			0.7198245880301588,
-			0.7197034239887201,
-			0.7195822380238615,
-			0.7194610301392744,
-			0.7193398003386512,
-			0.7192185486256846,
-			0.7190972750040681,
-			0.7189759794774961,
-			0.7188546620496634,
-			0.7187333227242655,
-			0.7186119615049986,
-			0.7184905783955596,
-			0.7183691733996461,
-			0.7182477465209561,
-			0.7181262977631889,
-			0.7180048271300435,
-			0.7178833346252205,
-			0.7177618202524205,
-			0.7176402840153454,
-			0.7175187259176972,
-			0.7173971459631786,
-			0.7172755441554933,
-			0.7171539204983457,
-			0.7170322749954403,
-			0.7169106076504828,
-			0.7167889184671794,
-			0.7166672074492371,
-			0.7165454746003631,
-			0.7164237199242660,
-			0.7163019434246543,
-			0.7161801451052376,
-			0.7160583249697263,
-			0.7159364830218312,
-			0.7158146192652637,
-			0.7156927337037359,
-			0.7155708263409607,
-			0.7154488971806519,
-			0.7153269462265234,
-			0.7152049734822900,
-			0.7150829789516673,
-			0.7149609626383716,
-			0.7148389245461194,
-			0.7147168646786284,
-			0.7145947830396169,
-			0.7144726796328034,
-			0.7143505544619075,
-			0.7142284075306495,
-			0.7141062388427500,
-			0.7139840484019307,
-			0.7138618362119135,
-			0.7137396022764213,
-			0.7136173465991776,
-			0.7134950691839064,
-			0.7133727700343326,
-			0.7132504491541816,
-			0.7131281065471795,
-			0.7130057422170530,
-			0.7128833561675297,
-			0.7127609484023376,
-			0.7126385189252054,
-			0.7125160677398625,
-			0.7123935948500393,
-			0.7122711002594661,
-			0.7121485839718744,
-			0.7120260459909965,
-			0.7119034863205649,
-			0.7117809049643131,
-			0.7116583019259749,
-			0.7115356772092853,
-			0.7114130308179797,
-			0.7112903627557937,
-			0.7111676730264644,
-			0.7110449616337290,
-			0.7109222285813255,
-			0.7107994738729924,
-			0.7106766975124694,
-			0.7105538995034962,
-			0.7104310798498135,
-			0.7103082385551626,
-			0.7101853756232853,
-			0.7100624910579247,
-			0.7099395848628236,
-			0.7098166570417261,
-			0.7096937075983769,
-			0.7095707365365209,
-			0.7094477438599044,
-			0.7093247295722740,
-			0.7092016936773765,
-			0.7090786361789602,
-			0.7089555570807735,
-			0.7088324563865654,
-			0.7087093341000862,
-			0.7085861902250861,
-			0.7084630247653164,
-			0.7083398377245290,
-			0.7082166291064760,
-			0.7080933989149110,
-			0.7079701471535875,
-			0.7078468738262603,
-			0.7077235789366842,
-			0.7076002624886153,
-			0.7074769244858097,
-			0.7073535649320245,
-			0.7072301838310175,
-			0.7071067811865476,
-			0.7069833570023731,
-			0.7068599112822541,
-			0.7067364440299511,
-			0.7066129552492247,
-			0.7064894449438369,
-			0.7063659131175500,
-			0.7062423597741271,
-			0.7061187849173316,
-			0.7059951885509279,
-			0.7058715706786810,
-			0.7057479313043565,
-			0.7056242704317207,
-			0.7055005880645404,
-			0.7053768842065834,
-			0.7052531588616178,
-			0.7051294120334124,
-			0.7050056437257368,
-			0.7048818539423614,
-			0.7047580426870569,
-			0.7046342099635947,
-			0.7045103557757471,
-			0.7043864801272868,
-			0.7042625830219873,
-			0.7041386644636229,
-			0.7040147244559684,
-			0.7038907630027988,
-			0.7037667801078906,
-			0.7036427757750203,
-			0.7035187500079654,
-			0.7033947028105039,
-			0.7032706341864144,
-			0.7031465441394766,
-			0.7030224326734702,
-			0.7028982997921758,
-			0.7027741454993748,
-			0.7026499697988492,
-			0.7025257726943817,
-			0.7024015541897551,
-			0.7022773142887540,
-			0.7021530529951625,
-			0.7020287703127659,
-			0.7019044662453500,
-			0.7017801407967015,
-			0.7016557939706075,
-			0.7015314257708557,
-			0.7014070362012348,
-			0.7012826252655338,
-			0.7011581929675422,
-			0.7010337393110511,
-			0.7009092642998509,
-			0.7007847679377338,
-			0.7006602502284918,
-			0.7005357111759181,
-			0.7004111507838063,
-			0.7002865690559509,
-			0.7001619659961469,
-			0.7000373416081896,
-			0.6999126958958757,
-			0.6997880288630016,
-			0.6996633405133653,
-			0.6995386308507651,
-			0.6994138998789995,
-			0.6992891476018682,
-			0.6991643740231714,
-			0.6990395791467099,
-			0.6989147629762851,
-			0.6987899255156993,
-			0.6986650667687551,
-			0.6985401867392560,
-			0.6984152854310058,
-			0.6982903628478098,
-			0.6981654189934727,
-			0.6980404538718008,
-			0.6979154674866009,
-			0.6977904598416802,
-			0.6976654309408465,
-			0.6975403807879086,
-			0.6974153093866755,
-			0.6972902167409574,
-			0.6971651028545645,
-			0.6970399677313084,
-			0.6969148113750006,
-			0.6967896337894536,
-			0.6966644349784807,
-			0.6965392149458955,
-			0.6964139736955128,
-			0.6962887112311472,
-			0.6961634275566145,
-			0.6960381226757313,
-			0.6959127965923143,
-			0.6957874493101813,
-			0.6956620808331508,
-			0.6955366911650415,
-			0.6954112803096730,
-			0.6952858482708655,
-			0.6951603950524399,
-			0.6950349206582178,
-			0.6949094250920214,
-			0.6947839083576733,
-			0.6946583704589974,
-			0.6945328113998173,
-			0.6944072311839580,
-			0.6942816298152447,
-			0.6941560072975038,
-			0.6940303636345616,
-			0.6939046988302457,
-			0.6937790128883841,
-			0.6936533058128049,
-			0.6935275776073380,
-			0.6934018282758130,
-			0.6932760578220605,
-			0.6931502662499116,
-			0.6930244535631982,
-			0.6928986197657526,
-			0.6927727648614084,
-			0.6926468888539987,
-			0.6925209917473585,
-			0.6923950735453226,
-			0.6922691342517265,
-			0.6921431738704068,
-			0.6920171924052003,
-			0.6918911898599449,
-			0.6917651662384784,
-			0.6916391215446401,
-			0.6915130557822694,
-			0.6913869689552063,
-			0.6912608610672919,
-			0.6911347321223678,
-			0.6910085821242756,
-			0.6908824110768583,
-			0.6907562189839594,
-			0.6906300058494230,
-			0.6905037716770933,
-			0.6903775164708160,
-			0.6902512402344372,
-			0.6901249429718032,
-			0.6899986246867612,
-			0.6898722853831591,
-			0.6897459250648457,
-			0.6896195437356698,
-			0.6894931413994814,
-			0.6893667180601309,
-			0.6892402737214693,
-			0.6891138083873485,
-			0.6889873220616206,
-			0.6888608147481388,
-			0.6887342864507566,
-			0.6886077371733283,
-			0.6884811669197090,
-			0.6883545756937540,
-			0.6882279634993196,
-			0.6881013303402624,
-			0.6879746762204404,
-			0.6878480011437113,
-			0.6877213051139337,
-			0.6875945881349674,
-			0.6874678502106721,
-			0.6873410913449087,
-			0.6872143115415383,
-			0.6870875108044230,
-			0.6869606891374254,
-			0.6868338465444084,
-			0.6867069830292359,
-			0.6865800985957726,
-			0.6864531932478837,
-			0.6863262669894347,
-			0.6861993198242922,
-			0.6860723517563230,
-			0.6859453627893949,
-			0.6858183529273761,
-			0.6856913221741359,
-			0.6855642705335435,
-			0.6854371980094692,
-			0.6853101046057840,
-			0.6851829903263591,
-			0.6850558551750670,
-			0.6849286991557800,
-			0.6848015222723719,
-			0.6846743245287167,
-			0.6845471059286887,
-			0.6844198664761636,
-			0.6842926061750170,
-			0.6841653250291257,
-			0.6840380230423669,
-			0.6839107002186184,
-			0.6837833565617588,
-			0.6836559920756669,
-			0.6835286067642226,
-			0.6834012006313064,
-			0.6832737736807992,
-			0.6831463259165825,
-			0.6830188573425390,
-			0.6828913679625512,
-			0.6827638577805027,
-			0.6826363268002780,
-			0.6825087750257616,
-			0.6823812024608391,
-			0.6822536091093964,
-			0.6821259949753206,
-			0.6819983600624985,
-			0.6818707043748184,
-			0.6817430279161691,
-			0.6816153306904396,
-			0.6814876127015198,
-			0.6813598739533001,
-			0.6812321144496719,
-			0.6811043341945268,
-			0.6809765331917574,
-			0.6808487114452564,
-			0.6807208689589179,
-			0.6805930057366358,
-			0.6804651217823052,
-			0.6803372170998218,
-			0.6802092916930818,
-			0.6800813455659817,
-			0.6799533787224191,
-			0.6798253911662925,
-			0.6796973829015001,
-			0.6795693539319415,
-			0.6794413042615165,
-			0.6793132338941260,
-			0.6791851428336712,
-			0.6790570310840536,
-			0.6789288986491762,
-			0.6788007455329418,
-			0.6786725717392543,
-			0.6785443772720180,
-			0.6784161621351382,
-			0.6782879263325203,
-			0.6781596698680706,
-			0.6780313927456961,
-			0.6779030949693043,
-			0.6777747765428036,
-			0.6776464374701023,
-			0.6775180777551102,
-			0.6773896974017373,
-			0.6772612964138943,
-			0.6771328747954923,
-			0.6770044325504437,
-			0.6768759696826608,
-			0.6767474861960566,
-			0.6766189820945454,
-			0.6764904573820412,
-			0.6763619120624593,
-			0.6762333461397154,
-			0.6761047596177260,
-			0.6759761525004079,
-			0.6758475247916785,
-			0.6757188764954564,
-			0.6755902076156602,
-			0.6754615181562096,
-			0.6753328081210245,
-			0.6752040775140257,
-			0.6750753263391346,
-			0.6749465546002729,
-			0.6748177623013636,
-			0.6746889494463300,
-			0.6745601160390956,
-			0.6744312620835849,
-			0.6743023875837234,
-			0.6741734925434365,
-			0.6740445769666508,
-			0.6739156408572929,
-			0.6737866842192909,
-			0.6736577070565728,
-			0.6735287093730674,
-			0.6733996911727044,
-			0.6732706524594139,
-			0.6731415932371263,
-			0.6730125135097733,
-			0.6728834132812870,
-			0.6727542925555997,
-			0.6726251513366447,
-			0.6724959896283560,
-			0.6723668074346680,
-			0.6722376047595161,
-			0.6721083816068355,
-			0.6719791379805630,
-			0.6718498738846352,
-			0.6717205893229901,
-			0.6715912842995659,
-			0.6714619588183013,
-			0.6713326128831358,
-			0.6712032464980093,
-			0.6710738596668628,
-			0.6709444523936379,
-			0.6708150246822759,
-			0.6706855765367200,
-			0.6705561079609131,
-			0.6704266189587992,
-			0.6702971095343225,
-			0.6701675796914283,
-			0.6700380294340622,
-			0.6699084587661708,
-			0.6697788676917006,
-			0.6696492562145995,
-			0.6695196243388155,
-			0.6693899720682976,
-			0.6692602994069952,
-			0.6691306063588582,
-			0.6690008929278375,
-			0.6688711591178841,
-			0.6687414049329502,
-			0.6686116303769881,
-			0.6684818354539510,
-			0.6683520201677930,
-			0.6682221845224683,
-			0.6680923285219318,
-			0.6679624521701391,
-			0.6678325554710466,
-			0.6677026384286112,
-			0.6675727010467905,
-			0.6674427433295423,
-			0.6673127652808257,
-			0.6671827669045998,
-			0.6670527482048244,
-			0.6669227091854606,
-			0.6667926498504694,
-			0.6666625702038126,
-			0.6665324702494525,
-			0.6664023499913525,
-			0.6662722094334759,
-			0.6661420485797873,
-			0.6660118674342517,
-			0.6658816660008343,
-			0.6657514442835016,
-			0.6656212022862201,
-			0.6654909400129573,
-			0.6653606574676815,
-			0.6652303546543608,
-			0.6651000315769648,
-			0.6649696882394635,
-			0.6648393246458271,
-			0.6647089408000266,
-			0.6645785367060341,
-			0.6644481123678216,
-			0.6643176677893622,
-			0.6641872029746296,
-			0.6640567179275978,
-			0.6639262126522416,
-			0.6637956871525365,
-			0.6636651414324585,
-			0.6635345754959843,
-			0.6634039893470911,
-			0.6632733829897567,
-			0.6631427564279597,
-			0.6630121096656794,
-			0.6628814427068951,
-			0.6627507555555876,
-			0.6626200482157375,
-			0.6624893206913267,
-			0.6623585729863369,
-			0.6622278051047513,
-			0.6620970170505533,
-			0.6619662088277267,
-			0.6618353804402566,
-			0.6617045318921279,
-			0.6615736631873262,
-			0.6614427743298386,
-			0.6613118653236518,
-			0.6611809361727539,
-			0.6610499868811327,
-			0.6609190174527775,
-			0.6607880278916778,
-			0.6606570182018237,
-			0.6605259883872059,
-			0.6603949384518162,
-			0.6602638683996462,
-			0.6601327782346887,
-			0.6600016679609368,
-			0.6598705375823843,
-			0.6597393871030262,
-			0.6596082165268569,
-			0.6594770258578724,
-			0.6593458151000690,
-			0.6592145842574434,
-			0.6590833333339933,
-			0.6589520623337168,
-			0.6588207712606129,
-			0.6586894601186805,
-			0.6585581289119199,
-			0.6584267776443314,
-			0.6582954063199163,
-			0.6581640149426765,
-			0.6580326035166145,
-			0.6579011720457331,
-			0.6577697205340359,
-			0.6576382489855274,
-			0.6575067574042120,
-			0.6573752457940958,
-			0.6572437141591843,
-			0.6571121625034845,
-			0.6569805908310037,
-			0.6568489991457496,
-			0.6567173874517308,
-			0.6565857557529564,
-			0.6564541040534363,
-			0.6563224323571806,
-			0.6561907406682005,
-			0.6560590289905073,
-			0.6559272973281134,
-			0.6557955456850313,
-			0.6556637740652747,
-			0.6555319824728574,
-			0.6554001709117939,
-			0.6552683393860996,
-			0.6551364878997903,
-			0.6550046164568826,
-			0.6548727250613930,
-			0.6547408137173397,
-			0.6546088824287407,
-			0.6544769311996148,
-			0.6543449600339817,
-			0.6542129689358610,
-			0.6540809579092739,
-			0.6539489269582415,
-			0.6538168760867856,
-			0.6536848052989289,
-			0.6535527145986942,
-			0.6534206039901054,
-			0.6532884734771869,
-			0.6531563230639635,
-			0.6530241527544607,
-			0.6528919625527049,
-			0.6527597524627226,
-			0.6526275224885409,
-			0.6524952726341883,
-			0.6523630029036931,
-			0.6522307133010845,
-			0.6520984038303922,
-			0.6519660744956467,
-			0.6518337253008787,
-			0.6517013562501203,
-			0.6515689673474031,
-			0.6514365585967603,
-			0.6513041300022253,
-			0.6511716815678319,
-			0.6510392132976147,
-			0.6509067251956092,
-			0.6507742172658509,
-			0.6506416895123764,
-			0.6505091419392228,
-			0.6503765745504275,
-			0.6502439873500288,
-			0.6501113803420656,
-			0.6499787535305774,
-			0.6498461069196042,
-			0.6497134405131865,
-			0.6495807543153658,
-			0.6494480483301835,
-			0.6493153225616828,
-			0.6491825770139060,
-			0.6490498116908974,
-			0.6489170265967008,
-			0.6487842217353611,
-			0.6486513971109241,
-			0.6485185527274354,
-			0.6483856885889422,
-			0.6482528046994913,
-			0.6481199010631309,
-			0.6479869776839094,
-			0.6478540345658756,
-			0.6477210717130796,
-			0.6475880891295714,
-			0.6474550868194021,
-			0.6473220647866229,
-			0.6471890230352861,
-			0.6470559615694443,
-			0.6469228803931508,
-			0.6467897795104595,
-			0.6466566589254250,
-			0.6465235186421021,
-			0.6463903586645466,
-			0.6462571789968150,
-			0.6461239796429639,
-			0.6459907606070510,
-			0.6458575218931341,
-			0.6457242635052721,
-			0.6455909854475245,
-			0.6454576877239506,
-			0.6453243703386112,
-			0.6451910332955677,
-			0.6450576765988812,
-			0.6449243002526143,
-			0.6447909042608300,
-			0.6446574886275914,
-			0.6445240533569627,
-			0.6443905984530087,
-			0.6442571239197948,
-			0.6441236297613866,
-			0.6439901159818505,
-			0.6438565825852538,
-			0.6437230295756640,
-			0.6435894569571495,
-			0.6434558647337789,
-			0.6433222529096220,
-			0.6431886214887487,
-			0.6430549704752294,
-			0.6429212998731356,
-			0.6427876096865394,
-			0.6426538999195127,
-			0.6425201705761288,
-			0.6423864216604613,
-			0.6422526531765844,
-			0.6421188651285730,
-			0.6419850575205024,
-			0.6418512303564486,
-			0.6417173836404886,
-			0.6415835173766989,
-			0.6414496315691579,
-			0.6413157262219437,
-			0.6411818013391354,
-			0.6410478569248125,
-			0.6409138929830553,
-			0.6407799095179446,
-			0.6406459065335615,
-			0.6405118840339883,
-			0.6403778420233073,
-			0.6402437805056018,
-			0.6401096994849554,
-			0.6399755989654528,
-			0.6398414789511786,
-			0.6397073394462183,
-			0.6395731804546581,
-			0.6394390019805847,
-			0.6393048040280856,
-			0.6391705866012486,
-			0.6390363497041621,
-			0.6389020933409152,
-			0.6387678175155976,
-			0.6386335222322997,
-			0.6384992074951124,
-			0.6383648733081269,
-			0.6382305196754354,
-			0.6380961466011306,
-			0.6379617540893054,
-			0.6378273421440541,
-			0.6376929107694710,
-			0.6375584599696510,
-			0.6374239897486899,
-			0.6372895001106834,
-			0.6371549910597287,
-			0.6370204625999233,
-			0.6368859147353649,
-			0.6367513474701521,
-			0.6366167608083841,
-			0.6364821547541607,
-			0.6363475293115821,
-			0.6362128844847493,
-			0.6360782202777640,
-			0.6359435366947280,
-			0.6358088337397441,
-			0.6356741114169157,
-			0.6355393697303463,
-			0.6354046086841409,
-			0.6352698282824043,
-			0.6351350285292422,
-			0.6350002094287607,
-			0.6348653709850667,
-			0.6347305132022676,
-			0.6345956360844714,
-			0.6344607396357869,
-			0.6343258238603230,
-			0.6341908887621897,
-			0.6340559343454971,
-			0.6339209606143562,
-			0.6337859675728786,
-			0.6336509552251766,
-			0.6335159235753627,
-			0.6333808726275502,
-			0.6332458023858532,
-			0.6331107128543857,
-			0.6329756040372632,
-			0.6328404759386013,
-			0.6327053285625162,
-			0.6325701619131245,
-			0.6324349759945438,
-			0.6322997708108923,
-			0.6321645463662882,
-			0.6320293026648508,
-			0.6318940397107001,
-			0.6317587575079562,
-			0.6316234560607401,
-			0.6314881353731732,
-			0.6313527954493776,
-			0.6312174362934764,
-			0.6310820579095924,
-			0.6309466603018496,
-			0.6308112434743727,
-			0.6306758074312863,
-			0.6305403521767161,
-			0.6304048777147887,
-			0.6302693840496306,
-			0.6301338711853692,
-			0.6299983391261323,
-			0.6298627878760488,
-			0.6297272174392473,
-			0.6295916278198580,
-			0.6294560190220112,
-			0.6293203910498375,
-			0.6291847439074685,
-			0.6290490775990361,
-			0.6289133921286730,
-			0.6287776875005128,
-			0.6286419637186886,
-			0.6285062207873353,
-			0.6283704587105879,
-			0.6282346774925818,
-			0.6280988771374527,
-			0.6279630576493379,
-			0.6278272190323746,
-			0.6276913612907004,
-			0.6275554844284542,
-			0.6274195884497747,
-			0.6272836733588016,
-			0.6271477391596751,
-			0.6270117858565362,
-			0.6268758134535261,
-			0.6267398219547867,
-			0.6266038113644605,
-			0.6264677816866907,
-			0.6263317329256213,
-			0.6261956650853960,
-			0.6260595781701602,
-			0.6259234721840591,
-			0.6257873471312387,
-			0.6256512030158456,
-			0.6255150398420269,
-			0.6253788576139307,
-			0.6252426563357052,
-			0.6251064360114992,
-			0.6249701966454623,
-			0.6248339382417445,
-			0.6246976608044965,
-			0.6245613643378697,
-			0.6244250488460159,
-			0.6242887143330872,
-			0.6241523608032370,
-			0.6240159882606187,
-			0.6238795967093862,
-			0.6237431861536945,
-			0.6236067565976990,
-			0.6234703080455554,
-			0.6233338405014203,
-			0.6231973539694503,
-			0.6230608484538035,
-			0.6229243239586381,
-			0.6227877804881125,
-			0.6226512180463863,
-			0.6225146366376196,
-			0.6223780362659725,
-			0.6222414169356063,
-			0.6221047786506828,
-			0.6219681214153641,
-			0.6218314452338128,
-			0.6216947501101928,
-			0.6215580360486677,
-			0.6214213030534019,
-			0.6212845511285610,
-			0.6211477802783103,
-			0.6210109905068164,
-			0.6208741818182458,
-			0.6207373542167663,
-			0.6206005077065456,
-			0.6204636422917525,
-			0.6203267579765560,
-			0.6201898547651260,
-			0.6200529326616326,
-			0.6199159916702470,
-			0.6197790317951400,
-			0.6196420530404846,
-			0.6195050554104526,
-			0.6193680389092177,
-			0.6192310035409534,
-			0.6190939493098341,
-			0.6189568762200346,
-			0.6188197842757305,
-			0.6186826734810978,
-			0.6185455438403135,
-			0.6184083953575541,
-			0.6182712280369981,
-			0.6181340418828233,
-			0.6179968368992088,
-			0.6178596130903342,
-			0.6177223704603798,
-			0.6175851090135258,
-			0.6174478287539535,
-			0.6173105296858450,
-			0.6171732118133824,
-			0.6170358751407488,
-			0.6168985196721274,
-			0.6167611454117026,
-			0.6166237523636591,
-			0.6164863405321819,
-			0.6163489099214567,
-			0.6162114605356706,
-			0.6160739923790096,
-			0.6159365054556618,
-			0.6157989997698152,
-			0.6156614753256583,
-			0.6155239321273804,
-			0.6153863701791714,
-			0.6152487894852218,
-			0.6151111900497223,
-			0.6149735718768643,
-			0.6148359349708402,
-			0.6146982793358424,
-			0.6145606049760646,
-			0.6144229118956999,
-			0.6142852000989432,
-			0.6141474695899893,
-			0.6140097203730337,
-			0.6138719524522723,
-			0.6137341658319022,
-			0.6135963605161202,
-			0.6134585365091242,
-			0.6133206938151127,
-			0.6131828324382845,
-			0.6130449523828391,
-			0.6129070536529765,
-			0.6127691362528974,
-			0.6126312001868033,
-			0.6124932454588954,
-			0.6123552720733765,
-			0.6122172800344493,
-			0.6120792693463173,
-			0.6119412400131846,
-			0.6118031920392559,
-			0.6116651254287362,
-			0.6115270401858311,
-			0.6113889363147473,
-			0.6112508138196916,
-			0.6111126727048715,
-			0.6109745129744946,
-			0.6108363346327699,
-			0.6106981376839065,
-			0.6105599221321139,
-			0.6104216879816025,
-			0.6102834352365832,
-			0.6101451639012677,
-			0.6100068739798674,
-			0.6098685654765953,
-			0.6097302383956642,
-			0.6095918927412881,
-			0.6094535285176810,
-			0.6093151457290580,
-			0.6091767443796341,
-			0.6090383244736255,
-			0.6088998860152487,
-			0.6087614290087207,
-			0.6086229534582591,
-			0.6084844593680823,
-			0.6083459467424088,
-			0.6082074155854582,
-			0.6080688659014503,
-			0.6079302976946053,
-			0.6077917109691447,
-			0.6076531057292900,
-			0.6075144819792629,
-			0.6073758397232868,
-			0.6072371789655843,
-			0.6070984997103797,
-			0.6069598019618974,
-			0.6068210857243622,
-			0.6066823510019997,
-			0.6065435977990360,
-			0.6064048261196978,
-			0.6062660359682122,
-			0.6061272273488073,
-			0.6059884002657110,
-			0.6058495547231526,
-			0.6057106907253614,
-			0.6055718082765674,
-			0.6054329073810013,
-			0.6052939880428944,
-			0.6051550502664781,
-			0.6050160940559849,
-			0.6048771194156476,
-			0.6047381263496997,
-			0.6045991148623749,
-			0.6044600849579079,
-			0.6043210366405339,
-			0.6041819699144886,
-			0.6040428847840078,
-			0.6039037812533287,
-			0.6037646593266883,
-			0.6036255190083248,
-			0.6034863603024766,
-			0.6033471832133827,
-			0.6032079877452825,
-			0.6030687739024162,
-			0.6029295416890247,
-			0.6027902911093491,
-			0.6026510221676312,
-			0.6025117348681134,
-			0.6023724292150386,
-			0.6022331052126505,
-			0.6020937628651928,
-			0.6019544021769103,
-			0.6018150231520483,
-			0.6016756257948523,
-			0.6015362101095687,
-			0.6013967761004444,
-			0.6012573237717266,
-			0.6011178531276633,
-			0.6009783641725034,
-			0.6008388569104954,
-			0.6006993313458895,
-			0.6005597874829354,
-			0.6004202253258841,
-			0.6002806448789868,
-			0.6001410461464954,
-			0.6000014291326625,
-			0.5998617938417410,
-			0.5997221402779842,
-			0.5995824684456463,
-			0.5994427783489821,
-			0.5993030699922467,
-			0.5991633433796959,
-			0.5990235985155858,
-			0.5988838354041737,
-			0.5987440540497165,
-			0.5986042544564726,
-			0.5984644366287004,
-			0.5983246005706591,
-			0.5981847462866082,
-			0.5980448737808078,
-			0.5979049830575189,
-			0.5977650741210028,
-			0.5976251469755210,
-			0.5974852016253365,
-			0.5973452380747121,
-			0.5972052563279110,
-			0.5970652563891975,
-			0.5969252382628364,
-			0.5967852019530927,
-			0.5966451474642321,
-			0.5965050748005213,
-			0.5963649839662266,
-			0.5962248749656159,
-			0.5960847478029567,
-			0.5959446024825179,
-			0.5958044390085685,
-			0.5956642573853780,
-			0.5955240576172165,
-			0.5953838397083551,
-			0.5952436036630645,
-			0.5951033494856171,
-			0.5949630771802850,
-			0.5948227867513414,
-			0.5946824782030594,
-			0.5945421515397132,
-			0.5944018067655774,
-			0.5942614438849274,
-			0.5941210629020385,
-			0.5939806638211872,
-			0.5938402466466502,
-			0.5936998113827050,
-			0.5935593580336291,
-			0.5934188866037013,
-			0.5932783970972008,
-			0.5931378895184066,
-			0.5929973638715993,
-			0.5928568201610593,
-			0.5927162583910678,
-			0.5925756785659065,
-			0.5924350806898581,
-			0.5922944647672050,
-			0.5921538308022309,
-			0.5920131787992196,
-			0.5918725087624556,
-			0.5917318206962239,
-			0.5915911146048103,
-			0.5914503904925009,
-			0.5913096483635825,
-			0.5911688882223420,
-			0.5910281100730673,
-			0.5908873139200470,
-			0.5907464997675700,
-			0.5906056676199253,
-			0.5904648174814034,
-			0.5903239493562946,
-			0.5901830632488899,
-			0.5900421591634810,
-			0.5899012371043604,
-			0.5897602970758204,
-			0.5896193390821546,
-			0.5894783631276566,
-			0.5893373692166208,
-			0.5891963573533421,
-			0.5890553275421160,
-			0.5889142797872386,
-			0.5887732140930066,
-			0.5886321304637168,
-			0.5884910289036669,
-			0.5883499094171551,
-			0.5882087720084804,
-			0.5880676166819417,
-			0.5879264434418393,
-			0.5877852522924731,
-			0.5876440432381445,
-			0.5875028162831545,
-			0.5873615714318052,
-			0.5872203086883997,
-			0.5870790280572404,
-			0.5869377295426315,
-			0.5867964131488769,
-			0.5866550788802813,
-			0.5865137267411501,
-			0.5863723567357894,
-			0.5862309688685050,
-			0.5860895631436043,
-			0.5859481395653946,
-			0.5858066981381838,
-			0.5856652388662806,
-			0.5855237617539941,
-			0.5853822668056339,
-			0.5852407540255102,
-			0.5850992234179336,
-			0.5849576749872154,
-			0.5848161087376675,
-			0.5846745246736025,
-			0.5845329227993328,
-			0.5843913031191722,
-			0.5842496656374345,
-			0.5841080103584342,
-			0.5839663372864864,
-			0.5838246464259070,
-			0.5836829377810118,
-			0.5835412113561175,
-			0.5833994671555416,
-			0.5832577051836016,
-			0.5831159254446159,
-			0.5829741279429034,
-			0.5828323126827835,
-			0.5826904796685761,
-			0.5825486289046017,
-			0.5824067603951814,
-			0.5822648741446366,
-			0.5821229701572894,
-			0.5819810484374626,
-			0.5818391089894794,
-			0.5816971518176633,
-			0.5815551769263387,
-			0.5814131843198305,
-			0.5812711740024640,
-			0.5811291459785650,
-			0.5809871002524598,
-			0.5808450368284755,
-			0.5807029557109399,
-			0.5805608569041805,
-			0.5804187404125259,
-			0.5802766062403057,
-			0.5801344543918494,
-			0.5799922848714869,
-			0.5798500976835492,
-			0.5797078928323675,
-			0.5795656703222735,
-			0.5794234301575996,
-			0.5792811723426788,
-			0.5791388968818445,
-			0.5789966037794305,
-			0.5788542930397714,
-			0.5787119646672022,
-			0.5785696186660587,
-			0.5784272550406766,
-			0.5782848737953927,
-			0.5781424749345445,
-			0.5780000584624692,
-			0.5778576243835053,
-			0.5777151727019917,
-			0.5775727034222676,
-			0.5774302165486728,
-			0.5772877120855480,
-			0.5771451900372336,
-			0.5770026504080716,
-			0.5768600932024037,
-			0.5767175184245725,
-			0.5765749260789212,
-			0.5764323161697933,
-			0.5762896887015329,
-			0.5761470436784847,
-			0.5760043811049941,
-			0.5758617009854066,
-			0.5757190033240687,
-			0.5755762881253270,
-			0.5754335553935290,
-			0.5752908051330224,
-			0.5751480373481561,
-			0.5750052520432786,
-			0.5748624492227394,
-			0.5747196288908888,
-			0.5745767910520773,
-			0.5744339357106556,
-			0.5742910628709756,
-			0.5741481725373897,
-			0.5740052647142503,
-			0.5738623394059106,
-			0.5737193966167246,
-			0.5735764363510460,
-			0.5734334586132305,
-			0.5732904634076327,
-			0.5731474507386090,
-			0.5730044206105154,
-			0.5728613730277090,
-			0.5727183079945474,
-			0.5725752255153885,
-			0.5724321255945910,
-			0.5722890082365136,
-			0.5721458734455163,
-			0.5720027212259591,
-			0.5718595515822025,
-			0.5717163645186077,
-			0.5715731600395370,
-			0.5714299381493519,
-			0.5712866988524155,
-			0.5711434421530913,
-			0.5710001680557428,
-			0.5708568765647347,
-			0.5707135676844317,
-			0.5705702414191993,
-			0.5704268977734036,
-			0.5702835367514107,
-			0.5701401583575881,
-			0.5699967625963031,
-			0.5698533494719238,
-			0.5697099189888188,
-			0.5695664711513575,
-			0.5694230059639092,
-			0.5692795234308442,
-			0.5691360235565333,
-			0.5689925063453479,
-			0.5688489718016595,
-			0.5687054199298406,
-			0.5685618507342640,
-			0.5684182642193030,
-			0.5682746603893314,
-			0.5681310392487240,
-			0.5679874008018554,
-			0.5678437450531013,
-			0.5677000720068375,
-			0.5675563816674407,
-			0.5674126740392879,
-			0.5672689491267565,
-			0.5671252069342249,
-			0.5669814474660717,
-			0.5668376707266759,
-			0.5666938767204172,
-			0.5665500654516760,
-			0.5664062369248328,
-			0.5662623911442692,
-			0.5661185281143666,
-			0.5659746478395077,
-			0.5658307503240751,
-			0.5656868355724519,
-			0.5655429035890227,
-			0.5653989543781716,
-			0.5652549879442832,
-			0.5651110042917433,
-			0.5649670034249380,
-			0.5648229853482535,
-			0.5646789500660769,
-			0.5645348975827962,
-			0.5643908279027990,
-			0.5642467410304741,
-			0.5641026369702106,
-			0.5639585157263980,
-			0.5638143773034268,
-			0.5636702217056876,
-			0.5635260489375714,
-			0.5633818590034703,
-			0.5632376519077765,
-			0.5630934276548825,
-			0.5629491862491819,
-			0.5628049276950686,
-			0.5626606519969368,
-			0.5625163591591813,
-			0.5623720491861979,
-			0.5622277220823821,
-			0.5620833778521305,
-			0.5619390164998403,
-			0.5617946380299088,
-			0.5616502424467340,
-			0.5615058297547144,
-			0.5613613999582491,
-			0.5612169530617379,
-			0.5610724890695805,
-			0.5609280079861779,
-			0.5607835098159312,
-			0.5606389945632418,
-			0.5604944622325120,
-			0.5603499128281446,
-			0.5602053463545429,
-			0.5600607628161105,
-			0.5599161622172516,
-			0.5597715445623711,
-			0.5596269098558743,
-			0.5594822581021669,
-			0.5593375893056556,
-			0.5591929034707468,
-			0.5590482006018483,
-			0.5589034807033676,
-			0.5587587437797136,
-			0.5586139898352946,
-			0.5584692188745205,
-			0.5583244309018014,
-			0.5581796259215476,
-			0.5580348039381700,
-			0.5578899649560801,
-			0.5577451089796901,
-			0.5576002360134127,
-			0.5574553460616607,
-			0.5573104391288479,
-			0.5571655152193884,
-			0.5570205743376968,
-			0.5568756164881880,
-			0.5567306416752780,
-			0.5565856499033830,
-			0.5564406411769195,
-			0.5562956155003048,
-			0.5561505728779568,
-			0.5560055133142933,
-			0.5558604368137334,
-			0.5557153433806966,
-			0.5555702330196023,
-			0.5554251057348710,
-			0.5552799615309233,
-			0.5551348004121808,
-			0.5549896223830654,
-			0.5548444274479992,
-			0.5546992156114054,
-			0.5545539868777074,
-			0.5544087412513288,
-			0.5542634787366941,
-			0.5541181993382284,
-			0.5539729030603573,
-			0.5538275899075065,
-			0.5536822598841027,
-			0.5535369129945727,
-			0.5533915492433441,
-			0.5532461686348449,
-			0.5531007711735039,
-			0.5529553568637499,
-			0.5528099257100125,
-			0.5526644777167218,
-			0.5525190128883084,
-			0.5523735312292035,
-			0.5522280327438386,
-			0.5520825174366459,
-			0.5519369853120583,
-			0.5517914363745084,
-			0.5516458706284302,
-			0.5515002880782580,
-			0.5513546887284263,
-			0.5512090725833703,
-			0.5510634396475260,
-			0.5509177899253292,
-			0.5507721234212170,
-			0.5506264401396265,
-			0.5504807400849956,
-			0.5503350232617624,
-			0.5501892896743656,
-			0.5500435393272449,
-			0.5498977722248399,
-			0.5497519883715907,
-			0.5496061877719383,
-			0.5494603704303243,
-			0.5493145363511901,
-			0.5491686855389785,
-			0.5490228179981318,
-			0.5488769337330939,
-			0.5487310327483085,
-			0.5485851150482198,
-			0.5484391806372733,
-			0.5482932295199139,
-			0.5481472617005876,
-			0.5480012771837408,
-			0.5478552759738207,
-			0.5477092580752745,
-			0.5475632234925503,
-			0.5474171722300964,
-			0.5472711042923620,
-			0.5471250196837965,
-			0.5469789184088496,
-			0.5468328004719724,
-			0.5466866658776154,
-			0.5465405146302302,
-			0.5463943467342691,
-			0.5462481621941843,
-			0.5461019610144291,
-			0.5459557431994567,
-			0.5458095087537216,
-			0.5456632576816780,
-			0.5455169899877812,
-			0.5453707056764864,
-			0.5452244047522500,
-			0.5450780872195287,
-			0.5449317530827791,
-			0.5447854023464593,
-			0.5446390350150272,
-			0.5444926510929412,
-			0.5443462505846606,
-			0.5441998334946452,
-			0.5440533998273548,
-			0.5439069495872503,
-			0.5437604827787925,
-			0.5436139994064432,
-			0.5434674994746648,
-			0.5433209829879194,
-			0.5431744499506707,
-			0.5430279003673820,
-			0.5428813342425175,
-			0.5427347515805421,
-			0.5425881523859205,
-			0.5424415366631188,
-			0.5422949044166029,
-			0.5421482556508398,
-			0.5420015903702963,
-			0.5418549085794403,
-			0.5417082102827399,
-			0.5415614954846638,
-			0.5414147641896813,
-			0.5412680164022619,
-			0.5411212521268759,
-			0.5409744713679940,
-			0.5408276741300873,
-			0.5406808604176275,
-			0.5405340302350872,
-			0.5403871835869386,
-			0.5402403204776551,
-			0.5400934409117104,
-			0.5399465448935785,
-			0.5397996324277347,
-			0.5396527035186534,
-			0.5395057581708111,
-			0.5393587963886836,
-			0.5392118181767472,
-			0.5390648235394799,
-			0.5389178124813592,
-			0.5387707850068630,
-			0.5386237411204703,
-			0.5384766808266602,
-			0.5383296041299126,
-			0.5381825110347072,
-			0.5380354015455252,
-			0.5378882756668476,
-			0.5377411334031563,
-			0.5375939747589333,
-			0.5374467997386615,
-			0.5372996083468239,
-			0.5371524005879044,
-			0.5370051764663868,
-			0.5368579359867566,
-			0.5367106791534982,
-			0.5365634059710975,
-			0.5364161164440412,
-			0.5362688105768152,
-			0.5361214883739076,
-			0.5359741498398051,
-			0.5358267949789965,
-			0.5356794237959708,
-			0.5355320362952162,
-			0.5353846324812231,
-			0.5352372123584815,
-			0.5350897759314822,
-			0.5349423232047161,
-			0.5347948541826751,
-			0.5346473688698513,
-			0.5344998672707374,
-			0.5343523493898263,
-			0.5342048152316121,
-			0.5340572648005886,
-			0.5339096981012504,
-			0.5337621151380929,
-			0.5336145159156115,
-			0.5334669004383027,
-			0.5333192687106625,
-			0.5331716207371887,
-			0.5330239565223786,
-			0.5328762760707300,
-			0.5327285793867420,
-			0.5325808664749134,
-			0.5324331373397441,
-			0.5322853919857339,
-			0.5321376304173835,
-			0.5319898526391942,
-			0.5318420586556668,
-			0.5316942484713041,
-			0.5315464220906084,
-			0.5313985795180829,
-			0.5312507207582310,
-			0.5311028458155567,
-			0.5309549546945647,
-			0.5308070473997597,
-			0.5306591239356474,
-			0.5305111843067342,
-			0.5303632285175259,
-			0.5302152565725298,
-			0.5300672684762535,
-			0.5299192642332049,
-			0.5297712438478926,
-			0.5296232073248250,
-			0.5294751546685122,
-			0.5293270858834642,
-			0.5291790009741906,
-			0.5290308999452031,
-			0.5288827828010129,
-			0.5287346495461317,
-			0.5285865001850722,
-			0.5284383347223471,
-			0.5282901531624700,
-			0.5281419555099542,
-			0.5279937417693148,
-			0.5278455119450665,
-			0.5276972660417242,
-			0.5275490040638040,
-			0.5274007260158222,
-			0.5272524319022954,
-			0.5271041217277415,
-			0.5269557954966775,
-			0.5268074532136222,
-			0.5266590948830946,
-			0.5265107205096130,
-			0.5263623300976980,
-			0.5262139236518696,
-			0.5260655011766484,
-			0.5259170626765557,
-			0.5257686081561131,
-			0.5256201376198429,
-			0.5254716510722677,
-			0.5253231485179108,
-			0.5251746299612957,
-			0.5250260954069466,
-			0.5248775448593881,
-			0.5247289783231452,
-			0.5245803958027434,
-			0.5244317973027093,
-			0.5242831828275690,
-			0.5241345523818499,
-			0.5239859059700793,
-			0.5238372435967850,
-			0.5236885652664959,
-			0.5235398709837410,
-			0.5233911607530496,
-			0.5232424345789518,
-			0.5230936924659779,
-			0.5229449344186593,
-			0.5227961604415265,
-			0.5226473705391124,
-			0.5224985647159489,
-			0.5223497429765690,
-			0.5222009053255060,
-			0.5220520517672939,
-			0.5219031823064668,
-			0.5217542969475595,
-			0.5216053956951077,
-			0.5214564785536472,
-			0.5213075455277137,
-			0.5211585966218445,
-			0.5210096318405762,
-			0.5208606511884474,
-			0.5207116546699958,
-			0.5205626422897601,
-			0.5204136140522796,
-			0.5202645699620941,
-			0.5201155100237431,
-			0.5199664342417680,
-			0.5198173426207094,
-			0.5196682351651093,
-			0.5195191118795094,
-			0.5193699727684524,
-			0.5192208178364814,
-			0.5190716470881397,
-			0.5189224605279718,
-			0.5187732581605216,
-			0.5186240399903342,
-			0.5184748060219553,
-			0.5183255562599307,
-			0.5181762907088066,
-			0.5180270093731302,
-			0.5178777122574487,
-			0.5177283993663102,
-			0.5175790707042627,
-			0.5174297262758549,
-			0.5172803660856365,
-			0.5171309901381572,
-			0.5169815984379671,
-			0.5168321909896170,
-			0.5166827677976580,
-			0.5165333288666419,
-			0.5163838742011206,
-			0.5162344038056476,
-			0.5160849176847750,
-			0.5159354158430570,
-			0.5157858982850475,
-			0.5156363650153011,
-			0.5154868160383728,
-			0.5153372513588179,
-			0.5151876709811930,
-			0.5150380749100544,
-			0.5148884631499586,
-			0.5147388357054632,
-			0.5145891925811263,
-			0.5144395337815064,
-			0.5142898593111621,
-			0.5141401691746530,
-			0.5139904633765386,
-			0.5138407419213796,
-			0.5136910048137362,
-			0.5135412520581701,
-			0.5133914836592430,
-			0.5132416996215170,
-			0.5130918999495548,
-			0.5129420846479196,
-			0.5127922537211750,
-			0.5126424071738850,
-			0.5124925450106144,
-			0.5123426672359284,
-			0.5121927738543920,
-			0.5120428648705717,
-			0.5118929402890335,
-			0.5117430001143449,
-			0.5115930443510731,
-			0.5114430730037860,
-			0.5112930860770520,
-			0.5111430835754402,
-			0.5109930655035194,
-			0.5108430318658599,
-			0.5106929826670318,
-			0.5105429179116058,
-			0.5103928376041532,
-			0.5102427417492458,
-			0.5100926303514556,
-			0.5099425034153552,
-			0.5097923609455183,
-			0.5096422029465179,
-			0.5094920294229279,
-			0.5093418403793237,
-			0.5091916358202797,
-			0.5090414157503714,
-			0.5088911801741748,
-			0.5087409290962664,
-			0.5085906625212235,
-			0.5084403804536228,
-			0.5082900828980423,
-			0.5081397698590607,
-			0.5079894413412567,
-			0.5078390973492093,
-			0.5076887378874984,
-			0.5075383629607042,
-			0.5073879725734074,
-			0.5072375667301889,
-			0.5070871454356310,
-			0.5069367086943152,
-			0.5067862565108241,
-			0.5066357888897409,
-			0.5064853058356491,
-			0.5063348073531326,
-			0.5061842934467757,
-			0.5060337641211637,
-			0.5058832193808820,
-			0.5057326592305158,
-			0.5055820836746523,
-			0.5054314927178775,
-			0.5052808863647791,
-			0.5051302646199448,
-			0.5049796274879628,
-			0.5048289749734217,
-			0.5046783070809109,
-			0.5045276238150193,
-			0.5043769251803376,
-			0.5042262111814563,
-			0.5040754818229662,
-			0.5039247371094590,
-			0.5037739770455263,
-			0.5036232016357609,
-			0.5034724108847553,
-			0.5033216047971034,
-			0.5031707833773985,
-			0.5030199466302350,
-			0.5028690945602080,
-			0.5027182271719119,
-			0.5025673444699433,
-			0.5024164464588979,
-			0.5022655331433725,
-			0.5021146045279641,
-			0.5019636606172699,
-			0.5018127014158884,
-			0.5016617269284179,
-			0.5015107371594574,
-			0.5013597321136062,
-			0.5012087117954642,
-			0.5010576762096319,
-			0.5009066253607100,
-			0.5007555592532994,
-			0.5006044778920027,
-			0.5004533812814215,
-			0.5003022694261582,
-			0.5001511423308167,
-			0.5000000000000001,
-			0.4998488424383125,
-			0.4996976696503583,
-			0.4995464816407428,
-			0.4993952784140716,
-			0.4992440599749498,
-			0.4990928263279846,
-			0.4989415774777824,
-			0.4987903134289508,
-			0.4986390341860973,
-			0.4984877397538303,
-			0.4983364301367584,
-			0.4981851053394908,
-			0.4980337653666372,
-			0.4978824102228074,
-			0.4977310399126122,
-			0.4975796544406626,
-			0.4974282538115699,
-			0.4972768380299462,
-			0.4971254071004037,
-			0.4969739610275553,
-			0.4968224998160146,
-			0.4966710234703950,
-			0.4965195319953107,
-			0.4963680253953769,
-			0.4962165036752081,
-			0.4960649668394205,
-			0.4959134148926298,
-			0.4957618478394527,
-			0.4956102656845063,
-			0.4954586684324075,
-			0.4953070560877749,
-			0.4951554286552265,
-			0.4950037861393813,
-			0.4948521285448585,
-			0.4947004558762779,
-			0.4945487681382597,
-			0.4943970653354245,
-			0.4942453474723933,
-			0.4940936145537884,
-			0.4939418665842311,
-			0.4937901035683439,
-			0.4936383255107504,
-			0.4934865324160733,
-			0.4933347242889372,
-			0.4931829011339656,
-			0.4930310629557840,
-			0.4928792097590176,
-			0.4927273415482916,
-			0.4925754583282326,
-			0.4924235601034671,
-			0.4922716468786223,
-			0.4921197186583255,
-			0.4919677754472050,
-			0.4918158172498890,
-			0.4916638440710066,
-			0.4915118559151869,
-			0.4913598527870602,
-			0.4912078346912563,
-			0.4910558016324061,
-			0.4909037536151409,
-			0.4907516906440920,
-			0.4905996127238920,
-			0.4904475198591732,
-			0.4902954120545687,
-			0.4901432893147120,
-			0.4899911516442366,
-			0.4898389990477775,
-			0.4896868315299689,
-			0.4895346490954466,
-			0.4893824517488463,
-			0.4892302394948039,
-			0.4890780123379563,
-			0.4889257702829405,
-			0.4887735133343940,
-			0.4886212414969550,
-			0.4884689547752618,
-			0.4883166531739534,
-			0.4881643366976691,
-			0.4880120053510488,
-			0.4878596591387327,
-			0.4877072980653615,
-			0.4875549221355768,
-			0.4874025313540197,
-			0.4872501257253322,
-			0.4870977052541576,
-			0.4869452699451381,
-			0.4867928198029176,
-			0.4866403548321399,
-			0.4864878750374492,
-			0.4863353804234907,
-			0.4861828709949089,
-			0.4860303467563503,
-			0.4858778077124606,
-			0.4857252538678866,
-			0.4855726852272752,
-			0.4854201017952740,
-			0.4852675035765310,
-			0.4851148905756945,
-			0.4849622627974133,
-			0.4848096202463371,
-			0.4846569629271152,
-			0.4845042908443981,
-			0.4843516040028362,
-			0.4841989024070806,
-			0.4840461860617832,
-			0.4838934549715959,
-			0.4837407091411710,
-			0.4835879485751616,
-			0.4834351732782207,
-			0.4832823832550026,
-			0.4831295785101609,
-			0.4829767590483508,
-			0.4828239248742274,
-			0.4826710759924462,
-			0.4825182124076633,
-			0.4823653341245351,
-			0.4822124411477186,
-			0.4820595334818712,
-			0.4819066111316507,
-			0.4817536741017154,
-			0.4816007223967240,
-			0.4814477560213354,
-			0.4812947749802099,
-			0.4811417792780071,
-			0.4809887689193877,
-			0.4808357439090125,
-			0.4806827042515428,
-			0.4805296499516409,
-			0.4803765810139685,
-			0.4802234974431889,
-			0.4800703992439651,
-			0.4799172864209605,
-			0.4797641589788398,
-			0.4796110169222666,
-			0.4794578602559066,
-			0.4793046889844251,
-			0.4791515031124876,
-			0.4789983026447611,
-			0.4788450875859117,
-			0.4786918579406069,
-			0.4785386137135142,
-			0.4783853549093016,
-			0.4782320815326381,
-			0.4780787935881923,
-			0.4779254910806334,
-			0.4777721740146320,
-			0.4776188423948575,
-			0.4774654962259813,
-			0.4773121355126744,
-			0.4771587602596084,
-			0.4770053704714556,
-			0.4768519661528879,
-			0.4766985473085790,
-			0.4765451139432019,
-			0.4763916660614305,
-			0.4762382036679391,
-			0.4760847267674025,
-			0.4759312353644959,
-			0.4757777294638948,
-			0.4756242090702751,
-			0.4754706741883139,
-			0.4753171248226873,
-			0.4751635609780736,
-			0.4750099826591499,
-			0.4748563898705945,
-			0.4747027826170865,
-			0.4745491609033049,
-			0.4743955247339292,
-			0.4742418741136395,
-			0.4740882090471162,
-			0.4739345295390405,
-			0.4737808355940930,
-			0.4736271272169563,
-			0.4734734044123122,
-			0.4733196671848434,
-			0.4731659155392332,
-			0.4730121494801648,
-			0.4728583690123226,
-			0.4727045741403907,
-			0.4725507648690539,
-			0.4723969412029980,
-			0.4722431031469083,
-			0.4720892507054710,
-			0.4719353838833726,
-			0.4717815026853006,
-			0.4716276071159424,
-			0.4714736971799853,
-			0.4713197728821184,
-			0.4711658342270304,
-			0.4710118812194100,
-			0.4708579138639474,
-			0.4707039321653326,
-			0.4705499361282560,
-			0.4703959257574088,
-			0.4702419010574823,
-			0.4700878620331683,
-			0.4699338086891592,
-			0.4697797410301478,
-			0.4696256590608271,
-			0.4694715627858909,
-			0.4693174522100330,
-			0.4691633273379480,
-			0.4690091881743306,
-			0.4688550347238769,
-			0.4687008669912816,
-			0.4685466849812419,
-			0.4683924886984538,
-			0.4682382781476145,
-			0.4680840533334217,
-			0.4679298142605733,
-			0.4677755609337677,
-			0.4676212933577037,
-			0.4674670115370806,
-			0.4673127154765980,
-			0.4671584051809560,
-			0.4670040806548553,
-			0.4668497419029969,
-			0.4666953889300821,
-			0.4665410217408127,
-			0.4663866403398912,
-			0.4662322447320203,
-			0.4660778349219030,
-			0.4659234109142429,
-			0.4657689727137444,
-			0.4656145203251115,
-			0.4654600537530491,
-			0.4653055730022628,
-			0.4651510780774583,
-			0.4649965689833419,
-			0.4648420457246196,
-			0.4646875083059991,
-			0.4645329567321878,
-			0.4643783910078931,
-			0.4642238111378240,
-			0.4640692171266889,
-			0.4639146089791971,
-			0.4637599867000582,
-			0.4636053502939823,
-			0.4634506997656798,
-			0.4632960351198618,
-			0.4631413563612393,
-			0.4629866634945248,
-			0.4628319565244298,
-			0.4626772354556672,
-			0.4625225002929498,
-			0.4623677510409917,
-			0.4622129877045066,
-			0.4620582102882085,
-			0.4619034187968125,
-			0.4617486132350341,
-			0.4615937936075881,
-			0.4614389599191914,
-			0.4612841121745602,
-			0.4611292503784113,
-			0.4609743745354624,
-			0.4608194846504309,
-			0.4606645807280353,
-			0.4605096627729941,
-			0.4603547307900264,
-			0.4601997847838517,
-			0.4600448247591900,
-			0.4598898507207615,
-			0.4597348626732871,
-			0.4595798606214879,
-			0.4594248445700857,
-			0.4592698145238022,
-			0.4591147704873606,
-			0.4589597124654832,
-			0.4588046404628932,
-			0.4586495544843149,
-			0.4584944545344722,
-			0.4583393406180900,
-			0.4581842127398927,
-			0.4580290709046064,
-			0.4578739151169567,
-			0.4577187453816701,
-			0.4575635617034731,
-			0.4574083640870930,
-			0.4572531525372573,
-			0.4570979270586942,
-			0.4569426876561320,
-			0.4567874343342996,
-			0.4566321670979262,
-			0.4564768859517414,
-			0.4563215909004759,
-			0.4561662819488597,
-			0.4560109591016240,
-			0.4558556223634999,
-			0.4557002717392197,
-			0.4555449072335157,
-			0.4553895288511198,
-			0.4552341365967659,
-			0.4550787304751874,
-			0.4549233104911177,
-			0.4547678766492916,
-			0.4546124289544440,
-			0.4544569674113098,
-			0.4543014920246248,
-			0.4541460027991250,
-			0.4539904997395469,
-			0.4538349828506273,
-			0.4536794521371036,
-			0.4535239076037135,
-			0.4533683492551953,
-			0.4532127770962874,
-			0.4530571911317286,
-			0.4529015913662588,
-			0.4527459778046178,
-			0.4525903504515454,
-			0.4524347093117829,
-			0.4522790543900708,
-			0.4521233856911507,
-			0.4519677032197649,
-			0.4518120069806556,
-			0.4516562969785656,
-			0.4515005732182380,
-			0.4513448357044165,
-			0.4511890844418451,
-			0.4510333194352680,
-			0.4508775406894308,
-			0.4507217482090781,
-			0.4505659419989558,
-			0.4504101220638101,
-			0.4502542884083876,
-			0.4500984410374351,
-			0.4499425799557000,
-			0.4497867051679301,
-			0.4496308166788739,
-			0.4494749144932798,
-			0.4493189986158965,
-			0.4491630690514741,
-			0.4490071258047623,
-			0.4488511688805114,
-			0.4486951982834717,
-			0.4485392140183949,
-			0.4483832160900322,
-			0.4482272045031359,
-			0.4480711792624580,
-			0.4479151403727516,
-			0.4477590878387697,
-			0.4476030216652661,
-			0.4474469418569948,
-			0.4472908484187102,
-			0.4471347413551671,
-			0.4469786206711212,
-			0.4468224863713278,
-			0.4466663384605431,
-			0.4465101769435237,
-			0.4463540018250263,
-			0.4461978131098087,
-			0.4460416108026287,
-			0.4458853949082439,
-			0.4457291654314137,
-			0.4455729223768964,
-			0.4454166657494517,
-			0.4452603955538396,
-			0.4451041117948202,
-			0.4449478144771543,
-			0.4447915036056029,
-			0.4446351791849275,
-			0.4444788412198901,
-			0.4443224897152527,
-			0.4441661246757787,
-			0.4440097461062306,
-			0.4438533540113723,
-			0.4436969483959676,
-			0.4435405292647808,
-			0.4433840966225773,
-			0.4432276504741215,
-			0.4430711908241796,
-			0.4429147176775177,
-			0.4427582310389017,
-			0.4426017309130985,
-			0.4424452173048759,
-			0.4422886902190012,
-			0.4421321496602429,
-			0.4419755956333687,
-			0.4418190281431482,
-			0.4416624471943504,
-			0.4415058527917450,
-			0.4413492449401027,
-			0.4411926236441934,
-			0.4410359889087882,
-			0.4408793407386586,
-			0.4407226791385761,
-			0.4405660041133135,
-			0.4404093156676426,
-			0.4402526138063370,
-			0.4400958985341700,
-			0.4399391698559152,
-			0.4397824277763470,
-			0.4396256723002398,
-			0.4394689034323690,
-			0.4393121211775099,
-			0.4391553255404383,
-			0.4389985165259306,
-			0.4388416941387633,
-			0.4386848583837137,
-			0.4385280092655591,
-			0.4383711467890775,
-			0.4382142709590471,
-			0.4380573817802469,
-			0.4379004792574554,
-			0.4377435633954527,
-			0.4375866341990186,
-			0.4374296916729334,
-			0.4372727358219776,
-			0.4371157666509330,
-			0.4369587841645805,
-			0.4368017883677023,
-			0.4366447792650806,
-			0.4364877568614985,
-			0.4363307211617393,
-			0.4361736721705859,
-			0.4360166098928226,
-			0.4358595343332341,
-			0.4357024454966049,
-			0.4355453433877203,
-			0.4353882280113658,
-			0.4352310993723275,
-			0.4350739574753918,
-			0.4349168023253455,
-			0.4347596339269756,
-			0.4346024522850703,
-			0.4344452574044171,
-			0.4342880492898047,
-			0.4341308279460217,
-			0.4339735933778573,
-			0.4338163455901016,
-			0.4336590845875444,
-			0.4335018103749758,
-			0.4333445229571871,
-			0.4331872223389696,
-			0.4330299085251145,
-			0.4328725815204141,
-			0.4327152413296607,
-			0.4325578879576474,
-			0.4324005214091676,
-			0.4322431416890144,
-			0.4320857488019823,
-			0.4319283427528657,
-			0.4317709235464594,
-			0.4316134911875584,
-			0.4314560456809590,
-			0.4312985870314568,
-			0.4311411152438481,
-			0.4309836303229304,
-			0.4308261322735003,
-			0.4306686211003560,
-			0.4305110968082952,
-			0.4303535594021163,
-			0.4301960088866188,
-			0.4300384452666010,
-			0.4298808685468633,
-			0.4297232787322058,
-			0.4295656758274282,
-			0.4294080598373321,
-			0.4292504307667185,
-			0.4290927886203891,
-			0.4289351334031461,
-			0.4287774651197914,
-			0.4286197837751284,
-			0.4284620893739604,
-			0.4283043819210903,
-			0.4281466614213230,
-			0.4279889278794625,
-			0.4278311813003138,
-			0.4276734216886819,
-			0.4275156490493730,
-			0.4273578633871925,
-			0.4272000647069469,
-			0.4270422530134436,
-			0.4268844283114889,
-			0.4267265906058915,
-			0.4265687399014585,
-			0.4264108762029985,
-			0.4262529995153206,
-			0.4260951098432339,
-			0.4259372071915479,
-			0.4257792915650728,
-			0.4256213629686185,
-			0.4254634214069963,
-			0.4253054668850171,
-			0.4251474994074923,
-			0.4249895189792346,
-			0.4248315256050556,
-			0.4246735192897683,
-			0.4245155000381859,
-			0.4243574678551217,
-			0.4241994227453901,
-			0.4240413647138053,
-			0.4238832937651815,
-			0.4237252099043344,
-			0.4235671131360796,
-			0.4234090034652324,
-			0.4232508808966093,
-			0.4230927454350273,
-			0.4229345970853032,
-			0.4227764358522549,
-			0.4226182617406994,
-			0.4224600747554558,
-			0.4223018749013424,
-			0.4221436621831782,
-			0.4219854366057826,
-			0.4218271981739760,
-			0.4216689468925778,
-			0.4215106827664091,
-			0.4213524058002908,
-			0.4211941159990439,
-			0.4210358133674911,
-			0.4208774979104538,
-			0.4207191696327545,
-			0.4205608285392169,
-			0.4204024746346635,
-			0.4202441079239186,
-			0.4200857284118064,
-			0.4199273361031508,
-			0.4197689310027771,
-			0.4196105131155107,
-			0.4194520824461771,
-			0.4192936389996023,
-			0.4191351827806132,
-			0.4189767137940361,
-			0.4188182320446988,
-			0.4186597375374281,
-			0.4185012302770528,
-			0.4183427102684010,
-			0.4181841775163016,
-			0.4180256320255835,
-			0.4178670738010768,
-			0.4177085028476111,
-			0.4175499191700165,
-			0.4173913227731244,
-			0.4172327136617652,
-			0.4170740918407712,
-			0.4169154573149736,
-			0.4167568100892047,
-			0.4165981501682979,
-			0.4164394775570854,
-			0.4162807922604012,
-			0.4161220942830791,
-			0.4159633836299528,
-			0.4158046603058574,
-			0.4156459243156278,
-			0.4154871756640994,
-			0.4153284143561076,
-			0.4151696403964892,
-			0.4150108537900803,
-			0.4148520545417178,
-			0.4146932426562389,
-			0.4145344181384817,
-			0.4143755809932843,
-			0.4142167312254846,
-			0.4140578688399215,
-			0.4138989938414350,
-			0.4137401062348639,
-			0.4135812060250483,
-			0.4134222932168289,
-			0.4132633678150464,
-			0.4131044298245419,
-			0.4129454792501568,
-			0.4127865160967329,
-			0.4126275403691129,
-			0.4124685520721392,
-			0.4123095512106547,
-			0.4121505377895035,
-			0.4119915118135288,
-			0.4118324732875750,
-			0.4116734222164867,
-			0.4115143586051087,
-			0.4113552824582866,
-			0.4111961937808664,
-			0.4110370925776934,
-			0.4108779788536150,
-			0.4107188526134772,
-			0.4105597138621280,
-			0.4104005626044149,
-			0.4102413988451853,
-			0.4100822225892884,
-			0.4099230338415727,
-			0.4097638326068874,
-			0.4096046188900817,
-			0.4094453926960062,
-			0.4092861540295106,
-			0.4091269028954461,
-			0.4089676392986630,
-			0.4088083632440135,
-			0.4086490747363491,
-			0.4084897737805221,
-			0.4083304603813848,
-			0.4081711345437908,
-			0.4080117962725929,
-			0.4078524455726447,
-			0.4076930824488010,
-			0.4075337069059155,
-			0.4073743189488435,
-			0.4072149185824405,
-			0.4070555058115612,
-			0.4068960806410626,
-			0.4067366430758002,
-			0.4065771931206313,
-			0.4064177307804132,
-			0.4062582560600026,
-			0.4060987689642581,
-			0.4059392694980377,
-			0.4057797576662000,
-			0.4056202334736039,
-			0.4054606969251093,
-			0.4053011480255754,
-			0.4051415867798626,
-			0.4049820131928313,
-			0.4048224272693423,
-			0.4046628290142574,
-			0.4045032184324375,
-			0.4043435955287449,
-			0.4041839603080424,
-			0.4040243127751923,
-			0.4038646529350576,
-			0.4037049807925024,
-			0.4035452963523900,
-			0.4033855996195851,
-			0.4032258905989524,
-			0.4030661692953562,
-			0.4029064357136627,
-			0.4027466898587372,
-			0.4025869317354461,
-			0.4024271613486560,
-			0.4022673787032331,
-			0.4021075838040454,
-			0.4019477766559602,
-			0.4017879572638454,
-			0.4016281256325698,
-			0.4014682817670021,
-			0.4013084256720109,
-			0.4011485573524661,
-			0.4009886768132372,
-			0.4008287840591950,
-			0.4006688790952101,
-			0.4005089619261527,
-			0.4003490325568949,
-			0.4001890909923082,
-			0.4000291372372647,
-			0.3998691712966367,
-			0.3997091931752976,
-			0.3995492028781200,
-			0.3993892004099775,
-			0.3992291857757447,
-			0.3990691589802953,
-			0.3989091200285041,
-			0.3987490689252463,
-			0.3985890056753970,
-			0.3984289302838327,
-			0.3982688427554291,
-			0.3981087430950625,
-			0.3979486313076105,
-			0.3977885073979496,
-			0.3976283713709581,
-			0.3974682232315140,
-			0.3973080629844950,
-			0.3971478906347808,
-			0.3969877061872496,
-			0.3968275096467816,
-			0.3966673010182566,
-			0.3965070803065542,
-			0.3963468475165557,
-			0.3961866026531419,
-			0.3960263457211940,
-			0.3958660767255935,
-			0.3957057956712233,
-			0.3955455025629650,
-			0.3953851974057015,
-			0.3952248802043166,
-			0.3950645509636929,
-			0.3949042096887153,
-			0.3947438563842673,
-			0.3945834910552338,
-			0.3944231137065001,
-			0.3942627243429511,
-			0.3941023229694726,
-			0.3939419095909513,
-			0.3937814842122728,
-			0.3936210468383245,
-			0.3934605974739937,
-			0.3933001361241673,
-			0.3931396627937341,
-			0.3929791774875816,
-			0.3928186802105990,
-			0.3926581709676753,
-			0.3924976497636994,
-			0.3923371166035615,
-			0.3921765714921517,
-			0.3920160144343604,
-			0.3918554454350782,
-			0.3916948644991970,
-			0.3915342716316078,
-			0.3913736668372023,
-			0.3912130501208735,
-			0.3910524214875137,
-			0.3908917809420162,
-			0.3907311284892739,
-			0.3905704641341807,
-			0.3904097878816309,
-			0.3902490997365190,
-			0.3900883997037395,
-			0.3899276877881883,
-			0.3897669639947602,
-			0.3896062283283516,
-			0.3894454807938588,
-			0.3892847213961778,
-			0.3891239501402063,
-			0.3889631670308415,
-			0.3888023720729809,
-			0.3886415652715232,
-			0.3884807466313662,
-			0.3883199161574090,
-			0.3881590738545507,
-			0.3879982197276907,
-			0.3878373537817293,
-			0.3876764760215667,
-			0.3875155864521029,
-			0.3873546850782396,
-			0.3871937719048778,
-			0.3870328469369193,
-			0.3868719101792663,
-			0.3867109616368206,
-			0.3865500013144856,
-			0.3863890292171643,
-			0.3862280453497600,
-			0.3860670497171765,
-			0.3859060423243187,
-			0.3857450231760903,
-			0.3855839922773964,
-			0.3854229496331429,
-			0.3852618952482345,
-			0.3851008291275781,
-			0.3849397512760795,
-			0.3847786616986453,
-			0.3846175604001832,
-			0.3844564473856001,
-			0.3842953226598037,
-			0.3841341862277027,
-			0.3839730380942050,
-			0.3838118782642198,
-			0.3836507067426565,
-			0.3834895235344239,
-			0.3833283286444327,
-			0.3831671220775929,
-			0.3830059038388151,
-			0.3828446739330105,
-			0.3826834323650898,
-			0.3825221791399654,
-			0.3823609142625491,
-			0.3821996377377533,
-			0.3820383495704907,
-			0.3818770497656748,
-			0.3817157383282185,
-			0.3815544152630358,
-			0.3813930805750414,
-			0.3812317342691490,
-			0.3810703763502742,
-			0.3809090068233319,
-			0.3807476256932374,
-			0.3805862329649073,
-			0.3804248286432576,
-			0.3802634127332049,
-			0.3801019852396665,
-			0.3799405461675591,
-			0.3797790955218011,
-			0.3796176333073105,
-			0.3794561595290049,
-			0.3792946741918041,
-			0.3791331773006271,
-			0.3789716688603929,
-			0.3788101488760217,
-			0.3786486173524330,
-			0.3784870742945483,
-			0.3783255197072878,
-			0.3781639535955729,
-			0.3780023759643253,
-			0.3778407868184673,
-			0.3776791861629204,
-			0.3775175740026075,
-			0.3773559503424518,
-			0.3771943151873766,
-			0.3770326685423058,
-			0.3768710104121626,
-			0.3767093408018723,
-			0.3765476597163592,
-			0.3763859671605485,
-			0.3762242631393654,
-			0.3760625476577363,
-			0.3759008207205868,
-			0.3757390823328433,
-			0.3755773324994332,
-			0.3754155712252830,
-			0.3752537985153206,
-			0.3750920143744743,
-			0.3749302188076712,
-			0.3747684118198411,
-			0.3746065934159120,
-			0.3744447636008136,
-			0.3742829223794758,
-			0.3741210697568277,
-			0.3739592057378004,
-			0.3737973303273245,
-			0.3736354435303303,
-			0.3734735453517500,
-			0.3733116357965149,
-			0.3731497148695571,
-			0.3729877825758092,
-			0.3728258389202033,
-			0.3726638839076731,
-			0.3725019175431519,
-			0.3723399398315734,
-			0.3721779507778716,
-			0.3720159503869815,
-			0.3718539386638373,
-			0.3716919156133742,
-			0.3715298812405284,
-			0.3713678355502347,
-			0.3712057785474301,
-			0.3710437102370512,
-			0.3708816306240340,
-			0.3707195397133166,
-			0.3705574375098362,
-			0.3703953240185308,
-			0.3702331992443388,
-			0.3700710631921983,
-			0.3699089158670488,
-			0.3697467572738296,
-			0.3695845874174796,
-			0.3694224063029393,
-			0.3692602139351495,
-			0.3690980103190501,
-			0.3689357954595822,
-			0.3687735693616877,
-			0.3686113320303077,
-			0.3684490834703845,
-			0.3682868236868604,
-			0.3681245526846779,
-			0.3679622704687807,
-			0.3677999770441115,
-			0.3676376724156143,
-			0.3674753565882333,
-			0.3673130295669129,
-			0.3671506913565977,
-			0.3669883419622332,
-			0.3668259813887641,
-			0.3666636096411368,
-			0.3665012267242973,
-			0.3663388326431918,
-			0.3661764274027678,
-			0.3660140110079717,
-			0.3658515834637513,
-			0.3656891447750544,
-			0.3655266949468289,
-			0.3653642339840238,
-			0.3652017618915879,
-			0.3650392786744698,
-			0.3648767843376196,
-			0.3647142788859870,
-			0.3645517623245221,
-			0.3643892346581757,
-			0.3642266958918982,
-			0.3640641460306412,
-			0.3639015850793563,
-			0.3637390130429949,
-			0.3635764299265098,
-			0.3634138357348533,
-			0.3632512304729784,
-			0.3630886141458380,
-			0.3629259867583863,
-			0.3627633483155768,
-			0.3626006988223637,
-			0.3624380382837017,
-			0.3622753667045456,
-			0.3621126840898511,
-			0.3619499904445733,
-			0.3617872857736681,
-			0.3616245700820924,
-			0.3614618433748020,
-			0.3612991056567544,
-			0.3611363569329069,
-			0.3609735972082165,
-			0.3608108264876417,
-			0.3606480447761407,
-			0.3604852520786720,
-			0.3603224484001949,
-			0.3601596337456678,
-			0.3599968081200512,
-			0.3598339715283048,
-			0.3596711239753887,
-			0.3595082654662635,
-			0.3593453960058907,
-			0.3591825155992310,
-			0.3590196242512461,
-			0.3588567219668984,
-			0.3586938087511496,
-			0.3585308846089627,
-			0.3583679495453004,
-			0.3582050035651260,
-			0.3580420466734036,
-			0.3578790788750966,
-			0.3577161001751692,
-			0.3575531105785865,
-			0.3573901100903133,
-			0.3572270987153148,
-			0.3570640764585568,
-			0.3569010433250046,
-			0.3567379993196252,
-			0.3565749444473849,
-			0.3564118787132508,
-			0.3562488021221898,
-			0.3560857146791699,
-			0.3559226163891589,
-			0.3557595072571250,
-			0.3555963872880366,
-			0.3554332564868629,
-			0.3552701148585734,
-			0.3551069624081372,
-			0.3549437991405240,
-			0.3547806250607047,
-			0.3546174401736496,
-			0.3544542444843298,
-			0.3542910379977158,
-			0.3541278207187799,
-			0.3539645926524939,
-			0.3538013538038296,
-			0.3536381041777596,
-			0.3534748437792571,
-			0.3533115726132952,
-			0.3531482906848472,
-			0.3529849979988874,
-			0.3528216945603896,
-			0.3526583803743284,
-			0.3524950554456786,
-			0.3523317197794152,
-			0.3521683733805143,
-			0.3520050162539511,
-			0.3518416484047017,
-			0.3516782698377433,
-			0.3515148805580517,
-			0.3513514805706048,
-			0.3511880698803800,
-			0.3510246484923545,
-			0.3508612164115069,
-			0.3506977736428155,
-			0.3505343201912590,
-			0.3503708560618167,
-			0.3502073812594674,
-			0.3500438957891915,
-			0.3498803996559688,
-			0.3497168928647796,
-			0.3495533754206046,
-			0.3493898473284252,
-			0.3492263085932222,
-			0.3490627592199774,
-			0.3488991992136733,
-			0.3487356285792917,
-			0.3485720473218151,
-			0.3484084554462272,
-			0.3482448529575105,
-			0.3480812398606493,
-			0.3479176161606271,
-			0.3477539818624279,
-			0.3475903369710372,
-			0.3474266814914389,
-			0.3472630154286190,
-			0.3470993387875628,
-			0.3469356515732558,
-			0.3467719537906848,
-			0.3466082454448360,
-			0.3464445265406962,
-			0.3462807970832530,
-			0.3461170570774930,
-			0.3459533065284048,
-			0.3457895454409763,
-			0.3456257738201957,
-			0.3454619916710521,
-			0.3452981989985348,
-			0.3451343958076326,
-			0.3449705821033353,
-			0.3448067578906334,
-			0.3446429231745170,
-			0.3444790779599768,
-			0.3443152222520039,
-			0.3441513560555896,
-			0.3439874793757257,
-			0.3438235922174037,
-			0.3436596945856161,
-			0.3434957864853557,
-			0.3433318679216153,
-			0.3431679388993882,
-			0.3430039994236679,
-			0.3428400494994482,
-			0.3426760891317235,
-			0.3425121183254882,
-			0.3423481370857370,
-			0.3421841454174656,
-			0.3420201433256688,
-			0.3418561308153427,
-			0.3416921078914834,
-			0.3415280745590871,
-			0.3413640308231509,
-			0.3411999766886720,
-			0.3410359121606470,
-			0.3408718372440743,
-			0.3407077519439516,
-			0.3405436562652773,
-			0.3403795502130499,
-			0.3402154337922689,
-			0.3400513070079329,
-			0.3398871698650418,
-			0.3397230223685954,
-			0.3395588645235939,
-			0.3393946963350382,
-			0.3392305178079287,
-			0.3390663289472665,
-			0.3389021297580537,
-			0.3387379202452915,
-			0.3385737004139819,
-			0.3384094702691282,
-			0.3382452298157321,
-			0.3380809790587975,
-			0.3379167180033271,
-			0.3377524466543247,
-			0.3375881650167949,
-			0.3374238730957411,
-			0.3372595708961686,
-			0.3370952584230822,
-			0.3369309356814868,
-			0.3367666026763883,
-			0.3366022594127925,
-			0.3364379058957055,
-			0.3362735421301337,
-			0.3361091681210844,
-			0.3359447838735642,
-			0.3357803893925807,
-			0.3356159846831416,
-			0.3354515697502549,
-			0.3352871445989294,
-			0.3351227092341733,
-			0.3349582636609954,
-			0.3347938078844056,
-			0.3346293419094132,
-			0.3344648657410282,
-			0.3343003793842609,
-			0.3341358828441214,
-			0.3339713761256213,
-			0.3338068592337711,
-			0.3336423321735823,
-			0.3334777949500671,
-			0.3333132475682374,
-			0.3331486900331055,
-			0.3329841223496846,
-			0.3328195445229867,
-			0.3326549565580260,
-			0.3324903584598158,
-			0.3323257502333700,
-			0.3321611318837032,
-			0.3319965034158299,
-			0.3318318648347646,
-			0.3316672161455226,
-			0.3315025573531193,
-			0.3313378884625709,
-			0.3311732094788934,
-			0.3310085204071028,
-			0.3308438212522162,
-			0.3306791120192505,
-			0.3305143927132230,
-			0.3303496633391512,
-			0.3301849239020537,
-			0.3300201744069480,
-			0.3298554148588529,
-			0.3296906452627873,
-			0.3295258656237702,
-			0.3293610759468216,
-			0.3291962762369607,
-			0.3290314664992076,
-			0.3288666467385833,
-			0.3287018169601079,
-			0.3285369771688026,
-			0.3283721273696887,
-			0.3282072675677876,
-			0.3280423977681216,
-			0.3278775179757129,
-			0.3277126281955836,
-			0.3275477284327571,
-			0.3273828186922558,
-			0.3272178989791039,
-			0.3270529692983249,
-			0.3268880296549425,
-			0.3267230800539814,
-			0.3265581205004662,
-			0.3263931509994218,
-			0.3262281715558732,
-			0.3260631821748468,
-			0.3258981828613676,
-			0.3257331736204621,
-			0.3255681544571568,
-			0.3254031253764781,
-			0.3252380863834538,
-			0.3250730374831107,
-			0.3249079786804763,
-			0.3247429099805795,
-			0.3245778313884475,
-			0.3244127429091095,
-			0.3242476445475946,
-			0.3240825363089312,
-			0.3239174181981494,
-			0.3237522902202790,
-			0.3235871523803495,
-			0.3234220046833921,
-			0.3232568471344366,
-			0.3230916797385148,
-			0.3229265025006577,
-			0.3227613154258965,
-			0.3225961185192636,
-			0.3224309117857910,
-			0.3222656952305111,
-			0.3221004688584567,
-			0.3219352326746613,
-			0.3217699866841577,
-			0.3216047308919799,
-			0.3214394653031615,
-			0.3212741899227373,
-			0.3211089047557419,
-			0.3209436098072097,
-			0.3207783050821758,
-			0.3206129905856762,
-			0.3204476663227465,
-			0.3202823322984225,
-			0.3201169885177411,
-			0.3199516349857384,
-			0.3197862717074516,
-			0.3196208986879179,
-			0.3194555159321747,
-			0.3192901234452605,
-			0.3191247212322127,
-			0.3189593092980698,
-			0.3187938876478712,
-			0.3186284562866552,
-			0.3184630152194615,
-			0.3182975644513295,
-			0.3181321039872991,
-			0.3179666338324109,
-			0.3178011539917053,
-			0.3176356644702226,
-			0.3174701652730046,
-			0.3173046564050921,
-			0.3171391378715272,
-			0.3169736096773519,
-			0.3168080718276080,
-			0.3166425243273385,
-			0.3164769671815861,
-			0.3163114003953941,
-			0.3161458239738056,
-			0.3159802379218651,
-			0.3158146422446159,
-			0.3156490369471023,
-			0.3154834220343697,
-			0.3153177975114621,
-			0.3151521633834255,
-			0.3149865196553049,
-			0.3148208663321460,
-			0.3146552034189956,
-			0.3144895309208990,
-			0.3143238488429039,
-			0.3141581571900570,
-			0.3139924559674049,
-			0.3138267451799959,
-			0.3136610248328778,
-			0.3134952949310981,
-			0.3133295554797060,
-			0.3131638064837495,
-			0.3129980479482782,
-			0.3128322798783413,
-			0.3126665022789878,
-			0.3125007151552683,
-			0.3123349185122326,
-			0.3121691123549312,
-			0.3120032966884147,
-			0.3118374715177347,
-			0.3116716368479420,
-			0.3115057926840880,
-			0.3113399390312255,
-			0.3111740758944056,
-			0.3110082032786818,
-			0.3108423211891062,
-			0.3106764296307317,
-			0.3105105286086123,
-			0.3103446181278013,
-			0.3101786981933526,
-			0.3100127688103207,
-			0.3098468299837595,
-			0.3096808817187242,
-			0.3095149240202699,
-			0.3093489568934517,
-			0.3091829803433258,
-			0.3090169943749475,
-			0.3088509989933733,
-			0.3086849942036599,
-			0.3085189800108634,
-			0.3083529564200416,
-			0.3081869234362517,
-			0.3080208810645510,
-			0.3078548293099980,
-			0.3076887681776507,
-			0.3075226976725675,
-			0.3073566177998070,
-			0.3071905285644287,
-			0.3070244299714919,
-			0.3068583220260563,
-			0.3066922047331813,
-			0.3065260780979277,
-			0.3063599421253558,
-			0.3061937968205265,
-			0.3060276421885005,
-			0.3058614782343400,
-			0.3056953049631057,
-			0.3055291223798598,
-			0.3053629304896651,
-			0.3051967292975831,
-			0.3050305188086776,
-			0.3048642990280109,
-			0.3046980699606464,
-			0.3045318316116484,
-			0.3043655839860799,
-			0.3041993270890058,
-			0.3040330609254904,
-			0.3038667855005980,
-			0.3037005008193943,
-			0.3035342068869445,
-			0.3033679037083136,
-			0.3032015912885681,
-			0.3030352696327739,
-			0.3028689387459977,
-			0.3027025986333062,
-			0.3025362492997659,
-			0.3023698907504445,
-			0.3022035229904097,
-			0.3020371460247291,
-			0.3018707598584707,
-			0.3017043644967036,
-			0.3015379599444958,
-			0.3013715462069163,
-			0.3012051232890349,
-			0.3010386911959203,
-			0.3008722499326433,
-			0.3007057995042733,
-			0.3005393399158806,
-			0.3003728711725365,
-			0.3002063932793110,
-			0.3000399062412762,
-			0.2998734100635034,
-			0.2997069047510637,
-			0.2995403903090299,
-			0.2993738667424740,
-			0.2992073340564687,
-			0.2990407922560865,
-			0.2988742413464013,
-			0.2987076813324859,
-			0.2985411122194145,
-			0.2983745340122603,
-			0.2982079467160983,
-			0.2980413503360028,
-			0.2978747448770486,
-			0.2977081303443105,
-			0.2975415067428647,
-			0.2973748740777861,
-			0.2972082323541506,
-			0.2970415815770349,
-			0.2968749217515151,
-			0.2967082528826683,
-			0.2965415749755712,
-			0.2963748880353008,
-			0.2962081920669353,
-			0.2960414870755524,
-			0.2958747730662298,
-			0.2957080500440467,
-			0.2955413180140811,
-			0.2953745769814122,
-			0.2952078269511191,
-			0.2950410679282812,
-			0.2948742999179786,
-			0.2947075229252914,
-			0.2945407369552993,
-			0.2943739420130837,
-			0.2942071381037246,
-			0.2940403252323039,
-			0.2938735034039028,
-			0.2937066726236026,
-			0.2935398328964857,
-			0.2933729842276343,
-			0.2932061266221304,
-			0.2930392600850574,
-			0.2928723846214981,
-			0.2927055002365357,
-			0.2925386069352542,
-			0.2923717047227368,
-			0.2922047936040681,
-			0.2920378735843324,
-			0.2918709446686144,
-			0.2917040068619988,
-			0.2915370601695714,
-			0.2913701045964172,
-			0.2912031401476218,
-			0.2910361668282719,
-			0.2908691846434531,
-			0.2907021935982524,
-			0.2905351936977567,
-			0.2903681849470525,
-			0.2902011673512281,
-			0.2900341409153701,
-			0.2898671056445672,
-			0.2897000615439076,
-			0.2895330086184791,
-			0.2893659468733710,
-			0.2891988763136720,
-			0.2890317969444716,
-			0.2888647087708590,
-			0.2886976117979245,
-			0.2885305060307577,
-			0.2883633914744494,
-			0.2881962681340894,
-			0.2880291360147693,
-			0.2878619951215799,
-			0.2876948454596128,
-			0.2875276870339594,
-			0.2873605198497121,
-			0.2871933439119627,
-			0.2870261592258035,
-			0.2868589657963280,
-			0.2866917636286283,
-			0.2865245527277983,
-			0.2863573330989315,
-			0.2861901047471211,
-			0.2860228676774618,
-			0.2858556218950478,
-			0.2856883674049736,
-			0.2855211042123342,
-			0.2853538323222243,
-			0.2851865517397398,
-			0.2850192624699762,
-			0.2848519645180291,
-			0.2846846578889953,
-			0.2845173425879710,
-			0.2843500186200527,
-			0.2841826859903375,
-			0.2840153447039225,
-			0.2838479947659056,
-			0.2836806361813845,
-			0.2835132689554567,
-			0.2833458930932211,
-			0.2831785085997762,
-			0.2830111154802204,
-			0.2828437137396529,
-			0.2826763033831734,
-			0.2825088844158813,
-			0.2823414568428763,
-			0.2821740206692591,
-			0.2820065759001295,
-			0.2818391225405883,
-			0.2816716605957366,
-			0.2815041900706752,
-			0.2813367109705063,
-			0.2811692233003309,
-			0.2810017270652510,
-			0.2808342222703693,
-			0.2806667089207877,
-			0.2804991870216094,
-			0.2803316565779376,
-			0.2801641175948747,
-			0.2799965700775252,
-			0.2798290140309920,
-			0.2796614494603799,
-			0.2794938763707930,
-			0.2793262947673354,
-			0.2791587046551126,
-			0.2789911060392293,
-			0.2788234989247909,
-			0.2786558833169029,
-			0.2784882592206717,
-			0.2783206266412028,
-			0.2781529855836026,
-			0.2779853360529784,
-			0.2778176780544364,
-			0.2776500115930840,
-			0.2774823366740286,
-			0.2773146533023777,
-			0.2771469614832398,
-			0.2769792612217225,
-			0.2768115525229342,
-			0.2766438353919842,
-			0.2764761098339807,
-			0.2763083758540336,
-			0.2761406334572522,
-			0.2759728826487457,
-			0.2758051234336247,
-			0.2756373558169992,
-			0.2754695798039797,
-			0.2753017953996771,
-			0.2751340026092020,
-			0.2749662014376660,
-			0.2747983918901806,
-			0.2746305739718575,
-			0.2744627476878085,
-			0.2742949130431466,
-			0.2741270700429836,
-			0.2739592186924323,
-			0.2737913589966063,
-			0.2736234909606186,
-			0.2734556145895828,
-			0.2732877298886126,
-			0.2731198368628218,
-			0.2729519355173254,
-			0.2727840258572374,
-			0.2726161078876727,
-			0.2724481816137466,
-			0.2722802470405744,
-			0.2721123041732715,
-			0.2719443530169540,
-			0.2717763935767374,
-			0.2716084258577388,
-			0.2714404498650743,
-			0.2712724656038607,
-			0.2711044730792157,
-			0.2709364722962559,
-			0.2707684632600994,
-			0.2706004459758637,
-			0.2704324204486669,
-			0.2702643866836277,
-			0.2700963446858648,
-			0.2699282944604963,
-			0.2697602360126419,
-			0.2695921693474209,
-			0.2694240944699527,
-			0.2692560113853576,
-			0.2690879200987549,
-			0.2689198206152657,
-			0.2687517129400103,
-			0.2685835970781096,
-			0.2684154730346844,
-			0.2682473408148568,
-			0.2680792004237478,
-			0.2679110518664791,
-			0.2677428951481735,
-			0.2675747302739527,
-			0.2674065572489396,
-			0.2672383760782570,
-			0.2670701867670277,
-			0.2669019893203757,
-			0.2667337837434240,
-			0.2665655700412964,
-			0.2663973482191176,
-			0.2662291182820112,
-			0.2660608802351022,
-			0.2658926340835157,
-			0.2657243798323758,
-			0.2655561174868088,
-			0.2653878470519398,
-			0.2652195685328947,
-			0.2650512819347998,
-			0.2648829872627808,
-			0.2647146845219647,
-			0.2645463737174782,
-			0.2643780548544485,
-			0.2642097279380023,
-			0.2640413929732682,
-			0.2638730499653730,
-			0.2637046989194449,
-			0.2635363398406125,
-			0.2633679727340041,
-			0.2631995976047487,
-			0.2630312144579749,
-			0.2628628232988119,
-			0.2626944241323900,
-			0.2625260169638380,
-			0.2623576017982860,
-			0.2621891786408647,
-			0.2620207474967043,
-			0.2618523083709355,
-			0.2616838612686895,
-			0.2615154061950969,
-			0.2613469431552896,
-			0.2611784721543992,
-			0.2610099931975576,
-			0.2608415062898970,
-			0.2606730114365497,
-			0.2605045086426485,
-			0.2603359979133261,
-			0.2601674792537155,
-			0.2599989526689505,
-			0.2598304181641647,
-			0.2596618757444917,
-			0.2594933254150653,
-			0.2593247671810205,
-			0.2591562010474915,
-			0.2589876270196135,
-			0.2588190451025207,
-			0.2586504553013493,
-			0.2584818576212344,
-			0.2583132520673119,
-			0.2581446386447175,
-			0.2579760173585883,
-			0.2578073882140599,
-			0.2576387512162692,
-			0.2574701063703538,
-			0.2573014536814503,
-			0.2571327931546961,
-			0.2569641247952295,
-			0.2567954486081876,
-			0.2566267645987095,
-			0.2564580727719329,
-			0.2562893731329965,
-			0.2561206656870398,
-			0.2559519504392010,
-			0.2557832273946203,
-			0.2556144965584370,
-			0.2554457579357905,
-			0.2552770115318215,
-			0.2551082573516700,
-			0.2549394954004767,
-			0.2547707256833824,
-			0.2546019482055276,
-			0.2544331629720543,
-			0.2542643699881035,
-			0.2540955692588172,
-			0.2539267607893370,
-			0.2537579445848057,
-			0.2535891206503653,
-			0.2534202889911582,
-			0.2532514496123282,
-			0.2530826025190175,
-			0.2529137477163700,
-			0.2527448852095295,
-			0.2525760150036390,
-			0.2524071371038437,
-			0.2522382515152870,
-			0.2520693582431136,
-			0.2519004572924689,
-			0.2517315486684971,
-			0.2515626323763440,
-			0.2513937084211552,
-			0.2512247768080756,
-			0.2510558375422520,
-			0.2508868906288302,
-			0.2507179360729567,
-			0.2505489738797784,
-			0.2503800040544415,
-			0.2502110266020937,
-			0.2500420415278822,
-			0.2498730488369544,
-			0.2497040485344585,
-			0.2495350406255425,
-			0.2493660251153542,
-			0.2491970020090423,
-			0.2490279713117559,
-			0.2488589330286436,
-			0.2486898871648547,
-			0.2485208337255387,
-			0.2483517727158452,
-			0.2481827041409242,
-			0.2480136280059256,
-			0.2478445443159997,
-			0.2476754530762976,
-			0.2475063542919697,
-			0.2473372479681670,
-			0.2471681341100410,
-			0.2469990127227428,
-			0.2468298838114246,
-			0.2466607473812385,
-			0.2464916034373359,
-			0.2463224519848701,
-			0.2461532930289932,
-			0.2459841265748581,
-			0.2458149526276181,
-			0.2456457711924263,
-			0.2454765822744366,
-			0.2453073858788027,
-			0.2451381820106782,
-			0.2449689706752179,
-			0.2447997518775760,
-			0.2446305256229073,
-			0.2444612919163664,
-			0.2442920507631092,
-			0.2441228021682903,
-			0.2439535461370657,
-			0.2437842826745911,
-			0.2436150117860224,
-			0.2434457334765165,
-			0.2432764477512293,
-			0.2431071546153175,
-			0.2429378540739387,
-			0.2427685461322493,
-			0.2425992307954074,
-			0.2424299080685704,
-			0.2422605779568958,
-			0.2420912404655424,
-			0.2419218955996679,
-			0.2417525433644308,
-			0.2415831837649906,
-			0.2414138168065054,
-			0.2412444424941350,
-			0.2410750608330389,
-			0.2409056718283761,
-			0.2407362754853070,
-			0.2405668718089917,
-			0.2403974608045905,
-			0.2402280424772636,
-			0.2400586168321725,
-			0.2398891838744776,
-			0.2397197436093402,
-			0.2395502960419219,
-			0.2393808411773841,
-			0.2392113790208894,
-			0.2390419095775991,
-			0.2388724328526757,
-			0.2387029488512821,
-			0.2385334575785808,
-			0.2383639590397350,
-			0.2381944532399080,
-			0.2380249401842625,
-			0.2378554198779630,
-			0.2376858923261731,
-			0.2375163575340567,
-			0.2373468155067787,
-			0.2371772662495030,
-			0.2370077097673947,
-			0.2368381460656190,
-			0.2366685751493401,
-			0.2364989970237245,
-			0.2363294116939378,
-			0.2361598191651451,
-			0.2359902194425132,
-			0.2358206125312083,
-			0.2356509984363966,
-			0.2354813771632450,
-			0.2353117487169203,
-			0.2351421131025900,
-			0.2349724703254215,
-			0.2348028203905819,
-			0.2346331633032396,
-			0.2344634990685624,
-			0.2342938276917186,
-			0.2341241491778765,
-			0.2339544635322055,
-			0.2337847707598737,
-			0.2336150708660506,
-			0.2334453638559055,
-			0.2332756497346077,
-			0.2331059285073278,
-			0.2329362001792350,
-			0.2327664647554995,
-			0.2325967222412926,
-			0.2324269726417839,
-			0.2322572159621449,
-			0.2320874522075468,
-			0.2319176813831602,
-			0.2317479034941573,
-			0.2315781185457095,
-			0.2314083265429889,
-			0.2312385274911677,
-			0.2310687213954178,
-			0.2308989082609124,
-			0.2307290880928242,
-			0.2305592608963256,
-			0.2303894266765906,
-			0.2302195854387923,
-			0.2300497371881045,
-			0.2298798819297007,
-			0.2297100196687556,
-			0.2295401504104431,
-			0.2293702741599377,
-			0.2292003909224143,
-			0.2290305007030474,
-			0.2288606035070130,
-			0.2286906993394858,
-			0.2285207882056413,
-			0.2283508701106559,
-			0.2281809450597048,
-			0.2280110130579649,
-			0.2278410741106126,
-			0.2276711282228239,
-			0.2275011753997762,
-			0.2273312156466464,
-			0.2271612489686119,
-			0.2269912753708502,
-			0.2268212948585384,
-			0.2266513074368551,
-			0.2264813131109782,
-			0.2263113118860857,
-			0.2261413037673567,
-			0.2259712887599699,
-			0.2258012668691038,
-			0.2256312380999375,
-			0.2254612024576512,
-			0.2252911599474237,
-			0.2251211105744350,
-			0.2249510543438649,
-			0.2247809912608941,
-			0.2246109213307030,
-			0.2244408445584717,
-			0.2242707609493812,
-			0.2241006705086128,
-			0.2239305732413476,
-			0.2237604691527669,
-			0.2235903582480530,
-			0.2234202405323870,
-			0.2232501160109514,
-			0.2230799846889283,
-			0.2229098465715002,
-			0.2227397016638502,
-			0.2225695499711607,
-			0.2223993914986148,
-			0.2222292262513965,
-			0.2220590542346884,
-			0.2218888754536750,
-			0.2217186899135401,
-			0.2215484976194672,
-			0.2213782985766415,
-			0.2212080927902471,
-			0.2210378802654689,
-			0.2208676610074920,
-			0.2206974350215011,
-			0.2205272023126820,
-			0.2203569628862205,
-			0.2201867167473016,
-			0.2200164639011119,
-			0.2198462043528376,
-			0.2196759381076649,
-			0.2195056651707802,
-			0.2193353855473711,
-			0.2191650992426238,
-			0.2189948062617257,
-			0.2188245066098647,
-			0.2186542002922276,
-			0.2184838873140031,
-			0.2183135676803787,
-			0.2181432413965425,
-			0.2179729084676836,
-			0.2178025688989897,
-			0.2176322226956505,
-			0.2174618698628549,
-			0.2172915104057915,
-			0.2171211443296504,
-			0.2169507716396210,
-			0.2167803923408933,
-			0.2166100064386574,
-			0.2164396139381029,
-			0.2162692148444210,
-			0.2160988091628021,
-			0.2159283968984371,
-			0.2157579780565167,
-			0.2155875526422329,
-			0.2154171206607766,
-			0.2152466821173392,
-			0.2150762370171135,
-			0.2149057853652907,
-			0.2147353271670631,
-			0.2145648624276238,
-			0.2143943911521647,
-			0.2142239133458794,
-			0.2140534290139603,
-			0.2138829381616006,
-			0.2137124407939944,
-			0.2135419369163349,
-			0.2133714265338160,
-			0.2132009096516321,
-			0.2130303862749766,
-			0.2128598564090447,
-			0.2126893200590308,
-			0.2125187772301295,
-			0.2123482279275365,
-			0.2121776721564463,
-			0.2120071099220547,
-			0.2118365412295573,
-			0.2116659660841495,
-			0.2114953844910279,
-			0.2113247964553888,
-			0.2111542019824278,
-			0.2109836010773422,
-			0.2108129937453286,
-			0.2106423799915840,
-			0.2104717598213054,
-			0.2103011332396908,
-			0.2101305002519371,
-			0.2099598608632426,
-			0.2097892150788046,
-			0.2096185629038218,
-			0.2094479043434925,
-			0.2092772394030152,
-			0.2091065680875884,
-			0.2089358904024118,
-			0.2087652063526837,
-			0.2085945159436036,
-			0.2084238191803717,
-			0.2082531160681867,
-			0.2080824066122495,
-			0.2079116908177595,
-			0.2077409686899170,
-			0.2075702402339231,
-			0.2073995054549778,
-			0.2072287643582825,
-			0.2070580169490382,
-			0.2068872632324457,
-			0.2067165032137069,
-			0.2065457368980234,
-			0.2063749642905970,
-			0.2062041853966294,
-			0.2060334002213236,
-			0.2058626087698814,
-			0.2056918110475054,
-			0.2055210070593986,
-			0.2053501968107637,
-			0.2051793803068046,
-			0.2050085575527239,
-			0.2048377285537253,
-			0.2046668933150130,
-			0.2044960518417905,
-			0.2043252041392618,
-			0.2041543502126318,
-			0.2039834900671043,
-			0.2038126237078849,
-			0.2036417511401777,
-			0.2034708723691878,
-			0.2032999874001211,
-			0.2031290962381822,
-			0.2029581988885775,
-			0.2027872953565127,
-			0.2026163856471932,
-			0.2024454697658259,
-			0.2022745477176170,
-			0.2021036195077730,
-			0.2019326851415005,
-			0.2017617446240070,
-			0.2015907979604992,
-			0.2014198451561845,
-			0.2012488862162702,
-			0.2010779211459646,
-			0.2009069499504754,
-			0.2007359726350103,
-			0.2005649892047777,
-			0.2003939996649863,
-			0.2002230040208446,
-			0.2000520022775613,
-			0.1998809944403459,
-			0.1997099805144070,
-			0.1995389605049545,
-			0.1993679344171974,
-			0.1991969022563456,
-			0.1990258640276093,
-			0.1988548197361986,
-			0.1986837693873234,
-			0.1985127129861950,
-			0.1983416505380233,
-			0.1981705820480194,
-			0.1979995075213945,
-			0.1978284269633594,
-			0.1976573403791261,
-			0.1974862477739060,
-			0.1973151491529105,
-			0.1971440445213522,
-			0.1969729338844425,
-			0.1968018172473943,
-			0.1966306946154202,
-			0.1964595659937322,
-			0.1962884313875438,
-			0.1961172908020679,
-			0.1959461442425177,
-			0.1957749917141064,
-			0.1956038332220482,
-			0.1954326687715564,
-			0.1952614983678450,
-			0.1950903220161283,
-			0.1949191397216203,
-			0.1947479514895363,
-			0.1945767573250902,
-			0.1944055572334969,
-			0.1942343512199721,
-			0.1940631392897304,
-			0.1938919214479873,
-			0.1937206976999589,
-			0.1935494680508602,
-			0.1933782325059078,
-			0.1932069910703177,
-			0.1930357437493058,
-			0.1928644905480893,
-			0.1926932314718840,
-			0.1925219665259074,
-			0.1923506957153766,
-			0.1921794190455082,
-			0.1920081365215200,
-			0.1918368481486296,
-			0.1916655539320547,
-			0.1914942538770129,
-			0.1913229479887229,
-			0.1911516362724025,
-			0.1909803187332703,
-			0.1908089953765449,
-			0.1906376662074449,
-			0.1904663312311900,
-			0.1902949904529986,
-			0.1901236438780902,
-			0.1899522915116846,
-			0.1897809333590013,
-			0.1896095694252601,
-			0.1894381997156815,
-			0.1892668242354849,
-			0.1890954429898913,
-			0.1889240559841213,
-			0.1887526632233952,
-			0.1885812647129343,
-			0.1884098604579596,
-			0.1882384504636923,
-			0.1880670347353542,
-			0.1878956132781662,
-			0.1877241860973507,
-			0.1875527531981295,
-			0.1873813145857245,
-			0.1872098702653585,
-			0.1870384202422540,
-			0.1868669645216331,
-			0.1866955031087191,
-			0.1865240360087346,
-			0.1863525632269032,
-			0.1861810847684484,
-			0.1860096006385930,
-			0.1858381108425614,
-			0.1856666153855772,
-			0.1854951142728645,
-			0.1853236075096473,
-			0.1851520951011506,
-			0.1849805770525983,
-			0.1848090533692153,
-			0.1846375240562270,
-			0.1844659891188576,
-			0.1842944485623334,
-			0.1841229023918790,
-			0.1839513506127200,
-			0.1837797932300829,
-			0.1836082302491930,
-			0.1834366616752764,
-			0.1832650875135599,
-			0.1830935077692692,
-			0.1829219224476316,
-			0.1827503315538737,
-			0.1825787350932220,
-			0.1824071330709044,
-			0.1822355254921474,
-			0.1820639123621791,
-			0.1818922936862271,
-			0.1817206694695185,
-			0.1815490397172820,
-			0.1813774044347456,
-			0.1812057636271374,
-			0.1810341172996858,
-			0.1808624654576201,
-			0.1806908081061685,
-			0.1805191452505598,
-			0.1803474768960240,
-			0.1801758030477895,
-			0.1800041237110866,
-			0.1798324388911443,
-			0.1796607485931925,
-			0.1794890528224615,
-			0.1793173515841813,
-			0.1791456448835823,
-			0.1789739327258950,
-			0.1788022151163496,
-			0.1786304920601774,
-			0.1784587635626096,
-			0.1782870296288765,
-			0.1781152902642101,
-			0.1779435454738418,
-			0.1777717952630031,
-			0.1776000396369261,
-			0.1774282786008420,
-			0.1772565121599838,
-			0.1770847403195834,
-			0.1769129630848733,
-			0.1767411804610861,
-			0.1765693924534550,
-			0.1763975990672125,
-			0.1762258003075916,
-			0.1760539961798261,
-			0.1758821866891492,
-			0.1757103718407947,
-			0.1755385516399960,
-			0.1753667260919871,
-			0.1751948952020024,
-			0.1750230589752760,
-			0.1748512174170422,
-			0.1746793705325362,
-			0.1745075183269920,
-			0.1743356608056448,
-			0.1741637979737298,
-			0.1739919298364818,
-			0.1738200563991371,
-			0.1736481776669304,
-			0.1734762936450976,
-			0.1733044043388751,
-			0.1731325097534983,
-			0.1729606098942037,
-			0.1727887047662277,
-			0.1726167943748065,
-			0.1724448787251773,
-			0.1722729578225769,
-			0.1721010316722417,
-			0.1719291002794095,
-			0.1717571636493175,
-			0.1715852217872030,
-			0.1714132746983040,
-			0.1712413223878577,
-			0.1710693648611026,
-			0.1708974021232767,
-			0.1707254341796182,
-			0.1705534610353654,
-			0.1703814826957575,
-			0.1702094991660326,
-			0.1700375104514297,
-			0.1698655165571885,
-			0.1696935174885473,
-			0.1695215132507464,
-			0.1693495038490248,
-			0.1691774892886220,
-			0.1690054695747786,
-			0.1688334447127338,
-			0.1686614147077284,
-			0.1684893795650028,
-			0.1683173392897967,
-			0.1681452938873515,
-			0.1679732433629079,
-			0.1678011877217064,
-			0.1676291269689886,
-			0.1674570611099956,
-			0.1672849901499688,
-			0.1671129140941500,
-			0.1669408329477803,
-			0.1667687467161023,
-			0.1665966554043578,
-			0.1664245590177890,
-			0.1662524575616380,
-			0.1660803510411479,
-			0.1659082394615609,
-			0.1657361228281196,
-			0.1655640011460676,
-			0.1653918744206477,
-			0.1652197426571035,
-			0.1650476058606778,
-			0.1648754640366144,
-			0.1647033171901574,
-			0.1645311653265504,
-			0.1643590084510375,
-			0.1641868465688630,
-			0.1640146796852711,
-			0.1638425078055063,
-			0.1636703309348134,
-			0.1634981490784368,
-			0.1633259622416221,
-			0.1631537704296143,
-			0.1629815736476582,
-			0.1628093719009995,
-			0.1626371651948837,
-			0.1624649535345566,
-			0.1622927369252640,
-			0.1621205153722517,
-			0.1619482888807663,
-			0.1617760574560542,
-			0.1616038211033613,
-			0.1614315798279344,
-			0.1612593336350205,
-			0.1610870825298664,
-			0.1609148265177194,
-			0.1607425656038261,
-			0.1605702997934345,
-			0.1603980290917918,
-			0.1602257535041457,
-			0.1600534730357439,
-			0.1598811876918349,
-			0.1597088974776663,
-			0.1595366023984862,
-			0.1593643024595437,
-			0.1591919976660865,
-			0.1590196880233641,
-			0.1588473735366251,
-			0.1586750542111180,
-			0.1585027300520929,
-			0.1583304010647980,
-			0.1581580672544835,
-			0.1579857286263990,
-			0.1578133851857936,
-			0.1576410369379178,
-			0.1574686838880216,
-			0.1572963260413546,
-			0.1571239634031678,
-			0.1569515959787113,
-			0.1567792237732358,
-			0.1566068467919922,
-			0.1564344650402309,
-			0.1562620785232035,
-			0.1560896872461610,
-			0.1559172912143548,
-			0.1557448904330360,
-			0.1555724849074570,
-			0.1554000746428689,
-			0.1552276596445236,
-			0.1550552399176739,
-			0.1548828154675710,
-			0.1547103862994680,
-			0.1545379524186174,
-			0.1543655138302711,
-			0.1541930705396826,
-			0.1540206225521045,
-			0.1538481698727900,
-			0.1536757125069925,
-			0.1535032504599647,
-			0.1533307837369607,
-			0.1531583123432339,
-			0.1529858362840379,
-			0.1528133555646271,
-			0.1526408701902555,
-			0.1524683801661769,
-			0.1522958854976460,
-			0.1521233861899168,
-			0.1519508822482445,
-			0.1517783736778836,
-			0.1516058604840888,
-			0.1514333426721157,
-			0.1512608202472194,
-			0.1510882932146548,
-			0.1509157615796774,
-			0.1507432253475432,
-			0.1505706845235078,
-			0.1503981391128271,
-			0.1502255891207571,
-			0.1500530345525539,
-			0.1498804754134740,
-			0.1497079117087736,
-			0.1495353434437094,
-			0.1493627706235385,
-			0.1491901932535172,
-			0.1490176113389027,
-			0.1488450248849523,
-			0.1486724338969229,
-			0.1484998383800724,
-			0.1483272383396584,
-			0.1481546337809378,
-			0.1479820247091695,
-			0.1478094111296108,
-			0.1476367930475197,
-			0.1474641704681549,
-			0.1472915433967746,
-			0.1471189118386371,
-			0.1469462757990020,
-			0.1467736352831267,
-			0.1466009902962710,
-			0.1464283408436937,
-			0.1462556869306544,
-			0.1460830285624114,
-			0.1459103657442256,
-			0.1457376984813556,
-			0.1455650267790615,
-			0.1453923506426031,
-			0.1452196700772403,
-			0.1450469850882337,
-			0.1448742956808432,
-			0.1447016018603290,
-			0.1445289036319524,
-			0.1443562010009732,
-			0.1441834939726528,
-			0.1440107825522523,
-			0.1438380667450321,
-			0.1436653465562543,
-			0.1434926219911793,
-			0.1433198930550693,
-			0.1431471597531860,
-			0.1429744220907901,
-			0.1428016800731450,
-			0.1426289337055117,
-			0.1424561829931527,
-			0.1422834279413299,
-			0.1421106685553063,
-			0.1419379048403445,
-			0.1417651368017061,
-			0.1415923644446556,
-			0.1414195877744544,
-			0.1412468067963669,
-			0.1410740215156550,
-			0.1409012319375828,
-			0.1407284380674137,
-			0.1405556399104110,
-			0.1403828374718389,
-			0.1402100307569610,
-			0.1400372197710416,
-			0.1398644045193441,
-			0.1396915850071334,
-			0.1395187612396737,
-			0.1393459332222295,
-			0.1391731009600657,
-			0.1390002644584461,
-			0.1388274237226371,
-			0.1386545787579026,
-			0.1384817295695080,
-			0.1383088761627193,
-			0.1381360185428004,
-			0.1379631567150184,
-			0.1377902906846382,
-			0.1376174204569254,
-			0.1374445460371466,
-			0.1372716674305674,
-			0.1370987846424544,
-			0.1369258976780734,
-			0.1367530065426907,
-			0.1365801112415735,
-			0.1364072117799883,
-			0.1362343081632017,
-			0.1360614003964806,
-			0.1358884884850929,
-			0.1357155724343044,
-			0.1355426522493834,
-			0.1353697279355972,
-			0.1351967994982130,
-			0.1350238669424995,
-			0.1348509302737231,
-			0.1346779894971527,
-			0.1345050446180562,
-			0.1343320956417014,
-			0.1341591425733573,
-			0.1339861854182922,
-			0.1338132241817743,
-			0.1336402588690723,
-			0.1334672894854554,
-			0.1332943160361924,
-			0.1331213385265521,
-			0.1329483569618046,
-			0.1327753713472180,
-			0.1326023816880624,
-			0.1324293879896074,
-			0.1322563902571222,
-			0.1320833884958778,
-			0.1319103827111425,
-			0.1317373729081875,
-			0.1315643590922826,
-			0.1313913412686979,
-			0.1312183194427043,
-			0.1310452936195724,
-			0.1308722638045723,
-			0.1306992300029751,
-			0.1305261922200517,
-			0.1303531504610729,
-			0.1301801047313103,
-			0.1300070550360352,
-			0.1298340013805182,
-			0.1296609437700319,
-			0.1294878822098469,
-			0.1293148167052357,
-			0.1291417472614702,
-			0.1289686738838214,
-			0.1287955965775628,
-			0.1286225153479658,
-			0.1284494302003029,
-			0.1282763411398468,
-			0.1281032481718693,
-			0.1279301513016444,
-			0.1277570505344439,
-			0.1275839458755413,
-			0.1274108373302091,
-			0.1272377249037211,
-			0.1270646086013506,
-			0.1268914884283701,
-			0.1267183643900548,
-			0.1265452364916766,
-			0.1263721047385104,
-			0.1261989691358297,
-			0.1260258296889084,
-			0.1258526864030214,
-			0.1256795392834417,
-			0.1255063883354446,
-			0.1253332335643043,
-			0.1251600749752955,
-			0.1249869125736922,
-			0.1248137463647705,
-			0.1246405763538044,
-			0.1244674025460691,
-			0.1242942249468405,
-			0.1241210435613924,
-			0.1239478583950018,
-			0.1237746694529434,
-			0.1236014767404926,
-			0.1234282802629260,
-			0.1232550800255186,
-			0.1230818760335471,
-			0.1229086682922871,
-			0.1227354568070148,
-			0.1225622415830069,
-			0.1223890226255396,
-			0.1222157999398894,
-			0.1220425735313334,
-			0.1218693434051475,
-			0.1216961095666094,
-			0.1215228720209957,
-			0.1213496307735838,
-			0.1211763858296504,
-			0.1210031371944737,
-			0.1208298848733305,
-			0.1206566288714983,
-			0.1204833691942554,
-			0.1203101058468788,
-			0.1201368388346470,
-			0.1199635681628381,
-			0.1197902938367296,
-			0.1196170158616002,
-			0.1194437342427279,
-			0.1192704489853916,
-			0.1190971600948699,
-			0.1189238675764410,
-			0.1187505714353838,
-			0.1185772716769775,
-			0.1184039683065009,
-			0.1182306613292331,
-			0.1180573507504540,
-			0.1178840365754416,
-			0.1177107188094764,
-			0.1175373974578377,
-			0.1173640725258049,
-			0.1171907440186586,
-			0.1170174119416775,
-			0.1168440763001425,
-			0.1166707370993333,
-			0.1164973943445300,
-			0.1163240480410134,
-			0.1161506981940636,
-			0.1159773448089615,
-			0.1158039878909870,
-			0.1156306274454216,
-			0.1154572634775458,
-			0.1152838959926406,
-			0.1151105249959874,
-			0.1149371504928664,
-			0.1147637724885605,
-			0.1145903909883495,
-			0.1144170059975158,
-			0.1142436175213410,
-			0.1140702255651060,
-			0.1138968301340938,
-			0.1137234312335856,
-			0.1135500288688636,
-			0.1133766230452099,
-			0.1132032137679066,
-			0.1130298010422366,
-			0.1128563848734818,
-			0.1126829652669249,
-			0.1125095422278484,
-			0.1123361157615355,
-			0.1121626858732688,
-			0.1119892525683311,
-			0.1118158158520063,
-			0.1116423757295764,
-			0.1114689322063255,
-			0.1112954852875367,
-			0.1111220349784933,
-			0.1109485812844799,
-			0.1107751242107787,
-			0.1106016637626745,
-			0.1104281999454510,
-			0.1102547327643920,
-			0.1100812622247819,
-			0.1099077883319051,
-			0.1097343110910454,
-			0.1095608305074872,
-			0.1093873465865157,
-			0.1092138593334146,
-			0.1090403687534695,
-			0.1088668748519647,
-			0.1086933776341850,
-			0.1085198771054162,
-			0.1083463732709424,
-			0.1081728661360496,
-			0.1079993557060231,
-			0.1078258419861476,
-			0.1076523249817094,
-			0.1074788046979938,
-			0.1073052811402866,
-			0.1071317543138735,
-			0.1069582242240409,
-			0.1067846908760743,
-			0.1066111542752600,
-			0.1064376144268842,
-			0.1062640713362331,
-			0.1060905250085935,
-			0.1059169754492519,
-			0.1057434226634942,
-			0.1055698666566082,
-			0.1053963074338798,
-			0.1052227450005964,
-			0.1050491793620451,
-			0.1048756105235122,
-			0.1047020384902864,
-			0.1045284632676535,
-			0.1043548848609017,
-			0.1041813032753185,
-			0.1040077185161912,
-			0.1038341305888074,
-			0.1036605394984553,
-			0.1034869452504226,
-			0.1033133478499970,
-			0.1031397473024676,
-			0.1029661436131212,
-			0.1027925367872469,
-			0.1026189268301329,
-			0.1024453137470674,
-			0.1022716975433398,
-			0.1020980782242373,
-			0.1019244557950502,
-			0.1017508302610664,
-			0.1015772016275748,
-			0.1014035698998649,
-			0.1012299350832257,
-			0.1010562971829466,
-			0.1008826562043159,
-			0.1007090121526244,
-			0.1005353650331609,
-			0.1003617148512149,
-			0.1001880616120765,
-			0.1000144053210346,
-			0.0998407459833804,
-			0.0996670836044029,
-			0.0994934181893922,
-			0.0993197497436391,
-			0.0991460782724330,
-			0.0989724037810651,
-			0.0987987262748251,
-			0.0986250457590039,
-			0.0984513622388917,
-			0.0982776757197798,
-			0.0981039862069587,
-			0.0979302937057195,
-			0.0977565982213527,
-			0.0975828997591495,
-			0.0974091983244013,
-			0.0972354939223993,
-			0.0970617865584346,
-			0.0968880762377994,
-			0.0967143629657840,
-			0.0965406467476809,
-			0.0963669275887815,
-			0.0961932054943774,
-			0.0960194804697614,
-			0.0958457525202241,
-			0.0956720216510584,
-			0.0954982878675563,
-			0.0953245511750098,
-			0.0951508115787116,
-			0.0949770690839541,
-			0.0948033236960295,
-			0.0946295754202303,
-			0.0944558242618496,
-			0.0942820702261800,
-			0.0941083133185141,
-			0.0939345535441456,
-			0.0937607909083664,
-			0.0935870254164706,
-			0.0934132570737506,
-			0.0932394858855002,
-			0.0930657118570130,
-			0.0928919349935815,
-			0.0927181553005002,
-			0.0925443727830623,
-			0.0923705874465617,
-			0.0921967992962918,
-			0.0920230083375470,
-			0.0918492145756214,
-			0.0916754180158084,
-			0.0915016186634025,
-			0.0913278165236977,
-			0.0911540116019888,
-			0.0909802039035701,
-			0.0908063934337352,
-			0.0906325801977803,
-			0.0904587642009985,
-			0.0902849454486854,
-			0.0901111239461358,
-			0.0899372996986437,
-			0.0897634727115055,
-			0.0895896429900153,
-			0.0894158105394686,
-			0.0892419753651605,
-			0.0890681374723861,
-			0.0888942968664416,
-			0.0887204535526217,
-			0.0885466075362223,
-			0.0883727588225388,
-			0.0881989074168677,
-			0.0880250533245034,
-			0.0878511965507433,
-			0.0876773371008825,
-			0.0875034749802171,
-			0.0873296101940441,
-			0.0871557427476581,
-			0.0869818726463571,
-			0.0868079998954365,
-			0.0866341245001928,
-			0.0864602464659229,
-			0.0862863657979234,
-			0.0861124825014911,
-			0.0859385965819219,
-			0.0857647080445139,
-			0.0855908168945634,
-			0.0854169231373673,
-			0.0852430267782234,
-			0.0850691278224279,
-			0.0848952262752791,
-			0.0847213221420735,
-			0.0845474154281088,
-			0.0843735061386829,
-			0.0841995942790925,
-			0.0840256798546361,
-			0.0838517628706114,
-			0.0836778433323154,
-			0.0835039212450469,
-			0.0833299966141034,
-			0.0831560694447830,
-			0.0829821397423842,
-			0.0828082075122046,
-			0.0826342727595425,
-			0.0824603354896968,
-			0.0822863957079656,
-			0.0821124534196473,
-			0.0819385086300412,
-			0.0817645613444448,
-			0.0815906115681576,
-			0.0814166593064783,
-			0.0812427045647055,
-			0.0810687473481387,
-			0.0808947876620768,
-			0.0807208255118185,
-			0.0805468609026633,
-			0.0803728938399101,
-			0.0801989243288589,
-			0.0800249523748087,
-			0.0798509779830593,
-			0.0796770011589095,
-			0.0795030219076598,
-			0.0793290402346095,
-			0.0791550561450582,
-			0.0789810696443067,
-			0.0788070807376536,
-			0.0786330894303997,
-			0.0784590957278450,
-			0.0782850996352893,
-			0.0781111011580338,
-			0.0779371003013772,
-			0.0777630970706215,
-			0.0775890914710661,
-			0.0774150835080118,
-			0.0772410731867591,
-			0.0770670605126089,
-			0.0768930454908620,
-			0.0767190281268184,
-			0.0765450084257804,
-			0.0763709863930474,
-			0.0761969620339214,
-			0.0760229353537035,
-			0.0758489063576938,
-			0.0756748750511952,
-			0.0755008414395074,
-			0.0753268055279327,
-			0.0751527673217724,
-			0.0749787268263275,
-			0.0748046840469005,
-			0.0746306389887923,
-			0.0744565916573049,
-			0.0742825420577399,
-			0.0741084901953991,
-			0.0739344360755849,
-			0.0737603797035991,
-			0.0735863210847435,
-			0.0734122602243201,
-			0.0732381971276316,
-			0.0730641317999801,
-			0.0728900642466676,
-			0.0727159944729975,
-			0.0725419224842708,
-			0.0723678482857911,
-			0.0721937718828606,
-			0.0720196932807823,
-			0.0718456124848585,
-			0.0716715295003919,
-			0.0714974443326860,
-			0.0713233569870433,
-			0.0711492674687670,
-			0.0709751757831598,
-			0.0708010819355255,
-			0.0706269859311668,
-			0.0704528877753868,
-			0.0702787874734896,
-			0.0701046850307776,
-			0.0699305804525551,
-			0.0697564737441255,
-			0.0695823649107917,
-			0.0694082539578583,
-			0.0692341408906282,
-			0.0690600257144058,
-			0.0688859084344949,
-			0.0687117890561986,
-			0.0685376675848221,
-			0.0683635440256687,
-			0.0681894183840427,
-			0.0680152906652480,
-			0.0678411608745893,
-			0.0676670290173708,
-			0.0674928950988966,
-			0.0673187591244712,
-			0.0671446210993989,
-			0.0669704810289852,
-			0.0667963389185333,
-			0.0666221947733488,
-			0.0664480485987362,
-			0.0662739004000001,
-			0.0660997501824457,
-			0.0659255979513778,
-			0.0657514437121016,
-			0.0655772874699216,
-			0.0654031292301430,
-			0.0652289689980715,
-			0.0650548067790118,
-			0.0648806425782697,
-			0.0647064764011497,
-			0.0645323082529580,
-			0.0643581381389998,
-			0.0641839660645803,
-			0.0640097920350061,
-			0.0638356160555813,
-			0.0636614381316130,
-			0.0634872582684062,
-			0.0633130764712668,
-			0.0631388927455012,
-			0.0629647070964145,
-			0.0627905195293135,
-			0.0626163300495038,
-			0.0624421386622913,
-			0.0622679453729828,
-			0.0620937501868842,
-			0.0619195531093020,
-			0.0617453541455417,
-			0.0615711533009112,
-			0.0613969505807155,
-			0.0612227459902619,
-			0.0610485395348569,
-			0.0608743312198068,
-			0.0607001210504192,
-			0.0605259090319995,
-			0.0603516951698554,
-			0.0601774794692935,
-			0.0600032619356206,
-			0.0598290425741440,
-			0.0596548213901708,
-			0.0594805983890076,
-			0.0593063735759615,
-			0.0591321469563403,
-			0.0589579185354508,
-			0.0587836883186006,
-			0.0586094563110967,
-			0.0584352225182464,
-			0.0582609869453577,
-			0.0580867495977378,
-			0.0579125104806941,
-			0.0577382695995352,
-			0.0575640269595673,
-			0.0573897825660991,
-			0.0572155364244382,
-			0.0570412885398921,
-			0.0568670389177697,
-			0.0566927875633776,
-			0.0565185344820246,
-			0.0563442796790186,
-			0.0561700231596678,
-			0.0559957649292799,
-			0.0558215049931637,
-			0.0556472433566275,
-			0.0554729800249789,
-			0.0552987150035271,
-			0.0551244482975796,
-			0.0549501799124457,
-			0.0547759098534338,
-			0.0546016381258516,
-			0.0544273647350093,
-			0.0542530896862140,
-			0.0540788129847753,
-			0.0539045346360020,
-			0.0537302546452020,
-			0.0535559730176855,
-			0.0533816897587605,
-			0.0532074048737363,
-			0.0530331183679217,
-			0.0528588302466261,
-			0.0526845405151587,
-			0.0525102491788281,
-			0.0523359562429440,
-			0.0521616617128152,
-			0.0519873655937515,
-			0.0518130678910622,
-			0.0516387686100563,
-			0.0514644677560442,
-			0.0512901653343342,
-			0.0511158613502366,
-			0.0509415558090608,
-			0.0507672487161167,
-			0.0505929400767133,
-			0.0504186298961611,
-			0.0502443181797696,
-			0.0500700049328486,
-			0.0498956901607083,
-			0.0497213738686577,
-			0.0495470560620081,
-			0.0493727367460686,
-			0.0491984159261494,
-			0.0490240936075612,
-			0.0488497697956132,
-			0.0486754444956166,
-			0.0485011177128809,
-			0.0483267894527165,
-			0.0481524597204343,
-			0.0479781285213439,
-			0.0478037958607566,
-			0.0476294617439821,
-			0.0474551261763311,
-			0.0472807891631145,
-			0.0471064507096427,
-			0.0469321108212263,
-			0.0467577695031759,
-			0.0465834267608028,
-			0.0464090825994172,
-			0.0462347370243298,
-			0.0460603900408523,
-			0.0458860416542946,
-			0.0457116918699688,
-			0.0455373406931846,
-			0.0453629881292537,
-			0.0451886341834876,
-			0.0450142788611965,
-			0.0448399221676923,
-			0.0446655641082862,
-			0.0444912046882890,
-			0.0443168439130119,
-			0.0441424817877669,
-			0.0439681183178649,
-			0.0437937535086177,
-			0.0436193873653362,
-			0.0434450198933320,
-			0.0432706510979171,
-			0.0430962809844027,
-			0.0429219095581004,
-			0.0427475368243225,
-			0.0425731627883796,
-			0.0423987874555842,
-			0.0422244108312479,
-			0.0420500329206822,
-			0.0418756537291995,
-			0.0417012732621115,
-			0.0415268915247302,
-			0.0413525085223673,
-			0.0411781242603348,
-			0.0410037387439450,
-			0.0408293519785100,
-			0.0406549639693419,
-			0.0404805747217522,
-			0.0403061842410546,
-			0.0401317925325597,
-			0.0399573996015806,
-			0.0397830054534300,
-			0.0396086100934190,
-			0.0394342135268616,
-			0.0392598157590687,
-			0.0390854167953536,
-			0.0389110166410287,
-			0.0387366153014061,
-			0.0385622127817993,
-			0.0383878090875201,
-			0.0382134042238813,
-			0.0380389981961954,
-			0.0378645910097756,
-			0.0376901826699345,
-			0.0375157731819845,
-			0.0373413625512393,
-			0.0371669507830105,
-			0.0369925378826119,
-			0.0368181238553562,
-			0.0366437087065561,
-			0.0364692924415254,
-			0.0362948750655758,
-			0.0361204565840214,
-			0.0359460370021750,
-			0.0357716163253494,
-			0.0355971945588583,
-			0.0354227717080149,
-			0.0352483477781319,
-			0.0350739227745229,
-			0.0348994967025011,
-			0.0347250695673796,
-			0.0345506413744724,
-			0.0343762121290923,
-			0.0342017818365527,
-			0.0340273505021676,
-			0.0338529181312497,
-			0.0336784847291135,
-			0.0335040503010717,
-			0.0333296148524379,
-			0.0331551783885263,
-			0.0329807409146501,
-			0.0328063024361232,
-			0.0326318629582593,
-			0.0324574224863716,
-			0.0322829810257745,
-			0.0321085385817816,
-			0.0319340951597067,
-			0.0317596507648633,
-			0.0315852054025659,
-			0.0314107590781284,
-			0.0312363117968640,
-			0.0310618635640875,
-			0.0308874143851122,
-			0.0307129642652526,
-			0.0305385132098228,
-			0.0303640612241361,
-			0.0301896083135081,
-			0.0300151544832513,
-			0.0298406997386809,
-			0.0296662440851110,
-			0.0294917875278549,
-			0.0293173300722283,
-			0.0291428717235446,
-			0.0289684124871182,
-			0.0287939523682633,
-			0.0286194913722951,
-			0.0284450295045267,
-			0.0282705667702733,
-			0.0280961031748493,
-			0.0279216387235688,
-			0.0277471734217472,
-			0.0275727072746974,
-			0.0273982402877357,
-			0.0272237724661756,
-			0.0270493038153317,
-			0.0268748343405192,
-			0.0267003640470524,
-			0.0265258929402462,
-			0.0263514210254149,
-			0.0261769483078731,
-			0.0260024747929362,
-			0.0258280004859186,
-			0.0256535253921353,
-			0.0254790495169003,
-			0.0253045728655297,
-			0.0251300954433375,
-			0.0249556172556387,
-			0.0247811383077487,
-			0.0246066586049816,
-			0.0244321781526532,
-			0.0242576969560780,
-			0.0240832150205708,
-			0.0239087323514474,
-			0.0237342489540219,
-			0.0235597648336101,
-			0.0233852799955270,
-			0.0232107944450873,
-			0.0230363081876062,
-			0.0228618212283992,
-			0.0226873335727813,
-			0.0225128452260675,
-			0.0223383561935739,
-			0.0221638664806144,
-			0.0219893760925051,
-			0.0218148850345612,
-			0.0216403933120976,
-			0.0214659009304306,
-			0.0212914078948742,
-			0.0211169142107446,
-			0.0209424198833571,
-			0.0207679249180267,
-			0.0205934293200694,
-			0.0204189330948006,
-			0.0202444362475353,
-			0.0200699387835890,
-			0.0198954407082776,
-			0.0197209420269164,
-			0.0195464427448212,
-			0.0193719428673071,
-			0.0191974423996896,
-			0.0190229413472849,
-			0.0188484397154082,
-			0.0186739375093750,
-			0.0184994347345017,
-			0.0183249313961028,
-			0.0181504274994948,
-			0.0179759230499932,
-			0.0178014180529136,
-			0.0176269125135721,
-			0.0174524064372834,
-			0.0172778998293647,
-			0.0171033926951308,
-			0.0169288850398978,
-			0.0167543768689813,
-			0.0165798681876974,
-			0.0164053590013622,
-			0.0162308493152904,
-			0.0160563391347996,
-			0.0158818284652041,
-			0.0157073173118206,
-			0.0155328056799652,
-			0.0153582935749527,
-			0.0151837810021007,
-			0.0150092679667237,
-			0.0148347544741384,
-			0.0146602405296607,
-			0.0144857261386063,
-			0.0143112113062919,
-			0.0141366960380328,
-			0.0139621803391454,
-			0.0137876642149453,
-			0.0136131476707493,
-			0.0134386307118730,
-			0.0132641133436329,
-			0.0130895955713446,
-			0.0129150774003241,
-			0.0127405588358886,
-			0.0125660398833526,
-			0.0123915205480337,
-			0.0122170008352474,
-			0.0120424807503097,
-			0.0118679602985372,
-			0.0116934394852461,
-			0.0115189183157526,
-			0.0113443967953721,
-			0.0111698749294222,
-			0.0109953527232183,
-			0.0108208301820767,
-			0.0106463073113138,
-			0.0104717841162456,
-			0.0102972606021891,
-			0.0101227367744599,
-			0.0099482126383742,
-			0.0097736881992492,
-			0.0095991634624000,
-			0.0094246384331439,
-			0.0092501131167971,
-			0.0090755875186753,
-			0.0089010616440958,
-			0.0087265354983739,
-			0.0085520090868268,
-			0.0083774824147708,
-			0.0082029554875217,
-			0.0080284283103965,
-			0.0078539008887113,
-			0.0076793732277827,
-			0.0075048453329268,
-			0.0073303172094609,
-			0.0071557888627000,
-			0.0069812602979616,
-			0.0068067315205619,
-			0.0066322025358170,
-			0.0064576733490444,
-			0.0062831439655591,
-			0.0061086143906785,
-			0.0059340846297189,
-			0.0057595546879965,
-			0.0055850245708282,
-			0.0054104942835307,
-			0.0052359638314198,
-			0.0050614332198121,
-			0.0048869024540245,
-			0.0047123715393734,
-			0.0045378404811753,
-			0.0043633092847468,
-			0.0041887779554039,
-			0.0040142464984638,
-			0.0038397149192427,
-			0.0036651832230569,
-			0.0034906514152240,
-			0.0033161195010589,
-			0.0031415874858797,
-			0.0029670553750020,
-			0.0027925231737424,
-			0.0026179908874179,
-			0.0024434585213448,
-			0.0022689260808400,
-			0.0020943935712195,
-			0.0019198609978002,
-			0.0017453283658983,
-			0.0015707956808308,
-			0.0013962629479145,
-			0.0012217301724648,
-			0.0010471973598001,
-			0.0008726645152352,
-			0.0006981316440876,
-			0.0005235987516737,
-			0.0003490658433099,
-			0.0001745329243136,
-			0.0000000000000001,
-			-0.0001745329243133,
-			-0.0003490658433100,
-			-0.0005235987516738,
-			-0.0006981316440877,
-			-0.0008726645152350,
-			-0.0010471973597997,
-			-0.0012217301724652,
-			-0.0013962629479143,
-			-0.0015707956808309,
-			-0.0017453283658986,
-			-0.0019198609977998,
-			-0.0020943935712194,
-			-0.0022689260808399,
-			-0.0024434585213449,
-			-0.0026179908874182,
-			-0.0027925231737423,
-			-0.0029670553750018,
-			-0.0031415874858795,
-			-0.0033161195010590,
-			-0.0034906514152237,
-			-0.0036651832230573,
-			-0.0038397149192425,
-			-0.0040142464984636,
-			-0.0041887779554038,
-			-0.0043633092847465,
-			-0.0045378404811754,
-			-0.0047123715393735,
-			-0.0048869024540244,
-			-0.0050614332198122,
-			-0.0052359638314194,
-			-0.0054104942835305,
-			-0.0055850245708283,
-			-0.0057595546879964,
-			-0.0059340846297188,
-			-0.0061086143906784,
-			-0.0062831439655589,
-			-0.0064576733490440,
-			-0.0066322025358169,
-			-0.0068067315205620,
-			-0.0069812602979615,
-			-0.0071557888626999,
-			-0.0073303172094605,
-			-0.0075048453329271,
-			-0.0076793732277828,
-			-0.0078539008887112,
-			-0.0080284283103968,
-			-0.0082029554875216,
-			-0.0083774824147707,
-			-0.0085520090868264,
-			-0.0087265354983738,
-			-0.0089010616440954,
-			-0.0090755875186752,
-			-0.0092501131167970,
-			-0.0094246384331440,
-			-0.0095991634624001,
-			-0.0097736881992488,
-			-0.0099482126383743,
-			-0.0101227367744598,
-			-0.0102972606021890,
-			-0.0104717841162460,
-			-0.0106463073113135,
-			-0.0108208301820768,
-			-0.0109953527232181,
-			-0.0111698749294221,
-			-0.0113443967953724,
-			-0.0115189183157520,
-			-0.0116934394852462,
-			-0.0118679602985371,
-			-0.0120424807503095,
-			-0.0122170008352472,
-			-0.0123915205480336,
-			-0.0125660398833527,
-			-0.0127405588358880,
-			-0.0129150774003240,
-			-0.0130895955713445,
-			-0.0132641133436328,
-			-0.0134386307118731,
-			-0.0136131476707494,
-			-0.0137876642149457,
-			-0.0139621803391450,
-			-0.0141366960380327,
-			-0.0143112113062917,
-			-0.0144857261386064,
-			-0.0146602405296608,
-			-0.0148347544741385,
-			-0.0150092679667236,
-			-0.0151837810021004,
-			-0.0153582935749528,
-			-0.0155328056799650,
-			-0.0157073173118207,
-			-0.0158818284652040,
-			-0.0160563391347993,
-			-0.0162308493152908,
-			-0.0164053590013621,
-			-0.0165798681876975,
-			-0.0167543768689816,
-			-0.0169288850398975,
-			-0.0171033926951307,
-			-0.0172778998293645,
-			-0.0174524064372835,
-			-0.0176269125135719,
-			-0.0178014180529133,
-			-0.0179759230499931,
-			-0.0181504274994947,
-			-0.0183249313961027,
-			-0.0184994347345016,
-			-0.0186739375093753,
-			-0.0188484397154083,
-			-0.0190229413472848,
-			-0.0191974423996897,
-			-0.0193719428673068,
-			-0.0195464427448211,
-			-0.0197209420269165,
-			-0.0198954407082774,
-			-0.0200699387835891,
-			-0.0202444362475349,
-			-0.0204189330948005,
-			-0.0205934293200695,
-			-0.0207679249180266,
-			-0.0209424198833571,
-			-0.0211169142107445,
-			-0.0212914078948740,
-			-0.0214659009304302,
-			-0.0216403933120977,
-			-0.0218148850345613,
-			-0.0219893760925050,
-			-0.0221638664806143,
-			-0.0223383561935736,
-			-0.0225128452260679,
-			-0.0226873335727814,
-			-0.0228618212283991,
-			-0.0230363081876065,
-			-0.0232107944450870,
-			-0.0233852799955269,
-			-0.0235597648336102,
-			-0.0237342489540220,
-			-0.0239087323514475,
-			-0.0240832150205707,
-			-0.0242576969560779,
-			-0.0244321781526531,
-			-0.0246066586049817,
-			-0.0247811383077483,
-			-0.0249556172556390,
-			-0.0251300954433374,
-			-0.0253045728655296,
-			-0.0254790495169006,
-			-0.0256535253921347,
-			-0.0258280004859187,
-			-0.0260024747929361,
-			-0.0261769483078730,
-			-0.0263514210254147,
-			-0.0265258929402458,
-			-0.0267003640470525,
-			-0.0268748343405190,
-			-0.0270493038153316,
-			-0.0272237724661754,
-			-0.0273982402877355,
-			-0.0275727072746975,
-			-0.0277471734217468,
-			-0.0279216387235691,
-			-0.0280961031748492,
-			-0.0282705667702732,
-			-0.0284450295045266,
-			-0.0286194913722948,
-			-0.0287939523682636,
-			-0.0289684124871183,
-			-0.0291428717235445,
-			-0.0293173300722284,
-			-0.0294917875278550,
-			-0.0296662440851108,
-			-0.0298406997386810,
-			-0.0300151544832512,
-			-0.0301896083135077,
-			-0.0303640612241362,
-			-0.0305385132098227,
-			-0.0307129642652527,
-			-0.0308874143851120,
-			-0.0310618635640872,
-			-0.0312363117968641,
-			-0.0314107590781283,
-			-0.0315852054025660,
-			-0.0317596507648637,
-			-0.0319340951597063,
-			-0.0321085385817815,
-			-0.0322829810257744,
-			-0.0324574224863715,
-			-0.0326318629582592,
-			-0.0328063024361228,
-			-0.0329807409146502,
-			-0.0331551783885262,
-			-0.0333296148524378,
-			-0.0335040503010716,
-			-0.0336784847291134,
-			-0.0338529181312499,
-			-0.0340273505021673,
-			-0.0342017818365528,
-			-0.0343762121290922,
-			-0.0345506413744723,
-			-0.0347250695673797,
-			-0.0348994967025007,
-			-0.0350739227745230,
-			-0.0352483477781316,
-			-0.0354227717080148,
-			-0.0355971945588584,
-			-0.0357716163253495,
-			-0.0359460370021751,
-			-0.0361204565840213,
-			-0.0362948750655757,
-			-0.0364692924415250,
-			-0.0366437087065564,
-			-0.0368181238553563,
-			-0.0369925378826118,
-			-0.0371669507830104,
-			-0.0373413625512390,
-			-0.0375157731819848,
-			-0.0376901826699346,
-			-0.0378645910097757,
-			-0.0380389981961957,
-			-0.0382134042238809,
-			-0.0383878090875199,
-			-0.0385622127817992,
-			-0.0387366153014062,
-			-0.0389110166410288,
-			-0.0390854167953533,
-			-0.0392598157590685,
-			-0.0394342135268612,
-			-0.0396086100934191,
-			-0.0397830054534299,
-			-0.0399573996015809,
-			-0.0401317925325596,
-			-0.0403061842410543,
-			-0.0404805747217526,
-			-0.0406549639693416,
-			-0.0408293519785101,
-			-0.0410037387439449,
-			-0.0411781242603346,
-			-0.0413525085223672,
-			-0.0415268915247299,
-			-0.0417012732621116,
-			-0.0418756537291996,
-			-0.0420500329206821,
-			-0.0422244108312477,
-			-0.0423987874555841,
-			-0.0425731627883795,
-			-0.0427475368243222,
-			-0.0429219095581007,
-			-0.0430962809844028,
-			-0.0432706510979170,
-			-0.0434450198933319,
-			-0.0436193873653359,
-			-0.0437937535086176,
-			-0.0439681183178650,
-			-0.0441424817877667,
-			-0.0443168439130123,
-			-0.0444912046882886,
-			-0.0446655641082861,
-			-0.0448399221676924,
-			-0.0450142788611964,
-			-0.0451886341834877,
-			-0.0453629881292538,
-			-0.0455373406931845,
-			-0.0457116918699685,
-			-0.0458860416542947,
-			-0.0460603900408519,
-			-0.0462347370243299,
-			-0.0464090825994170,
-			-0.0465834267608027,
-			-0.0467577695031762,
-			-0.0469321108212260,
-			-0.0471064507096428,
-			-0.0472807891631144,
-			-0.0474551261763310,
-			-0.0476294617439820,
-			-0.0478037958607560,
-			-0.0479781285213440,
-			-0.0481524597204340,
-			-0.0483267894527164,
-			-0.0485011177128808,
-			-0.0486754444956164,
-			-0.0488497697956133,
-			-0.0490240936075608,
-			-0.0491984159261497,
-			-0.0493727367460685,
-			-0.0495470560620080,
-			-0.0497213738686580,
-			-0.0498956901607080,
-			-0.0500700049328487,
-			-0.0502443181797695,
-			-0.0504186298961610,
-			-0.0505929400767134,
-			-0.0507672487161164,
-			-0.0509415558090609,
-			-0.0511158613502364,
-			-0.0512901653343341,
-			-0.0514644677560439,
-			-0.0516387686100566,
-			-0.0518130678910623,
-			-0.0519873655937516,
-			-0.0521616617128151,
-			-0.0523359562429436,
-			-0.0525102491788280,
-			-0.0526845405151585,
-			-0.0528588302466262,
-			-0.0530331183679220,
-			-0.0532074048737360,
-			-0.0533816897587604,
-			-0.0535559730176854,
-			-0.0537302546452021,
-			-0.0539045346360019,
-			-0.0540788129847754,
-			-0.0542530896862139,
-			-0.0544273647350090,
-			-0.0546016381258517,
-			-0.0547759098534337,
-			-0.0549501799124458,
-			-0.0551244482975795,
-			-0.0552987150035267,
-			-0.0554729800249789,
-			-0.0556472433566274,
-			-0.0558215049931638,
-			-0.0559957649292802,
-			-0.0561700231596674,
-			-0.0563442796790185,
-			-0.0565185344820243,
-			-0.0566927875633775,
-			-0.0568670389177694,
-			-0.0570412885398920,
-			-0.0572155364244383,
-			-0.0573897825660990,
-			-0.0575640269595672,
-			-0.0577382695995348,
-			-0.0579125104806945,
-			-0.0580867495977379,
-			-0.0582609869453576,
-			-0.0584352225182467,
-			-0.0586094563110963,
-			-0.0587836883186005,
-			-0.0589579185354509,
-			-0.0591321469563401,
-			-0.0593063735759619,
-			-0.0594805983890073,
-			-0.0596548213901707,
-			-0.0598290425741441,
-			-0.0600032619356207,
-			-0.0601774794692936,
-			-0.0603516951698553,
-			-0.0605259090319994,
-			-0.0607001210504188,
-			-0.0608743312198069,
-			-0.0610485395348570,
-			-0.0612227459902620,
-			-0.0613969505807154,
-			-0.0615711533009108,
-			-0.0617453541455420,
-			-0.0619195531093014,
-			-0.0620937501868843,
-			-0.0622679453729827,
-			-0.0624421386622912,
-			-0.0626163300495036,
-			-0.0627905195293134,
-			-0.0629647070964146,
-			-0.0631388927455008,
-			-0.0633130764712667,
-			-0.0634872582684061,
-			-0.0636614381316129,
-			-0.0638356160555814,
-			-0.0640097920350058,
-			-0.0641839660645806,
-			-0.0643581381389996,
-			-0.0645323082529579,
-			-0.0647064764011498,
-			-0.0648806425782694,
-			-0.0650548067790119,
-			-0.0652289689980713,
-			-0.0654031292301429,
-			-0.0655772874699215,
-			-0.0657514437121012,
-			-0.0659255979513779,
-			-0.0660997501824458,
-			-0.0662739003999999,
-			-0.0664480485987361,
-			-0.0666221947733487,
-			-0.0667963389185332,
-			-0.0669704810289849,
-			-0.0671446210993993,
-			-0.0673187591244709,
-			-0.0674928950988965,
-			-0.0676670290173707,
-			-0.0678411608745894,
-			-0.0680152906652483,
-			-0.0681894183840424,
-			-0.0683635440256686,
-			-0.0685376675848220,
-			-0.0687117890561987,
-			-0.0688859084344948,
-			-0.0690600257144059,
-			-0.0692341408906281,
-			-0.0694082539578580,
-			-0.0695823649107916,
-			-0.0697564737441253,
-			-0.0699305804525552,
-			-0.0701046850307777,
-			-0.0702787874734892,
-			-0.0704528877753869,
-			-0.0706269859311667,
-			-0.0708010819355254,
-			-0.0709751757831601,
-			-0.0711492674687666,
-			-0.0713233569870434,
-			-0.0714974443326858,
-			-0.0716715295003918,
-			-0.0718456124848584,
-			-0.0720196932807817,
-			-0.0721937718828607,
-			-0.0723678482857910,
-			-0.0725419224842707,
-			-0.0727159944729971,
-			-0.0728900642466679,
-			-0.0730641317999802,
-			-0.0732381971276315,
-			-0.0734122602243204,
-			-0.0735863210847431,
-			-0.0737603797035990,
-			-0.0739344360755850,
-			-0.0741084901953992,
-			-0.0742825420577400,
-			-0.0744565916573045,
-			-0.0746306389887922,
-			-0.0748046840469004,
-			-0.0749787268263276,
-			-0.0751527673217725,
-			-0.0753268055279328,
-			-0.0755008414395073,
-			-0.0756748750511949,
-			-0.0758489063576941,
-			-0.0760229353537033,
-			-0.0761969620339215,
-			-0.0763709863930473,
-			-0.0765450084257800,
-			-0.0767190281268187,
-			-0.0768930454908619,
-			-0.0770670605126090,
-			-0.0772410731867594,
-			-0.0774150835080115,
-			-0.0775890914710660,
-			-0.0777630970706213,
-			-0.0779371003013773,
-			-0.0781111011580335,
-			-0.0782850996352892,
-			-0.0784590957278449,
-			-0.0786330894303996,
-			-0.0788070807376535,
-			-0.0789810696443063,
-			-0.0791550561450585,
-			-0.0793290402346093,
-			-0.0795030219076596,
-			-0.0796770011589096,
-			-0.0798509779830589,
-			-0.0800249523748088,
-			-0.0801989243288590,
-			-0.0803728938399100,
-			-0.0805468609026631,
-			-0.0807208255118181,
-			-0.0808947876620766,
-			-0.0810687473481388,
-			-0.0812427045647054,
-			-0.0814166593064784,
-			-0.0815906115681575,
-			-0.0817645613444447,
-			-0.0819385086300409,
-			-0.0821124534196476,
-			-0.0822863957079657,
-			-0.0824603354896967,
-			-0.0826342727595424,
-			-0.0828082075122042,
-			-0.0829821397423840,
-			-0.0831560694447827,
-			-0.0833299966141032,
-			-0.0835039212450467,
-			-0.0836778433323153,
-			-0.0838517628706113,
-			-0.0840256798546362,
-			-0.0841995942790926,
-			-0.0843735061386825,
-			-0.0845474154281089,
-			-0.0847213221420734,
-			-0.0848952262752790,
-			-0.0850691278224280,
-			-0.0852430267782230,
-			-0.0854169231373676,
-			-0.0855908168945633,
-			-0.0857647080445138,
-			-0.0859385965819222,
-			-0.0861124825014905,
-			-0.0862863657979235,
-			-0.0864602464659228,
-			-0.0866341245001927,
-			-0.0868079998954364,
-			-0.0869818726463568,
-			-0.0871557427476582,
-			-0.0873296101940435,
-			-0.0875034749802170,
-			-0.0876773371008824,
-			-0.0878511965507432,
-			-0.0880250533245035,
-			-0.0881989074168674,
-			-0.0883727588225391,
-			-0.0885466075362220,
-			-0.0887204535526216,
-			-0.0888942968664417,
-			-0.0890681374723862,
-			-0.0892419753651606,
-			-0.0894158105394682,
-			-0.0895896429900152,
-			-0.0897634727115054,
-			-0.0899372996986438,
-			-0.0901111239461357,
-			-0.0902849454486855,
-			-0.0904587642009984,
-			-0.0906325801977800,
-			-0.0908063934337355,
-			-0.0909802039035700,
-			-0.0911540116019889,
-			-0.0913278165236976,
-			-0.0915016186634022,
-			-0.0916754180158083,
-			-0.0918492145756212,
-			-0.0920230083375471,
-			-0.0921967992962921,
-			-0.0923705874465613,
-			-0.0925443727830622,
-			-0.0927181553005001,
-			-0.0928919349935814,
-			-0.0930657118570128,
-			-0.0932394858855003,
-			-0.0934132570737505,
-			-0.0935870254164703,
-			-0.0937607909083663,
-			-0.0939345535441453,
-			-0.0941083133185144,
-			-0.0942820702261801,
-			-0.0944558242618495,
-			-0.0946295754202304,
-			-0.0948033236960292,
-			-0.0949770690839540,
-			-0.0951508115787117,
-			-0.0953245511750096,
-			-0.0954982878675564,
-			-0.0956720216510581,
-			-0.0958457525202240,
-			-0.0960194804697611,
-			-0.0961932054943773,
-			-0.0963669275887816,
-			-0.0965406467476808,
-			-0.0967143629657839,
-			-0.0968880762377991,
-			-0.0970617865584349,
-			-0.0972354939223994,
-			-0.0974091983244012,
-			-0.0975828997591498,
-			-0.0977565982213524,
-			-0.0979302937057193,
-			-0.0981039862069588,
-			-0.0982776757197799,
-			-0.0984513622388920,
-			-0.0986250457590035,
-			-0.0987987262748250,
-			-0.0989724037810650,
-			-0.0991460782724331,
-			-0.0993197497436392,
-			-0.0994934181893925,
-			-0.0996670836044028,
-			-0.0998407459833803,
-			-0.1000144053210349,
-			-0.1001880616120760,
-			-0.1003617148512150,
-			-0.1005353650331607,
-			-0.1007090121526243,
-			-0.1008826562043162,
-			-0.1010562971829462,
-			-0.1012299350832258,
-			-0.1014035698998648,
-			-0.1015772016275747,
-			-0.1017508302610662,
-			-0.1019244557950501,
-			-0.1020980782242374,
-			-0.1022716975433395,
-			-0.1024453137470673,
-			-0.1026189268301328,
-			-0.1027925367872468,
-			-0.1029661436131211,
-			-0.1031397473024673,
-			-0.1033133478499974,
-			-0.1034869452504227,
-			-0.1036605394984551,
-			-0.1038341305888075,
-			-0.1040077185161909,
-			-0.1041813032753184,
-			-0.1043548848609018,
-			-0.1045284632676533,
-			-0.1047020384902863,
-			-0.1048756105235123,
-			-0.1050491793620450,
-			-0.1052227450005965,
-			-0.1053963074338796,
-			-0.1055698666566079,
-			-0.1057434226634944,
-			-0.1059169754492517,
-			-0.1060905250085936,
-			-0.1062640713362334,
-			-0.1064376144268839,
-			-0.1066111542752599,
-			-0.1067846908760742,
-			-0.1069582242240408,
-			-0.1071317543138738,
-			-0.1073052811402863,
-			-0.1074788046979937,
-			-0.1076523249817092,
-			-0.1078258419861475,
-			-0.1079993557060229,
-			-0.1081728661360497,
-			-0.1083463732709425,
-			-0.1085198771054159,
-			-0.1086933776341851,
-			-0.1088668748519646,
-			-0.1090403687534694,
-			-0.1092138593334147,
-			-0.1093873465865153,
-			-0.1095608305074875,
-			-0.1097343110910450,
-			-0.1099077883319050,
-			-0.1100812622247822,
-			-0.1102547327643918,
-			-0.1104281999454511,
-			-0.1106016637626744,
-			-0.1107751242107786,
-			-0.1109485812844795,
-			-0.1111220349784934,
-			-0.1112954852875368,
-			-0.1114689322063253,
-			-0.1116423757295763,
-			-0.1118158158520060,
-			-0.1119892525683314,
-			-0.1121626858732689,
-			-0.1123361157615356,
-			-0.1125095422278487,
-			-0.1126829652669246,
-			-0.1128563848734817,
-			-0.1130298010422365,
-			-0.1132032137679067,
-			-0.1133766230452100,
-			-0.1135500288688633,
-			-0.1137234312335855,
-			-0.1138968301340937,
-			-0.1140702255651061,
-			-0.1142436175213409,
-			-0.1144170059975159,
-			-0.1145903909883493,
-			-0.1147637724885601,
-			-0.1149371504928667,
-			-0.1151105249959873,
-			-0.1152838959926407,
-			-0.1154572634775456,
-			-0.1156306274454214,
-			-0.1158039878909871,
-			-0.1159773448089612,
-			-0.1161506981940637,
-			-0.1163240480410135,
-			-0.1164973943445299,
-			-0.1166707370993332,
-			-0.1168440763001423,
-			-0.1170174119416774,
-			-0.1171907440186583,
-			-0.1173640725258052,
-			-0.1175373974578378,
-			-0.1177107188094763,
-			-0.1178840365754415,
-			-0.1180573507504536,
-			-0.1182306613292334,
-			-0.1184039683065010,
-			-0.1185772716769774,
-			-0.1187505714353839,
-			-0.1189238675764407,
-			-0.1190971600948698,
-			-0.1192704489853917,
-			-0.1194437342427278,
-			-0.1196170158616003,
-			-0.1197902938367293,
-			-0.1199635681628379,
-			-0.1201368388346471,
-			-0.1203101058468789,
-			-0.1204833691942555,
-			-0.1206566288714984,
-			-0.1208298848733304,
-			-0.1210031371944736,
-			-0.1211763858296507,
-			-0.1213496307735834,
-			-0.1215228720209956,
-			-0.1216961095666092,
-			-0.1218693434051474,
-			-0.1220425735313332,
-			-0.1222157999398891,
-			-0.1223890226255396,
-			-0.1225622415830067,
-			-0.1227354568070147,
-			-0.1229086682922870,
-			-0.1230818760335470,
-			-0.1232550800255187,
-			-0.1234282802629257,
-			-0.1236014767404929,
-			-0.1237746694529432,
-			-0.1239478583950017,
-			-0.1241210435613925,
-			-0.1242942249468399,
-			-0.1244674025460694,
-			-0.1246405763538043,
-			-0.1248137463647704,
-			-0.1249869125736925,
-			-0.1251600749752952,
-			-0.1253332335643044,
-			-0.1255063883354445,
-			-0.1256795392834416,
-			-0.1258526864030213,
-			-0.1260258296889087,
-			-0.1261989691358298,
-			-0.1263721047385105,
-			-0.1265452364916765,
-			-0.1267183643900544,
-			-0.1268914884283704,
-			-0.1270646086013505,
-			-0.1272377249037212,
-			-0.1274108373302094,
-			-0.1275839458755409,
-			-0.1277570505344438,
-			-0.1279301513016443,
-			-0.1281032481718694,
-			-0.1282763411398467,
-			-0.1284494302003026,
-			-0.1286225153479656,
-			-0.1287955965775627,
-			-0.1289686738838215,
-			-0.1291417472614701,
-			-0.1293148167052358,
-			-0.1294878822098468,
-			-0.1296609437700316,
-			-0.1298340013805183,
-			-0.1300070550360350,
-			-0.1301801047313104,
-			-0.1303531504610732,
-			-0.1305261922200514,
-			-0.1306992300029750,
-			-0.1308722638045722,
-			-0.1310452936195723,
-			-0.1312183194427047,
-			-0.1313913412686978,
-			-0.1315643590922827,
-			-0.1317373729081874,
-			-0.1319103827111424,
-			-0.1320833884958774,
-			-0.1322563902571226,
-			-0.1324293879896075,
-			-0.1326023816880623,
-			-0.1327753713472178,
-			-0.1329483569618043,
-			-0.1331213385265524,
-			-0.1332943160361925,
-			-0.1334672894854552,
-			-0.1336402588690726,
-			-0.1338132241817739,
-			-0.1339861854182921,
-			-0.1341591425733574,
-			-0.1343320956417015,
-			-0.1345050446180562,
-			-0.1346779894971526,
-			-0.1348509302737230,
-			-0.1350238669424991,
-			-0.1351967994982131,
-			-0.1353697279355973,
-			-0.1355426522493833,
-			-0.1357155724343043,
-			-0.1358884884850925,
-			-0.1360614003964809,
-			-0.1362343081632018,
-			-0.1364072117799884,
-			-0.1365801112415739,
-			-0.1367530065426906,
-			-0.1369258976780732,
-			-0.1370987846424541,
-			-0.1372716674305675,
-			-0.1374445460371465,
-			-0.1376174204569253,
-			-0.1377902906846381,
-			-0.1379631567150183,
-			-0.1381360185428005,
-			-0.1383088761627187,
-			-0.1384817295695083,
-			-0.1386545787579025,
-			-0.1388274237226369,
-			-0.1390002644584465,
-			-0.1391731009600654,
-			-0.1393459332222296,
-			-0.1395187612396736,
-			-0.1396915850071333,
-			-0.1398644045193441,
-			-0.1400372197710412,
-			-0.1402100307569611,
-			-0.1403828374718390,
-			-0.1405556399104108,
-			-0.1407284380674136,
-			-0.1409012319375827,
-			-0.1410740215156548,
-			-0.1412468067963666,
-			-0.1414195877744543,
-			-0.1415923644446557,
-			-0.1417651368017064,
-			-0.1419379048403444,
-			-0.1421106685553064,
-			-0.1422834279413302,
-			-0.1424561829931523,
-			-0.1426289337055116,
-			-0.1428016800731448,
-			-0.1429744220907902,
-			-0.1431471597531858,
-			-0.1433198930550694,
-			-0.1434926219911792,
-			-0.1436653465562539,
-			-0.1438380667450320,
-			-0.1440107825522522,
-			-0.1441834939726529,
-			-0.1443562010009732,
-			-0.1445289036319520,
-			-0.1447016018603291,
-			-0.1448742956808430,
-			-0.1450469850882336,
-			-0.1452196700772406,
-			-0.1453923506426028,
-			-0.1455650267790616,
-			-0.1457376984813555,
-			-0.1459103657442255,
-			-0.1460830285624118,
-			-0.1462556869306539,
-			-0.1464283408436939,
-			-0.1466009902962709,
-			-0.1467736352831266,
-			-0.1469462757990019,
-			-0.1471189118386375,
-			-0.1472915433967747,
-			-0.1474641704681548,
-			-0.1476367930475200,
-			-0.1478094111296104,
-			-0.1479820247091694,
-			-0.1481546337809379,
-			-0.1483272383396582,
-			-0.1484998383800727,
-			-0.1486724338969228,
-			-0.1488450248849522,
-			-0.1490176113389026,
-			-0.1491901932535171,
-			-0.1493627706235386,
-			-0.1495353434437094,
-			-0.1497079117087735,
-			-0.1498804754134739,
-			-0.1500530345525538,
-			-0.1502255891207571,
-			-0.1503981391128272,
-			-0.1505706845235077,
-			-0.1507432253475431,
-			-0.1509157615796775,
-			-0.1510882932146546,
-			-0.1512608202472192,
-			-0.1514333426721160,
-			-0.1516058604840887,
-			-0.1517783736778835,
-			-0.1519508822482444,
-			-0.1521233861899167,
-			-0.1522958854976459,
-			-0.1524683801661765,
-			-0.1526408701902554,
-			-0.1528133555646272,
-			-0.1529858362840380,
-			-0.1531583123432338,
-			-0.1533307837369608,
-			-0.1535032504599646,
-			-0.1536757125069922,
-			-0.1538481698727902,
-			-0.1540206225521044,
-			-0.1541930705396827,
-			-0.1543655138302712,
-			-0.1545379524186171,
-			-0.1547103862994682,
-			-0.1548828154675709,
-			-0.1550552399176738,
-			-0.1552276596445238,
-			-0.1554000746428686,
-			-0.1555724849074571,
-			-0.1557448904330361,
-			-0.1559172912143546,
-			-0.1560896872461609,
-			-0.1562620785232036,
-			-0.1564344650402310,
-			-0.1566068467919919,
-			-0.1567792237732356,
-			-0.1569515959787111,
-			-0.1571239634031679,
-			-0.1572963260413547,
-			-0.1574686838880213,
-			-0.1576410369379181,
-			-0.1578133851857935,
-			-0.1579857286263989,
-			-0.1581580672544836,
-			-0.1583304010647981,
-			-0.1585027300520925,
-			-0.1586750542111179,
-			-0.1588473735366250,
-			-0.1590196880233642,
-			-0.1591919976660867,
-			-0.1593643024595434,
-			-0.1595366023984865,
-			-0.1597088974776661,
-			-0.1598811876918348,
-			-0.1600534730357442,
-			-0.1602257535041454,
-			-0.1603980290917918,
-			-0.1605702997934343,
-			-0.1607425656038260,
-			-0.1609148265177193,
-			-0.1610870825298663,
-			-0.1612593336350206,
-			-0.1614315798279342,
-			-0.1616038211033610,
-			-0.1617760574560541,
-			-0.1619482888807664,
-			-0.1621205153722518,
-			-0.1622927369252639,
-			-0.1624649535345567,
-			-0.1626371651948836,
-			-0.1628093719009994,
-			-0.1629815736476581,
-			-0.1631537704296142,
-			-0.1633259622416224,
-			-0.1634981490784367,
-			-0.1636703309348132,
-			-0.1638425078055062,
-			-0.1640146796852709,
-			-0.1641868465688630,
-			-0.1643590084510376,
-			-0.1645311653265503,
-			-0.1647033171901572,
-			-0.1648754640366145,
-			-0.1650476058606777,
-			-0.1652197426571033,
-			-0.1653918744206476,
-			-0.1655640011460675,
-			-0.1657361228281197,
-			-0.1659082394615607,
-			-0.1660803510411478,
-			-0.1662524575616383,
-			-0.1664245590177886,
-			-0.1665966554043577,
-			-0.1667687467161022,
-			-0.1669408329477802,
-			-0.1671129140941499,
-			-0.1672849901499684,
-			-0.1674570611099954,
-			-0.1676291269689885,
-			-0.1678011877217063,
-			-0.1679732433629078,
-			-0.1681452938873516,
-			-0.1683173392897968,
-			-0.1684893795650024,
-			-0.1686614147077285,
-			-0.1688334447127337,
-			-0.1690054695747785,
-			-0.1691774892886221,
-			-0.1693495038490244,
-			-0.1695215132507465,
-			-0.1696935174885472,
-			-0.1698655165571884,
-			-0.1700375104514298,
-			-0.1702094991660323,
-			-0.1703814826957576,
-			-0.1705534610353655,
-			-0.1707254341796181,
-			-0.1708974021232766,
-			-0.1710693648611027,
-			-0.1712413223878578,
-			-0.1714132746983037,
-			-0.1715852217872029,
-			-0.1717571636493173,
-			-0.1719291002794096,
-			-0.1721010316722418,
-			-0.1722729578225768,
-			-0.1724448787251776,
-			-0.1726167943748064,
-			-0.1727887047662275,
-			-0.1729606098942036,
-			-0.1731325097534982,
-			-0.1733044043388752,
-			-0.1734762936450979,
-			-0.1736481776669303,
-			-0.1738200563991370,
-			-0.1739919298364820,
-			-0.1741637979737294,
-			-0.1743356608056449,
-			-0.1745075183269919,
-			-0.1746793705325360,
-			-0.1748512174170425,
-			-0.1750230589752759,
-			-0.1751948952020025,
-			-0.1753667260919870,
-			-0.1755385516399957,
-			-0.1757103718407946,
-			-0.1758821866891491,
-			-0.1760539961798262,
-			-0.1762258003075917,
-			-0.1763975990672121,
-			-0.1765693924534549,
-			-0.1767411804610862,
-			-0.1769129630848732,
-			-0.1770847403195833,
-			-0.1772565121599838,
-			-0.1774282786008419,
-			-0.1776000396369257,
-			-0.1777717952630032,
-			-0.1779435454738417,
-			-0.1781152902642102,
-			-0.1782870296288766,
-			-0.1784587635626093,
-			-0.1786304920601776,
-			-0.1788022151163495,
-			-0.1789739327258949,
-			-0.1791456448835823,
-			-0.1793173515841812,
-			-0.1794890528224614,
-			-0.1796607485931926,
-			-0.1798324388911442,
-			-0.1800041237110865,
-			-0.1801758030477894,
-			-0.1803474768960237,
-			-0.1805191452505600,
-			-0.1806908081061684,
-			-0.1808624654576200,
-			-0.1810341172996861,
-			-0.1812057636271371,
-			-0.1813774044347454,
-			-0.1815490397172819,
-			-0.1817206694695184,
-			-0.1818922936862269,
-			-0.1820639123621792,
-			-0.1822355254921475,
-			-0.1824071330709041,
-			-0.1825787350932219,
-			-0.1827503315538736,
-			-0.1829219224476316,
-			-0.1830935077692693,
-			-0.1832650875135596,
-			-0.1834366616752767,
-			-0.1836082302491929,
-			-0.1837797932300828,
-			-0.1839513506127204,
-			-0.1841229023918786,
-			-0.1842944485623335,
-			-0.1844659891188575,
-			-0.1846375240562269,
-			-0.1848090533692154,
-			-0.1849805770525982,
-			-0.1851520951011507,
-			-0.1853236075096474,
-			-0.1854951142728644,
-			-0.1856666153855771,
-			-0.1858381108425615,
-			-0.1860096006385931,
-			-0.1861810847684483,
-			-0.1863525632269035,
-			-0.1865240360087344,
-			-0.1866955031087190,
-			-0.1868669645216330,
-			-0.1870384202422539,
-			-0.1872098702653588,
-			-0.1873813145857244,
-			-0.1875527531981294,
-			-0.1877241860973506,
-			-0.1878956132781660,
-			-0.1880670347353541,
-			-0.1882384504636924,
-			-0.1884098604579594,
-			-0.1885812647129342,
-			-0.1887526632233950,
-			-0.1889240559841212,
-			-0.1890954429898914,
-			-0.1892668242354847,
-			-0.1894381997156812,
-			-0.1896095694252602,
-			-0.1897809333590011,
-			-0.1899522915116847,
-			-0.1901236438780903,
-			-0.1902949904529983,
-			-0.1904663312311899,
-			-0.1906376662074450,
-			-0.1908089953765448,
-			-0.1909803187332702,
-			-0.1911516362724022,
-			-0.1913229479887228,
-			-0.1914942538770129,
-			-0.1916655539320546,
-			-0.1918368481486295,
-			-0.1920081365215202,
-			-0.1921794190455083,
-			-0.1923506957153763,
-			-0.1925219665259075,
-			-0.1926932314718839,
-			-0.1928644905480892,
-			-0.1930357437493059,
-			-0.1932069910703174,
-			-0.1933782325059081,
-			-0.1935494680508601,
-			-0.1937206976999588,
-			-0.1938919214479874,
-			-0.1940631392897301,
-			-0.1942343512199722,
-			-0.1944055572334970,
-			-0.1945767573250900,
-			-0.1947479514895362,
-			-0.1949191397216207,
-			-0.1950903220161280,
-			-0.1952614983678449,
-			-0.1954326687715563,
-			-0.1956038332220481,
-			-0.1957749917141067,
-			-0.1959461442425174,
-			-0.1961172908020680,
-			-0.1962884313875437,
-			-0.1964595659937321,
-			-0.1966306946154201,
-			-0.1968018172473944,
-			-0.1969729338844426,
-			-0.1971440445213519,
-			-0.1973151491529103,
-			-0.1974862477739059,
-			-0.1976573403791261,
-			-0.1978284269633595,
-			-0.1979995075213941,
-			-0.1981705820480195,
-			-0.1983416505380232,
-			-0.1985127129861948,
-			-0.1986837693873237,
-			-0.1988548197361984,
-			-0.1990258640276094,
-			-0.1991969022563454,
-			-0.1993679344171971,
-			-0.1995389605049543,
-			-0.1997099805144069,
-			-0.1998809944403460,
-			-0.2000520022775616,
-			-0.2002230040208445,
-			-0.2003939996649862,
-			-0.2005649892047778,
-			-0.2007359726350102,
-			-0.2009069499504753,
-			-0.2010779211459649,
-			-0.2012488862162701,
-			-0.2014198451561844,
-			-0.2015907979604991,
-			-0.2017617446240069,
-			-0.2019326851415008,
-			-0.2021036195077726,
-			-0.2022745477176169,
-			-0.2024454697658258,
-			-0.2026163856471931,
-			-0.2027872953565126,
-			-0.2029581988885776,
-			-0.2031290962381821,
-			-0.2032999874001207,
-			-0.2034708723691878,
-			-0.2036417511401775,
-			-0.2038126237078847,
-			-0.2039834900671045,
-			-0.2041543502126315,
-			-0.2043252041392618,
-			-0.2044960518417903,
-			-0.2046668933150129,
-			-0.2048377285537256,
-			-0.2050085575527236,
-			-0.2051793803068045,
-			-0.2053501968107639,
-			-0.2055210070593985,
-			-0.2056918110475053,
-			-0.2058626087698810,
-			-0.2060334002213237,
-			-0.2062041853966295,
-			-0.2063749642905969,
-			-0.2065457368980233,
-			-0.2067165032137070,
-			-0.2068872632324458,
-			-0.2070580169490379,
-			-0.2072287643582828,
-			-0.2073995054549777,
-			-0.2075702402339230,
-			-0.2077409686899171,
-			-0.2079116908177591,
-			-0.2080824066122496,
-			-0.2082531160681866,
-			-0.2084238191803716,
-			-0.2085945159436037,
-			-0.2087652063526836,
-			-0.2089358904024119,
-			-0.2091065680875885,
-			-0.2092772394030151,
-			-0.2094479043434924,
-			-0.2096185629038219,
-			-0.2097892150788047,
-			-0.2099598608632425,
-			-0.2101305002519370,
-			-0.2103011332396907,
-			-0.2104717598213057,
-			-0.2106423799915837,
-			-0.2108129937453287,
-			-0.2109836010773421,
-			-0.2111542019824277,
-			-0.2113247964553887,
-			-0.2114953844910280,
-			-0.2116659660841496,
-			-0.2118365412295569,
-			-0.2120071099220548,
-			-0.2121776721564462,
-			-0.2123482279275364,
-			-0.2125187772301296,
-			-0.2126893200590307,
-			-0.2128598564090448,
-			-0.2130303862749765,
-			-0.2132009096516317,
-			-0.2133714265338161,
-			-0.2135419369163348,
-			-0.2137124407939945,
-			-0.2138829381616007,
-			-0.2140534290139599,
-			-0.2142239133458793,
-			-0.2143943911521646,
-			-0.2145648624276237,
-			-0.2147353271670632,
-			-0.2149057853652904,
-			-0.2150762370171136,
-			-0.2152466821173394,
-			-0.2154171206607765,
-			-0.2155875526422328,
-			-0.2157579780565170,
-			-0.2159283968984367,
-			-0.2160988091628020,
-			-0.2162692148444209,
-			-0.2164396139381028,
-			-0.2166100064386572,
-			-0.2167803923408929,
-			-0.2169507716396209,
-			-0.2171211443296503,
-			-0.2172915104057914,
-			-0.2174618698628548,
-			-0.2176322226956506,
-			-0.2178025688989899,
-			-0.2179729084676832,
-			-0.2181432413965426,
-			-0.2183135676803786,
-			-0.2184838873140030,
-			-0.2186542002922277,
-			-0.2188245066098643,
-			-0.2189948062617257,
-			-0.2191650992426237,
-			-0.2193353855473709,
-			-0.2195056651707805,
-			-0.2196759381076645,
-			-0.2198462043528377,
-			-0.2200164639011118,
-			-0.2201867167473014,
-			-0.2203569628862204,
-			-0.2205272023126821,
-			-0.2206974350215012,
-			-0.2208676610074917,
-			-0.2210378802654688,
-			-0.2212080927902469,
-			-0.2213782985766415,
-			-0.2215484976194673,
-			-0.2217186899135397,
-			-0.2218888754536753,
-			-0.2220590542346883,
-			-0.2222292262513964,
-			-0.2223993914986149,
-			-0.2225695499711606,
-			-0.2227397016638503,
-			-0.2229098465715000,
-			-0.2230799846889282,
-			-0.2232501160109513,
-			-0.2234202405323869,
-			-0.2235903582480531,
-			-0.2237604691527672,
-			-0.2239305732413475,
-			-0.2241006705086127,
-			-0.2242707609493813,
-			-0.2244408445584716,
-			-0.2246109213307029,
-			-0.2247809912608944,
-			-0.2249510543438648,
-			-0.2251211105744349,
-			-0.2252911599474236,
-			-0.2254612024576511,
-			-0.2256312380999379,
-			-0.2258012668691035,
-			-0.2259712887599698,
-			-0.2261413037673568,
-			-0.2263113118860858,
-			-0.2264813131109780,
-			-0.2266513074368552,
-			-0.2268212948585383,
-			-0.2269912753708498,
-			-0.2271612489686118,
-			-0.2273312156466463,
-			-0.2275011753997763,
-			-0.2276711282228240,
-			-0.2278410741106123,
-			-0.2280110130579650,
-			-0.2281809450597047,
-			-0.2283508701106558,
-			-0.2285207882056413,
-			-0.2286906993394854,
-			-0.2288606035070131,
-			-0.2290305007030475,
-			-0.2292003909224141,
-			-0.2293702741599376,
-			-0.2295401504104428,
-			-0.2297100196687557,
-			-0.2298798819297007,
-			-0.2300497371881043,
-			-0.2302195854387922,
-			-0.2303894266765907,
-			-0.2305592608963257,
-			-0.2307290880928239,
-			-0.2308989082609127,
-			-0.2310687213954177,
-			-0.2312385274911676,
-			-0.2314083265429885,
-			-0.2315781185457096,
-			-0.2317479034941576,
-			-0.2319176813831601,
-			-0.2320874522075467,
-			-0.2322572159621450,
-			-0.2324269726417840,
-			-0.2325967222412922,
-			-0.2327664647554996,
-			-0.2329362001792348,
-			-0.2331059285073276,
-			-0.2332756497346080,
-			-0.2334453638559051,
-			-0.2336150708660507,
-			-0.2337847707598736,
-			-0.2339544635322053,
-			-0.2341241491778769,
-			-0.2342938276917185,
-			-0.2344634990685625,
-			-0.2346331633032395,
-			-0.2348028203905818,
-			-0.2349724703254214,
-			-0.2351421131025901,
-			-0.2353117487169204,
-			-0.2354813771632447,
-			-0.2356509984363963,
-			-0.2358206125312082,
-			-0.2359902194425133,
-			-0.2361598191651453,
-			-0.2363294116939377,
-			-0.2364989970237248,
-			-0.2366685751493399,
-			-0.2368381460656186,
-			-0.2370077097673948,
-			-0.2371772662495029,
-			-0.2373468155067788,
-			-0.2375163575340570,
-			-0.2376858923261730,
-			-0.2378554198779629,
-			-0.2380249401842624,
-			-0.2381944532399078,
-			-0.2383639590397351,
-			-0.2385334575785807,
-			-0.2387029488512820,
-			-0.2388724328526758,
-			-0.2390419095775990,
-			-0.2392113790208893,
-			-0.2393808411773845,
-			-0.2395502960419216,
-			-0.2397197436093401,
-			-0.2398891838744774,
-			-0.2400586168321724,
-			-0.2402280424772639,
-			-0.2403974608045901,
-			-0.2405668718089916,
-			-0.2407362754853069,
-			-0.2409056718283759,
-			-0.2410750608330388,
-			-0.2412444424941351,
-			-0.2414138168065055,
-			-0.2415831837649903,
-			-0.2417525433644309,
-			-0.2419218955996678,
-			-0.2420912404655423,
-			-0.2422605779568959,
-			-0.2424299080685701,
-			-0.2425992307954077,
-			-0.2427685461322492,
-			-0.2429378540739386,
-			-0.2431071546153176,
-			-0.2432764477512289,
-			-0.2434457334765166,
-			-0.2436150117860225,
-			-0.2437842826745910,
-			-0.2439535461370656,
-			-0.2441228021682902,
-			-0.2442920507631093,
-			-0.2444612919163665,
-			-0.2446305256229072,
-			-0.2447997518775759,
-			-0.2449689706752180,
-			-0.2451381820106783,
-			-0.2453073858788026,
-			-0.2454765822744369,
-			-0.2456457711924261,
-			-0.2458149526276180,
-			-0.2459841265748580,
-			-0.2461532930289931,
-			-0.2463224519848702,
-			-0.2464916034373358,
-			-0.2466607473812384,
-			-0.2468298838114247,
-			-0.2469990127227429,
-			-0.2471681341100410,
-			-0.2473372479681671,
-			-0.2475063542919695,
-			-0.2476754530762975,
-			-0.2478445443160000,
-			-0.2480136280059255,
-			-0.2481827041409242,
-			-0.2483517727158451,
-			-0.2485208337255386,
-			-0.2486898871648549,
-			-0.2488589330286435,
-			-0.2490279713117560,
-			-0.2491970020090422,
-			-0.2493660251153539,
-			-0.2495350406255424,
-			-0.2497040485344586,
-			-0.2498730488369545,
-			-0.2500420415278821,
-			-0.2502110266020938,
-			-0.2503800040544414,
-			-0.2505489738797781,
-			-0.2507179360729566,
-			-0.2508868906288301,
-			-0.2510558375422521,
-			-0.2512247768080757,
-			-0.2513937084211548,
-			-0.2515626323763441,
-			-0.2517315486684970,
-			-0.2519004572924688,
-			-0.2520693582431137,
-			-0.2522382515152867,
-			-0.2524071371038438,
-			-0.2525760150036389,
-			-0.2527448852095294,
-			-0.2529137477163701,
-			-0.2530826025190173,
-			-0.2532514496123279,
-			-0.2534202889911583,
-			-0.2535891206503652,
-			-0.2537579445848056,
-			-0.2539267607893372,
-			-0.2540955692588168,
-			-0.2542643699881034,
-			-0.2544331629720541,
-			-0.2546019482055275,
-			-0.2547707256833823,
-			-0.2549394954004763,
-			-0.2551082573516701,
-			-0.2552770115318214,
-			-0.2554457579357904,
-			-0.2556144965584369,
-			-0.2557832273946203,
-			-0.2559519504392012,
-			-0.2561206656870395,
-			-0.2562893731329969,
-			-0.2564580727719328,
-			-0.2566267645987094,
-			-0.2567954486081878,
-			-0.2569641247952292,
-			-0.2571327931546964,
-			-0.2573014536814502,
-			-0.2574701063703537,
-			-0.2576387512162696,
-			-0.2578073882140598,
-			-0.2579760173585883,
-			-0.2581446386447176,
-			-0.2583132520673118,
-			-0.2584818576212343,
-			-0.2586504553013494,
-			-0.2588190451025209,
-			-0.2589876270196134,
-			-0.2591562010474914,
-			-0.2593247671810204,
-			-0.2594933254150654,
-			-0.2596618757444916,
-			-0.2598304181641646,
-			-0.2599989526689508,
-			-0.2601674792537154,
-			-0.2603359979133260,
-			-0.2605045086426483,
-			-0.2606730114365496,
-			-0.2608415062898971,
-			-0.2610099931975573,
-			-0.2611784721543991,
-			-0.2613469431552895,
-			-0.2615154061950968,
-			-0.2616838612686894,
-			-0.2618523083709356,
-			-0.2620207474967042,
-			-0.2621891786408646,
-			-0.2623576017982861,
-			-0.2625260169638379,
-			-0.2626944241323899,
-			-0.2628628232988123,
-			-0.2630312144579746,
-			-0.2631995976047486,
-			-0.2633679727340040,
-			-0.2635363398406125,
-			-0.2637046989194449,
-			-0.2638730499653726,
-			-0.2640413929732681,
-			-0.2642097279380025,
-			-0.2643780548544483,
-			-0.2645463737174781,
-			-0.2647146845219648,
-			-0.2648829872627809,
-			-0.2650512819347995,
-			-0.2652195685328946,
-			-0.2653878470519397,
-			-0.2655561174868089,
-			-0.2657243798323760,
-			-0.2658926340835153,
-			-0.2660608802351025,
-			-0.2662291182820110,
-			-0.2663973482191175,
-			-0.2665655700412965,
-			-0.2667337837434237,
-			-0.2669019893203758,
-			-0.2670701867670278,
-			-0.2672383760782568,
-			-0.2674065572489395,
-			-0.2675747302739526,
-			-0.2677428951481736,
-			-0.2679110518664792,
-			-0.2680792004237477,
-			-0.2682473408148567,
-			-0.2684154730346847,
-			-0.2685835970781092,
-			-0.2687517129400104,
-			-0.2689198206152656,
-			-0.2690879200987548,
-			-0.2692560113853575,
-			-0.2694240944699524,
-			-0.2695921693474210,
-			-0.2697602360126418,
-			-0.2699282944604962,
-			-0.2700963446858647,
-			-0.2702643866836278,
-			-0.2704324204486670,
-			-0.2706004459758634,
-			-0.2707684632600995,
-			-0.2709364722962558,
-			-0.2711044730792156,
-			-0.2712724656038610,
-			-0.2714404498650742,
-			-0.2716084258577389,
-			-0.2717763935767373,
-			-0.2719443530169537,
-			-0.2721123041732715,
-			-0.2722802470405742,
-			-0.2724481816137467,
-			-0.2726161078876728,
-			-0.2727840258572371,
-			-0.2729519355173253,
-			-0.2731198368628218,
-			-0.2732877298886124,
-			-0.2734556145895827,
-			-0.2736234909606184,
-			-0.2737913589966062,
-			-0.2739592186924324,
-			-0.2741270700429835,
-			-0.2742949130431465,
-			-0.2744627476878089,
-			-0.2746305739718572,
-			-0.2747983918901805,
-			-0.2749662014376659,
-			-0.2751340026092018,
-			-0.2753017953996770,
-			-0.2754695798039798,
-			-0.2756373558169991,
-			-0.2758051234336246,
-			-0.2759728826487456,
-			-0.2761406334572521,
-			-0.2763083758540337,
-			-0.2764761098339806,
-			-0.2766438353919839,
-			-0.2768115525229343,
-			-0.2769792612217223,
-			-0.2771469614832397,
-			-0.2773146533023780,
-			-0.2774823366740283,
-			-0.2776500115930839,
-			-0.2778176780544363,
-			-0.2779853360529783,
-			-0.2781529855836029,
-			-0.2783206266412025,
-			-0.2784882592206718,
-			-0.2786558833169030,
-			-0.2788234989247908,
-			-0.2789911060392292,
-			-0.2791587046551127,
-			-0.2793262947673355,
-			-0.2794938763707927,
-			-0.2796614494603802,
-			-0.2798290140309919,
-			-0.2799965700775250,
-			-0.2801641175948748,
-			-0.2803316565779372,
-			-0.2804991870216098,
-			-0.2806667089207876,
-			-0.2808342222703692,
-			-0.2810017270652510,
-			-0.2811692233003307,
-			-0.2813367109705064,
-			-0.2815041900706753,
-			-0.2816716605957365,
-			-0.2818391225405882,
-			-0.2820065759001293,
-			-0.2821740206692592,
-			-0.2823414568428765,
-			-0.2825088844158812,
-			-0.2826763033831733,
-			-0.2828437137396530,
-			-0.2830111154802203,
-			-0.2831785085997761,
-			-0.2833458930932213,
-			-0.2835132689554566,
-			-0.2836806361813844,
-			-0.2838479947659057,
-			-0.2840153447039226,
-			-0.2841826859903372,
-			-0.2843500186200524,
-			-0.2845173425879709,
-			-0.2846846578889953,
-			-0.2848519645180292,
-			-0.2850192624699761,
-			-0.2851865517397399,
-			-0.2853538323222242,
-			-0.2855211042123340,
-			-0.2856883674049737,
-			-0.2858556218950477,
-			-0.2860228676774619,
-			-0.2861901047471212,
-			-0.2863573330989311,
-			-0.2865245527277984,
-			-0.2866917636286282,
-			-0.2868589657963279,
-			-0.2870261592258036,
-			-0.2871933439119624,
-			-0.2873605198497120,
-			-0.2875276870339594,
-			-0.2876948454596127,
-			-0.2878619951215798,
-			-0.2880291360147694,
-			-0.2881962681340895,
-			-0.2883633914744491,
-			-0.2885305060307576,
-			-0.2886976117979244,
-			-0.2888647087708593,
-			-0.2890317969444713,
-			-0.2891988763136719,
-			-0.2893659468733709,
-			-0.2895330086184790,
-			-0.2897000615439075,
-			-0.2898671056445674,
-			-0.2900341409153700,
-			-0.2902011673512278,
-			-0.2903681849470524,
-			-0.2905351936977566,
-			-0.2907021935982525,
-			-0.2908691846434532,
-			-0.2910361668282716,
-			-0.2912031401476219,
-			-0.2913701045964170,
-			-0.2915370601695713,
-			-0.2917040068619991,
-			-0.2918709446686141,
-			-0.2920378735843325,
-			-0.2922047936040680,
-			-0.2923717047227367,
-			-0.2925386069352541,
-			-0.2927055002365354,
-			-0.2928723846214982,
-			-0.2930392600850573,
-			-0.2932061266221303,
-			-0.2933729842276342,
-			-0.2935398328964857,
-			-0.2937066726236027,
-			-0.2938735034039025,
-			-0.2940403252323042,
-			-0.2942071381037245,
-			-0.2943739420130836,
-			-0.2945407369552994,
-			-0.2947075229252913,
-			-0.2948742999179789,
-			-0.2950410679282811,
-			-0.2952078269511190,
-			-0.2953745769814121,
-			-0.2955413180140810,
-			-0.2957080500440468,
-			-0.2958747730662301,
-			-0.2960414870755523,
-			-0.2962081920669352,
-			-0.2963748880353009,
-			-0.2965415749755710,
-			-0.2967082528826682,
-			-0.2968749217515150,
-			-0.2970415815770348,
-			-0.2972082323541507,
-			-0.2973748740777860,
-			-0.2975415067428646,
-			-0.2977081303443109,
-			-0.2978747448770482,
-			-0.2980413503360027,
-			-0.2982079467160982,
-			-0.2983745340122602,
-			-0.2985411122194144,
-			-0.2987076813324857,
-			-0.2988742413464012,
-			-0.2990407922560866,
-			-0.2992073340564685,
-			-0.2993738667424738,
-			-0.2995403903090300,
-			-0.2997069047510638,
-			-0.2998734100635030,
-			-0.3000399062412763,
-			-0.3002063932793109,
-			-0.3003728711725364,
-			-0.3005393399158807,
-			-0.3007057995042730,
-			-0.3008722499326432,
-			-0.3010386911959202,
-			-0.3012051232890348,
-			-0.3013715462069163,
-			-0.3015379599444954,
-			-0.3017043644967037,
-			-0.3018707598584708,
-			-0.3020371460247290,
-			-0.3022035229904096,
-			-0.3023698907504446,
-			-0.3025362492997659,
-			-0.3027025986333058,
-			-0.3028689387459976,
-			-0.3030352696327738,
-			-0.3032015912885682,
-			-0.3033679037083136,
-			-0.3035342068869442,
-			-0.3037005008193946,
-			-0.3038667855005979,
-			-0.3040330609254903,
-			-0.3041993270890059,
-			-0.3043655839860800,
-			-0.3045318316116481,
-			-0.3046980699606465,
-			-0.3048642990280108,
-			-0.3050305188086774,
-			-0.3051967292975832,
-			-0.3053629304896647,
-			-0.3055291223798601,
-			-0.3056953049631056,
-			-0.3058614782343398,
-			-0.3060276421885008,
-			-0.3061937968205262,
-			-0.3063599421253559,
-			-0.3065260780979276,
-			-0.3066922047331812,
-			-0.3068583220260562,
-			-0.3070244299714918,
-			-0.3071905285644289,
-			-0.3073566177998069,
-			-0.3075226976725672,
-			-0.3076887681776506,
-			-0.3078548293099980,
-			-0.3080208810645511,
-			-0.3081869234362515,
-			-0.3083529564200417,
-			-0.3085189800108633,
-			-0.3086849942036595,
-			-0.3088509989933734,
-			-0.3090169943749473,
-			-0.3091829803433259,
-			-0.3093489568934515,
-			-0.3095149240202698,
-			-0.3096808817187241,
-			-0.3098468299837593,
-			-0.3100127688103206,
-			-0.3101786981933527,
-			-0.3103446181278012,
-			-0.3105105286086122,
-			-0.3106764296307318,
-			-0.3108423211891060,
-			-0.3110082032786817,
-			-0.3111740758944055,
-			-0.3113399390312251,
-			-0.3115057926840881,
-			-0.3116716368479419,
-			-0.3118374715177346,
-			-0.3120032966884150,
-			-0.3121691123549309,
-			-0.3123349185122325,
-			-0.3125007151552682,
-			-0.3126665022789877,
-			-0.3128322798783412,
-			-0.3129980479482783,
-			-0.3131638064837496,
-			-0.3133295554797058,
-			-0.3134952949310980,
-			-0.3136610248328777,
-			-0.3138267451799960,
-			-0.3139924559674050,
-			-0.3141581571900566,
-			-0.3143238488429040,
-			-0.3144895309208989,
-			-0.3146552034189954,
-			-0.3148208663321461,
-			-0.3149865196553046,
-			-0.3151521633834256,
-			-0.3153177975114619,
-			-0.3154834220343696,
-			-0.3156490369471024,
-			-0.3158146422446158,
-			-0.3159802379218651,
-			-0.3161458239738057,
-			-0.3163114003953940,
-			-0.3164769671815860,
-			-0.3166425243273385,
-			-0.3168080718276080,
-			-0.3169736096773516,
-			-0.3171391378715275,
-			-0.3173046564050920,
-			-0.3174701652730045,
-			-0.3176356644702227,
-			-0.3178011539917052,
-			-0.3179666338324111,
-			-0.3181321039872990,
-			-0.3182975644513294,
-			-0.3184630152194613,
-			-0.3186284562866551,
-			-0.3187938876478713,
-			-0.3189593092980701,
-			-0.3191247212322126,
-			-0.3192901234452604,
-			-0.3194555159321749,
-			-0.3196208986879176,
-			-0.3197862717074517,
-			-0.3199516349857383,
-			-0.3201169885177410,
-			-0.3202823322984227,
-			-0.3204476663227463,
-			-0.3206129905856763,
-			-0.3207783050821757,
-			-0.3209436098072093,
-			-0.3211089047557417,
-			-0.3212741899227374,
-			-0.3214394653031616,
-			-0.3216047308919797,
-			-0.3217699866841574,
-			-0.3219352326746612,
-			-0.3221004688584568,
-			-0.3222656952305110,
-			-0.3224309117857909,
-			-0.3225961185192637,
-			-0.3227613154258966,
-			-0.3229265025006574,
-			-0.3230916797385148,
-			-0.3232568471344365,
-			-0.3234220046833920,
-			-0.3235871523803496,
-			-0.3237522902202787,
-			-0.3239174181981497,
-			-0.3240825363089311,
-			-0.3242476445475945,
-			-0.3244127429091097,
-			-0.3245778313884474,
-			-0.3247429099805791,
-			-0.3249079786804764,
-			-0.3250730374831106,
-			-0.3252380863834537,
-			-0.3254031253764784,
-			-0.3255681544571564,
-			-0.3257331736204620,
-			-0.3258981828613675,
-			-0.3260631821748467,
-			-0.3262281715558736,
-			-0.3263931509994215,
-			-0.3265581205004663,
-			-0.3267230800539813,
-			-0.3268880296549423,
-			-0.3270529692983248,
-			-0.3272178989791040,
-			-0.3273828186922559,
-			-0.3275477284327568,
-			-0.3277126281955834,
-			-0.3278775179757128,
-			-0.3280423977681217,
-			-0.3282072675677876,
-			-0.3283721273696883,
-			-0.3285369771688027,
-			-0.3287018169601078,
-			-0.3288666467385832,
-			-0.3290314664992079,
-			-0.3291962762369606,
-			-0.3293610759468217,
-			-0.3295258656237703,
-			-0.3296906452627872,
-			-0.3298554148588528,
-			-0.3300201744069479,
-			-0.3301849239020537,
-			-0.3303496633391513,
-			-0.3305143927132229,
-			-0.3306791120192504,
-			-0.3308438212522162,
-			-0.3310085204071029,
-			-0.3311732094788933,
-			-0.3313378884625712,
-			-0.3315025573531192,
-			-0.3316672161455225,
-			-0.3318318648347644,
-			-0.3319965034158298,
-			-0.3321611318837034,
-			-0.3323257502333699,
-			-0.3324903584598157,
-			-0.3326549565580258,
-			-0.3328195445229866,
-			-0.3329841223496844,
-			-0.3331486900331057,
-			-0.3333132475682373,
-			-0.3334777949500670,
-			-0.3336423321735824,
-			-0.3338068592337710,
-			-0.3339713761256212,
-			-0.3341358828441213,
-			-0.3343003793842606,
-			-0.3344648657410283,
-			-0.3346293419094131,
-			-0.3347938078844057,
-			-0.3349582636609955,
-			-0.3351227092341729,
-			-0.3352871445989293,
-			-0.3354515697502550,
-			-0.3356159846831415,
-			-0.3357803893925806,
-			-0.3359447838735639,
-			-0.3361091681210845,
-			-0.3362735421301338,
-			-0.3364379058957054,
-			-0.3366022594127924,
-			-0.3367666026763884,
-			-0.3369309356814869,
-			-0.3370952584230820,
-			-0.3372595708961689,
-			-0.3374238730957410,
-			-0.3375881650167948,
-			-0.3377524466543249,
-			-0.3379167180033268,
-			-0.3380809790587976,
-			-0.3382452298157320,
-			-0.3384094702691281,
-			-0.3385737004139820,
-			-0.3387379202452914,
-			-0.3389021297580538,
-			-0.3390663289472666,
-			-0.3392305178079286,
-			-0.3393946963350380,
-			-0.3395588645235941,
-			-0.3397230223685951,
-			-0.3398871698650419,
-			-0.3400513070079328,
-			-0.3402154337922688,
-			-0.3403795502130502,
-			-0.3405436562652770,
-			-0.3407077519439517,
-			-0.3408718372440742,
-			-0.3410359121606469,
-			-0.3411999766886719,
-			-0.3413640308231510,
-			-0.3415280745590872,
-			-0.3416921078914831,
-			-0.3418561308153428,
-			-0.3420201433256687,
-			-0.3421841454174654,
-			-0.3423481370857371,
-			-0.3425121183254881,
-			-0.3426760891317236,
-			-0.3428400494994481,
-			-0.3430039994236678,
-			-0.3431679388993882,
-			-0.3433318679216152,
-			-0.3434957864853558,
-			-0.3436596945856160,
-			-0.3438235922174034,
-			-0.3439874793757255,
-			-0.3441513560555894,
-			-0.3443152222520040,
-			-0.3444790779599770,
-			-0.3446429231745169,
-			-0.3448067578906333,
-			-0.3449705821033354,
-			-0.3451343958076324,
-			-0.3452981989985346,
-			-0.3454619916710524,
-			-0.3456257738201955,
-			-0.3457895454409762,
-			-0.3459533065284047,
-			-0.3461170570774929,
-			-0.3462807970832529,
-			-0.3464445265406959,
-			-0.3466082454448359,
-			-0.3467719537906847,
-			-0.3469356515732557,
-			-0.3470993387875627,
-			-0.3472630154286190,
-			-0.3474266814914388,
-			-0.3475903369710369,
-			-0.3477539818624280,
-			-0.3479176161606269,
-			-0.3480812398606491,
-			-0.3482448529575106,
-			-0.3484084554462269,
-			-0.3485720473218152,
-			-0.3487356285792916,
-			-0.3488991992136732,
-			-0.3490627592199777,
-			-0.3492263085932219,
-			-0.3493898473284253,
-			-0.3495533754206047,
-			-0.3497168928647795,
-			-0.3498803996559687,
-			-0.3500438957891917,
-			-0.3502073812594675,
-			-0.3503708560618164,
-			-0.3505343201912589,
-			-0.3506977736428153,
-			-0.3508612164115070,
-			-0.3510246484923546,
-			-0.3511880698803797,
-			-0.3513514805706052,
-			-0.3515148805580516,
-			-0.3516782698377431,
-			-0.3518416484047018,
-			-0.3520050162539510,
-			-0.3521683733805144,
-			-0.3523317197794151,
-			-0.3524950554456784,
-			-0.3526583803743282,
-			-0.3528216945603895,
-			-0.3529849979988876,
-			-0.3531482906848474,
-			-0.3533115726132951,
-			-0.3534748437792570,
-			-0.3536381041777596,
-			-0.3538013538038295,
-			-0.3539645926524937,
-			-0.3541278207187801,
-			-0.3542910379977157,
-			-0.3544542444843297,
-			-0.3546174401736495,
-			-0.3547806250607048,
-			-0.3549437991405239,
-			-0.3551069624081368,
-			-0.3552701148585733,
-			-0.3554332564868630,
-			-0.3555963872880366,
-			-0.3557595072571249,
-			-0.3559226163891590,
-			-0.3560857146791698,
-			-0.3562488021221897,
-			-0.3564118787132506,
-			-0.3565749444473848,
-			-0.3567379993196253,
-			-0.3569010433250045,
-			-0.3570640764585564,
-			-0.3572270987153149,
-			-0.3573901100903132,
-			-0.3575531105785866,
-			-0.3577161001751693,
-			-0.3578790788750962,
-			-0.3580420466734034,
-			-0.3582050035651260,
-			-0.3583679495453003,
-			-0.3585308846089625,
-			-0.3586938087511493,
-			-0.3588567219668984,
-			-0.3590196242512462,
-			-0.3591825155992309,
-			-0.3593453960058906,
-			-0.3595082654662638,
-			-0.3596711239753884,
-			-0.3598339715283047,
-			-0.3599968081200515,
-			-0.3601596337456677,
-			-0.3603224484001947,
-			-0.3604852520786717,
-			-0.3606480447761406,
-			-0.3608108264876416,
-			-0.3609735972082164,
-			-0.3611363569329068,
-			-0.3612991056567545,
-			-0.3614618433748021,
-			-0.3616245700820921,
-			-0.3617872857736682,
-			-0.3619499904445732,
-			-0.3621126840898510,
-			-0.3622753667045459,
-			-0.3624380382837014,
-			-0.3626006988223638,
-			-0.3627633483155767,
-			-0.3629259867583862,
-			-0.3630886141458383,
-			-0.3632512304729780,
-			-0.3634138357348534,
-			-0.3635764299265097,
-			-0.3637390130429948,
-			-0.3639015850793562,
-			-0.3640641460306413,
-			-0.3642266958918983,
-			-0.3643892346581754,
-			-0.3645517623245220,
-			-0.3647142788859868,
-			-0.3648767843376197,
-			-0.3650392786744699,
-			-0.3652017618915878,
-			-0.3653642339840241,
-			-0.3655266949468288,
-			-0.3656891447750543,
-			-0.3658515834637512,
-			-0.3660140110079716,
-			-0.3661764274027678,
-			-0.3663388326431921,
-			-0.3665012267242972,
-			-0.3666636096411367,
-			-0.3668259813887640,
-			-0.3669883419622331,
-			-0.3671506913565978,
-			-0.3673130295669128,
-			-0.3674753565882332,
-			-0.3676376724156144,
-			-0.3677999770441114,
-			-0.3679622704687806,
-			-0.3681245526846782,
-			-0.3682868236868601,
-			-0.3684490834703844,
-			-0.3686113320303076,
-			-0.3687735693616876,
-			-0.3689357954595825,
-			-0.3690980103190498,
-			-0.3692602139351494,
-			-0.3694224063029394,
-			-0.3695845874174795,
-			-0.3697467572738294,
-			-0.3699089158670489,
-			-0.3700710631921982,
-			-0.3702331992443385,
-			-0.3703953240185309,
-			-0.3705574375098361,
-			-0.3707195397133167,
-			-0.3708816306240341,
-			-0.3710437102370508,
-			-0.3712057785474303,
-			-0.3713678355502346,
-			-0.3715298812405283,
-			-0.3716919156133743,
-			-0.3718539386638370,
-			-0.3720159503869816,
-			-0.3721779507778717,
-			-0.3723399398315733,
-			-0.3725019175431518,
-			-0.3726638839076728,
-			-0.3728258389202034,
-			-0.3729877825758088,
-			-0.3731497148695569,
-			-0.3733116357965148,
-			-0.3734735453517501,
-			-0.3736354435303305,
-			-0.3737973303273242,
-			-0.3739592057378007,
-			-0.3741210697568276,
-			-0.3742829223794756,
-			-0.3744447636008137,
-			-0.3746065934159121,
-			-0.3747684118198412,
-			-0.3749302188076711,
-			-0.3750920143744741,
-			-0.3752537985153208,
-			-0.3754155712252830,
-			-0.3755773324994329,
-			-0.3757390823328436,
-			-0.3759008207205867,
-			-0.3760625476577362,
-			-0.3762242631393657,
-			-0.3763859671605482,
-			-0.3765476597163593,
-			-0.3767093408018722,
-			-0.3768710104121625,
-			-0.3770326685423057,
-			-0.3771943151873765,
-			-0.3773559503424520,
-			-0.3775175740026074,
-			-0.3776791861629201,
-			-0.3778407868184672,
-			-0.3780023759643255,
-			-0.3781639535955730,
-			-0.3783255197072877,
-			-0.3784870742945483,
-			-0.3786486173524329,
-			-0.3788101488760213,
-			-0.3789716688603927,
-			-0.3791331773006270,
-			-0.3792946741918045,
-			-0.3794561595290048,
-			-0.3796176333073102,
-			-0.3797790955218012,
-			-0.3799405461675590,
-			-0.3801019852396664,
-			-0.3802634127332050,
-			-0.3804248286432575,
-			-0.3805862329649072,
-			-0.3807476256932373,
-			-0.3809090068233318,
-			-0.3810703763502741,
-			-0.3812317342691489,
-			-0.3813930805750411,
-			-0.3815544152630359,
-			-0.3817157383282184,
-			-0.3818770497656747,
-			-0.3820383495704909,
-			-0.3821996377377531,
-			-0.3823609142625490,
-			-0.3825221791399653,
-			-0.3826834323650897,
-			-0.3828446739330104,
-			-0.3830059038388148,
-			-0.3831671220775928,
-			-0.3833283286444326,
-			-0.3834895235344238,
-			-0.3836507067426564,
-			-0.3838118782642199,
-			-0.3839730380942051,
-			-0.3841341862277025,
-			-0.3842953226598038,
-			-0.3844564473856000,
-			-0.3846175604001831,
-			-0.3847786616986454,
-			-0.3849397512760792,
-			-0.3851008291275782,
-			-0.3852618952482344,
-			-0.3854229496331428,
-			-0.3855839922773965,
-			-0.3857450231760900,
-			-0.3859060423243187,
-			-0.3860670497171766,
-			-0.3862280453497599,
-			-0.3863890292171642,
-			-0.3865500013144857,
-			-0.3867109616368207,
-			-0.3868719101792660,
-			-0.3870328469369192,
-			-0.3871937719048777,
-			-0.3873546850782397,
-			-0.3875155864521030,
-			-0.3876764760215666,
-			-0.3878373537817296,
-			-0.3879982197276906,
-			-0.3881590738545506,
-			-0.3883199161574089,
-			-0.3884807466313661,
-			-0.3886415652715233,
-			-0.3888023720729808,
-			-0.3889631670308414,
-			-0.3891239501402062,
-			-0.3892847213961776,
-			-0.3894454807938587,
-			-0.3896062283283517,
-			-0.3897669639947601,
-			-0.3899276877881881,
-			-0.3900883997037398,
-			-0.3902490997365189,
-			-0.3904097878816310,
-			-0.3905704641341805,
-			-0.3907311284892736,
-			-0.3908917809420160,
-			-0.3910524214875136,
-			-0.3912130501208736,
-			-0.3913736668372024,
-			-0.3915342716316074,
-			-0.3916948644991969,
-			-0.3918554454350783,
-			-0.3920160144343603,
-			-0.3921765714921516,
-			-0.3923371166035616,
-			-0.3924976497636994,
-			-0.3926581709676750,
-			-0.3928186802105988,
-			-0.3929791774875815,
-			-0.3931396627937340,
-			-0.3933001361241674,
-			-0.3934605974739934,
-			-0.3936210468383246,
-			-0.3937814842122727,
-			-0.3939419095909512,
-			-0.3941023229694727,
-			-0.3942627243429508,
-			-0.3944231137065002,
-			-0.3945834910552338,
-			-0.3947438563842672,
-			-0.3949042096887152,
-			-0.3950645509636930,
-			-0.3952248802043162,
-			-0.3953851974057015,
-			-0.3955455025629649,
-			-0.3957057956712232,
-			-0.3958660767255939,
-			-0.3960263457211937,
-			-0.3961866026531418,
-			-0.3963468475165556,
-			-0.3965070803065541,
-			-0.3966673010182565,
-			-0.3968275096467813,
-			-0.3969877061872497,
-			-0.3971478906347805,
-			-0.3973080629844949,
-			-0.3974682232315139,
-			-0.3976283713709582,
-			-0.3977885073979497,
-			-0.3979486313076102,
-			-0.3981087430950628,
-			-0.3982688427554290,
-			-0.3984289302838326,
-			-0.3985890056753973,
-			-0.3987490689252460,
-			-0.3989091200285042,
-			-0.3990691589802952,
-			-0.3992291857757446,
-			-0.3993892004099778,
-			-0.3995492028781199,
-			-0.3997091931752977,
-			-0.3998691712966368,
-			-0.4000291372372646,
-			-0.4001890909923081,
-			-0.4003490325568950,
-			-0.4005089619261528,
-			-0.4006688790952100,
-			-0.4008287840591949,
-			-0.4009886768132371,
-			-0.4011485573524660,
-			-0.4013084256720108,
-			-0.4014682817670019,
-			-0.4016281256325701,
-			-0.4017879572638453,
-			-0.4019477766559601,
-			-0.4021075838040453,
-			-0.4022673787032330,
-			-0.4024271613486559,
-			-0.4025869317354462,
-			-0.4027466898587371,
-			-0.4029064357136626,
-			-0.4030661692953561,
-			-0.4032258905989523,
-			-0.4033855996195852,
-			-0.4035452963523899,
-			-0.4037049807925022,
-			-0.4038646529350577,
-			-0.4040243127751922,
-			-0.4041839603080423,
-			-0.4043435955287452,
-			-0.4045032184324373,
-			-0.4046628290142572,
-			-0.4048224272693422,
-			-0.4049820131928312,
-			-0.4051415867798625,
-			-0.4053011480255752,
-			-0.4054606969251094,
-			-0.4056202334736040,
-			-0.4057797576661999,
-			-0.4059392694980375,
-			-0.4060987689642582,
-			-0.4062582560600027,
-			-0.4064177307804129,
-			-0.4065771931206315,
-			-0.4067366430758001,
-			-0.4068960806410625,
-			-0.4070555058115613,
-			-0.4072149185824401,
-			-0.4073743189488438,
-			-0.4075337069059154,
-			-0.4076930824488009,
-			-0.4078524455726448,
-			-0.4080117962725928,
-			-0.4081711345437909,
-			-0.4083304603813849,
-			-0.4084897737805220,
-			-0.4086490747363490,
-			-0.4088083632440134,
-			-0.4089676392986631,
-			-0.4091269028954458,
-			-0.4092861540295105,
-			-0.4094453926960060,
-			-0.4096046188900819,
-			-0.4097638326068870,
-			-0.4099230338415728,
-			-0.4100822225892883,
-			-0.4102413988451852,
-			-0.4104005626044148,
-			-0.4105597138621280,
-			-0.4107188526134773,
-			-0.4108779788536147,
-			-0.4110370925776933,
-			-0.4111961937808662,
-			-0.4113552824582867,
-			-0.4115143586051088,
-			-0.4116734222164864,
-			-0.4118324732875751,
-			-0.4119915118135287,
-			-0.4121505377895034,
-			-0.4123095512106550,
-			-0.4124685520721391,
-			-0.4126275403691129,
-			-0.4127865160967328,
-			-0.4129454792501565,
-			-0.4131044298245418,
-			-0.4132633678150462,
-			-0.4134222932168290,
-			-0.4135812060250484,
-			-0.4137401062348636,
-			-0.4138989938414349,
-			-0.4140578688399216,
-			-0.4142167312254845,
-			-0.4143755809932841,
-			-0.4145344181384820,
-			-0.4146932426562388,
-			-0.4148520545417177,
-			-0.4150108537900802,
-			-0.4151696403964891,
-			-0.4153284143561079,
-			-0.4154871756640990,
-			-0.4156459243156277,
-			-0.4158046603058573,
-			-0.4159633836299527,
-			-0.4161220942830790,
-			-0.4162807922604010,
-			-0.4164394775570853,
-			-0.4165981501682977,
-			-0.4167568100892046,
-			-0.4169154573149737,
-			-0.4170740918407709,
-			-0.4172327136617651,
-			-0.4173913227731241,
-			-0.4175499191700168,
-			-0.4177085028476111,
-			-0.4178670738010765,
-			-0.4180256320255838,
-			-0.4181841775163013,
-			-0.4183427102684011,
-			-0.4185012302770529,
-			-0.4186597375374278,
-			-0.4188182320446986,
-			-0.4189767137940358,
-			-0.4191351827806132,
-			-0.4192936389996025,
-			-0.4194520824461772,
-			-0.4196105131155104,
-			-0.4197689310027772,
-			-0.4199273361031508,
-			-0.4200857284118063,
-			-0.4202441079239188,
-			-0.4204024746346632,
-			-0.4205608285392168,
-			-0.4207191696327546,
-			-0.4208774979104536,
-			-0.4210358133674910,
-			-0.4211941159990437,
-			-0.4213524058002907,
-			-0.4215106827664090,
-			-0.4216689468925777,
-			-0.4218271981739758,
-			-0.4219854366057827,
-			-0.4221436621831781,
-			-0.4223018749013422,
-			-0.4224600747554560,
-			-0.4226182617406993,
-			-0.4227764358522546,
-			-0.4229345970853031,
-			-0.4230927454350272,
-			-0.4232508808966096,
-			-0.4234090034652321,
-			-0.4235671131360793,
-			-0.4237252099043347,
-			-0.4238832937651814,
-			-0.4240413647138054,
-			-0.4241994227453904,
-			-0.4243574678551216,
-			-0.4245155000381856,
-			-0.4246735192897680,
-			-0.4248315256050557,
-			-0.4249895189792346,
-			-0.4251474994074922,
-			-0.4253054668850167,
-			-0.4254634214069963,
-			-0.4256213629686186,
-			-0.4257792915650727,
-			-0.4259372071915480,
-			-0.4260951098432336,
-			-0.4262529995153207,
-			-0.4264108762029986,
-			-0.4265687399014584,
-			-0.4267265906058914,
-			-0.4268844283114887,
-			-0.4270422530134435,
-			-0.4272000647069470,
-			-0.4273578633871924,
-			-0.4275156490493728,
-			-0.4276734216886820,
-			-0.4278311813003137,
-			-0.4279889278794624,
-			-0.4281466614213228,
-			-0.4283043819210902,
-			-0.4284620893739600,
-			-0.4286197837751283,
-			-0.4287774651197913,
-			-0.4289351334031458,
-			-0.4290927886203890,
-			-0.4292504307667184,
-			-0.4294080598373320,
-			-0.4295656758274281,
-			-0.4297232787322059,
-			-0.4298808685468632,
-			-0.4300384452666009,
-			-0.4301960088866185,
-			-0.4303535594021166,
-			-0.4305110968082954,
-			-0.4306686211003558,
-			-0.4308261322735001,
-			-0.4309836303229301,
-			-0.4311411152438484,
-			-0.4312985870314568,
-			-0.4314560456809587,
-			-0.4316134911875587,
-			-0.4317709235464590,
-			-0.4319283427528657,
-			-0.4320857488019824,
-			-0.4322431416890145,
-			-0.4324005214091675,
-			-0.4325578879576471,
-			-0.4327152413296608,
-			-0.4328725815204140,
-			-0.4330299085251144,
-			-0.4331872223389694,
-			-0.4333445229571872,
-			-0.4335018103749759,
-			-0.4336590845875443,
-			-0.4338163455901016,
-			-0.4339735933778570,
-			-0.4341308279460216,
-			-0.4342880492898046,
-			-0.4344452574044170,
-			-0.4346024522850702,
-			-0.4347596339269757,
-			-0.4349168023253454,
-			-0.4350739574753917,
-			-0.4352310993723274,
-			-0.4353882280113657,
-			-0.4355453433877202,
-			-0.4357024454966048,
-			-0.4358595343332340,
-			-0.4360166098928229,
-			-0.4361736721705857,
-			-0.4363307211617389,
-			-0.4364877568614984,
-			-0.4366447792650805,
-			-0.4368017883677024,
-			-0.4369587841645806,
-			-0.4371157666509327,
-			-0.4372727358219779,
-			-0.4374296916729331,
-			-0.4375866341990187,
-			-0.4377435633954528,
-			-0.4379004792574551,
-			-0.4380573817802468,
-			-0.4382142709590471,
-			-0.4383711467890775,
-			-0.4385280092655592,
-			-0.4386848583837133,
-			-0.4388416941387630,
-			-0.4389985165259307,
-			-0.4391553255404384,
-			-0.4393121211775100,
-			-0.4394689034323691,
-			-0.4396256723002395,
-			-0.4397824277763469,
-			-0.4399391698559151,
-			-0.4400958985341699,
-			-0.4402526138063371,
-			-0.4404093156676422,
-			-0.4405660041133134,
-			-0.4407226791385762,
-			-0.4408793407386585,
-			-0.4410359889087881,
-			-0.4411926236441933,
-			-0.4413492449401026,
-			-0.4415058527917451,
-			-0.4416624471943503,
-			-0.4418190281431481,
-			-0.4419755956333686,
-			-0.4421321496602429,
-			-0.4422886902190011,
-			-0.4424452173048762,
-			-0.4426017309130984,
-			-0.4427582310389014,
-			-0.4429147176775177,
-			-0.4430711908241795,
-			-0.4432276504741218,
-			-0.4433840966225771,
-			-0.4435405292647807,
-			-0.4436969483959673,
-			-0.4438533540113724,
-			-0.4440097461062307,
-			-0.4441661246757784,
-			-0.4443224897152526,
-			-0.4444788412198897,
-			-0.4446351791849276,
-			-0.4447915036056030,
-			-0.4449478144771544,
-			-0.4451041117948203,
-			-0.4452603955538393,
-			-0.4454166657494518,
-			-0.4455729223768963,
-			-0.4457291654314136,
-			-0.4458853949082440,
-			-0.4460416108026286,
-			-0.4461978131098088,
-			-0.4463540018250264,
-			-0.4465101769435236,
-			-0.4466663384605429,
-			-0.4468224863713277,
-			-0.4469786206711211,
-			-0.4471347413551671,
-			-0.4472908484187101,
-			-0.4474469418569947,
-			-0.4476030216652660,
-			-0.4477590878387700,
-			-0.4479151403727515,
-			-0.4480711792624579,
-			-0.4482272045031357,
-			-0.4483832160900321,
-			-0.4485392140183947,
-			-0.4486951982834716,
-			-0.4488511688805111,
-			-0.4490071258047622,
-			-0.4491630690514740,
-			-0.4493189986158964,
-			-0.4494749144932799,
-			-0.4496308166788741,
-			-0.4497867051679300,
-			-0.4499425799557001,
-			-0.4500984410374348,
-			-0.4502542884083877,
-			-0.4504101220638103,
-			-0.4505659419989556,
-			-0.4507217482090782,
-			-0.4508775406894305,
-			-0.4510333194352683,
-			-0.4511890844418451,
-			-0.4513448357044161,
-			-0.4515005732182381,
-			-0.4516562969785657,
-			-0.4518120069806557,
-			-0.4519677032197650,
-			-0.4521233856911508,
-			-0.4522790543900707,
-			-0.4524347093117828,
-			-0.4525903504515454,
-			-0.4527459778046177,
-			-0.4529015913662589,
-			-0.4530571911317283,
-			-0.4532127770962873,
-			-0.4533683492551951,
-			-0.4535239076037134,
-			-0.4536794521371035,
-			-0.4538349828506272,
-			-0.4539904997395467,
-			-0.4541460027991249,
-			-0.4543014920246247,
-			-0.4544569674113097,
-			-0.4546124289544439,
-			-0.4547678766492915,
-			-0.4549233104911176,
-			-0.4550787304751875,
-			-0.4552341365967658,
-			-0.4553895288511197,
-			-0.4555449072335158,
-			-0.4557002717392196,
-			-0.4558556223635002,
-			-0.4560109591016237,
-			-0.4561662819488594,
-			-0.4563215909004760,
-			-0.4564768859517413,
-			-0.4566321670979263,
-			-0.4567874343342992,
-			-0.4569426876561317,
-			-0.4570979270586943,
-			-0.4572531525372575,
-			-0.4574083640870931,
-			-0.4575635617034732,
-			-0.4577187453816701,
-			-0.4578739151169565,
-			-0.4580290709046065,
-			-0.4581842127398928,
-			-0.4583393406180899,
-			-0.4584944545344723,
-			-0.4586495544843146,
-			-0.4588046404628933,
-			-0.4589597124654831,
-			-0.4591147704873605,
-			-0.4592698145238023,
-			-0.4594248445700856,
-			-0.4595798606214878,
-			-0.4597348626732869,
-			-0.4598898507207614,
-			-0.4600448247591898,
-			-0.4601997847838516,
-			-0.4603547307900263,
-			-0.4605096627729940,
-			-0.4606645807280352,
-			-0.4608194846504308,
-			-0.4609743745354623,
-			-0.4611292503784116,
-			-0.4612841121745601,
-			-0.4614389599191913,
-			-0.4615937936075880,
-			-0.4617486132350338,
-			-0.4619034187968128,
-			-0.4620582102882084,
-			-0.4622129877045068,
-			-0.4623677510409916,
-			-0.4625225002929497,
-			-0.4626772354556669,
-			-0.4628319565244299,
-			-0.4629866634945248,
-			-0.4631413563612392,
-			-0.4632960351198619,
-			-0.4634506997656795,
-			-0.4636053502939824,
-			-0.4637599867000582,
-			-0.4639146089791968,
-			-0.4640692171266890,
-			-0.4642238111378237,
-			-0.4643783910078932,
-			-0.4645329567321877,
-			-0.4646875083059991,
-			-0.4648420457246197,
-			-0.4649965689833417,
-			-0.4651510780774584,
-			-0.4653055730022629,
-			-0.4654600537530492,
-			-0.4656145203251114,
-			-0.4657689727137443,
-			-0.4659234109142429,
-			-0.4660778349219029,
-			-0.4662322447320202,
-			-0.4663866403398911,
-			-0.4665410217408126,
-			-0.4666953889300823,
-			-0.4668497419029968,
-			-0.4670040806548552,
-			-0.4671584051809559,
-			-0.4673127154765979,
-			-0.4674670115370805,
-			-0.4676212933577036,
-			-0.4677755609337676,
-			-0.4679298142605732,
-			-0.4680840533334216,
-			-0.4682382781476144,
-			-0.4683924886984539,
-			-0.4685466849812416,
-			-0.4687008669912815,
-			-0.4688550347238770,
-			-0.4690091881743306,
-			-0.4691633273379481,
-			-0.4693174522100327,
-			-0.4694715627858905,
-			-0.4696256590608272,
-			-0.4697797410301475,
-			-0.4699338086891593,
-			-0.4700878620331684,
-			-0.4702419010574820,
-			-0.4703959257574089,
-			-0.4705499361282561,
-			-0.4707039321653326,
-			-0.4708579138639475,
-			-0.4710118812194101,
-			-0.4711658342270303,
-			-0.4713197728821185,
-			-0.4714736971799854,
-			-0.4716276071159423,
-			-0.4717815026853007,
-			-0.4719353838833723,
-			-0.4720892507054709,
-			-0.4722431031469081,
-			-0.4723969412029979,
-			-0.4725507648690540,
-			-0.4727045741403906,
-			-0.4728583690123225,
-			-0.4730121494801647,
-			-0.4731659155392330,
-			-0.4733196671848433,
-			-0.4734734044123121,
-			-0.4736271272169562,
-			-0.4737808355940930,
-			-0.4739345295390402,
-			-0.4740882090471161,
-			-0.4742418741136394,
-			-0.4743955247339295,
-			-0.4745491609033048,
-			-0.4747027826170868,
-			-0.4748563898705944,
-			-0.4750099826591496,
-			-0.4751635609780737,
-			-0.4753171248226872,
-			-0.4754706741883140,
-			-0.4756242090702750,
-			-0.4757777294638945,
-			-0.4759312353644960,
-			-0.4760847267674027,
-			-0.4762382036679392,
-			-0.4763916660614302,
-			-0.4765451139432019,
-			-0.4766985473085786,
-			-0.4768519661528881,
-			-0.4770053704714555,
-			-0.4771587602596085,
-			-0.4773121355126745,
-			-0.4774654962259810,
-			-0.4776188423948576,
-			-0.4777721740146318,
-			-0.4779254910806335,
-			-0.4780787935881922,
-			-0.4782320815326380,
-			-0.4783853549093017,
-			-0.4785386137135141,
-			-0.4786918579406068,
-			-0.4788450875859116,
-			-0.4789983026447610,
-			-0.4791515031124877,
-			-0.4793046889844250,
-			-0.4794578602559065,
-			-0.4796110169222665,
-			-0.4797641589788395,
-			-0.4799172864209608,
-			-0.4800703992439649,
-			-0.4802234974431888,
-			-0.4803765810139684,
-			-0.4805296499516407,
-			-0.4806827042515431,
-			-0.4808357439090126,
-			-0.4809887689193875,
-			-0.4811417792780069,
-			-0.4812947749802098,
-			-0.4814477560213353,
-			-0.4816007223967240,
-			-0.4817536741017150,
-			-0.4819066111316503,
-			-0.4820595334818712,
-			-0.4822124411477183,
-			-0.4823653341245352,
-			-0.4825182124076633,
-			-0.4826710759924459,
-			-0.4828239248742275,
-			-0.4829767590483505,
-			-0.4831295785101609,
-			-0.4832823832550024,
-			-0.4834351732782203,
-			-0.4835879485751615,
-			-0.4837407091411711,
-			-0.4838934549715960,
-			-0.4840461860617833,
-			-0.4841989024070807,
-			-0.4843516040028361,
-			-0.4845042908443979,
-			-0.4846569629271155,
-			-0.4848096202463370,
-			-0.4849622627974133,
-			-0.4851148905756944,
-			-0.4852675035765309,
-			-0.4854201017952743,
-			-0.4855726852272751,
-			-0.4857252538678865,
-			-0.4858778077124605,
-			-0.4860303467563502,
-			-0.4861828709949088,
-			-0.4863353804234904,
-			-0.4864878750374491,
-			-0.4866403548321397,
-			-0.4867928198029174,
-			-0.4869452699451380,
-			-0.4870977052541577,
-			-0.4872501257253322,
-			-0.4874025313540193,
-			-0.4875549221355768,
-			-0.4877072980653614,
-			-0.4878596591387329,
-			-0.4880120053510485,
-			-0.4881643366976688,
-			-0.4883166531739535,
-			-0.4884689547752619,
-			-0.4886212414969551,
-			-0.4887735133343937,
-			-0.4889257702829402,
-			-0.4890780123379563,
-			-0.4892302394948040,
-			-0.4893824517488463,
-			-0.4895346490954467,
-			-0.4896868315299690,
-			-0.4898389990477774,
-			-0.4899911516442366,
-			-0.4901432893147118,
-			-0.4902954120545687,
-			-0.4904475198591733,
-			-0.4905996127238917,
-			-0.4907516906440921,
-			-0.4909037536151408,
-			-0.4910558016324060,
-			-0.4912078346912562,
-			-0.4913598527870601,
-			-0.4915118559151869,
-			-0.4916638440710065,
-			-0.4918158172498889,
-			-0.4919677754472049,
-			-0.4921197186583254,
-			-0.4922716468786226,
-			-0.4924235601034670,
-			-0.4925754583282325,
-			-0.4927273415482915,
-			-0.4928792097590173,
-			-0.4930310629557843,
-			-0.4931829011339655,
-			-0.4933347242889369,
-			-0.4934865324160732,
-			-0.4936383255107501,
-			-0.4937901035683442,
-			-0.4939418665842312,
-			-0.4940936145537881,
-			-0.4942453474723932,
-			-0.4943970653354242,
-			-0.4945487681382598,
-			-0.4947004558762780,
-			-0.4948521285448586,
-			-0.4950037861393810,
-			-0.4951554286552266,
-			-0.4953070560877746,
-			-0.4954586684324076,
-			-0.4956102656845062,
-			-0.4957618478394524,
-			-0.4959134148926299,
-			-0.4960649668394206,
-			-0.4962165036752083,
-			-0.4963680253953769,
-			-0.4965195319953104,
-			-0.4966710234703949,
-			-0.4968224998160145,
-			-0.4969739610275553,
-			-0.4971254071004036,
-			-0.4972768380299460,
-			-0.4974282538115698,
-			-0.4975796544406625,
-			-0.4977310399126125,
-			-0.4978824102228073,
-			-0.4980337653666371,
-			-0.4981851053394907,
-			-0.4983364301367583,
-			-0.4984877397538306,
-			-0.4986390341860972,
-			-0.4987903134289507,
-			-0.4989415774777823,
-			-0.4990928263279845,
-			-0.4992440599749501,
-			-0.4993952784140716,
-			-0.4995464816407427,
-			-0.4996976696503582,
-			-0.4998488424383126,
-			-0.4999999999999998,
-			-0.5001511423308168,
-			-0.5003022694261581,
-			-0.5004533812814211,
-			-0.5006044778920028,
-			-0.5007555592532993,
-			-0.5009066253607101,
-			-0.5010576762096316,
-			-0.5012087117954640,
-			-0.5013597321136063,
-			-0.5015107371594575,
-			-0.5016617269284180,
-			-0.5018127014158885,
-			-0.5019636606172696,
-			-0.5021146045279640,
-			-0.5022655331433725,
-			-0.5024164464588980,
-			-0.5025673444699434,
-			-0.5027182271719121,
-			-0.5028690945602079,
-			-0.5030199466302351,
-			-0.5031707833773984,
-			-0.5033216047971033,
-			-0.5034724108847554,
-			-0.5036232016357608,
-			-0.5037739770455262,
-			-0.5039247371094588,
-			-0.5040754818229661,
-			-0.5042262111814562,
-			-0.5043769251803375,
-			-0.5045276238150191,
-			-0.5046783070809109,
-			-0.5048289749734216,
-			-0.5049796274879627,
-			-0.5051302646199447,
-			-0.5052808863647794,
-			-0.5054314927178774,
-			-0.5055820836746521,
-			-0.5057326592305157,
-			-0.5058832193808818,
-			-0.5060337641211640,
-			-0.5061842934467756,
-			-0.5063348073531323,
-			-0.5064853058356488,
-			-0.5066357888897406,
-			-0.5067862565108242,
-			-0.5069367086943153,
-			-0.5070871454356310,
-			-0.5072375667301888,
-			-0.5073879725734075,
-			-0.5075383629607043,
-			-0.5076887378874985,
-			-0.5078390973492093,
-			-0.5079894413412563,
-			-0.5081397698590608,
-			-0.5082900828980425,
-			-0.5084403804536227,
-			-0.5085906625212234,
-			-0.5087409290962661,
-			-0.5088911801741748,
-			-0.5090414157503713,
-			-0.5091916358202796,
-			-0.5093418403793236,
-			-0.5094920294229280,
-			-0.5096422029465177,
-			-0.5097923609455182,
-			-0.5099425034153553,
-			-0.5100926303514555,
-			-0.5102427417492457,
-			-0.5103928376041531,
-			-0.5105429179116057,
-			-0.5106929826670320,
-			-0.5108430318658598,
-			-0.5109930655035193,
-			-0.5111430835754399,
-			-0.5112930860770519,
-			-0.5114430730037863,
-			-0.5115930443510730,
-			-0.5117430001143448,
-			-0.5118929402890334,
-			-0.5120428648705714,
-			-0.5121927738543921,
-			-0.5123426672359285,
-			-0.5124925450106143,
-			-0.5126424071738849,
-			-0.5127922537211751,
-			-0.5129420846479197,
-			-0.5130918999495550,
-			-0.5132416996215167,
-			-0.5133914836592427,
-			-0.5135412520581703,
-			-0.5136910048137363,
-			-0.5138407419213795,
-			-0.5139904633765386,
-			-0.5141401691746527,
-			-0.5142898593111622,
-			-0.5144395337815065,
-			-0.5145891925811265,
-			-0.5147388357054632,
-			-0.5148884631499585,
-			-0.5150380749100543,
-			-0.5151876709811931,
-			-0.5153372513588180,
-			-0.5154868160383727,
-			-0.5156363650153010,
-			-0.5157858982850474,
-			-0.5159354158430569,
-			-0.5160849176847749,
-			-0.5162344038056474,
-			-0.5163838742011208,
-			-0.5165333288666418,
-			-0.5166827677976579,
-			-0.5168321909896172,
-			-0.5169815984379670,
-			-0.5171309901381571,
-			-0.5172803660856364,
-			-0.5174297262758548,
-			-0.5175790707042628,
-			-0.5177283993663100,
-			-0.5178777122574486,
-			-0.5180270093731301,
-			-0.5181762907088068,
-			-0.5183255562599308,
-			-0.5184748060219551,
-			-0.5186240399903344,
-			-0.5187732581605212,
-			-0.5189224605279718,
-			-0.5190716470881396,
-			-0.5192208178364814,
-			-0.5193699727684521,
-			-0.5195191118795091,
-			-0.5196682351651094,
-			-0.5198173426207096,
-			-0.5199664342417680,
-			-0.5201155100237429,
-			-0.5202645699620940,
-			-0.5204136140522797,
-			-0.5205626422897602,
-			-0.5207116546699958,
-			-0.5208606511884470,
-			-0.5210096318405764,
-			-0.5211585966218444,
-			-0.5213075455277136,
-			-0.5214564785536471,
-			-0.5216053956951078,
-			-0.5217542969475596,
-			-0.5219031823064667,
-			-0.5220520517672937,
-			-0.5222009053255059,
-			-0.5223497429765689,
-			-0.5224985647159488,
-			-0.5226473705391123,
-			-0.5227961604415265,
-			-0.5229449344186590,
-			-0.5230936924659778,
-			-0.5232424345789517,
-			-0.5233911607530495,
-			-0.5235398709837412,
-			-0.5236885652664958,
-			-0.5238372435967849,
-			-0.5239859059700790,
-			-0.5241345523818497,
-			-0.5242831828275692,
-			-0.5244317973027092,
-			-0.5245803958027433,
-			-0.5247289783231449,
-			-0.5248775448593878,
-			-0.5250260954069467,
-			-0.5251746299612958,
-			-0.5253231485179106,
-			-0.5254716510722676,
-			-0.5256201376198431,
-			-0.5257686081561133,
-			-0.5259170626765558,
-			-0.5260655011766484,
-			-0.5262139236518693,
-			-0.5263623300976981,
-			-0.5265107205096131,
-			-0.5266590948830945,
-			-0.5268074532136223,
-			-0.5269557954966773,
-			-0.5271041217277413,
-			-0.5272524319022955,
-			-0.5274007260158221,
-			-0.5275490040638039,
-			-0.5276972660417241,
-			-0.5278455119450663,
-			-0.5279937417693149,
-			-0.5281419555099544,
-			-0.5282901531624699,
-			-0.5284383347223471,
-			-0.5285865001850721,
-			-0.5287346495461316,
-			-0.5288827828010131,
-			-0.5290308999452030,
-			-0.5291790009741905,
-			-0.5293270858834639,
-			-0.5294751546685121,
-			-0.5296232073248254,
-			-0.5297712438478923,
-			-0.5299192642332048,
-			-0.5300672684762534,
-			-0.5302152565725297,
-			-0.5303632285175260,
-			-0.5305111843067338,
-			-0.5306591239356473,
-			-0.5308070473997595,
-			-0.5309549546945647,
-			-0.5311028458155568,
-			-0.5312507207582311,
-			-0.5313985795180830,
-			-0.5315464220906082,
-			-0.5316942484713042,
-			-0.5318420586556669,
-			-0.5319898526391941,
-			-0.5321376304173836,
-			-0.5322853919857337,
-			-0.5324331373397442,
-			-0.5325808664749135,
-			-0.5327285793867420,
-			-0.5328762760707296,
-			-0.5330239565223784,
-			-0.5331716207371886,
-			-0.5333192687106626,
-			-0.5334669004383026,
-			-0.5336145159156115,
-			-0.5337621151380928,
-			-0.5339096981012503,
-			-0.5340572648005885,
-			-0.5342048152316120,
-			-0.5343523493898263,
-			-0.5344998672707373,
-			-0.5346473688698512,
-			-0.5347948541826750,
-			-0.5349423232047160,
-			-0.5350897759314821,
-			-0.5352372123584814,
-			-0.5353846324812230,
-			-0.5355320362952161,
-			-0.5356794237959708,
-			-0.5358267949789964,
-			-0.5359741498398050,
-			-0.5361214883739073,
-			-0.5362688105768155,
-			-0.5364161164440413,
-			-0.5365634059710974,
-			-0.5367106791534983,
-			-0.5368579359867562,
-			-0.5370051764663870,
-			-0.5371524005879044,
-			-0.5372996083468236,
-			-0.5374467997386612,
-			-0.5375939747589330,
-			-0.5377411334031563,
-			-0.5378882756668477,
-			-0.5380354015455252,
-			-0.5381825110347068,
-			-0.5383296041299125,
-			-0.5384766808266602,
-			-0.5386237411204704,
-			-0.5387707850068632,
-			-0.5389178124813588,
-			-0.5390648235394800,
-			-0.5392118181767473,
-			-0.5393587963886834,
-			-0.5395057581708110,
-			-0.5396527035186531,
-			-0.5397996324277345,
-			-0.5399465448935785,
-			-0.5400934409117103,
-			-0.5402403204776550,
-			-0.5403871835869385,
-			-0.5405340302350871,
-			-0.5406808604176275,
-			-0.5408276741300876,
-			-0.5409744713679938,
-			-0.5411212521268758,
-			-0.5412680164022617,
-			-0.5414147641896812,
-			-0.5415614954846640,
-			-0.5417082102827397,
-			-0.5418549085794401,
-			-0.5420015903702962,
-			-0.5421482556508396,
-			-0.5422949044166031,
-			-0.5424415366631186,
-			-0.5425881523859203,
-			-0.5427347515805417,
-			-0.5428813342425173,
-			-0.5430279003673821,
-			-0.5431744499506708,
-			-0.5433209829879192,
-			-0.5434674994746644,
-			-0.5436139994064434,
-			-0.5437604827787926,
-			-0.5439069495872503,
-			-0.5440533998273549,
-			-0.5441998334946448,
-			-0.5443462505846608,
-			-0.5444926510929412,
-			-0.5446390350150271,
-			-0.5447854023464593,
-			-0.5449317530827787,
-			-0.5450780872195287,
-			-0.5452244047522501,
-			-0.5453707056764864,
-			-0.5455169899877810,
-			-0.5456632576816779,
-			-0.5458095087537216,
-			-0.5459557431994567,
-			-0.5461019610144290,
-			-0.5462481621941843,
-			-0.5463943467342690,
-			-0.5465405146302302,
-			-0.5466866658776153,
-			-0.5468328004719722,
-			-0.5469789184088496,
-			-0.5471250196837963,
-			-0.5472711042923619,
-			-0.5474171722300963,
-			-0.5475632234925505,
-			-0.5477092580752744,
-			-0.5478552759738206,
-			-0.5480012771837407,
-			-0.5481472617005877,
-			-0.5482932295199140,
-			-0.5484391806372730,
-			-0.5485851150482197,
-			-0.5487310327483083,
-			-0.5488769337330940,
-			-0.5490228179981319,
-			-0.5491686855389780,
-			-0.5493145363511902,
-			-0.5494603704303239,
-			-0.5496061877719385,
-			-0.5497519883715908,
-			-0.5498977722248398,
-			-0.5500435393272450,
-			-0.5501892896743658,
-			-0.5503350232617624,
-			-0.5504807400849956,
-			-0.5506264401396266,
-			-0.5507721234212167,
-			-0.5509177899253292,
-			-0.5510634396475260,
-			-0.5512090725833704,
-			-0.5513546887284263,
-			-0.5515002880782576,
-			-0.5516458706284302,
-			-0.5517914363745083,
-			-0.5519369853120581,
-			-0.5520825174366459,
-			-0.5522280327438386,
-			-0.5523735312292034,
-			-0.5525190128883084,
-			-0.5526644777167217,
-			-0.5528099257100124,
-			-0.5529553568637497,
-			-0.5531007711735038,
-			-0.5532461686348449,
-			-0.5533915492433443,
-			-0.5535369129945725,
-			-0.5536822598841025,
-			-0.5538275899075067,
-			-0.5539729030603571,
-			-0.5541181993382287,
-			-0.5542634787366939,
-			-0.5544087412513284,
-			-0.5545539868777074,
-			-0.5546992156114052,
-			-0.5548444274479994,
-			-0.5549896223830655,
-			-0.5551348004121806,
-			-0.5552799615309231,
-			-0.5554251057348710,
-			-0.5555702330196023,
-			-0.5557153433806966,
-			-0.5558604368137332,
-			-0.5560055133142930,
-			-0.5561505728779568,
-			-0.5562956155003048,
-			-0.5564406411769195,
-			-0.5565856499033830,
-			-0.5567306416752777,
-			-0.5568756164881881,
-			-0.5570205743376967,
-			-0.5571655152193884,
-			-0.5573104391288479,
-			-0.5574553460616607,
-			-0.5576002360134127,
-			-0.5577451089796901,
-			-0.5578899649560800,
-			-0.5580348039381698,
-			-0.5581796259215475,
-			-0.5583244309018014,
-			-0.5584692188745205,
-			-0.5586139898352945,
-			-0.5587587437797134,
-			-0.5589034807033675,
-			-0.5590482006018485,
-			-0.5591929034707467,
-			-0.5593375893056558,
-			-0.5594822581021668,
-			-0.5596269098558742,
-			-0.5597715445623709,
-			-0.5599161622172514,
-			-0.5600607628161106,
-			-0.5602053463545427,
-			-0.5603499128281445,
-			-0.5604944622325119,
-			-0.5606389945632420,
-			-0.5607835098159313,
-			-0.5609280079861777,
-			-0.5610724890695807,
-			-0.5612169530617376,
-			-0.5613613999582493,
-			-0.5615058297547144,
-			-0.5616502424467340,
-			-0.5617946380299088,
-			-0.5619390164998400,
-			-0.5620833778521307,
-			-0.5622277220823821,
-			-0.5623720491861979,
-			-0.5625163591591814,
-			-0.5626606519969368,
-			-0.5628049276950686,
-			-0.5629491862491820,
-			-0.5630934276548825,
-			-0.5632376519077764,
-			-0.5633818590034703,
-			-0.5635260489375714,
-			-0.5636702217056875,
-			-0.5638143773034268,
-			-0.5639585157263980,
-			-0.5641026369702105,
-			-0.5642467410304740,
-			-0.5643908279027989,
-			-0.5645348975827961,
-			-0.5646789500660769,
-			-0.5648229853482534,
-			-0.5649670034249379,
-			-0.5651110042917432,
-			-0.5652549879442831,
-			-0.5653989543781713,
-			-0.5655429035890226,
-			-0.5656868355724519,
-			-0.5658307503240751,
-			-0.5659746478395075,
-			-0.5661185281143665,
-			-0.5662623911442694,
-			-0.5664062369248326,
-			-0.5665500654516761,
-			-0.5666938767204173,
-			-0.5668376707266756,
-			-0.5669814474660717,
-			-0.5671252069342246,
-			-0.5672689491267566,
-			-0.5674126740392879,
-			-0.5675563816674404,
-			-0.5677000720068376,
-			-0.5678437450531013,
-			-0.5679874008018555,
-			-0.5681310392487241,
-			-0.5682746603893316,
-			-0.5684182642193026,
-			-0.5685618507342640,
-			-0.5687054199298406,
-			-0.5688489718016595,
-			-0.5689925063453479,
-			-0.5691360235565330,
-			-0.5692795234308442,
-			-0.5694230059639092,
-			-0.5695664711513574,
-			-0.5697099189888188,
-			-0.5698533494719238,
-			-0.5699967625963031,
-			-0.5701401583575880,
-			-0.5702835367514106,
-			-0.5704268977734034,
-			-0.5705702414191992,
-			-0.5707135676844316,
-			-0.5708568765647346,
-			-0.5710001680557431,
-			-0.5711434421530911,
-			-0.5712866988524153,
-			-0.5714299381493521,
-			-0.5715731600395367,
-			-0.5717163645186080,
-			-0.5718595515822023,
-			-0.5720027212259587,
-			-0.5721458734455164,
-			-0.5722890082365134,
-			-0.5724321255945910,
-			-0.5725752255153883,
-			-0.5727183079945471,
-			-0.5728613730277088,
-			-0.5730044206105155,
-			-0.5731474507386090,
-			-0.5732904634076328,
-			-0.5734334586132305,
-			-0.5735764363510458,
-			-0.5737193966167244,
-			-0.5738623394059106,
-			-0.5740052647142503,
-			-0.5741481725373897,
-			-0.5742910628709753,
-			-0.5744339357106556,
-			-0.5745767910520772,
-			-0.5747196288908888,
-			-0.5748624492227394,
-			-0.5750052520432786,
-			-0.5751480373481561,
-			-0.5752908051330226,
-			-0.5754335553935290,
-			-0.5755762881253269,
-			-0.5757190033240686,
-			-0.5758617009854066,
-			-0.5760043811049940,
-			-0.5761470436784847,
-			-0.5762896887015327,
-			-0.5764323161697932,
-			-0.5765749260789215,
-			-0.5767175184245724,
-			-0.5768600932024036,
-			-0.5770026504080714,
-			-0.5771451900372335,
-			-0.5772877120855477,
-			-0.5774302165486727,
-			-0.5775727034222674,
-			-0.5777151727019916,
-			-0.5778576243835052,
-			-0.5780000584624689,
-			-0.5781424749345445,
-			-0.5782848737953930,
-			-0.5784272550406764,
-			-0.5785696186660587,
-			-0.5787119646672021,
-			-0.5788542930397715,
-			-0.5789966037794306,
-			-0.5791388968818442,
-			-0.5792811723426790,
-			-0.5794234301575993,
-			-0.5795656703222736,
-			-0.5797078928323675,
-			-0.5798500976835489,
-			-0.5799922848714870,
-			-0.5801344543918494,
-			-0.5802766062403059,
-			-0.5804187404125261,
-			-0.5805608569041804,
-			-0.5807029557109398,
-			-0.5808450368284755,
-			-0.5809871002524598,
-			-0.5811291459785649,
-			-0.5812711740024640,
-			-0.5814131843198302,
-			-0.5815551769263387,
-			-0.5816971518176632,
-			-0.5818391089894793,
-			-0.5819810484374626,
-			-0.5821229701572893,
-			-0.5822648741446365,
-			-0.5824067603951812,
-			-0.5825486289046019,
-			-0.5826904796685759,
-			-0.5828323126827833,
-			-0.5829741279429033,
-			-0.5831159254446158,
-			-0.5832577051836018,
-			-0.5833994671555414,
-			-0.5835412113561174,
-			-0.5836829377810120,
-			-0.5838246464259068,
-			-0.5839663372864867,
-			-0.5841080103584340,
-			-0.5842496656374342,
-			-0.5843913031191723,
-			-0.5845329227993326,
-			-0.5846745246736026,
-			-0.5848161087376678,
-			-0.5849576749872152,
-			-0.5850992234179336,
-			-0.5852407540255101,
-			-0.5853822668056339,
-			-0.5855237617539941,
-			-0.5856652388662806,
-			-0.5858066981381835,
-			-0.5859481395653946,
-			-0.5860895631436043,
-			-0.5862309688685050,
-			-0.5863723567357892,
-			-0.5865137267411498,
-			-0.5866550788802813,
-			-0.5867964131488768,
-			-0.5869377295426315,
-			-0.5870790280572404,
-			-0.5872203086883996,
-			-0.5873615714318052,
-			-0.5875028162831544,
-			-0.5876440432381443,
-			-0.5877852522924730,
-			-0.5879264434418392,
-			-0.5880676166819417,
-			-0.5882087720084803,
-			-0.5883499094171550,
-			-0.5884910289036668,
-			-0.5886321304637167,
-			-0.5887732140930068,
-			-0.5889142797872385,
-			-0.5890553275421159,
-			-0.5891963573533419,
-			-0.5893373692166205,
-			-0.5894783631276567,
-			-0.5896193390821547,
-			-0.5897602970758207,
-			-0.5899012371043603,
-			-0.5900421591634809,
-			-0.5901830632488897,
-			-0.5903239493562946,
-			-0.5904648174814036,
-			-0.5906056676199251,
-			-0.5907464997675700,
-			-0.5908873139200468,
-			-0.5910281100730674,
-			-0.5911688882223420,
-			-0.5913096483635821,
-			-0.5914503904925010,
-			-0.5915911146048101,
-			-0.5917318206962240,
-			-0.5918725087624556,
-			-0.5920131787992196,
-			-0.5921538308022308,
-			-0.5922944647672050,
-			-0.5924350806898581,
-			-0.5925756785659066,
-			-0.5927162583910678,
-			-0.5928568201610592,
-			-0.5929973638715993,
-			-0.5931378895184070,
-			-0.5932783970972006,
-			-0.5934188866037013,
-			-0.5935593580336290,
-			-0.5936998113827048,
-			-0.5938402466466505,
-			-0.5939806638211871,
-			-0.5941210629020384,
-			-0.5942614438849273,
-			-0.5944018067655774,
-			-0.5945421515397131,
-			-0.5946824782030595,
-			-0.5948227867513411,
-			-0.5949630771802848,
-			-0.5951033494856169,
-			-0.5952436036630644,
-			-0.5953838397083551,
-			-0.5955240576172163,
-			-0.5956642573853776,
-			-0.5958044390085686,
-			-0.5959446024825177,
-			-0.5960847478029568,
-			-0.5962248749656159,
-			-0.5963649839662264,
-			-0.5965050748005214,
-			-0.5966451474642324,
-			-0.5967852019530928,
-			-0.5969252382628365,
-			-0.5970652563891973,
-			-0.5972052563279110,
-			-0.5973452380747121,
-			-0.5974852016253366,
-			-0.5976251469755212,
-			-0.5977650741210028,
-			-0.5979049830575189,
-			-0.5980448737808077,
-			-0.5981847462866081,
-			-0.5983246005706591,
-			-0.5984644366287004,
-			-0.5986042544564723,
-			-0.5987440540497165,
-			-0.5988838354041736,
-			-0.5990235985155858,
-			-0.5991633433796958,
-			-0.5993030699922466,
-			-0.5994427783489821,
-			-0.5995824684456462,
-			-0.5997221402779841,
-			-0.5998617938417408,
-			-0.6000014291326624,
-			-0.6001410461464958,
-			-0.6002806448789867,
-			-0.6004202253258839,
-			-0.6005597874829351,
-			-0.6006993313458893,
-			-0.6008388569104957,
-			-0.6009783641725032,
-			-0.6011178531276635,
-			-0.6012573237717264,
-			-0.6013967761004441,
-			-0.6015362101095688,
-			-0.6016756257948525,
-			-0.6018150231520484,
-			-0.6019544021769101,
-			-0.6020937628651926,
-			-0.6022331052126505,
-			-0.6023724292150388,
-			-0.6025117348681135,
-			-0.6026510221676309,
-			-0.6027902911093491,
-			-0.6029295416890245,
-			-0.6030687739024163,
-			-0.6032079877452825,
-			-0.6033471832133827,
-			-0.6034863603024766,
-			-0.6036255190083248,
-			-0.6037646593266883,
-			-0.6039037812533287,
-			-0.6040428847840078,
-			-0.6041819699144885,
-			-0.6043210366405339,
-			-0.6044600849579079,
-			-0.6045991148623748,
-			-0.6047381263496996,
-			-0.6048771194156475,
-			-0.6050160940559849,
-			-0.6051550502664784,
-			-0.6052939880428942,
-			-0.6054329073810013,
-			-0.6055718082765673,
-			-0.6057106907253613,
-			-0.6058495547231528,
-			-0.6059884002657109,
-			-0.6061272273488071,
-			-0.6062660359682120,
-			-0.6064048261196976,
-			-0.6065435977990362,
-			-0.6066823510019999,
-			-0.6068210857243620,
-			-0.6069598019618972,
-			-0.6070984997103799,
-			-0.6072371789655842,
-			-0.6073758397232868,
-			-0.6075144819792631,
-			-0.6076531057292897,
-			-0.6077917109691449,
-			-0.6079302976946052,
-			-0.6080688659014503,
-			-0.6082074155854582,
-			-0.6083459467424085,
-			-0.6084844593680823,
-			-0.6086229534582591,
-			-0.6087614290087207,
-			-0.6088998860152487,
-			-0.6090383244736252,
-			-0.6091767443796341,
-			-0.6093151457290580,
-			-0.6094535285176811,
-			-0.6095918927412881,
-			-0.6097302383956642,
-			-0.6098685654765952,
-			-0.6100068739798674,
-			-0.6101451639012679,
-			-0.6102834352365832,
-			-0.6104216879816025,
-			-0.6105599221321137,
-			-0.6106981376839062,
-			-0.6108363346327701,
-			-0.6109745129744945,
-			-0.6111126727048712,
-			-0.6112508138196915,
-			-0.6113889363147473,
-			-0.6115270401858314,
-			-0.6116651254287360,
-			-0.6118031920392557,
-			-0.6119412400131845,
-			-0.6120792693463175,
-			-0.6122172800344491,
-			-0.6123552720733767,
-			-0.6124932454588953,
-			-0.6126312001868031,
-			-0.6127691362528976,
-			-0.6129070536529763,
-			-0.6130449523828392,
-			-0.6131828324382842,
-			-0.6133206938151124,
-			-0.6134585365091243,
-			-0.6135963605161203,
-			-0.6137341658319022,
-			-0.6138719524522721,
-			-0.6140097203730337,
-			-0.6141474695899893,
-			-0.6142852000989433,
-			-0.6144229118957000,
-			-0.6145606049760645,
-			-0.6146982793358425,
-			-0.6148359349708402,
-			-0.6149735718768643,
-			-0.6151111900497221,
-			-0.6152487894852218,
-			-0.6153863701791715,
-			-0.6155239321273804,
-			-0.6156614753256583,
-			-0.6157989997698151,
-			-0.6159365054556617,
-			-0.6160739923790095,
-			-0.6162114605356701,
-			-0.6163489099214572,
-			-0.6164863405321818,
-			-0.6166237523636590,
-			-0.6167611454117025,
-			-0.6168985196721273,
-			-0.6170358751407485,
-			-0.6171732118133826,
-			-0.6173105296858449,
-			-0.6174478287539534,
-			-0.6175851090135259,
-			-0.6177223704603799,
-			-0.6178596130903342,
-			-0.6179968368992090,
-			-0.6181340418828231,
-			-0.6182712280369977,
-			-0.6184083953575540,
-			-0.6185455438403136,
-			-0.6186826734810981,
-			-0.6188197842757303,
-			-0.6189568762200347,
-			-0.6190939493098341,
-			-0.6192310035409531,
-			-0.6193680389092178,
-			-0.6195050554104524,
-			-0.6196420530404843,
-			-0.6197790317951402,
-			-0.6199159916702469,
-			-0.6200529326616326,
-			-0.6201898547651260,
-			-0.6203267579765560,
-			-0.6204636422917522,
-			-0.6206005077065456,
-			-0.6207373542167662,
-			-0.6208741818182458,
-			-0.6210109905068164,
-			-0.6211477802783103,
-			-0.6212845511285610,
-			-0.6214213030534019,
-			-0.6215580360486676,
-			-0.6216947501101927,
-			-0.6218314452338125,
-			-0.6219681214153644,
-			-0.6221047786506828,
-			-0.6222414169356063,
-			-0.6223780362659724,
-			-0.6225146366376194,
-			-0.6226512180463862,
-			-0.6227877804881123,
-			-0.6229243239586378,
-			-0.6230608484538034,
-			-0.6231973539694505,
-			-0.6233338405014203,
-			-0.6234703080455551,
-			-0.6236067565976992,
-			-0.6237431861536944,
-			-0.6238795967093860,
-			-0.6240159882606187,
-			-0.6241523608032371,
-			-0.6242887143330870,
-			-0.6244250488460159,
-			-0.6245613643378698,
-			-0.6246976608044963,
-			-0.6248339382417446,
-			-0.6249701966454619,
-			-0.6251064360114988,
-			-0.6252426563357049,
-			-0.6253788576139309,
-			-0.6255150398420271,
-			-0.6256512030158456,
-			-0.6257873471312387,
-			-0.6259234721840591,
-			-0.6260595781701599,
-			-0.6261956650853961,
-			-0.6263317329256213,
-			-0.6264677816866905,
-			-0.6266038113644605,
-			-0.6267398219547866,
-			-0.6268758134535259,
-			-0.6270117858565362,
-			-0.6271477391596751,
-			-0.6272836733588015,
-			-0.6274195884497750,
-			-0.6275554844284544,
-			-0.6276913612907004,
-			-0.6278272190323748,
-			-0.6279630576493378,
-			-0.6280988771374526,
-			-0.6282346774925818,
-			-0.6283704587105877,
-			-0.6285062207873353,
-			-0.6286419637186882,
-			-0.6287776875005129,
-			-0.6289133921286729,
-			-0.6290490775990359,
-			-0.6291847439074683,
-			-0.6293203910498373,
-			-0.6294560190220110,
-			-0.6295916278198582,
-			-0.6297272174392475,
-			-0.6298627878760484,
-			-0.6299983391261325,
-			-0.6301338711853692,
-			-0.6302693840496303,
-			-0.6304048777147888,
-			-0.6305403521767160,
-			-0.6306758074312859,
-			-0.6308112434743727,
-			-0.6309466603018496,
-			-0.6310820579095925,
-			-0.6312174362934764,
-			-0.6313527954493777,
-			-0.6314881353731732,
-			-0.6316234560607400,
-			-0.6317587575079562,
-			-0.6318940397107001,
-			-0.6320293026648505,
-			-0.6321645463662882,
-			-0.6322997708108922,
-			-0.6324349759945438,
-			-0.6325701619131244,
-			-0.6327053285625160,
-			-0.6328404759386008,
-			-0.6329756040372635,
-			-0.6331107128543856,
-			-0.6332458023858529,
-			-0.6333808726275501,
-			-0.6335159235753626,
-			-0.6336509552251764,
-			-0.6337859675728785,
-			-0.6339209606143560,
-			-0.6340559343454968,
-			-0.6341908887621898,
-			-0.6343258238603232,
-			-0.6344607396357868,
-			-0.6345956360844717,
-			-0.6347305132022675,
-			-0.6348653709850665,
-			-0.6350002094287608,
-			-0.6351350285292423,
-			-0.6352698282824041,
-			-0.6354046086841407,
-			-0.6355393697303465,
-			-0.6356741114169157,
-			-0.6358088337397438,
-			-0.6359435366947280,
-			-0.6360782202777637,
-			-0.6362128844847491,
-			-0.6363475293115822,
-			-0.6364821547541607,
-			-0.6366167608083841,
-			-0.6367513474701522,
-			-0.6368859147353649,
-			-0.6370204625999230,
-			-0.6371549910597288,
-			-0.6372895001106834,
-			-0.6374239897486894,
-			-0.6375584599696510,
-			-0.6376929107694710,
-			-0.6378273421440541,
-			-0.6379617540893054,
-			-0.6380961466011305,
-			-0.6382305196754353,
-			-0.6383648733081272,
-			-0.6384992074951126,
-			-0.6386335222322997,
-			-0.6387678175155976,
-			-0.6389020933409151,
-			-0.6390363497041620,
-			-0.6391705866012485,
-			-0.6393048040280855,
-			-0.6394390019805847,
-			-0.6395731804546579,
-			-0.6397073394462184,
-			-0.6398414789511786,
-			-0.6399755989654525,
-			-0.6401096994849557,
-			-0.6402437805056016,
-			-0.6403778420233072,
-			-0.6405118840339884,
-			-0.6406459065335617,
-			-0.6407799095179443,
-			-0.6409138929830555,
-			-0.6410478569248127,
-			-0.6411818013391352,
-			-0.6413157262219438,
-			-0.6414496315691576,
-			-0.6415835173766986,
-			-0.6417173836404885,
-			-0.6418512303564488,
-			-0.6419850575205024,
-			-0.6421188651285726,
-			-0.6422526531765844,
-			-0.6423864216604613,
-			-0.6425201705761284,
-			-0.6426538999195127,
-			-0.6427876096865394,
-			-0.6429212998731354,
-			-0.6430549704752294,
-			-0.6431886214887486,
-			-0.6433222529096220,
-			-0.6434558647337789,
-			-0.6435894569571494,
-			-0.6437230295756640,
-			-0.6438565825852540,
-			-0.6439901159818504,
-			-0.6441236297613865,
-			-0.6442571239197951,
-			-0.6443905984530087,
-			-0.6445240533569627,
-			-0.6446574886275912,
-			-0.6447909042608297,
-			-0.6449243002526142,
-			-0.6450576765988814,
-			-0.6451910332955678,
-			-0.6453243703386111,
-			-0.6454576877239504,
-			-0.6455909854475241,
-			-0.6457242635052719,
-			-0.6458575218931338,
-			-0.6459907606070511,
-			-0.6461239796429636,
-			-0.6462571789968148,
-			-0.6463903586645467,
-			-0.6465235186421022,
-			-0.6466566589254247,
-			-0.6467897795104597,
-			-0.6469228803931506,
-			-0.6470559615694440,
-			-0.6471890230352861,
-			-0.6473220647866230,
-			-0.6474550868194021,
-			-0.6475880891295714,
-			-0.6477210717130797,
-			-0.6478540345658756,
-			-0.6479869776839093,
-			-0.6481199010631309,
-			-0.6482528046994910,
-			-0.6483856885889425,
-			-0.6485185527274354,
-			-0.6486513971109240,
-			-0.6487842217353611,
-			-0.6489170265967007,
-			-0.6490498116908973,
-			-0.6491825770139057,
-			-0.6493153225616830,
-			-0.6494480483301835,
-			-0.6495807543153657,
-			-0.6497134405131865,
-			-0.6498461069196041,
-			-0.6499787535305773,
-			-0.6501113803420655,
-			-0.6502439873500288,
-			-0.6503765745504273,
-			-0.6505091419392229,
-			-0.6506416895123767,
-			-0.6507742172658508,
-			-0.6509067251956093,
-			-0.6510392132976146,
-			-0.6511716815678317,
-			-0.6513041300022254,
-			-0.6514365585967605,
-			-0.6515689673474030,
-			-0.6517013562501204,
-			-0.6518337253008789,
-			-0.6519660744956467,
-			-0.6520984038303920,
-			-0.6522307133010845,
-			-0.6523630029036929,
-			-0.6524952726341881,
-			-0.6526275224885411,
-			-0.6527597524627226,
-			-0.6528919625527045,
-			-0.6530241527544608,
-			-0.6531563230639635,
-			-0.6532884734771865,
-			-0.6534206039901055,
-			-0.6535527145986942,
-			-0.6536848052989285,
-			-0.6538168760867856,
-			-0.6539489269582415,
-			-0.6540809579092739,
-			-0.6542129689358610,
-			-0.6543449600339816,
-			-0.6544769311996148,
-			-0.6546088824287409,
-			-0.6547408137173397,
-			-0.6548727250613930,
-			-0.6550046164568828,
-			-0.6551364878997903,
-			-0.6552683393860996,
-			-0.6554001709117938,
-			-0.6555319824728572,
-			-0.6556637740652745,
-			-0.6557955456850312,
-			-0.6559272973281135,
-			-0.6560590289905075,
-			-0.6561907406682003,
-			-0.6563224323571808,
-			-0.6564541040534361,
-			-0.6565857557529563,
-			-0.6567173874517309,
-			-0.6568489991457493,
-			-0.6569805908310035,
-			-0.6571121625034847,
-			-0.6572437141591845,
-			-0.6573752457940956,
-			-0.6575067574042122,
-			-0.6576382489855270,
-			-0.6577697205340357,
-			-0.6579011720457332,
-			-0.6580326035166145,
-			-0.6581640149426766,
-			-0.6582954063199165,
-			-0.6584267776443314,
-			-0.6585581289119199,
-			-0.6586894601186802,
-			-0.6588207712606129,
-			-0.6589520623337166,
-			-0.6590833333339930,
-			-0.6592145842574434,
-			-0.6593458151000688,
-			-0.6594770258578723,
-			-0.6596082165268569,
-			-0.6597393871030260,
-			-0.6598705375823843,
-			-0.6600016679609371,
-			-0.6601327782346885,
-			-0.6602638683996461,
-			-0.6603949384518164,
-			-0.6605259883872059,
-			-0.6606570182018235,
-			-0.6607880278916777,
-			-0.6609190174527774,
-			-0.6610499868811326,
-			-0.6611809361727540,
-			-0.6613118653236520,
-			-0.6614427743298384,
-			-0.6615736631873265,
-			-0.6617045318921275,
-			-0.6618353804402564,
-			-0.6619662088277266,
-			-0.6620970170505535,
-			-0.6622278051047511,
-			-0.6623585729863367,
-			-0.6624893206913267,
-			-0.6626200482157376,
-			-0.6627507555555873,
-			-0.6628814427068952,
-			-0.6630121096656791,
-			-0.6631427564279595,
-			-0.6632733829897568,
-			-0.6634039893470911,
-			-0.6635345754959839,
-			-0.6636651414324586,
-			-0.6637956871525366,
-			-0.6639262126522416,
-			-0.6640567179275978,
-			-0.6641872029746296,
-			-0.6643176677893620,
-			-0.6644481123678220,
-			-0.6645785367060341,
-			-0.6647089408000266,
-			-0.6648393246458270,
-			-0.6649696882394635,
-			-0.6651000315769648,
-			-0.6652303546543604,
-			-0.6653606574676814,
-			-0.6654909400129573,
-			-0.6656212022862197,
-			-0.6657514442835014,
-			-0.6658816660008342,
-			-0.6660118674342516,
-			-0.6661420485797872,
-			-0.6662722094334758,
-			-0.6664023499913523,
-			-0.6665324702494527,
-			-0.6666625702038127,
-			-0.6667926498504693,
-			-0.6669227091854608,
-			-0.6670527482048243,
-			-0.6671827669045995,
-			-0.6673127652808257,
-			-0.6674427433295421,
-			-0.6675727010467902,
-			-0.6677026384286114,
-			-0.6678325554710468,
-			-0.6679624521701392,
-			-0.6680923285219318,
-			-0.6682221845224683,
-			-0.6683520201677928,
-			-0.6684818354539509,
-			-0.6686116303769881,
-			-0.6687414049329502,
-			-0.6688711591178838,
-			-0.6690008929278375,
-			-0.6691306063588582,
-			-0.6692602994069949,
-			-0.6693899720682976,
-			-0.6695196243388153,
-			-0.6696492562145991,
-			-0.6697788676917006,
-			-0.6699084587661708,
-			-0.6700380294340622,
-			-0.6701675796914283,
-			-0.6702971095343224,
-			-0.6704266189587991,
-			-0.6705561079609134,
-			-0.6706855765367200,
-			-0.6708150246822759,
-			-0.6709444523936381,
-			-0.6710738596668628,
-			-0.6712032464980093,
-			-0.6713326128831356,
-			-0.6714619588183012,
-			-0.6715912842995658,
-			-0.6717205893229901,
-			-0.6718498738846355,
-			-0.6719791379805627,
-			-0.6721083816068354,
-			-0.6722376047595161,
-			-0.6723668074346679,
-			-0.6724959896283559,
-			-0.6726251513366448,
-			-0.6727542925555994,
-			-0.6728834132812868,
-			-0.6730125135097734,
-			-0.6731415932371264,
-			-0.6732706524594135,
-			-0.6733996911727045,
-			-0.6735287093730672,
-			-0.6736577070565726,
-			-0.6737866842192910,
-			-0.6739156408572931,
-			-0.6740445769666504,
-			-0.6741734925434366,
-			-0.6743023875837234,
-			-0.6744312620835851,
-			-0.6745601160390956,
-			-0.6746889494463300,
-			-0.6748177623013634,
-			-0.6749465546002726,
-			-0.6750753263391345,
-			-0.6752040775140256,
-			-0.6753328081210244,
-			-0.6754615181562096,
-			-0.6755902076156602,
-			-0.6757188764954564,
-			-0.6758475247916785,
-			-0.6759761525004078,
-			-0.6761047596177256,
-			-0.6762333461397158,
-			-0.6763619120624593,
-			-0.6764904573820411,
-			-0.6766189820945452,
-			-0.6767474861960565,
-			-0.6768759696826606,
-			-0.6770044325504440,
-			-0.6771328747954926,
-			-0.6772612964138941,
-			-0.6773896974017375,
-			-0.6775180777551101,
-			-0.6776464374701021,
-			-0.6777747765428036,
-			-0.6779030949693041,
-			-0.6780313927456960,
-			-0.6781596698680704,
-			-0.6782879263325204,
-			-0.6784161621351383,
-			-0.6785443772720179,
-			-0.6786725717392543,
-			-0.6788007455329415,
-			-0.6789288986491758,
-			-0.6790570310840537,
-			-0.6791851428336712,
-			-0.6793132338941257,
-			-0.6794413042615166,
-			-0.6795693539319415,
-			-0.6796973829015001,
-			-0.6798253911662925,
-			-0.6799533787224192,
-			-0.6800813455659813,
-			-0.6802092916930820,
-			-0.6803372170998219,
-			-0.6804651217823052,
-			-0.6805930057366357,
-			-0.6807208689589178,
-			-0.6808487114452564,
-			-0.6809765331917577,
-			-0.6811043341945268,
-			-0.6812321144496718,
-			-0.6813598739532998,
-			-0.6814876127015197,
-			-0.6816153306904394,
-			-0.6817430279161690,
-			-0.6818707043748184,
-			-0.6819983600624984,
-			-0.6821259949753203,
-			-0.6822536091093966,
-			-0.6823812024608389,
-			-0.6825087750257615,
-			-0.6826363268002782,
-			-0.6827638577805026,
-			-0.6828913679625510,
-			-0.6830188573425391,
-			-0.6831463259165824,
-			-0.6832737736807990,
-			-0.6834012006313065,
-			-0.6835286067642228,
-			-0.6836559920756670,
-			-0.6837833565617588,
-			-0.6839107002186186,
-			-0.6840380230423667,
-			-0.6841653250291259,
-			-0.6842926061750171,
-			-0.6844198664761633,
-			-0.6845471059286884,
-			-0.6846743245287166,
-			-0.6848015222723720,
-			-0.6849286991557798,
-			-0.6850558551750670,
-			-0.6851829903263589,
-			-0.6853101046057837,
-			-0.6854371980094692,
-			-0.6855642705335435,
-			-0.6856913221741359,
-			-0.6858183529273763,
-			-0.6859453627893949,
-			-0.6860723517563230,
-			-0.6861993198242921,
-			-0.6863262669894347,
-			-0.6864531932478833,
-			-0.6865800985957730,
-			-0.6867069830292358,
-			-0.6868338465444082,
-			-0.6869606891374251,
-			-0.6870875108044229,
-			-0.6872143115415382,
-			-0.6873410913449089,
-			-0.6874678502106724,
-			-0.6875945881349672,
-			-0.6877213051139336,
-			-0.6878480011437114,
-			-0.6879746762204402,
-			-0.6881013303402623,
-			-0.6882279634993194,
-			-0.6883545756937538,
-			-0.6884811669197088,
-			-0.6886077371733286,
-			-0.6887342864507567,
-			-0.6888608147481385,
-			-0.6889873220616207,
-			-0.6891138083873483,
-			-0.6892402737214691,
-			-0.6893667180601309,
-			-0.6894931413994815,
-			-0.6896195437356696,
-			-0.6897459250648457,
-			-0.6898722853831591,
-			-0.6899986246867611,
-			-0.6901249429718030,
-			-0.6902512402344372,
-			-0.6903775164708158,
-			-0.6905037716770936,
-			-0.6906300058494229,
-			-0.6907562189839594,
-			-0.6908824110768581,
-			-0.6910085821242755,
-			-0.6911347321223676,
-			-0.6912608610672920,
-			-0.6913869689552063,
-			-0.6915130557822693,
-			-0.6916391215446397,
-			-0.6917651662384787,
-			-0.6918911898599448,
-			-0.6920171924052003,
-			-0.6921431738704067,
-			-0.6922691342517264,
-			-0.6923950735453224,
-			-0.6925209917473587,
-			-0.6926468888539987,
-			-0.6927727648614082,
-			-0.6928986197657528,
-			-0.6930244535631980,
-			-0.6931502662499114,
-			-0.6932760578220606,
-			-0.6934018282758128,
-			-0.6935275776073379,
-			-0.6936533058128052,
-			-0.6937790128883841,
-			-0.6939046988302459,
-			-0.6940303636345614,
-			-0.6941560072975038,
-			-0.6942816298152445,
-			-0.6944072311839576,
-			-0.6945328113998173,
-			-0.6946583704589970,
-			-0.6947839083576731,
-			-0.6949094250920214,
-			-0.6950349206582178,
-			-0.6951603950524399,
-			-0.6952858482708655,
-			-0.6954112803096729,
-			-0.6955366911650411,
-			-0.6956620808331511,
-			-0.6957874493101814,
-			-0.6959127965923143,
-			-0.6960381226757313,
-			-0.6961634275566145,
-			-0.6962887112311471,
-			-0.6964139736955127,
-			-0.6965392149458957,
-			-0.6966644349784804,
-			-0.6967896337894539,
-			-0.6969148113750004,
-			-0.6970399677313083,
-			-0.6971651028545645,
-			-0.6972902167409573,
-			-0.6974153093866754,
-			-0.6975403807879084,
-			-0.6976654309408467,
-			-0.6977904598416800,
-			-0.6979154674866008,
-			-0.6980404538718010,
-			-0.6981654189934725,
-			-0.6982903628478095,
-			-0.6984152854310057,
-			-0.6985401867392558,
-			-0.6986650667687549,
-			-0.6987899255156994,
-			-0.6989147629762853,
-			-0.6990395791467097,
-			-0.6991643740231716,
-			-0.6992891476018683,
-			-0.6994138998789993,
-			-0.6995386308507652,
-			-0.6996633405133654,
-			-0.6997880288630014,
-			-0.6999126958958757,
-			-0.7000373416081896,
-			-0.7001619659961469,
-			-0.7002865690559507,
-			-0.7004111507838064,
-			-0.7005357111759177,
-			-0.7006602502284914,
-			-0.7007847679377337,
-			-0.7009092642998509,
-			-0.7010337393110507,
-			-0.7011581929675423,
-			-0.7012826252655338,
-			-0.7014070362012348,
-			-0.7015314257708557,
-			-0.7016557939706074,
-			-0.7017801407967011,
-			-0.7019044662453502,
-			-0.7020287703127658,
-			-0.7021530529951623,
-			-0.7022773142887538,
-			-0.7024015541897551,
-			-0.7025257726943815,
-			-0.7026499697988494,
-			-0.7027741454993747,
-			-0.7028982997921757,
-			-0.7030224326734703,
-			-0.7031465441394767,
-			-0.7032706341864143,
-			-0.7033947028105038,
-			-0.7035187500079653,
-			-0.7036427757750201,
-			-0.7037667801078904,
-			-0.7038907630027990,
-			-0.7040147244559685,
-			-0.7041386644636228,
-			-0.7042625830219875,
-			-0.7043864801272867,
-			-0.7045103557757468,
-			-0.7046342099635947,
-			-0.7047580426870566,
-			-0.7048818539423611,
-			-0.7050056437257369,
-			-0.7051294120334124,
-			-0.7052531588616178,
-			-0.7053768842065834,
-			-0.7055005880645404,
-			-0.7056242704317204,
-			-0.7057479313043569,
-			-0.7058715706786810,
-			-0.7059951885509279,
-			-0.7061187849173316,
-			-0.7062423597741271,
-			-0.7063659131175500,
-			-0.7064894449438369,
-			-0.7066129552492247,
-			-0.7067364440299509,
-			-0.7068599112822538,
-			-0.7069833570023734,
-			-0.7071067811865475,
-			-0.7072301838310175,
-			-0.7073535649320244,
-			-0.7074769244858095,
-			-0.7076002624886151,
-			-0.7077235789366845,
-			-0.7078468738262602,
-			-0.7079701471535875,
-			-0.7080933989149112,
-			-0.7082166291064759,
-			-0.7083398377245287,
-			-0.7084630247653165,
-			-0.7085861902250860,
-			-0.7087093341000861,
-			-0.7088324563865657,
-			-0.7089555570807735,
-			-0.7090786361789599,
-			-0.7092016936773766,
-			-0.7093247295722740,
-			-0.7094477438599042,
-			-0.7095707365365207,
-			-0.7096937075983769,
-			-0.7098166570417258,
-			-0.7099395848628233,
-			-0.7100624910579247,
-			-0.7101853756232854,
-			-0.7103082385551626,
-			-0.7104310798498135,
-			-0.7105538995034962,
-			-0.7106766975124691,
-			-0.7107994738729925,
-			-0.7109222285813255,
-			-0.7110449616337287,
-			-0.7111676730264643,
-			-0.7112903627557937,
-			-0.7114130308179796,
-			-0.7115356772092853,
-			-0.7116583019259749,
-			-0.7117809049643127,
-			-0.7119034863205651,
-			-0.7120260459909967,
-			-0.7121485839718744,
-			-0.7122711002594663,
-			-0.7123935948500392,
-			-0.7125160677398625,
-			-0.7126385189252052,
-			-0.7127609484023375,
-			-0.7128833561675296,
-			-0.7130057422170526,
-			-0.7131281065471797,
-			-0.7132504491541815,
-			-0.7133727700343324,
-			-0.7134950691839063,
-			-0.7136173465991774,
-			-0.7137396022764212,
-			-0.7138618362119136,
-			-0.7139840484019309,
-			-0.7141062388427499,
-			-0.7142284075306496,
-			-0.7143505544619076,
-			-0.7144726796328031,
-			-0.7145947830396169,
-			-0.7147168646786282,
-			-0.7148389245461192,
-			-0.7149609626383716,
-			-0.7150829789516674,
-			-0.7152049734822901,
-			-0.7153269462265234,
-			-0.7154488971806520,
-			-0.7155708263409606,
-			-0.7156927337037355,
-			-0.7158146192652636,
-			-0.7159364830218312,
-			-0.7160583249697261,
-			-0.7161801451052376,
-			-0.7163019434246543,
-			-0.7164237199242659,
-			-0.7165454746003631,
-			-0.7166672074492370,
-			-0.7167889184671791,
-			-0.7169106076504830,
-			-0.7170322749954402,
-			-0.7171539204983455,
-			-0.7172755441554933,
-			-0.7173971459631785,
-			-0.7175187259176971,
-			-0.7176402840153456,
-			-0.7177618202524205,
-			-0.7178833346252204,
-			-0.7180048271300437,
-			-0.7181262977631890,
-			-0.7182477465209560,
-			-0.7183691733996462,
-			-0.7184905783955595,
-			-0.7186119615049984,
-			-0.7187333227242654,
-			-0.7188546620496635,
-			-0.7189759794774959,
-			-0.7190972750040679,
-			-0.7192185486256846,
-			-0.7193398003386513,
-			-0.7194610301392742,
-			-0.7195822380238616,
-			-0.7197034239887199,
-			-0.7198245880301586,
-			-0.7199457301444868,
-			-0.7200668503280137,
-			-0.7201879485770500,
-			-0.7203090248879069,
-			-0.7204300792568963,
-			-0.7205511116803301,
-			-0.7206721221545227,
-			-0.7207931106757866,
-			-0.7209140772404367,
-			-0.7210350218447887,
-			-0.7211559444851577,
-			-0.7212768451578605,
-			-0.7213977238592142,
-			-0.7215185805855365,
-			-0.7216394153331461,
-			-0.7217602280983618,
-			-0.7218810188775047,
-			-0.7220017876668933,
-			-0.7221225344628501,
-			-0.7222432592616967,
-			-0.7223639620597555,
-			-0.7224846428533498,
-			-0.7226053016388032,
-			-0.7227259384124406,
-			-0.7228465531705865,
-			-0.7229671459095685,
-			-0.7230877166257110,
-			-0.7232082653153419,
-			-0.7233287919747898,
-			-0.7234492966003823,
-			-0.7235697791884491,
-			-0.7236902397353205,
-			-0.7238106782373264,
-			-0.7239310946907977,
-			-0.7240514890920676,
-			-0.7241718614374676,
-			-0.7242922117233309,
-			-0.7244125399459924,
-			-0.7245328461017856,
-			-0.7246531301870465,
-			-0.7247733921981107,
-			-0.7248936321313152,
-			-0.7250138499829967,
-			-0.7251340457494934,
-			-0.7252542194271440,
-			-0.7253743710122876,
-			-0.7254945005012642,
-			-0.7256146078904151,
-			-0.7257346931760809,
-			-0.7258547563546034,
-			-0.7259747974223263,
-			-0.7260948163755919,
-			-0.7262148132107447,
-			-0.7263347879241293,
-			-0.7264547405120910,
-			-0.7265746709709755,
-			-0.7266945792971310,
-			-0.7268144654869028,
-			-0.7269343295366402,
-			-0.7270541714426920,
-			-0.7271739912014068,
-			-0.7272937888091353,
-			-0.7274135642622285,
-			-0.7275333175570368,
-			-0.7276530486899132,
-			-0.7277727576572107,
-			-0.7278924444552819,
-			-0.7280121090804810,
-			-0.7281317515291635,
-			-0.7282513717976844,
-			-0.7283709698824001,
-			-0.7284905457796673,
-			-0.7286100994858438,
-			-0.7287296309972868,
-			-0.7288491403103563,
-			-0.7289686274214117,
-			-0.7290880923268125,
-			-0.7292075350229198,
-			-0.7293269555060959,
-			-0.7294463537727019,
-			-0.7295657298191018,
-			-0.7296850836416590,
-			-0.7298044152367371,
-			-0.7299237246007015,
-			-0.7300430117299179,
-			-0.7301622766207524,
-			-0.7302815192695721,
-			-0.7304007396727447,
-			-0.7305199378266384,
-			-0.7306391137276220,
-			-0.7307582673720665,
-			-0.7308773987563403,
-			-0.7309965078768156,
-			-0.7311155947298641,
-			-0.7312346593118579,
-			-0.7313537016191705,
-			-0.7314727216481749,
-			-0.7315917193952470,
-			-0.7317106948567601,
-			-0.7318296480290911,
-			-0.7319485789086162,
-			-0.7320674874917128,
-			-0.7321863737747584,
-			-0.7323052377541317,
-			-0.7324240794262118,
-			-0.7325428987873787,
-			-0.7326616958340131,
-			-0.7327804705624958,
-			-0.7328992229692086,
-			-0.7330179530505351,
-			-0.7331366608028571,
-			-0.7332553462225598,
-			-0.7333740093060278,
-			-0.7334926500496456,
-			-0.7336112684497993,
-			-0.7337298645028765,
-			-0.7338484382052637,
-			-0.7339669895533490,
-			-0.7340855185435212,
-			-0.7342040251721703,
-			-0.7343225094356853,
-			-0.7344409713304579,
-			-0.7345594108528795,
-			-0.7346778279993416,
-			-0.7347962227662371,
-			-0.7349145951499599,
-			-0.7350329451469040,
-			-0.7351512727534639,
-			-0.7352695779660361,
-			-0.7353878607810159,
-			-0.7355061211948002,
-			-0.7356243592037873,
-			-0.7357425748043749,
-			-0.7358607679929621,
-			-0.7359789387659484,
-			-0.7360970871197343,
-			-0.7362152130507207,
-			-0.7363333165553095,
-			-0.7364513976299024,
-			-0.7365694562709032,
-			-0.7366874924747155,
-			-0.7368055062377431,
-			-0.7369234975563917,
-			-0.7370414664270670,
-			-0.7371594128461754,
-			-0.7372773368101240,
-			-0.7373952383153206,
-			-0.7375131173581740,
-			-0.7376309739350930,
-			-0.7377488080424874,
-			-0.7378666196767685,
-			-0.7379844088343466,
-			-0.7381021755116343,
-			-0.7382199197050444,
-			-0.7383376414109892,
-			-0.7384553406258837,
-			-0.7385730173461423,
-			-0.7386906715681802,
-			-0.7388083032884132,
-			-0.7389259125032588,
-			-0.7390434992091335,
-			-0.7391610634024561,
-			-0.7392786050796455,
-			-0.7393961242371205,
-			-0.7395136208713017,
-			-0.7396310949786098,
-			-0.7397485465554663,
-			-0.7398659755982936,
-			-0.7399833821035142,
-			-0.7401007660675525,
-			-0.7402181274868318,
-			-0.7403354663577778,
-			-0.7404527826768162,
-			-0.7405700764403728,
-			-0.7406873476448749,
-			-0.7408045962867501,
-			-0.7409218223624269,
-			-0.7410390258683344,
-			-0.7411562068009026,
-			-0.7412733651565611,
-			-0.7413905009317421,
-			-0.7415076141228772,
-			-0.7416247047263982,
-			-0.7417417727387392,
-			-0.7418588181563337,
-			-0.7419758409756163,
-			-0.7420928411930224,
-			-0.7422098188049882,
-			-0.7423267738079498,
-			-0.7424437061983444,
-			-0.7425606159726111,
-			-0.7426775031271874,
-			-0.7427943676585136,
-			-0.7429112095630295,
-			-0.7430280288371760,
-			-0.7431448254773941,
-			-0.7432615994801265,
-			-0.7433783508418162,
-			-0.7434950795589061,
-			-0.7436117856278406,
-			-0.7437284690450654,
-			-0.7438451298070249,
-			-0.7439617679101663,
-			-0.7440783833509367,
-			-0.7441949761257830,
-			-0.7443115462311541,
-			-0.7444280936634990,
-			-0.7445446184192674,
-			-0.7446611204949100,
-			-0.7447775998868775,
-			-0.7448940565916220,
-			-0.7450104906055959,
-			-0.7451269019252532,
-			-0.7452432905470463,
-			-0.7453596564674310,
-			-0.7454759996828622,
-			-0.7455923201897958,
-			-0.7457086179846887,
-			-0.7458248930639978,
-			-0.7459411454241821,
-			-0.7460573750616994,
-			-0.7461735819730095,
-			-0.7462897661545727,
-			-0.7464059276028495,
-			-0.7465220663143016,
-			-0.7466381822853914,
-			-0.7467542755125813,
-			-0.7468703459923354,
-			-0.7469863937211179,
-			-0.7471024186953935,
-			-0.7472184209116277,
-			-0.7473344003662878,
-			-0.7474503570558397,
-			-0.7475662909767521,
-			-0.7476822021254933,
-			-0.7477980904985317,
-			-0.7479139560923379,
-			-0.7480297989033826,
-			-0.7481456189281364,
-			-0.7482614161630713,
-			-0.7483771906046601,
-			-0.7484929422493760,
-			-0.7486086710936929,
-			-0.7487243771340859,
-			-0.7488400603670305,
-			-0.7489557207890022,
-			-0.7490713583964778,
-			-0.7491869731859354,
-			-0.7493025651538526,
-			-0.7494181342967082,
-			-0.7495336806109826,
-			-0.7496492040931548,
-			-0.7497647047397068,
-			-0.7498801825471202,
-			-0.7499956375118766,
-			-0.7501110696304595,
-			-0.7502264788993527,
-			-0.7503418653150404,
-			-0.7504572288740079,
-			-0.7505725695727414,
-			-0.7506878874077263,
-			-0.7508031823754509,
-			-0.7509184544724029,
-			-0.7510337036950703,
-			-0.7511489300399431,
-			-0.7512641335035111,
-			-0.7513793140822649,
-			-0.7514944717726960,
-			-0.7516096065712964,
-			-0.7517247184745594,
-			-0.7518398074789776,
-			-0.7519548735810454,
-			-0.7520699167772584,
-			-0.7521849370641113,
-			-0.7522999344381009,
-			-0.7524149088957245,
-			-0.7525298604334787,
-			-0.7526447890478628,
-			-0.7527596947353760,
-			-0.7528745774925173,
-			-0.7529894373157872,
-			-0.7531042742016878,
-			-0.7532190881467198,
-			-0.7533338791473866,
-			-0.7534486472001916,
-			-0.7535633923016379,
-			-0.7536781144482309,
-			-0.7537928136364754,
-			-0.7539074898628779,
-			-0.7540221431239451,
-			-0.7541367734161843,
-			-0.7542513807361039,
-			-0.7543659650802121,
-			-0.7544805264450194,
-			-0.7545950648270359,
-			-0.7547095802227720,
-			-0.7548240726287396,
-			-0.7549385420414513,
-			-0.7550529884574197,
-			-0.7551674118731591,
-			-0.7552818122851835,
-			-0.7553961896900084,
-			-0.7555105440841495,
-			-0.7556248754641237,
-			-0.7557391838264474,
-			-0.7558534691676395,
-			-0.7559677314842181,
-			-0.7560819707727030,
-			-0.7561961870296140,
-			-0.7563103802514721,
-			-0.7564245504347984,
-			-0.7565386975761149,
-			-0.7566528216719456,
-			-0.7567669227188126,
-			-0.7568810007132413,
-			-0.7569950556517566,
-			-0.7571090875308832,
-			-0.7572230963471486,
-			-0.7573370820970794,
-			-0.7574510447772038,
-			-0.7575649843840497,
-			-0.7576789009141462,
-			-0.7577927943640242,
-			-0.7579066647302132,
-			-0.7580205120092451,
-			-0.7581343361976524,
-			-0.7582481372919666,
-			-0.7583619152887217,
-			-0.7584756701844523,
-			-0.7585894019756925,
-			-0.7587031106589781,
-			-0.7588167962308455,
-			-0.7589304586878314,
-			-0.7590440980264733,
-			-0.7591577142433107,
-			-0.7592713073348808,
-			-0.7593848772977246,
-			-0.7594984241283823,
-			-0.7596119478233950,
-			-0.7597254483793047,
-			-0.7598389257926540,
-			-0.7599523800599856,
-			-0.7600658111778442,
-			-0.7601792191427740,
-			-0.7602926039513211,
-			-0.7604059656000308,
-			-0.7605193040854504,
-			-0.7606326194041272,
-			-0.7607459115526094,
-			-0.7608591805274461,
-			-0.7609724263251869,
-			-0.7610856489423820,
-			-0.7611988483755820,
-			-0.7613120246213398,
-			-0.7614251776762067,
-			-0.7615383075367366,
-			-0.7616514141994835,
-			-0.7617644976610009,
-			-0.7618775579178451,
-			-0.7619905949665721,
-			-0.7621036088037378,
-			-0.7622165994259003,
-			-0.7623295668296174,
-			-0.7624425110114480,
-			-0.7625554319679513,
-			-0.7626683296956884,
-			-0.7627812041912194,
-			-0.7628940554511063,
-			-0.7630068834719110,
-			-0.7631196882501976,
-			-0.7632324697825289,
-			-0.7633452280654694,
-			-0.7634579630955852,
-			-0.7635706748694410,
-			-0.7636833633836042,
-			-0.7637960286346421,
-			-0.7639086706191225,
-			-0.7640212893336139,
-			-0.7641338847746860,
-			-0.7642464569389090,
-			-0.7643590058228537,
-			-0.7644715314230915,
-			-0.7645840337361950,
-			-0.7646965127587370,
-			-0.7648089684872913,
-			-0.7649214009184317,
-			-0.7650338100487342,
-			-0.7651461958747742,
-			-0.7652585583931282,
-			-0.7653708976003735,
-			-0.7654832134930883,
-			-0.7655955060678509,
-			-0.7657077753212403,
-			-0.7658200212498375,
-			-0.7659322438502232,
-			-0.7660444431189779,
-			-0.7661566190526848,
-			-0.7662687716479265,
-			-0.7663809009012867,
-			-0.7664930068093497,
-			-0.7666050893687009,
-			-0.7667171485759252,
-			-0.7668291844276095,
-			-0.7669411969203417,
-			-0.7670531860507085,
-			-0.7671651518152994,
-			-0.7672770942107037,
-			-0.7673890132335109,
-			-0.7675009088803119,
-			-0.7676127811476987,
-			-0.7677246300322629,
-			-0.7678364555305975,
-			-0.7679482576392962,
-			-0.7680600363549532,
-			-0.7681717916741635,
-			-0.7682835235935237,
-			-0.7683952321096286,
-			-0.7685069172190766,
-			-0.7686185789184652,
-			-0.7687302172043931,
-			-0.7688418320734595,
-			-0.7689534235222645,
-			-0.7690649915474087,
-			-0.7691765361454936,
-			-0.7692880573131211,
-			-0.7693995550468953,
-			-0.7695110293434179,
-			-0.7696224801992945,
-			-0.7697339076111296,
-			-0.7698453115755292,
-			-0.7699566920890996,
-			-0.7700680491484482,
-			-0.7701793827501824,
-			-0.7702906928909107,
-			-0.7704019795672433,
-			-0.7705132427757891,
-			-0.7706244825131596,
-			-0.7707356987759664,
-			-0.7708468915608206,
-			-0.7709580608643360,
-			-0.7710692066831264,
-			-0.7711803290138052,
-			-0.7712914278529879,
-			-0.7714025031972899,
-			-0.7715135550433285,
-			-0.7716245833877198,
-			-0.7717355882270824,
-			-0.7718465695580350,
-			-0.7719575273771964,
-			-0.7720684616811865,
-			-0.7721793724666269,
-			-0.7722902597301384,
-			-0.7724011234683432,
-			-0.7725119636778645,
-			-0.7726227803553256,
-			-0.7727335734973507,
-			-0.7728443431005660,
-			-0.7729550891615956,
-			-0.7730658116770670,
-			-0.7731765106436073,
-			-0.7732871860578441,
-			-0.7733978379164064,
-			-0.7735084662159232,
-			-0.7736190709530248,
-			-0.7737296521243420,
-			-0.7738402097265065,
-			-0.7739507437561496,
-			-0.7740612542099052,
-			-0.7741717410844067,
-			-0.7742822043762885,
-			-0.7743926440821856,
-			-0.7745030601987337,
-			-0.7746134527225699,
-			-0.7747238216503305,
-			-0.7748341669786541,
-			-0.7749444887041798,
-			-0.7750547868235458,
-			-0.7751650613333932,
-			-0.7752753122303626,
-			-0.7753855395110956,
-			-0.7754957431722344,
-			-0.7756059232104222,
-			-0.7757160796223024,
-			-0.7758262124045194,
-			-0.7759363215537187,
-			-0.7760464070665460,
-			-0.7761564689396477,
-			-0.7762665071696719,
-			-0.7763765217532660,
-			-0.7764865126870784,
-			-0.7765964799677596,
-			-0.7767064235919591,
-			-0.7768163435563280,
-			-0.7769262398575176,
-			-0.7770361124921812,
-			-0.7771459614569707,
-			-0.7772557867485407,
-			-0.7773655883635459,
-			-0.7774753662986409,
-			-0.7775851205504820,
-			-0.7776948511157258,
-			-0.7778045579910298,
-			-0.7779142411730521,
-			-0.7780239006584515,
-			-0.7781335364438877,
-			-0.7782431485260206,
-			-0.7783527369015125,
-			-0.7784623015670233,
-			-0.7785718425192167,
-			-0.7786813597547557,
-			-0.7787908532703040,
-			-0.7789003230625263,
-			-0.7790097691280884,
-			-0.7791191914636555,
-			-0.7792285900658947,
-			-0.7793379649314743,
-			-0.7794473160570616,
-			-0.7795566434393257,
-			-0.7796659470749369,
-			-0.7797752269605651,
-			-0.7798844830928817,
-			-0.7799937154685583,
-			-0.7801029240842681,
-			-0.7802121089366837,
-			-0.7803212700224791,
-			-0.7804304073383299,
-			-0.7805395208809105,
-			-0.7806486106468979,
-			-0.7807576766329691,
-			-0.7808667188358013,
-			-0.7809757372520727,
-			-0.7810847318784633,
-			-0.7811937027116521,
-			-0.7813026497483200,
-			-0.7814115729851483,
-			-0.7815204724188188,
-			-0.7816293480460141,
-			-0.7817381998634190,
-			-0.7818470278677155,
-			-0.7819558320555900,
-			-0.7820646124237278,
-			-0.7821733689688153,
-			-0.7822821016875394,
-			-0.7823908105765881,
-			-0.7824994956326499,
-			-0.7826081568524139,
-			-0.7827167942325700,
-			-0.7828254077698099,
-			-0.7829339974608236,
-			-0.7830425633023040,
-			-0.7831511052909441,
-			-0.7832596234234374,
-			-0.7833681176964781,
-			-0.7834765881067617,
-			-0.7835850346509831,
-			-0.7836934573258397,
-			-0.7838018561280288,
-			-0.7839102310542474,
-			-0.7840185821011952,
-			-0.7841269092655714,
-			-0.7842352125440759,
-			-0.7843434919334099,
-			-0.7844517474302751,
-			-0.7845599790313734,
-			-0.7846681867334081,
-			-0.7847763705330830,
-			-0.7848845304271027,
-			-0.7849926664121721,
-			-0.7851007784849978,
-			-0.7852088666422865,
-			-0.7853169308807447,
-			-0.7854249711970817,
-			-0.7855329875880060,
-			-0.7856409800502271,
-			-0.7857489485804554,
-			-0.7858568931754020,
-			-0.7859648138317786,
-			-0.7860727105462978,
-			-0.7861805833156738,
-			-0.7862884321366189,
-			-0.7863962570058490,
-			-0.7865040579200794,
-			-0.7866118348760260,
-			-0.7867195878704060,
-			-0.7868273168999370,
-			-0.7869350219613374,
-			-0.7870427030513258,
-			-0.7871503601666234,
-			-0.7872579933039492,
-			-0.7873656024600253,
-			-0.7874731876315738,
-			-0.7875807488153171,
-			-0.7876882860079791,
-			-0.7877957992062837,
-			-0.7879032884069564,
-			-0.7880107536067219,
-			-0.7881181948023074,
-			-0.7882256119904402,
-			-0.7883330051678473,
-			-0.7884403743312581,
-			-0.7885477194774018,
-			-0.7886550406030083,
-			-0.7887623377048085,
-			-0.7888696107795342,
-			-0.7889768598239173,
-			-0.7890840848346905,
-			-0.7891912858085885,
-			-0.7892984627423452,
-			-0.7894056156326953,
-			-0.7895127444763760,
-			-0.7896198492701229,
-			-0.7897269300106735,
-			-0.7898339866947667,
-			-0.7899410193191406,
-			-0.7900480278805351,
-			-0.7901550123756904,
-			-0.7902619728013477,
-			-0.7903689091542485,
-			-0.7904758214311358,
-			-0.7905827096287530,
-			-0.7906895737438434,
-			-0.7907964137731518,
-			-0.7909032297134245,
-			-0.7910100215614069,
-			-0.7911167893138462,
-			-0.7912235329674900,
-			-0.7913302525190868,
-			-0.7914369479653854,
-			-0.7915436193031368,
-			-0.7916502665290899,
-			-0.7917568896399972,
-			-0.7918634886326105,
-			-0.7919700635036826,
-			-0.7920766142499670,
-			-0.7921831408682183,
-			-0.7922896433551906,
-			-0.7923961217076406,
-			-0.7925025759223248,
-			-0.7926090059959997,
-			-0.7927154119254234,
-			-0.7928217937073554,
-			-0.7929281513385540,
-			-0.7930344848157801,
-			-0.7931407941357944,
-			-0.7932470792953589,
-			-0.7933533402912353,
-			-0.7934595771201868,
-			-0.7935657897789778,
-			-0.7936719782643722,
-			-0.7937781425731358,
-			-0.7938842827020348,
-			-0.7939903986478352,
-			-0.7940964904073051,
-			-0.7942025579772131,
-			-0.7943086013543275,
-			-0.7944146205354181,
-			-0.7945206155172557,
-			-0.7946265862966114,
-			-0.7947325328702569,
-			-0.7948384552349659,
-			-0.7949443533875100,
-			-0.7950502273246649,
-			-0.7951560770432049,
-			-0.7952619025399056,
-			-0.7953677038115436,
-			-0.7954734808548959,
-			-0.7955792336667402,
-			-0.7956849622438553,
-			-0.7957906665830203,
-			-0.7958963466810161,
-			-0.7960020025346221,
-			-0.7961076341406206,
-			-0.7962132414957940,
-			-0.7963188245969250,
-			-0.7964243834407976,
-			-0.7965299180241965,
-			-0.7966354283439060,
-			-0.7967409143967130,
-			-0.7968463761794041,
-			-0.7969518136887661,
-			-0.7970572269215879,
-			-0.7971626158746581,
-			-0.7972679805447666,
-			-0.7973733209287035,
-			-0.7974786370232604,
-			-0.7975839288252287,
-			-0.7976891963314008,
-			-0.7977944395385711,
-			-0.7978996584435328,
-			-0.7980048530430809,
-			-0.7981100233340115,
-			-0.7982151693131203,
-			-0.7983202909772045,
-			-0.7984253883230622,
-			-0.7985304613474921,
-			-0.7986355100472929,
-			-0.7987405344192650,
-			-0.7988455344602090,
-			-0.7989505101669265,
-			-0.7990554615362195,
-			-0.7991603885648918,
-			-0.7992652912497464,
-			-0.7993701695875877,
-			-0.7994750235752217,
-			-0.7995798532094537,
-			-0.7996846584870905,
-			-0.7997894394049397,
-			-0.7998941959598094,
-			-0.7999989281485083,
-			-0.8001036359678471,
-			-0.8002083194146346,
-			-0.8003129784856831,
-			-0.8004176131778042,
-			-0.8005222234878107,
-			-0.8006268094125156,
-			-0.8007313709487337,
-			-0.8008359080932789,
-			-0.8009404208429676,
-			-0.8010449091946156,
-			-0.8011493731450412,
-			-0.8012538126910606,
-			-0.8013582278294933,
-			-0.8014626185571586,
-			-0.8015669848708764,
-			-0.8016713267674677,
-			-0.8017756442437541,
-			-0.8018799372965576,
-			-0.8019842059227010,
-			-0.8020884501190092,
-			-0.8021926698823058,
-			-0.8022968652094159,
-			-0.8024010360971666,
-			-0.8025051825423836,
-			-0.8026093045418949,
-			-0.8027134020925292,
-			-0.8028174751911146,
-			-0.8029215238344813,
-			-0.8030255480194598,
-			-0.8031295477428814,
-			-0.8032335230015776,
-			-0.8033374737923824,
-			-0.8034414001121276,
-			-0.8035453019576485,
-			-0.8036491793257796,
-			-0.8037530322133573,
-			-0.8038568606172173,
-			-0.8039606645341971,
-			-0.8040644439611346,
-			-0.8041681988948687,
-			-0.8042719293322382,
-			-0.8043756352700847,
-			-0.8044793167052474,
-			-0.8045829736345690,
-			-0.8046866060548917,
-			-0.8047902139630588,
-			-0.8048937973559140,
-			-0.8049973562303024,
-			-0.8051008905830687,
-			-0.8052044004110596,
-			-0.8053078857111221,
-			-0.8054113464801035,
-			-0.8055147827148519,
-			-0.8056181944122176,
-			-0.8057215815690492,
-			-0.8058249441821982,
-			-0.8059282822485159,
-			-0.8060315957648541,
-			-0.8061348847280656,
-			-0.8062381491350046,
-			-0.8063413889825254,
-			-0.8064446042674824,
-			-0.8065477949867322,
-			-0.8066509611371316,
-			-0.8067541027155372,
-			-0.8068572197188076,
-			-0.8069603121438020,
-			-0.8070633799873793,
-			-0.8071664232464003,
-			-0.8072694419177261,
-			-0.8073724359982184,
-			-0.8074754054847397,
-			-0.8075783503741542,
-			-0.8076812706633251,
-			-0.8077841663491172,
-			-0.8078870374283973,
-			-0.8079898838980305,
-			-0.8080927057548846,
-			-0.8081955029958271,
-			-0.8082982756177268,
-			-0.8084010236174531,
-			-0.8085037469918763,
-			-0.8086064457378668,
-			-0.8087091198522962,
-			-0.8088117693320374,
-			-0.8089143941739630,
-			-0.8090169943749473,
-			-0.8091195699318647,
-			-0.8092221208415906,
-			-0.8093246471010013,
-			-0.8094271487069730,
-			-0.8095296256563846,
-			-0.8096320779461129,
-			-0.8097345055730382,
-			-0.8098369085340398,
-			-0.8099392868259986,
-			-0.8100416404457959,
-			-0.8101439693903141,
-			-0.8102462736564354,
-			-0.8103485532410437,
-			-0.8104508081410241,
-			-0.8105530383532608,
-			-0.8106552438746398,
-			-0.8107574247020485,
-			-0.8108595808323733,
-			-0.8109617122625030,
-			-0.8110638189893268,
-			-0.8111659010097334,
-			-0.8112679583206138,
-			-0.8113699909188588,
-			-0.8114719988013609,
-			-0.8115739819650123,
-			-0.8116759404067062,
-			-0.8117778741233377,
-			-0.8118797831118009,
-			-0.8119816673689912,
-			-0.8120835268918063,
-			-0.8121853616771422,
-			-0.8122871717218972,
-			-0.8123889570229701,
-			-0.8124907175772603,
-			-0.8125924533816676,
-			-0.8126941644330942,
-			-0.8127958507284401,
-			-0.8128975122646088,
-			-0.8129991490385033,
-			-0.8131007610470276,
-			-0.8132023482870864,
-			-0.8133039107555853,
-			-0.8134054484494300,
-			-0.8135069613655280,
-			-0.8136084495007871,
-			-0.8137099128521156,
-			-0.8138113514164224,
-			-0.8139127651906179,
-			-0.8140141541716130,
-			-0.8141155183563191,
-			-0.8142168577416483,
-			-0.8143181723245140,
-			-0.8144194621018293,
-			-0.8145207270705093,
-			-0.8146219672274694,
-			-0.8147231825696251,
-			-0.8148243730938932,
-			-0.8149255387971922,
-			-0.8150266796764392,
-			-0.8151277957285541,
-			-0.8152288869504567,
-			-0.8153299533390671,
-			-0.8154309948913069,
-			-0.8155320116040982,
-			-0.8156330034743638,
-			-0.8157339704990272,
-			-0.8158349126750134,
-			-0.8159358299992467,
-			-0.8160367224686532,
-			-0.8161375900801603,
-			-0.8162384328306943,
-			-0.8163392507171839,
-			-0.8164400437365580,
-			-0.8165408118857462,
-			-0.8166415551616789,
-			-0.8167422735612870,
-			-0.8168429670815037,
-			-0.8169436357192599,
-			-0.8170442794714902,
-			-0.8171448983351285,
-			-0.8172454923071097,
-			-0.8173460613843698,
-			-0.8174466055638452,
-			-0.8175471248424729,
-			-0.8176476192171912,
-			-0.8177480886849390,
-			-0.8178485332426553,
-			-0.8179489528872804,
-			-0.8180493476157562,
-			-0.8181497174250233,
-			-0.8182500623120252,
-			-0.8183503822737050,
-			-0.8184506773070066,
-			-0.8185509474088746,
-			-0.8186511925762554,
-			-0.8187514128060946,
-			-0.8188516080953394,
-			-0.8189517784409380,
-			-0.8190519238398389,
-			-0.8191520442889916,
-			-0.8192521397853461,
-			-0.8193522103258536,
-			-0.8194522559074653,
-			-0.8195522765271337,
-			-0.8196522721818126,
-			-0.8197522428684553,
-			-0.8198521885840164,
-			-0.8199521093254524,
-			-0.8200520050897185,
-			-0.8201518758737719,
-			-0.8202517216745711,
-			-0.8203515424890736,
-			-0.8204513383142393,
-			-0.8205511091470281,
-			-0.8206508549844007,
-			-0.8207505758233189,
-			-0.8208502716607450,
-			-0.8209499424936415,
-			-0.8210495883189731,
-			-0.8211492091337043,
-			-0.8212488049347996,
-			-0.8213483757192261,
-			-0.8214479214839504,
-			-0.8215474422259400,
-			-0.8216469379421636,
-			-0.8217464086295899,
-			-0.8218458542851900,
-			-0.8219452749059331,
-			-0.8220446704887915,
-			-0.8221440410307373,
-			-0.8222433865287436,
-			-0.8223427069797841,
-			-0.8224420023808335,
-			-0.8225412727288665,
-			-0.8226405180208597,
-			-0.8227397382537900,
-			-0.8228389334246345,
-			-0.8229381035303716,
-			-0.8230372485679810,
-			-0.8231363685344417,
-			-0.8232354634267350,
-			-0.8233345332418425,
-			-0.8234335779767455,
-			-0.8235325976284275,
-			-0.8236315921938721,
-			-0.8237305616700635,
-			-0.8238295060539873,
-			-0.8239284253426291,
-			-0.8240273195329763,
-			-0.8241261886220155,
-			-0.8242250326067356,
-			-0.8243238514841258,
-			-0.8244226452511754,
-			-0.8245214139048751,
-			-0.8246201574422163,
-			-0.8247188758601911,
-			-0.8248175691557921,
-			-0.8249162373260140,
-			-0.8250148803678496,
-			-0.8251134982782951,
-			-0.8252120910543462,
-			-0.8253106586929996,
-			-0.8254092011912526,
-			-0.8255077185461036,
-			-0.8256062107545517,
-			-0.8257046778135962,
-			-0.8258031197202383,
-			-0.8259015364714788,
-			-0.8259999280643194,
-			-0.8260982944957640,
-			-0.8261966357628151,
-			-0.8262949518624777,
-			-0.8263932427917567,
-			-0.8264915085476584,
-			-0.8265897491271885,
-			-0.8266879645273553,
-			-0.8267861547451669,
-			-0.8268843197776318,
-			-0.8269824596217598,
-			-0.8270805742745619,
-			-0.8271786637330486,
-			-0.8272767279942326,
-			-0.8273747670551267,
-			-0.8274727809127439,
-			-0.8275707695640986,
-			-0.8276687330062066,
-			-0.8277666712360829,
-			-0.8278645842507445,
-			-0.8279624720472092,
-			-0.8280603346224944,
-			-0.8281581719736193,
-			-0.8282559840976041,
-			-0.8283537709914688,
-			-0.8284515326522346,
-			-0.8285492690769236,
-			-0.8286469802625588,
-			-0.8287446662061634,
-			-0.8288423269047617,
-			-0.8289399623553794,
-			-0.8290375725550416,
-			-0.8291351575007752,
-			-0.8292327171896079,
-			-0.8293302516185675,
-			-0.8294277607846829,
-			-0.8295252446849841,
-			-0.8296227033165012,
-			-0.8297201366762658,
-			-0.8298175447613100,
-			-0.8299149275686659,
-			-0.8300122850953674,
-			-0.8301096173384493,
-			-0.8302069242949458,
-			-0.8303042059618936,
-			-0.8304014623363291,
-			-0.8304986934152890,
-			-0.8305958991958126,
-			-0.8306930796749383,
-			-0.8307902348497056,
-			-0.8308873647171550,
-			-0.8309844692743283,
-			-0.8310815485182669,
-			-0.8311786024460139,
-			-0.8312756310546130,
-			-0.8313726343411085,
-			-0.8314696123025453,
-			-0.8315665649359690,
-			-0.8316634922384272,
-			-0.8317603942069665,
-			-0.8318572708386350,
-			-0.8319541221304826,
-			-0.8320509480795579,
-			-0.8321477486829123,
-			-0.8322445239375970,
-			-0.8323412738406635,
-			-0.8324379983891649,
-			-0.8325346975801549,
-			-0.8326313714106879,
-			-0.8327280198778189,
-			-0.8328246429786040,
-			-0.8329212407100994,
-			-0.8330178130693633,
-			-0.8331143600534536,
-			-0.8332108816594290,
-			-0.8333073778843497,
-			-0.8334038487252762,
-			-0.8335002941792697,
-			-0.8335967142433924,
-			-0.8336931089147069,
-			-0.8337894781902778,
-			-0.8338858220671681,
-			-0.8339821405424439,
-			-0.8340784336131711,
-			-0.8341747012764162,
-			-0.8342709435292470,
-			-0.8343671603687318,
-			-0.8344633517919390,
-			-0.8345595177959392,
-			-0.8346556583778031,
-			-0.8347517735346014,
-			-0.8348478632634064,
-			-0.8349439275612918,
-			-0.8350399664253303,
-			-0.8351359798525970,
-			-0.8352319678401674,
-			-0.8353279303851169,
-			-0.8354238674845222,
-			-0.8355197791354619,
-			-0.8356156653350134,
-			-0.8357115260802563,
-			-0.8358073613682703,
-			-0.8359031711961362,
-			-0.8359989555609352,
-			-0.8360947144597500,
-			-0.8361904478896637,
-			-0.8362861558477596,
-			-0.8363818383311223,
-			-0.8364774953368375,
-			-0.8365731268619909,
-			-0.8366687329036696,
-			-0.8367643134589616,
-			-0.8368598685249550,
-			-0.8369553980987388,
-			-0.8370509021774036,
-			-0.8371463807580397,
-			-0.8372418338377389,
-			-0.8373372614135934,
-			-0.8374326634826964,
-			-0.8375280400421417,
-			-0.8376233910890242,
-			-0.8377187166204390,
-			-0.8378140166334821,
-			-0.8379092911252515,
-			-0.8380045400928438,
-			-0.8380997635333582,
-			-0.8381949614438944,
-			-0.8382901338215514,
-			-0.8383852806634309,
-			-0.8384804019666344,
-			-0.8385754977282646,
-			-0.8386705679454242,
-			-0.8387656126152171,
-			-0.8388606317347489,
-			-0.8389556253011241,
-			-0.8390505933114499,
-			-0.8391455357628334,
-			-0.8392404526523818,
-			-0.8393353439772039,
-			-0.8394302097344100,
-			-0.8395250499211093,
-			-0.8396198645344130,
-			-0.8397146535714336,
-			-0.8398094170292827,
-			-0.8399041549050743,
-			-0.8399988671959225,
-			-0.8400935538989419,
-			-0.8401882150112482,
-			-0.8402828505299580,
-			-0.8403774604521884,
-			-0.8404720447750577,
-			-0.8405666034956845,
-			-0.8406611366111880,
-			-0.8407556441186891,
-			-0.8408501260153086,
-			-0.8409445822981690,
-			-0.8410390129643924,
-			-0.8411334180111024,
-			-0.8412277974354234,
-			-0.8413221512344804,
-			-0.8414164794053990,
-			-0.8415107819453064,
-			-0.8416050588513289,
-			-0.8416993101205956,
-			-0.8417935357502354,
-			-0.8418877357373774,
-			-0.8419819100791526,
-			-0.8420760587726924,
-			-0.8421701818151283,
-			-0.8422642792035936,
-			-0.8423583509352220,
-			-0.8424523970071477,
-			-0.8425464174165055,
-			-0.8426404121604323,
-			-0.8427343812360639,
-			-0.8428283246405386,
-			-0.8429222423709946,
-			-0.8430161344245705,
-			-0.8431100007984063,
-			-0.8432038414896431,
-			-0.8432976564954223,
-			-0.8433914458128857,
-			-0.8434852094391764,
-			-0.8435789473714388,
-			-0.8436726596068166,
-			-0.8437663461424557,
-			-0.8438600069755025,
-			-0.8439536421031033,
-			-0.8440472515224060,
-			-0.8441408352305593,
-			-0.8442343932247123,
-			-0.8443279255020151,
-			-0.8444214320596185,
-			-0.8445149128946743,
-			-0.8446083680043345,
-			-0.8447017973857532,
-			-0.8447952010360832,
-			-0.8448885789524799,
-			-0.8449819311320990,
-			-0.8450752575720964,
-			-0.8451685582696294,
-			-0.8452618332218563,
-			-0.8453550824259352,
-			-0.8454483058790253,
-			-0.8455415035782877,
-			-0.8456346755208830,
-			-0.8457278217039732,
-			-0.8458209421247207,
-			-0.8459140367802889,
-			-0.8460071056678421,
-			-0.8461001487845452,
-			-0.8461931661275641,
-			-0.8462861576940650,
-			-0.8463791234812152,
-			-0.8464720634861834,
-			-0.8465649777061377,
-			-0.8466578661382482,
-			-0.8467507287796857,
-			-0.8468435656276208,
-			-0.8469363766792255,
-			-0.8470291619316733,
-			-0.8471219213821372,
-			-0.8472146550277918,
-			-0.8473073628658122,
-			-0.8474000448933744,
-			-0.8474927011076550,
-			-0.8475853315058323,
-			-0.8476779360850832,
-			-0.8477705148425880,
-			-0.8478630677755261,
-			-0.8479555948810783,
-			-0.8480480961564260,
-			-0.8481405715987512,
-			-0.8482330212052377,
-			-0.8483254449730686,
-			-0.8484178428994286,
-			-0.8485102149815036,
-			-0.8486025612164793,
-			-0.8486948816015427,
-			-0.8487871761338818,
-			-0.8488794448106849,
-			-0.8489716876291414,
-			-0.8490639045864418,
-			-0.8491560956797762,
-			-0.8492482609063370,
-			-0.8493404002633167,
-			-0.8494325137479078,
-			-0.8495246013573053,
-			-0.8496166630887038,
-			-0.8497086989392983,
-			-0.8498007089062860,
-			-0.8498926929868641,
-			-0.8499846511782300,
-			-0.8500765834775830,
-			-0.8501684898821221,
-			-0.8502603703890487,
-			-0.8503522249955627,
-			-0.8504440536988671,
-			-0.8505358564961644,
-			-0.8506276333846575,
-			-0.8507193843615515,
-			-0.8508111094240512,
-			-0.8509028085693624,
-			-0.8509944817946917,
-			-0.8510861290972471,
-			-0.8511777504742361,
-			-0.8512693459228683,
-			-0.8513609154403536,
-			-0.8514524590239023,
-			-0.8515439766707259,
-			-0.8516354683780367,
-			-0.8517269341430477,
-			-0.8518183739629726,
-			-0.8519097878350260,
-			-0.8520011757564233,
-			-0.8520925377243805,
-			-0.8521838737361156,
-			-0.8522751837888446,
-			-0.8523664678797872,
-			-0.8524577260061624,
-			-0.8525489581651905,
-			-0.8526401643540922,
-			-0.8527313445700893,
-			-0.8528224988104044,
-			-0.8529136270722603,
-			-0.8530047293528816,
-			-0.8530958056494933,
-			-0.8531868559593202,
-			-0.8532778802795896,
-			-0.8533688786075284,
-			-0.8534598509403647,
-			-0.8535507972753273,
-			-0.8536417176096460,
-			-0.8537326119405508,
-			-0.8538234802652730,
-			-0.8539143225810450,
-			-0.8540051388850990,
-			-0.8540959291746690,
-			-0.8541866934469895,
-			-0.8542774316992953,
-			-0.8543681439288221,
-			-0.8544588301328074,
-			-0.8545494903084883,
-			-0.8546401244531031,
-			-0.8547307325638908,
-			-0.8548213146380920,
-			-0.8549118706729464,
-			-0.8550024006656963,
-			-0.8550929046135840,
-			-0.8551833825138522,
-			-0.8552738343637448,
-			-0.8553642601605066,
-			-0.8554546599013831,
-			-0.8555450335836207,
-			-0.8556353812044660,
-			-0.8557257027611674,
-			-0.8558159982509730,
-			-0.8559062676711332,
-			-0.8559965110188970,
-			-0.8560867282915161,
-			-0.8561769194862423,
-			-0.8562670846003282,
-			-0.8563572236310271,
-			-0.8564473365755935,
-			-0.8565374234312818,
-			-0.8566274841953483,
-			-0.8567175188650498,
-			-0.8568075274376429,
-			-0.8568975099103864,
-			-0.8569874662805391,
-			-0.8570773965453609,
-			-0.8571673007021122,
-			-0.8572571787480544,
-			-0.8573470306804499,
-			-0.8574368564965612,
-			-0.8575266561936521,
-			-0.8576164297689878,
-			-0.8577061772198327,
-			-0.8577958985434535,
-			-0.8578855937371174,
-			-0.8579752627980913,
-			-0.8580649057236444,
-			-0.8581545225110460,
-			-0.8582441131575658,
-			-0.8583336776604750,
-			-0.8584232160170452,
-			-0.8585127282245489,
-			-0.8586022142802593,
-			-0.8586916741814513,
-			-0.8587811079253985,
-			-0.8588705155093774,
-			-0.8589598969306644,
-			-0.8590492521865367,
-			-0.8591385812742723,
-			-0.8592278841911501,
-			-0.8593171609344503,
-			-0.8594064115014525,
-			-0.8594956358894384,
-			-0.8595848340956905,
-			-0.8596740061174910,
-			-0.8597631519521238,
-			-0.8598522715968734,
-			-0.8599413650490250,
-			-0.8600304323058646,
-			-0.8601194733646795,
-			-0.8602084882227565,
-			-0.8602974768773848,
-			-0.8603864393258536,
-			-0.8604753755654522,
-			-0.8605642855934723,
-			-0.8606531694072053,
-			-0.8607420270039435,
-			-0.8608308583809803,
-			-0.8609196635356099,
-			-0.8610084424651266,
-			-0.8610971951668265,
-			-0.8611859216380058,
-			-0.8612746218759617,
-			-0.8613632958779923,
-			-0.8614519436413967,
-			-0.8615405651634745,
-			-0.8616291604415256,
-			-0.8617177294728517,
-			-0.8618062722547551,
-			-0.8618947887845380,
-			-0.8619832790595040,
-			-0.8620717430769583,
-			-0.8621601808342053,
-			-0.8622485923285516,
-			-0.8623369775573040,
-			-0.8624253365177698,
-			-0.8625136692072575,
-			-0.8626019756230764,
-			-0.8626902557625367,
-			-0.8627785096229490,
-			-0.8628667372016250,
-			-0.8629549384958771,
-			-0.8630431135030184,
-			-0.8631312622203640,
-			-0.8632193846452270,
-			-0.8633074807749241,
-			-0.8633955506067716,
-			-0.8634835941380867,
-			-0.8635716113661874,
-			-0.8636596022883926,
-			-0.8637475669020218,
-			-0.8638355052043957,
-			-0.8639234171928353,
-			-0.8640113028646629,
-			-0.8640991622172008,
-			-0.8641869952477733,
-			-0.8642748019537047,
-			-0.8643625823323200,
-			-0.8644503363809454,
-			-0.8645380640969080,
-			-0.8646257654775350,
-			-0.8647134405201550,
-			-0.8648010892220976,
-			-0.8648887115806924,
-			-0.8649763075932705,
-			-0.8650638772571639,
-			-0.8651514205697043,
-			-0.8652389375282257,
-			-0.8653264281300620,
-			-0.8654138923725478,
-			-0.8655013302530190,
-			-0.8655887417688121,
-			-0.8656761269172643,
-			-0.8657634856957135,
-			-0.8658508181014991,
-			-0.8659381241319608,
-			-0.8660254037844387,
-			-0.8661126570562739,
-			-0.8661998839448094,
-			-0.8662870844473874,
-			-0.8663742585613519,
-			-0.8664614062840472,
-			-0.8665485276128189,
-			-0.8666356225450126,
-			-0.8667226910779764,
-			-0.8668097332090566,
-			-0.8668967489356028,
-			-0.8669837382549638,
-			-0.8670707011644900,
-			-0.8671576376615323,
-			-0.8672445477434426,
-			-0.8673314314075731,
-			-0.8674182886512773,
-			-0.8675051194719099,
-			-0.8675919238668249,
-			-0.8676787018333790,
-			-0.8677654533689286,
-			-0.8678521784708304,
-			-0.8679388771364435,
-			-0.8680255493631264,
-			-0.8681121951482393,
-			-0.8681988144891424,
-			-0.8682854073831970,
-			-0.8683719738277661,
-			-0.8684585138202119,
-			-0.8685450273578987,
-			-0.8686315144381913,
-			-0.8687179750584545,
-			-0.8688044092160552,
-			-0.8688908169083603,
-			-0.8689771981327375,
-			-0.8690635528865556,
-			-0.8691498811671839,
-			-0.8692361829719930,
-			-0.8693224582983536,
-			-0.8694087071436383,
-			-0.8694949295052190,
-			-0.8695811253804697,
-			-0.8696672947667645,
-			-0.8697534376614787,
-			-0.8698395540619882,
-			-0.8699256439656696,
-			-0.8700117073699006,
-			-0.8700977442720594,
-			-0.8701837546695255,
-			-0.8702697385596787,
-			-0.8703556959398997,
-			-0.8704416268075700,
-			-0.8705275311600722,
-			-0.8706134089947893,
-			-0.8706992603091056,
-			-0.8707850851004058,
-			-0.8708708833660753,
-			-0.8709566551035008,
-			-0.8710424003100697,
-			-0.8711281189831693,
-			-0.8712138111201894,
-			-0.8712994767185190,
-			-0.8713851157755490,
-			-0.8714707282886704,
-			-0.8715563142552757,
-			-0.8716418736727573,
-			-0.8717274065385088,
-			-0.8718129128499255,
-			-0.8718983926044021,
-			-0.8719838457993345,
-			-0.8720692724321207,
-			-0.8721546725001573,
-			-0.8722400460008436,
-			-0.8723253929315786,
-			-0.8724107132897631,
-			-0.8724960070727972,
-			-0.8725812742780830,
-			-0.8726665149030236,
-			-0.8727517289450216,
-			-0.8728369164014820,
-			-0.8729220772698097,
-			-0.8730072115474101,
-			-0.8730923192316901,
-			-0.8731774003200575,
-			-0.8732624548099202,
-			-0.8733474826986872,
-			-0.8734324839837688,
-			-0.8735174586625755,
-			-0.8736024067325184,
-			-0.8736873281910111,
-			-0.8737722230354652,
-			-0.8738570912632956,
-			-0.8739419328719168,
-			-0.8740267478587443,
-			-0.8741115362211948,
-			-0.8741962979566854,
-			-0.8742810330626336,
-			-0.8743657415364587,
-			-0.8744504233755802,
-			-0.8745350785774192,
-			-0.8746197071393957,
-			-0.8747043090589327,
-			-0.8747888843334527,
-			-0.8748734329603796,
-			-0.8749579549371376,
-			-0.8750424502611526,
-			-0.8751269189298500,
-			-0.8752113609406569,
-			-0.8752957762910016,
-			-0.8753801649783118,
-			-0.8754645270000178,
-			-0.8755488623535493,
-			-0.8756331710363370,
-			-0.8757174530458133,
-			-0.8758017083794107,
-			-0.8758859370345623,
-			-0.8759701390087026,
-			-0.8760543142992666,
-			-0.8761384629036901,
-			-0.8762225848194098,
-			-0.8763066800438636,
-			-0.8763907485744893,
-			-0.8764747904087262,
-			-0.8765588055440141,
-			-0.8766427939777943,
-			-0.8767267557075077,
-			-0.8768106907305970,
-			-0.8768945990445054,
-			-0.8769784806466767,
-			-0.8770623355345558,
-			-0.8771461637055890,
-			-0.8772299651572214,
-			-0.8773137398869014,
-			-0.8773974878920766,
-			-0.8774812091701960,
-			-0.8775649037187092,
-			-0.8776485715350669,
-			-0.8777322126167203,
-			-0.8778158269611216,
-			-0.8778994145657240,
-			-0.8779829754279808,
-			-0.8780665095453465,
-			-0.8781500169152773,
-			-0.8782334975352284,
-			-0.8783169514026578,
-			-0.8784003785150230,
-			-0.8784837788697822,
-			-0.8785671524643953,
-			-0.8786504992963228,
-			-0.8787338193630256,
-			-0.8788171126619653,
-			-0.8789003791906050,
-			-0.8789836189464083,
-			-0.8790668319268395,
-			-0.8791500181293637,
-			-0.8792331775514471,
-			-0.8793163101905563,
-			-0.8793994160441589,
-			-0.8794824951097235,
-			-0.8795655473847194,
-			-0.8796485728666164,
-			-0.8797315715528859,
-			-0.8798145434409992,
-			-0.8798974885284288,
-			-0.8799804068126484,
-			-0.8800632982911319,
-			-0.8801461629613544,
-			-0.8802290008207916,
-			-0.8803118118669202,
-			-0.8803945960972174,
-			-0.8804773535091621,
-			-0.8805600841002327,
-			-0.8806427878679089,
-			-0.8807254648096722,
-			-0.8808081149230036,
-			-0.8808907382053855,
-			-0.8809733346543012,
-			-0.8810559042672345,
-			-0.8811384470416701,
-			-0.8812209629750937,
-			-0.8813034520649924,
-			-0.8813859143088520,
-			-0.8814683497041618,
-			-0.8815507582484101,
-			-0.8816331399390869,
-			-0.8817154947736824,
-			-0.8817978227496882,
-			-0.8818801238645962,
-			-0.8819623981158993,
-			-0.8820446455010919,
-			-0.8821268660176679,
-			-0.8822090596631228,
-			-0.8822912264349534,
-			-0.8823733663306560,
-			-0.8824554793477289,
-			-0.8825375654836711,
-			-0.8826196247359817,
-			-0.8827016571021609,
-			-0.8827836625797099,
-			-0.8828656411661312,
-			-0.8829475928589268,
-			-0.8830295176556009,
-			-0.8831114155536580,
-			-0.8831932865506028,
-			-0.8832751306439416,
-			-0.8833569478311816,
-			-0.8834387381098301,
-			-0.8835205014773958,
-			-0.8836022379313880,
-			-0.8836839474693169,
-			-0.8837656300886932,
-			-0.8838472857870296,
-			-0.8839289145618375,
-			-0.8840105164106312,
-			-0.8840920913309247,
-			-0.8841736393202331,
-			-0.8842551603760723,
-			-0.8843366544959590,
-			-0.8844181216774107,
-			-0.8844995619179460,
-			-0.8845809752150841,
-			-0.8846623615663446,
-			-0.8847437209692484,
-			-0.8848250534213175,
-			-0.8849063589200742,
-			-0.8849876374630418,
-			-0.8850688890477444,
-			-0.8851501136717072,
-			-0.8852313113324551,
-			-0.8853124820275156,
-			-0.8853936257544159,
-			-0.8854747425106840,
-			-0.8855558322938488,
-			-0.8856368951014408,
-			-0.8857179309309898,
-			-0.8857989397800281,
-			-0.8858799216460879,
-			-0.8859608765267020,
-			-0.8860418044194044,
-			-0.8861227053217302,
-			-0.8862035792312147,
-			-0.8862844261453945,
-			-0.8863652460618071,
-			-0.8864460389779902,
-			-0.8865268048914826,
-			-0.8866075437998248,
-			-0.8866882557005565,
-			-0.8867689405912195,
-			-0.8868495984693558,
-			-0.8869302293325086,
-			-0.8870108331782217,
-			-0.8870914100040395,
-			-0.8871719598075083,
-			-0.8872524825861733,
-			-0.8873329783375823,
-			-0.8874134470592832,
-			-0.8874938887488247,
-			-0.8875743034037564,
-			-0.8876546910216288,
-			-0.8877350515999930,
-			-0.8878153851364011,
-			-0.8878956916284066,
-			-0.8879759710735623,
-			-0.8880562234694230,
-			-0.8881364488135447,
-			-0.8882166471034826,
-			-0.8882968183367945,
-			-0.8883769625110381,
-			-0.8884570796237719,
-			-0.8885371696725551,
-			-0.8886172326549489,
-			-0.8886972685685136,
-			-0.8887772774108114,
-			-0.8888572591794053,
-			-0.8889372138718588,
-			-0.8890171414857363,
-			-0.8890970420186031,
-			-0.8891769154680255,
-			-0.8892567618315700,
-			-0.8893365811068042,
-			-0.8894163732912976,
-			-0.8894961383826187,
-			-0.8895758763783378,
-			-0.8896555872760266,
-			-0.8897352710732562,
-			-0.8898149277675995,
-			-0.8898945573566306,
-			-0.8899741598379232,
-			-0.8900537352090525,
-			-0.8901332834675947,
-			-0.8902128046111265,
-			-0.8902922986372257,
-			-0.8903717655434709,
-			-0.8904512053274407,
-			-0.8905306179867158,
-			-0.8906100035188774,
-			-0.8906893619215066,
-			-0.8907686931921865,
-			-0.8908479973285004,
-			-0.8909272743280324,
-			-0.8910065241883678,
-			-0.8910857469070922,
-			-0.8911649424817932,
-			-0.8912441109100572,
-			-0.8913232521894732,
-			-0.8914023663176304,
-			-0.8914814532921188,
-			-0.8915605131105292,
-			-0.8916395457704536,
-			-0.8917185512694839,
-			-0.8917975296052140,
-			-0.8918764807752382,
-			-0.8919554047771510,
-			-0.8920343016085481,
-			-0.8921131712670272,
-			-0.8921920137501845,
-			-0.8922708290556194,
-			-0.8923496171809306,
-			-0.8924283781237180,
-			-0.8925071118815824,
-			-0.8925858184521256,
-			-0.8926644978329499,
-			-0.8927431500216586,
-			-0.8928217750158558,
-			-0.8929003728131468,
-			-0.8929789434111368,
-			-0.8930574868074329,
-			-0.8931360029996426,
-			-0.8932144919853736,
-			-0.8932929537622353,
-			-0.8933713883278376,
-			-0.8934497956797912,
-			-0.8935281758157075,
-			-0.8936065287331999,
-			-0.8936848544298801,
-			-0.8937631529033632,
-			-0.8938414241512638,
-			-0.8939196681711976,
-			-0.8939978849607811,
-			-0.8940760745176319,
-			-0.8941542368393681,
-			-0.8942323719236087,
-			-0.8943104797679737,
-			-0.8943885603700836,
-			-0.8944666137275598,
-			-0.8945446398380252,
-			-0.8946226386991023,
-			-0.8947006103084157,
-			-0.8947785546635900,
-			-0.8948564717622511,
-			-0.8949343616020250,
-			-0.8950122241805395,
-			-0.8950900594954228,
-			-0.8951678675443036,
-			-0.8952456483248116,
-			-0.8953234018345780,
-			-0.8954011280712338,
-			-0.8954788270324118,
-			-0.8955564987157449,
-			-0.8956341431188670,
-			-0.8957117602394127,
-			-0.8957893500750184,
-			-0.8958669126233200,
-			-0.8959444478819546,
-			-0.8960219558485611,
-			-0.8960994365207778,
-			-0.8961768898962447,
-			-0.8962543159726027,
-			-0.8963317147474930,
-			-0.8964090862185579,
-			-0.8964864303834406,
-			-0.8965637472397849,
-			-0.8966410367852359,
-			-0.8967182990174387,
-			-0.8967955339340407,
-			-0.8968727415326883,
-			-0.8969499218110297,
-			-0.8970270747667146,
-			-0.8971042003973920,
-			-0.8971812987007127,
-			-0.8972583696743284,
-			-0.8973354133158912,
-			-0.8974124296230541,
-			-0.8974894185934715,
-			-0.8975663802247976,
-			-0.8976433145146883,
-			-0.8977202214608002,
-			-0.8977971010607901,
-			-0.8978739533123166,
-			-0.8979507782130387,
-			-0.8980275757606155,
-			-0.8981043459527084,
-			-0.8981810887869786,
-			-0.8982578042610881,
-			-0.8983344923727000,
-			-0.8984111531194789,
-			-0.8984877864990887,
-			-0.8985643925091956,
-			-0.8986409711474660,
-			-0.8987175224115672,
-			-0.8987940462991670,
-			-0.8988705428079344,
-			-0.8989470119355397,
-			-0.8990234536796529,
-			-0.8990998680379455,
-			-0.8991762550080904,
-			-0.8992526145877598,
-			-0.8993289467746285,
-			-0.8994052515663711,
-			-0.8994815289606628,
-			-0.8995577789551803,
-			-0.8996340015476010,
-			-0.8997101967356029,
-			-0.8997863645168650,
-			-0.8998625048890673,
-			-0.8999386178498898,
-			-0.9000147033970146,
-			-0.9000907615281241,
-			-0.9001667922409007,
-			-0.9002427955330289,
-			-0.9003187714021935,
-			-0.9003947198460800,
-			-0.9004706408623749,
-			-0.9005465344487655,
-			-0.9006224006029405,
-			-0.9006982393225879,
-			-0.9007740506053981,
-			-0.9008498344490615,
-			-0.9009255908512700,
-			-0.9010013198097155,
-			-0.9010770213220917,
-			-0.9011526953860918,
-			-0.9012283419994113,
-			-0.9013039611597458,
-			-0.9013795528647914,
-			-0.9014551171122456,
-			-0.9015306538998070,
-			-0.9016061632251740,
-			-0.9016816450860470,
-			-0.9017570994801265,
-			-0.9018325264051138,
-			-0.9019079258587114,
-			-0.9019832978386227,
-			-0.9020586423425516,
-			-0.9021339593682028,
-			-0.9022092489132824,
-			-0.9022845109754964,
-			-0.9023597455525526,
-			-0.9024349526421591,
-			-0.9025101322420254,
-			-0.9025852843498606,
-			-0.9026604089633760,
-			-0.9027355060802829,
-			-0.9028105756982937,
-			-0.9028856178151217,
-			-0.9029606324284815,
-			-0.9030356195360871,
-			-0.9031105791356548,
-			-0.9031855112249014,
-			-0.9032604158015439,
-			-0.9033352928633007,
-			-0.9034101424078911,
-			-0.9034849644330348,
-			-0.9035597589364527,
-			-0.9036345259158667,
-			-0.9037092653689988,
-			-0.9037839772935722,
-			-0.9038586616873118,
-			-0.9039333185479417,
-			-0.9040079478731884,
-			-0.9040825496607785,
-			-0.9041571239084389,
-			-0.9042316706138986,
-			-0.9043061897748865,
-			-0.9043806813891329,
-			-0.9044551454543681,
-			-0.9045295819683239,
-			-0.9046039909287336,
-			-0.9046783723333294,
-			-0.9047527261798465,
-			-0.9048270524660196,
-			-0.9049013511895845,
-			-0.9049756223482777,
-			-0.9050498659398375,
-			-0.9051240819620017,
-			-0.9051982704125094,
-			-0.9052724312891015,
-			-0.9053465645895181,
-			-0.9054206703115015,
-			-0.9054947484527943,
-			-0.9055687990111396,
-			-0.9056428219842819,
-			-0.9057168173699662,
-			-0.9057907851659387,
-			-0.9058647253699460,
-			-0.9059386379797361,
-			-0.9060125229930568,
-			-0.9060863804076580,
-			-0.9061602102212897,
-			-0.9062340124317032,
-			-0.9063077870366499,
-			-0.9063815340338828,
-			-0.9064552534211553,
-			-0.9065289451962218,
-			-0.9066026093568377,
-			-0.9066762459007589,
-			-0.9067498548257421,
-			-0.9068234361295453,
-			-0.9068969898099273,
-			-0.9069705158646468,
-			-0.9070440142914649,
-			-0.9071174850881424,
-			-0.9071909282524409,
-			-0.9072643437821236,
-			-0.9073377316749542,
-			-0.9074110919286968,
-			-0.9074844245411169,
-			-0.9075577295099808,
-			-0.9076310068330552,
-			-0.9077042565081083,
-			-0.9077774785329087,
-			-0.9078506729052257,
-			-0.9079238396228297,
-			-0.9079969786834922,
-			-0.9080700900849852,
-			-0.9081431738250814,
-			-0.9082162299015544,
-			-0.9082892583121793,
-			-0.9083622590547309,
-			-0.9084352321269861,
-			-0.9085081775267219,
-			-0.9085810952517158,
-			-0.9086539852997469,
-			-0.9087268476685949,
-			-0.9087996823560401,
-			-0.9088724893598640,
-			-0.9089452686778486,
-			-0.9090180203077772,
-			-0.9090907442474332,
-			-0.9091634404946022,
-			-0.9092361090470685,
-			-0.9093087499026193,
-			-0.9093813630590417,
-			-0.9094539485141238,
-			-0.9095265062656543,
-			-0.9095990363114234,
-			-0.9096715386492212,
-			-0.9097440132768392,
-			-0.9098164601920701,
-			-0.9098888793927067,
-			-0.9099612708765431,
-			-0.9100336346413742,
-			-0.9101059706849957,
-			-0.9101782790052038,
-			-0.9102505595997962,
-			-0.9103228124665711,
-			-0.9103950376033274,
-			-0.9104672350078648,
-			-0.9105394046779846,
-			-0.9106115466114876,
-			-0.9106836608061770,
-			-0.9107557472598560,
-			-0.9108278059703282,
-			-0.9108998369353987,
-			-0.9109718401528739,
-			-0.9110438156205598,
-			-0.9111157633362641,
-			-0.9111876832977952,
-			-0.9112595755029622,
-			-0.9113314399495751,
-			-0.9114032766354455,
-			-0.9114750855583839,
-			-0.9115468667162037,
-			-0.9116186201067178,
-			-0.9116903457277413,
-			-0.9117620435770886,
-			-0.9118337136525756,
-			-0.9119053559520198,
-			-0.9119769704732381,
-			-0.9120485572140493,
-			-0.9121201161722730,
-			-0.9121916473457290,
-			-0.9122631507322384,
-			-0.9123346263296233,
-			-0.9124060741357062,
-			-0.9124774941483107,
-			-0.9125488863652615,
-			-0.9126202507843834,
-			-0.9126915874035028,
-			-0.9127628962204468,
-			-0.9128341772330427,
-			-0.9129054304391198,
-			-0.9129766558365073,
-			-0.9130478534230354,
-			-0.9131190231965355,
-			-0.9131901651548398,
-			-0.9132612792957807,
-			-0.9133323656171923,
-			-0.9134034241169090,
-			-0.9134744547927666,
-			-0.9135454576426008,
-			-0.9136164326642492,
-			-0.9136873798555498,
-			-0.9137582992143410,
-			-0.9138291907384628,
-			-0.9139000544257559,
-			-0.9139708902740612,
-			-0.9140416982812211,
-			-0.9141124784450788,
-			-0.9141832307634780,
-			-0.9142539552342636,
-			-0.9143246518552813,
-			-0.9143953206243775,
-			-0.9144659615393993,
-			-0.9145365745981949,
-			-0.9146071597986136,
-			-0.9146777171385050,
-			-0.9147482466157197,
-			-0.9148187482281096,
-			-0.9148892219735267,
-			-0.9149596678498250,
-			-0.9150300858548575,
-			-0.9151004759864798,
-			-0.9151708382425476,
-			-0.9152411726209175,
-			-0.9153114791194471,
-			-0.9153817577359946,
-			-0.9154520084684196,
-			-0.9155222313145812,
-			-0.9155924262723412,
-			-0.9156625933395612,
-			-0.9157327325141033,
-			-0.9158028437938313,
-			-0.9158729271766095,
-			-0.9159429826603029,
-			-0.9160130102427777,
-			-0.9160830099219007,
-			-0.9161529816955394,
-			-0.9162229255615622,
-			-0.9162928415178391,
-			-0.9163627295622395,
-			-0.9164325896926352,
-			-0.9165024219068980,
-			-0.9165722262029005,
-			-0.9166420025785161,
-			-0.9167117510316201,
-			-0.9167814715600870,
-			-0.9168511641617935,
-			-0.9169208288346162,
-			-0.9169904655764337,
-			-0.9170600743851239,
-			-0.9171296552585670,
-			-0.9171992081946434,
-			-0.9172687331912341,
-			-0.9173382302462212,
-			-0.9174076993574882,
-			-0.9174771405229186,
-			-0.9175465537403971,
-			-0.9176159390078092,
-			-0.9176852963230415,
-			-0.9177546256839809,
-			-0.9178239270885163,
-			-0.9178932005345357,
-			-0.9179624460199295,
-			-0.9180316635425881,
-			-0.9181008531004031,
-			-0.9181700146912670,
-			-0.9182391483130730,
-			-0.9183082539637146,
-			-0.9183773316410875,
-			-0.9184463813430873,
-			-0.9185154030676101,
-			-0.9185843968125540,
-			-0.9186533625758170,
-			-0.9187223003552984,
-			-0.9187912101488982,
-			-0.9188600919545173,
-			-0.9189289457700577,
-			-0.9189977715934214,
-			-0.9190665694225121,
-			-0.9191353392552345,
-			-0.9192040810894930,
-			-0.9192727949231944,
-			-0.9193414807542452,
-			-0.9194101385805528,
-			-0.9194787684000262,
-			-0.9195473702105749,
-			-0.9196159440101086,
-			-0.9196844897965389,
-			-0.9197530075677777,
-			-0.9198214973217377,
-			-0.9198899590563324,
-			-0.9199583927694772,
-			-0.9200267984590864,
-			-0.9200951761230769,
-			-0.9201635257593656,
-			-0.9202318473658704,
-			-0.9203001409405102,
-			-0.9203684064812044,
-			-0.9204366439858742,
-			-0.9205048534524402,
-			-0.9205730348788250,
-			-0.9206411882629518,
-			-0.9207093136027442,
-			-0.9207774108961272,
-			-0.9208454801410262,
-			-0.9209135213353680,
-			-0.9209815344770796,
-			-0.9210495195640898,
-			-0.9211174765943269,
-			-0.9211854055657211,
-			-0.9212533064762036,
-			-0.9213211793237053,
-			-0.9213890241061592,
-			-0.9214568408214984,
-			-0.9215246294676571,
-			-0.9215923900425705,
-			-0.9216601225441745,
-			-0.9217278269704056,
-			-0.9217955033192012,
-			-0.9218631515885006,
-			-0.9219307717762424,
-			-0.9219983638803668,
-			-0.9220659278988151,
-			-0.9221334638295294,
-			-0.9222009716704517,
-			-0.9222684514195262,
-			-0.9223359030746974,
-			-0.9224033266339101,
-			-0.9224707220951106,
-			-0.9225380894562464,
-			-0.9226054287152647,
-			-0.9226727398701147,
-			-0.9227400229187460,
-			-0.9228072778591088,
-			-0.9228745046891542,
-			-0.9229417034068350,
-			-0.9230088740101037,
-			-0.9230760164969143,
-			-0.9231431308652215,
-			-0.9232102171129809,
-			-0.9232772752381488,
-			-0.9233443052386832,
-			-0.9234113071125410,
-			-0.9234782808576822,
-			-0.9235452264720664,
-			-0.9236121439536542,
-			-0.9236790333004073,
-			-0.9237458945102881,
-			-0.9238127275812599,
-			-0.9238795325112867,
-			-0.9239463092983335,
-			-0.9240130579403669,
-			-0.9240797784353525,
-			-0.9241464707812584,
-			-0.9242131349760532,
-			-0.9242797710177060,
-			-0.9243463789041869,
-			-0.9244129586334672,
-			-0.9244795102035183,
-			-0.9245460336123130,
-			-0.9246125288578255,
-			-0.9246789959380294,
-			-0.9247454348509005,
-			-0.9248118455944151,
-			-0.9248782281665495,
-			-0.9249445825652822,
-			-0.9250109087885920,
-			-0.9250772068344582,
-			-0.9251434767008611,
-			-0.9252097183857821,
-			-0.9252759318872036,
-			-0.9253421172031083,
-			-0.9254082743314804,
-			-0.9254744032703047,
-			-0.9255405040175664,
-			-0.9256065765712520,
-			-0.9256726209293492,
-			-0.9257386370898458,
-			-0.9258046250507311,
-			-0.9258705848099947,
-			-0.9259365163656277,
-			-0.9260024197156211,
-			-0.9260682948579685,
-			-0.9261341417906620,
-			-0.9261999605116964,
-			-0.9262657510190666,
-			-0.9263315133107687,
-			-0.9263972473847992,
-			-0.9264629532391561,
-			-0.9265286308718372,
-			-0.9265942802808427,
-			-0.9266599014641723,
-			-0.9267254944198269,
-			-0.9267910591458088,
-			-0.9268565956401208,
-			-0.9269221039007662,
-			-0.9269875839257499,
-			-0.9270530357130770,
-			-0.9271184592607539,
-			-0.9271838545667873,
-			-0.9272492216291857,
-			-0.9273145604459576,
-			-0.9273798710151124,
-			-0.9274451533346613,
-			-0.9275104074026153,
-			-0.9275756332169863,
-			-0.9276408307757880,
-			-0.9277060000770343,
-			-0.9277711411187397,
-			-0.9278362538989200,
-			-0.9279013384155919,
-			-0.9279663946667727,
-			-0.9280314226504804,
-			-0.9280964223647349,
-			-0.9281613938075555,
-			-0.9282263369769631,
-			-0.9282912518709800,
-			-0.9283561384876282,
-			-0.9284209968249313,
-			-0.9284858268809135,
-			-0.9285506286536003,
-			-0.9286154021410171,
-			-0.9286801473411915,
-			-0.9287448642521512,
-			-0.9288095528719242,
-			-0.9288742131985405,
-			-0.9289388452300301,
-			-0.9290034489644244,
-			-0.9290680243997554,
-			-0.9291325715340562,
-			-0.9291970903653601,
-			-0.9292615808917022,
-			-0.9293260431111182,
-			-0.9293904770216437,
-			-0.9294548826213165,
-			-0.9295192599081745,
-			-0.9295836088802568,
-			-0.9296479295356030,
-			-0.9297122218722542,
-			-0.9297764858882515,
-			-0.9298407215816372,
-			-0.9299049289504553,
-			-0.9299691079927492,
-			-0.9300332587065639,
-			-0.9300973810899460,
-			-0.9301614751409414,
-			-0.9302255408575981,
-			-0.9302895782379645,
-			-0.9303535872800901,
-			-0.9304175679820246,
-			-0.9304815203418191,
-			-0.9305454443575261,
-			-0.9306093400271975,
-			-0.9306732073488877,
-			-0.9307370463206509,
-			-0.9308008569405423,
-			-0.9308646392066180,
-			-0.9309283931169358,
-			-0.9309921186695529,
-			-0.9310558158625283,
-			-0.9311194846939218,
-			-0.9311831251617939,
-			-0.9312467372642058,
-			-0.9313103209992204,
-			-0.9313738763649000,
-			-0.9314374033593090,
-			-0.9315009019805123,
-			-0.9315643722265755,
-			-0.9316278140955652,
-			-0.9316912275855491,
-			-0.9317546126945949,
-			-0.9318179694207724,
-			-0.9318812977621512,
-			-0.9319445977168030,
-			-0.9320078692827984,
-			-0.9320711124582109,
-			-0.9321343272411137,
-			-0.9321975136295813,
-			-0.9322606716216887,
-			-0.9323238012155123,
-			-0.9323869024091286,
-			-0.9324499752006159,
-			-0.9325130195880529,
-			-0.9325760355695186,
-			-0.9326390231430940,
-			-0.9327019823068604,
-			-0.9327649130588994,
-			-0.9328278153972944,
-			-0.9328906893201295,
-			-0.9329535348254892,
-			-0.9330163519114589,
-			-0.9330791405761254,
-			-0.9331419008175759,
-			-0.9332046326338984,
-			-0.9332673360231827,
-			-0.9333300109835181,
-			-0.9333926575129955,
-			-0.9334552756097068,
-			-0.9335178652717444,
-			-0.9335804264972017,
-			-0.9336429592841731,
-			-0.9337054636307536,
-			-0.9337679395350391,
-			-0.9338303869951267,
-			-0.9338928060091144,
-			-0.9339551965751000,
-			-0.9340175586911836,
-			-0.9340798923554655,
-			-0.9341421975660468,
-			-0.9342044743210295,
-			-0.9342667226185166,
-			-0.9343289424566120,
-			-0.9343911338334201,
-			-0.9344532967470471,
-			-0.9345154311955987,
-			-0.9345775371771823,
-			-0.9346396146899063,
-			-0.9347016637318796,
-			-0.9347636843012120,
-			-0.9348256763960145,
-			-0.9348876400143984,
-			-0.9349495751544762,
-			-0.9350114818143613,
-			-0.9350733599921683,
-			-0.9351352096860116,
-			-0.9351970308940076,
-			-0.9352588236142731,
-			-0.9353205878449257,
-			-0.9353823235840839,
-			-0.9354440308298674,
-			-0.9355057095803960,
-			-0.9355673598337912,
-			-0.9356289815881750,
-			-0.9356905748416702,
-			-0.9357521395924004,
-			-0.9358136758384908,
-			-0.9358751835780664,
-			-0.9359366628092536,
-			-0.9359981135301800,
-			-0.9360595357389733,
-			-0.9361209294337626,
-			-0.9361822946126778,
-			-0.9362436312738495,
-			-0.9363049394154093,
-			-0.9363662190354900,
-			-0.9364274701322243,
-			-0.9364886927037467,
-			-0.9365498867481923,
-			-0.9366110522636970,
-			-0.9366721892483976,
-			-0.9367332977004317,
-			-0.9367943776179378,
-			-0.9368554289990554,
-			-0.9369164518419246,
-			-0.9369774461446870,
-			-0.9370384119054840,
-			-0.9370993491224587,
-			-0.9371602577937551,
-			-0.9372211379175175,
-			-0.9372819894918915,
-			-0.9373428125150235,
-			-0.9374036069850604,
-			-0.9374643729001508,
-			-0.9375251102584437,
-			-0.9375858190580882,
-			-0.9376464992972355,
-			-0.9377071509740375,
-			-0.9377677740866459,
-			-0.9378283686332146,
-			-0.9378889346118977,
-			-0.9379494720208500,
-			-0.9380099808582276,
-			-0.9380704611221871,
-			-0.9381309128108866,
-			-0.9381913359224840,
-			-0.9382517304551393,
-			-0.9383120964070127,
-			-0.9383724337762649,
-			-0.9384327425610584,
-			-0.9384930227595559,
-			-0.9385532743699212,
-			-0.9386134973903187,
-			-0.9386736918189144,
-			-0.9387338576538741,
-			-0.9387939948933652,
-			-0.9388541035355564,
-			-0.9389141835786159,
-			-0.9389742350207139,
-			-0.9390342578600210,
-			-0.9390942520947091,
-			-0.9391542177229504,
-			-0.9392141547429183,
-			-0.9392740631527871,
-			-0.9393339429507317,
-			-0.9393937941349283,
-			-0.9394536167035535,
-			-0.9395134106547850,
-			-0.9395731759868016,
-			-0.9396329126977826,
-			-0.9396926207859083,
-			-0.9397523002493600,
-			-0.9398119510863198,
-			-0.9398715732949702,
-			-0.9399311668734954,
-			-0.9399907318200802,
-			-0.9400502681329096,
-			-0.9401097758101705,
-			-0.9401692548500502,
-			-0.9402287052507365,
-			-0.9402881270104189,
-			-0.9403475201272870,
-			-0.9404068845995316,
-			-0.9404662204253443,
-			-0.9405255276029179,
-			-0.9405848061304454,
-			-0.9406440560061213,
-			-0.9407032772281410,
-			-0.9407624697947001,
-			-0.9408216337039955,
-			-0.9408807689542255,
-			-0.9409398755435882,
-			-0.9409989534702832,
-			-0.9410580027325109,
-			-0.9411170233284727,
-			-0.9411760152563706,
-			-0.9412349785144075,
-			-0.9412939131007877,
-			-0.9413528190137156,
-			-0.9414116962513968,
-			-0.9414705448120380,
-			-0.9415293646938463,
-			-0.9415881558950301,
-			-0.9416469184137987,
-			-0.9417056522483617,
-			-0.9417643573969301,
-			-0.9418230338577163,
-			-0.9418816816289317,
-			-0.9419403007087905,
-			-0.9419988910955072,
-			-0.9420574527872967,
-			-0.9421159857823752,
-			-0.9421744900789598,
-			-0.9422329656752680,
-			-0.9422914125695191,
-			-0.9423498307599324,
-			-0.9424082202447281,
-			-0.9424665810221279,
-			-0.9425249130903540,
-			-0.9425832164476295,
-			-0.9426414910921783,
-			-0.9426997370222253,
-			-0.9427579542359964,
-			-0.9428161427317179,
-			-0.9428743025076172,
-			-0.9429324335619231,
-			-0.9429905358928645,
-			-0.9430486094986714,
-			-0.9431066543775753,
-			-0.9431646705278074,
-			-0.9432226579476009,
-			-0.9432806166351893,
-			-0.9433385465888069,
-			-0.9433964478066892,
-			-0.9434543202870724,
-			-0.9435121640281936,
-			-0.9435699790282907,
-			-0.9436277652856029,
-			-0.9436855227983694,
-			-0.9437432515648311,
-			-0.9438009515832294,
-			-0.9438586228518068,
-			-0.9439162653688065,
-			-0.9439738791324724,
-			-0.9440314641410497,
-			-0.9440890203927842,
-			-0.9441465478859224,
-			-0.9442040466187127,
-			-0.9442615165894026,
-			-0.9443189577962420,
-			-0.9443763702374810,
-			-0.9444337539113707,
-			-0.9444911088161633,
-			-0.9445484349501116,
-			-0.9446057323114689,
-			-0.9446630008984904,
-			-0.9447202407094315,
-			-0.9447774517425483,
-			-0.9448346339960981,
-			-0.9448917874683395,
-			-0.9449489121575307,
-			-0.9450060080619324,
-			-0.9450630751798049,
-			-0.9451201135094098,
-			-0.9451771230490098,
-			-0.9452341037968682,
-			-0.9452910557512494,
-			-0.9453479789104182,
-			-0.9454048732726410,
-			-0.9454617388361848,
-			-0.9455185755993167,
-			-0.9455753835603060,
-			-0.9456321627174221,
-			-0.9456889130689353,
-			-0.9457456346131168,
-			-0.9458023273482390,
-			-0.9458589912725747,
-			-0.9459156263843979,
-			-0.9459722326819836,
-			-0.9460288101636072,
-			-0.9460853588275453,
-			-0.9461418786720754,
-			-0.9461983696954759,
-			-0.9462548318960258,
-			-0.9463112652720053,
-			-0.9463676698216952,
-			-0.9464240455433773,
-			-0.9464803924353347,
-			-0.9465367104958505,
-			-0.9465929997232092,
-			-0.9466492601156965,
-			-0.9467054916715980,
-			-0.9467616943892014,
-			-0.9468178682667945,
-			-0.9468740133026660,
-			-0.9469301294951056,
-			-0.9469862168424040,
-			-0.9470422753428530,
-			-0.9470983049947442,
-			-0.9471543057963715,
-			-0.9472102777460287,
-			-0.9472662208420110,
-			-0.9473221350826141,
-			-0.9473780204661351,
-			-0.9474338769908710,
-			-0.9474897046551206,
-			-0.9475455034571837,
-			-0.9476012733953602,
-			-0.9476570144679509,
-			-0.9477127266732587,
-			-0.9477684100095856,
-			-0.9478240644752360,
-			-0.9478796900685145,
-			-0.9479352867877264,
-			-0.9479908546311783,
-			-0.9480463935971775,
-			-0.9481019036840320,
-			-0.9481573848900511,
-			-0.9482128372135445,
-			-0.9482682606528235,
-			-0.9483236552061993,
-			-0.9483790208719846,
-			-0.9484343576484932,
-			-0.9484896655340390,
-			-0.9485449445269375,
-			-0.9486001946255046,
-			-0.9486554158280575,
-			-0.9487106081329137,
-			-0.9487657715383928,
-			-0.9488209060428133,
-			-0.9488760116444965,
-			-0.9489310883417635,
-			-0.9489861361329366,
-			-0.9490411550163389,
-			-0.9490961449902947,
-			-0.9491511060531284,
-			-0.9492060382031662,
-			-0.9492609414387347,
-			-0.9493158157581614,
-			-0.9493706611597745,
-			-0.9494254776419039,
-			-0.9494802652028792,
-			-0.9495350238410317,
-			-0.9495897535546935,
-			-0.9496444543421975,
-			-0.9496991262018770,
-			-0.9497537691320668,
-			-0.9498083831311026,
-			-0.9498629681973204,
-			-0.9499175243290576,
-			-0.9499720515246526,
-			-0.9500265497824438,
-			-0.9500810191007716,
-			-0.9501354594779768,
-			-0.9501898709124007,
-			-0.9502442534023859,
-			-0.9502986069462761,
-			-0.9503529315424153,
-			-0.9504072271891486,
-			-0.9504614938848226,
-			-0.9505157316277837,
-			-0.9505699404163800,
-			-0.9506241202489600,
-			-0.9506782711238735,
-			-0.9507323930394708,
-			-0.9507864859941033,
-			-0.9508405499861233,
-			-0.9508945850138839,
-			-0.9509485910757389,
-			-0.9510025681700438,
-			-0.9510565162951535,
-			-0.9511104354494252,
-			-0.9511643256312163,
-			-0.9512181868388853,
-			-0.9512720190707913,
-			-0.9513258223252946,
-			-0.9513795966007562,
-			-0.9514333418955381,
-			-0.9514870582080033,
-			-0.9515407455365150,
-			-0.9515944038794382,
-			-0.9516480332351384,
-			-0.9517016336019816,
-			-0.9517552049783353,
-			-0.9518087473625678,
-			-0.9518622607530478,
-			-0.9519157451481451,
-			-0.9519692005462310,
-			-0.9520226269456766,
-			-0.9520760243448546,
-			-0.9521293927421387,
-			-0.9521827321359028,
-			-0.9522360425245223,
-			-0.9522893239063732,
-			-0.9523425762798328,
-			-0.9523957996432784,
-			-0.9524489939950890,
-			-0.9525021593336441,
-			-0.9525552956573243,
-			-0.9526084029645108,
-			-0.9526614812535863,
-			-0.9527145305229334,
-			-0.9527675507709363,
-			-0.9528205419959803,
-			-0.9528735041964507,
-			-0.9529264373707343,
-			-0.9529793415172187,
-			-0.9530322166342925,
-			-0.9530850627203449,
-			-0.9531378797737661,
-			-0.9531906677929471,
-			-0.9532434267762799,
-			-0.9532961567221577,
-			-0.9533488576289738,
-			-0.9534015294951231,
-			-0.9534541723190013,
-			-0.9535067860990043,
-			-0.9535593708335298,
-			-0.9536119265209758,
-			-0.9536644531597417,
-			-0.9537169507482268,
-			-0.9537694192848325,
-			-0.9538218587679603,
-			-0.9538742691960128,
-			-0.9539266505673935,
-			-0.9539790028805069,
-			-0.9540313261337580,
-			-0.9540836203255529,
-			-0.9541358854542992,
-			-0.9541881215184042,
-			-0.9542403285162768,
-			-0.9542925064463270,
-			-0.9543446553069650,
-			-0.9543967750966025,
-			-0.9544488658136520,
-			-0.9545009274565263,
-			-0.9545529600236397,
-			-0.9546049635134071,
-			-0.9546569379242446,
-			-0.9547088832545688,
-			-0.9547607995027975,
-			-0.9548126866673490,
-			-0.9548645447466430,
-			-0.9549163737390994,
-			-0.9549681736431401,
-			-0.9550199444571866,
-			-0.9550716861796621,
-			-0.9551233988089903,
-			-0.9551750823435960,
-			-0.9552267367819048,
-			-0.9552783621223437,
-			-0.9553299583633393,
-			-0.9553815255033205,
-			-0.9554330635407161,
-			-0.9554845724739564,
-			-0.9555360523014722,
-			-0.9555875030216955,
-			-0.9556389246330588,
-			-0.9556903171339959,
-			-0.9557416805229413,
-			-0.9557930147983302,
-			-0.9558443199585989,
-			-0.9558955960021848,
-			-0.9559468429275255,
-			-0.9559980607330604,
-			-0.9560492494172292,
-			-0.9561004089784724,
-			-0.9561515394152316,
-			-0.9562026407259495,
-			-0.9562537129090695,
-			-0.9563047559630354,
-			-0.9563557698862929,
-			-0.9564067546772878,
-			-0.9564577103344666,
-			-0.9565086368562780,
-			-0.9565595342411700,
-			-0.9566104024875921,
-			-0.9566612415939951,
-			-0.9567120515588307,
-			-0.9567628323805502,
-			-0.9568135840576073,
-			-0.9568643065884562,
-			-0.9569149999715514,
-			-0.9569656642053488,
-			-0.9570162992883053,
-			-0.9570669052188784,
-			-0.9571174819955262,
-			-0.9571680296167082,
-			-0.9572185480808848,
-			-0.9572690373865173,
-			-0.9573194975320674,
-			-0.9573699285159978,
-			-0.9574203303367727,
-			-0.9574707029928565,
-			-0.9575210464827150,
-			-0.9575713608048145,
-			-0.9576216459576222,
-			-0.9576719019396066,
-			-0.9577221287492367,
-			-0.9577723263849824,
-			-0.9578224948453150,
-			-0.9578726341287056,
-			-0.9579227442336274,
-			-0.9579728251585540,
-			-0.9580228769019592,
-			-0.9580728994623192,
-			-0.9581228928381097,
-			-0.9581728570278079,
-			-0.9582227920298917,
-			-0.9582726978428404,
-			-0.9583225744651332,
-			-0.9583724218952512,
-			-0.9584222401316760,
-			-0.9584720291728898,
-			-0.9585217890173758,
-			-0.9585715196636188,
-			-0.9586212211101034,
-			-0.9586708933553157,
-			-0.9587205363977427,
-			-0.9587701502358723,
-			-0.9588197348681931,
-			-0.9588692902931943,
-			-0.9589188165093669,
-			-0.9589683135152021,
-			-0.9590177813091917,
-			-0.9590672198898295,
-			-0.9591166292556091,
-			-0.9591660094050254,
-			-0.9592153603365743,
-			-0.9592646820487524,
-			-0.9593139745400575,
-			-0.9593632378089879,
-			-0.9594124718540428,
-			-0.9594616766737227,
-			-0.9595108522665288,
-			-0.9595599986309626,
-			-0.9596091157655278,
-			-0.9596582036687276,
-			-0.9597072623390667,
-			-0.9597562917750510,
-			-0.9598052919751872,
-			-0.9598542629379818,
-			-0.9599032046619437,
-			-0.9599521171455819,
-			-0.9600010003874068,
-			-0.9600498543859286,
-			-0.9600986791396596,
-			-0.9601474746471128,
-			-0.9601962409068010,
-			-0.9602449779172394,
-			-0.9602936856769430,
-			-0.9603423641844283,
-			-0.9603910134382122,
-			-0.9604396334368130,
-			-0.9604882241787498,
-			-0.9605367856625419,
-			-0.9605853178867105,
-			-0.9606338208497771,
-			-0.9606822945502641,
-			-0.9607307389866950,
-			-0.9607791541575940,
-			-0.9608275400614866,
-			-0.9608758966968985,
-			-0.9609242240623570,
-			-0.9609725221563896,
-			-0.9610207909775256,
-			-0.9610690305242938,
-			-0.9611172407952255,
-			-0.9611654217888519,
-			-0.9612135735037053,
-			-0.9612616959383187,
-			-0.9613097890912268,
-			-0.9613578529609641,
-			-0.9614058875460664,
-			-0.9614538928450708,
-			-0.9615018688565150,
-			-0.9615498155789372,
-			-0.9615977330108770,
-			-0.9616456211508754,
-			-0.9616934799974726,
-			-0.9617413095492112,
-			-0.9617891098046345,
-			-0.9618368807622862,
-			-0.9618846224207108,
-			-0.9619323347784545,
-			-0.9619800178340638,
-			-0.9620276715860858,
-			-0.9620752960330694,
-			-0.9621228911735636,
-			-0.9621704570061185,
-			-0.9622179935292854,
-			-0.9622655007416159,
-			-0.9623129786416634,
-			-0.9623604272279810,
-			-0.9624078464991238,
-			-0.9624552364536473,
-			-0.9625025970901075,
-			-0.9625499284070623,
-			-0.9625972304030695,
-			-0.9626445030766883,
-			-0.9626917464264788,
-			-0.9627389604510016,
-			-0.9627861451488189,
-			-0.9628333005184930,
-			-0.9628804265585876,
-			-0.9629275232676672,
-			-0.9629745906442972,
-			-0.9630216286870436,
-			-0.9630686373944736,
-			-0.9631156167651557,
-			-0.9631625667976581,
-			-0.9632094874905510,
-			-0.9632563788424054,
-			-0.9633032408517924,
-			-0.9633500735172847,
-			-0.9633968768374558,
-			-0.9634436508108800,
-			-0.9634903954361320,
-			-0.9635371107117884,
-			-0.9635837966364263,
-			-0.9636304532086230,
-			-0.9636770804269574,
-			-0.9637236782900096,
-			-0.9637702467963599,
-			-0.9638167859445894,
-			-0.9638632957332809,
-			-0.9639097761610176,
-			-0.9639562272263832,
-			-0.9640026489279632,
-			-0.9640490412643432,
-			-0.9640954042341101,
-			-0.9641417378358518,
-			-0.9641880420681564,
-			-0.9642343169296140,
-			-0.9642805624188147,
-			-0.9643267785343496,
-			-0.9643729652748113,
-			-0.9644191226387926,
-			-0.9644652506248873,
-			-0.9645113492316905,
-			-0.9645574184577982,
-			-0.9646034583018065,
-			-0.9646494687623132,
-			-0.9646954498379169,
-			-0.9647414015272168,
-			-0.9647873238288129,
-			-0.9648332167413068,
-			-0.9648790802633003,
-			-0.9649249143933961,
-			-0.9649707191301982,
-			-0.9650164944723115,
-			-0.9650622404183412,
-			-0.9651079569668941,
-			-0.9651536441165776,
-			-0.9651993018659998,
-			-0.9652449302137700,
-			-0.9652905291584983,
-			-0.9653360986987958,
-			-0.9653816388332739,
-			-0.9654271495605458,
-			-0.9654726308792252,
-			-0.9655180827879262,
-			-0.9655635052852648,
-			-0.9656088983698570,
-			-0.9656542620403201,
-			-0.9656995962952726,
-			-0.9657449011333329,
-			-0.9657901765531215,
-			-0.9658354225532588,
-			-0.9658806391323670,
-			-0.9659258262890682,
-			-0.9659709840219863,
-			-0.9660161123297457,
-			-0.9660612112109714,
-			-0.9661062806642902,
-			-0.9661513206883285,
-			-0.9661963312817147,
-			-0.9662413124430778,
-			-0.9662862641710471,
-			-0.9663311864642539,
-			-0.9663760793213293,
-			-0.9664209427409063,
-			-0.9664657767216176,
-			-0.9665105812620979,
-			-0.9665553563609826,
-			-0.9666001020169073,
-			-0.9666448182285091,
-			-0.9666895049944262,
-			-0.9667341623132970,
-			-0.9667787901837611,
-			-0.9668233886044594,
-			-0.9668679575740332,
-			-0.9669124970911246,
-			-0.9669570071543772,
-			-0.9670014877624350,
-			-0.9670459389139431,
-			-0.9670903606075473,
-			-0.9671347528418948,
-			-0.9671791156156330,
-			-0.9672234489274103,
-			-0.9672677527758767,
-			-0.9673120271596826,
-			-0.9673562720774791,
-			-0.9674004875279186,
-			-0.9674446735096539,
-			-0.9674888300213395,
-			-0.9675329570616300,
-			-0.9675770546291811,
-			-0.9676211227226500,
-			-0.9676651613406938,
-			-0.9677091704819711,
-			-0.9677531501451416,
-			-0.9677971003288656,
-			-0.9678410210318038,
-			-0.9678849122526186,
-			-0.9679287739899731,
-			-0.9679726062425312,
-			-0.9680164090089575,
-			-0.9680601822879179,
-			-0.9681039260780788,
-			-0.9681476403781077,
-			-0.9681913251866732,
-			-0.9682349805024445,
-			-0.9682786063240915,
-			-0.9683222026502855,
-			-0.9683657694796987,
-			-0.9684093068110037,
-			-0.9684528146428741,
-			-0.9684962929739851,
-			-0.9685397418030119,
-			-0.9685831611286311,
-			-0.9686265509495200,
-			-0.9686699112643569,
-			-0.9687132420718210,
-			-0.9687565433705925,
-			-0.9687998151593519,
-			-0.9688430574367815,
-			-0.9688862702015640,
-			-0.9689294534523829,
-			-0.9689726071879230,
-			-0.9690157314068696,
-			-0.9690588261079089,
-			-0.9691018912897285,
-			-0.9691449269510164,
-			-0.9691879330904618,
-			-0.9692309097067543,
-			-0.9692738567985851,
-			-0.9693167743646460,
-			-0.9693596624036293,
-			-0.9694025209142288,
-			-0.9694453498951390,
-			-0.9694881493450549,
-			-0.9695309192626732,
-			-0.9695736596466911,
-			-0.9696163704958061,
-			-0.9696590518087174,
-			-0.9697017035841251,
-			-0.9697443258207299,
-			-0.9697869185172331,
-			-0.9698294816723376,
-			-0.9698720152847468,
-			-0.9699145193531649,
-			-0.9699569938762973,
-			-0.9699994388528500,
-			-0.9700418542815303,
-			-0.9700842401610460,
-			-0.9701265964901058,
-			-0.9701689232674198,
-			-0.9702112204916982,
-			-0.9702534881616530,
-			-0.9702957262759965,
-			-0.9703379348334419,
-			-0.9703801138327036,
-			-0.9704222632724967,
-			-0.9704643831515374,
-			-0.9705064734685425,
-			-0.9705485342222298,
-			-0.9705905654113182,
-			-0.9706325670345274,
-			-0.9706745390905777,
-			-0.9707164815781908,
-			-0.9707583944960890,
-			-0.9708002778429954,
-			-0.9708421316176343,
-			-0.9708839558187311,
-			-0.9709257504450112,
-			-0.9709675154952015,
-			-0.9710092509680301,
-			-0.9710509568622256,
-			-0.9710926331765174,
-			-0.9711342799096361,
-			-0.9711758970603129,
-			-0.9712174846272802,
-			-0.9712590426092711,
-			-0.9713005710050200,
-			-0.9713420698132614,
-			-0.9713835390327313,
-			-0.9714249786621667,
-			-0.9714663887003052,
-			-0.9715077691458850,
-			-0.9715491199976461,
-			-0.9715904412543287,
-			-0.9716317329146739,
-			-0.9716729949774241,
-			-0.9717142274413222,
-			-0.9717554303051126,
-			-0.9717966035675396,
-			-0.9718377472273493,
-			-0.9718788612832886,
-			-0.9719199457341048,
-			-0.9719610005785463,
-			-0.9720020258153627,
-			-0.9720430214433043,
-			-0.9720839874611222,
-			-0.9721249238675685,
-			-0.9721658306613967,
-			-0.9722067078413599,
-			-0.9722475554062133,
-			-0.9722883733547127,
-			-0.9723291616856148,
-			-0.9723699203976766,
-			-0.9724106494896568,
-			-0.9724513489603153,
-			-0.9724920188084113,
-			-0.9725326590327065,
-			-0.9725732696319630,
-			-0.9726138506049435,
-			-0.9726544019504119,
-			-0.9726949236671329,
-			-0.9727354157538725,
-			-0.9727758782093965,
-			-0.9728163110324730,
-			-0.9728567142218701,
-			-0.9728970877763570,
-			-0.9729374316947040,
-			-0.9729777459756820,
-			-0.9730180306180631,
-			-0.9730582856206200,
-			-0.9730985109821265,
-			-0.9731387067013575,
-			-0.9731788727770883,
-			-0.9732190092080953,
-			-0.9732591159931563,
-			-0.9732991931310490,
-			-0.9733392406205532,
-			-0.9733792584604484,
-			-0.9734192466495161,
-			-0.9734592051865377,
-			-0.9734991340702963,
-			-0.9735390332995757,
-			-0.9735789028731604,
-			-0.9736187427898355,
-			-0.9736585530483879,
-			-0.9736983336476049,
-			-0.9737380845862744,
-			-0.9737778058631856,
-			-0.9738174974771289,
-			-0.9738571594268948,
-			-0.9738967917112751,
-			-0.9739363943290629,
-			-0.9739759672790517,
-			-0.9740155105600357,
-			-0.9740550241708108,
-			-0.9740945081101732,
-			-0.9741339623769198,
-			-0.9741733869698495,
-			-0.9742127818877605,
-			-0.9742521471294533,
-			-0.9742914826937288,
-			-0.9743307885793885,
-			-0.9743700647852352,
-			-0.9744093113100725,
-			-0.9744485281527048,
-			-0.9744877153119377,
-			-0.9745268727865771,
-			-0.9745660005754306,
-			-0.9746050986773059,
-			-0.9746441670910124,
-			-0.9746832058153599,
-			-0.9747222148491591,
-			-0.9747611941912218,
-			-0.9748001438403605,
-			-0.9748390637953889,
-			-0.9748779540551211,
-			-0.9749168146183731,
-			-0.9749556454839604,
-			-0.9749944466507005,
-			-0.9750332181174115,
-			-0.9750719598829122,
-			-0.9751106719460224,
-			-0.9751493543055633,
-			-0.9751880069603560,
-			-0.9752266299092234,
-			-0.9752652231509888,
-			-0.9753037866844770,
-			-0.9753423205085127,
-			-0.9753808246219223,
-			-0.9754192990235332,
-			-0.9754577437121731,
-			-0.9754961586866708,
-			-0.9755345439458566,
-			-0.9755728994885609,
-			-0.9756112253136150,
-			-0.9756495214198520,
-			-0.9756877878061050,
-			-0.9757260244712084,
-			-0.9757642314139976,
-			-0.9758024086333085,
-			-0.9758405561279783,
-			-0.9758786738968450,
-			-0.9759167619387473,
-			-0.9759548202525253,
-			-0.9759928488370193,
-			-0.9760308476910710,
-			-0.9760688168135230,
-			-0.9761067562032189,
-			-0.9761446658590023,
-			-0.9761825457797189,
-			-0.9762203959642147,
-			-0.9762582164113370,
-			-0.9762960071199333,
-			-0.9763337680888527,
-			-0.9763714993169449,
-			-0.9764092008030603,
-			-0.9764468725460508,
-			-0.9764845145447687,
-			-0.9765221267980673,
-			-0.9765597093048007,
-			-0.9765972620638246,
-			-0.9766347850739946,
-			-0.9766722783341678,
-			-0.9767097418432024,
-			-0.9767471755999566,
-			-0.9767845796032907,
-			-0.9768219538520648,
-			-0.9768592983451410,
-			-0.9768966130813810,
-			-0.9769338980596487,
-			-0.9769711532788081,
-			-0.9770083787377244,
-			-0.9770455744352637,
-			-0.9770827403702927,
-			-0.9771198765416795,
-			-0.9771569829482929,
-			-0.9771940595890025,
-			-0.9772311064626787,
-			-0.9772681235681935,
-			-0.9773051109044187,
-			-0.9773420684702279,
-			-0.9773789962644952,
-			-0.9774158942860960,
-			-0.9774527625339058,
-			-0.9774896010068020,
-			-0.9775264097036622,
-			-0.9775631886233651,
-			-0.9775999377647906,
-			-0.9776366571268192,
-			-0.9776733467083322,
-			-0.9777100065082119,
-			-0.9777466365253419,
-			-0.9777832367586062,
-			-0.9778198072068898,
-			-0.9778563478690789,
-			-0.9778928587440603,
-			-0.9779293398307217,
-			-0.9779657911279522,
-			-0.9780022126346412,
-			-0.9780386043496789,
-			-0.9780749662719572,
-			-0.9781112984003684,
-			-0.9781476007338057,
-			-0.9781838732711631,
-			-0.9782201160113360,
-			-0.9782563289532200,
-			-0.9782925120957122,
-			-0.9783286654377106,
-			-0.9783647889781135,
-			-0.9784008827158208,
-			-0.9784369466497330,
-			-0.9784729807787514,
-			-0.9785089851017784,
-			-0.9785449596177174,
-			-0.9785809043254721,
-			-0.9786168192239479,
-			-0.9786527043120510,
-			-0.9786885595886878,
-			-0.9787243850527663,
-			-0.9787601807031954,
-			-0.9787959465388842,
-			-0.9788316825587436,
-			-0.9788673887616850,
-			-0.9789030651466206,
-			-0.9789387117124637,
-			-0.9789743284581285,
-			-0.9790099153825299,
-			-0.9790454724845838,
-			-0.9790809997632073,
-			-0.9791164972173182,
-			-0.9791519648458350,
-			-0.9791874026476773,
-			-0.9792228106217657,
-			-0.9792581887670218,
-			-0.9792935370823673,
-			-0.9793288555667261,
-			-0.9793641442190221,
-			-0.9793994030381801,
-			-0.9794346320231264,
-			-0.9794698311727876,
-			-0.9795050004860918,
-			-0.9795401399619674,
-			-0.9795752495993439,
-			-0.9796103293971523,
-			-0.9796453793543236,
-			-0.9796803994697900,
-			-0.9797153897424851,
-			-0.9797503501713429,
-			-0.9797852807552982,
-			-0.9798201814932872,
-			-0.9798550523842469,
-			-0.9798898934271147,
-			-0.9799247046208295,
-			-0.9799594859643310,
-			-0.9799942374565596,
-			-0.9800289590964565,
-			-0.9800636508829642,
-			-0.9800983128150261,
-			-0.9801329448915860,
-			-0.9801675471115889,
-			-0.9802021194739814,
-			-0.9802366619777096,
-			-0.9802711746217218,
-			-0.9803056574049664,
-			-0.9803401103263932,
-			-0.9803745333849524,
-			-0.9804089265795957,
-			-0.9804432899092753,
-			-0.9804776233729443,
-			-0.9805119269695572,
-			-0.9805462006980687,
-			-0.9805804445574351,
-			-0.9806146585466130,
-			-0.9806488426645602,
-			-0.9806829969102356,
-			-0.9807171212825985,
-			-0.9807512157806098,
-			-0.9807852804032304,
-			-0.9808193151494230,
-			-0.9808533200181510,
-			-0.9808872950083780,
-			-0.9809212401190697,
-			-0.9809551553491915,
-			-0.9809890406977106,
-			-0.9810228961635949,
-			-0.9810567217458128,
-			-0.9810905174433341,
-			-0.9811242832551292,
-			-0.9811580191801698,
-			-0.9811917252174278,
-			-0.9812254013658768,
-			-0.9812590476244910,
-			-0.9812926639922451,
-			-0.9813262504681155,
-			-0.9813598070510789,
-			-0.9813933337401133,
-			-0.9814268305341971,
-			-0.9814602974323101,
-			-0.9814937344334329,
-			-0.9815271415365469,
-			-0.9815605187406342,
-			-0.9815938660446786,
-			-0.9816271834476640,
-			-0.9816604709485752,
-			-0.9816937285463988,
-			-0.9817269562401214,
-			-0.9817601540287307,
-			-0.9817933219112156,
-			-0.9818264598865659,
-			-0.9818595679537717,
-			-0.9818926461118250,
-			-0.9819256943597178,
-			-0.9819587126964436,
-			-0.9819917011209967,
-			-0.9820246596323717,
-			-0.9820575882295652,
-			-0.9820904869115739,
-			-0.9821233556773955,
-			-0.9821561945260292,
-			-0.9821890034564743,
-			-0.9822217824677313,
-			-0.9822545315588019,
-			-0.9822872507286888,
-			-0.9823199399763947,
-			-0.9823525993009241,
-			-0.9823852287012823,
-			-0.9824178281764752,
-			-0.9824503977255097,
-			-0.9824829373473938,
-			-0.9825154470411364,
-			-0.9825479268057468,
-			-0.9825803766402358,
-			-0.9826127965436152,
-			-0.9826451865148971,
-			-0.9826775465530949,
-			-0.9827098766572230,
-			-0.9827421768262965,
-			-0.9827744470593314,
-			-0.9828066873553447,
-			-0.9828388977133544,
-			-0.9828710781323792,
-			-0.9829032286114390,
-			-0.9829353491495542,
-			-0.9829674397457466,
-			-0.9829995003990386,
-			-0.9830315311084533,
-			-0.9830635318730155,
-			-0.9830955026917499,
-			-0.9831274435636830,
-			-0.9831593544878416,
-			-0.9831912354632536,
-			-0.9832230864889481,
-			-0.9832549075639545,
-			-0.9832866986873039,
-			-0.9833184598580276,
-			-0.9833501910751581,
-			-0.9833818923377290,
-			-0.9834135636447744,
-			-0.9834452049953296,
-			-0.9834768163884309,
-			-0.9835083978231154,
-			-0.9835399492984207,
-			-0.9835714708133858,
-			-0.9836029623670508,
-			-0.9836344239584562,
-			-0.9836658555866437,
-			-0.9836972572506558,
-			-0.9837286289495359,
-			-0.9837599706823283,
-			-0.9837912824480786,
-			-0.9838225642458327,
-			-0.9838538160746376,
-			-0.9838850379335417,
-			-0.9839162298215935,
-			-0.9839473917378432,
-			-0.9839785236813413,
-			-0.9840096256511397,
-			-0.9840406976462909,
-			-0.9840717396658482,
-			-0.9841027517088662,
-			-0.9841337337744003,
-			-0.9841646858615064,
-			-0.9841956079692419,
-			-0.9842265000966649,
-			-0.9842573622428342,
-			-0.9842881944068098,
-			-0.9843189965876524,
-			-0.9843497687844239,
-			-0.9843805109961868,
-			-0.9844112232220045,
-			-0.9844419054609416,
-			-0.9844725577120637,
-			-0.9845031799744367,
-			-0.9845337722471278,
-			-0.9845643345292053,
-			-0.9845948668197383,
-			-0.9846253691177964,
-			-0.9846558414224508,
-			-0.9846862837327730,
-			-0.9847166960478357,
-			-0.9847470783667126,
-			-0.9847774306884783,
-			-0.9848077530122080,
-			-0.9848380453369781,
-			-0.9848683076618658,
-			-0.9848985399859495,
-			-0.9849287423083078,
-			-0.9849589146280211,
-			-0.9849890569441702,
-			-0.9850191692558368,
-			-0.9850492515621038,
-			-0.9850793038620547,
-			-0.9851093261547739,
-			-0.9851393184393472,
-			-0.9851692807148608,
-			-0.9851992129804021,
-			-0.9852291152350594,
-			-0.9852589874779214,
-			-0.9852888297080785,
-			-0.9853186419246217,
-			-0.9853484241266426,
-			-0.9853781763132341,
-			-0.9854078984834902,
-			-0.9854375906365049,
-			-0.9854672527713741,
-			-0.9854968848871943,
-			-0.9855264869830629,
-			-0.9855560590580777,
-			-0.9855856011113383,
-			-0.9856151131419448,
-			-0.9856445951489980,
-			-0.9856740471315999,
-			-0.9857034690888536,
-			-0.9857328610198623,
-			-0.9857622229237313,
-			-0.9857915547995658,
-			-0.9858208566464725,
-			-0.9858501284635585,
-			-0.9858793702499324,
-			-0.9859085820047033,
-			-0.9859377637269815,
-			-0.9859669154158781,
-			-0.9859960370705050,
-			-0.9860251286899749,
-			-0.9860541902734020,
-			-0.9860832218199007,
-			-0.9861122233285871,
-			-0.9861411947985772,
-			-0.9861701362289889,
-			-0.9861990476189403,
-			-0.9862279289675508,
-			-0.9862567802739409,
-			-0.9862856015372313,
-			-0.9863143927565444,
-			-0.9863431539310030,
-			-0.9863718850597309,
-			-0.9864005861418533,
-			-0.9864292571764955,
-			-0.9864578981627842,
-			-0.9864865090998470,
-			-0.9865150899868125,
-			-0.9865436408228098,
-			-0.9865721616069694,
-			-0.9866006523384225,
-			-0.9866291130163011,
-			-0.9866575436397382,
-			-0.9866859442078680,
-			-0.9867143147198253,
-			-0.9867426551747457,
-			-0.9867709655717660,
-			-0.9867992459100240,
-			-0.9868274961886578,
-			-0.9868557164068074,
-			-0.9868839065636127,
-			-0.9869120666582151,
-			-0.9869401966897569,
-			-0.9869682966573811,
-			-0.9869963665602319,
-			-0.9870244063974540,
-			-0.9870524161681935,
-			-0.9870803958715970,
-			-0.9871083455068123,
-			-0.9871362650729879,
-			-0.9871641545692733,
-			-0.9871920139948192,
-			-0.9872198433487767,
-			-0.9872476426302980,
-			-0.9872754118385365,
-			-0.9873031509726463,
-			-0.9873308600317822,
-			-0.9873585390151003,
-			-0.9873861879217576,
-			-0.9874138067509114,
-			-0.9874413955017207,
-			-0.9874689541733453,
-			-0.9874964827649454,
-			-0.9875239812756823,
-			-0.9875514497047189,
-			-0.9875788880512179,
-			-0.9876062963143437,
-			-0.9876336744932616,
-			-0.9876610225871373,
-			-0.9876883405951377,
-			-0.9877156285164308,
-			-0.9877428863501856,
-			-0.9877701140955714,
-			-0.9877973117517588,
-			-0.9878244793179196,
-			-0.9878516167932261,
-			-0.9878787241768515,
-			-0.9879058014679702,
-			-0.9879328486657575,
-			-0.9879598657693891,
-			-0.9879868527780424,
-			-0.9880138096908951,
-			-0.9880407365071262,
-			-0.9880676332259155,
-			-0.9880944998464434,
-			-0.9881213363678918,
-			-0.9881481427894430,
-			-0.9881749191102804,
-			-0.9882016653295888,
-			-0.9882283814465529,
-			-0.9882550674603591,
-			-0.9882817233701944,
-			-0.9883083491752470,
-			-0.9883349448747060,
-			-0.9883615104677607,
-			-0.9883880459536023,
-			-0.9884145513314223,
-			-0.9884410266004132,
-			-0.9884674717597689,
-			-0.9884938868086836,
-			-0.9885202717463525,
-			-0.9885466265719720,
-			-0.9885729512847395,
-			-0.9885992458838527,
-			-0.9886255103685109,
-			-0.9886517447379140,
-			-0.9886779489912628,
-			-0.9887041231277591,
-			-0.9887302671466056,
-			-0.9887563810470059,
-			-0.9887824648281645,
-			-0.9888085184892867,
-			-0.9888345420295792,
-			-0.9888605354482491,
-			-0.9888864987445046,
-			-0.9889124319175547,
-			-0.9889383349666097,
-			-0.9889642078908802,
-			-0.9889900506895783,
-			-0.9890158633619168,
-			-0.9890416459071093,
-			-0.9890673983243705,
-			-0.9890931206129158,
-			-0.9891188127719618,
-			-0.9891444748007259,
-			-0.9891701066984261,
-			-0.9891957084642820,
-			-0.9892212800975134,
-			-0.9892468215973415,
-			-0.9892723329629883,
-			-0.9892978141936767,
-			-0.9893232652886302,
-			-0.9893486862470738,
-			-0.9893740770682333,
-			-0.9893994377513349,
-			-0.9894247682956060,
-			-0.9894500687002754,
-			-0.9894753389645721,
-			-0.9895005790877264,
-			-0.9895257890689695,
-			-0.9895509689075334,
-			-0.9895761186026509,
-			-0.9896012381535563,
-			-0.9896263275594841,
-			-0.9896513868196702,
-			-0.9896764159333511,
-			-0.9897014148997646,
-			-0.9897263837181489,
-			-0.9897513223877435,
-			-0.9897762309077890,
-			-0.9898011092775263,
-			-0.9898259574961975,
-			-0.9898507755630460,
-			-0.9898755634773158,
-			-0.9899003212382514,
-			-0.9899250488450991,
-			-0.9899497462971054,
-			-0.9899744135935180,
-			-0.9899990507335856,
-			-0.9900236577165575,
-			-0.9900482345416844,
-			-0.9900727812082175,
-			-0.9900972977154090,
-			-0.9901217840625122,
-			-0.9901462402487813,
-			-0.9901706662734709,
-			-0.9901950621358373,
-			-0.9902194278351374,
-			-0.9902437633706288,
-			-0.9902680687415703,
-			-0.9902923439472213,
-			-0.9903165889868428,
-			-0.9903408038596959,
-			-0.9903649885650428,
-			-0.9903891431021473,
-			-0.9904132674702733,
-			-0.9904373616686858,
-			-0.9904614256966512,
-			-0.9904854595534363,
-			-0.9905094632383088,
-			-0.9905334367505378,
-			-0.9905573800893930,
-			-0.9905812932541447,
-			-0.9906051762440649,
-			-0.9906290290584258,
-			-0.9906528516965009,
-			-0.9906766441575646,
-			-0.9907004064408920,
-			-0.9907241385457592,
-			-0.9907478404714437,
-			-0.9907715122172229,
-			-0.9907951537823761,
-			-0.9908187651661831,
-			-0.9908423463679246,
-			-0.9908658973868821,
-			-0.9908894182223387,
-			-0.9909129088735774,
-			-0.9909363693398828,
-			-0.9909597996205404,
-			-0.9909831997148363,
-			-0.9910065696220577,
-			-0.9910299093414927,
-			-0.9910532188724306,
-			-0.9910764982141609,
-			-0.9910997473659747,
-			-0.9911229663271639,
-			-0.9911461550970212,
-			-0.9911693136748400,
-			-0.9911924420599150,
-			-0.9912155402515418,
-			-0.9912386082490164,
-			-0.9912616460516366,
-			-0.9912846536587002,
-			-0.9913076310695066,
-			-0.9913305782833558,
-			-0.9913534952995486,
-			-0.9913763821173874,
-			-0.9913992387361745,
-			-0.9914220651552140,
-			-0.9914448613738104,
-			-0.9914676273912693,
-			-0.9914903632068973,
-			-0.9915130688200017,
-			-0.9915357442298909,
-			-0.9915583894358742,
-			-0.9915810044372616,
-			-0.9916035892333646,
-			-0.9916261438234949,
-			-0.9916486682069655,
-			-0.9916711623830904,
-			-0.9916936263511843,
-			-0.9917160601105628,
-			-0.9917384636605427,
-			-0.9917608370004416,
-			-0.9917831801295777,
-			-0.9918054930472705,
-			-0.9918277757528405,
-			-0.9918500282456089,
-			-0.9918722505248975,
-			-0.9918944425900296,
-			-0.9919166044403294,
-			-0.9919387360751214,
-			-0.9919608374937317,
-			-0.9919829086954870,
-			-0.9920049496797150,
-			-0.9920269604457442,
-			-0.9920489409929042,
-			-0.9920708913205255,
-			-0.9920928114279391,
-			-0.9921147013144778,
-			-0.9921365609794744,
-			-0.9921583904222632,
-			-0.9921801896421792,
-			-0.9922019586385583,
-			-0.9922236974107375,
-			-0.9922454059580544,
-			-0.9922670842798479,
-			-0.9922887323754577,
-			-0.9923103502442241,
-			-0.9923319378854887,
-			-0.9923534952985940,
-			-0.9923750224828833,
-			-0.9923965194377007,
-			-0.9924179861623914,
-			-0.9924394226563017,
-			-0.9924608289187784,
-			-0.9924822049491694,
-			-0.9925035507468237,
-			-0.9925248663110910,
-			-0.9925461516413220,
-			-0.9925674067368683,
-			-0.9925886315970825,
-			-0.9926098262213179,
-			-0.9926309906089289,
-			-0.9926521247592711,
-			-0.9926732286717003,
-			-0.9926943023455738,
-			-0.9927153457802497,
-			-0.9927363589750871,
-			-0.9927573419294455,
-			-0.9927782946426861,
-			-0.9927992171141706,
-			-0.9928201093432615,
-			-0.9928409713293225,
-			-0.9928618030717181,
-			-0.9928826045698136,
-			-0.9929033758229756,
-			-0.9929241168305711,
-			-0.9929448275919687,
-			-0.9929655081065369,
-			-0.9929861583736462,
-			-0.9930067783926676,
-			-0.9930273681629725,
-			-0.9930479276839344,
-			-0.9930684569549263,
-			-0.9930889559753232,
-			-0.9931094247445008,
-			-0.9931298632618353,
-			-0.9931502715267043,
-			-0.9931706495384861,
-			-0.9931909972965598,
-			-0.9932113148003058,
-			-0.9932316020491050,
-			-0.9932518590423394,
-			-0.9932720857793921,
-			-0.9932922822596469,
-			-0.9933124484824886,
-			-0.9933325844473028,
-			-0.9933526901534763,
-			-0.9933727656003964,
-			-0.9933928107874518,
-			-0.9934128257140318,
-			-0.9934328103795267,
-			-0.9934527647833276,
-			-0.9934726889248269,
-			-0.9934925828034176,
-			-0.9935124464184935,
-			-0.9935322797694497,
-			-0.9935520828556822,
-			-0.9935718556765875,
-			-0.9935915982315633,
-			-0.9936113105200084,
-			-0.9936309925413221,
-			-0.9936506442949050,
-			-0.9936702657801585,
-			-0.9936898569964848,
-			-0.9937094179432870,
-			-0.9937289486199696,
-			-0.9937484490259374,
-			-0.9937679191605964,
-			-0.9937873590233535,
-			-0.9938067686136166,
-			-0.9938261479307944,
-			-0.9938454969742966,
-			-0.9938648157435338,
-			-0.9938841042379174,
-			-0.9939033624568601,
-			-0.9939225903997749,
-			-0.9939417880660764,
-			-0.9939609554551797,
-			-0.9939800925665009,
-			-0.9939991993994570,
-			-0.9940182759534661,
-			-0.9940373222279471,
-			-0.9940563382223196,
-			-0.9940753239360045,
-			-0.9940942793684237,
-			-0.9941132045189992,
-			-0.9941320993871550,
-			-0.9941509639723154,
-			-0.9941697982739057,
-			-0.9941886022913521,
-			-0.9942073760240820,
-			-0.9942261194715235,
-			-0.9942448326331054,
-			-0.9942635155082579,
-			-0.9942821680964117,
-			-0.9943007903969989,
-			-0.9943193824094519,
-			-0.9943379441332046,
-			-0.9943564755676915,
-			-0.9943749767123480,
-			-0.9943934475666106,
-			-0.9944118881299168,
-			-0.9944302984017045,
-			-0.9944486783814133,
-			-0.9944670280684830,
-			-0.9944853474623547,
-			-0.9945036365624706,
-			-0.9945218953682733,
-			-0.9945401238792068,
-			-0.9945583220947156,
-			-0.9945764900142455,
-			-0.9945946276372433,
-			-0.9946127349631561,
-			-0.9946308119914323,
-			-0.9946488587215215,
-			-0.9946668751528741,
-			-0.9946848612849409,
-			-0.9947028171171741,
-			-0.9947207426490270,
-			-0.9947386378799533,
-			-0.9947565028094080,
-			-0.9947743374368467,
-			-0.9947921417617265,
-			-0.9948099157835046,
-			-0.9948276595016400,
-			-0.9948453729155919,
-			-0.9948630560248208,
-			-0.9948807088287882,
-			-0.9948983313269562,
-			-0.9949159235187879,
-			-0.9949334854037475,
-			-0.9949510169813002,
-			-0.9949685182509117,
-			-0.9949859892120491,
-			-0.9950034298641800,
-			-0.9950208402067732,
-			-0.9950382202392984,
-			-0.9950555699612263,
-			-0.9950728893720281,
-			-0.9950901784711764,
-			-0.9951074372581447,
-			-0.9951246657324068,
-			-0.9951418638934384,
-			-0.9951590317407152,
-			-0.9951761692737144,
-			-0.9951932764919141,
-			-0.9952103533947932,
-			-0.9952273999818312,
-			-0.9952444162525090,
-			-0.9952614022063083,
-			-0.9952783578427117,
-			-0.9952952831612025,
-			-0.9953121781612655,
-			-0.9953290428423857,
-			-0.9953458772040493,
-			-0.9953626812457439,
-			-0.9953794549669573,
-			-0.9953961983671789,
-			-0.9954129114458981,
-			-0.9954295942026062,
-			-0.9954462466367950,
-			-0.9954628687479571,
-			-0.9954794605355862,
-			-0.9954960219991770,
-			-0.9955125531382248,
-			-0.9955290539522262,
-			-0.9955455244406785,
-			-0.9955619646030800,
-			-0.9955783744389298,
-			-0.9955947539477282,
-			-0.9956111031289762,
-			-0.9956274219821758,
-			-0.9956437105068296,
-			-0.9956599687024419,
-			-0.9956761965685171,
-			-0.9956923941045609,
-			-0.9957085613100801,
-			-0.9957246981845821,
-			-0.9957408047275753,
-			-0.9957568809385691,
-			-0.9957729268170739,
-			-0.9957889423626007,
-			-0.9958049275746617,
-			-0.9958208824527700,
-			-0.9958368069964398,
-			-0.9958527012051857,
-			-0.9958685650785236,
-			-0.9958843986159703,
-			-0.9959002018170436,
-			-0.9959159746812619,
-			-0.9959317172081448,
-			-0.9959474293972129,
-			-0.9959631112479873,
-			-0.9959787627599906,
-			-0.9959943839327459,
-			-0.9960099747657771,
-			-0.9960255352586098,
-			-0.9960410654107695,
-			-0.9960565652217835,
-			-0.9960720346911794,
-			-0.9960874738184862,
-			-0.9961028826032333,
-			-0.9961182610449516,
-			-0.9961336091431725,
-			-0.9961489268974284,
-			-0.9961642143072529,
-			-0.9961794713721802,
-			-0.9961946980917455,
-			-0.9962098944654851,
-			-0.9962250604929360,
-			-0.9962401961736361,
-			-0.9962553015071246,
-			-0.9962703764929413,
-			-0.9962854211306268,
-			-0.9963004354197230,
-			-0.9963154193597725,
-			-0.9963303729503188,
-			-0.9963452961909064,
-			-0.9963601890810808,
-			-0.9963750516203883,
-			-0.9963898838083760,
-			-0.9964046856445924,
-			-0.9964194571285864,
-			-0.9964341982599080,
-			-0.9964489090381082,
-			-0.9964635894627391,
-			-0.9964782395333531,
-			-0.9964928592495044,
-			-0.9965074486107472,
-			-0.9965220076166375,
-			-0.9965365362667313,
-			-0.9965510345605866,
-			-0.9965655024977614,
-			-0.9965799400778150,
-			-0.9965943473003078,
-			-0.9966087241648008,
-			-0.9966230706708561,
-			-0.9966373868180366,
-			-0.9966516726059063,
-			-0.9966659280340299,
-			-0.9966801531019732,
-			-0.9966943478093030,
-			-0.9967085121555869,
-			-0.9967226461403933,
-			-0.9967367497632916,
-			-0.9967508230238523,
-			-0.9967648659216468,
-			-0.9967788784562471,
-			-0.9967928606272266,
-			-0.9968068124341593,
-			-0.9968207338766200,
-			-0.9968346249541847,
-			-0.9968484856664305,
-			-0.9968623160129351,
-			-0.9968761159932769,
-			-0.9968898856070357,
-			-0.9969036248537924,
-			-0.9969173337331280,
-			-0.9969310122446250,
-			-0.9969446603878670,
-			-0.9969582781624380,
-			-0.9969718655679232,
-			-0.9969854226039088,
-			-0.9969989492699818,
-			-0.9970124455657300,
-			-0.9970259114907425,
-			-0.9970393470446091,
-			-0.9970527522269202,
-			-0.9970661270372679,
-			-0.9970794714752444,
-			-0.9970927855404437,
-			-0.9971060692324597,
-			-0.9971193225508880,
-			-0.9971325454953248,
-			-0.9971457380653674,
-			-0.9971589002606139,
-			-0.9971720320806634,
-			-0.9971851335251158,
-			-0.9971982045935720,
-			-0.9972112452856338,
-			-0.9972242556009041,
-			-0.9972372355389866,
-			-0.9972501850994856,
-			-0.9972631042820070,
-			-0.9972759930861571,
-			-0.9972888515115433,
-			-0.9973016795577738,
-			-0.9973144772244581,
-			-0.9973272445112061,
-			-0.9973399814176290,
-			-0.9973526879433389,
-			-0.9973653640879485,
-			-0.9973780098510718,
-			-0.9973906252323237,
-			-0.9974032102313197,
-			-0.9974157648476766,
-			-0.9974282890810118,
-			-0.9974407829309440,
-			-0.9974532463970924,
-			-0.9974656794790776,
-			-0.9974780821765206,
-			-0.9974904544890437,
-			-0.9975027964162702,
-			-0.9975151079578237,
-			-0.9975273891133296,
-			-0.9975396398824136,
-			-0.9975518602647026,
-			-0.9975640502598242,
-			-0.9975762098674072,
-			-0.9975883390870813,
-			-0.9976004379184767,
-			-0.9976125063612252,
-			-0.9976245444149590,
-			-0.9976365520793113,
-			-0.9976485293539166,
-			-0.9976604762384097,
-			-0.9976723927324269,
-			-0.9976842788356053,
-			-0.9976961345475827,
-			-0.9977079598679978,
-			-0.9977197547964906,
-			-0.9977315193327018,
-			-0.9977432534762729,
-			-0.9977549572268465,
-			-0.9977666305840662,
-			-0.9977782735475763,
-			-0.9977898861170221,
-			-0.9978014682920500,
-			-0.9978130200723071,
-			-0.9978245414574415,
-			-0.9978360324471022,
-			-0.9978474930409392,
-			-0.9978589232386035,
-			-0.9978703230397468,
-			-0.9978816924440218,
-			-0.9978930314510823,
-			-0.9979043400605829,
-			-0.9979156182721790,
-			-0.9979268660855271,
-			-0.9979380835002845,
-			-0.9979492705161096,
-			-0.9979604271326616,
-			-0.9979715533496006,
-			-0.9979826491665879,
-			-0.9979937145832851,
-			-0.9980047495993555,
-			-0.9980157542144626,
-			-0.9980267284282716,
-			-0.9980376722404478,
-			-0.9980485856506582,
-			-0.9980594686585701,
-			-0.9980703212638520,
-			-0.9980811434661735,
-			-0.9980919352652047,
-			-0.9981026966606170,
-			-0.9981134276520827,
-			-0.9981241282392745,
-			-0.9981347984218669,
-			-0.9981454381995347,
-			-0.9981560475719539,
-			-0.9981666265388009,
-			-0.9981771750997539,
-			-0.9981876932544914,
-			-0.9981981810026931,
-			-0.9982086383440394,
-			-0.9982190652782118,
-			-0.9982294618048926,
-			-0.9982398279237652,
-			-0.9982501636345139,
-			-0.9982604689368237,
-			-0.9982707438303807,
-			-0.9982809883148720,
-			-0.9982912023899855,
-			-0.9983013860554101,
-			-0.9983115393108355,
-			-0.9983216621559523,
-			-0.9983317545904524,
-			-0.9983418166140283,
-			-0.9983518482263735,
-			-0.9983618494271822,
-			-0.9983718202161501,
-			-0.9983817605929732,
-			-0.9983916705573488,
-			-0.9984015501089750,
-			-0.9984113992475510,
-			-0.9984212179727765,
-			-0.9984310062843526,
-			-0.9984407641819810,
-			-0.9984504916653646,
-			-0.9984601887342069,
-			-0.9984698553882129,
-			-0.9984794916270877,
-			-0.9984890974505379,
-			-0.9984986728582710,
-			-0.9985082178499952,
-			-0.9985177324254199,
-			-0.9985272165842549,
-			-0.9985366703262117,
-			-0.9985460936510022,
-			-0.9985554865583393,
-			-0.9985648490479369,
-			-0.9985741811195098,
-			-0.9985834827727736,
-			-0.9985927540074452,
-			-0.9986019948232421,
-			-0.9986112052198827,
-			-0.9986203851970865,
-			-0.9986295347545738,
-			-0.9986386538920661,
-			-0.9986477426092855,
-			-0.9986568009059550,
-			-0.9986658287817988,
-			-0.9986748262365419,
-			-0.9986837932699102,
-			-0.9986927298816305,
-			-0.9987016360714307,
-			-0.9987105118390394,
-			-0.9987193571841861,
-			-0.9987281721066018,
-			-0.9987369566060175,
-			-0.9987457106821658,
-			-0.9987544343347802,
-			-0.9987631275635946,
-			-0.9987717903683445,
-			-0.9987804227487659,
-			-0.9987890247045957,
-			-0.9987975962355722,
-			-0.9988061373414340,
-			-0.9988146480219211,
-			-0.9988231282767742,
-			-0.9988315781057349,
-			-0.9988399975085459,
-			-0.9988483864849507,
-			-0.9988567450346937,
-			-0.9988650731575204,
-			-0.9988733708531771,
-			-0.9988816381214108,
-			-0.9988898749619700,
-			-0.9988980813746036,
-			-0.9989062573590616,
-			-0.9989144029150951,
-			-0.9989225180424558,
-			-0.9989306027408966,
-			-0.9989386570101713,
-			-0.9989466808500344,
-			-0.9989546742602414,
-			-0.9989626372405491,
-			-0.9989705697907147,
-			-0.9989784719104966,
-			-0.9989863435996542,
-			-0.9989941848579477,
-			-0.9990019956851380,
-			-0.9990097760809875,
-			-0.9990175260452590,
-			-0.9990252455777164,
-			-0.9990329346781247,
-			-0.9990405933462496,
-			-0.9990482215818578,
-			-0.9990558193847169,
-			-0.9990633867545955,
-			-0.9990709236912629,
-			-0.9990784301944898,
-			-0.9990859062640476,
-			-0.9990933518997082,
-			-0.9991007671012450,
-			-0.9991081518684322,
-			-0.9991155062010446,
-			-0.9991228300988584,
-			-0.9991301235616503,
-			-0.9991373865891984,
-			-0.9991446191812813,
-			-0.9991518213376787,
-			-0.9991589930581710,
-			-0.9991661343425401,
-			-0.9991732451905683,
-			-0.9991803256020390,
-			-0.9991873755767364,
-			-0.9991943951144460,
-			-0.9992013842149537,
-			-0.9992083428780468,
-			-0.9992152711035133,
-			-0.9992221688911420,
-			-0.9992290362407229,
-			-0.9992358731520469,
-			-0.9992426796249055,
-			-0.9992494556590916,
-			-0.9992562012543986,
-			-0.9992629164106211,
-			-0.9992696011275547,
-			-0.9992762554049955,
-			-0.9992828792427410,
-			-0.9992894726405892,
-			-0.9992960355983396,
-			-0.9993025681157919,
-			-0.9993090701927474,
-			-0.9993155418290078,
-			-0.9993219830243762,
-			-0.9993283937786562,
-			-0.9993347740916527,
-			-0.9993411239631712,
-			-0.9993474433930183,
-			-0.9993537323810014,
-			-0.9993599909269292,
-			-0.9993662190306108,
-			-0.9993724166918566,
-			-0.9993785839104777,
-			-0.9993847206862865,
-			-0.9993908270190958,
-			-0.9993969029087195,
-			-0.9994029483549729,
-			-0.9994089633576716,
-			-0.9994149479166323,
-			-0.9994209020316729,
-			-0.9994268257026119,
-			-0.9994327189292689,
-			-0.9994385817114643,
-			-0.9994444140490196,
-			-0.9994502159417572,
-			-0.9994559873895001,
-			-0.9994617283920728,
-			-0.9994674389493003,
-			-0.9994731190610087,
-			-0.9994787687270248,
-			-0.9994843879471766,
-			-0.9994899767212930,
-			-0.9994955350492036,
-			-0.9995010629307393,
-			-0.9995065603657316,
-			-0.9995120273540129,
-			-0.9995174638954168,
-			-0.9995228699897778,
-			-0.9995282456369311,
-			-0.9995335908367129,
-			-0.9995389055889605,
-			-0.9995441898935119,
-			-0.9995494437502062,
-			-0.9995546671588832,
-			-0.9995598601193840,
-			-0.9995650226315503,
-			-0.9995701546952250,
-			-0.9995752563102516,
-			-0.9995803274764746,
-			-0.9995853681937397,
-			-0.9995903784618934,
-			-0.9995953582807828,
-			-0.9996003076502565,
-			-0.9996052265701637,
-			-0.9996101150403544,
-			-0.9996149730606797,
-			-0.9996198006309919,
-			-0.9996245977511435,
-			-0.9996293644209887,
-			-0.9996341006403823,
-			-0.9996388064091798,
-			-0.9996434817272380,
-			-0.9996481265944145,
-			-0.9996527410105678,
-			-0.9996573249755573,
-			-0.9996618784892434,
-			-0.9996664015514872,
-			-0.9996708941621513,
-			-0.9996753563210985,
-			-0.9996797880281931,
-			-0.9996841892832999,
-			-0.9996885600862851,
-			-0.9996929004370153,
-			-0.9996972103353584,
-			-0.9997014897811831,
-			-0.9997057387743591,
-			-0.9997099573147569,
-			-0.9997141454022479,
-			-0.9997183030367047,
-			-0.9997224302180006,
-			-0.9997265269460098,
-			-0.9997305932206075,
-			-0.9997346290416700,
-			-0.9997386344090743,
-			-0.9997426093226983,
-			-0.9997465537824209,
-			-0.9997504677881222,
-			-0.9997543513396826,
-			-0.9997582044369840,
-			-0.9997620270799091,
-			-0.9997658192683413,
-			-0.9997695810021652,
-			-0.9997733122812661,
-			-0.9997770131055305,
-			-0.9997806834748455,
-			-0.9997843233890994,
-			-0.9997879328481812,
-			-0.9997915118519811,
-			-0.9997950604003900,
-			-0.9997985784932998,
-			-0.9998020661306034,
-			-0.9998055233121944,
-			-0.9998089500379678,
-			-0.9998123463078188,
-			-0.9998157121216442,
-			-0.9998190474793415,
-			-0.9998223523808090,
-			-0.9998256268259461,
-			-0.9998288708146529,
-			-0.9998320843468308,
-			-0.9998352674223817,
-			-0.9998384200412088,
-			-0.9998415422032160,
-			-0.9998446339083082,
-			-0.9998476951563913,
-			-0.9998507259473718,
-			-0.9998537262811577,
-			-0.9998566961576574,
-			-0.9998596355767804,
-			-0.9998625445384374,
-			-0.9998654230425394,
-			-0.9998682710889991,
-			-0.9998710886777297,
-			-0.9998738758086451,
-			-0.9998766324816606,
-			-0.9998793586966922,
-			-0.9998820544536569,
-			-0.9998847197524724,
-			-0.9998873545930577,
-			-0.9998899589753325,
-			-0.9998925328992173,
-			-0.9998950763646340,
-			-0.9998975893715050,
-			-0.9999000719197535,
-			-0.9999025240093042,
-			-0.9999049456400823,
-			-0.9999073368120139,
-			-0.9999096975250265,
-			-0.9999120277790478,
-			-0.9999143275740070,
-			-0.9999165969098340,
-			-0.9999188357864599,
-			-0.9999210442038161,
-			-0.9999232221618356,
-			-0.9999253696604520,
-			-0.9999274866995999,
-			-0.9999295732792147,
-			-0.9999316293992330,
-			-0.9999336550595920,
-			-0.9999356502602300,
-			-0.9999376150010865,
-			-0.9999395492821014,
-			-0.9999414531032158,
-			-0.9999433264643717,
-			-0.9999451693655121,
-			-0.9999469818065809,
-			-0.9999487637875227,
-			-0.9999505153082835,
-			-0.9999522363688097,
-			-0.9999539269690489,
-			-0.9999555871089498,
-			-0.9999572167884616,
-			-0.9999588160075348,
-			-0.9999603847661206,
-			-0.9999619230641713,
-			-0.9999634309016400,
-			-0.9999649082784806,
-			-0.9999663551946484,
-			-0.9999677716500991,
-			-0.9999691576447897,
-			-0.9999705131786779,
-			-0.9999718382517224,
-			-0.9999731328638829,
-			-0.9999743970151198,
-			-0.9999756307053947,
-			-0.9999768339346702,
-			-0.9999780067029094,
-			-0.9999791490100767,
-			-0.9999802608561371,
-			-0.9999813422410571,
-			-0.9999823931648033,
-			-0.9999834136273441,
-			-0.9999844036286483,
-			-0.9999853631686855,
-			-0.9999862922474267,
-			-0.9999871908648437,
-			-0.9999880590209089,
-			-0.9999888967155960,
-			-0.9999897039488793,
-			-0.9999904807207345,
-			-0.9999912270311376,
-			-0.9999919428800662,
-			-0.9999926282674982,
-			-0.9999932831934130,
-			-0.9999939076577904,
-			-0.9999945016606114,
-			-0.9999950652018582,
-			-0.9999955982815133,
-			-0.9999961008995606,
-			-0.9999965730559848,
-			-0.9999970147507714,
-			-0.9999974259839071,
-			-0.9999978067553793,
-			-0.9999981570651764,
-			-0.9999984769132877,
-			-0.9999987662997035,
-			-0.9999990252244151,
-			-0.9999992536874144,
-			-0.9999994516886945,
-			-0.9999996192282494,
-			-0.9999997563060741,
-			-0.9999998629221643,
-			-0.9999999390765166,
-			-0.9999999847691291,
-			-1.0000000000000000,
-			-0.9999999847691291,
-			-0.9999999390765166,
-			-0.9999998629221643,
-			-0.9999997563060741,
-			-0.9999996192282494,
-			-0.9999994516886945,
-			-0.9999992536874144,
-			-0.9999990252244151,
-			-0.9999987662997035,
-			-0.9999984769132877,
-			-0.9999981570651764,
-			-0.9999978067553793,
-			-0.9999974259839071,
-			-0.9999970147507714,
-			-0.9999965730559848,
-			-0.9999961008995606,
-			-0.9999955982815133,
-			-0.9999950652018582,
-			-0.9999945016606114,
-			-0.9999939076577904,
-			-0.9999932831934130,
-			-0.9999926282674982,
-			-0.9999919428800662,
-			-0.9999912270311376,
-			-0.9999904807207345,
-			-0.9999897039488793,
-			-0.9999888967155960,
-			-0.9999880590209089,
-			-0.9999871908648437,
-			-0.9999862922474267,
-			-0.9999853631686856,
-			-0.9999844036286483,
-			-0.9999834136273441,
-			-0.9999823931648033,
-			-0.9999813422410571,
-			-0.9999802608561371,
-			-0.9999791490100767,
-			-0.9999780067029094,
-			-0.9999768339346702,
-			-0.9999756307053947,
-			-0.9999743970151198,
-			-0.9999731328638829,
-			-0.9999718382517224,
-			-0.9999705131786779,
-			-0.9999691576447897,
-			-0.9999677716500991,
-			-0.9999663551946484,
-			-0.9999649082784806,
-			-0.9999634309016400,
-			-0.9999619230641713,
-			-0.9999603847661206,
-			-0.9999588160075348,
-			-0.9999572167884616,
-			-0.9999555871089498,
-			-0.9999539269690489,
-			-0.9999522363688097,
-			-0.9999505153082835,
-			-0.9999487637875227,
-			-0.9999469818065809,
-			-0.9999451693655121,
-			-0.9999433264643717,
-			-0.9999414531032158,
-			-0.9999395492821014,
-			-0.9999376150010865,
-			-0.9999356502602300,
-			-0.9999336550595920,
-			-0.9999316293992330,
-			-0.9999295732792147,
-			-0.9999274866995999,
-			-0.9999253696604520,
-			-0.9999232221618356,
-			-0.9999210442038161,
-			-0.9999188357864599,
-			-0.9999165969098341,
-			-0.9999143275740070,
-			-0.9999120277790479,
-			-0.9999096975250265,
-			-0.9999073368120139,
-			-0.9999049456400823,
-			-0.9999025240093042,
-			-0.9999000719197535,
-			-0.9998975893715050,
-			-0.9998950763646340,
-			-0.9998925328992174,
-			-0.9998899589753325,
-			-0.9998873545930577,
-			-0.9998847197524724,
-			-0.9998820544536569,
-			-0.9998793586966922,
-			-0.9998766324816606,
-			-0.9998738758086451,
-			-0.9998710886777297,
-			-0.9998682710889991,
-			-0.9998654230425394,
-			-0.9998625445384374,
-			-0.9998596355767804,
-			-0.9998566961576574,
-			-0.9998537262811577,
-			-0.9998507259473718,
-			-0.9998476951563913,
-			-0.9998446339083082,
-			-0.9998415422032161,
-			-0.9998384200412088,
-			-0.9998352674223817,
-			-0.9998320843468308,
-			-0.9998288708146529,
-			-0.9998256268259461,
-			-0.9998223523808091,
-			-0.9998190474793415,
-			-0.9998157121216442,
-			-0.9998123463078188,
-			-0.9998089500379678,
-			-0.9998055233121944,
-			-0.9998020661306034,
-			-0.9997985784932998,
-			-0.9997950604003900,
-			-0.9997915118519811,
-			-0.9997879328481812,
-			-0.9997843233890994,
-			-0.9997806834748455,
-			-0.9997770131055305,
-			-0.9997733122812661,
-			-0.9997695810021652,
-			-0.9997658192683413,
-			-0.9997620270799091,
-			-0.9997582044369840,
-			-0.9997543513396826,
-			-0.9997504677881222,
-			-0.9997465537824209,
-			-0.9997426093226983,
-			-0.9997386344090743,
-			-0.9997346290416701,
-			-0.9997305932206075,
-			-0.9997265269460097,
-			-0.9997224302180006,
-			-0.9997183030367047,
-			-0.9997141454022479,
-			-0.9997099573147569,
-			-0.9997057387743591,
-			-0.9997014897811831,
-			-0.9996972103353584,
-			-0.9996929004370153,
-			-0.9996885600862851,
-			-0.9996841892832999,
-			-0.9996797880281931,
-			-0.9996753563210985,
-			-0.9996708941621513,
-			-0.9996664015514872,
-			-0.9996618784892434,
-			-0.9996573249755573,
-			-0.9996527410105678,
-			-0.9996481265944145,
-			-0.9996434817272380,
-			-0.9996388064091798,
-			-0.9996341006403823,
-			-0.9996293644209887,
-			-0.9996245977511435,
-			-0.9996198006309919,
-			-0.9996149730606797,
-			-0.9996101150403544,
-			-0.9996052265701637,
-			-0.9996003076502565,
-			-0.9995953582807828,
-			-0.9995903784618934,
-			-0.9995853681937397,
-			-0.9995803274764746,
-			-0.9995752563102516,
-			-0.9995701546952250,
-			-0.9995650226315504,
-			-0.9995598601193840,
-			-0.9995546671588833,
-			-0.9995494437502062,
-			-0.9995441898935119,
-			-0.9995389055889605,
-			-0.9995335908367129,
-			-0.9995282456369311,
-			-0.9995228699897779,
-			-0.9995174638954168,
-			-0.9995120273540129,
-			-0.9995065603657316,
-			-0.9995010629307393,
-			-0.9994955350492036,
-			-0.9994899767212930,
-			-0.9994843879471766,
-			-0.9994787687270248,
-			-0.9994731190610087,
-			-0.9994674389493003,
-			-0.9994617283920728,
-			-0.9994559873895001,
-			-0.9994502159417572,
-			-0.9994444140490196,
-			-0.9994385817114643,
-			-0.9994327189292689,
-			-0.9994268257026119,
-			-0.9994209020316729,
-			-0.9994149479166323,
-			-0.9994089633576716,
-			-0.9994029483549729,
-			-0.9993969029087195,
-			-0.9993908270190958,
-			-0.9993847206862865,
-			-0.9993785839104777,
-			-0.9993724166918566,
-			-0.9993662190306108,
-			-0.9993599909269292,
-			-0.9993537323810014,
-			-0.9993474433930183,
-			-0.9993411239631712,
-			-0.9993347740916527,
-			-0.9993283937786562,
-			-0.9993219830243762,
-			-0.9993155418290078,
-			-0.9993090701927474,
-			-0.9993025681157919,
-			-0.9992960355983396,
-			-0.9992894726405892,
-			-0.9992828792427410,
-			-0.9992762554049955,
-			-0.9992696011275547,
-			-0.9992629164106213,
-			-0.9992562012543986,
-			-0.9992494556590916,
-			-0.9992426796249055,
-			-0.9992358731520469,
-			-0.9992290362407229,
-			-0.9992221688911420,
-			-0.9992152711035133,
-			-0.9992083428780468,
-			-0.9992013842149537,
-			-0.9991943951144460,
-			-0.9991873755767364,
-			-0.9991803256020390,
-			-0.9991732451905683,
-			-0.9991661343425401,
-			-0.9991589930581710,
-			-0.9991518213376787,
-			-0.9991446191812813,
-			-0.9991373865891984,
-			-0.9991301235616503,
-			-0.9991228300988584,
-			-0.9991155062010446,
-			-0.9991081518684322,
-			-0.9991007671012450,
-			-0.9990933518997082,
-			-0.9990859062640476,
-			-0.9990784301944899,
-			-0.9990709236912629,
-			-0.9990633867545954,
-			-0.9990558193847169,
-			-0.9990482215818578,
-			-0.9990405933462496,
-			-0.9990329346781247,
-			-0.9990252455777164,
-			-0.9990175260452590,
-			-0.9990097760809875,
-			-0.9990019956851380,
-			-0.9989941848579477,
-			-0.9989863435996542,
-			-0.9989784719104967,
-			-0.9989705697907146,
-			-0.9989626372405491,
-			-0.9989546742602414,
-			-0.9989466808500344,
-			-0.9989386570101713,
-			-0.9989306027408966,
-			-0.9989225180424558,
-			-0.9989144029150950,
-			-0.9989062573590616,
-			-0.9988980813746036,
-			-0.9988898749619700,
-			-0.9988816381214108,
-			-0.9988733708531770,
-			-0.9988650731575204,
-			-0.9988567450346937,
-			-0.9988483864849507,
-			-0.9988399975085459,
-			-0.9988315781057349,
-			-0.9988231282767742,
-			-0.9988146480219211,
-			-0.9988061373414341,
-			-0.9987975962355722,
-			-0.9987890247045957,
-			-0.9987804227487659,
-			-0.9987717903683445,
-			-0.9987631275635946,
-			-0.9987544343347802,
-			-0.9987457106821659,
-			-0.9987369566060175,
-			-0.9987281721066018,
-			-0.9987193571841863,
-			-0.9987105118390394,
-			-0.9987016360714307,
-			-0.9986927298816305,
-			-0.9986837932699102,
-			-0.9986748262365419,
-			-0.9986658287817988,
-			-0.9986568009059550,
-			-0.9986477426092855,
-			-0.9986386538920661,
-			-0.9986295347545738,
-			-0.9986203851970865,
-			-0.9986112052198827,
-			-0.9986019948232421,
-			-0.9985927540074452,
-			-0.9985834827727736,
-			-0.9985741811195097,
-			-0.9985648490479369,
-			-0.9985554865583394,
-			-0.9985460936510022,
-			-0.9985366703262117,
-			-0.9985272165842550,
-			-0.9985177324254199,
-			-0.9985082178499952,
-			-0.9984986728582710,
-			-0.9984890974505379,
-			-0.9984794916270877,
-			-0.9984698553882129,
-			-0.9984601887342071,
-			-0.9984504916653646,
-			-0.9984407641819810,
-			-0.9984310062843526,
-			-0.9984212179727765,
-			-0.9984113992475510,
-			-0.9984015501089750,
-			-0.9983916705573489,
-			-0.9983817605929732,
-			-0.9983718202161501,
-			-0.9983618494271823,
-			-0.9983518482263735,
-			-0.9983418166140284,
-			-0.9983317545904524,
-			-0.9983216621559523,
-			-0.9983115393108354,
-			-0.9983013860554101,
-			-0.9982912023899856,
-			-0.9982809883148720,
-			-0.9982707438303807,
-			-0.9982604689368237,
-			-0.9982501636345139,
-			-0.9982398279237652,
-			-0.9982294618048927,
-			-0.9982190652782118,
-			-0.9982086383440394,
-			-0.9981981810026931,
-			-0.9981876932544915,
-			-0.9981771750997540,
-			-0.9981666265388009,
-			-0.9981560475719539,
-			-0.9981454381995347,
-			-0.9981347984218669,
-			-0.9981241282392747,
-			-0.9981134276520827,
-			-0.9981026966606170,
-			-0.9980919352652048,
-			-0.9980811434661735,
-			-0.9980703212638521,
-			-0.9980594686585701,
-			-0.9980485856506582,
-			-0.9980376722404479,
-			-0.9980267284282716,
-			-0.9980157542144626,
-			-0.9980047495993555,
-			-0.9979937145832851,
-			-0.9979826491665879,
-			-0.9979715533496006,
-			-0.9979604271326616,
-			-0.9979492705161096,
-			-0.9979380835002845,
-			-0.9979268660855271,
-			-0.9979156182721790,
-			-0.9979043400605828,
-			-0.9978930314510823,
-			-0.9978816924440219,
-			-0.9978703230397468,
-			-0.9978589232386035,
-			-0.9978474930409393,
-			-0.9978360324471022,
-			-0.9978245414574415,
-			-0.9978130200723071,
-			-0.9978014682920500,
-			-0.9977898861170221,
-			-0.9977782735475763,
-			-0.9977666305840662,
-			-0.9977549572268465,
-			-0.9977432534762729,
-			-0.9977315193327018,
-			-0.9977197547964907,
-			-0.9977079598679978,
-			-0.9976961345475827,
-			-0.9976842788356053,
-			-0.9976723927324269,
-			-0.9976604762384097,
-			-0.9976485293539165,
-			-0.9976365520793113,
-			-0.9976245444149590,
-			-0.9976125063612252,
-			-0.9976004379184769,
-			-0.9975883390870813,
-			-0.9975762098674072,
-			-0.9975640502598243,
-			-0.9975518602647026,
-			-0.9975396398824136,
-			-0.9975273891133296,
-			-0.9975151079578237,
-			-0.9975027964162702,
-			-0.9974904544890437,
-			-0.9974780821765207,
-			-0.9974656794790776,
-			-0.9974532463970924,
-			-0.9974407829309440,
-			-0.9974282890810118,
-			-0.9974157648476765,
-			-0.9974032102313197,
-			-0.9973906252323237,
-			-0.9973780098510718,
-			-0.9973653640879485,
-			-0.9973526879433389,
-			-0.9973399814176290,
-			-0.9973272445112061,
-			-0.9973144772244581,
-			-0.9973016795577739,
-			-0.9972888515115433,
-			-0.9972759930861571,
-			-0.9972631042820070,
-			-0.9972501850994856,
-			-0.9972372355389866,
-			-0.9972242556009041,
-			-0.9972112452856339,
-			-0.9971982045935720,
-			-0.9971851335251157,
-			-0.9971720320806634,
-			-0.9971589002606139,
-			-0.9971457380653674,
-			-0.9971325454953248,
-			-0.9971193225508880,
-			-0.9971060692324597,
-			-0.9970927855404437,
-			-0.9970794714752446,
-			-0.9970661270372679,
-			-0.9970527522269202,
-			-0.9970393470446091,
-			-0.9970259114907425,
-			-0.9970124455657300,
-			-0.9969989492699817,
-			-0.9969854226039088,
-			-0.9969718655679232,
-			-0.9969582781624380,
-			-0.9969446603878670,
-			-0.9969310122446251,
-			-0.9969173337331280,
-			-0.9969036248537924,
-			-0.9968898856070358,
-			-0.9968761159932769,
-			-0.9968623160129350,
-			-0.9968484856664306,
-			-0.9968346249541847,
-			-0.9968207338766200,
-			-0.9968068124341593,
-			-0.9967928606272266,
-			-0.9967788784562471,
-			-0.9967648659216468,
-			-0.9967508230238524,
-			-0.9967367497632916,
-			-0.9967226461403933,
-			-0.9967085121555869,
-			-0.9966943478093031,
-			-0.9966801531019733,
-			-0.9966659280340299,
-			-0.9966516726059063,
-			-0.9966373868180366,
-			-0.9966230706708561,
-			-0.9966087241648008,
-			-0.9965943473003078,
-			-0.9965799400778151,
-			-0.9965655024977614,
-			-0.9965510345605866,
-			-0.9965365362667313,
-			-0.9965220076166373,
-			-0.9965074486107472,
-			-0.9964928592495044,
-			-0.9964782395333531,
-			-0.9964635894627391,
-			-0.9964489090381082,
-			-0.9964341982599080,
-			-0.9964194571285864,
-			-0.9964046856445925,
-			-0.9963898838083760,
-			-0.9963750516203883,
-			-0.9963601890810808,
-			-0.9963452961909064,
-			-0.9963303729503188,
-			-0.9963154193597725,
-			-0.9963004354197230,
-			-0.9962854211306268,
-			-0.9962703764929413,
-			-0.9962553015071247,
-			-0.9962401961736362,
-			-0.9962250604929360,
-			-0.9962098944654850,
-			-0.9961946980917455,
-			-0.9961794713721802,
-			-0.9961642143072529,
-			-0.9961489268974285,
-			-0.9961336091431725,
-			-0.9961182610449516,
-			-0.9961028826032333,
-			-0.9960874738184862,
-			-0.9960720346911794,
-			-0.9960565652217835,
-			-0.9960410654107696,
-			-0.9960255352586098,
-			-0.9960099747657771,
-			-0.9959943839327459,
-			-0.9959787627599905,
-			-0.9959631112479873,
-			-0.9959474293972129,
-			-0.9959317172081449,
-			-0.9959159746812618,
-			-0.9959002018170435,
-			-0.9958843986159704,
-			-0.9958685650785236,
-			-0.9958527012051857,
-			-0.9958368069964398,
-			-0.9958208824527701,
-			-0.9958049275746618,
-			-0.9957889423626006,
-			-0.9957729268170739,
-			-0.9957568809385692,
-			-0.9957408047275753,
-			-0.9957246981845822,
-			-0.9957085613100801,
-			-0.9956923941045610,
-			-0.9956761965685171,
-			-0.9956599687024419,
-			-0.9956437105068296,
-			-0.9956274219821757,
-			-0.9956111031289763,
-			-0.9955947539477283,
-			-0.9955783744389299,
-			-0.9955619646030800,
-			-0.9955455244406786,
-			-0.9955290539522262,
-			-0.9955125531382248,
-			-0.9954960219991770,
-			-0.9954794605355862,
-			-0.9954628687479571,
-			-0.9954462466367950,
-			-0.9954295942026063,
-			-0.9954129114458982,
-			-0.9953961983671787,
-			-0.9953794549669575,
-			-0.9953626812457440,
-			-0.9953458772040493,
-			-0.9953290428423857,
-			-0.9953121781612655,
-			-0.9952952831612025,
-			-0.9952783578427117,
-			-0.9952614022063083,
-			-0.9952444162525090,
-			-0.9952273999818312,
-			-0.9952103533947931,
-			-0.9951932764919142,
-			-0.9951761692737146,
-			-0.9951590317407153,
-			-0.9951418638934383,
-			-0.9951246657324069,
-			-0.9951074372581447,
-			-0.9950901784711764,
-			-0.9950728893720282,
-			-0.9950555699612263,
-			-0.9950382202392986,
-			-0.9950208402067733,
-			-0.9950034298641800,
-			-0.9949859892120491,
-			-0.9949685182509117,
-			-0.9949510169813002,
-			-0.9949334854037475,
-			-0.9949159235187879,
-			-0.9948983313269562,
-			-0.9948807088287882,
-			-0.9948630560248209,
-			-0.9948453729155919,
-			-0.9948276595016401,
-			-0.9948099157835046,
-			-0.9947921417617265,
-			-0.9947743374368468,
-			-0.9947565028094080,
-			-0.9947386378799533,
-			-0.9947207426490271,
-			-0.9947028171171742,
-			-0.9946848612849409,
-			-0.9946668751528741,
-			-0.9946488587215216,
-			-0.9946308119914323,
-			-0.9946127349631561,
-			-0.9945946276372433,
-			-0.9945764900142456,
-			-0.9945583220947157,
-			-0.9945401238792068,
-			-0.9945218953682734,
-			-0.9945036365624706,
-			-0.9944853474623547,
-			-0.9944670280684830,
-			-0.9944486783814133,
-			-0.9944302984017046,
-			-0.9944118881299168,
-			-0.9943934475666106,
-			-0.9943749767123481,
-			-0.9943564755676915,
-			-0.9943379441332046,
-			-0.9943193824094519,
-			-0.9943007903969989,
-			-0.9942821680964119,
-			-0.9942635155082579,
-			-0.9942448326331054,
-			-0.9942261194715235,
-			-0.9942073760240822,
-			-0.9941886022913522,
-			-0.9941697982739057,
-			-0.9941509639723155,
-			-0.9941320993871551,
-			-0.9941132045189993,
-			-0.9940942793684237,
-			-0.9940753239360046,
-			-0.9940563382223195,
-			-0.9940373222279471,
-			-0.9940182759534661,
-			-0.9939991993994570,
-			-0.9939800925665009,
-			-0.9939609554551798,
-			-0.9939417880660765,
-			-0.9939225903997749,
-			-0.9939033624568601,
-			-0.9938841042379175,
-			-0.9938648157435337,
-			-0.9938454969742966,
-			-0.9938261479307944,
-			-0.9938067686136166,
-			-0.9937873590233536,
-			-0.9937679191605964,
-			-0.9937484490259374,
-			-0.9937289486199696,
-			-0.9937094179432872,
-			-0.9936898569964848,
-			-0.9936702657801585,
-			-0.9936506442949051,
-			-0.9936309925413221,
-			-0.9936113105200085,
-			-0.9935915982315633,
-			-0.9935718556765875,
-			-0.9935520828556823,
-			-0.9935322797694498,
-			-0.9935124464184936,
-			-0.9934925828034176,
-			-0.9934726889248269,
-			-0.9934527647833276,
-			-0.9934328103795266,
-			-0.9934128257140318,
-			-0.9933928107874518,
-			-0.9933727656003964,
-			-0.9933526901534764,
-			-0.9933325844473029,
-			-0.9933124484824887,
-			-0.9932922822596471,
-			-0.9932720857793922,
-			-0.9932518590423394,
-			-0.9932316020491050,
-			-0.9932113148003058,
-			-0.9931909972965598,
-			-0.9931706495384861,
-			-0.9931502715267043,
-			-0.9931298632618354,
-			-0.9931094247445008,
-			-0.9930889559753233,
-			-0.9930684569549263,
-			-0.9930479276839342,
-			-0.9930273681629727,
-			-0.9930067783926676,
-			-0.9929861583736463,
-			-0.9929655081065371,
-			-0.9929448275919686,
-			-0.9929241168305712,
-			-0.9929033758229757,
-			-0.9928826045698137,
-			-0.9928618030717181,
-			-0.9928409713293225,
-			-0.9928201093432615,
-			-0.9927992171141706,
-			-0.9927782946426862,
-			-0.9927573419294455,
-			-0.9927363589750871,
-			-0.9927153457802498,
-			-0.9926943023455738,
-			-0.9926732286717003,
-			-0.9926521247592711,
-			-0.9926309906089290,
-			-0.9926098262213179,
-			-0.9925886315970824,
-			-0.9925674067368684,
-			-0.9925461516413220,
-			-0.9925248663110910,
-			-0.9925035507468237,
-			-0.9924822049491695,
-			-0.9924608289187784,
-			-0.9924394226563018,
-			-0.9924179861623915,
-			-0.9923965194377006,
-			-0.9923750224828832,
-			-0.9923534952985941,
-			-0.9923319378854888,
-			-0.9923103502442241,
-			-0.9922887323754577,
-			-0.9922670842798480,
-			-0.9922454059580545,
-			-0.9922236974107375,
-			-0.9922019586385584,
-			-0.9921801896421792,
-			-0.9921583904222633,
-			-0.9921365609794746,
-			-0.9921147013144779,
-			-0.9920928114279391,
-			-0.9920708913205254,
-			-0.9920489409929043,
-			-0.9920269604457443,
-			-0.9920049496797150,
-			-0.9919829086954871,
-			-0.9919608374937318,
-			-0.9919387360751214,
-			-0.9919166044403294,
-			-0.9918944425900297,
-			-0.9918722505248975,
-			-0.9918500282456089,
-			-0.9918277757528406,
-			-0.9918054930472706,
-			-0.9917831801295778,
-			-0.9917608370004416,
-			-0.9917384636605427,
-			-0.9917160601105629,
-			-0.9916936263511843,
-			-0.9916711623830905,
-			-0.9916486682069656,
-			-0.9916261438234949,
-			-0.9916035892333647,
-			-0.9915810044372617,
-			-0.9915583894358742,
-			-0.9915357442298909,
-			-0.9915130688200017,
-			-0.9914903632068973,
-			-0.9914676273912693,
-			-0.9914448613738105,
-			-0.9914220651552141,
-			-0.9913992387361745,
-			-0.9913763821173873,
-			-0.9913534952995487,
-			-0.9913305782833558,
-			-0.9913076310695066,
-			-0.9912846536587002,
-			-0.9912616460516365,
-			-0.9912386082490164,
-			-0.9912155402515418,
-			-0.9911924420599152,
-			-0.9911693136748401,
-			-0.9911461550970212,
-			-0.9911229663271640,
-			-0.9910997473659748,
-			-0.9910764982141609,
-			-0.9910532188724306,
-			-0.9910299093414927,
-			-0.9910065696220577,
-			-0.9909831997148363,
-			-0.9909597996205404,
-			-0.9909363693398829,
-			-0.9909129088735774,
-			-0.9908894182223387,
-			-0.9908658973868824,
-			-0.9908423463679247,
-			-0.9908187651661831,
-			-0.9907951537823761,
-			-0.9907715122172229,
-			-0.9907478404714437,
-			-0.9907241385457594,
-			-0.9907004064408921,
-			-0.9906766441575646,
-			-0.9906528516965010,
-			-0.9906290290584258,
-			-0.9906051762440649,
-			-0.9905812932541447,
-			-0.9905573800893929,
-			-0.9905334367505378,
-			-0.9905094632383088,
-			-0.9904854595534363,
-			-0.9904614256966513,
-			-0.9904373616686859,
-			-0.9904132674702734,
-			-0.9903891431021474,
-			-0.9903649885650430,
-			-0.9903408038596958,
-			-0.9903165889868429,
-			-0.9902923439472214,
-			-0.9902680687415703,
-			-0.9902437633706289,
-			-0.9902194278351374,
-			-0.9901950621358374,
-			-0.9901706662734709,
-			-0.9901462402487812,
-			-0.9901217840625123,
-			-0.9900972977154090,
-			-0.9900727812082175,
-			-0.9900482345416844,
-			-0.9900236577165575,
-			-0.9899990507335856,
-			-0.9899744135935180,
-			-0.9899497462971054,
-			-0.9899250488450991,
-			-0.9899003212382514,
-			-0.9898755634773159,
-			-0.9898507755630461,
-			-0.9898259574961975,
-			-0.9898011092775263,
-			-0.9897762309077890,
-			-0.9897513223877435,
-			-0.9897263837181489,
-			-0.9897014148997647,
-			-0.9896764159333511,
-			-0.9896513868196702,
-			-0.9896263275594842,
-			-0.9896012381535564,
-			-0.9895761186026509,
-			-0.9895509689075334,
-			-0.9895257890689696,
-			-0.9895005790877264,
-			-0.9894753389645721,
-			-0.9894500687002755,
-			-0.9894247682956061,
-			-0.9893994377513349,
-			-0.9893740770682333,
-			-0.9893486862470739,
-			-0.9893232652886302,
-			-0.9892978141936767,
-			-0.9892723329629883,
-			-0.9892468215973416,
-			-0.9892212800975134,
-			-0.9891957084642820,
-			-0.9891701066984262,
-			-0.9891444748007259,
-			-0.9891188127719618,
-			-0.9890931206129159,
-			-0.9890673983243705,
-			-0.9890416459071093,
-			-0.9890158633619168,
-			-0.9889900506895783,
-			-0.9889642078908801,
-			-0.9889383349666097,
-			-0.9889124319175548,
-			-0.9888864987445046,
-			-0.9888605354482491,
-			-0.9888345420295793,
-			-0.9888085184892869,
-			-0.9887824648281645,
-			-0.9887563810470059,
-			-0.9887302671466057,
-			-0.9887041231277590,
-			-0.9886779489912628,
-			-0.9886517447379141,
-			-0.9886255103685110,
-			-0.9885992458838527,
-			-0.9885729512847395,
-			-0.9885466265719721,
-			-0.9885202717463525,
-			-0.9884938868086836,
-			-0.9884674717597690,
-			-0.9884410266004133,
-			-0.9884145513314223,
-			-0.9883880459536022,
-			-0.9883615104677608,
-			-0.9883349448747060,
-			-0.9883083491752471,
-			-0.9882817233701945,
-			-0.9882550674603591,
-			-0.9882283814465529,
-			-0.9882016653295888,
-			-0.9881749191102804,
-			-0.9881481427894431,
-			-0.9881213363678917,
-			-0.9880944998464435,
-			-0.9880676332259155,
-			-0.9880407365071262,
-			-0.9880138096908953,
-			-0.9879868527780424,
-			-0.9879598657693891,
-			-0.9879328486657575,
-			-0.9879058014679704,
-			-0.9878787241768515,
-			-0.9878516167932261,
-			-0.9878244793179197,
-			-0.9877973117517589,
-			-0.9877701140955714,
-			-0.9877428863501857,
-			-0.9877156285164309,
-			-0.9876883405951378,
-			-0.9876610225871373,
-			-0.9876336744932616,
-			-0.9876062963143437,
-			-0.9875788880512180,
-			-0.9875514497047190,
-			-0.9875239812756824,
-			-0.9874964827649454,
-			-0.9874689541733455,
-			-0.9874413955017208,
-			-0.9874138067509115,
-			-0.9873861879217576,
-			-0.9873585390151004,
-			-0.9873308600317822,
-			-0.9873031509726463,
-			-0.9872754118385365,
-			-0.9872476426302981,
-			-0.9872198433487767,
-			-0.9871920139948192,
-			-0.9871641545692734,
-			-0.9871362650729879,
-			-0.9871083455068123,
-			-0.9870803958715971,
-			-0.9870524161681937,
-			-0.9870244063974540,
-			-0.9869963665602319,
-			-0.9869682966573812,
-			-0.9869401966897570,
-			-0.9869120666582151,
-			-0.9868839065636127,
-			-0.9868557164068072,
-			-0.9868274961886578,
-			-0.9867992459100240,
-			-0.9867709655717661,
-			-0.9867426551747457,
-			-0.9867143147198253,
-			-0.9866859442078681,
-			-0.9866575436397383,
-			-0.9866291130163011,
-			-0.9866006523384225,
-			-0.9865721616069695,
-			-0.9865436408228099,
-			-0.9865150899868126,
-			-0.9864865090998470,
-			-0.9864578981627842,
-			-0.9864292571764955,
-			-0.9864005861418533,
-			-0.9863718850597312,
-			-0.9863431539310031,
-			-0.9863143927565444,
-			-0.9862856015372314,
-			-0.9862567802739409,
-			-0.9862279289675508,
-			-0.9861990476189404,
-			-0.9861701362289890,
-			-0.9861411947985773,
-			-0.9861122233285871,
-			-0.9860832218199008,
-			-0.9860541902734020,
-			-0.9860251286899749,
-			-0.9859960370705050,
-			-0.9859669154158781,
-			-0.9859377637269815,
-			-0.9859085820047034,
-			-0.9858793702499326,
-			-0.9858501284635585,
-			-0.9858208566464723,
-			-0.9857915547995659,
-			-0.9857622229237314,
-			-0.9857328610198625,
-			-0.9857034690888536,
-			-0.9856740471316000,
-			-0.9856445951489980,
-			-0.9856151131419448,
-			-0.9855856011113384,
-			-0.9855560590580777,
-			-0.9855264869830628,
-			-0.9854968848871944,
-			-0.9854672527713743,
-			-0.9854375906365049,
-			-0.9854078984834902,
-			-0.9853781763132342,
-			-0.9853484241266427,
-			-0.9853186419246218,
-			-0.9852888297080786,
-			-0.9852589874779215,
-			-0.9852291152350593,
-			-0.9851992129804023,
-			-0.9851692807148610,
-			-0.9851393184393472,
-			-0.9851093261547739,
-			-0.9850793038620547,
-			-0.9850492515621038,
-			-0.9850191692558368,
-			-0.9849890569441703,
-			-0.9849589146280213,
-			-0.9849287423083078,
-			-0.9848985399859495,
-			-0.9848683076618659,
-			-0.9848380453369782,
-			-0.9848077530122080,
-			-0.9847774306884785,
-			-0.9847470783667128,
-			-0.9847166960478357,
-			-0.9846862837327731,
-			-0.9846558414224509,
-			-0.9846253691177964,
-			-0.9845948668197384,
-			-0.9845643345292054,
-			-0.9845337722471279,
-			-0.9845031799744366,
-			-0.9844725577120638,
-			-0.9844419054609417,
-			-0.9844112232220046,
-			-0.9843805109961868,
-			-0.9843497687844239,
-			-0.9843189965876525,
-			-0.9842881944068098,
-			-0.9842573622428342,
-			-0.9842265000966650,
-			-0.9841956079692420,
-			-0.9841646858615064,
-			-0.9841337337744003,
-			-0.9841027517088663,
-			-0.9840717396658482,
-			-0.9840406976462909,
-			-0.9840096256511398,
-			-0.9839785236813413,
-			-0.9839473917378433,
-			-0.9839162298215937,
-			-0.9838850379335417,
-			-0.9838538160746376,
-			-0.9838225642458327,
-			-0.9837912824480786,
-			-0.9837599706823283,
-			-0.9837286289495359,
-			-0.9836972572506559,
-			-0.9836658555866438,
-			-0.9836344239584563,
-			-0.9836029623670510,
-			-0.9835714708133859,
-			-0.9835399492984206,
-			-0.9835083978231154,
-			-0.9834768163884310,
-			-0.9834452049953297,
-			-0.9834135636447745,
-			-0.9833818923377290,
-			-0.9833501910751582,
-			-0.9833184598580277,
-			-0.9832866986873039,
-			-0.9832549075639546,
-			-0.9832230864889481,
-			-0.9831912354632536,
-			-0.9831593544878416,
-			-0.9831274435636830,
-			-0.9830955026917501,
-			-0.9830635318730154,
-			-0.9830315311084534,
-			-0.9829995003990385,
-			-0.9829674397457466,
-			-0.9829353491495544,
-			-0.9829032286114390,
-			-0.9828710781323793,
-			-0.9828388977133544,
-			-0.9828066873553447,
-			-0.9827744470593313,
-			-0.9827421768262965,
-			-0.9827098766572231,
-			-0.9826775465530949,
-			-0.9826451865148972,
-			-0.9826127965436153,
-			-0.9825803766402359,
-			-0.9825479268057469,
-			-0.9825154470411364,
-			-0.9824829373473939,
-			-0.9824503977255097,
-			-0.9824178281764753,
-			-0.9823852287012823,
-			-0.9823525993009242,
-			-0.9823199399763947,
-			-0.9822872507286888,
-			-0.9822545315588020,
-			-0.9822217824677313,
-			-0.9821890034564742,
-			-0.9821561945260292,
-			-0.9821233556773956,
-			-0.9820904869115740,
-			-0.9820575882295652,
-			-0.9820246596323718,
-			-0.9819917011209967,
-			-0.9819587126964436,
-			-0.9819256943597180,
-			-0.9818926461118250,
-			-0.9818595679537718,
-			-0.9818264598865659,
-			-0.9817933219112157,
-			-0.9817601540287306,
-			-0.9817269562401214,
-			-0.9816937285463989,
-			-0.9816604709485753,
-			-0.9816271834476640,
-			-0.9815938660446788,
-			-0.9815605187406343,
-			-0.9815271415365469,
-			-0.9814937344334330,
-			-0.9814602974323102,
-			-0.9814268305341970,
-			-0.9813933337401133,
-			-0.9813598070510791,
-			-0.9813262504681156,
-			-0.9812926639922452,
-			-0.9812590476244910,
-			-0.9812254013658769,
-			-0.9811917252174278,
-			-0.9811580191801698,
-			-0.9811242832551292,
-			-0.9810905174433341,
-			-0.9810567217458128,
-			-0.9810228961635949,
-			-0.9809890406977108,
-			-0.9809551553491916,
-			-0.9809212401190697,
-			-0.9808872950083782,
-			-0.9808533200181510,
-			-0.9808193151494231,
-			-0.9807852804032305,
-			-0.9807512157806096,
-			-0.9807171212825986,
-			-0.9806829969102355,
-			-0.9806488426645603,
-			-0.9806146585466131,
-			-0.9805804445574351,
-			-0.9805462006980690,
-			-0.9805119269695572,
-			-0.9804776233729444,
-			-0.9804432899092753,
-			-0.9804089265795959,
-			-0.9803745333849524,
-			-0.9803401103263931,
-			-0.9803056574049666,
-			-0.9802711746217218,
-			-0.9802366619777098,
-			-0.9802021194739815,
-			-0.9801675471115892,
-			-0.9801329448915860,
-			-0.9800983128150261,
-			-0.9800636508829643,
-			-0.9800289590964565,
-			-0.9799942374565596,
-			-0.9799594859643310,
-			-0.9799247046208297,
-			-0.9798898934271147,
-			-0.9798550523842469,
-			-0.9798201814932873,
-			-0.9797852807552982,
-			-0.9797503501713428,
-			-0.9797153897424852,
-			-0.9796803994697900,
-			-0.9796453793543236,
-			-0.9796103293971523,
-			-0.9795752495993442,
-			-0.9795401399619674,
-			-0.9795050004860918,
-			-0.9794698311727877,
-			-0.9794346320231264,
-			-0.9793994030381801,
-			-0.9793641442190221,
-			-0.9793288555667263,
-			-0.9792935370823673,
-			-0.9792581887670218,
-			-0.9792228106217659,
-			-0.9791874026476772,
-			-0.9791519648458350,
-			-0.9791164972173183,
-			-0.9790809997632074,
-			-0.9790454724845838,
-			-0.9790099153825299,
-			-0.9789743284581285,
-			-0.9789387117124637,
-			-0.9789030651466206,
-			-0.9788673887616851,
-			-0.9788316825587438,
-			-0.9787959465388842,
-			-0.9787601807031954,
-			-0.9787243850527664,
-			-0.9786885595886878,
-			-0.9786527043120511,
-			-0.9786168192239481,
-			-0.9785809043254721,
-			-0.9785449596177173,
-			-0.9785089851017784,
-			-0.9784729807787516,
-			-0.9784369466497330,
-			-0.9784008827158208,
-			-0.9783647889781136,
-			-0.9783286654377107,
-			-0.9782925120957122,
-			-0.9782563289532200,
-			-0.9782201160113361,
-			-0.9781838732711631,
-			-0.9781476007338057,
-			-0.9781112984003686,
-			-0.9780749662719572,
-			-0.9780386043496789,
-			-0.9780022126346412,
-			-0.9779657911279522,
-			-0.9779293398307218,
-			-0.9778928587440604,
-			-0.9778563478690790,
-			-0.9778198072068899,
-			-0.9777832367586062,
-			-0.9777466365253420,
-			-0.9777100065082120,
-			-0.9776733467083322,
-			-0.9776366571268192,
-			-0.9775999377647908,
-			-0.9775631886233652,
-			-0.9775264097036622,
-			-0.9774896010068019,
-			-0.9774527625339058,
-			-0.9774158942860959,
-			-0.9773789962644953,
-			-0.9773420684702280,
-			-0.9773051109044187,
-			-0.9772681235681935,
-			-0.9772311064626789,
-			-0.9771940595890025,
-			-0.9771569829482929,
-			-0.9771198765416796,
-			-0.9770827403702929,
-			-0.9770455744352636,
-			-0.9770083787377244,
-			-0.9769711532788082,
-			-0.9769338980596487,
-			-0.9768966130813811,
-			-0.9768592983451408,
-			-0.9768219538520649,
-			-0.9767845796032906,
-			-0.9767471755999567,
-			-0.9767097418432025,
-			-0.9766722783341678,
-			-0.9766347850739947,
-			-0.9765972620638247,
-			-0.9765597093048008,
-			-0.9765221267980672,
-			-0.9764845145447687,
-			-0.9764468725460509,
-			-0.9764092008030604,
-			-0.9763714993169449,
-			-0.9763337680888527,
-			-0.9762960071199334,
-			-0.9762582164113371,
-			-0.9762203959642148,
-			-0.9761825457797190,
-			-0.9761446658590023,
-			-0.9761067562032187,
-			-0.9760688168135232,
-			-0.9760308476910711,
-			-0.9759928488370194,
-			-0.9759548202525252,
-			-0.9759167619387475,
-			-0.9758786738968451,
-			-0.9758405561279784,
-			-0.9758024086333086,
-			-0.9757642314139976,
-			-0.9757260244712084,
-			-0.9756877878061051,
-			-0.9756495214198520,
-			-0.9756112253136149,
-			-0.9755728994885607,
-			-0.9755345439458567,
-			-0.9754961586866709,
-			-0.9754577437121732,
-			-0.9754192990235334,
-			-0.9753808246219224,
-			-0.9753423205085128,
-			-0.9753037866844769,
-			-0.9752652231509890,
-			-0.9752266299092234,
-			-0.9751880069603560,
-			-0.9751493543055634,
-			-0.9751106719460225,
-			-0.9750719598829122,
-			-0.9750332181174116,
-			-0.9749944466507006,
-			-0.9749556454839603,
-			-0.9749168146183731,
-			-0.9748779540551213,
-			-0.9748390637953888,
-			-0.9748001438403606,
-			-0.9747611941912218,
-			-0.9747222148491591,
-			-0.9746832058153601,
-			-0.9746441670910125,
-			-0.9746050986773062,
-			-0.9745660005754306,
-			-0.9745268727865771,
-			-0.9744877153119378,
-			-0.9744485281527049,
-			-0.9744093113100725,
-			-0.9743700647852352,
-			-0.9743307885793886,
-			-0.9742914826937287,
-			-0.9742521471294534,
-			-0.9742127818877606,
-			-0.9741733869698493,
-			-0.9741339623769198,
-			-0.9740945081101732,
-			-0.9740550241708108,
-			-0.9740155105600357,
-			-0.9739759672790517,
-			-0.9739363943290631,
-			-0.9738967917112752,
-			-0.9738571594268948,
-			-0.9738174974771290,
-			-0.9737778058631857,
-			-0.9737380845862744,
-			-0.9736983336476049,
-			-0.9736585530483880,
-			-0.9736187427898355,
-			-0.9735789028731603,
-			-0.9735390332995758,
-			-0.9734991340702964,
-			-0.9734592051865378,
-			-0.9734192466495160,
-			-0.9733792584604485,
-			-0.9733392406205532,
-			-0.9732991931310491,
-			-0.9732591159931563,
-			-0.9732190092080953,
-			-0.9731788727770884,
-			-0.9731387067013575,
-			-0.9730985109821266,
-			-0.9730582856206200,
-			-0.9730180306180630,
-			-0.9729777459756821,
-			-0.9729374316947039,
-			-0.9728970877763570,
-			-0.9728567142218701,
-			-0.9728163110324730,
-			-0.9727758782093966,
-			-0.9727354157538723,
-			-0.9726949236671332,
-			-0.9726544019504119,
-			-0.9726138506049435,
-			-0.9725732696319631,
-			-0.9725326590327066,
-			-0.9724920188084113,
-			-0.9724513489603153,
-			-0.9724106494896571,
-			-0.9723699203976766,
-			-0.9723291616856147,
-			-0.9722883733547127,
-			-0.9722475554062133,
-			-0.9722067078413600,
-			-0.9721658306613967,
-			-0.9721249238675688,
-			-0.9720839874611223,
-			-0.9720430214433045,
-			-0.9720020258153628,
-			-0.9719610005785462,
-			-0.9719199457341047,
-			-0.9718788612832886,
-			-0.9718377472273496,
-			-0.9717966035675397,
-			-0.9717554303051125,
-			-0.9717142274413224,
-			-0.9716729949774242,
-			-0.9716317329146739,
-			-0.9715904412543288,
-			-0.9715491199976461,
-			-0.9715077691458851,
-			-0.9714663887003052,
-			-0.9714249786621668,
-			-0.9713835390327313,
-			-0.9713420698132614,
-			-0.9713005710050201,
-			-0.9712590426092714,
-			-0.9712174846272803,
-			-0.9711758970603130,
-			-0.9711342799096363,
-			-0.9710926331765174,
-			-0.9710509568622256,
-			-0.9710092509680303,
-			-0.9709675154952014,
-			-0.9709257504450111,
-			-0.9708839558187311,
-			-0.9708421316176344,
-			-0.9708002778429955,
-			-0.9707583944960890,
-			-0.9707164815781908,
-			-0.9706745390905778,
-			-0.9706325670345274,
-			-0.9705905654113183,
-			-0.9705485342222300,
-			-0.9705064734685425,
-			-0.9704643831515375,
-			-0.9704222632724968,
-			-0.9703801138327037,
-			-0.9703379348334419,
-			-0.9702957262759966,
-			-0.9702534881616530,
-			-0.9702112204916983,
-			-0.9701689232674198,
-			-0.9701265964901060,
-			-0.9700842401610460,
-			-0.9700418542815303,
-			-0.9699994388528501,
-			-0.9699569938762974,
-			-0.9699145193531649,
-			-0.9698720152847469,
-			-0.9698294816723378,
-			-0.9697869185172331,
-			-0.9697443258207299,
-			-0.9697017035841252,
-			-0.9696590518087174,
-			-0.9696163704958060,
-			-0.9695736596466910,
-			-0.9695309192626733,
-			-0.9694881493450549,
-			-0.9694453498951390,
-			-0.9694025209142287,
-			-0.9693596624036293,
-			-0.9693167743646460,
-			-0.9692738567985852,
-			-0.9692309097067545,
-			-0.9691879330904618,
-			-0.9691449269510165,
-			-0.9691018912897287,
-			-0.9690588261079089,
-			-0.9690157314068697,
-			-0.9689726071879230,
-			-0.9689294534523829,
-			-0.9688862702015640,
-			-0.9688430574367816,
-			-0.9687998151593520,
-			-0.9687565433705924,
-			-0.9687132420718211,
-			-0.9686699112643570,
-			-0.9686265509495201,
-			-0.9685831611286311,
-			-0.9685397418030121,
-			-0.9684962929739852,
-			-0.9684528146428741,
-			-0.9684093068110037,
-			-0.9683657694796989,
-			-0.9683222026502856,
-			-0.9682786063240915,
-			-0.9682349805024445,
-			-0.9681913251866733,
-			-0.9681476403781077,
-			-0.9681039260780788,
-			-0.9680601822879179,
-			-0.9680164090089576,
-			-0.9679726062425313,
-			-0.9679287739899733,
-			-0.9678849122526187,
-			-0.9678410210318038,
-			-0.9677971003288656,
-			-0.9677531501451417,
-			-0.9677091704819712,
-			-0.9676651613406939,
-			-0.9676211227226499,
-			-0.9675770546291812,
-			-0.9675329570616300,
-			-0.9674888300213395,
-			-0.9674446735096541,
-			-0.9674004875279185,
-			-0.9673562720774791,
-			-0.9673120271596828,
-
-			-0.9672677527758768,
-			-0.9672234489274103,
-			-0.9671791156156329,
-			-0.9671347528418948,
-			-0.9670903606075474,
-			-0.9670459389139432,
-			-0.9670014877624352,
-			-0.9669570071543772,
-			-0.9669124970911247,
-			-0.9668679575740331,
-			-0.9668233886044595,
-			-0.9667787901837611,
-			-0.9667341623132970,
-			-0.9666895049944264,
-			-0.9666448182285092,
-			-0.9666001020169074,
-			-0.9665553563609828,
-			-0.9665105812620981,
-			-0.9664657767216177,
-			-0.9664209427409062,
-			-0.9663760793213294,
-			-0.9663311864642539,
-			-0.9662862641710472,
-			-0.9662413124430778,
-			-0.9661963312817147,
-			-0.9661513206883287,
-			-0.9661062806642901,
-			-0.9660612112109717,
-			-0.9660161123297457,
-			-0.9659709840219864,
-			-0.9659258262890684,
-			-0.9658806391323670,
-			-0.9658354225532588,
-			-0.9657901765531215,
-			-0.9657449011333329,
-			-0.9656995962952726,
-			-0.9656542620403202,
-			-0.9656088983698571,
-			-0.9655635052852648,
-			-0.9655180827879263,
-			-0.9654726308792252,
-			-0.9654271495605459,
-			-0.9653816388332738,
-			-0.9653360986987957,
-			-0.9652905291584984,
-			-0.9652449302137700,
-			-0.9651993018659999,
-			-0.9651536441165778,
-			-0.9651079569668942,
-			-0.9650622404183413,
-			-0.9650164944723116,
-			-0.9649707191301983,
-			-0.9649249143933960,
-			-0.9648790802633003,
-			-0.9648332167413068,
-			-0.9647873238288129,
-			-0.9647414015272168,
-			-0.9646954498379169,
-			-0.9646494687623133,
-			-0.9646034583018066,
-			-0.9645574184577982,
-			-0.9645113492316907,
-			-0.9644652506248873,
-			-0.9644191226387926,
-			-0.9643729652748114,
-			-0.9643267785343497,
-			-0.9642805624188148,
-			-0.9642343169296140,
-			-0.9641880420681567,
-			-0.9641417378358518,
-			-0.9640954042341101,
-			-0.9640490412643433,
-			-0.9640026489279632,
-			-0.9639562272263832,
-			-0.9639097761610175,
-			-0.9638632957332811,
-			-0.9638167859445894,
-			-0.9637702467963599,
-			-0.9637236782900098,
-			-0.9636770804269577,
-			-0.9636304532086231,
-			-0.9635837966364263,
-			-0.9635371107117886,
-			-0.9634903954361321,
-			-0.9634436508108799,
-			-0.9633968768374560,
-			-0.9633500735172847,
-			-0.9633032408517925,
-			-0.9632563788424056,
-			-0.9632094874905512,
-			-0.9631625667976582,
-			-0.9631156167651558,
-			-0.9630686373944738,
-			-0.9630216286870434,
-			-0.9629745906442971,
-			-0.9629275232676673,
-			-0.9628804265585875,
-			-0.9628333005184930,
-			-0.9627861451488188,
-			-0.9627389604510017,
-			-0.9626917464264788,
-			-0.9626445030766884,
-			-0.9625972304030697,
-			-0.9625499284070623,
-			-0.9625025970901077,
-			-0.9624552364536474,
-			-0.9624078464991240,
-			-0.9623604272279810,
-			-0.9623129786416633,
-			-0.9622655007416161,
-			-0.9622179935292855,
-			-0.9621704570061185,
-			-0.9621228911735636,
-			-0.9620752960330694,
-			-0.9620276715860859,
-			-0.9619800178340638,
-			-0.9619323347784547,
-			-0.9618846224207108,
-			-0.9618368807622861,
-			-0.9617891098046347,
-			-0.9617413095492114,
-			-0.9616934799974726,
-			-0.9616456211508754,
-			-0.9615977330108773,
-			-0.9615498155789373,
-			-0.9615018688565149,
-			-0.9614538928450709,
-			-0.9614058875460663,
-			-0.9613578529609640,
-			-0.9613097890912268,
-			-0.9612616959383189,
-			-0.9612135735037053,
-			-0.9611654217888519,
-			-0.9611172407952256,
-			-0.9610690305242939,
-			-0.9610207909775255,
-			-0.9609725221563897,
-			-0.9609242240623571,
-			-0.9608758966968987,
-			-0.9608275400614865,
-			-0.9607791541575942,
-			-0.9607307389866951,
-			-0.9606822945502640,
-			-0.9606338208497771,
-			-0.9605853178867105,
-			-0.9605367856625420,
-			-0.9604882241787498,
-			-0.9604396334368134,
-			-0.9603910134382123,
-			-0.9603423641844283,
-			-0.9602936856769432,
-			-0.9602449779172395,
-			-0.9601962409068011,
-			-0.9601474746471128,
-			-0.9600986791396597,
-			-0.9600498543859287,
-			-0.9600010003874069,
-			-0.9599521171455820,
-			-0.9599032046619436,
-			-0.9598542629379817,
-			-0.9598052919751870,
-			-0.9597562917750512,
-			-0.9597072623390667,
-			-0.9596582036687276,
-			-0.9596091157655277,
-			-0.9595599986309626,
-			-0.9595108522665289,
-			-0.9594616766737227,
-			-0.9594124718540430,
-			-0.9593632378089879,
-			-0.9593139745400576,
-			-0.9592646820487526,
-			-0.9592153603365744,
-			-0.9591660094050254,
-			-0.9591166292556091,
-			-0.9590672198898296,
-			-0.9590177813091918,
-			-0.9589683135152021,
-			-0.9589188165093672,
-			-0.9588692902931943,
-			-0.9588197348681932,
-			-0.9587701502358724,
-			-0.9587205363977429,
-			-0.9586708933553157,
-			-0.9586212211101034,
-			-0.9585715196636189,
-			-0.9585217890173758,
-			-0.9584720291728898,
-			-0.9584222401316762,
-			-0.9583724218952513,
-			-0.9583225744651332,
-			-0.9582726978428404,
-			-0.9582227920298918,
-			-0.9581728570278079,
-			-0.9581228928381098,
-			-0.9580728994623192,
-			-0.9580228769019593,
-			-0.9579728251585540,
-			-0.9579227442336274,
-			-0.9578726341287058,
-			-0.9578224948453149,
-			-0.9577723263849826,
-			-0.9577221287492369,
-			-0.9576719019396066,
-			-0.9576216459576221,
-			-0.9575713608048144,
-			-0.9575210464827150,
-			-0.9574707029928564,
-			-0.9574203303367727,
-			-0.9573699285159980,
-			-0.9573194975320674,
-			-0.9572690373865174,
-			-0.9572185480808851,
-			-0.9571680296167083,
-			-0.9571174819955260,
-			-0.9570669052188783,
-			-0.9570162992883053,
-			-0.9569656642053489,
-			-0.9569149999715515,
-			-0.9568643065884563,
-			-0.9568135840576073,
-			-0.9567628323805503,
-			-0.9567120515588305,
-			-0.9566612415939953,
-			-0.9566104024875921,
-			-0.9565595342411699,
-			-0.9565086368562780,
-			-0.9564577103344667,
-			-0.9564067546772878,
-			-0.9563557698862929,
-			-0.9563047559630355,
-			-0.9562537129090696,
-			-0.9562026407259495,
-			-0.9561515394152318,
-			-0.9561004089784724,
-			-0.9560492494172292,
-			-0.9559980607330605,
-			-0.9559468429275256,
-			-0.9558955960021849,
-			-0.9558443199585989,
-			-0.9557930147983302,
-			-0.9557416805229413,
-			-0.9556903171339960,
-			-0.9556389246330590,
-			-0.9555875030216955,
-			-0.9555360523014723,
-			-0.9554845724739565,
-			-0.9554330635407162,
-			-0.9553815255033205,
-			-0.9553299583633394,
-			-0.9552783621223438,
-			-0.9552267367819050,
-			-0.9551750823435962,
-			-0.9551233988089904,
-			-0.9550716861796621,
-			-0.9550199444571865,
-			-0.9549681736431402,
-			-0.9549163737390997,
-			-0.9548645447466430,
-			-0.9548126866673491,
-			-0.9547607995027977,
-			-0.9547088832545689,
-			-0.9546569379242447,
-			-0.9546049635134073,
-			-0.9545529600236397,
-			-0.9545009274565261,
-			-0.9544488658136521,
-			-0.9543967750966027,
-			-0.9543446553069651,
-			-0.9542925064463271,
-			-0.9542403285162768,
-			-0.9541881215184043,
-			-0.9541358854542993,
-			-0.9540836203255531,
-			-0.9540313261337581,
-			-0.9539790028805069,
-			-0.9539266505673936,
-			-0.9538742691960130,
-			-0.9538218587679603,
-			-0.9537694192848325,
-			-0.9537169507482269,
-			-0.9536644531597418,
-			-0.9536119265209758,
-			-0.9535593708335299,
-			-0.9535067860990045,
-			-0.9534541723190013,
-			-0.9534015294951232,
-			-0.9533488576289738,
-			-0.9532961567221578,
-			-0.9532434267762798,
-			-0.9531906677929470,
-			-0.9531378797737662,
-			-0.9530850627203449,
-			-0.9530322166342926,
-			-0.9529793415172190,
-			-0.9529264373707345,
-			-0.9528735041964508,
-			-0.9528205419959804,
-			-0.9527675507709366,
-			-0.9527145305229334,
-			-0.9526614812535863,
-			-0.9526084029645109,
-			-0.9525552956573243,
-			-0.9525021593336441,
-			-0.9524489939950889,
-			-0.9523957996432785,
-			-0.9523425762798327,
-			-0.9522893239063733,
-			-0.9522360425245225,
-			-0.9521827321359029,
-			-0.9521293927421388,
-			-0.9520760243448547,
-			-0.9520226269456767,
-			-0.9519692005462311,
-			-0.9519157451481453,
-			-0.9518622607530479,
-			-0.9518087473625678,
-			-0.9517552049783354,
-			-0.9517016336019818,
-			-0.9516480332351385,
-			-0.9515944038794381,
-			-0.9515407455365150,
-			-0.9514870582080033,
-			-0.9514333418955383,
-			-0.9513795966007562,
-			-0.9513258223252947,
-			-0.9512720190707914,
-			-0.9512181868388854,
-			-0.9511643256312166,
-			-0.9511104354494253,
-			-0.9510565162951535,
-			-0.9510025681700438,
-			-0.9509485910757391,
-			-0.9508945850138840,
-			-0.9508405499861234,
-			-0.9507864859941035,
-			-0.9507323930394709,
-			-0.9506782711238735,
-			-0.9506241202489600,
-			-0.9505699404163800,
-			-0.9505157316277837,
-			-0.9504614938848227,
-			-0.9504072271891488,
-			-0.9503529315424154,
-			-0.9502986069462761,
-			-0.9502442534023859,
-			-0.9501898709124008,
-			-0.9501354594779768,
-			-0.9500810191007717,
-			-0.9500265497824441,
-			-0.9499720515246528,
-			-0.9499175243290576,
-			-0.9498629681973204,
-			-0.9498083831311026,
-			-0.9497537691320670,
-			-0.9496991262018770,
-			-0.9496444543421976,
-			-0.9495897535546937,
-			-0.9495350238410318,
-			-0.9494802652028794,
-			-0.9494254776419041,
-			-0.9493706611597746,
-			-0.9493158157581614,
-			-0.9492609414387349,
-			-0.9492060382031664,
-			-0.9491511060531285,
-			-0.9490961449902947,
-			-0.9490411550163390,
-			-0.9489861361329367,
-			-0.9489310883417637,
-			-0.9488760116444965,
-			-0.9488209060428133,
-			-0.9487657715383927,
-			-0.9487106081329140,
-			-0.9486554158280577,
-			-0.9486001946255047,
-			-0.9485449445269374,
-			-0.9484896655340391,
-			-0.9484343576484933,
-			-0.9483790208719847,
-			-0.9483236552061994,
-			-0.9482682606528237,
-			-0.9482128372135445,
-			-0.9481573848900512,
-			-0.9481019036840321,
-			-0.9480463935971775,
-			-0.9479908546311783,
-			-0.9479352867877265,
-			-0.9478796900685146,
-			-0.9478240644752360,
-			-0.9477684100095858,
-			-0.9477127266732589,
-			-0.9476570144679510,
-			-0.9476012733953602,
-			-0.9475455034571838,
-			-0.9474897046551208,
-			-0.9474338769908710,
-			-0.9473780204661351,
-			-0.9473221350826142,
-			-0.9472662208420111,
-			-0.9472102777460290,
-			-0.9471543057963716,
-			-0.9470983049947443,
-			-0.9470422753428529,
-			-0.9469862168424041,
-			-0.9469301294951058,
-			-0.9468740133026660,
-			-0.9468178682667945,
-			-0.9467616943892015,
-			-0.9467054916715981,
-			-0.9466492601156965,
-			-0.9465929997232092,
-			-0.9465367104958505,
-			-0.9464803924353347,
-			-0.9464240455433774,
-			-0.9463676698216954,
-			-0.9463112652720053,
-			-0.9462548318960257,
-			-0.9461983696954760,
-			-0.9461418786720756,
-			-0.9460853588275453,
-			-0.9460288101636072,
-			-0.9459722326819838,
-			-0.9459156263843979,
-			-0.9458589912725748,
-			-0.9458023273482392,
-			-0.9457456346131169,
-			-0.9456889130689352,
-			-0.9456321627174222,
-			-0.9455753835603062,
-			-0.9455185755993167,
-			-0.9454617388361848,
-			-0.9454048732726411,
-			-0.9453479789104183,
-			-0.9452910557512495,
-			-0.9452341037968683,
-			-0.9451771230490099,
-			-0.9451201135094098,
-			-0.9450630751798049,
-			-0.9450060080619326,
-			-0.9449489121575309,
-			-0.9448917874683396,
-			-0.9448346339960982,
-			-0.9447774517425485,
-			-0.9447202407094316,
-			-0.9446630008984905,
-			-0.9446057323114692,
-			-0.9445484349501115,
-			-0.9444911088161634,
-			-0.9444337539113709,
-			-0.9443763702374811,
-			-0.9443189577962419,
-			-0.9442615165894027,
-			-0.9442040466187128,
-			-0.9441465478859226,
-			-0.9440890203927843,
-			-0.9440314641410499,
-			-0.9439738791324724,
-			-0.9439162653688065,
-			-0.9438586228518069,
-			-0.9438009515832295,
-			-0.9437432515648310,
-			-0.9436855227983694,
-			-0.9436277652856030,
-			-0.9435699790282907,
-			-0.9435121640281937,
-			-0.9434543202870727,
-			-0.9433964478066893,
-			-0.9433385465888069,
-			-0.9432806166351894,
-			-0.9432226579476011,
-			-0.9431646705278075,
-			-0.9431066543775753,
-			-0.9430486094986715,
-			-0.9429905358928646,
-			-0.9429324335619232,
-			-0.9428743025076173,
-			-0.9428161427317180,
-			-0.9427579542359963,
-			-0.9426997370222254,
-			-0.9426414910921785,
-			-0.9425832164476295,
-			-0.9425249130903539,
-			-0.9424665810221280,
-			-0.9424082202447283,
-			-0.9423498307599324,
-			-0.9422914125695191,
-			-0.9422329656752683,
-			-0.9421744900789598,
-			-0.9421159857823753,
-			-0.9420574527872969,
-			-0.9419988910955073,
-			-0.9419403007087905,
-			-0.9418816816289317,
-			-0.9418230338577163,
-			-0.9417643573969302,
-			-0.9417056522483618,
-			-0.9416469184137989,
-			-0.9415881558950302,
-			-0.9415293646938464,
-			-0.9414705448120380,
-			-0.9414116962513969,
-			-0.9413528190137155,
-			-0.9412939131007878,
-			-0.9412349785144077,
-			-0.9411760152563707,
-			-0.9411170233284728,
-			-0.9410580027325108,
-			-0.9409989534702833,
-			-0.9409398755435883,
-			-0.9408807689542256,
-			-0.9408216337039957,
-			-0.9407624697947000,
-			-0.9407032772281411,
-			-0.9406440560061213,
-			-0.9405848061304455,
-			-0.9405255276029179,
-			-0.9404662204253442,
-			-0.9404068845995316,
-			-0.9403475201272870,
-			-0.9402881270104189,
-			-0.9402287052507368,
-			-0.9401692548500502,
-			-0.9401097758101706,
-			-0.9400502681329097,
-			-0.9399907318200803,
-			-0.9399311668734953,
-			-0.9398715732949703,
-			-0.9398119510863199,
-			-0.9397523002493601,
-			-0.9396926207859084,
-			-0.9396329126977828,
-			-0.9395731759868017,
-			-0.9395134106547849,
-			-0.9394536167035534,
-			-0.9393937941349284,
-			-0.9393339429507319,
-			-0.9392740631527872,
-			-0.9392141547429186,
-			-0.9391542177229505,
-			-0.9390942520947092,
-			-0.9390342578600214,
-			-0.9389742350207140,
-			-0.9389141835786158,
-			-0.9388541035355564,
-			-0.9387939948933655,
-			-0.9387338576538742,
-			-0.9386736918189144,
-			-0.9386134973903187,
-			-0.9385532743699213,
-			-0.9384930227595560,
-			-0.9384327425610585,
-			-0.9383724337762651,
-			-0.9383120964070126,
-			-0.9382517304551394,
-			-0.9381913359224843,
-			-0.9381309128108867,
-			-0.9380704611221869,
-			-0.9380099808582275,
-			-0.9379494720208501,
-			-0.9378889346118976,
-			-0.9378283686332147,
-			-0.9377677740866461,
-			-0.9377071509740378,
-			-0.9376464992972356,
-			-0.9375858190580882,
-			-0.9375251102584437,
-			-0.9374643729001511,
-			-0.9374036069850605,
-			-0.9373428125150236,
-			-0.9372819894918916,
-			-0.9372211379175175,
-			-0.9371602577937553,
-			-0.9370993491224588,
-			-0.9370384119054841,
-			-0.9369774461446870,
-			-0.9369164518419248,
-			-0.9368554289990557,
-			-0.9367943776179379,
-			-0.9367332977004316,
-			-0.9366721892483977,
-			-0.9366110522636971,
-			-0.9365498867481923,
-			-0.9364886927037468,
-			-0.9364274701322242,
-			-0.9363662190354899,
-			-0.9363049394154095,
-			-0.9362436312738497,
-			-0.9361822946126779,
-			-0.9361209294337626,
-			-0.9360595357389734,
-			-0.9359981135301801,
-			-0.9359366628092537,
-			-0.9358751835780665,
-			-0.9358136758384912,
-			-0.9357521395924006,
-			-0.9356905748416703,
-			-0.9356289815881751,
-			-0.9355673598337914,
-			-0.9355057095803960,
-			-0.9354440308298675,
-			-0.9353823235840841,
-			-0.9353205878449258,
-			-0.9352588236142734,
-			-0.9351970308940077,
-			-0.9351352096860117,
-			-0.9350733599921685,
-			-0.9350114818143614,
-			-0.9349495751544764,
-			-0.9348876400143984,
-			-0.9348256763960147,
-			-0.9347636843012121,
-			-0.9347016637318797,
-			-0.9346396146899065,
-			-0.9345775371771824,
-			-0.9345154311955987,
-			-0.9344532967470471,
-			-0.9343911338334204,
-			-0.9343289424566122,
-			-0.9342667226185167,
-			-0.9342044743210296,
-			-0.9341421975660469,
-			-0.9340798923554656,
-			-0.9340175586911836,
-			-0.9339551965751001,
-			-0.9338928060091145,
-			-0.9338303869951268,
-			-0.9337679395350392,
-			-0.9337054636307538,
-			-0.9336429592841732,
-			-0.9335804264972017,
-			-0.9335178652717445,
-			-0.9334552756097070,
-			-0.9333926575129955,
-			-0.9333300109835182,
-			-0.9332673360231830,
-			-0.9332046326338985,
-			-0.9331419008175760,
-			-0.9330791405761256,
-			-0.9330163519114589,
-			-0.9329535348254890,
-			-0.9328906893201296,
-			-0.9328278153972948,
-			-0.9327649130588994,
-			-0.9327019823068605,
-			-0.9326390231430941,
-			-0.9325760355695187,
-			-0.9325130195880530,
-			-0.9324499752006160,
-			-0.9323869024091288,
-			-0.9323238012155122,
-			-0.9322606716216887,
-			-0.9321975136295815,
-			-0.9321343272411138,
-			-0.9320711124582108,
-			-0.9320078692827986,
-			-0.9319445977168030,
-			-0.9318812977621513,
-			-0.9318179694207724,
-			-0.9317546126945951,
-			-0.9316912275855490,
-			-0.9316278140955653,
-			-0.9315643722265755,
-			-0.9315009019805124,
-			-0.9314374033593089,
-			-0.9313738763649000,
-			-0.9313103209992205,
-			-0.9312467372642059,
-			-0.9311831251617940,
-			-0.9311194846939220,
-			-0.9310558158625284,
-			-0.9309921186695529,
-			-0.9309283931169359,
-			-0.9308646392066183,
-			-0.9308008569405422,
-			-0.9307370463206510,
-			-0.9306732073488877,
-			-0.9306093400271976,
-			-0.9305454443575262,
-			-0.9304815203418192,
-			-0.9304175679820247,
-			-0.9303535872800900,
-			-0.9302895782379647,
-			-0.9302255408575983,
-			-0.9301614751409415,
-			-0.9300973810899461,
-			-0.9300332587065641,
-			-0.9299691079927492,
-			-0.9299049289504554,
-			-0.9298407215816373,
-			-0.9297764858882516,
-			-0.9297122218722541,
-			-0.9296479295356032,
-			-0.9295836088802570,
-			-0.9295192599081746,
-			-0.9294548826213164,
-			-0.9293904770216438,
-			-0.9293260431111183,
-			-0.9292615808917023,
-			-0.9291970903653602,
-			-0.9291325715340564,
-			-0.9290680243997556,
-			-0.9290034489644245,
-			-0.9289388452300303,
-			-0.9288742131985406,
-			-0.9288095528719241,
-			-0.9287448642521512,
-			-0.9286801473411919,
-			-0.9286154021410172,
-			-0.9285506286536003,
-			-0.9284858268809139,
-			-0.9284209968249313,
-			-0.9283561384876282,
-			-0.9282912518709800,
-			-0.9282263369769634,
-			-0.9281613938075555,
-			-0.9280964223647350,
-			-0.9280314226504807,
-			-0.9279663946667728,
-			-0.9279013384155920,
-			-0.9278362538989200,
-			-0.9277711411187398,
-			-0.9277060000770342,
-			-0.9276408307757881,
-			-0.9275756332169866,
-			-0.9275104074026151,
-			-0.9274451533346613,
-			-0.9273798710151125,
-			-0.9273145604459577,
-			-0.9272492216291855,
-			-0.9271838545667874,
-			-0.9271184592607540,
-			-0.9270530357130771,
-			-0.9269875839257500,
-			-0.9269221039007666,
-			-0.9268565956401208,
-			-0.9267910591458089,
-			-0.9267254944198270,
-			-0.9266599014641724,
-			-0.9265942802808426,
-			-0.9265286308718373,
-			-0.9264629532391562,
-			-0.9263972473847993,
-			-0.9263315133107688,
-			-0.9262657510190669,
-			-0.9261999605116965,
-			-0.9261341417906619,
-			-0.9260682948579684,
-			-0.9260024197156215,
-			-0.9259365163656279,
-			-0.9258705848099948,
-			-0.9258046250507310,
-			-0.9257386370898459,
-			-0.9256726209293493,
-			-0.9256065765712521,
-			-0.9255405040175665,
-			-0.9254744032703046,
-			-0.9254082743314805,
-			-0.9253421172031085,
-			-0.9252759318872037,
-			-0.9252097183857823,
-			-0.9251434767008609,
-			-0.9250772068344582,
-			-0.9250109087885922,
-			-0.9249445825652823,
-			-0.9248782281665497,
-			-0.9248118455944150,
-			-0.9247454348509007,
-			-0.9246789959380296,
-			-0.9246125288578256,
-			-0.9245460336123130,
-			-0.9244795102035183,
-			-0.9244129586334673,
-			-0.9243463789041870,
-			-0.9242797710177061,
-			-0.9242131349760534,
-			-0.9241464707812586,
-			-0.9240797784353525,
-			-0.9240130579403668,
-			-0.9239463092983338,
-			-0.9238795325112870,
-			-0.9238127275812600,
-			-0.9237458945102882,
-			-0.9236790333004075,
-			-0.9236121439536543,
-			-0.9235452264720667,
-			-0.9234782808576824,
-			-0.9234113071125410,
-			-0.9233443052386830,
-			-0.9232772752381491,
-			-0.9232102171129811,
-			-0.9231431308652216,
-			-0.9230760164969142,
-			-0.9230088740101038,
-			-0.9229417034068351,
-			-0.9228745046891543,
-			-0.9228072778591089,
-			-0.9227400229187459,
-			-0.9226727398701148,
-			-0.9226054287152650,
-			-0.9225380894562467,
-			-0.9224707220951107,
-			-0.9224033266339100,
-			-0.9223359030746975,
-			-0.9222684514195265,
-			-0.9222009716704518,
-			-0.9221334638295294,
-			-0.9220659278988153,
-			-0.9219983638803669,
-			-0.9219307717762425,
-			-0.9218631515885007,
-			-0.9217955033192016,
-			-0.9217278269704055,
-			-0.9216601225441746,
-			-0.9215923900425708,
-			-0.9215246294676572,
-			-0.9214568408214987,
-			-0.9213890241061593,
-			-0.9213211793237054,
-			-0.9212533064762035,
-			-0.9211854055657213,
-			-0.9211174765943271,
-			-0.9210495195640898,
-			-0.9209815344770798,
-			-0.9209135213353681,
-			-0.9208454801410263,
-			-0.9207774108961271,
-			-0.9207093136027443,
-			-0.9206411882629519,
-			-0.9205730348788251,
-			-0.9205048534524404,
-			-0.9204366439858744,
-			-0.9203684064812045,
-			-0.9203001409405103,
-			-0.9202318473658705,
-			-0.9201635257593657,
-			-0.9200951761230768,
-			-0.9200267984590865,
-			-0.9199583927694773,
-			-0.9198899590563325,
-			-0.9198214973217378,
-			-0.9197530075677779,
-			-0.9196844897965391,
-			-0.9196159440101086,
-			-0.9195473702105750,
-			-0.9194787684000264,
-			-0.9194101385805529,
-			-0.9193414807542453,
-			-0.9192727949231945,
-			-0.9192040810894931,
-			-0.9191353392552346,
-			-0.9190665694225122,
-			-0.9189977715934216,
-			-0.9189289457700576,
-			-0.9188600919545175,
-			-0.9187912101488985,
-			-0.9187223003552984,
-			-0.9186533625758169,
-			-0.9185843968125541,
-			-0.9185154030676103,
-			-0.9184463813430874,
-			-0.9183773316410876,
-			-0.9183082539637150,
-			-0.9182391483130729,
-			-0.9181700146912670,
-			-0.9181008531004035,
-			-0.9180316635425882,
-			-0.9179624460199294,
-			-0.9178932005345358,
-			-0.9178239270885165,
-			-0.9177546256839810,
-			-0.9176852963230416,
-			-0.9176159390078095,
-			-0.9175465537403972,
-			-0.9174771405229187,
-			-0.9174076993574883,
-			-0.9173382302462215,
-			-0.9172687331912340,
-			-0.9171992081946435,
-			-0.9171296552585673,
-			-0.9170600743851240,
-			-0.9169904655764338,
-			-0.9169208288346163,
-			-0.9168511641617936,
-			-0.9167814715600870,
-			-0.9167117510316202,
-			-0.9166420025785165,
-			-0.9165722262029004,
-			-0.9165024219068981,
-			-0.9164325896926353,
-			-0.9163627295622396,
-			-0.9162928415178392,
-			-0.9162229255615623,
-			-0.9161529816955395,
-			-0.9160830099219006,
-			-0.9160130102427778,
-			-0.9159429826603033,
-			-0.9158729271766096,
-			-0.9158028437938314,
-			-0.9157327325141034,
-			-0.9156625933395612,
-			-0.9155924262723412,
-			-0.9155222313145813,
-			-0.9154520084684196,
-			-0.9153817577359947,
-			-0.9153114791194472,
-			-0.9152411726209179,
-			-0.9151708382425476,
-			-0.9151004759864797,
-			-0.9150300858548576,
-			-0.9149596678498251,
-			-0.9148892219735268,
-			-0.9148187482281097,
-			-0.9147482466157201,
-			-0.9146777171385051,
-			-0.9146071597986137,
-			-0.9145365745981950,
-			-0.9144659615393993,
-			-0.9143953206243773,
-			-0.9143246518552814,
-			-0.9142539552342639,
-			-0.9141832307634781,
-			-0.9141124784450789,
-			-0.9140416982812212,
-			-0.9139708902740613,
-			-0.9139000544257561,
-			-0.9138291907384629,
-			-0.9137582992143413,
-			-0.9136873798555498,
-			-0.9136164326642493,
-			-0.9135454576426011,
-			-0.9134744547927667,
-			-0.9134034241169089,
-			-0.9133323656171922,
-			-0.9132612792957808,
-			-0.9131901651548396,
-			-0.9131190231965356,
-			-0.9130478534230356,
-			-0.9129766558365073,
-			-0.9129054304391199,
-			-0.9128341772330428,
-			-0.9127628962204469,
-			-0.9126915874035026,
-			-0.9126202507843834,
-			-0.9125488863652615,
-			-0.9124774941483108,
-			-0.9124060741357062,
-			-0.9123346263296235,
-			-0.9122631507322385,
-			-0.9121916473457289,
-			-0.9121201161722731,
-			-0.9120485572140495,
-			-0.9119769704732381,
-			-0.9119053559520198,
-			-0.9118337136525757,
-			-0.9117620435770887,
-			-0.9116903457277414,
-			-0.9116186201067179,
-			-0.9115468667162038,
-			-0.9114750855583837,
-			-0.9114032766354454,
-			-0.9113314399495754,
-			-0.9112595755029625,
-			-0.9111876832977953,
-			-0.9111157633362640,
-			-0.9110438156205598,
-			-0.9109718401528739,
-			-0.9108998369353988,
-			-0.9108278059703283,
-			-0.9107557472598559,
-			-0.9106836608061771,
-			-0.9106115466114879,
-			-0.9105394046779847,
-			-0.9104672350078646,
-			-0.9103950376033273,
-			-0.9103228124665712,
-			-0.9102505595997965,
-			-0.9101782790052039,
-			-0.9101059706849959,
-			-0.9100336346413743,
-			-0.9099612708765432,
-			-0.9098888793927068,
-			-0.9098164601920701,
-			-0.9097440132768391,
-			-0.9096715386492211,
-			-0.9095990363114235,
-			-0.9095265062656545,
-			-0.9094539485141239,
-			-0.9093813630590420,
-			-0.9093087499026195,
-			-0.9092361090470686,
-			-0.9091634404946021,
-			-0.9090907442474335,
-			-0.9090180203077775,
-			-0.9089452686778488,
-			-0.9088724893598641,
-			-0.9087996823560403,
-			-0.9087268476685949,
-			-0.9086539852997468,
-			-0.9085810952517159,
-			-0.9085081775267217,
-			-0.9084352321269862,
-			-0.9083622590547312,
-			-0.9082892583121795,
-			-0.9082162299015545,
-			-0.9081431738250813,
-			-0.9080700900849853,
-			-0.9079969786834925,
-			-0.9079238396228297,
-			-0.9078506729052258,
-			-0.9077774785329087,
-			-0.9077042565081084,
-			-0.9076310068330555,
-			-0.9075577295099809,
-			-0.9074844245411168,
-			-0.9074110919286967,
-			-0.9073377316749544,
-			-0.9072643437821238,
-			-0.9071909282524410,
-			-0.9071174850881425,
-			-0.9070440142914650,
-			-0.9069705158646469,
-			-0.9068969898099274,
-			-0.9068234361295454,
-			-0.9067498548257423,
-			-0.9066762459007589,
-			-0.9066026093568378,
-			-0.9065289451962222,
-			-0.9064552534211554,
-			-0.9063815340338828,
-			-0.9063077870366500,
-			-0.9062340124317033,
-			-0.9061602102212898,
-			-0.9060863804076581,
-			-0.9060125229930570,
-			-0.9059386379797360,
-			-0.9058647253699461,
-			-0.9057907851659388,
-			-0.9057168173699663,
-			-0.9056428219842818,
-			-0.9055687990111397,
-			-0.9054947484527944,
-			-0.9054206703115016,
-			-0.9053465645895185,
-			-0.9052724312891018,
-			-0.9051982704125096,
-			-0.9051240819620016,
-			-0.9050498659398376,
-			-0.9049756223482780,
-			-0.9049013511895844,
-			-0.9048270524660197,
-			-0.9047527261798465,
-			-0.9046783723333295,
-			-0.9046039909287337,
-			-0.9045295819683241,
-			-0.9044551454543682,
-			-0.9043806813891327,
-			-0.9043061897748866,
-			-0.9042316706138989,
-			-0.9041571239084391,
-			-0.9040825496607786,
-			-0.9040079478731885,
-			-0.9039333185479418,
-			-0.9038586616873119,
-			-0.9037839772935723,
-			-0.9037092653689989,
-			-0.9036345259158666,
-			-0.9035597589364528,
-			-0.9034849644330351,
-			-0.9034101424078912,
-			-0.9033352928633007,
-			-0.9032604158015440,
-			-0.9031855112249015,
-			-0.9031105791356550,
-			-0.9030356195360872,
-			-0.9029606324284817,
-			-0.9028856178151218,
-			-0.9028105756982938,
-			-0.9027355060802830,
-			-0.9026604089633761,
-			-0.9025852843498605,
-			-0.9025101322420255,
-			-0.9024349526421594,
-			-0.9023597455525527,
-			-0.9022845109754966,
-			-0.9022092489132826,
-			-0.9021339593682030,
-			-0.9020586423425517,
-			-0.9019832978386229,
-			-0.9019079258587116,
-			-0.9018325264051138,
-			-0.9017570994801266,
-			-0.9016816450860472,
-			-0.9016061632251742,
-			-0.9015306538998071,
-			-0.9014551171122457,
-			-0.9013795528647915,
-			-0.9013039611597456,
-			-0.9012283419994114,
-			-0.9011526953860921,
-			-0.9010770213220917,
-			-0.9010013198097157,
-			-0.9009255908512701,
-			-0.9008498344490616,
-			-0.9007740506053979,
-			-0.9006982393225880,
-			-0.9006224006029406,
-			-0.9005465344487656,
-			-0.9004706408623750,
-			-0.9003947198460803,
-			-0.9003187714021936,
-			-0.9002427955330288,
-			-0.9001667922409008,
-			-0.9000907615281242,
-			-0.9000147033970146,
-			-0.8999386178498899,
-			-0.8998625048890674,
-			-0.8997863645168651,
-			-0.8997101967356030,
-			-0.8996340015476013,
-			-0.8995577789551804,
-			-0.8994815289606627,
-			-0.8994052515663712,
-			-0.8993289467746288,
-			-0.8992526145877600,
-			-0.8991762550080905,
-			-0.8990998680379456,
-			-0.8990234536796530,
-			-0.8989470119355398,
-			-0.8988705428079345,
-			-0.8987940462991671,
-			-0.8987175224115671,
-			-0.8986409711474661,
-			-0.8985643925091960,
-			-0.8984877864990888,
-			-0.8984111531194791,
-			-0.8983344923727001,
-			-0.8982578042610883,
-			-0.8981810887869787,
-			-0.8981043459527085,
-			-0.8980275757606159,
-			-0.8979507782130386,
-			-0.8978739533123167,
-			-0.8977971010607902,
-			-0.8977202214608003,
-			-0.8976433145146882,
-			-0.8975663802247976,
-			-0.8974894185934716,
-			-0.8974124296230542,
-			-0.8973354133158913,
-			-0.8972583696743287,
-			-0.8971812987007128,
-			-0.8971042003973920,
-			-0.8970270747667147,
-			-0.8969499218110301,
-			-0.8968727415326883,
-			-0.8967955339340408,
-			-0.8967182990174390,
-			-0.8966410367852360,
-			-0.8965637472397850,
-			-0.8964864303834409,
-			-0.8964090862185580,
-			-0.8963317147474928,
-			-0.8962543159726029,
-			-0.8961768898962450,
-			-0.8960994365207777,
-			-0.8960219558485611,
-			-0.8959444478819547,
-			-0.8958669126233201,
-			-0.8957893500750185,
-			-0.8957117602394128,
-			-0.8956341431188670,
-			-0.8955564987157448,
-			-0.8954788270324119,
-			-0.8954011280712342,
-			-0.8953234018345781,
-			-0.8952456483248115,
-			-0.8951678675443034,
-			-0.8950900594954229,
-			-0.8950122241805397,
-			-0.8949343616020251,
-			-0.8948564717622512,
-			-0.8947785546635901,
-			-0.8947006103084159,
-			-0.8946226386991026,
-			-0.8945446398380253,
-			-0.8944666137275598,
-			-0.8943885603700835,
-			-0.8943104797679738,
-			-0.8942323719236090,
-			-0.8941542368393682,
-			-0.8940760745176323,
-			-0.8939978849607813,
-			-0.8939196681711977,
-			-0.8938414241512639,
-			-0.8937631529033633,
-			-0.8936848544298800,
-			-0.8936065287331998,
-			-0.8935281758157079,
-			-0.8934497956797913,
-			-0.8933713883278377,
-			-0.8932929537622352,
-			-0.8932144919853736,
-			-0.8931360029996427,
-			-0.8930574868074330,
-			-0.8929789434111371,
-			-0.8929003728131472,
-			-0.8928217750158559,
-			-0.8927431500216585,
-			-0.8926644978329500,
-			-0.8925858184521256,
-			-0.8925071118815823,
-			-0.8924283781237181,
-			-0.8923496171809305,
-			-0.8922708290556195,
-			-0.8921920137501849,
-			-0.8921131712670275,
-			-0.8920343016085482,
-			-0.8919554047771509,
-			-0.8918764807752383,
-			-0.8917975296052143,
-			-0.8917185512694840,
-			-0.8916395457704537,
-			-0.8915605131105293,
-			-0.8914814532921188,
-			-0.8914023663176307,
-			-0.8913232521894733,
-			-0.8912441109100571,
-			-0.8911649424817931,
-			-0.8910857469070925,
-			-0.8910065241883681,
-			-0.8909272743280325,
-			-0.8908479973285003,
-			-0.8907686931921865,
-			-0.8906893619215067,
-			-0.8906100035188776,
-			-0.8905306179867160,
-			-0.8904512053274409,
-			-0.8903717655434708,
-			-0.8902922986372258,
-			-0.8902128046111266,
-			-0.8901332834675948,
-			-0.8900537352090524,
-			-0.8899741598379233,
-			-0.8898945573566307,
-			-0.8898149277675997,
-			-0.8897352710732563,
-			-0.8896555872760269,
-			-0.8895758763783379,
-			-0.8894961383826188,
-			-0.8894163732912976,
-			-0.8893365811068046,
-			-0.8892567618315699,
-			-0.8891769154680256,
-			-0.8890970420186034,
-			-0.8890171414857364,
-			-0.8889372138718591,
-			-0.8888572591794054,
-			-0.8887772774108115,
-			-0.8886972685685136,
-			-0.8886172326549491,
-			-0.8885371696725555,
-			-0.8884570796237717,
-			-0.8883769625110383,
-			-0.8882968183367946,
-			-0.8882166471034827,
-			-0.8881364488135448,
-			-0.8880562234694231,
-			-0.8879759710735624,
-			-0.8878956916284065,
-			-0.8878153851364013,
-			-0.8877350515999933,
-			-0.8876546910216289,
-			-0.8875743034037563,
-			-0.8874938887488248,
-			-0.8874134470592833,
-			-0.8873329783375823,
-			-0.8872524825861734,
-			-0.8871719598075084,
-			-0.8870914100040396,
-			-0.8870108331782218,
-			-0.8869302293325090,
-			-0.8868495984693560,
-			-0.8867689405912194,
-			-0.8866882557005566,
-			-0.8866075437998249,
-			-0.8865268048914827,
-			-0.8864460389779902,
-			-0.8863652460618074,
-			-0.8862844261453946,
-			-0.8862035792312148,
-			-0.8861227053217303,
-			-0.8860418044194045,
-			-0.8859608765267019,
-			-0.8858799216460880,
-			-0.8857989397800284,
-			-0.8857179309309899,
-			-0.8856368951014409,
-			-0.8855558322938489,
-			-0.8854747425106841,
-			-0.8853936257544160,
-			-0.8853124820275157,
-			-0.8852313113324555,
-			-0.8851501136717070,
-			-0.8850688890477445,
-			-0.8849876374630419,
-			-0.8849063589200743,
-			-0.8848250534213175,
-			-0.8847437209692485,
-			-0.8846623615663447,
-			-0.8845809752150841,
-			-0.8844995619179461,
-			-0.8844181216774111,
-			-0.8843366544959591,
-			-0.8842551603760724,
-			-0.8841736393202332,
-			-0.8840920913309248,
-			-0.8840105164106311,
-			-0.8839289145618376,
-			-0.8838472857870298,
-			-0.8837656300886934,
-			-0.8836839474693170,
-			-0.8836022379313884,
-			-0.8835205014773959,
-			-0.8834387381098300,
-			-0.8833569478311817,
-			-0.8832751306439419,
-			-0.8831932865506027,
-			-0.8831114155536581,
-			-0.8830295176556010,
-			-0.8829475928589269,
-			-0.8828656411661313,
-			-0.8827836625797100,
-			-0.8827016571021610,
-			-0.8826196247359815,
-			-0.8825375654836713,
-			-0.8824554793477293,
-			-0.8823733663306561,
-			-0.8822912264349535,
-			-0.8822090596631229,
-			-0.8821268660176680,
-			-0.8820446455010920,
-			-0.8819623981158995,
-			-0.8818801238645964,
-			-0.8817978227496882,
-			-0.8817154947736825,
-			-0.8816331399390872,
-			-0.8815507582484102,
-			-0.8814683497041618,
-			-0.8813859143088523,
-			-0.8813034520649925,
-			-0.8812209629750938,
-			-0.8811384470416702,
-			-0.8810559042672348,
-			-0.8809733346543013,
-			-0.8808907382053857,
-			-0.8808081149230037,
-			-0.8807254648096723,
-			-0.8806427878679088,
-			-0.8805600841002326,
-			-0.8804773535091622,
-			-0.8803945960972175,
-			-0.8803118118669203,
-			-0.8802290008207919,
-			-0.8801461629613545,
-			-0.8800632982911321,
-			-0.8799804068126486,
-			-0.8798974885284290,
-			-0.8798145434409991,
-			-0.8797315715528861,
-			-0.8796485728666165,
-			-0.8795655473847195,
-			-0.8794824951097236,
-			-0.8793994160441588,
-			-0.8793163101905564,
-			-0.8792331775514471,
-			-0.8791500181293638,
-			-0.8790668319268399,
-			-0.8789836189464084,
-			-0.8789003791906052,
-			-0.8788171126619654,
-			-0.8787338193630257,
-			-0.8786504992963227,
-			-0.8785671524643954,
-			-0.8784837788697825,
-			-0.8784003785150228,
-			-0.8783169514026579,
-			-0.8782334975352287,
-			-0.8781500169152774,
-			-0.8780665095453464,
-			-0.8779829754279806,
-			-0.8778994145657241,
-			-0.8778158269611215,
-			-0.8777322126167204,
-			-0.8776485715350673,
-			-0.8775649037187093,
-			-0.8774812091701961,
-			-0.8773974878920769,
-			-0.8773137398869015,
-			-0.8772299651572214,
-			-0.8771461637055888,
-			-0.8770623355345561,
-			-0.8769784806466768,
-			-0.8768945990445055,
-			-0.8768106907305969,
-			-0.8767267557075078,
-			-0.8766427939777944,
-			-0.8765588055440142,
-			-0.8764747904087263,
-			-0.8763907485744893,
-			-0.8763066800438637,
-			-0.8762225848194101,
-			-0.8761384629036902,
-			-0.8760543142992667,
-			-0.8759701390087025,
-			-0.8758859370345624,
-			-0.8758017083794108,
-			-0.8757174530458134,
-			-0.8756331710363373,
-			-0.8755488623535497,
-			-0.8754645270000179,
-			-0.8753801649783121,
-			-0.8752957762910017,
-			-0.8752113609406568,
-			-0.8751269189298500,
-			-0.8750424502611527,
-			-0.8749579549371377,
-			-0.8748734329603797,
-			-0.8747888843334530,
-			-0.8747043090589328,
-			-0.8746197071393959,
-			-0.8745350785774191,
-			-0.8744504233755805,
-			-0.8743657415364591,
-			-0.8742810330626337,
-			-0.8741962979566855,
-			-0.8741115362211949,
-			-0.8740267478587445,
-			-0.8739419328719171,
-			-0.8738570912632957,
-			-0.8737722230354651,
-			-0.8736873281910110,
-			-0.8736024067325188,
-			-0.8735174586625758,
-			-0.8734324839837689,
-			-0.8733474826986872,
-			-0.8732624548099203,
-			-0.8731774003200576,
-			-0.8730923192316902,
-			-0.8730072115474103,
-			-0.8729220772698101,
-			-0.8728369164014821,
-			-0.8727517289450220,
-			-0.8726665149030237,
-			-0.8725812742780829,
-			-0.8724960070727971,
-			-0.8724107132897632,
-			-0.8723253929315790,
-			-0.8722400460008437,
-			-0.8721546725001577,
-			-0.8720692724321210,
-			-0.8719838457993347,
-			-0.8718983926044022,
-			-0.8718129128499256,
-			-0.8717274065385091,
-			-0.8716418736727571,
-			-0.8715563142552758,
-			-0.8714707282886706,
-			-0.8713851157755491,
-			-0.8712994767185194,
-			-0.8712138111201895,
-			-0.8711281189831696,
-			-0.8710424003100696,
-			-0.8709566551035010,
-			-0.8708708833660757,
-			-0.8707850851004059,
-			-0.8706992603091057,
-			-0.8706134089947895,
-			-0.8705275311600723,
-			-0.8704416268075699,
-			-0.8703556959398998,
-			-0.8702697385596788,
-			-0.8701837546695256,
-			-0.8700977442720598,
-			-0.8700117073699010,
-			-0.8699256439656697,
-			-0.8698395540619881,
-			-0.8697534376614788,
-			-0.8696672947667646,
-			-0.8695811253804696,
-			-0.8694949295052191,
-			-0.8694087071436386,
-			-0.8693224582983538,
-			-0.8692361829719931,
-			-0.8691498811671843,
-			-0.8690635528865557,
-			-0.8689771981327374,
-			-0.8688908169083605,
-			-0.8688044092160555,
-			-0.8687179750584546,
-			-0.8686315144381914,
-			-0.8685450273578988,
-			-0.8684585138202120,
-			-0.8683719738277662,
-			-0.8682854073831971,
-			-0.8681988144891425,
-			-0.8681121951482392,
-			-0.8680255493631265,
-			-0.8679388771364438,
-			-0.8678521784708305,
-			-0.8677654533689287,
-			-0.8676787018333791,
-			-0.8675919238668252,
-			-0.8675051194719100,
-			-0.8674182886512775,
-			-0.8673314314075734,
-			-0.8672445477434426,
-			-0.8671576376615324,
-			-0.8670707011644901,
-			-0.8669837382549639,
-			-0.8668967489356026,
-			-0.8668097332090567,
-			-0.8667226910779765,
-			-0.8666356225450127,
-			-0.8665485276128190,
-			-0.8664614062840476,
-			-0.8663742585613520,
-			-0.8662870844473876,
-			-0.8661998839448096,
-			-0.8661126570562743,
-			-0.8660254037844386,
-			-0.8659381241319609,
-			-0.8658508181014993,
-			-0.8657634856957136,
-			-0.8656761269172644,
-			-0.8655887417688124,
-			-0.8655013302530191,
-			-0.8654138923725477,
-			-0.8653264281300621,
-			-0.8652389375282260,
-			-0.8651514205697045,
-			-0.8650638772571640,
-			-0.8649763075932707,
-			-0.8648887115806925,
-			-0.8648010892220978,
-			-0.8647134405201551,
-			-0.8646257654775351,
-			-0.8645380640969079,
-			-0.8644503363809455,
-			-0.8643625823323203,
-			-0.8642748019537048,
-			-0.8641869952477732,
-			-0.8640991622172010,
-			-0.8640113028646631,
-			-0.8639234171928352,
-			-0.8638355052043958,
-			-0.8637475669020221,
-			-0.8636596022883927,
-			-0.8635716113661875,
-			-0.8634835941380871,
-			-0.8633955506067718,
-			-0.8633074807749240,
-			-0.8632193846452271,
-			-0.8631312622203641,
-			-0.8630431135030187,
-			-0.8629549384958772,
-			-0.8628667372016253,
-			-0.8627785096229491,
-			-0.8626902557625368,
-			-0.8626019756230766,
-			-0.8625136692072576,
-			-0.8624253365177696,
-			-0.8623369775573041,
-			-0.8622485923285519,
-			-0.8621601808342054,
-			-0.8620717430769586,
-			-0.8619832790595041,
-			-0.8618947887845381,
-			-0.8618062722547553,
-			-0.8617177294728519,
-			-0.8616291604415259,
-			-0.8615405651634744,
-			-0.8614519436413968,
-			-0.8613632958779924,
-			-0.8612746218759619,
-			-0.8611859216380059,
-			-0.8610971951668264,
-			-0.8610084424651268,
-			-0.8609196635356098,
-			-0.8608308583809805,
-			-0.8607420270039439,
-			-0.8606531694072054,
-			-0.8605642855934724,
-			-0.8604753755654524,
-			-0.8603864393258537,
-			-0.8602974768773847,
-			-0.8602084882227566,
-			-0.8601194733646796,
-			-0.8600304323058647,
-			-0.8599413650490251,
-			-0.8598522715968737,
-			-0.8597631519521239,
-			-0.8596740061174909,
-			-0.8595848340956906,
-			-0.8594956358894389,
-			-0.8594064115014526,
-			-0.8593171609344504,
-			-0.8592278841911503,
-			-0.8591385812742726,
-			-0.8590492521865368,
-			-0.8589598969306648,
-			-0.8588705155093775,
-			-0.8587811079253984,
-			-0.8586916741814512,
-			-0.8586022142802596,
-			-0.8585127282245490,
-			-0.8584232160170453,
-			-0.8583336776604749,
-			-0.8582441131575660,
-			-0.8581545225110461,
-			-0.8580649057236445,
-			-0.8579752627980917,
-			-0.8578855937371174,
-			-0.8577958985434537,
-			-0.8577061772198330,
-			-0.8576164297689879,
-			-0.8575266561936520,
-			-0.8574368564965612,
-			-0.8573470306804500,
-			-0.8572571787480545,
-			-0.8571673007021123,
-			-0.8570773965453612,
-			-0.8569874662805392,
-			-0.8568975099103865,
-			-0.8568075274376430,
-			-0.8567175188650499,
-			-0.8566274841953482,
-			-0.8565374234312819,
-			-0.8564473365755936,
-			-0.8563572236310272,
-			-0.8562670846003283,
-			-0.8561769194862426,
-			-0.8560867282915162,
-			-0.8559965110188971,
-			-0.8559062676711331,
-			-0.8558159982509733,
-			-0.8557257027611678,
-			-0.8556353812044662,
-			-0.8555450335836206,
-			-0.8554546599013833,
-			-0.8553642601605068,
-			-0.8552738343637447,
-			-0.8551833825138523,
-			-0.8550929046135839,
-			-0.8550024006656964,
-			-0.8549118706729467,
-			-0.8548213146380923,
-			-0.8547307325638909,
-			-0.8546401244531030,
-			-0.8545494903084884,
-			-0.8544588301328077,
-			-0.8543681439288222,
-			-0.8542774316992954,
-			-0.8541866934469895,
-			-0.8540959291746691,
-			-0.8540051388850993,
-			-0.8539143225810452,
-			-0.8538234802652729,
-			-0.8537326119405507,
-			-0.8536417176096461,
-			-0.8535507972753277,
-			-0.8534598509403648,
-			-0.8533688786075287,
-			-0.8532778802795897,
-			-0.8531868559593204,
-			-0.8530958056494934,
-			-0.8530047293528817,
-			-0.8529136270722607,
-			-0.8528224988104043,
-			-0.8527313445700894,
-			-0.8526401643540923,
-			-0.8525489581651906,
-			-0.8524577260061623,
-			-0.8523664678797873,
-			-0.8522751837888447,
-			-0.8521838737361155,
-			-0.8520925377243810,
-			-0.8520011757564238,
-			-0.8519097878350261,
-			-0.8518183739629727,
-			-0.8517269341430478,
-			-0.8516354683780368,
-			-0.8515439766707258,
-			-0.8514524590239024,
-			-0.8513609154403535,
-			-0.8512693459228684,
-			-0.8511777504742364,
-			-0.8510861290972475,
-			-0.8509944817946918,
-			-0.8509028085693624,
-			-0.8508111094240515,
-			-0.8507193843615518,
-			-0.8506276333846576,
-			-0.8505358564961646,
-			-0.8504440536988672,
-			-0.8503522249955628,
-			-0.8502603703890488,
-			-0.8501684898821222,
-			-0.8500765834775831,
-			-0.8499846511782299,
-			-0.8498926929868642,
-			-0.8498007089062863,
-			-0.8497086989392985,
-			-0.8496166630887039,
-			-0.8495246013573055,
-			-0.8494325137479080,
-			-0.8493404002633168,
-			-0.8492482609063371,
-			-0.8491560956797766,
-			-0.8490639045864417,
-			-0.8489716876291415,
-			-0.8488794448106852,
-			-0.8487871761338819,
-			-0.8486948816015426,
-			-0.8486025612164794,
-			-0.8485102149815038,
-			-0.8484178428994287,
-			-0.8483254449730688,
-			-0.8482330212052381,
-			-0.8481405715987513,
-			-0.8480480961564261,
-			-0.8479555948810784,
-			-0.8478630677755262,
-			-0.8477705148425879,
-			-0.8476779360850834,
-			-0.8475853315058324,
-			-0.8474927011076551,
-			-0.8474000448933745,
-			-0.8473073628658125,
-			-0.8472146550277919,
-			-0.8471219213821374,
-			-0.8470291619316734,
-			-0.8469363766792258,
-			-0.8468435656276206,
-			-0.8467507287796858,
-			-0.8466578661382484,
-			-0.8465649777061378,
-			-0.8464720634861835,
-			-0.8463791234812154,
-			-0.8462861576940651,
-			-0.8461931661275640,
-			-0.8461001487845453,
-			-0.8460071056678424,
-			-0.8459140367802890,
-			-0.8458209421247208,
-			-0.8457278217039733,
-			-0.8456346755208832,
-			-0.8455415035782876,
-			-0.8454483058790254,
-			-0.8453550824259353,
-			-0.8452618332218562,
-			-0.8451685582696296,
-			-0.8450752575720968,
-			-0.8449819311320991,
-			-0.8448885789524798,
-			-0.8447952010360833,
-			-0.8447017973857534,
-			-0.8446083680043346,
-			-0.8445149128946744,
-			-0.8444214320596189,
-			-0.8443279255020152,
-			-0.8442343932247124,
-			-0.8441408352305597,
-			-0.8440472515224062,
-			-0.8439536421031032,
-			-0.8438600069755027,
-			-0.8437663461424562,
-			-0.8436726596068167,
-			-0.8435789473714389,
-			-0.8434852094391766,
-			-0.8433914458128858,
-			-0.8432976564954224,
-			-0.8432038414896432,
-			-0.8431100007984066,
-			-0.8430161344245704,
-			-0.8429222423709947,
-			-0.8428283246405389,
-			-0.8427343812360640,
-			-0.8426404121604325,
-			-0.8425464174165056,
-			-0.8424523970071478,
-			-0.8423583509352219,
-			-0.8422642792035937,
-			-0.8421701818151286,
-			-0.8420760587726923,
-			-0.8419819100791528,
-			-0.8418877357373775,
-			-0.8417935357502355,
-			-0.8416993101205955,
-			-0.8416050588513290,
-			-0.8415107819453065,
-			-0.8414164794053992,
-			-0.8413221512344805,
-			-0.8412277974354238,
-			-0.8411334180111026,
-			-0.8410390129643925,
-			-0.8409445822981692,
-			-0.8408501260153090,
-			-0.8407556441186890,
-			-0.8406611366111881,
-			-0.8405666034956846,
-			-0.8404720447750578,
-			-0.8403774604521886,
-			-0.8402828505299584,
-			-0.8401882150112484,
-			-0.8400935538989418,
-			-0.8399988671959226,
-			-0.8399041549050748,
-			-0.8398094170292828,
-			-0.8397146535714337,
-			-0.8396198645344132,
-			-0.8395250499211094,
-			-0.8394302097344101,
-			-0.8393353439772040,
-			-0.8392404526523819,
-			-0.8391455357628332,
-			-0.8390505933114500,
-			-0.8389556253011246,
-			-0.8388606317347490,
-			-0.8387656126152170,
-			-0.8386705679454241,
-			-0.8385754977282647,
-			-0.8384804019666348,
-			-0.8383852806634310,
-			-0.8382901338215517,
-			-0.8381949614438943,
-			-0.8380997635333584,
-			-0.8380045400928441,
-			-0.8379092911252516,
-			-0.8378140166334820,
-			-0.8377187166204388,
-			-0.8376233910890243,
-			-0.8375280400421418,
-			-0.8374326634826965,
-			-0.8373372614135938,
-			-0.8372418338377391,
-			-0.8371463807580399,
-			-0.8370509021774037,
-			-0.8369553980987391,
-			-0.8368598685249549,
-			-0.8367643134589619,
-			-0.8366687329036699,
-			-0.8365731268619911,
-			-0.8364774953368376,
-			-0.8363818383311222,
-			-0.8362861558477597,
-			-0.8361904478896636,
-			-0.8360947144597501,
-			-0.8359989555609356,
-			-0.8359031711961366,
-			-0.8358073613682704,
-			-0.8357115260802561,
-			-0.8356156653350136,
-			-0.8355197791354620,
-			-0.8354238674845224,
-			-0.8353279303851170,
-			-0.8352319678401673,
-			-0.8351359798525971,
-			-0.8350399664253306,
-			-0.8349439275612922,
-			-0.8348478632634065,
-			-0.8347517735346013,
-			-0.8346556583778032,
-			-0.8345595177959396,
-			-0.8344633517919391,
-			-0.8343671603687319,
-			-0.8342709435292471,
-			-0.8341747012764164,
-			-0.8340784336131715,
-			-0.8339821405424441,
-			-0.8338858220671680,
-			-0.8337894781902777,
-			-0.8336931089147073,
-			-0.8335967142433928,
-			-0.8335002941792699,
-			-0.8334038487252766,
-			-0.8333073778843498,
-			-0.8332108816594291,
-			-0.8331143600534536,
-			-0.8330178130693634,
-			-0.8329212407100999,
-			-0.8328246429786039,
-			-0.8327280198778190,
-			-0.8326313714106880,
-			-0.8325346975801551,
-			-0.8324379983891648,
-			-0.8323412738406636,
-			-0.8322445239375971,
-			-0.8321477486829124,
-			-0.8320509480795583,
-			-0.8319541221304829,
-			-0.8318572708386351,
-			-0.8317603942069666,
-			-0.8316634922384273,
-			-0.8315665649359694,
-			-0.8314696123025452,
-			-0.8313726343411088,
-			-0.8312756310546132,
-			-0.8311786024460142,
-			-0.8310815485182672,
-			-0.8309844692743288,
-			-0.8308873647171551,
-			-0.8307902348497055,
-			-0.8306930796749384,
-			-0.8305958991958129,
-			-0.8304986934152893,
-			-0.8304014623363292,
-			-0.8303042059618937,
-			-0.8302069242949459,
-			-0.8301096173384495,
-			-0.8300122850953675,
-			-0.8299149275686661,
-			-0.8298175447613099,
-			-0.8297201366762660,
-			-0.8296227033165017,
-			-0.8295252446849842,
-			-0.8294277607846828,
-			-0.8293302516185677,
-			-0.8292327171896081,
-			-0.8291351575007753,
-			-0.8290375725550418,
-			-0.8289399623553798,
-			-0.8288423269047618,
-			-0.8287446662061635,
-			-0.8286469802625591,
-			-0.8285492690769238,
-			-0.8284515326522345,
-			-0.8283537709914689,
-			-0.8282559840976043,
-			-0.8281581719736194,
-			-0.8280603346224946,
-			-0.8279624720472095,
-			-0.8278645842507446,
-			-0.8277666712360832,
-			-0.8276687330062067,
-			-0.8275707695640989,
-			-0.8274727809127438,
-			-0.8273747670551268,
-			-0.8272767279942330,
-			-0.8271786637330488,
-			-0.8270805742745621,
-			-0.8269824596217599,
-			-0.8268843197776320,
-			-0.8267861547451668,
-			-0.8266879645273554,
-			-0.8265897491271889,
-			-0.8264915085476583,
-			-0.8263932427917569,
-			-0.8262949518624778,
-			-0.8261966357628152,
-			-0.8260982944957642,
-			-0.8259999280643197,
-			-0.8259015364714789,
-			-0.8258031197202382,
-			-0.8257046778135964,
-			-0.8256062107545520,
-			-0.8255077185461038,
-			-0.8254092011912527,
-			-0.8253106586929997,
-			-0.8252120910543463,
-			-0.8251134982782949,
-			-0.8250148803678498,
-			-0.8249162373260142,
-			-0.8248175691557923,
-			-0.8247188758601912,
-			-0.8246201574422167,
-			-0.8245214139048752,
-			-0.8244226452511753,
-			-0.8243238514841260,
-			-0.8242250326067360,
-			-0.8241261886220156,
-			-0.8240273195329764,
-			-0.8239284253426292,
-			-0.8238295060539874,
-			-0.8237305616700636,
-			-0.8236315921938722,
-			-0.8235325976284277,
-			-0.8234335779767454,
-			-0.8233345332418426,
-			-0.8232354634267355,
-			-0.8231363685344418,
-			-0.8230372485679811,
-			-0.8229381035303717,
-			-0.8228389334246347,
-			-0.8227397382537901,
-			-0.8226405180208598,
-			-0.8225412727288669,
-			-0.8224420023808334,
-			-0.8223427069797843,
-			-0.8222433865287441,
-			-0.8221440410307375,
-			-0.8220446704887914,
-			-0.8219452749059332,
-			-0.8218458542851901,
-			-0.8217464086295900,
-			-0.8216469379421637,
-			-0.8215474422259404,
-			-0.8214479214839505,
-			-0.8213483757192263,
-			-0.8212488049347998,
-			-0.8211492091337044,
-			-0.8210495883189730,
-			-0.8209499424936417,
-			-0.8208502716607452,
-			-0.8207505758233190,
-			-0.8206508549844009,
-			-0.8205511091470284,
-			-0.8204513383142394,
-			-0.8203515424890735,
-			-0.8202517216745712,
-			-0.8201518758737723,
-			-0.8200520050897184,
-			-0.8199521093254525,
-			-0.8198521885840165,
-			-0.8197522428684554,
-			-0.8196522721818127,
-			-0.8195522765271338,
-			-0.8194522559074655,
-			-0.8193522103258535,
-			-0.8192521397853463,
-			-0.8191520442889920,
-			-0.8190519238398392,
-			-0.8189517784409381,
-			-0.8188516080953395,
-			-0.8187514128060948,
-			-0.8186511925762556,
-			-0.8185509474088748,
-			-0.8184506773070068,
-			-0.8183503822737049,
-			-0.8182500623120254,
-			-0.8181497174250237,
-			-0.8180493476157563,
-			-0.8179489528872803,
-			-0.8178485332426552,
-			-0.8177480886849391,
-			-0.8176476192171916,
-			-0.8175471248424730,
-			-0.8174466055638455,
-
-			-0.8173460613843699,
-			-0.8172454923071100,
-			-0.8171448983351286,
-			-0.8170442794714903,
-			-0.8169436357192598,
-			-0.8168429670815036,
-			-0.8167422735612875,
-			-0.8166415551616790,
-			-0.8165408118857463,
-			-0.8164400437365579,
-			-0.8163392507171841,
-			-0.8162384328306944,
-			-0.8161375900801604,
-			-0.8160367224686537,
-			-0.8159358299992466,
-			-0.8158349126750135,
-			-0.8157339704990276,
-			-0.8156330034743640,
-			-0.8155320116040983,
-			-0.8154309948913068,
-			-0.8153299533390672,
-			-0.8152288869504565,
-			-0.8151277957285542,
-			-0.8150266796764396,
-			-0.8149255387971925,
-			-0.8148243730938934,
-			-0.8147231825696249,
-			-0.8146219672274695,
-			-0.8145207270705097,
-			-0.8144194621018294,
-			-0.8143181723245142,
-			-0.8142168577416484,
-			-0.8141155183563192,
-			-0.8140141541716135,
-			-0.8139127651906182,
-			-0.8138113514164222,
-			-0.8137099128521155,
-			-0.8136084495007874,
-			-0.8135069613655284,
-			-0.8134054484494301,
-			-0.8133039107555855,
-			-0.8132023482870865,
-			-0.8131007610470278,
-			-0.8129991490385037,
-			-0.8128975122646089,
-			-0.8127958507284400,
-			-0.8126941644330941,
-			-0.8125924533816681,
-			-0.8124907175772607,
-			-0.8123889570229703,
-			-0.8122871717218971,
-			-0.8121853616771423,
-			-0.8120835268918064,
-			-0.8119816673689915,
-			-0.8118797831118010,
-			-0.8117778741233381,
-			-0.8116759404067064,
-			-0.8115739819650124,
-			-0.8114719988013611,
-			-0.8113699909188592,
-			-0.8112679583206137,
-			-0.8111659010097335,
-			-0.8110638189893269,
-			-0.8109617122625032,
-			-0.8108595808323737,
-			-0.8107574247020489,
-			-0.8106552438746399,
-			-0.8105530383532606,
-			-0.8104508081410242,
-			-0.8103485532410442,
-			-0.8102462736564353,
-			-0.8101439693903142,
-			-0.8100416404457961,
-			-0.8099392868259987,
-			-0.8098369085340402,
-			-0.8097345055730383,
-			-0.8096320779461130,
-			-0.8095296256563844,
-			-0.8094271487069733,
-			-0.8093246471010016,
-			-0.8092221208415908,
-			-0.8091195699318650,
-			-0.8090169943749475,
-			-0.8089143941739632,
-			-0.8088117693320371,
-			-0.8087091198522963,
-			-0.8086064457378669,
-			-0.8085037469918761,
-			-0.8084010236174533,
-			-0.8082982756177272,
-			-0.8081955029958272,
-			-0.8080927057548843,
-			-0.8079898838980306,
-			-0.8078870374283974,
-			-0.8077841663491174,
-			-0.8076812706633252,
-			-0.8075783503741545,
-			-0.8074754054847398,
-			-0.8073724359982185,
-			-0.8072694419177262,
-			-0.8071664232464004,
-			-0.8070633799873792,
-			-0.8069603121438021,
-			-0.8068572197188081,
-			-0.8067541027155373,
-			-0.8066509611371319,
-			-0.8065477949867325,
-			-0.8064446042674825,
-			-0.8063413889825255,
-			-0.8062381491350047,
-			-0.8061348847280660,
-			-0.8060315957648539,
-			-0.8059282822485161,
-			-0.8058249441821985,
-			-0.8057215815690493,
-			-0.8056181944122177,
-			-0.8055147827148521,
-			-0.8054113464801036,
-			-0.8053078857111220,
-			-0.8052044004110597,
-			-0.8051008905830691,
-			-0.8049973562303023,
-			-0.8048937973559143,
-			-0.8047902139630589,
-			-0.8046866060548920,
-			-0.8045829736345689,
-			-0.8044793167052475,
-			-0.8043756352700848,
-			-0.8042719293322383,
-			-0.8041681988948688,
-			-0.8040644439611351,
-			-0.8039606645341972,
-			-0.8038568606172172,
-			-0.8037530322133575,
-			-0.8036491793257801,
-			-0.8035453019576484,
-			-0.8034414001121277,
-			-0.8033374737923825,
-			-0.8032335230015778,
-			-0.8031295477428815,
-			-0.8030255480194602,
-			-0.8029215238344815,
-			-0.8028174751911145,
-			-0.8027134020925293,
-			-0.8026093045418954,
-			-0.8025051825423837,
-			-0.8024010360971667,
-			-0.8022968652094161,
-			-0.8021926698823059,
-			-0.8020884501190094,
-			-0.8019842059227013,
-			-0.8018799372965577,
-			-0.8017756442437540,
-			-0.8016713267674678,
-			-0.8015669848708769,
-			-0.8014626185571587,
-			-0.8013582278294932,
-			-0.8012538126910607,
-			-0.8011493731450413,
-			-0.8010449091946158,
-			-0.8009404208429677,
-			-0.8008359080932793,
-			-0.8007313709487336,
-			-0.8006268094125157,
-			-0.8005222234878108,
-			-0.8004176131778044,
-			-0.8003129784856829,
-			-0.8002083194146348,
-			-0.8001036359678472,
-			-0.7999989281485084,
-			-0.7998941959598095,
-			-0.7997894394049401,
-			-0.7996846584870907,
-			-0.7995798532094539,
-			-0.7994750235752219,
-			-0.7993701695875881,
-			-0.7992652912497463,
-			-0.7991603885648920,
-			-0.7990554615362200,
-			-0.7989505101669266,
-			-0.7988455344602091,
-			-0.7987405344192648,
-			-0.7986355100472931,
-			-0.7985304613474919,
-			-0.7984253883230623,
-			-0.7983202909772049,
-			-0.7982151693131202,
-			-0.7981100233340116,
-			-0.7980048530430810,
-			-0.7978996584435329,
-			-0.7977944395385712,
-			-0.7976891963314010,
-			-0.7975839288252288,
-			-0.7974786370232603,
-			-0.7973733209287036,
-			-0.7972679805447670,
-			-0.7971626158746583,
-			-0.7970572269215878,
-			-0.7969518136887662,
-			-0.7968463761794042,
-			-0.7967409143967129,
-			-0.7966354283439061,
-			-0.7965299180241966,
-			-0.7964243834407978,
-			-0.7963188245969253,
-			-0.7962132414957944,
-			-0.7961076341406208,
-			-0.7960020025346218,
-			-0.7958963466810159,
-			-0.7957906665830207,
-			-0.7956849622438558,
-			-0.7955792336667404,
-			-0.7954734808548962,
-			-0.7953677038115438,
-			-0.7952619025399058,
-			-0.7951560770432050,
-			-0.7950502273246650,
-			-0.7949443533875099,
-			-0.7948384552349657,
-			-0.7947325328702572,
-			-0.7946265862966115,
-			-0.7945206155172559,
-			-0.7944146205354181,
-			-0.7943086013543276,
-			-0.7942025579772133,
-			-0.7940964904073053,
-			-0.7939903986478356,
-			-0.7938842827020347,
-			-0.7937781425731359,
-			-0.7936719782643723,
-			-0.7935657897789780,
-			-0.7934595771201866,
-			-0.7933533402912352,
-			-0.7932470792953591,
-			-0.7931407941357946,
-			-0.7930344848157802,
-			-0.7929281513385543,
-			-0.7928217937073558,
-			-0.7927154119254236,
-			-0.7926090059959996,
-			-0.7925025759223249,
-			-0.7923961217076411,
-			-0.7922896433551908,
-			-0.7921831408682184,
-			-0.7920766142499671,
-			-0.7919700635036827,
-			-0.7918634886326109,
-			-0.7917568896399974,
-			-0.7916502665290898,
-			-0.7915436193031367,
-			-0.7914369479653859,
-			-0.7913302525190873,
-			-0.7912235329674902,
-			-0.7911167893138461,
-			-0.7910100215614071,
-			-0.7909032297134246,
-			-0.7907964137731519,
-			-0.7906895737438435,
-			-0.7905827096287528,
-			-0.7904758214311359,
-			-0.7903689091542488,
-			-0.7902619728013479,
-			-0.7901550123756906,
-			-0.7900480278805350,
-			-0.7899410193191407,
-			-0.7898339866947669,
-			-0.7897269300106736,
-			-0.7896198492701231,
-			-0.7895127444763764,
-			-0.7894056156326955,
-			-0.7892984627423453,
-			-0.7891912858085888,
-			-0.7890840848346909,
-			-0.7889768598239171,
-			-0.7888696107795344,
-			-0.7887623377048090,
-			-0.7886550406030084,
-			-0.7885477194774022,
-			-0.7884403743312582,
-			-0.7883330051678474,
-			-0.7882256119904401,
-			-0.7881181948023076,
-			-0.7880107536067222,
-			-0.7879032884069563,
-			-0.7877957992062840,
-			-0.7876882860079792,
-			-0.7875807488153174,
-			-0.7874731876315741,
-			-0.7873656024600255,
-			-0.7872579933039493,
-			-0.7871503601666233,
-			-0.7870427030513262,
-			-0.7869350219613377,
-			-0.7868273168999371,
-			-0.7867195878704059,
-			-0.7866118348760262,
-			-0.7865040579200795,
-			-0.7863962570058489,
-			-0.7862884321366190,
-			-0.7861805833156740,
-			-0.7860727105462980,
-			-0.7859648138317789,
-			-0.7858568931754023,
-			-0.7857489485804555,
-			-0.7856409800502270,
-			-0.7855329875880062,
-			-0.7854249711970821,
-			-0.7853169308807448,
-			-0.7852088666422866,
-			-0.7851007784849979,
-			-0.7849926664121722,
-			-0.7848845304271028,
-			-0.7847763705330831,
-			-0.7846681867334083,
-			-0.7845599790313733,
-			-0.7844517474302752,
-			-0.7843434919334104,
-			-0.7842352125440761,
-			-0.7841269092655718,
-			-0.7840185821011953,
-			-0.7839102310542476,
-			-0.7838018561280289,
-			-0.7836934573258398,
-			-0.7835850346509835,
-			-0.7834765881067616,
-			-0.7833681176964782,
-			-0.7832596234234375,
-			-0.7831511052909442,
-			-0.7830425633023039,
-			-0.7829339974608237,
-			-0.7828254077698100,
-			-0.7827167942325701,
-			-0.7826081568524140,
-			-0.7824994956326503,
-			-0.7823908105765882,
-			-0.7822821016875396,
-			-0.7821733689688155,
-			-0.7820646124237280,
-			-0.7819558320555899,
-			-0.7818470278677156,
-			-0.7817381998634191,
-			-0.7816293480460144,
-			-0.7815204724188189,
-			-0.7814115729851486,
-			-0.7813026497483202,
-			-0.7811937027116520,
-			-0.7810847318784635,
-			-0.7809757372520731,
-			-0.7808667188358012,
-			-0.7807576766329692,
-			-0.7806486106468981,
-			-0.7805395208809106,
-			-0.7804304073383300,
-			-0.7803212700224792,
-			-0.7802121089366838,
-			-0.7801029240842681,
-			-0.7799937154685586,
-			-0.7798844830928821,
-			-0.7797752269605652,
-			-0.7796659470749367,
-			-0.7795566434393260,
-			-0.7794473160570619,
-			-0.7793379649314744,
-			-0.7792285900658948,
-			-0.7791191914636557,
-			-0.7790097691280882,
-			-0.7789003230625264,
-			-0.7787908532703044,
-			-0.7786813597547558,
-			-0.7785718425192166,
-			-0.7784623015670236,
-			-0.7783527369015126,
-			-0.7782431485260208,
-			-0.7781335364438878,
-			-0.7780239006584520,
-			-0.7779142411730522,
-			-0.7778045579910299,
-			-0.7776948511157260,
-			-0.7775851205504821,
-			-0.7774753662986408,
-			-0.7773655883635461,
-			-0.7772557867485411,
-			-0.7771459614569708,
-			-0.7770361124921813,
-			-0.7769262398575177,
-			-0.7768163435563281,
-			-0.7767064235919593,
-			-0.7765964799677598,
-			-0.7764865126870788,
-			-0.7763765217532658,
-			-0.7762665071696722,
-			-0.7761564689396480,
-			-0.7760464070665463,
-			-0.7759363215537189,
-			-0.7758262124045193,
-			-0.7757160796223025,
-			-0.7756059232104221,
-			-0.7754957431722345,
-			-0.7753855395110960,
-			-0.7752753122303628,
-			-0.7751650613333934,
-			-0.7750547868235460,
-			-0.7749444887041800,
-			-0.7748341669786540,
-			-0.7747238216503306,
-			-0.7746134527225701,
-			-0.7745030601987339,
-			-0.7743926440821857,
-			-0.7742822043762889,
-			-0.7741717410844069,
-			-0.7740612542099051,
-			-0.7739507437561497,
-			-0.7738402097265066,
-			-0.7737296521243419,
-			-0.7736190709530250,
-			-0.7735084662159236,
-			-0.7733978379164065,
-			-0.7732871860578443,
-			-0.7731765106436077,
-			-0.7730658116770672,
-			-0.7729550891615955,
-			-0.7728443431005659,
-			-0.7727335734973512,
-			-0.7726227803553257,
-			-0.7725119636778647,
-			-0.7724011234683431,
-			-0.7722902597301385,
-			-0.7721793724666272,
-			-0.7720684616811867,
-			-0.7719575273771966,
-			-0.7718465695580349,
-			-0.7717355882270825,
-			-0.7716245833877202,
-			-0.7715135550433286,
-			-0.7714025031972898,
-			-0.7712914278529878,
-			-0.7711803290138054,
-			-0.7710692066831265,
-			-0.7709580608643363,
-			-0.7708468915608211,
-			-0.7707356987759663,
-			-0.7706244825131598,
-			-0.7705132427757893,
-			-0.7704019795672434,
-			-0.7702906928909106,
-			-0.7701793827501823,
-			-0.7700680491484484,
-			-0.7699566920890997,
-			-0.7698453115755294,
-			-0.7697339076111300,
-			-0.7696224801992946,
-			-0.7695110293434181,
-			-0.7693995550468952,
-			-0.7692880573131216,
-			-0.7691765361454941,
-			-0.7690649915474088,
-			-0.7689534235222644,
-			-0.7688418320734597,
-			-0.7687302172043933,
-			-0.7686185789184652,
-			-0.7685069172190768,
-			-0.7683952321096286,
-			-0.7682835235935236,
-			-0.7681717916741639,
-			-0.7680600363549537,
-			-0.7679482576392964,
-			-0.7678364555305973,
-			-0.7677246300322630,
-			-0.7676127811476988,
-			-0.7675009088803120,
-			-0.7673890132335111,
-			-0.7672770942107036,
-			-0.7671651518152995,
-			-0.7670531860507089,
-			-0.7669411969203419,
-			-0.7668291844276094,
-			-0.7667171485759251,
-			-0.7666050893687010,
-			-0.7664930068093502,
-			-0.7663809009012869,
-			-0.7662687716479269,
-			-0.7661566190526850,
-			-0.7660444431189781,
-			-0.7659322438502233,
-			-0.7658200212498377,
-			-0.7657077753212408,
-			-0.7655955060678508,
-			-0.7654832134930885,
-			-0.7653708976003737,
-			-0.7652585583931283,
-			-0.7651461958747746,
-			-0.7650338100487343,
-			-0.7649214009184320,
-			-0.7648089684872912,
-			-0.7646965127587371,
-			-0.7645840337361954,
-			-0.7644715314230918,
-			-0.7643590058228539,
-			-0.7642464569389091,
-			-0.7641338847746862,
-			-0.7640212893336138,
-			-0.7639086706191226,
-			-0.7637960286346424,
-			-0.7636833633836043,
-			-0.7635706748694414,
-			-0.7634579630955857,
-			-0.7633452280654696,
-			-0.7632324697825288,
-			-0.7631196882501978,
-			-0.7630068834719115,
-			-0.7628940554511061,
-			-0.7627812041912195,
-			-0.7626683296956889,
-			-0.7625554319679514,
-			-0.7624425110114481,
-			-0.7623295668296178,
-			-0.7622165994259005,
-			-0.7621036088037377,
-			-0.7619905949665722,
-			-0.7618775579178455,
-			-0.7617644976610011,
-			-0.7616514141994836,
-			-0.7615383075367368,
-			-0.7614251776762069,
-			-0.7613120246213401,
-			-0.7611988483755822,
-			-0.7610856489423821,
-			-0.7609724263251868,
-			-0.7608591805274462,
-			-0.7607459115526098,
-			-0.7606326194041273,
-			-0.7605193040854503,
-			-0.7604059656000310,
-			-0.7602926039513213,
-			-0.7601792191427741,
-			-0.7600658111778444,
-			-0.7599523800599861,
-			-0.7598389257926540,
-			-0.7597254483793049,
-			-0.7596119478233953,
-			-0.7594984241283825,
-			-0.7593848772977245,
-			-0.7592713073348810,
-			-0.7591577142433108,
-			-0.7590440980264735,
-			-0.7589304586878316,
-			-0.7588167962308460,
-			-0.7587031106589783,
-			-0.7585894019756927,
-			-0.7584756701844524,
-			-0.7583619152887221,
-			-0.7582481372919665,
-			-0.7581343361976525,
-			-0.7580205120092454,
-			-0.7579066647302133,
-			-0.7577927943640245,
-			-0.7576789009141465,
-			-0.7575649843840498,
-			-0.7574510447772037,
-			-0.7573370820970796,
-			-0.7572230963471490,
-			-0.7571090875308835,
-			-0.7569950556517567,
-			-0.7568810007132415,
-			-0.7567669227188129,
-			-0.7566528216719457,
-			-0.7565386975761151,
-			-0.7564245504347986,
-			-0.7563103802514720,
-			-0.7561961870296141,
-			-0.7560819707727034,
-			-0.7559677314842184,
-			-0.7558534691676393,
-			-0.7557391838264477,
-			-0.7556248754641239,
-			-0.7555105440841494,
-			-0.7553961896900087,
-			-0.7552818122851841,
-			-0.7551674118731593,
-			-0.7550529884574200,
-			-0.7549385420414516,
-			-0.7548240726287399,
-			-0.7547095802227719,
-			-0.7545950648270361,
-			-0.7544805264450198,
-			-0.7543659650802123,
-			-0.7542513807361040,
-			-0.7541367734161848,
-			-0.7540221431239453,
-			-0.7539074898628781,
-			-0.7537928136364757,
-			-0.7536781144482310,
-			-0.7535633923016378,
-			-0.7534486472001918,
-			-0.7533338791473870,
-			-0.7532190881467199,
-			-0.7531042742016879,
-			-0.7529894373157874,
-			-0.7528745774925174,
-			-0.7527596947353761,
-			-0.7526447890478630,
-			-0.7525298604334791,
-			-0.7524149088957244,
-			-0.7522999344381012,
-			-0.7521849370641115,
-			-0.7520699167772587,
-			-0.7519548735810453,
-			-0.7518398074789774,
-			-0.7517247184745595,
-			-0.7516096065712966,
-			-0.7514944717726961,
-			-0.7513793140822653,
-			-0.7512641335035112,
-			-0.7511489300399432,
-			-0.7510337036950704,
-			-0.7509184544724031,
-			-0.7508031823754507,
-			-0.7506878874077265,
-			-0.7505725695727415,
-			-0.7504572288740081,
-			-0.7503418653150407,
-			-0.7502264788993531,
-			-0.7501110696304597,
-			-0.7499956375118765,
-			-0.7498801825471203,
-			-0.7497647047397072,
-			-0.7496492040931549,
-			-0.7495336806109827,
-			-0.7494181342967083,
-			-0.7493025651538527,
-			-0.7491869731859355,
-			-0.7490713583964779,
-			-0.7489557207890024,
-			-0.7488400603670304,
-			-0.7487243771340861,
-			-0.7486086710936933,
-			-0.7484929422493762,
-			-0.7483771906046602,
-			-0.7482614161630712,
-			-0.7481456189281365,
-			-0.7480297989033828,
-			-0.7479139560923381,
-			-0.7477980904985322,
-			-0.7476822021254932,
-			-0.7475662909767523,
-			-0.7474503570558402,
-			-0.7473344003662880,
-			-0.7472184209116276,
-			-0.7471024186953933,
-			-0.7469863937211181,
-			-0.7468703459923355,
-			-0.7467542755125814,
-			-0.7466381822853917,
-			-0.7465220663143018,
-			-0.7464059276028497,
-			-0.7462897661545729,
-			-0.7461735819730098,
-			-0.7460573750616993,
-			-0.7459411454241822,
-			-0.7458248930639982,
-			-0.7457086179846889,
-			-0.7455923201897960,
-			-0.7454759996828626,
-			-0.7453596564674312,
-			-0.7452432905470465,
-			-0.7451269019252531,
-			-0.7450104906055963,
-			-0.7448940565916226,
-			-0.7447775998868778,
-			-0.7446611204949098,
-			-0.7445446184192677,
-			-0.7444280936634992,
-			-0.7443115462311540,
-			-0.7441949761257832,
-			-0.7440783833509365,
-			-0.7439617679101664,
-			-0.7438451298070253,
-			-0.7437284690450658,
-			-0.7436117856278408,
-			-0.7434950795589060,
-			-0.7433783508418164,
-			-0.7432615994801269,
-			-0.7431448254773942,
-			-0.7430280288371762,
-			-0.7429112095630296,
-			-0.7427943676585138,
-			-0.7426775031271879,
-			-0.7425606159726112,
-			-0.7424437061983443,
-			-0.7423267738079496,
-			-0.7422098188049884,
-			-0.7420928411930228,
-			-0.7419758409756165,
-			-0.7418588181563341,
-			-0.7417417727387393,
-			-0.7416247047263984,
-			-0.7415076141228774,
-			-0.7413905009317422,
-			-0.7412733651565616,
-			-0.7411562068009024,
-			-0.7410390258683345,
-			-0.7409218223624270,
-			-0.7408045962867502,
-			-0.7406873476448748,
-			-0.7405700764403730,
-			-0.7404527826768164,
-			-0.7403354663577780,
-			-0.7402181274868322,
-			-0.7401007660675530,
-			-0.7399833821035143,
-			-0.7398659755982937,
-			-0.7397485465554665,
-			-0.7396310949786099,
-			-0.7395136208713016,
-			-0.7393961242371208,
-			-0.7392786050796454,
-			-0.7391610634024562,
-			-0.7390434992091339,
-			-0.7389259125032592,
-			-0.7388083032884133,
-			-0.7386906715681800,
-			-0.7385730173461426,
-			-0.7384553406258841,
-			-0.7383376414109893,
-			-0.7382199197050445,
-			-0.7381021755116345,
-			-0.7379844088343467,
-			-0.7378666196767687,
-			-0.7377488080424875,
-			-0.7376309739350932,
-			-0.7375131173581739,
-			-0.7373952383153207,
-			-0.7372773368101244,
-			-0.7371594128461755,
-			-0.7370414664270668,
-			-0.7369234975563919,
-			-0.7368055062377432,
-			-0.7366874924747158,
-			-0.7365694562709033,
-			-0.7364513976299029,
-			-0.7363333165553094,
-			-0.7362152130507209,
-			-0.7360970871197348,
-			-0.7359789387659486,
-			-0.7358607679929620,
-			-0.7357425748043751,
-			-0.7356243592037875,
-			-0.7355061211948003,
-			-0.7353878607810160,
-			-0.7352695779660365,
-			-0.7351512727534641,
-			-0.7350329451469042,
-			-0.7349145951499600,
-			-0.7347962227662374,
-			-0.7346778279993413,
-			-0.7345594108528796,
-			-0.7344409713304583,
-			-0.7343225094356856,
-			-0.7342040251721704,
-			-0.7340855185435213,
-			-0.7339669895533493,
-			-0.7338484382052638,
-			-0.7337298645028767,
-			-0.7336112684497997,
-			-0.7334926500496455,
-			-0.7333740093060279,
-			-0.7332553462225601,
-			-0.7331366608028573,
-			-0.7330179530505352,
-			-0.7328992229692087,
-			-0.7327804705624960,
-			-0.7326616958340130,
-			-0.7325428987873788,
-			-0.7324240794262122,
-			-0.7323052377541318,
-			-0.7321863737747586,
-			-0.7320674874917129,
-			-0.7319485789086164,
-			-0.7318296480290910,
-			-0.7317106948567602,
-			-0.7315917193952471,
-			-0.7314727216481751,
-			-0.7313537016191706,
-			-0.7312346593118585,
-			-0.7311155947298642,
-			-0.7309965078768155,
-			-0.7308773987563404,
-			-0.7307582673720666,
-			-0.7306391137276221,
-			-0.7305199378266385,
-			-0.7304007396727451,
-			-0.7302815192695723,
-			-0.7301622766207526,
-			-0.7300430117299184,
-			-0.7299237246007018,
-			-0.7298044152367370,
-			-0.7296850836416591,
-			-0.7295657298191023,
-			-0.7294463537727022,
-			-0.7293269555060962,
-			-0.7292075350229199,
-			-0.7290880923268127,
-			-0.7289686274214118,
-			-0.7288491403103565,
-			-0.7287296309972873,
-			-0.7286100994858437,
-			-0.7284905457796674,
-			-0.7283709698824006,
-			-0.7282513717976846,
-			-0.7281317515291633,
-			-0.7280121090804812,
-			-0.7278924444552820,
-			-0.7277727576572106,
-			-0.7276530486899134,
-			-0.7275333175570372,
-			-0.7274135642622284,
-			-0.7272937888091354,
-			-0.7271739912014069,
-			-0.7270541714426922,
-			-0.7269343295366401,
-			-0.7268144654869029,
-			-0.7266945792971312,
-			-0.7265746709709757,
-			-0.7264547405120911,
-			-0.7263347879241298,
-			-0.7262148132107449,
-			-0.7260948163755920,
-			-0.7259747974223264,
-			-0.7258547563546038,
-			-0.7257346931760807,
-			-0.7256146078904153,
-			-0.7254945005012644,
-			-0.7253743710122879,
-			-0.7252542194271441,
-			-0.7251340457494933,
-			-0.7250138499829968,
-			-0.7248936321313151,
-			-0.7247733921981108,
-			-0.7246531301870469,
-			-0.7245328461017857,
-			-0.7244125399459926,
-			-0.7242922117233311,
-			-0.7241718614374678,
-			-0.7240514890920678,
-			-0.7239310946907980,
-			-0.7238106782373266,
-			-0.7236902397353204,
-			-0.7235697791884493,
-			-0.7234492966003827,
-			-0.7233287919747899,
-			-0.7232082653153418,
-			-0.7230877166257108,
-			-0.7229671459095686,
-			-0.7228465531705868,
-			-0.7227259384124407,
-			-0.7226053016388038,
-			-0.7224846428533499,
-			-0.7223639620597556,
-			-0.7222432592616972,
-			-0.7221225344628504,
-			-0.7220017876668932,
-			-0.7218810188775046,
-			-0.7217602280983623,
-			-0.7216394153331464,
-			-0.7215185805855366,
-			-0.7213977238592146,
-			-0.7212768451578606,
-			-0.7211559444851579,
-			-0.7210350218447888,
-			-0.7209140772404371,
-			-0.7207931106757864,
-			-0.7206721221545228,
-			-0.7205511116803306,
-			-0.7204300792568964,
-			-0.7203090248879070,
-			-0.7201879485770499,
-			-0.7200668503280139,
-			-0.7199457301444867,
-			-0.7198245880301588,
-			-0.7197034239887203,
-			-0.7195822380238621,
-			-0.7194610301392744,
-			-0.7193398003386511,
-			-0.7192185486256848,
-			-0.7190972750040678,
-			-0.7189759794774961,
-			-0.7188546620496638,
-			-0.7187333227242655,
-			-0.7186119615049986,
-			-0.7184905783955600,
-			-0.7183691733996468,
-			-0.7182477465209562,
-			-0.7181262977631889,
-			-0.7180048271300439,
-			-0.7178833346252209,
-			-0.7177618202524207,
-			-0.7176402840153459,
-			-0.7175187259176972,
-			-0.7173971459631787,
-			-0.7172755441554938,
-			-0.7171539204983457,
-			-0.7170322749954401,
-			-0.7169106076504829,
-			-0.7167889184671795,
-			-0.7166672074492375,
-			-0.7165454746003632,
-			-0.7164237199242657,
-			-0.7163019434246544,
-			-0.7161801451052379,
-			-0.7160583249697262,
-			-0.7159364830218313,
-			-0.7158146192652641,
-			-0.7156927337037358,
-			-0.7155708263409610,
-			-0.7154488971806521,
-			-0.7153269462265235,
-			-0.7152049734822898,
-			-0.7150829789516676,
-			-0.7149609626383717,
-			-0.7148389245461193,
-			-0.7147168646786287,
-			-0.7145947830396174,
-			-0.7144726796328034,
-			-0.7143505544619079,
-			-0.7142284075306498,
-			-0.7141062388427504,
-			-0.7139840484019306,
-			-0.7138618362119138,
-			-0.7137396022764213,
-			-0.7136173465991776,
-			-0.7134950691839067,
-			-0.7133727700343326,
-			-0.7132504491541817,
-			-0.7131281065471795,
-			-0.7130057422170530,
-			-0.7128833561675301,
-			-0.7127609484023376,
-			-0.7126385189252055,
-			-0.7125160677398626,
-			-0.7123935948500393,
-			-0.7122711002594665,
-			-0.7121485839718745,
-			-0.7120260459909968,
-			-0.7119034863205650,
-			-0.7117809049643131,
-			-0.7116583019259755,
-			-0.7115356772092856,
-			-0.7114130308179795,
-			-0.7112903627557938,
-			-0.7111676730264646,
-			-0.7110449616337289,
-			-0.7109222285813256,
-			-0.7107994738729930,
-			-0.7106766975124692,
-			-0.7105538995034963,
-			-0.7104310798498140,
-			-0.7103082385551628,
-			-0.7101853756232853,
-			-0.7100624910579248,
-			-0.7099395848628238,
-			-0.7098166570417260,
-			-0.7096937075983770,
-			-0.7095707365365209,
-			-0.7094477438599044,
-			-0.7093247295722741,
-			-0.7092016936773768,
-			-0.7090786361789605,
-			-0.7089555570807734,
-			-0.7088324563865658,
-			-0.7087093341000865,
-			-0.7085861902250862,
-			-0.7084630247653168,
-			-0.7083398377245289,
-			-0.7082166291064761,
-			-0.7080933989149110,
-			-0.7079701471535876,
-			-0.7078468738262607,
-			-0.7077235789366844,
-			-0.7076002624886153,
-			-0.7074769244858097,
-			-0.7073535649320246,
-			-0.7072301838310174,
-			-0.7071067811865477,
-			-0.7069833570023736,
-			-0.7068599112822540,
-			-0.7067364440299512,
-			-0.7066129552492252,
-			-0.7064894449438371,
-			-0.7063659131175503,
-			-0.7062423597741272,
-			-0.7061187849173317,
-			-0.7059951885509277,
-			-0.7058715706786811,
-			-0.7057479313043570,
-			-0.7056242704317206,
-			-0.7055005880645406,
-			-0.7053768842065840,
-			-0.7052531588616180,
-			-0.7051294120334123,
-			-0.7050056437257372,
-			-0.7048818539423617,
-			-0.7047580426870568,
-			-0.7046342099635949,
-			-0.7045103557757471,
-			-0.7043864801272868,
-			-0.7042625830219877,
-			-0.7041386644636231,
-			-0.7040147244559687,
-			-0.7038907630027988,
-			-0.7037667801078906,
-			-0.7036427757750207,
-			-0.7035187500079654,
-			-0.7033947028105036,
-			-0.7032706341864146,
-			-0.7031465441394770,
-			-0.7030224326734704,
-			-0.7028982997921758,
-			-0.7027741454993752,
-			-0.7026499697988493,
-			-0.7025257726943817,
-			-0.7024015541897556,
-			-0.7022773142887541,
-			-0.7021530529951622,
-			-0.7020287703127659,
-			-0.7019044662453504,
-			-0.7017801407967013,
-			-0.7016557939706076,
-			-0.7015314257708563,
-			-0.7014070362012349,
-			-0.7012826252655339,
-			-0.7011581929675424,
-			-0.7010337393110512,
-			-0.7009092642998508,
-			-0.7007847679377339,
-			-0.7006602502284919,
-			-0.7005357111759180,
-			-0.7004111507838066,
-			-0.7002865690559509,
-			-0.7001619659961471,
-			-0.7000373416081895,
-			-0.6999126958958758,
-			-0.6997880288630020,
-			-0.6996633405133653,
-			-0.6995386308507653,
-			-0.6994138998789995,
-			-0.6992891476018686,
-			-0.6991643740231717,
-			-0.6990395791467099,
-			-0.6989147629762855,
-			-0.6987899255156993,
-			-0.6986650667687551,
-			-0.6985401867392562,
-			-0.6984152854310059,
-			-0.6982903628478097,
-			-0.6981654189934727,
-			-0.6980404538718012,
-			-0.6979154674866006,
-			-0.6977904598416802,
-			-0.6976654309408469,
-			-0.6975403807879086,
-			-0.6974153093866755,
-			-0.6972902167409577,
-			-0.6971651028545647,
-			-0.6970399677313082,
-			-0.6969148113750007,
-			-0.6967896337894541,
-			-0.6966644349784805,
-			-0.6965392149458958,
-			-0.6964139736955133,
-			-0.6962887112311473,
-			-0.6961634275566146,
-			-0.6960381226757314,
-			-0.6959127965923145,
-			-0.6957874493101812,
-			-0.6956620808331510,
-			-0.6955366911650416,
-			-0.6954112803096730,
-			-0.6952858482708656,
-			-0.6951603950524398,
-			-0.6950349206582180,
-			-0.6949094250920216,
-			-0.6947839083576733,
-			-0.6946583704589975,
-			-0.6945328113998172,
-			-0.6944072311839579,
-			-0.6942816298152450,
-			-0.6941560072975040,
-			-0.6940303636345613,
-			-0.6939046988302457,
-			-0.6937790128883843,
-			-0.6936533058128049,
-			-0.6935275776073380,
-			-0.6934018282758133,
-			-0.6932760578220611,
-			-0.6931502662499116,
-			-0.6930244535631982,
-			-0.6928986197657531,
-			-0.6927727648614080,
-			-0.6926468888539988,
-			-0.6925209917473589,
-			-0.6923950735453226,
-			-0.6922691342517265,
-			-0.6921431738704072,
-			-0.6920171924052004,
-			-0.6918911898599446,
-			-0.6917651662384785,
-			-0.6916391215446402,
-			-0.6915130557822698,
-			-0.6913869689552066,
-			-0.6912608610672919,
-			-0.6911347321223679,
-			-0.6910085821242757,
-			-0.6908824110768582,
-			-0.6907562189839597,
-			-0.6906300058494228,
-			-0.6905037716770935,
-			-0.6903775164708164,
-			-0.6902512402344376,
-			-0.6901249429718033,
-			-0.6899986246867610,
-			-0.6898722853831594,
-			-0.6897459250648459,
-			-0.6896195437356697,
-			-0.6894931413994816,
-			-0.6893667180601308,
-			-0.6892402737214693,
-			-0.6891138083873487,
-			-0.6889873220616209,
-			-0.6888608147481384,
-			-0.6887342864507566,
-			-0.6886077371733287,
-			-0.6884811669197093,
-			-0.6883545756937540,
-			-0.6882279634993199,
-			-0.6881013303402626,
-			-0.6879746762204404,
-			-0.6878480011437113,
-			-0.6877213051139338,
-			-0.6875945881349678,
-			-0.6874678502106722,
-			-0.6873410913449092,
-			-0.6872143115415384,
-			-0.6870875108044231,
-			-0.6869606891374256,
-			-0.6868338465444084,
-			-0.6867069830292361,
-			-0.6865800985957728,
-			-0.6864531932478838,
-			-0.6863262669894352,
-			-0.6861993198242923,
-			-0.6860723517563231,
-			-0.6859453627893951,
-			-0.6858183529273764,
-			-0.6856913221741358,
-			-0.6855642705335436,
-			-0.6854371980094691,
-			-0.6853101046057838,
-			-0.6851829903263593,
-			-0.6850558551750674,
-			-0.6849286991557799,
-			-0.6848015222723718,
-			-0.6846743245287168,
-			-0.6845471059286889,
-			-0.6844198664761634,
-			-0.6842926061750173,
-			-0.6841653250291264,
-			-0.6840380230423669,
-			-0.6839107002186188,
-			-0.6837833565617590,
-			-0.6836559920756672,
-			-0.6835286067642226,
-			-0.6834012006313067,
-			-0.6832737736807994,
-			-0.6831463259165826,
-			-0.6830188573425393,
-			-0.6828913679625511,
-			-0.6827638577805029,
-			-0.6826363268002783,
-			-0.6825087750257617,
-			-0.6823812024608394,
-			-0.6822536091093965,
-			-0.6821259949753206,
-			-0.6819983600624989,
-			-0.6818707043748186,
-			-0.6817430279161689,
-			-0.6816153306904397,
-			-0.6814876127015198,
-			-0.6813598739532999,
-			-0.6812321144496720,
-			-0.6811043341945273,
-			-0.6809765331917574,
-			-0.6808487114452566,
-			-0.6807208689589179,
-			-0.6805930057366359,
-			-0.6804651217823051,
-			-0.6803372170998220,
-			-0.6802092916930822,
-			-0.6800813455659815,
-			-0.6799533787224195,
-			-0.6798253911662929,
-			-0.6796973829015003,
-			-0.6795693539319413,
-			-0.6794413042615168,
-			-0.6793132338941262,
-			-0.6791851428336709,
-			-0.6790570310840538,
-			-0.6789288986491760,
-			-0.6788007455329417,
-			-0.6786725717392545,
-			-0.6785443772720180,
-			-0.6784161621351386,
-			-0.6782879263325203,
-			-0.6781596698680706,
-			-0.6780313927456965,
-			-0.6779030949693043,
-			-0.6777747765428038,
-			-0.6776464374701023,
-			-0.6775180777551102,
-			-0.6773896974017377,
-			-0.6772612964138943,
-			-0.6771328747954928,
-			-0.6770044325504437,
-			-0.6768759696826608,
-			-0.6767474861960571,
-			-0.6766189820945454,
-			-0.6764904573820409,
-			-0.6763619120624594,
-			-0.6762333461397160,
-			-0.6761047596177258,
-			-0.6759761525004080,
-			-0.6758475247916790,
-			-0.6757188764954565,
-			-0.6755902076156604,
-			-0.6754615181562097,
-			-0.6753328081210246,
-			-0.6752040775140254,
-			-0.6750753263391347,
-			-0.6749465546002732,
-			-0.6748177623013636,
-			-0.6746889494463302,
-			-0.6745601160390960,
-			-0.6744312620835852,
-			-0.6743023875837236,
-			-0.6741734925434367,
-			-0.6740445769666510,
-			-0.6739156408572928,
-			-0.6737866842192911,
-			-0.6736577070565730,
-			-0.6735287093730674,
-			-0.6733996911727047,
-			-0.6732706524594138,
-			-0.6731415932371266,
-			-0.6730125135097733,
-			-0.6728834132812869,
-			-0.6727542925555999,
-			-0.6726251513366447,
-			-0.6724959896283560,
-			-0.6723668074346680,
-			-0.6722376047595163,
-			-0.6721083816068352,
-			-0.6719791379805630,
-			-0.6718498738846357,
-			-0.6717205893229903,
-			-0.6715912842995659,
-			-0.6714619588183016,
-			-0.6713326128831358,
-			-0.6712032464980091,
-			-0.6710738596668631,
-			-0.6709444523936383,
-			-0.6708150246822758,
-			-0.6706855765367201,
-			-0.6705561079609136,
-			-0.6704266189587993,
-			-0.6702971095343226,
-			-0.6701675796914288,
-			-0.6700380294340624,
-			-0.6699084587661706,
-			-0.6697788676917008,
-			-0.6696492562145997,
-			-0.6695196243388155,
-			-0.6693899720682979,
-			-0.6692602994069951,
-			-0.6691306063588585,
-			-0.6690008929278376,
-			-0.6688711591178840,
-			-0.6687414049329503,
-			-0.6686116303769880,
-			-0.6684818354539510,
-			-0.6683520201677933,
-			-0.6682221845224685,
-			-0.6680923285219320,
-			-0.6679624521701391,
-			-0.6678325554710469,
-			-0.6677026384286116,
-			-0.6675727010467905,
-			-0.6674427433295427,
-			-0.6673127652808256,
-			-0.6671827669045997,
-			-0.6670527482048245,
-			-0.6669227091854610,
-			-0.6667926498504690,
-			-0.6666625702038126,
-			-0.6665324702494528,
-			-0.6664023499913525,
-			-0.6662722094334760,
-			-0.6661420485797878,
-			-0.6660118674342517,
-			-0.6658816660008344,
-			-0.6657514442835016,
-			-0.6656212022862202,
-			-0.6654909400129572,
-			-0.6653606574676816,
-			-0.6652303546543610,
-			-0.6651000315769651,
-			-0.6649696882394636,
-			-0.6648393246458275,
-			-0.6647089408000267,
-			-0.6645785367060338,
-			-0.6644481123678218,
-			-0.6643176677893624,
-			-0.6641872029746301,
-			-0.6640567179275980,
-			-0.6639262126522415,
-			-0.6637956871525367,
-			-0.6636651414324587,
-			-0.6635345754959842,
-			-0.6634039893470912,
-			-0.6632733829897566,
-			-0.6631427564279597,
-			-0.6630121096656796,
-			-0.6628814427068954,
-			-0.6627507555555872,
-			-0.6626200482157375,
-			-0.6624893206913268,
-			-0.6623585729863372,
-			-0.6622278051047513,
-			-0.6620970170505537,
-			-0.6619662088277268,
-			-0.6618353804402566,
-			-0.6617045318921281,
-			-0.6615736631873266,
-			-0.6614427743298383,
-			-0.6613118653236519,
-			-0.6611809361727542,
-			-0.6610499868811330,
-			-0.6609190174527776,
-			-0.6607880278916781,
-			-0.6606570182018238,
-			-0.6605259883872061,
-			-0.6603949384518163,
-			-0.6602638683996462,
-			-0.6601327782346891,
-			-0.6600016679609368,
-			-0.6598705375823846,
-			-0.6597393871030263,
-			-0.6596082165268570,
-			-0.6594770258578722,
-			-0.6593458151000691,
-			-0.6592145842574435,
-			-0.6590833333339932,
-			-0.6589520623337171,
-			-0.6588207712606133,
-			-0.6586894601186803,
-			-0.6585581289119197,
-			-0.6584267776443316,
-			-0.6582954063199166,
-			-0.6581640149426765,
-			-0.6580326035166147,
-			-0.6579011720457330,
-			-0.6577697205340358,
-			-0.6576382489855276,
-			-0.6575067574042127,
-			-0.6573752457940957,
-			-0.6572437141591844,
-			-0.6571121625034848,
-			-0.6569805908310039,
-			-0.6568489991457496,
-			-0.6567173874517311,
-			-0.6565857557529564,
-			-0.6564541040534363,
-			-0.6563224323571810,
-			-0.6561907406682005,
-			-0.6560590289905077,
-			-0.6559272973281134,
-			-0.6557955456850314,
-			-0.6556637740652750,
-			-0.6555319824728574,
-			-0.6554001709117937,
-			-0.6552683393860997,
-			-0.6551364878997905,
-			-0.6550046164568830,
-			-0.6548727250613933,
-			-0.6547408137173402,
-			-0.6546088824287408,
-			-0.6544769311996149,
-			-0.6543449600339817,
-			-0.6542129689358612,
-			-0.6540809579092738,
-			-0.6539489269582417,
-			-0.6538168760867858,
-			-0.6536848052989287,
-			-0.6535527145986944,
-			-0.6534206039901056,
-			-0.6532884734771864,
-			-0.6531563230639638,
-			-0.6530241527544610,
-			-0.6528919625527051,
-			-0.6527597524627227,
-			-0.6526275224885412,
-			-0.6524952726341886,
-			-0.6523630029036928,
-			-0.6522307133010847,
-			-0.6520984038303924,
-			-0.6519660744956469,
-			-0.6518337253008790,
-			-0.6517013562501205,
-			-0.6515689673474034,
-			-0.6514365585967608,
-			-0.6513041300022256,
-			-0.6511716815678322,
-			-0.6510392132976145,
-			-0.6509067251956095,
-			-0.6507742172658513,
-			-0.6506416895123769,
-			-0.6505091419392232,
-			-0.6503765745504272,
-			-0.6502439873500292,
-			-0.6501113803420661,
-			-0.6499787535305772,
-			-0.6498461069196045,
-			-0.6497134405131862,
-			-0.6495807543153655,
-			-0.6494480483301841,
-			-0.6493153225616832,
-			-0.6491825770139059,
-			-0.6490498116908971,
-			-0.6489170265967013,
-			-0.6487842217353610,
-			-0.6486513971109239,
-			-0.6485185527274360,
-			-0.6483856885889426,
-			-0.6482528046994912,
-			-0.6481199010631308,
-			-0.6479869776839099,
-			-0.6478540345658762,
-			-0.6477210717130795,
-			-0.6475880891295720,
-			-0.6474550868194020,
-			-0.6473220647866228,
-			-0.6471890230352867,
-			-0.6470559615694442,
-			-0.6469228803931508,
-			-0.6467897795104595,
-			-0.6466566589254249,
-			-0.6465235186421027,
-			-0.6463903586645466,
-			-0.6462571789968149,
-			-0.6461239796429639,
-			-0.6459907606070509,
-			-0.6458575218931341,
-			-0.6457242635052721,
-			-0.6455909854475244,
-			-0.6454576877239506,
-			-0.6453243703386113,
-			-0.6451910332955684,
-			-0.6450576765988812,
-			-0.6449243002526144,
-			-0.6447909042608300,
-			-0.6446574886275914,
-			-0.6445240533569628,
-			-0.6443905984530089,
-			-0.6442571239197956,
-			-0.6441236297613866,
-			-0.6439901159818506,
-			-0.6438565825852539,
-			-0.6437230295756641,
-			-0.6435894569571495,
-			-0.6434558647337791,
-			-0.6433222529096222,
-			-0.6431886214887488,
-			-0.6430549704752296,
-			-0.6429212998731360,
-			-0.6427876096865395,
-			-0.6426538999195128,
-			-0.6425201705761290,
-			-0.6423864216604614,
-			-0.6422526531765846,
-			-0.6421188651285732,
-			-0.6419850575205026,
-			-0.6418512303564489,
-			-0.6417173836404887,
-			-0.6415835173766992,
-			-0.6414496315691581,
-			-0.6413157262219440,
-			-0.6411818013391357,
-			-0.6410478569248128,
-			-0.6409138929830557,
-			-0.6407799095179448,
-			-0.6406459065335619,
-			-0.6405118840339886,
-			-0.6403778420233069,
-			-0.6402437805056022,
-			-0.6401096994849559,
-			-0.6399755989654524,
-			-0.6398414789511788,
-			-0.6397073394462186,
-			-0.6395731804546585,
-			-0.6394390019805845,
-			-0.6393048040280861,
-			-0.6391705866012490,
-			-0.6390363497041618,
-			-0.6389020933409156,
-			-0.6387678175155974,
-			-0.6386335222322995,
-			-0.6384992074951128,
-			-0.6383648733081273,
-			-0.6382305196754359,
-			-0.6380961466011303,
-			-0.6379617540893060,
-			-0.6378273421440547,
-			-0.6376929107694709,
-			-0.6375584599696515,
-			-0.6374239897486895,
-			-0.6372895001106832,
-			-0.6371549910597293,
-			-0.6370204625999232,
-			-0.6368859147353654,
-			-0.6367513474701519,
-			-0.6366167608083840,
-			-0.6364821547541613,
-			-0.6363475293115820,
-			-0.6362128844847493,
-			-0.6360782202777638,
-			-0.6359435366947286,
-			-0.6358088337397440,
-			-0.6356741114169155,
-			-0.6355393697303471,
-			-0.6354046086841409,
-			-0.6352698282824043,
-			-0.6351350285292421,
-			-0.6350002094287607,
-			-0.6348653709850667,
-			-0.6347305132022676,
-			-0.6345956360844722,
-			-0.6344607396357869,
-			-0.6343258238603230,
-			-0.6341908887621903,
-			-0.6340559343454970,
-			-0.6339209606143562,
-			-0.6337859675728788,
-			-0.6336509552251767,
-			-0.6335159235753627,
-			-0.6333808726275503,
-			-0.6332458023858532,
-			-0.6331107128543858,
-			-0.6329756040372634,
-			-0.6328404759386014,
-			-0.6327053285625162,
-			-0.6325701619131247,
-			-0.6324349759945440,
-			-0.6322997708108924,
-			-0.6321645463662884,
-			-0.6320293026648510,
-			-0.6318940397107002,
-			-0.6317587575079563,
-			-0.6316234560607402,
-			-0.6314881353731734,
-			-0.6313527954493779,
-			-0.6312174362934766,
-			-0.6310820579095926,
-			-0.6309466603018499,
-			-0.6308112434743729,
-			-0.6306758074312858,
-			-0.6305403521767164,
-			-0.6304048777147890,
-			-0.6302693840496302,
-			-0.6301338711853695,
-			-0.6299983391261326,
-			-0.6298627878760490,
-			-0.6297272174392476,
-			-0.6295916278198584,
-			-0.6294560190220115,
-			-0.6293203910498371,
-			-0.6291847439074688,
-			-0.6290490775990365,
-			-0.6289133921286728,
-			-0.6287776875005131,
-			-0.6286419637186884,
-			-0.6285062207873358,
-			-0.6283704587105883,
-			-0.6282346774925820,
-			-0.6280988771374530,
-			-0.6279630576493377,
-			-0.6278272190323750,
-			-0.6276913612907009,
-			-0.6275554844284547,
-			-0.6274195884497752,
-			-0.6272836733588014,
-			-0.6271477391596757,
-			-0.6270117858565361,
-			-0.6268758134535258,
-			-0.6267398219547872,
-			-0.6266038113644603,
-			-0.6264677816866907,
-			-0.6263317329256212,
-			-0.6261956650853967,
-			-0.6260595781701601,
-			-0.6259234721840590,
-			-0.6257873471312392,
-			-0.6256512030158454,
-			-0.6255150398420269,
-			-0.6253788576139314,
-			-0.6252426563357051,
-			-0.6251064360114991,
-			-0.6249701966454622,
-			-0.6248339382417450,
-			-0.6246976608044965,
-			-0.6245613643378697,
-			-0.6244250488460165,
-			-0.6242887143330872,
-			-0.6241523608032369,
-			-0.6240159882606192,
-			-0.6238795967093862,
-			-0.6237431861536946,
-			-0.6236067565976990,
-			-0.6234703080455554,
-			-0.6233338405014208,
-			-0.6231973539694503,
-			-0.6230608484538036,
-			-0.6229243239586381,
-			-0.6227877804881126,
-			-0.6226512180463865,
-			-0.6225146366376196,
-			-0.6223780362659727,
-			-0.6222414169356065,
-			-0.6221047786506829,
-			-0.6219681214153642,
-			-0.6218314452338124,
-			-0.6216947501101929,
-			-0.6215580360486678,
-			-0.6214213030534022,
-			-0.6212845511285612,
-			-0.6211477802783105,
-			-0.6210109905068165,
-			-0.6208741818182461,
-			-0.6207373542167665,
-			-0.6206005077065458,
-			-0.6204636422917520,
-			-0.6203267579765562,
-			-0.6201898547651261,
-			-0.6200529326616329,
-			-0.6199159916702470,
-			-0.6197790317951404,
-			-0.6196420530404848,
-			-0.6195050554104530,
-			-0.6193680389092180,
-			-0.6192310035409536,
-			-0.6190939493098343,
-			-0.6189568762200348,
-			-0.6188197842757308,
-			-0.6186826734810982,
-			-0.6185455438403137,
-			-0.6184083953575538,
-			-0.6182712280369983,
-			-0.6181340418828229,
-			-0.6179968368992093,
-			-0.6178596130903348,
-			-0.6177223704603801,
-			-0.6175851090135261,
-			-0.6174478287539533,
-			-0.6173105296858454,
-			-0.6171732118133828,
-			-0.6170358751407484,
-			-0.6168985196721278,
-			-0.6167611454117023,
-			-0.6166237523636587,
-			-0.6164863405321823,
-			-0.6163489099214573,
-			-0.6162114605356702,
-			-0.6160739923790094,
-			-0.6159365054556623,
-			-0.6157989997698157,
-			-0.6156614753256581,
-			-0.6155239321273810,
-			-0.6153863701791720,
-			-0.6152487894852215,
-			-0.6151111900497227,
-			-0.6149735718768641,
-			-0.6148359349708408,
-			-0.6146982793358423,
-			-0.6145606049760650,
-			-0.6144229118957005,
-			-0.6142852000989432,
-			-0.6141474695899892,
-			-0.6140097203730336,
-			-0.6138719524522723,
-			-0.6137341658319021,
-			-0.6135963605161209,
-			-0.6134585365091249,
-			-0.6133206938151127,
-			-0.6131828324382844,
-			-0.6130449523828390,
-			-0.6129070536529765,
-			-0.6127691362528982,
-			-0.6126312001868032,
-			-0.6124932454588954,
-			-0.6123552720733765,
-			-0.6122172800344493,
-			-0.6120792693463181,
-			-0.6119412400131847,
-			-0.6118031920392559,
-			-0.6116651254287362,
-			-0.6115270401858313,
-			-0.6113889363147474,
-			-0.6112508138196917,
-			-0.6111126727048721,
-			-0.6109745129744947,
-			-0.6108363346327700,
-			-0.6106981376839065,
-			-0.6105599221321140,
-			-0.6104216879816027,
-			-0.6102834352365835,
-			-0.6101451639012678,
-			-0.6100068739798676,
-			-0.6098685654765954,
-			-0.6097302383956644,
-			-0.6095918927412883,
-			-0.6094535285176813,
-			-0.6093151457290582,
-			-0.6091767443796343,
-			-0.6090383244736250,
-			-0.6088998860152489,
-			-0.6087614290087209,
-			-0.6086229534582593,
-			-0.6084844593680825,
-			-0.6083459467424090,
-			-0.6082074155854584,
-			-0.6080688659014498,
-			-0.6079302976946057,
-			-0.6077917109691451,
-			-0.6076531057292902,
-			-0.6075144819792633,
-			-0.6073758397232870,
-			-0.6072371789655847,
-			-0.6070984997103794,
-			-0.6069598019618978,
-			-0.6068210857243626,
-			-0.6066823510020001,
-			-0.6065435977990363,
-			-0.6064048261196975,
-			-0.6062660359682126,
-			-0.6061272273488076,
-			-0.6059884002657114,
-			-0.6058495547231530,
-			-0.6057106907253611,
-			-0.6055718082765672,
-			-0.6054329073810019,
-			-0.6052939880428941,
-			-0.6051550502664785,
-			-0.6050160940559854,
-			-0.6048771194156480,
-			-0.6047381263496994,
-			-0.6045991148623746,
-			-0.6044600849579085,
-			-0.6043210366405337,
-			-0.6041819699144890,
-			-0.6040428847840076,
-			-0.6039037812533284,
-			-0.6037646593266882,
-			-0.6036255190083247,
-			-0.6034863603024772,
-			-0.6033471832133825,
-			-0.6032079877452831,
-			-0.6030687739024169,
-			-0.6029295416890246,
-			-0.6027902911093490,
-			-0.6026510221676311,
-			-0.6025117348681140,
-			-0.6023724292150393,
-			-0.6022331052126504,
-			-0.6020937628651928,
-			-0.6019544021769103,
-			-0.6018150231520483,
-			-0.6016756257948530,
-			-0.6015362101095687,
-			-0.6013967761004443,
-			-0.6012573237717266,
-			-0.6011178531276634,
-			-0.6009783641725034,
-			-0.6008388569104955,
-			-0.6006993313458902,
-			-0.6005597874829354,
-			-0.6004202253258841,
-			-0.6002806448789869,
-			-0.6001410461464955,
-			-0.6000014291326626,
-			-0.5998617938417410,
-			-0.5997221402779850,
-			-0.5995824684456464,
-			-0.5994427783489815,
-			-0.5993030699922468,
-			-0.5991633433796959,
-			-0.5990235985155860,
-			-0.5988838354041738,
-			-0.5987440540497166,
-			-0.5986042544564728,
-			-0.5984644366287006,
-			-0.5983246005706593,
-			-0.5981847462866082,
-			-0.5980448737808080,
-			-0.5979049830575190,
-			-0.5977650741210029,
-			-0.5976251469755214,
-			-0.5974852016253368,
-			-0.5973452380747123,
-			-0.5972052563279112,
-			-0.5970652563891978,
-			-0.5969252382628367,
-			-0.5967852019530930,
-			-0.5966451474642318,
-			-0.5965050748005215,
-			-0.5963649839662269,
-			-0.5962248749656162,
-			-0.5960847478029571,
-			-0.5959446024825176,
-			-0.5958044390085687,
-			-0.5956642573853775,
-			-0.5955240576172168,
-			-0.5953838397083553,
-			-0.5952436036630642,
-			-0.5951033494856168,
-			-0.5949630771802847,
-			-0.5948227867513417,
-			-0.5946824782030598,
-			-0.5945421515397136,
-			-0.5944018067655780,
-			-0.5942614438849271,
-			-0.5941210629020383,
-			-0.5939806638211876,
-			-0.5938402466466507,
-			-0.5936998113827053,
-			-0.5935593580336289,
-			-0.5934188866037019,
-			-0.5932783970972012,
-			-0.5931378895184065,
-			-0.5929973638715998,
-			-0.5928568201610590,
-			-0.5927162583910683,
-			-0.5925756785659072,
-			-0.5924350806898580,
-			-0.5922944647672048,
-			-0.5921538308022307,
-			-0.5920131787992201,
-			-0.5918725087624561,
-			-0.5917318206962239,
-			-0.5915911146048103,
-			-0.5914503904925008,
-			-0.5913096483635822,
-			-0.5911688882223418,
-			-0.5910281100730680,
-			-0.5908873139200470,
-			-0.5907464997675699,
-			-0.5906056676199253,
-			-0.5904648174814033,
-			-0.5903239493562945,
-			-0.5901830632488906,
-			-0.5900421591634811,
-			-0.5899012371043604,
-			-0.5897602970758204,
-			-0.5896193390821546,
-			-0.5894783631276572,
-			-0.5893373692166207,
-			-0.5891963573533429,
-			-0.5890553275421161,
-			-0.5889142797872388,
-			-0.5887732140930066,
-			-0.5886321304637168,
-			-0.5884910289036670,
-			-0.5883499094171553,
-			-0.5882087720084805,
-			-0.5880676166819419,
-			-0.5879264434418394,
-			-0.5877852522924732,
-			-0.5876440432381445,
-			-0.5875028162831546,
-			-0.5873615714318055,
-			-0.5872203086883998,
-			-0.5870790280572407,
-			-0.5869377295426316,
-			-0.5867964131488770,
-			-0.5866550788802815,
-			-0.5865137267411497,
-			-0.5863723567357895,
-			-0.5862309688685052,
-			-0.5860895631436045,
-			-0.5859481395653948,
-			-0.5858066981381841,
-			-0.5856652388662816,
-			-0.5855237617539943,
-			-0.5853822668056334,
-			-0.5852407540255103,
-			-0.5850992234179339,
-			-0.5849576749872157,
-			-0.5848161087376680,
-			-0.5846745246736028,
-			-0.5845329227993331,
-			-0.5843913031191718,
-			-0.5842496656374347,
-			-0.5841080103584345,
-			-0.5839663372864868,
-			-0.5838246464259074,
-			-0.5836829377810121,
-			-0.5835412113561171,
-			-0.5833994671555419,
-			-0.5832577051836020,
-			-0.5831159254446163,
-			-0.5829741279429030,
-			-0.5828323126827839,
-			-0.5826904796685766,
-			-0.5825486289046014,
-			-0.5824067603951818,
-			-0.5822648741446370,
-			-0.5821229701572899,
-			-0.5819810484374625,
-			-0.5818391089894791,
-			-0.5816971518176639,
-			-0.5815551769263386,
-			-0.5814131843198311,
-			-0.5812711740024645,
-			-0.5811291459785648,
-			-0.5809871002524596,
-			-0.5808450368284754,
-			-0.5807029557109403,
-			-0.5805608569041802,
-			-0.5804187404125266,
-			-0.5802766062403064,
-			-0.5801344543918493,
-			-0.5799922848714868,
-			-0.5798500976835491,
-			-0.5797078928323673,
-			-0.5795656703222741,
-			-0.5794234301575996,
-			-0.5792811723426795,
-			-0.5791388968818444,
-			-0.5789966037794304,
-			-0.5788542930397721,
-			-0.5787119646672022,
-			-0.5785696186660593,
-			-0.5784272550406766,
-			-0.5782848737953927,
-			-0.5781424749345444,
-			-0.5780000584624692,
-			-0.5778576243835061,
-			-0.5777151727019918,
-			-0.5775727034222676,
-			-0.5774302165486729,
-			-0.5772877120855480,
-			-0.5771451900372337,
-			-0.5770026504080716,
-			-0.5768600932024045,
-			-0.5767175184245726,
-			-0.5765749260789212,
-			-0.5764323161697934,
-			-0.5762896887015330,
-			-0.5761470436784849,
-			-0.5760043811049942,
-			-0.5758617009854068,
-			-0.5757190033240688,
-			-0.5755762881253271,
-			-0.5754335553935291,
-			-0.5752908051330228,
-			-0.5751480373481563,
-			-0.5750052520432795,
-			-0.5748624492227397,
-			-0.5747196288908882,
-			-0.5745767910520774,
-			-0.5744339357106558,
-			-0.5742910628709759,
-			-0.5741481725373899,
-			-0.5740052647142505,
-			-0.5738623394059108,
-			-0.5737193966167240,
-			-0.5735764363510464,
-			-0.5734334586132307,
-			-0.5732904634076330,
-			-0.5731474507386092,
-			-0.5730044206105156,
-			-0.5728613730277093,
-			-0.5727183079945470,
-			-0.5725752255153889,
-			-0.5724321255945912,
-			-0.5722890082365132,
-			-0.5721458734455166,
-			-0.5720027212259586,
-			-0.5718595515822028,
-			-0.5717163645186082,
-			-0.5715731600395373,
-			-0.5714299381493523,
-			-0.5712866988524152,
-			-0.5711434421530910,
-			-0.5710001680557433,
-			-0.5708568765647344,
-			-0.5707135676844322,
-			-0.5705702414191998,
-			-0.5704268977734039,
-			-0.5702835367514105,
-			-0.5701401583575878,
-			-0.5699967625963036,
-			-0.5698533494719236,
-			-0.5697099189888194,
-			-0.5695664711513579,
-			-0.5694230059639089,
-			-0.5692795234308441,
-			-0.5691360235565333,
-			-0.5689925063453485,
-			-0.5688489718016601,
-			-0.5687054199298405,
-			-0.5685618507342646,
-			-0.5684182642193029,
-			-0.5682746603893314,
-			-0.5681310392487239,
-			-0.5679874008018561,
-			-0.5678437450531020,
-			-0.5677000720068375,
-			-0.5675563816674406,
-			-0.5674126740392877,
-			-0.5672689491267564,
-			-0.5671252069342256,
-			-0.5669814474660716,
-			-0.5668376707266758,
-			-0.5666938767204172,
-			-0.5665500654516760,
-			-0.5664062369248328,
-			-0.5662623911442691,
-			-0.5661185281143674,
-			-0.5659746478395077,
-			-0.5658307503240750,
-			-0.5656868355724521,
-			-0.5655429035890228,
-			-0.5653989543781716,
-			-0.5652549879442833,
-			-0.5651110042917434,
-			-0.5649670034249380,
-			-0.5648229853482536,
-			-0.5646789500660772,
-			-0.5645348975827963,
-			-0.5643908279027992,
-			-0.5642467410304749,
-			-0.5641026369702107,
-			-0.5639585157263982,
-			-0.5638143773034270,
-			-0.5636702217056877,
-			-0.5635260489375716,
-			-0.5633818590034705,
-			-0.5632376519077766,
-			-0.5630934276548827,
-			-0.5629491862491822,
-			-0.5628049276950688,
-			-0.5626606519969370,
-			-0.5625163591591816,
-			-0.5623720491861981,
-			-0.5622277220823824,
-			-0.5620833778521309,
-			-0.5619390164998399,
-			-0.5617946380299090,
-			-0.5616502424467342,
-			-0.5615058297547146,
-			-0.5613613999582494,
-			-0.5612169530617375,
-			-0.5610724890695808,
-			-0.5609280079861783,
-			-0.5607835098159315,
-			-0.5606389945632421,
-			-0.5604944622325116,
-			-0.5603499128281443,
-			-0.5602053463545432,
-			-0.5600607628161108,
-			-0.5599161622172519,
-			-0.5597715445623714,
-			-0.5596269098558747,
-			-0.5594822581021675,
-			-0.5593375893056552,
-			-0.5591929034707472,
-			-0.5590482006018487,
-			-0.5589034807033681,
-			-0.5587587437797131,
-			-0.5586139898352951,
-			-0.5584692188745211,
-			-0.5583244309018012,
-			-0.5581796259215480,
-			-0.5580348039381696,
-			-0.5578899649560799,
-			-0.5577451089796907,
-			-0.5576002360134125,
-			-0.5574553460616606,
-			-0.5573104391288478,
-			-0.5571655152193890,
-			-0.5570205743376972,
-			-0.5568756164881878,
-			-0.5567306416752780,
-			-0.5565856499033829,
-			-0.5564406411769194,
-			-0.5562956155003054,
-			-0.5561505728779573,
-			-0.5560055133142932,
-			-0.5558604368137334,
-			-0.5557153433806965,
-			-0.5555702330196030,
-			-0.5554251057348708,
-			-0.5552799615309240,
-			-0.5551348004121808,
-			-0.5549896223830654,
-			-0.5548444274479992,
-			-0.5546992156114054,
-			-0.5545539868777080,
-			-0.5544087412513287,
-			-0.5542634787366941,
-			-0.5541181993382285,
-			-0.5539729030603573,
-			-0.5538275899075066,
-			-0.5536822598841027,
-			-0.5535369129945727,
-			-0.5533915492433441,
-			-0.5532461686348451,
-			-0.5531007711735040,
-			-0.5529553568637500,
-			-0.5528099257100125,
-			-0.5526644777167219,
-			-0.5525190128883086,
-			-0.5523735312292036,
-			-0.5522280327438388,
-			-0.5520825174366462,
-			-0.5519369853120584,
-			-0.5517914363745086,
-			-0.5516458706284312,
-			-0.5515002880782582,
-			-0.5513546887284265,
-			-0.5512090725833706,
-			-0.5510634396475261,
-			-0.5509177899253295,
-			-0.5507721234212173,
-			-0.5506264401396268,
-			-0.5504807400849958,
-			-0.5503350232617619,
-			-0.5501892896743660,
-			-0.5500435393272451,
-			-0.5498977722248400,
-			-0.5497519883715910,
-			-0.5496061877719387,
-			-0.5494603704303245,
-			-0.5493145363511897,
-			-0.5491686855389786,
-			-0.5490228179981321,
-			-0.5488769337330942,
-			-0.5487310327483088,
-			-0.5485851150482196,
-			-0.5484391806372729,
-			-0.5482932295199142,
-			-0.5481472617005879,
-			-0.5480012771837413,
-			-0.5478552759738203,
-			-0.5477092580752749,
-			-0.5475632234925507,
-			-0.5474171722300961,
-			-0.5472711042923625,
-			-0.5471250196837969,
-			-0.5469789184088494,
-			-0.5468328004719728,
-			-0.5466866658776152,
-			-0.5465405146302308,
-			-0.5463943467342689,
-			-0.5462481621941848,
-			-0.5461019610144295,
-			-0.5459557431994566,
-			-0.5458095087537214,
-			-0.5456632576816778,
-			-0.5455169899877816,
-			-0.5453707056764869,
-			-0.5452244047522506,
-			-0.5450780872195292,
-			-0.5449317530827790,
-			-0.5447854023464591,
-			-0.5446390350150270,
-			-0.5444926510929411,
-			-0.5443462505846614,
-			-0.5441998334946451,
-			-0.5440533998273555,
-			-0.5439069495872502,
-			-0.5437604827787924,
-			-0.5436139994064439,
-			-0.5434674994746647,
-			-0.5433209829879194,
-			-0.5431744499506707,
-			-0.5430279003673819,
-			-0.5428813342425175,
-			-0.5427347515805420,
-			-0.5425881523859213,
-			-0.5424415366631188,
-			-0.5422949044166030,
-			-0.5421482556508398,
-			-0.5420015903702963,
-			-0.5418549085794403,
-			-0.5417082102827400,
-			-0.5415614954846646,
-			-0.5414147641896813,
-			-0.5412680164022620,
-			-0.5411212521268759,
-			-0.5409744713679940,
-			-0.5408276741300874,
-			-0.5406808604176285,
-			-0.5405340302350873,
-			-0.5403871835869387,
-			-0.5402403204776551,
-			-0.5400934409117105,
-			-0.5399465448935787,
-			-0.5397996324277348,
-			-0.5396527035186537,
-			-0.5395057581708113,
-			-0.5393587963886829,
-			-0.5392118181767476,
-			-0.5390648235394803,
-			-0.5389178124813594,
-			-0.5387707850068633,
-			-0.5386237411204706,
-			-0.5384766808266604,
-			-0.5383296041299119,
-			-0.5381825110347075,
-			-0.5380354015455254,
-			-0.5378882756668479,
-			-0.5377411334031565,
-			-0.5375939747589329,
-			-0.5374467997386617,
-			-0.5372996083468242,
-			-0.5371524005879046,
-			-0.5370051764663872,
-			-0.5368579359867561,
-			-0.5367106791534985,
-			-0.5365634059710980,
-			-0.5364161164440415,
-			-0.5362688105768157,
-			-0.5361214883739078,
-			-0.5359741498398055,
-			-0.5358267949789971,
-			-0.5356794237959702,
-			-0.5355320362952166,
-			-0.5353846324812228,
-			-0.5352372123584820,
-			-0.5350897759314827,
-			-0.5349423232047167,
-			-0.5347948541826749,
-			-0.5346473688698511,
-			-0.5344998672707378,
-			-0.5343523493898261,
-			-0.5342048152316126,
-			-0.5340572648005890,
-			-0.5339096981012502,
-			-0.5337621151380927,
-			-0.5336145159156114,
-			-0.5334669004383031,
-			-0.5333192687106632,
-			-0.5331716207371885,
-			-0.5330239565223790,
-			-0.5328762760707298,
-			-0.5327285793867419,
-			-0.5325808664749142,
-			-0.5324331373397447,
-			-0.5322853919857339,
-			-0.5321376304173834,
-			-0.5319898526391938,
-			-0.5318420586556675,
-			-0.5316942484713041,
-			-0.5315464220906092,
-			-0.5313985795180829,
-			-0.5312507207582309,
-			-0.5311028458155567,
-			-0.5309549546945646,
-			-0.5308070473997597,
-			-0.5306591239356475,
-			-0.5305111843067348,
-			-0.5303632285175258,
-			-0.5302152565725291,
-			-0.5300672684762536,
-			-0.5299192642332050,
-			-0.5297712438478925,
-			-0.5296232073248252,
-			-0.5294751546685124,
-			-0.5293270858834641,
-			-0.5291790009741907,
-			-0.5290308999452031,
-			-0.5288827828010130,
-			-0.5287346495461318,
-			-0.5285865001850724,
-			-0.5284383347223472,
-			-0.5282901531624701,
-			-0.5281419555099546,
-			-0.5279937417693151,
-			-0.5278455119450673,
-			-0.5276972660417243,
-			-0.5275490040638041,
-			-0.5274007260158223,
-			-0.5272524319022956,
-			-0.5271041217277416,
-			-0.5269557954966778,
-			-0.5268074532136225,
-			-0.5266590948830946,
-			-0.5265107205096126,
-			-0.5263623300976983,
-			-0.5262139236518698,
-			-0.5260655011766486,
-			-0.5259170626765559,
-			-0.5257686081561135,
-			-0.5256201376198433,
-			-0.5254716510722673,
-			-0.5253231485179112,
-			-0.5251746299612960,
-			-0.5250260954069469,
-			-0.5248775448593883,
-			-0.5247289783231447,
-			-0.5245803958027432,
-			-0.5244317973027097,
-			-0.5242831828275695,
-			-0.5241345523818502,
-			-0.5239859059700795,
-			-0.5238372435967854,
-			-0.5236885652664964,
-			-0.5235398709837407,
-			-0.5233911607530500,
-			-0.5232424345789523,
-			-0.5230936924659785,
-			-0.5229449344186595,
-			-0.5227961604415263,
-			-0.5226473705391129,
-			-0.5224985647159486,
-			-0.5223497429765694,
-			-0.5222009053255064,
-			-0.5220520517672935,
-			-0.5219031823064673,
-			-0.5217542969475595,
-			-0.5216053956951077,
-			-0.5214564785536476,
-			-0.5213075455277142,
-			-0.5211585966218449,
-			-0.5210096318405762,
-			-0.5208606511884473,
-			-0.5207116546699957,
-			-0.5205626422897600,
-			-0.5204136140522803,
-			-0.5202645699620946,
-			-0.5201155100237431,
-			-0.5199664342417679,
-			-0.5198173426207094,
-			-0.5196682351651100,
-			-0.5195191118795093,
-			-0.5193699727684531,
-			-0.5192208178364813,
-			-0.5190716470881397,
-			-0.5189224605279716,
-			-0.5187732581605214,
-			-0.5186240399903349,
-			-0.5184748060219553,
-			-0.5183255562599306,
-			-0.5181762907088074,
-			-0.5180270093731303,
-			-0.5178777122574488,
-			-0.5177283993663101,
-			-0.5175790707042626,
-			-0.5174297262758550,
-			-0.5172803660856367,
-			-0.5171309901381573,
-			-0.5169815984379672,
-			-0.5168321909896170,
-			-0.5166827677976589,
-			-0.5165333288666420,
-			-0.5163838742011210,
-			-0.5162344038056477,
-			-0.5160849176847752,
-			-0.5159354158430571,
-			-0.5157858982850476,
-			-0.5156363650153020,
-			-0.5154868160383729,
-			-0.5153372513588175,
-			-0.5151876709811933,
-			-0.5150380749100545,
-			-0.5148884631499587,
-			-0.5147388357054634,
-			-0.5145891925811267,
-			-0.5144395337815068,
-			-0.5142898593111617,
-			-0.5141401691746532,
-			-0.5139904633765389,
-			-0.5138407419213797,
-			-0.5136910048137364,
-			-0.5135412520581705,
-			-0.5133914836592426,
-			-0.5132416996215173,
-			-0.5130918999495552,
-			-0.5129420846479199,
-			-0.5127922537211753,
-			-0.5126424071738854,
-			-0.5124925450106148,
-			-0.5123426672359279,
-			-0.5121927738543923,
-			-0.5120428648705719,
-			-0.5118929402890340,
-			-0.5117430001143454,
-			-0.5115930443510728,
-			-0.5114430730037866,
-			-0.5112930860770518,
-			-0.5111430835754406,
-			-0.5109930655035199,
-			-0.5108430318658596,
-			-0.5106929826670322,
-			-0.5105429179116054,
-			-0.5103928376041537,
-			-0.5102427417492454,
-			-0.5100926303514561,
-			-0.5099425034153559,
-			-0.5097923609455181,
-			-0.5096422029465175,
-			-0.5094920294229279,
-			-0.5093418403793243,
-			-0.5091916358202802,
-			-0.5090414157503719,
-			-0.5088911801741755,
-			-0.5087409290962663,
-			-0.5085906625212232,
-			-0.5084403804536234,
-			-0.5082900828980422,
-			-0.5081397698590614,
-			-0.5079894413412566,
-			-0.5078390973492092,
-			-0.5076887378874982,
-			-0.5075383629607041,
-			-0.5073879725734081,
-			-0.5072375667301890,
-			-0.5070871454356309,
-			-0.5069367086943158,
-			-0.5067862565108240,
-			-0.5066357888897408,
-			-0.5064853058356490,
-			-0.5063348073531333,
-			-0.5061842934467758,
-			-0.5060337641211639,
-			-0.5058832193808819,
-			-0.5057326592305159,
-			-0.5055820836746522,
-			-0.5054314927178776,
-			-0.5052808863647800,
-			-0.5051302646199449,
-			-0.5049796274879629,
-			-0.5048289749734218,
-			-0.5046783070809108,
-			-0.5045276238150194,
-			-0.5043769251803385,
-			-0.5042262111814564,
-			-0.5040754818229656,
-			-0.5039247371094591,
-			-0.5037739770455264,
-			-0.5036232016357610,
-			-0.5034724108847556,
-			-0.5033216047971035,
-			-0.5031707833773986,
-			-0.5030199466302345,
-			-0.5028690945602081,
-			-0.5027182271719123,
-			-0.5025673444699437,
-			-0.5024164464588983,
-			-0.5022655331433727,
-			-0.5021146045279642,
-			-0.5019636606172702,
-			-0.5018127014158887,
-			-0.5016617269284183,
-			-0.5015107371594577,
-			-0.5013597321136065,
-			-0.5012087117954638,
-			-0.5010576762096322,
-			-0.5009066253607103,
-			-0.5007555592533000,
-			-0.5006044778920030,
-			-0.5004533812814209,
-			-0.5003022694261580,
-			-0.5001511423308170,
-			-0.5000000000000004,
-			-0.4998488424383128,
-			-0.4996976696503588,
-			-0.4995464816407433,
-			-0.4993952784140718,
-			-0.4992440599749495,
-			-0.4990928263279850,
-			-0.4989415774777822,
-			-0.4987903134289513,
-			-0.4986390341860978,
-			-0.4984877397538308,
-			-0.4983364301367582,
-			-0.4981851053394906,
-			-0.4980337653666377,
-			-0.4978824102228079,
-			-0.4977310399126127,
-			-0.4975796544406631,
-			-0.4974282538115696,
-			-0.4972768380299459,
-			-0.4971254071004042,
-			-0.4969739610275559,
-			-0.4968224998160151,
-			-0.4966710234703948,
-			-0.4965195319953106,
-			-0.4963680253953767,
-			-0.4962165036752081,
-			-0.4960649668394211,
-			-0.4959134148926305,
-			-0.4957618478394526,
-			-0.4956102656845060,
-			-0.4954586684324074,
-			-0.4953070560877748,
-			-0.4951554286552264,
-			-0.4950037861393820,
-			-0.4948521285448584,
-			-0.4947004558762778,
-			-0.4945487681382596,
-			-0.4943970653354244,
-			-0.4942453474723935,
-			-0.4940936145537883,
-			-0.4939418665842317,
-			-0.4937901035683448,
-			-0.4936383255107503,
-			-0.4934865324160734,
-			-0.4933347242889371,
-			-0.4931829011339657,
-			-0.4930310629557849,
-			-0.4928792097590175,
-			-0.4927273415482917,
-			-0.4925754583282327,
-			-0.4924235601034672,
-			-0.4922716468786231,
-			-0.4921197186583257,
-			-0.4919677754472051,
-			-0.4918158172498892,
-			-0.4916638440710067,
-			-0.4915118559151871,
-			-0.4913598527870603,
-			-0.4912078346912572,
-			-0.4910558016324063,
-			-0.4909037536151410,
-			-0.4907516906440924,
-			-0.4905996127238915,
-			-0.4904475198591735,
-			-0.4902954120545689,
-			-0.4901432893147121,
-			-0.4899911516442368,
-			-0.4898389990477768,
-			-0.4896868315299692,
-			-0.4895346490954469,
-			-0.4893824517488465,
-			-0.4892302394948042,
-			-0.4890780123379566,
-			-0.4889257702829400,
-			-0.4887735133343943,
-			-0.4886212414969553,
-			-0.4884689547752621,
-			-0.4883166531739537,
-			-0.4881643366976694,
-			-0.4880120053510491,
-			-0.4878596591387323,
-			-0.4877072980653620,
-			-0.4875549221355771,
-			-0.4874025313540200,
-			-0.4872501257253327,
-			-0.4870977052541580,
-			-0.4869452699451386,
-			-0.4867928198029173,
-			-0.4866403548321403,
-			-0.4864878750374497,
-			-0.4863353804234909,
-			-0.4861828709949094,
-			-0.4860303467563500,
-			-0.4858778077124603,
-			-0.4857252538678862,
-			-0.4855726852272757,
-			-0.4854201017952745,
-			-0.4852675035765307,
-			-0.4851148905756942,
-			-0.4849622627974132,
-			-0.4848096202463368,
-			-0.4846569629271157,
-			-0.4845042908443986,
-			-0.4843516040028367,
-			-0.4841989024070806,
-			-0.4840461860617832,
-			-0.4838934549715966,
-			-0.4837407091411709,
-			-0.4835879485751621,
-			-0.4834351732782206,
-			-0.4832823832550023,
-			-0.4831295785101608,
-			-0.4829767590483507,
-			-0.4828239248742281,
-			-0.4826710759924461,
-			-0.4825182124076640,
-			-0.4823653341245358,
-			-0.4822124411477185,
-			-0.4820595334818711,
-			-0.4819066111316506,
-			-0.4817536741017160,
-			-0.4816007223967239,
-			-0.4814477560213355,
-			-0.4812947749802100,
-			-0.4811417792780072,
-			-0.4809887689193877,
-			-0.4808357439090125,
-			-0.4806827042515429,
-			-0.4805296499516408,
-			-0.4803765810139686,
-			-0.4802234974431890,
-			-0.4800703992439651,
-			-0.4799172864209607,
-			-0.4797641589788405,
-			-0.4796110169222667,
-			-0.4794578602559068,
-			-0.4793046889844252,
-			-0.4791515031124879,
-			-0.4789983026447612,
-			-0.4788450875859118,
-			-0.4786918579406078,
-			-0.4785386137135143,
-			-0.4783853549093011,
-			-0.4782320815326382,
-			-0.4780787935881924,
-			-0.4779254910806337,
-			-0.4777721740146321,
-			-0.4776188423948578,
-			-0.4774654962259816,
-			-0.4773121355126747,
-			-0.4771587602596087,
-			-0.4770053704714557,
-			-0.4768519661528882,
-			-0.4766985473085792,
-			-0.4765451139432021,
-			-0.4763916660614300,
-			-0.4762382036679395,
-			-0.4760847267674029,
-			-0.4759312353644962,
-			-0.4757777294638943,
-			-0.4756242090702756,
-			-0.4754706741883142,
-			-0.4753171248226871,
-			-0.4751635609780739,
-			-0.4750099826591502,
-			-0.4748563898705950,
-			-0.4747027826170870,
-			-0.4745491609033046,
-			-0.4743955247339298,
-			-0.4742418741136392,
-			-0.4740882090471167,
-			-0.4739345295390408,
-			-0.4737808355940927,
-			-0.4736271272169560,
-			-0.4734734044123118,
-			-0.4733196671848439,
-			-0.4731659155392337,
-			-0.4730121494801653,
-			-0.4728583690123230,
-			-0.4727045741403904,
-			-0.4725507648690538,
-			-0.4723969412029985,
-			-0.4722431031469080,
-			-0.4720892507054715,
-			-0.4719353838833725,
-			-0.4717815026853013,
-			-0.4716276071159421,
-			-0.4714736971799852,
-			-0.4713197728821191,
-			-0.4711658342270301,
-			-0.4710118812194107,
-			-0.4708579138639473,
-			-0.4707039321653325,
-			-0.4705499361282559,
-			-0.4703959257574087,
-			-0.4702419010574830,
-			-0.4700878620331682,
-			-0.4699338086891592,
-			-0.4697797410301477,
-			-0.4696256590608270,
-			-0.4694715627858908,
-			-0.4693174522100329,
-			-0.4691633273379487,
-			-0.4690091881743307,
-			-0.4688550347238767,
-			-0.4687008669912817,
-			-0.4685466849812418,
-			-0.4683924886984537,
-			-0.4682382781476154,
-			-0.4680840533334218,
-			-0.4679298142605735,
-			-0.4677755609337678,
-			-0.4676212933577039,
-			-0.4674670115370807,
-			-0.4673127154765981,
-			-0.4671584051809569,
-			-0.4670040806548554,
-			-0.4668497419029962,
-			-0.4666953889300822,
-			-0.4665410217408129,
-			-0.4663866403398914,
-			-0.4662322447320204,
-			-0.4660778349219031,
-			-0.4659234109142432,
-			-0.4657689727137437,
-			-0.4656145203251116,
-			-0.4654600537530494,
-			-0.4653055730022631,
-			-0.4651510780774586,
-			-0.4649965689833420,
-			-0.4648420457246199,
-			-0.4646875083059994,
-			-0.4645329567321879,
-			-0.4643783910078935,
-			-0.4642238111378235,
-			-0.4640692171266892,
-			-0.4639146089791974,
-			-0.4637599867000585,
-			-0.4636053502939825,
-			-0.4634506997656801,
-			-0.4632960351198629,
-			-0.4631413563612398,
-			-0.4629866634945243,
-			-0.4628319565244300,
-			-0.4626772354556667,
-			-0.4625225002929503,
-			-0.4623677510409922,
-			-0.4622129877045070,
-			-0.4620582102882082,
-			-0.4619034187968122,
-			-0.4617486132350344,
-			-0.4615937936075878,
-			-0.4614389599191919,
-			-0.4612841121745607,
-			-0.4611292503784118,
-			-0.4609743745354621,
-			-0.4608194846504307,
-			-0.4606645807280358,
-			-0.4605096627729945,
-			-0.4603547307900261,
-			-0.4601997847838522,
-			-0.4600448247591897,
-			-0.4598898507207612,
-			-0.4597348626732876,
-			-0.4595798606214884,
-			-0.4594248445700862,
-			-0.4592698145238022,
-			-0.4591147704873603,
-			-0.4589597124654837,
-			-0.4588046404628931,
-			-0.4586495544843156,
-			-0.4584944545344730,
-			-0.4583393406180897,
-			-0.4581842127398926,
-			-0.4580290709046063,
-			-0.4578739151169567,
-			-0.4577187453816700,
-			-0.4575635617034738,
-			-0.4574083640870937,
-			-0.4572531525372573,
-			-0.4570979270586941,
-			-0.4569426876561319,
-			-0.4567874343342995,
-			-0.4566321670979261,
-			-0.4564768859517415,
-			-0.4563215909004766,
-			-0.4561662819488597,
-			-0.4560109591016239,
-			-0.4558556223635000,
-			-0.4557002717392198,
-			-0.4555449072335164,
-			-0.4553895288511199,
-			-0.4552341365967660,
-			-0.4550787304751873,
-			-0.4549233104911178,
-			-0.4547678766492925,
-			-0.4546124289544441,
-			-0.4544569674113099,
-			-0.4543014920246249,
-			-0.4541460027991251,
-			-0.4539904997395469,
-			-0.4538349828506274,
-			-0.4536794521371037,
-			-0.4535239076037136,
-			-0.4533683492551954,
-			-0.4532127770962875,
-			-0.4530571911317289,
-			-0.4529015913662591,
-			-0.4527459778046179,
-			-0.4525903504515457,
-			-0.4524347093117830,
-			-0.4522790543900709,
-			-0.4521233856911510,
-			-0.4519677032197652,
-			-0.4518120069806559,
-			-0.4516562969785659,
-			-0.4515005732182383,
-			-0.4513448357044160,
-			-0.4511890844418454,
-			-0.4510333194352685,
-			-0.4508775406894311,
-			-0.4507217482090784,
-			-0.4505659419989562,
-			-0.4504101220638105,
-			-0.4502542884083871,
-			-0.4500984410374354,
-			-0.4499425799557004,
-			-0.4497867051679306,
-			-0.4496308166788743,
-			-0.4494749144932801,
-			-0.4493189986158970,
-			-0.4491630690514739,
-			-0.4490071258047628,
-			-0.4488511688805117,
-			-0.4486951982834714,
-			-0.4485392140183954,
-			-0.4483832160900320,
-			-0.4482272045031356,
-			-0.4480711792624585,
-			-0.4479151403727521,
-			-0.4477590878387702,
-			-0.4476030216652658,
-			-0.4474469418569945,
-			-0.4472908484187107,
-			-0.4471347413551670,
-			-0.4469786206711217,
-			-0.4468224863713283,
-			-0.4466663384605436,
-			-0.4465101769435234,
-			-0.4463540018250262,
-			-0.4461978131098094,
-			-0.4460416108026284,
-			-0.4458853949082446,
-			-0.4457291654314134,
-			-0.4455729223768962,
-			-0.4454166657494516,
-			-0.4452603955538395,
-			-0.4451041117948210,
-			-0.4449478144771542,
-			-0.4447915036056028,
-			-0.4446351791849282,
-			-0.4444788412198900,
-			-0.4443224897152528,
-			-0.4441661246757785,
-			-0.4440097461062305,
-			-0.4438533540113730,
-			-0.4436969483959675,
-			-0.4435405292647809,
-			-0.4433840966225773,
-			-0.4432276504741217,
-			-0.4430711908241805,
-			-0.4429147176775176,
-			-0.4427582310389016,
-			-0.4426017309130986,
-			-0.4424452173048760,
-			-0.4422886902190014,
-			-0.4421321496602428,
-			-0.4419755956333696,
-			-0.4418190281431483,
-			-0.4416624471943505,
-			-0.4415058527917453,
-			-0.4413492449401028,
-			-0.4411926236441935,
-			-0.4410359889087883,
-			-0.4408793407386587,
-			-0.4407226791385764,
-			-0.4405660041133128,
-			-0.4404093156676429,
-			-0.4402526138063373,
-			-0.4400958985341701,
-			-0.4399391698559154,
-			-0.4397824277763471,
-			-0.4396256723002401,
-			-0.4394689034323693,
-			-0.4393121211775102,
-			-0.4391553255404386,
-			-0.4389985165259309,
-			-0.4388416941387637,
-			-0.4386848583837140,
-			-0.4385280092655586,
-			-0.4383711467890777,
-			-0.4382142709590474,
-			-0.4380573817802470,
-			-0.4379004792574557,
-			-0.4377435633954531,
-			-0.4375866341990189,
-			-0.4374296916729329,
-			-0.4372727358219781,
-			-0.4371157666509333,
-			-0.4369587841645808,
-			-0.4368017883677027,
-			-0.4366447792650803,
-			-0.4364877568614990,
-			-0.4363307211617388,
-			-0.4361736721705863,
-			-0.4360166098928231,
-			-0.4358595343332338,
-			-0.4357024454966046,
-			-0.4355453433877200,
-			-0.4353882280113663,
-			-0.4352310993723280,
-			-0.4350739574753923,
-			-0.4349168023253460,
-			-0.4347596339269755,
-			-0.4346024522850701,
-			-0.4344452574044176,
-			-0.4342880492898044,
-			-0.4341308279460222,
-			-0.4339735933778572,
-			-0.4338163455901022,
-			-0.4336590845875442,
-			-0.4335018103749757,
-			-0.4333445229571878,
-			-0.4331872223389693,
-			-0.4330299085251142,
-			-0.4328725815204146,
-			-0.4327152413296605,
-			-0.4325578879576473,
-			-0.4324005214091673,
-			-0.4322431416890151,
-			-0.4320857488019830,
-			-0.4319283427528656,
-			-0.4317709235464592,
-			-0.4316134911875585,
-			-0.4314560456809589,
-			-0.4312985870314567,
-			-0.4311411152438490,
-			-0.4309836303229304,
-			-0.4308261322735004,
-			-0.4306686211003560,
-			-0.4305110968082951,
-			-0.4303535594021164,
-			-0.4301960088866195,
-			-0.4300384452666011,
-			-0.4298808685468634,
-			-0.4297232787322057,
-			-0.4295656758274283,
-			-0.4294080598373322,
-			-0.4292504307667186,
-			-0.4290927886203892,
-			-0.4289351334031460,
-			-0.4287774651197907,
-			-0.4286197837751285,
-			-0.4284620893739602,
-			-0.4283043819210904,
-			-0.4281466614213231,
-			-0.4279889278794626,
-			-0.4278311813003139,
-			-0.4276734216886822,
-			-0.4275156490493731,
-			-0.4273578633871926,
-			-0.4272000647069472,
-			-0.4270422530134437,
-			-0.4268844283114893,
-			-0.4267265906058916,
-			-0.4265687399014586,
-			-0.4264108762029988,
-			-0.4262529995153209,
-			-0.4260951098432334,
-			-0.4259372071915482,
-			-0.4257792915650729,
-			-0.4256213629686188,
-			-0.4254634214069966,
-			-0.4253054668850174,
-			-0.4251474994074929,
-			-0.4249895189792349,
-			-0.4248315256050551,
-			-0.4246735192897687,
-			-0.4245155000381854,
-			-0.4243574678551222,
-			-0.4241994227453906,
-			-0.4240413647138056,
-			-0.4238832937651812,
-			-0.4237252099043342,
-			-0.4235671131360799,
-			-0.4234090034652327,
-			-0.4232508808966098,
-			-0.4230927454350278,
-			-0.4229345970853030,
-			-0.4227764358522544,
-			-0.4226182617406999,
-			-0.4224600747554563,
-			-0.4223018749013429,
-			-0.4221436621831779,
-			-0.4219854366057834,
-			-0.4218271981739765,
-			-0.4216689468925776,
-			-0.4215106827664096,
-			-0.4213524058002913,
-			-0.4211941159990439,
-			-0.4210358133674908,
-			-0.4208774979104535,
-			-0.4207191696327552,
-			-0.4205608285392167,
-			-0.4204024746346642,
-			-0.4202441079239185,
-			-0.4200857284118061,
-			-0.4199273361031506,
-			-0.4197689310027770,
-			-0.4196105131155106,
-			-0.4194520824461770,
-			-0.4192936389996031,
-			-0.4191351827806139,
-			-0.4189767137940361,
-			-0.4188182320446985,
-			-0.4186597375374280,
-			-0.4185012302770527,
-			-0.4183427102684018,
-			-0.4181841775163015,
-			-0.4180256320255844,
-			-0.4178670738010767,
-			-0.4177085028476110,
-			-0.4175499191700174,
-			-0.4173913227731244,
-			-0.4172327136617653,
-			-0.4170740918407711,
-			-0.4169154573149735,
-			-0.4167568100892048,
-			-0.4165981501682979,
-			-0.4164394775570863,
-			-0.4162807922604013,
-			-0.4161220942830790,
-			-0.4159633836299529,
-			-0.4158046603058576,
-			-0.4156459243156279,
-			-0.4154871756640995,
-			-0.4153284143561079,
-			-0.4151696403964893,
-			-0.4150108537900796,
-			-0.4148520545417179,
-			-0.4146932426562392,
-			-0.4145344181384820,
-			-0.4143755809932844,
-			-0.4142167312254847,
-			-0.4140578688399218,
-			-0.4138989938414351,
-			-0.4137401062348640,
-			-0.4135812060250486,
-			-0.4134222932168292,
-			-0.4132633678150467,
-			-0.4131044298245420,
-			-0.4129454792501561,
-			-0.4127865160967332,
-			-0.4126275403691131,
-			-0.4124685520721394,
-			-0.4123095512106552,
-			-0.4121505377895038,
-			-0.4119915118135291,
-			-0.4118324732875745,
-			-0.4116734222164870,
-			-0.4115143586051092,
-			-0.4113552824582871,
-			-0.4111961937808667,
-			-0.4110370925776931,
-			-0.4108779788536153,
-			-0.4107188526134769,
-			-0.4105597138621285,
-			-0.4104005626044152,
-			-0.4102413988451851,
-			-0.4100822225892890,
-			-0.4099230338415724,
-			-0.4097638326068870,
-			-0.4096046188900824,
-			-0.4094453926960067,
-			-0.4092861540295111,
-			-0.4091269028954456,
-			-0.4089676392986628,
-			-0.4088083632440140,
-			-0.4086490747363488,
-			-0.4084897737805226,
-			-0.4083304603813855,
-			-0.4081711345437913,
-			-0.4080117962725926,
-			-0.4078524455726446,
-			-0.4076930824488015,
-			-0.4075337069059154,
-			-0.4073743189488442,
-			-0.4072149185824410,
-			-0.4070555058115611,
-			-0.4068960806410623,
-			-0.4067366430758001,
-			-0.4065771931206321,
-			-0.4064177307804137,
-			-0.4062582560600025,
-			-0.4060987689642588,
-			-0.4059392694980376,
-			-0.4057797576661999,
-			-0.4056202334736040,
-			-0.4054606969251092,
-			-0.4053011480255754,
-			-0.4051415867798625,
-			-0.4049820131928312,
-			-0.4048224272693424,
-			-0.4046628290142573,
-			-0.4045032184324382,
-			-0.4043435955287450,
-			-0.4041839603080423,
-			-0.4040243127751922,
-			-0.4038646529350577,
-			-0.4037049807925024,
-			-0.4035452963523901,
-			-0.4033855996195860,
-			-0.4032258905989523,
-			-0.4030661692953555,
-			-0.4029064357136628,
-			-0.4027466898587374,
-			-0.4025869317354462,
-			-0.4024271613486559,
-			-0.4022673787032333,
-			-0.4021075838040455,
-			-0.4019477766559603,
-			-0.4017879572638458,
-			-0.4016281256325701,
-			-0.4014682817670022,
-			-0.4013084256720110,
-			-0.4011485573524662,
-			-0.4009886768132376,
-			-0.4008287840591954,
-			-0.4006688790952102,
-			-0.4005089619261530,
-			-0.4003490325568952,
-			-0.4001890909923085,
-			-0.4000291372372651,
-			-0.3998691712966364,
-			-0.3997091931752979,
-			-0.3995492028781203,
-			-0.3993892004099781,
-			-0.3992291857757450,
-			-0.3990691589802948,
-			-0.3989091200285044,
-			-0.3987490689252458,
-			-0.3985890056753976,
-			-0.3984289302838331,
-			-0.3982688427554294,
-			-0.3981087430950630,
-			-0.3979486313076100,
-			-0.3977885073979501,
-			-0.3976283713709586,
-			-0.3974682232315143,
-			-0.3973080629844955,
-			-0.3971478906347803,
-			-0.3969877061872493,
-			-0.3968275096467821,
-			-0.3966673010182569,
-			-0.3965070803065547,
-			-0.3963468475165562,
-			-0.3961866026531424,
-			-0.3960263457211945,
-			-0.3958660767255935,
-			-0.3957057956712238,
-			-0.3955455025629647,
-			-0.3953851974057022,
-			-0.3952248802043162,
-			-0.3950645509636928,
-			-0.3949042096887150,
-			-0.3947438563842671,
-			-0.3945834910552345,
-			-0.3944231137064998,
-			-0.3942627243429508,
-			-0.3941023229694733,
-			-0.3939419095909510,
-			-0.3937814842122727,
-			-0.3936210468383244,
-			-0.3934605974739942,
-			-0.3933001361241680,
-			-0.3931396627937339,
-			-0.3929791774875815,
-			-0.3928186802105989,
-			-0.3926581709676750,
-			-0.3924976497637001,
-			-0.3923371166035622,
-			-0.3921765714921516,
-			-0.3920160144343603,
-			-0.3918554454350783,
-			-0.3916948644991978,
-			-0.3915342716316076,
-			-0.3913736668372033,
-			-0.3912130501208736,
-			-0.3910524214875138,
-			-0.3908917809420161,
-			-0.3907311284892738,
-			-0.3905704641341808,
-			-0.3904097878816311,
-			-0.3902490997365191,
-			-0.3900883997037398,
-			-0.3899276877881876,
-			-0.3897669639947604,
-			-0.3896062283283517,
-			-0.3894454807938587,
-			-0.3892847213961779,
-			-0.3891239501402064,
-			-0.3889631670308416,
-			-0.3888023720729812,
-			-0.3886415652715233,
-			-0.3884807466313663,
-			-0.3883199161574091,
-			-0.3881590738545508,
-			-0.3879982197276910,
-			-0.3878373537817296,
-			-0.3876764760215668,
-			-0.3875155864521032,
-			-0.3873546850782407,
-			-0.3871937719048781,
-			-0.3870328469369188,
-			-0.3868719101792664,
-			-0.3867109616368209,
-			-0.3865500013144860,
-			-0.3863890292171646,
-			-0.3862280453497604,
-			-0.3860670497171771,
-			-0.3859060423243181,
-			-0.3857450231760906,
-			-0.3855839922773969,
-			-0.3854229496331432,
-			-0.3852618952482350,
-			-0.3851008291275784,
-			-0.3849397512760790,
-			-0.3847786616986450,
-			-0.3846175604001835,
-			-0.3844564473856004,
-			-0.3842953226598042,
-			-0.3841341862277031,
-			-0.3839730380942047,
-			-0.3838118782642195,
-			-0.3836507067426568,
-			-0.3834895235344244,
-			-0.3833283286444332,
-			-0.3831671220775926,
-			-0.3830059038388148,
-			-0.3828446739330108,
-			-0.3826834323650895,
-			-0.3825221791399659,
-			-0.3823609142625496,
-			-0.3821996377377531,
-			-0.3820383495704914,
-			-0.3818770497656745,
-			-0.3817157383282191,
-			-0.3815544152630357,
-			-0.3813930805750419,
-			-0.3812317342691497,
-			-0.3810703763502740,
-			-0.3809090068233316,
-			-0.3807476256932373,
-			-0.3805862329649072,
-			-0.3804248286432583,
-			-0.3802634127332056,
-			-0.3801019852396670,
-			-0.3799405461675591,
-			-0.3797790955218011,
-			-0.3796176333073102,
-			-0.3794561595290050,
-			-0.3792946741918051,
-			-0.3791331773006270,
-			-0.3789716688603928,
-			-0.3788101488760214,
-			-0.3786486173524330,
-			-0.3784870742945490,
-			-0.3783255197072877,
-			-0.3781639535955730,
-			-0.3780023759643255,
-			-0.3778407868184672,
-			-0.3776791861629203,
-			-0.3775175740026076,
-			-0.3773559503424528,
-			-0.3771943151873768,
-			-0.3770326685423057,
-			-0.3768710104121628,
-			-0.3767093408018724,
-			-0.3765476597163593,
-			-0.3763859671605486,
-			-0.3762242631393657,
-			-0.3760625476577364,
-			-0.3759008207205869,
-			-0.3757390823328436,
-			-0.3755773324994333,
-			-0.3754155712252832,
-			-0.3752537985153218,
-			-0.3750920143744744,
-			-0.3749302188076707,
-			-0.3747684118198412,
-			-0.3746065934159123,
-			-0.3744447636008140,
-			-0.3742829223794759,
-			-0.3741210697568280,
-			-0.3739592057378007,
-			-0.3737973303273238,
-			-0.3736354435303307,
-			-0.3734735453517503,
-			-0.3733116357965152,
-			-0.3731497148695574,
-			-0.3729877825758093,
-			-0.3728258389202036,
-			-0.3726638839076726,
-			-0.3725019175431522,
-			-0.3723399398315737,
-			-0.3721779507778721,
-			-0.3720159503869818,
-			-0.3718539386638368,
-			-0.3716919156133748,
-			-0.3715298812405287,
-			-0.3713678355502353,
-			-0.3712057785474307,
-			-0.3710437102370507,
-			-0.3708816306240337,
-			-0.3707195397133171,
-			-0.3705574375098359,
-			-0.3703953240185313,
-			-0.3702331992443392,
-			-0.3700710631921988,
-			-0.3699089158670493,
-			-0.3697467572738291,
-			-0.3695845874174801,
-			-0.3694224063029392,
-			-0.3692602139351500,
-			-0.3690980103190498,
-			-0.3689357954595829,
-			-0.3687735693616874,
-			-0.3686113320303074,
-			-0.3684490834703850,
-			-0.3682868236868601,
-			-0.3681245526846786,
-			-0.3679622704687812,
-			-0.3677999770441113,
-			-0.3676376724156142,
-			-0.3674753565882332,
-			-0.3673130295669136,
-			-0.3671506913565984,
-			-0.3669883419622329,
-			-0.3668259813887640,
-			-0.3666636096411367,
-			-0.3665012267242972,
-			-0.3663388326431927,
-			-0.3661764274027677,
-			-0.3660140110079716,
-			-0.3658515834637512,
-			-0.3656891447750543,
-			-0.3655266949468290,
-			-0.3653642339840239,
-			-0.3652017618915886,
-			-0.3650392786744699,
-			-0.3648767843376197,
-			-0.3647142788859871,
-			-0.3645517623245222,
-			-0.3643892346581756,
-			-0.3642266958918983,
-			-0.3640641460306421,
-			-0.3639015850793563,
-			-0.3637390130429942,
-			-0.3635764299265100,
-			-0.3634138357348534,
-			-0.3632512304729785,
-			-0.3630886141458383,
-			-0.3629259867583864,
-			-0.3627633483155769,
-			-0.3626006988223638,
-			-0.3624380382837018,
-			-0.3622753667045459,
-			-0.3621126840898512,
-			-0.3619499904445734,
-			-0.3617872857736684,
-			-0.3616245700820925,
-			-0.3614618433748023,
-			-0.3612991056567547,
-			-0.3611363569329070,
-			-0.3609735972082168,
-			-0.3608108264876421,
-			-0.3606480447761410,
-			-0.3604852520786715,
-			-0.3603224484001950,
-			-0.3601596337456682,
-			-0.3599968081200515,
-			-0.3598339715283051,
-			-0.3596711239753882,
-			-0.3595082654662640,
-			-0.3593453960058910,
-			-0.3591825155992314,
-			-0.3590196242512466,
-			-0.3588567219668987,
-			-0.3586938087511491,
-			-0.3585308846089621,
-			-0.3583679495453007,
-			-0.3582050035651265,
-			-0.3580420466734039,
-			-0.3578790788750968,
-			-0.3577161001751689,
-			-0.3575531105785862,
-			-0.3573901100903139,
-			-0.3572270987153153,
-			-0.3570640764585571,
-			-0.3569010433250043,
-			-0.3567379993196257,
-			-0.3565749444473855,
-			-0.3564118787132504,
-			-0.3562488021221904,
-			-0.3560857146791697,
-			-0.3559226163891594,
-			-0.3557595072571255,
-			-0.3555963872880364,
-			-0.3554332564868629,
-			-0.3552701148585731,
-			-0.3551069624081377,
-			-0.3549437991405248,
-			-0.3547806250607047,
-			-0.3546174401736495,
-			-0.3544542444843295,
-			-0.3542910379977157,
-			-0.3541278207187806,
-			-0.3539645926524944,
-			-0.3538013538038301,
-			-0.3536381041777595,
-			-0.3534748437792570,
-			-0.3533115726132951,
-			-0.3531482906848473,
-			-0.3529849979988882,
-			-0.3528216945603895,
-			-0.3526583803743283,
-			-0.3524950554456785,
-			-0.3523317197794153,
-			-0.3521683733805150,
-			-0.3520050162539510,
-			-0.3518416484047027,
-			-0.3516782698377432,
-			-0.3515148805580519,
-			-0.3513514805706049,
-			-0.3511880698803799,
-			-0.3510246484923546,
-			-0.3508612164115070,
-			-0.3506977736428156,
-			-0.3505343201912591,
-			-0.3503708560618166,
-			-0.3502073812594676,
-			-0.3500438957891917,
-			-0.3498803996559690,
-			-0.3497168928647797,
-			-0.3495533754206049,
-			-0.3493898473284253,
-			-0.3492263085932223,
-			-0.3490627592199778,
-			-0.3488991992136743,
-			-0.3487356285792918,
-			-0.3485720473218155,
-			-0.3484084554462273,
-			-0.3482448529575108,
-			-0.3480812398606494,
-			-0.3479176161606272,
-			-0.3477539818624291,
-			-0.3475903369710373,
-			-0.3474266814914384,
-			-0.3472630154286193,
-			-0.3470993387875629,
-			-0.3469356515732562,
-			-0.3467719537906851,
-			-0.3466082454448363,
-			-0.3464445265406966,
-			-0.3462807970832523,
-			-0.3461170570774934,
-			-0.3459533065284051,
-			-0.3457895454409766,
-			-0.3456257738201962,
-			-0.3454619916710526,
-			-0.3452981989985342,
-			-0.3451343958076329,
-			-0.3449705821033358,
-			-0.3448067578906339,
-			-0.3446429231745167,
-			-0.3444790779599773,
-			-0.3443152222520044,
-			-0.3441513560555893,
-			-0.3439874793757260,
-			-0.3438235922174041,
-			-0.3436596945856166,
-			-0.3434957864853562,
-			-0.3433318679216150,
-			-0.3431679388993887,
-			-0.3430039994236675,
-			-0.3428400494994488,
-			-0.3426760891317241,
-			-0.3425121183254879,
-			-0.3423481370857369,
-			-0.3421841454174653,
-			-0.3420201433256694,
-			-0.3418561308153424,
-			-0.3416921078914840,
-			-0.3415280745590878,
-			-0.3413640308231509,
-			-0.3411999766886717,
-			-0.3410359121606469,
-			-0.3408718372440742,
-			-0.3407077519439524,
-			-0.3405436562652772,
-			-0.3403795502130508,
-			-0.3402154337922688,
-			-0.3400513070079328,
-			-0.3398871698650425,
-			-0.3397230223685954,
-			-0.3395588645235948,
-			-0.3393946963350381,
-			-0.3392305178079286,
-			-0.3390663289472666,
-			-0.3389021297580536,
-			-0.3387379202452922,
-			-0.3385737004139820,
-			-0.3384094702691281,
-			-0.3382452298157322,
-			-0.3380809790587974,
-			-0.3379167180033270,
-			-0.3377524466543249,
-			-0.3375881650167957,
-			-0.3374238730957412,
-			-0.3372595708961687,
-			-0.3370952584230822,
-			-0.3369309356814869,
-			-0.3367666026763884,
-			-0.3366022594127926,
-			-0.3364379058957056,
-			-0.3362735421301340,
-			-0.3361091681210845,
-			-0.3359447838735643,
-			-0.3357803893925808,
-			-0.3356159846831417,
-			-0.3354515697502560,
-			-0.3352871445989295,
-			-0.3351227092341725,
-			-0.3349582636609957,
-			-0.3347938078844059,
-			-0.3346293419094135,
-			-0.3344648657410285,
-			-0.3343003793842610,
-			-0.3341358828441218,
-			-0.3339713761256206,
-			-0.3338068592337712,
-			-0.3336423321735826,
-			-0.3334777949500675,
-			-0.3333132475682377,
-			-0.3331486900331059,
-			-0.3329841223496847,
-			-0.3328195445229870,
-			-0.3326549565580263,
-			-0.3324903584598162,
-			-0.3323257502333697,
-			-0.3321611318837037,
-			-0.3319965034158294,
-			-0.3318318648347648,
-			-0.3316672161455229,
-			-0.3315025573531198,
-			-0.3313378884625715,
-			-0.3311732094788929,
-			-0.3310085204071024,
-			-0.3308438212522167,
-			-0.3306791120192502,
-			-0.3305143927132235,
-			-0.3303496633391519,
-			-0.3301849239020542,
-			-0.3300201744069476,
-			-0.3298554148588526,
-			-0.3296906452627879,
-			-0.3295258656237701,
-			-0.3293610759468221,
-			-0.3291962762369612,
-			-0.3290314664992083,
-			-0.3288666467385830,
-			-0.3287018169601076,
-			-0.3285369771688031,
-			-0.3283721273696892,
-			-0.3282072675677875,
-			-0.3280423977681223,
-			-0.3278775179757126,
-			-0.3277126281955834,
-			-0.3275477284327576,
-			-0.3273828186922566,
-			-0.3272178989791046,
-			-0.3270529692983247,
-			-0.3268880296549423,
-			-0.3267230800539813,
-			-0.3265581205004661,
-			-0.3263931509994225,
-			-0.3262281715558734,
-			-0.3260631821748467,
-			-0.3258981828613675,
-			-0.3257331736204620,
-			-0.3255681544571566,
-			-0.3254031253764782,
-			-0.3252380863834545,
-			-0.3250730374831106,
-			-0.3249079786804765,
-			-0.3247429099805794,
-			-0.3245778313884476,
-			-0.3244127429091097,
-			-0.3242476445475945,
-			-0.3240825363089313,
-			-0.3239174181981503,
-			-0.3237522902202789,
-			-0.3235871523803496,
-			-0.3234220046833920,
-			-0.3232568471344368,
-			-0.3230916797385157,
-			-0.3229265025006576,
-			-0.3227613154258966,
-			-0.3225961185192637,
-			-0.3224309117857911,
-			-0.3222656952305121,
-			-0.3221004688584570,
-			-0.3219352326746614,
-			-0.3217699866841578,
-			-0.3216047308919800,
-			-0.3214394653031618,
-			-0.3212741899227376,
-			-0.3211089047557420,
-			-0.3209436098072098,
-			-0.3207783050821761,
-			-0.3206129905856765,
-			-0.3204476663227460,
-			-0.3202823322984230,
-			-0.3201169885177414,
-			-0.3199516349857388,
-			-0.3197862717074519,
-			-0.3196208986879174,
-			-0.3194555159321753,
-			-0.3192901234452608,
-			-0.3191247212322130,
-			-0.3189593092980704,
-			-0.3187938876478715,
-			-0.3186284562866547,
-			-0.3184630152194617,
-			-0.3182975644513298,
-			-0.3181321039872996,
-			-0.3179666338324114,
-			-0.3178011539917056,
-			-0.3176356644702231,
-			-0.3174701652730041,
-			-0.3173046564050926,
-			-0.3171391378715277,
-			-0.3169736096773522,
-			-0.3168080718276085,
-			-0.3166425243273390,
-			-0.3164769671815866,
-			-0.3163114003953938,
-			-0.3161458239738064,
-			-0.3159802379218647,
-			-0.3158146422446155,
-			-0.3156490369471031,
-			-0.3154834220343694,
-			-0.3153177975114620,
-			-0.3151521633834252,
-			-0.3149865196553054,
-			-0.3148208663321467,
-			-0.3146552034189952,
-			-0.3144895309208990,
-			-0.3143238488429038,
-			-0.3141581571900566,
-			-0.3139924559674057,
-			-0.3138267451799966,
-			-0.3136610248328783,
-			-0.3134952949310980,
-			-0.3133295554797058,
-			-0.3131638064837503,
-			-0.3129980479482781,
-			-0.3128322798783418,
-			-0.3126665022789877,
-			-0.3125007151552682,
-			-0.3123349185122325,
-			-0.3121691123549311,
-			-0.3120032966884157,
-			-0.3118374715177347,
-			-0.3116716368479419,
-			-0.3115057926840890,
-			-0.3113399390312254,
-			-0.3111740758944057,
-			-0.3110082032786817,
-			-0.3108423211891060,
-			-0.3106764296307318,
-			-0.3105105286086124,
-			-0.3103446181278014,
-			-0.3101786981933528,
-			-0.3100127688103206,
-			-0.3098468299837596,
-			-0.3096808817187243,
-			-0.3095149240202700,
-			-0.3093489568934520,
-			-0.3091829803433259,
-			-0.3090169943749476,
-			-0.3088509989933734,
-			-0.3086849942036606,
-			-0.3085189800108635,
-			-0.3083529564200417,
-			-0.3081869234362518,
-			-0.3080208810645513,
-			-0.3078548293099982,
-			-0.3076887681776508,
-			-0.3075226976725676,
-			-0.3073566177998073,
-			-0.3071905285644282,
-			-0.3070244299714922,
-			-0.3068583220260564,
-			-0.3066922047331816,
-			-0.3065260780979280,
-			-0.3063599421253562,
-			-0.3061937968205268,
-			-0.3060276421885011,
-			-0.3058614782343402,
-			-0.3056953049631060,
-			-0.3055291223798604,
-			-0.3053629304896654,
-			-0.3051967292975828,
-			-0.3050305188086770,
-			-0.3048642990280112,
-			-0.3046980699606470,
-			-0.3045318316116487,
-			-0.3043655839860796,
-			-0.3041993270890063,
-			-0.3040330609254908,
-			-0.3038667855005978,
-			-0.3037005008193948,
-			-0.3035342068869448,
-			-0.3033679037083141,
-			-0.3032015912885686,
-			-0.3030352696327737,
-			-0.3028689387459982,
-			-0.3027025986333057,
-			-0.3025362492997664,
-			-0.3023698907504451,
-			-0.3022035229904094,
-			-0.3020371460247288,
-			-0.3018707598584706,
-			-0.3017043644967041,
-			-0.3015379599444963,
-			-0.3013715462069170,
-			-0.3012051232890354,
-			-0.3010386911959202,
-			-0.3008722499326430,
-			-0.3007057995042738,
-			-0.3005393399158804,
-			-0.3003728711725370,
-			-0.3002063932793110,
-			-0.3000399062412770,
-			-0.2998734100635031,
-			-0.2997069047510636,
-			-0.2995403903090306,
-			-0.2993738667424739,
-			-0.2992073340564685,
-			-0.2990407922560866,
-			-0.2988742413464012,
-			-0.2987076813324859,
-			-0.2985411122194142,
-			-0.2983745340122611,
-			-0.2982079467160982,
-			-0.2980413503360027,
-			-0.2978747448770485,
-			-0.2977081303443107,
-			-0.2975415067428646,
-			-0.2973748740777860,
-			-0.2972082323541516,
-			-0.2970415815770350,
-			-0.2968749217515153,
-			-0.2967082528826682,
-			-0.2965415749755710,
-			-0.2963748880353009,
-			-0.2962081920669363,
-			-0.2960414870755525,
-			-0.2958747730662302,
-			-0.2957080500440468,
-			-0.2955413180140812,
-			-0.2953745769814123,
-			-0.2952078269511192,
-			-0.2950410679282815,
-			-0.2948742999179789,
-			-0.2947075229252907,
-			-0.2945407369552996,
-			-0.2943739420130838,
-			-0.2942071381037250,
-			-0.2940403252323042,
-			-0.2938735034039029,
-			-0.2937066726236029,
-			-0.2935398328964851,
-			-0.2933729842276344,
-			-0.2932061266221307,
-			-0.2930392600850577,
-			-0.2928723846214984,
-			-0.2927055002365352,
-			-0.2925386069352544,
-			-0.2923717047227371,
-			-0.2922047936040684,
-			-0.2920378735843328,
-			-0.2918709446686139,
-			-0.2917040068619993,
-			-0.2915370601695718,
-			-0.2913701045964175,
-			-0.2912031401476223,
-			-0.2910361668282723,
-			-0.2908691846434536,
-			-0.2907021935982529,
-			-0.2905351936977562,
-			-0.2903681849470531,
-			-0.2902011673512275,
-			-0.2900341409153707,
-			-0.2898671056445678,
-			-0.2897000615439079,
-			-0.2895330086184787,
-			-0.2893659468733706,
-			-0.2891988763136726,
-			-0.2890317969444713,
-			-0.2888647087708597,
-			-0.2886976117979251,
-			-0.2885305060307575,
-			-0.2883633914744489,
-			-0.2881962681340891,
-			-0.2880291360147698,
-			-0.2878619951215805,
-			-0.2876948454596125,
-			-0.2875276870339601,
-			-0.2873605198497118,
-			-0.2871933439119624,
-			-0.2870261592258043,
-			-0.2868589657963285,
-			-0.2866917636286282,
-			-0.2865245527277982,
-			-0.2863573330989312,
-			-0.2861901047471219,
-			-0.2860228676774618,
-			-0.2858556218950485,
-			-0.2856883674049735,
-			-0.2855211042123340,
-			-0.2853538323222242,
-			-0.2851865517397397,
-			-0.2850192624699761,
-			-0.2848519645180292,
-			-0.2846846578889962,
-			-0.2845173425879718,
-			-0.2843500186200526,
-			-0.2841826859903375,
-			-0.2840153447039226,
-			-0.2838479947659057,
-			-0.2836806361813844,
-			-0.2835132689554568,
-			-0.2833458930932220,
-			-0.2831785085997761,
-			-0.2830111154802203,
-			-0.2828437137396530,
-			-0.2826763033831735,
-			-0.2825088844158814,
-			-0.2823414568428766,
-			-0.2821740206692592,
-			-0.2820065759001296,
-			-0.2818391225405885,
-			-0.2816716605957376,
-			-0.2815041900706756,
-			-0.2813367109705064,
-			-0.2811692233003310,
-			-0.2810017270652512,
-			-0.2808342222703694,
-			-0.2806667089207880,
-			-0.2804991870216098,
-			-0.2803316565779377,
-			-0.2801641175948741,
-			-0.2799965700775253,
-			-0.2798290140309924,
-			-0.2796614494603802,
-			-0.2794938763707931,
-			-0.2793262947673357,
-			-0.2791587046551129,
-			-0.2789911060392296,
-			-0.2788234989247912,
-			-0.2786558833169034,
-			-0.2784882592206720,
-			-0.2783206266412031,
-			-0.2781529855836031,
-			-0.2779853360529779,
-			-0.2778176780544367,
-			-0.2776500115930843,
-			-0.2774823366740289,
-			-0.2773146533023783,
-			-0.2771469614832401,
-			-0.2769792612217228,
-			-0.2768115525229339,
-			-0.2766438353919846,
-			-0.2764761098339813,
-			-0.2763083758540342,
-			-0.2761406334572525,
-			-0.2759728826487454,
-			-0.2758051234336252,
-			-0.2756373558169989,
-			-0.2754695798039802,
-			-0.2753017953996775,
-			-0.2751340026092017,
-			-0.2749662014376666,
-			-0.2747983918901803,
-			-0.2746305739718572,
-			-0.2744627476878093,
-			-0.2742949130431471,
-			-0.2741270700429841,
-			-0.2739592186924323,
-			-0.2737913589966062,
-			-0.2736234909606193,
-			-0.2734556145895825,
-			-0.2732877298886131,
-			-0.2731198368628225,
-			-0.2729519355173259,
-			-0.2727840258572371,
-			-0.2726161078876725,
-			-0.2724481816137473,
-			-0.2722802470405742,
-			-0.2721123041732722,
-			-0.2719443530169537,
-			-0.2717763935767374,
-			-0.2716084258577386,
-			-0.2714404498650742,
-			-0.2712724656038616,
-			-0.2711044730792156,
-			-0.2709364722962559,
-			-0.2707684632601001,
-			-0.2706004459758636,
-			-0.2704324204486671,
-			-0.2702643866836278,
-			-0.2700963446858647,
-			-0.2699282944604964,
-			-0.2697602360126420,
-			-0.2695921693474210,
-			-0.2694240944699529,
-			-0.2692560113853575,
-			-0.2690879200987559,
-			-0.2689198206152658,
-			-0.2687517129400104,
-			-0.2685835970781097,
-			-0.2684154730346848,
-			-0.2682473408148570,
-			-0.2680792004237479,
-			-0.2679110518664803,
-			-0.2677428951481736,
-			-0.2675747302739520,
-			-0.2674065572489397,
-			-0.2672383760782571,
-			-0.2670701867670280,
-			-0.2669019893203758,
-			-0.2667337837434241,
-			-0.2665655700412967,
-			-0.2663973482191169,
-			-0.2662291182820115,
-			-0.2660608802351025,
-			-0.2658926340835158,
-			-0.2657243798323762,
-			-0.2655561174868091,
-			-0.2653878470519401,
-			-0.2652195685328951,
-			-0.2650512819347999,
-			-0.2648829872627811,
-			-0.2647146845219651,
-			-0.2645463737174786,
-			-0.2643780548544488,
-			-0.2642097279380021,
-			-0.2640413929732685,
-			-0.2638730499653733,
-			-0.2637046989194454,
-			-0.2635363398406130,
-			-0.2633679727340038,
-			-0.2631995976047490,
-			-0.2630312144579744,
-			-0.2628628232988125,
-			-0.2626944241323903,
-			-0.2625260169638383,
-			-0.2623576017982865,
-			-0.2621891786408644,
-			-0.2620207474967048,
-			-0.2618523083709352,
-			-0.2616838612686899,
-			-0.2615154061950974,
-			-0.2613469431552893,
-			-0.2611784721543989,
-			-0.2610099931975574,
-			-0.2608415062898976,
-			-0.2606730114365503,
-			-0.2605045086426490,
-			-0.2603359979133266,
-			-0.2601674792537154,
-			-0.2599989526689504,
-			-0.2598304181641653,
-			-0.2596618757444913,
-			-0.2594933254150661,
-			-0.2593247671810204,
-			-0.2591562010474914,
-			-0.2589876270196131,
-			-0.2588190451025206,
-			-0.2586504553013500,
-			-0.2584818576212343,
-			-0.2583132520673118,
-			-0.2581446386447185,
-			-0.2579760173585882,
-			-0.2578073882140598,
-			-0.2576387512162693,
-			-0.2574701063703546,
-			-0.2573014536814511,
-			-0.2571327931546962,
-			-0.2569641247952294,
-			-0.2567954486081878,
-			-0.2566267645987095,
-			-0.2564580727719329,
-			-0.2562893731329975,
-			-0.2561206656870397,
-			-0.2559519504392012,
-			-0.2557832273946204,
-			-0.2556144965584369,
-			-0.2554457579357906,
-			-0.2552770115318225,
-			-0.2551082573516701,
-			-0.2549394954004768,
-			-0.2547707256833823,
-			-0.2546019482055277,
-			-0.2544331629720544,
-			-0.2542643699881036,
-			-0.2540955692588173,
-			-0.2539267607893373,
-			-0.2537579445848049,
-			-0.2535891206503654,
-			-0.2534202889911585,
-			-0.2532514496123283,
-			-0.2530826025190178,
-			-0.2529137477163703,
-			-0.2527448852095296,
-			-0.2525760150036394,
-			-0.2524071371038438,
-			-0.2522382515152871,
-			-0.2520693582431139,
-			-0.2519004572924690,
-			-0.2517315486684974,
-			-0.2515626323763444,
-			-0.2513937084211553,
-			-0.2512247768080759,
-			-0.2510558375422523,
-			-0.2508868906288297,
-			-0.2507179360729562,
-			-0.2505489738797785,
-			-0.2503800040544418,
-			-0.2502110266020940,
-			-0.2500420415278826,
-			-0.2498730488369550,
-			-0.2497040485344590,
-			-0.2495350406255419,
-			-0.2493660251153546,
-			-0.2491970020090420,
-			-0.2490279713117564,
-			-0.2488589330286441,
-			-0.2486898871648553,
-			-0.2485208337255384,
-			-0.2483517727158449,
-			-0.2481827041409247,
-			-0.2480136280059261,
-			-0.2478445443160004,
-			-0.2476754530762982,
-			-0.2475063542919693,
-			-0.2473372479681667,
-			-0.2471681341100415,
-			-0.2469990127227435,
-			-0.2468298838114254,
-			-0.2466607473812382,
-			-0.2464916034373358,
-			-0.2463224519848707,
-			-0.2461532930289929,
-			-0.2459841265748587,
-			-0.2458149526276187,
-			-0.2456457711924262,
-			-0.2454765822744364,
-			-0.2453073858788024,
-			-0.2451381820106790,
-			-0.2449689706752178,
-			-0.2447997518775768,
-			-0.2446305256229072,
-			-0.2444612919163665,
-			-0.2442920507631091,
-			-0.2441228021682902,
-			-0.2439535461370656,
-			-0.2437842826745910,
-			-0.2436150117860233,
-			-0.2434457334765172,
-			-0.2432764477512292,
-			-0.2431071546153176,
-			-0.2429378540739386,
-			-0.2427685461322494,
-			-0.2425992307954083,
-			-0.2424299080685703,
-			-0.2422605779568959,
-			-0.2420912404655423,
-			-0.2419218955996678,
-			-0.2417525433644318,
-			-0.2415831837649905,
-			-0.2414138168065064,
-			-0.2412444424941360,
-			-0.2410750608330388,
-			-0.2409056718283762,
-			-0.2407362754853072,
-			-0.2405668718089927,
-			-0.2403974608045906,
-			-0.2402280424772630,
-			-0.2400586168321726,
-			-0.2398891838744777,
-			-0.2397197436093403,
-			-0.2395502960419221,
-			-0.2393808411773845,
-			-0.2392113790208895,
-			-0.2390419095775984,
-			-0.2388724328526760,
-			-0.2387029488512824,
-			-0.2385334575785812,
-			-0.2383639590397353,
-			-0.2381944532399072,
-			-0.2380249401842620,
-			-0.2378554198779634,
-			-0.2376858923261734,
-			-0.2375163575340572,
-			-0.2373468155067790,
-			-0.2371772662495042,
-			-0.2370077097673951,
-			-0.2368381460656182,
-			-0.2366685751493406,
-			-0.2364989970237251,
-			-0.2363294116939382,
-			-0.2361598191651448,
-			-0.2359902194425129,
-			-0.2358206125312087,
-			-0.2356509984363961,
-			-0.2354813771632454,
-			-0.2353117487169208,
-			-0.2351421131025905,
-			-0.2349724703254218,
-			-0.2348028203905816,
-			-0.2346331633032401,
-			-0.2344634990685621,
-			-0.2342938276917192,
-			-0.2341241491778773,
-			-0.2339544635322051,
-			-0.2337847707598734,
-			-0.2336150708660503,
-			-0.2334453638559051,
-			-0.2332756497346085,
-			-0.2331059285073283,
-			-0.2329362001792355,
-			-0.2327664647555003,
-			-0.2325967222412923,
-			-0.2324269726417846,
-			-0.2322572159621448,
-			-0.2320874522075474,
-			-0.2319176813831601,
-			-0.2317479034941572,
-			-0.2315781185457094,
-			-0.2314083265429888,
-			-0.2312385274911683,
-			-0.2310687213954177,
-			-0.2308989082609131,
-			-0.2307290880928247,
-			-0.2305592608963256,
-			-0.2303894266765905,
-			-0.2302195854387922,
-			-0.2300497371881052,
-			-0.2298798819297016,
-			-0.2297100196687555,
-			-0.2295401504104430,
-			-0.2293702741599376,
-			-0.2292003909224142,
-			-0.2290305007030475,
-			-0.2288606035070129,
-			-0.2286906993394865,
-			-0.2285207882056422,
-			-0.2283508701106558,
-			-0.2281809450597050,
-			-0.2280110130579651,
-			-0.2278410741106134,
-			-0.2276711282228240,
-			-0.2275011753997755,
-			-0.2273312156466466,
-			-0.2271612489686120,
-			-0.2269912753708501,
-			-0.2268212948585385,
-			-0.2266513074368561,
-			-0.2264813131109783,
-			-0.2263113118860852,
-			-0.2261413037673571,
-			-0.2259712887599700,
-			-0.2258012668691039,
-			-0.2256312380999379,
-			-0.2254612024576504,
-			-0.2252911599474238,
-			-0.2251211105744351,
-			-0.2249510543438653,
-			-0.2247809912608945,
-			-0.2246109213307031,
-			-0.2244408445584727,
-			-0.2242707609493815,
-			-0.2241006705086131,
-			-0.2239305732413480,
-			-0.2237604691527675,
-			-0.2235903582480533,
-			-0.2234202405323865,
-			-0.2232501160109509,
-			-0.2230799846889287,
-			-0.2229098465714998,
-			-0.2227397016638505,
-			-0.2225695499711610,
-			-0.2223993914986154,
-			-0.2222292262513968,
-			-0.2220590542346881,
-			-0.2218888754536755,
-			-0.2217186899135395,
-			-0.2215484976194678,
-			-0.2213782985766420,
-			-0.2212080927902468,
-			-0.2210378802654686,
-			-0.2208676610074915,
-			-0.2206974350215016,
-			-0.2205272023126826,
-			-0.2203569628862208,
-			-0.2201867167473021,
-			-0.2200164639011125,
-			-0.2198462043528372,
-			-0.2196759381076654,
-			-0.2195056651707810,
-			-0.2193353855473716,
-			-0.2191650992426235,
-			-0.2189948062617255,
-			-0.2188245066098652,
-			-0.2186542002922275,
-			-0.2184838873140037,
-			-0.2183135676803784,
-			-0.2181432413965432,
-			-0.2179729084676841,
-			-0.2178025688989897,
-			-0.2176322226956504,
-			-0.2174618698628546,
-			-0.2172915104057923,
-			-0.2171211443296503,
-			-0.2169507716396201,
-			-0.2167803923408932,
-			-0.2166100064386570,
-			-0.2164396139381028,
-			-0.2162692148444209,
-			-0.2160988091628029,
-			-0.2159283968984378,
-			-0.2157579780565177,
-			-0.2155875526422328,
-			-0.2154171206607765,
-			-0.2152466821173394,
-			-0.2150762370171143,
-			-0.2149057853652906,
-			-0.2147353271670632,
-			-0.2145648624276238,
-			-0.2143943911521648,
-			-0.2142239133458801,
-			-0.2140534290139602,
-			-0.2138829381616016,
-			-0.2137124407939945,
-			-0.2135419369163350,
-			-0.2133714265338162,
-			-0.2132009096516320,
-			-0.2130303862749767,
-			-0.2128598564090448,
-			-0.2126893200590300,
-			-0.2125187772301298,
-			-0.2123482279275357,
-			-0.2121776721564465,
-			-0.2120071099220548,
-			-0.2118365412295574,
-			-0.2116659660841498,
-			-0.2114953844910291,
-			-0.2113247964553889,
-			-0.2111542019824281,
-			-0.2109836010773425,
-			-0.2108129937453289,
-			-0.2106423799915835,
-			-0.2104717598213051,
-			-0.2103011332396911,
-			-0.2101305002519375,
-			-0.2099598608632427,
-			-0.2097892150788049,
-			-0.2096185629038230,
-			-0.2094479043434929,
-			-0.2092772394030147,
-			-0.2091065680875890,
-			-0.2089358904024121,
-			-0.2087652063526841,
-			-0.2085945159436042,
-			-0.2084238191803711,
-			-0.2082531160681872,
-			-0.2080824066122489,
-			-0.2079116908177598,
-			-0.2077409686899175,
-			-0.2075702402339235,
-			-0.2073995054549784,
-			-0.2072287643582831,
-			-0.2070580169490377,
-			-0.2068872632324454,
-			-0.2067165032137075,
-			-0.2065457368980240,
-			-0.2063749642905967,
-			-0.2062041853966293,
-			-0.2060334002213233,
-			-0.2058626087698811,
-			-0.2056918110475060,
-			-0.2055210070593992,
-			-0.2053501968107645,
-			-0.2051793803068052,
-			-0.2050085575527236,
-			-0.2048377285537260,
-			-0.2046668933150127,
-			-0.2044960518417910,
-			-0.2043252041392625,
-			-0.2041543502126315,
-			-0.2039834900671043,
-			-0.2038126237078846,
-			-0.2036417511401782,
-			-0.2034708723691876,
-			-0.2032999874001216,
-			-0.2031290962381830,
-			-0.2029581988885783,
-			-0.2027872953565124,
-			-0.2026163856471931,
-			-0.2024454697658258,
-			-0.2022745477176177,
-			-0.2021036195077729,
-			-0.2019326851415006,
-			-0.2017617446240069,
-			-0.2015907979604991,
-			-0.2014198451561844,
-			-0.2012488862162704,
-			-0.2010779211459656,
-			-0.2009069499504761,
-			-0.2007359726350102,
-			-0.2005649892047778,
-			-0.2003939996649864,
-			-0.2002230040208456,
-			-0.2000520022775616,
-			-0.1998809944403451,
-			-0.1997099805144071,
-			-0.1995389605049544,
-			-0.1993679344171973,
-			-0.1991969022563457,
-			-0.1990258640276103,
-			-0.1988548197361987,
-			-0.1986837693873246,
-			-0.1985127129861951,
-			-0.1983416505380234,
-			-0.1981705820480196,
-			-0.1979995075213946,
-			-0.1978284269633589,
-			-0.1976573403791264,
-			-0.1974862477739062,
-			-0.1973151491529108,
-			-0.1971440445213523,
-			-0.1969729338844428,
-			-0.1968018172473955,
-			-0.1966306946154203,
-			-0.1964595659937317,
-			-0.1962884313875442,
-			-0.1961172908020682,
-			-0.1959461442425180,
-			-0.1957749917141069,
-			-0.1956038332220477,
-			-0.1954326687715567,
-			-0.1952614983678445,
-			-0.1950903220161287,
-			-0.1949191397216209,
-			-0.1947479514895366,
-			-0.1945767573250905,
-			-0.1944055572334983,
-			-0.1942343512199724,
-			-0.1940631392897299,
-			-0.1938919214479878,
-			-0.1937206976999592,
-			-0.1935494680508599,
-			-0.1933782325059074,
-			-0.1932069910703172,
-			-0.1930357437493063,
-			-0.1928644905480896,
-			-0.1926932314718846,
-			-0.1925219665259080,
-			-0.1923506957153770,
-			-0.1921794190455079,
-			-0.1920081365215206,
-			-0.1918368481486293,
-			-0.1916655539320552,
-			-0.1914942538770136,
-			-0.1913229479887226,
-			-0.1911516362724022,
-			-0.1909803187332700,
-			-0.1908089953765455,
-			-0.1906376662074449,
-			-0.1904663312311906,
-			-0.1902949904529992,
-			-0.1901236438780909,
-			-0.1899522915116845,
-			-0.1897809333590011,
-			-0.1896095694252609,
-			-0.1894381997156812,
-			-0.1892668242354839,
-			-0.1890954429898912,
-			-0.1889240559841210,
-			-0.1887526632233951,
-			-0.1885812647129342,
-			-0.1884098604579603,
-			-0.1882384504636931,
-			-0.1880670347353547,
-			-0.1878956132781661,
-			-0.1877241860973506,
-			-0.1875527531981294,
-			-0.1873813145857255,
-			-0.1872098702653586,
-			-0.1870384202422539,
-			-0.1868669645216331,
-			-0.1866955031087190,
-			-0.1865240360087347,
-			-0.1863525632269033,
-			-0.1861810847684492,
-			-0.1860096006385931,
-			-0.1858381108425624,
-			-0.1856666153855773,
-			-0.1854951142728646,
-			-0.1853236075096476,
-			-0.1851520951011507,
-			-0.1849805770525976,
-			-0.1848090533692156,
-			-0.1846375240562262,
-			-0.1844659891188580,
-			-0.1842944485623335,
-			-0.1841229023918791,
-			-0.1839513506127204,
-			-0.1837797932300839,
-			-0.1836082302491931,
-			-0.1834366616752767,
-			-0.1832650875135600,
-			-0.1830935077692696,
-			-0.1829219224476319,
-			-0.1827503315538730,
-			-0.1825787350932224,
-			-0.1824071330709046,
-			-0.1822355254921478,
-			-0.1820639123621794,
-			-0.1818922936862272,
-			-0.1817206694695188,
-			-0.1815490397172832,
-			-0.1813774044347459,
-			-0.1812057636271369,
-			-0.1810341172996864,
-			-0.1808624654576205,
-			-0.1806908081061679,
-			-0.1805191452505595,
-			-0.1803474768960235,
-			-0.1801758030477901,
-			-0.1800041237110869,
-			-0.1798324388911446,
-			-0.1796607485931930,
-			-0.1794890528224621,
-			-0.1793173515841810,
-			-0.1791456448835819,
-			-0.1789739327258953,
-			-0.1788022151163501,
-			-0.1786304920601780,
-			-0.1784587635626091,
-			-0.1782870296288762,
-			-0.1781152902642098,
-			-0.1779435454738424,
-			-0.1777717952630036,
-			-0.1776000396369264,
-			-0.1774282786008426,
-			-0.1772565121599843,
-			-0.1770847403195839,
-			-0.1769129630848730,
-			-0.1767411804610869,
-			-0.1765693924534547,
-			-0.1763975990672122,
-			-0.1762258003075915,
-			-0.1760539961798260,
-			-0.1758821866891491,
-			-0.1757103718407944,
-			-0.1755385516399966,
-			-0.1753667260919879,
-			-0.1751948952020032,
-			-0.1750230589752760,
-			-0.1748512174170423,
-			-0.1746793705325361,
-			-0.1745075183269928,
-			-0.1743356608056456,
-			-0.1741637979737297,
-			-0.1739919298364820,
-			-0.1738200563991370,
-			-0.1736481776669303,
-			-0.1734762936450977,
-			-0.1733044043388758,
-			-0.1731325097534991,
-			-0.1729606098942045,
-			-0.1727887047662276,
-			-0.1726167943748066,
-			-0.1724448787251783,
-			-0.1722729578225768,
-			-0.1721010316722409,
-			-0.1719291002794096,
-			-0.1717571636493176,
-			-0.1715852217872031,
-			-0.1714132746983039,
-			-0.1712413223878578,
-			-0.1710693648611027,
-			-0.1708974021232777,
-			-0.1707254341796183,
-			-0.1705534610353657,
-			-0.1703814826957576,
-			-0.1702094991660328,
-			-0.1700375104514301,
-			-0.1698655165571877,
-			-0.1696935174885476,
-			-0.1695215132507465,
-			-0.1693495038490249,
-			-0.1691774892886223,
-			-0.1690054695747796,
-			-0.1688334447127341,
-			-0.1686614147077296,
-			-0.1684893795650029,
-			-0.1683173392897970,
-			-0.1681452938873518,
-			-0.1679732433629081,
-			-0.1678011877217059,
-			-0.1676291269689889,
-			-0.1674570611099950,
-			-0.1672849901499691,
-			-0.1671129140941501,
-			-0.1669408329477807,
-			-0.1667687467161027,
-			-0.1665966554043582,
-			-0.1664245590177893,
-			-0.1662524575616376,
-			-0.1660803510411482,
-			-0.1659082394615612,
-			-0.1657361228281202,
-			-0.1655640011460673,
-			-0.1653918744206474,
-			-0.1652197426571029,
-			-0.1650476058606782,
-			-0.1648754640366150,
-			-0.1647033171901579,
-			-0.1645311653265509,
-			-0.1643590084510390,
-			-0.1641868465688635,
-			-0.1640146796852707,
-			-0.1638425078055069,
-			-0.1636703309348139,
-			-0.1634981490784367,
-			-0.1633259622416220,
-			-0.1631537704296140,
-			-0.1629815736476588,
-			-0.1628093719009992,
-			-0.1626371651948843,
-			-0.1624649535345571,
-			-0.1622927369252645,
-			-0.1621205153722516,
-			-0.1619482888807662,
-			-0.1617760574560547,
-			-0.1616038211033610,
-			-0.1614315798279351,
-			-0.1612593336350204,
-			-0.1610870825298663,
-			-0.1609148265177191,
-			-0.1607425656038260,
-			-0.1605702997934343,
-			-0.1603980290917925,
-			-0.1602257535041465,
-			-0.1600534730357449,
-			-0.1598811876918348,
-			-0.1597088974776662,
-			-0.1595366023984872,
-			-0.1593643024595436,
-			-0.1591919976660858,
-			-0.1590196880233642,
-			-0.1588473735366250,
-			-0.1586750542111182,
-			-0.1585027300520928,
-			-0.1583304010647990,
-			-0.1581580672544836,
-			-0.1579857286263998,
-			-0.1578133851857937,
-			-0.1576410369379179,
-			-0.1574686838880215,
-			-0.1572963260413548,
-			-0.1571239634031688,
-			-0.1569515959787114,
-			-0.1567792237732350,
-			-0.1566068467919921,
-			-0.1564344650402310,
-			-0.1562620785232036,
-			-0.1560896872461612,
-			-0.1559172912143549,
-			-0.1557448904330372,
-			-0.1555724849074571,
-			-0.1554000746428690,
-			-0.1552276596445240,
-			-0.1550552399176740,
-			-0.1548828154675705,
-			-0.1547103862994684,
-			-0.1545379524186166,
-			-0.1543655138302714,
-			-0.1541930705396829,
-			-0.1540206225521049,
-			-0.1538481698727904,
-			-0.1536757125069935,
-			-0.1535032504599650,
-			-0.1533307837369601,
-			-0.1531583123432342,
-			-0.1529858362840384,
-			-0.1528133555646276,
-			-0.1526408701902549,
-			-0.1524683801661763,
-			-0.1522958854976462,
-			-0.1521233861899171,
-			-0.1519508822482448,
-			-0.1517783736778839,
-			-0.1516058604840894,
-			-0.1514333426721163,
-			-0.1512608202472188,
-			-0.1510882932146551,
-			-0.1509157615796779,
-			-0.1507432253475438,
-			-0.1505706845235075,
-			-0.1503981391128268,
-			-0.1502255891207567,
-			-0.1500530345525545,
-			-0.1498804754134737,
-			-0.1497079117087742,
-			-0.1495353434437101,
-			-0.1493627706235390,
-			-0.1491901932535169,
-			-0.1490176113389024,
-			-0.1488450248849529,
-			-0.1486724338969228,
-			-0.1484998383800732,
-			-0.1483272383396580,
-			-0.1481546337809377,
-			-0.1479820247091692,
-			-0.1478094111296105,
-			-0.1476367930475204,
-			-0.1474641704681557,
-			-0.1472915433967754,
-			-0.1471189118386381,
-			-0.1469462757990017,
-			-0.1467736352831266,
-			-0.1466009902962717,
-			-0.1464283408436945,
-			-0.1462556869306541,
-			-0.1460830285624116,
-			-0.1459103657442255,
-			-0.1457376984813555,
-			-0.1455650267790614,
-			-0.1453923506426039,
-			-0.1452196700772404,
-			-0.1450469850882345,
-			-0.1448742956808431,
-			-0.1447016018603291,
-			-0.1445289036319523,
-			-0.1443562010009733,
-			-0.1441834939726538,
-			-0.1440107825522522,
-			-0.1438380667450314,
-			-0.1436653465562542,
-			-0.1434926219911794,
-			-0.1433198930550694,
-			-0.1431471597531858,
-			-0.1429744220907913,
-			-0.1428016800731460,
-			-0.1426289337055118,
-			-0.1424561829931528,
-			-0.1422834279413303,
-			-0.1421106685553067,
-			-0.1419379048403437,
-			-0.1417651368017067,
-			-0.1415923644446558,
-			-0.1414195877744548,
-			-0.1412468067963668,
-			-0.1410740215156560,
-			-0.1409012319375829,
-			-0.1407284380674147,
-			-0.1405556399104113,
-			-0.1403828374718392,
-			-0.1402100307569613,
-			-0.1400372197710417,
-			-0.1398644045193444,
-			-0.1396915850071337,
-			-0.1395187612396732,
-			-0.1393459332222299,
-			-0.1391731009600649,
-			-0.1390002644584467,
-			-0.1388274237226374,
-			-0.1386545787579030,
-			-0.1384817295695085,
-			-0.1383088761627185,
-			-0.1381360185428009,
-			-0.1379631567150188,
-			-0.1377902906846385,
-			-0.1376174204569251,
-			-0.1374445460371463,
-			-0.1372716674305671,
-			-0.1370987846424547,
-			-0.1369258976780737,
-			-0.1367530065426913,
-			-0.1365801112415741,
-			-0.1364072117799897,
-			-0.1362343081632023,
-			-0.1360614003964805,
-			-0.1358884884850932,
-			-0.1357155724343050,
-			-0.1355426522493840,
-			-0.1353697279355969,
-			-0.1351967994982129,
-			-0.1350238669424998,
-			-0.1348509302737228,
-			-0.1346779894971533,
-			-0.1345050446180558,
-			-0.1343320956417022,
-			-0.1341591425733581,
-			-0.1339861854182919,
-			-0.1338132241817740,
-			-0.1336402588690722,
-			-0.1334672894854562,
-			-0.1332943160361923,
-			-0.1331213385265522,
-			-0.1329483569618043,
-			-0.1327753713472179,
-			-0.1326023816880623,
-			-0.1324293879896082,
-			-0.1322563902571232,
-			-0.1320833884958783,
-			-0.1319103827111424,
-			-0.1317373729081874,
-			-0.1315643590922833,
-			-0.1313913412686980,
-			-0.1312183194427053,
-			-0.1310452936195723,
-			-0.1308722638045722,
-			-0.1306992300029750,
-			-0.1305261922200516,
-			-0.1303531504610739,
-			-0.1301801047313104,
-			-0.1300070550360360,
-			-0.1298340013805193,
-			-0.1296609437700318,
-			-0.1294878822098471,
-			-0.1293148167052358,
-			-0.1291417472614701,
-			-0.1289686738838217,
-			-0.1287955965775620,
-			-0.1286225153479659,
-			-0.1284494302003030,
-			-0.1282763411398467,
-			-0.1281032481718697,
-			-0.1279301513016445,
-			-0.1277570505344450,
-			-0.1275839458755414,
-			-0.1274108373302094,
-			-0.1272377249037215,
-			-0.1270646086013507,
-			-0.1268914884283716,
-			-0.1267183643900549,
-			-0.1265452364916761,
-			-0.1263721047385107,
-			-0.1261989691358301,
-			-0.1260258296889090,
-			-0.1258526864030216,
-			-0.1256795392834430,
-			-0.1255063883354449,
-			-0.1253332335643037,
-			-0.1251600749752956,
-			-0.1249869125736928,
-			-0.1248137463647708,
-			-0.1246405763538039,
-			-0.1244674025460688,
-			-0.1242942249468406,
-			-0.1241210435613930,
-			-0.1239478583950022,
-			-0.1237746694529437,
-			-0.1236014767404932,
-			-0.1234282802629264,
-			-0.1232550800255183,
-			-0.1230818760335466,
-			-0.1229086682922875,
-			-0.1227354568070154,
-			-0.1225622415830074,
-			-0.1223890226255392,
-			-0.1222157999398891,
-			-0.1220425735313337,
-			-0.1218693434051472,
-			-0.1216961095666099,
-			-0.1215228720209963,
-			-0.1213496307735843,
-			-0.1211763858296512,
-			-0.1210031371944734,
-			-0.1208298848733310,
-			-0.1206566288714982,
-			-0.1204833691942560,
-			-0.1203101058468787,
-			-0.1201368388346469,
-			-0.1199635681628377,
-			-0.1197902938367293,
-			-0.1196170158616008,
-			-0.1194437342427287,
-			-0.1192704489853924,
-			-0.1190971600948705,
-			-0.1189238675764407,
-			-0.1187505714353837,
-			-0.1185772716769783,
-			-0.1184039683065009,
-			-0.1182306613292341,
-			-0.1180573507504536,
-			-0.1178840365754415,
-			-0.1177107188094763,
-			-0.1175373974578376,
-			-0.1173640725258059,
-			-0.1171907440186583,
-			-0.1170174119416783,
-			-0.1168440763001432,
-			-0.1166707370993332,
-			-0.1164973943445301,
-			-0.1163240480410135,
-			-0.1161506981940646,
-			-0.1159773448089614,
-			-0.1158039878909863,
-			-0.1156306274454217,
-			-0.1154572634775459,
-			-0.1152838959926407,
-			-0.1151105249959873,
-			-0.1149371504928676,
-			-0.1147637724885612,
-			-0.1145903909883496,
-			-0.1144170059975159,
-			-0.1142436175213409,
-			-0.1140702255651063,
-			-0.1138968301340948,
-			-0.1137234312335858,
-			-0.1135500288688637,
-			-0.1133766230452101,
-			-0.1132032137679069,
-			-0.1130298010422368,
-			-0.1128563848734819,
-			-0.1126829652669259,
-			-0.1125095422278488,
-			-0.1123361157615349,
-			-0.1121626858732691,
-			-0.1119892525683317,
-			-0.1118158158520065,
-			-0.1116423757295759,
-			-0.1114689322063249,
-			-0.1112954852875370,
-			-0.1111220349784930,
-			-0.1109485812844800,
-			-0.1107751242107791,
-			-0.1106016637626749,
-			-0.1104281999454514,
-			-0.1102547327643917,
-			-0.1100812622247825,
-			-0.1099077883319054,
-			-0.1097343110910457,
-			-0.1095608305074877,
-			-0.1093873465865151,
-			-0.1092138593334143,
-			-0.1090403687534699,
-			-0.1088668748519651,
-			-0.1086933776341856,
-			-0.1085198771054165,
-			-0.1083463732709430,
-			-0.1081728661360501,
-			-0.1079993557060225,
-			-0.1078258419861482,
-			-0.1076523249817091,
-			-0.1074788046979944,
-			-0.1073052811402863,
-			-0.1071317543138734,
-			-0.1069582242240406,
-			-0.1067846908760740,
-			-0.1066111542752606,
-			-0.1064376144268839,
-			-0.1062640713362339,
-			-0.1060905250085942,
-			-0.1059169754492515,
-			-0.1057434226634942,
-			-0.1055698666566079,
-			-0.1053963074338805,
-			-0.1052227450005972,
-			-0.1050491793620448,
-			-0.1048756105235123,
-			-0.1047020384902861,
-			-0.1045284632676534,
-			-0.1043548848609024,
-			-0.1041813032753191,
-			-0.1040077185161918,
-			-0.1038341305888082,
-			-0.1036605394984552,
-			-0.1034869452504234,
-			-0.1033133478499972,
-			-0.1031397473024682,
-			-0.1029661436131211,
-			-0.1027925367872468,
-			-0.1026189268301328,
-			-0.1024453137470675,
-			-0.1022716975433395,
-			-0.1020980782242374,
-			-0.1019244557950510,
-			-0.1017508302610671,
-			-0.1015772016275749,
-			-0.1014035698998651,
-			-0.1012299350832258,
-			-0.1010562971829465,
-			-0.1008826562043162,
-			-0.1007090121526237,
-			-0.1005353650331610,
-			-0.1003617148512150,
-			-0.1001880616120764,
-			-0.1000144053210350,
-			-0.0998407459833805,
-			-0.0996670836044039,
-			-0.0994934181893934,
-			-0.0993197497436392,
-			-0.0991460782724333,
-			-0.0989724037810652,
-			-0.0987987262748261,
-			-0.0986250457590040,
-			-0.0984513622388912,
-			-0.0982776757197801,
-			-0.0981039862069590,
-			-0.0979302937057196,
-			-0.0977565982213528,
-			-0.0975828997591498,
-			-0.0974091983244017,
-			-0.0972354939223988,
-			-0.0970617865584352,
-			-0.0968880762377996,
-			-0.0967143629657844,
-			-0.0965406467476813,
-			-0.0963669275887810,
-			-0.0961932054943771,
-			-0.0960194804697615,
-			-0.0958457525202244,
-			-0.0956720216510587,
-			-0.0954982878675566,
-			-0.0953245511750103,
-			-0.0951508115787121,
-			-0.0949770690839536,
-			-0.0948033236960299,
-			-0.0946295754202309,
-			-0.0944558242618502,
-			-0.0942820702261797,
-			-0.0941083133185140,
-			-0.0939345535441460,
-			-0.0937607909083661,
-			-0.0935870254164710,
-			-0.0934132570737512,
-			-0.0932394858855008,
-			-0.0930657118570133,
-			-0.0928919349935812,
-			-0.0927181553005007,
-			-0.0925443727830620,
-			-0.0923705874465622,
-			-0.0921967992962926,
-			-0.0920230083375469,
-			-0.0918492145756210,
-			-0.0916754180158081,
-			-0.0915016186634022,
-			-0.0913278165236985,
-			-0.0911540116019896,
-			-0.0909802039035706,
-			-0.0908063934337362,
-			-0.0906325801977800,
-			-0.0904587642009993,
-			-0.0902849454486853,
-			-0.0901111239461364,
-			-0.0899372996986438,
-			-0.0897634727115054,
-			-0.0895896429900152,
-			-0.0894158105394685,
-			-0.0892419753651612,
-			-0.0890681374723862,
-			-0.0888942968664424,
-			-0.0887204535526225,
-			-0.0885466075362222,
-			-0.0883727588225389,
-			-0.0881989074168674,
-			-0.0880250533245044,
-			-0.0878511965507432,
-			-0.0876773371008815,
-			-0.0875034749802172,
-			-0.0873296101940438,
-			-0.0871557427476582,
-			-0.0869818726463570,
-			-0.0868079998954364,
-			-0.0866341245001938,
-			-0.0864602464659239,
-			-0.0862863657979235,
-			-0.0861124825014910,
-			-0.0859385965819222,
-			-0.0857647080445150,
-			-0.0855908168945635,
-			-0.0854169231373668,
-			-0.0852430267782235,
-			-0.0850691278224283,
-			-0.0848952262752792,
-			-0.0847213221420737,
-			-0.0845474154281100,
-			-0.0843735061386830,
-			-0.0841995942790920,
-			-0.0840256798546365,
-			-0.0838517628706115,
-			-0.0836778433323158,
-			-0.0835039212450472,
-			-0.0833299966141028,
-			-0.0831560694447834,
-			-0.0829821397423834,
-			-0.0828082075122047,
-			-0.0826342727595429,
-			-0.0824603354896971,
-			-0.0822863957079660,
-			-0.0821124534196478,
-			-0.0819385086300413,
-			-0.0817645613444451,
-			-0.0815906115681580,
-			-0.0814166593064787,
-			-0.0812427045647052,
-			-0.0810687473481383,
-			-0.0808947876620771,
-			-0.0807208255118179,
-			-0.0805468609026636,
-			-0.0803728938399107,
-			-0.0801989243288594,
-			-0.0800249523748092,
-			-0.0798509779830587,
-			-0.0796770011589101,
-			-0.0795030219076594,
-			-0.0793290402346100,
-			-0.0791550561450590,
-			-0.0789810696443062,
-			-0.0788070807376533,
-			-0.0786330894303994,
-			-0.0784590957278456,
-			-0.0782850996352892,
-			-0.0781111011580342,
-			-0.0779371003013780,
-			-0.0777630970706220,
-			-0.0775890914710658,
-			-0.0774150835080115,
-			-0.0772410731867599,
-			-0.0770670605126097,
-			-0.0768930454908617,
-			-0.0767190281268185,
-			-0.0765450084257801,
-			-0.0763709863930473,
-			-0.0761969620339222,
-			-0.0760229353537031,
-			-0.0758489063576948,
-			-0.0756748750511958,
-			-0.0755008414395073,
-			-0.0753268055279327,
-			-0.0751527673217723,
-			-0.0749787268263285,
-			-0.0748046840469004,
-			-0.0746306389887913,
-			-0.0744565916573048,
-			-0.0742825420577398,
-			-0.0741084901953993,
-			-0.0739344360755850,
-			-0.0737603797035999,
-			-0.0735863210847443,
-			-0.0734122602243211,
-			-0.0732381971276318,
-			-0.0730641317999802,
-			-0.0728900642466680,
-			-0.0727159944729974,
-			-0.0725419224842701,
-			-0.0723678482857912,
-			-0.0721937718828607,
-			-0.0720196932807822,
-			-0.0718456124848584,
-			-0.0716715295003921,
-			-0.0714974443326870,
-			-0.0713233569870434,
-			-0.0711492674687671,
-			-0.0709751757831601,
-			-0.0708010819355256,
-			-0.0706269859311669,
-			-0.0704528877753871,
-			-0.0702787874734888,
-			-0.0701046850307780,
-			-0.0699305804525545,
-			-0.0697564737441256,
-			-0.0695823649107920,
-			-0.0694082539578584,
-			-0.0692341408906286,
-			-0.0690600257144070,
-			-0.0688859084344950,
-			-0.0687117890561991,
-			-0.0685376675848225,
-			-0.0683635440256691,
-			-0.0681894183840422,
-			-0.0680152906652477,
-			-0.0678411608745898,
-			-0.0676670290173712,
-			-0.0674928950988969,
-			-0.0673187591244716,
-			-0.0671446210993995,
-			-0.0669704810289854,
-			-0.0667963389185328,
-			-0.0666221947733492,
-			-0.0664480485987366,
-			-0.0662739004000006,
-			-0.0660997501824463,
-			-0.0659255979513775,
-			-0.0657514437121019,
-			-0.0655772874699211,
-			-0.0654031292301436,
-			-0.0652289689980711,
-			-0.0650548067790124,
-			-0.0648806425782700,
-			-0.0647064764011503,
-			-0.0645323082529577,
-			-0.0643581381389994,
-			-0.0641839660645811,
-			-0.0640097920350065,
-			-0.0638356160555812,
-			-0.0636614381316127,
-			-0.0634872582684059,
-			-0.0633130764712667,
-			-0.0631388927455017,
-			-0.0629647070964152,
-			-0.0627905195293141,
-			-0.0626163300495043,
-			-0.0624421386622912,
-			-0.0622679453729836,
-			-0.0620937501868841,
-			-0.0619195531093025,
-			-0.0617453541455427,
-			-0.0615711533009109,
-			-0.0613969505807154,
-			-0.0612227459902618,
-			-0.0610485395348577,
-			-0.0608743312198069,
-			-0.0607001210504198,
-			-0.0605259090319994,
-			-0.0603516951698562,
-			-0.0601774794692934,
-			-0.0600032619356207,
-			-0.0598290425741442,
-			-0.0596548213901707,
-			-0.0594805983890066,
-			-0.0593063735759617,
-			-0.0591321469563404,
-			-0.0589579185354509,
-			-0.0587836883186005,
-			-0.0586094563110966,
-			-0.0584352225182474,
-			-0.0582609869453587,
-			-0.0580867495977379,
-			-0.0579125104806945,
-			-0.0577382695995351,
-			-0.0575640269595683,
-			-0.0573897825660992,
-			-0.0572155364244374,
-			-0.0570412885398925,
-			-0.0568670389177696,
-			-0.0566927875633777,
-			-0.0565185344820247,
-			-0.0563442796790197,
-			-0.0561700231596679,
-			-0.0559957649292811,
-			-0.0558215049931641,
-			-0.0556472433566276,
-			-0.0554729800249792,
-			-0.0552987150035272,
-			-0.0551244482975791,
-			-0.0549501799124461,
-			-0.0547759098534331,
-			-0.0546016381258522,
-			-0.0544273647350095,
-			-0.0542530896862144,
-			-0.0540788129847757,
-			-0.0539045346360021,
-			-0.0537302546452017,
-			-0.0535559730176858,
-			-0.0533816897587609,
-			-0.0532074048737367,
-			-0.0530331183679222,
-			-0.0528588302466258,
-			-0.0526845405151590,
-			-0.0525102491788276,
-			-0.0523359562429443,
-			-0.0521616617128157,
-			-0.0519873655937521,
-			-0.0518130678910627,
-			-0.0516387686100580,
-			-0.0514644677560446,
-			-0.0512901653343339,
-			-0.0511158613502371,
-			-0.0509415558090614,
-			-0.0507672487161162,
-			-0.0505929400767130,
-			-0.0504186298961608,
-			-0.0502443181797702,
-			-0.0500700049328483,
-			-0.0498956901607087,
-			-0.0497213738686585,
-			-0.0495470560620087,
-			-0.0493727367460683,
-			-0.0491984159261493,
-			-0.0490240936075608,
-			-0.0488497697956140,
-			-0.0486754444956171,
-			-0.0485011177128806,
-			-0.0483267894527164,
-			-0.0481524597204340,
-			-0.0479781285213447,
-			-0.0478037958607563,
-			-0.0476294617439827,
-			-0.0474551261763319,
-			-0.0472807891631153,
-			-0.0471064507096426,
-			-0.0469321108212262,
-			-0.0467577695031769,
-			-0.0465834267608027,
-			-0.0464090825994162,
-			-0.0462347370243299,
-			-0.0460603900408522,
-			-0.0458860416542947,
-			-0.0457116918699685,
-			-0.0455373406931854,
-			-0.0453629881292547,
-			-0.0451886341834883,
-			-0.0450142788611966,
-			-0.0448399221676924,
-			-0.0446655641082861,
-			-0.0444912046882889,
-			-0.0443168439130120,
-			-0.0441424817877670,
-			-0.0439681183178650,
-			-0.0437937535086176,
-			-0.0436193873653361,
-			-0.0434450198933322,
-			-0.0432706510979181,
-			-0.0430962809844029,
-			-0.0429219095581016,
-			-0.0427475368243224,
-			-0.0425731627883797,
-			-0.0423987874555843,
-			-0.0422244108312480,
-			-0.0420500329206817,
-			-0.0418756537291999,
-			-0.0417012732621109,
-			-0.0415268915247304,
-			-0.0413525085223675,
-			-0.0411781242603351,
-			-0.0410037387439454,
-			-0.0408293519785112,
-			-0.0406549639693421,
-			-0.0404805747217528,
-			-0.0403061842410547,
-			-0.0401317925325601,
-			-0.0399573996015811,
-			-0.0397830054534293,
-			-0.0396086100934196,
-			-0.0394342135268617,
-			-0.0392598157590690,
-			-0.0390854167953539,
-			-0.0389110166410290,
-			-0.0387366153014067,
-			-0.0385622127818005,
-			-0.0383878090875204,
-			-0.0382134042238807,
-			-0.0380389981961960,
-			-0.0378645910097762,
-			-0.0376901826699342,
-			-0.0375157731819844,
-			-0.0373413625512388,
-			-0.0371669507830111,
-			-0.0369925378826116,
-			-0.0368181238553568,
-			-0.0366437087065568,
-			-0.0364692924415257,
-			-0.0362948750655755,
-			-0.0361204565840211,
-			-0.0359460370021756,
-			-0.0357716163253502,
-			-0.0355971945588591,
-			-0.0354227717080146,
-			-0.0352483477781316,
-			-0.0350739227745226,
-			-0.0348994967025016,
-			-0.0347250695673804,
-			-0.0345506413744730,
-			-0.0343762121290929,
-			-0.0342017818365534,
-			-0.0340273505021682,
-			-0.0338529181312497,
-			-0.0336784847291140,
-			-0.0335040503010714,
-			-0.0333296148524369,
-			-0.0331551783885262,
-			-0.0329807409146500,
-			-0.0328063024361231,
-			-0.0326318629582590,
-			-0.0324574224863724,
-			-0.0322829810257744,
-			-0.0321085385817824,
-			-0.0319340951597066,
-			-0.0317596507648635,
-			-0.0315852054025661,
-			-0.0314107590781283,
-			-0.0312363117968650,
-			-0.0310618635640874,
-			-0.0308874143851123,
-			-0.0307129642652527,
-			-0.0305385132098227,
-			-0.0303640612241364,
-			-0.0301896083135088,
-			-0.0300151544832523,
-			-0.0298406997386819,
-			-0.0296662440851109,
-			-0.0294917875278553,
-			-0.0293173300722294,
-			-0.0291428717235447,
-			-0.0289684124871174,
-			-0.0287939523682636,
-			-0.0286194913722950,
-			-0.0284450295045268,
-			-0.0282705667702735,
-			-0.0280961031748494,
-			-0.0279216387235691,
-			-0.0277471734217479,
-			-0.0275727072746978,
-			-0.0273982402877349,
-			-0.0272237724661757,
-			-0.0270493038153321,
-			-0.0268748343405195,
-			-0.0267003640470518,
-			-0.0265258929402454,
-			-0.0263514210254150,
-			-0.0261769483078735,
-			-0.0260024747929365,
-			-0.0258280004859189,
-			-0.0256535253921354,
-			-0.0254790495169017,
-			-0.0253045728655300,
-			-0.0251300954433379,
-			-0.0249556172556392,
-			-0.0247811383077490,
-			-0.0246066586049812,
-			-0.0244321781526536,
-			-0.0242576969560775,
-			-0.0240832150205714,
-			-0.0239087323514478,
-			-0.0237342489540225,
-			-0.0235597648336106,
-			-0.0233852799955273,
-			-0.0232107944450877,
-			-0.0230363081876059,
-			-0.0228618212283998,
-			-0.0226873335727819,
-			-0.0225128452260683,
-			-0.0223383561935734,
-			-0.0221638664806141,
-			-0.0219893760925048,
-			-0.0218148850345608,
-			-0.0216403933120984,
-			-0.0214659009304309,
-			-0.0212914078948747,
-			-0.0211169142107452,
-			-0.0209424198833567,
-			-0.0207679249180266,
-			-0.0205934293200702,
-			-0.0204189330948011,
-			-0.0202444362475350,
-			-0.0200699387835889,
-			-0.0198954407082775,
-			-0.0197209420269172,
-			-0.0195464427448209,
-			-0.0193719428673077,
-			-0.0191974423996904,
-			-0.0190229413472857,
-			-0.0188484397154081,
-			-0.0186739375093751,
-			-0.0184994347345023,
-			-0.0183249313961027,
-			-0.0181504274994956,
-			-0.0179759230499931,
-			-0.0178014180529135,
-			-0.0176269125135717,
-			-0.0174524064372835,
-			-0.0172778998293646,
-			-0.0171033926951316,
-			-0.0169288850398986,
-			-0.0167543768689823,
-			-0.0165798681876976,
-			-0.0164053590013621,
-			-0.0162308493152908,
-			-0.0160563391347995,
-			-0.0158818284652033,
-			-0.0157073173118208,
-			-0.0155328056799651,
-			-0.0153582935749530,
-			-0.0151837810021006,
-			-0.0150092679667247,
-			-0.0148347544741386,
-			-0.0146602405296617,
-			-0.0144857261386066,
-			-0.0143112113062920,
-			-0.0141366960380329,
-			-0.0139621803391455,
-			-0.0137876642149466,
-			-0.0136131476707496,
-			-0.0134386307118725,
-			-0.0132641133436330,
-			-0.0130895955713447,
-			-0.0129150774003245,
-			-0.0127405588358885,
-			-0.0125660398833529,
-			-0.0123915205480347,
-			-0.0122170008352475,
-			-0.0120424807503100,
-			-0.0118679602985376,
-			-0.0116934394852464,
-			-0.0115189183157518,
-			-0.0113443967953727,
-			-0.0111698749294217,
-			-0.0109953527232186,
-			-0.0108208301820771,
-			-0.0106463073113142,
-			-0.0104717841162462,
-			-0.0102972606021904,
-			-0.0101227367744602,
-			-0.0099482126383739,
-			-0.0097736881992495,
-			-0.0095991634624006,
-			-0.0094246384331445,
-			-0.0092501131167966,
-			-0.0090755875186750,
-			-0.0089010616440961,
-			-0.0087265354983736,
-			-0.0085520090868274,
-			-0.0083774824147712,
-			-0.0082029554875223,
-			-0.0080284283103970,
-			-0.0078539008887110,
-			-0.0076793732277833,
-			-0.0075048453329276,
-			-0.0073303172094612,
-			-0.0071557888626997,
-			-0.0069812602979613,
-			-0.0068067315205616,
-			-0.0066322025358178,
-			-0.0064576733490438,
-			-0.0062831439655596,
-			-0.0061086143906791,
-			-0.0059340846297194,
-			-0.0057595546879964,
-			-0.0055850245708281,
-			-0.0054104942835312,
-			-0.0052359638314194,
-			-0.0050614332198129,
-			-0.0048869024540244,
-			-0.0047123715393733,
-			-0.0045378404811752,
-			-0.0043633092847465,
-			-0.0041887779554047,
-			-0.0040142464984637,
-			-0.0038397149192434,
-			-0.0036651832230579,
-			-0.0034906514152237,
-			-0.0033161195010590,
-			-0.0031415874858796,
-			-0.0029670553750028,
-			-0.0027925231737425,
-			-0.0026179908874180,
-			-0.0024434585213450,
-			-0.0022689260808399,
-			-0.0020943935712194,
-			-0.0019198609978009,
-			-0.0017453283658984,
-			-0.0015707956808319,
-			-0.0013962629479144,
-			-0.0012217301724652,
-			-0.0010471973598000,
-			-0.0008726645152353,
-			-0.0006981316440886,
-			-0.0005235987516739,
-			-0.0003490658433094,
-			-0.0001745329243135,
-			-0.0000000000000002,
-			 0.0001745329243131,
-			 0.0003490658433099,
-			 0.0005235987516726,
-			 0.0006981316440874,
-			 0.0008726645152358,
-			 0.0010471973597996,
-			 0.0012217301724648,
-			 0.0013962629479140,
-			 0.0015707956808315,
-			 0.0017453283658989,
-			 0.0019198609977997,
-			 0.0020943935712191,
-			 0.0022689260808396,
-			 0.0024434585213446,
-			 0.0026179908874176,
-			 0.0027925231737412,
-			 0.0029670553750015,
-			 0.0031415874858792,
-			 0.0033161195010586,
-			 0.0034906514152233,
-			 0.0036651832230567,
-			 0.0038397149192431,
-			 0.0040142464984642,
-			 0.0041887779554034,
-			 0.0043633092847470,
-			 0.0045378404811748,
-			 0.0047123715393729,
-			 0.0048869024540241,
-			 0.0050614332198116,
-			 0.0052359638314200,
-			 0.0054104942835300,
-			 0.0055850245708278,
-			 0.0057595546879960,
-			 0.0059340846297191,
-			 0.0061086143906787,
-			 0.0062831439655593,
-			 0.0064576733490443,
-			 0.0066322025358165,
-			 0.0068067315205612,
-			 0.0069812602979609,
-			 0.0071557888626993,
-			 0.0073303172094608,
-			 0.0075048453329272,
-			 0.0076793732277820,
-			 0.0078539008887107,
-			 0.0080284283103958,
-			 0.0082029554875219,
-			 0.0083774824147708,
-			 0.0085520090868261,
-			 0.0087265354983741,
-			 0.0089010616440948,
-			 0.0090755875186755,
-			 0.0092501131167962,
-			 0.0094246384331432,
-			 0.0095991634624002,
-			 0.0097736881992491,
-			 0.0099482126383744,
-			 0.0101227367744590,
-			 0.0102972606021891,
-			 0.0104717841162458,
-			 0.0106463073113138,
-			 0.0108208301820767,
-			 0.0109953527232182,
-			 0.0111698749294213,
-			 0.0113443967953714,
-			 0.0115189183157514,
-			 0.0116934394852460,
-			 0.0118679602985372,
-			 0.0120424807503096,
-			 0.0122170008352471,
-			 0.0123915205480326,
-			 0.0125660398833525,
-			 0.0127405588358881,
-			 0.0129150774003241,
-			 0.0130895955713443,
-			 0.0132641133436318,
-			 0.0134386307118730,
-			 0.0136131476707484,
-			 0.0137876642149453,
-			 0.0139621803391460,
-			 0.0141366960380326,
-			 0.0143112113062916,
-			 0.0144857261386063,
-			 0.0146602405296613,
-			 0.0148347544741391,
-			 0.0150092679667235,
-			 0.0151837810021003,
-			 0.0153582935749527,
-			 0.0155328056799647,
-			 0.0157073173118204,
-			 0.0158818284652030,
-			 0.0160563391347992,
-			 0.0162308493152904,
-			 0.0164053590013617,
-			 0.0165798681876972,
-			 0.0167543768689801,
-			 0.0169288850398973,
-			 0.0171033926951312,
-			 0.0172778998293642,
-			 0.0174524064372831,
-			 0.0176269125135714,
-			 0.0178014180529131,
-			 0.0179759230499918,
-			 0.0181504274994944,
-			 0.0183249313961032,
-			 0.0184994347345010,
-			 0.0186739375093747,
-			 0.0188484397154077,
-			 0.0190229413472853,
-			 0.0191974423996901,
-			 0.0193719428673073,
-			 0.0195464427448214,
-			 0.0197209420269159,
-			 0.0198954407082771,
-			 0.0200699387835885,
-			 0.0202444362475346,
-			 0.0204189330948008,
-			 0.0205934293200698,
-			 0.0207679249180262,
-			 0.0209424198833564,
-			 0.0211169142107439,
-			 0.0212914078948744,
-			 0.0214659009304305,
-			 0.0216403933120971,
-			 0.0218148850345614,
-			 0.0219893760925044,
-			 0.0221638664806137,
-			 0.0223383561935730,
-			 0.0225128452260671,
-			 0.0226873335727815,
-			 0.0228618212283985,
-			 0.0230363081876064,
-			 0.0232107944450864,
-			 0.0233852799955270,
-			 0.0235597648336103,
-			 0.0237342489540221,
-			 0.0239087323514474,
-			 0.0240832150205701,
-			 0.0242576969560780,
-			 0.0244321781526523,
-			 0.0246066586049809,
-			 0.0247811383077486,
-			 0.0249556172556389,
-			 0.0251300954433375,
-			 0.0253045728655297,
-			 0.0254790495168996,
-			 0.0256535253921351,
-			 0.0258280004859186,
-			 0.0260024747929362,
-			 0.0261769483078731,
-			 0.0263514210254137,
-			 0.0265258929402459,
-			 0.0267003640470515,
-			 0.0268748343405183,
-			 0.0270493038153317,
-			 0.0272237724661753,
-			 0.0273982402877354,
-			 0.0275727072746965,
-			 0.0277471734217467,
-			 0.0279216387235696,
-			 0.0280961031748490,
-			 0.0282705667702731,
-			 0.0284450295045264,
-			 0.0286194913722946,
-			 0.0287939523682624,
-			 0.0289684124871180,
-			 0.0291428717235452,
-			 0.0293173300722281,
-			 0.0294917875278549,
-			 0.0296662440851105,
-			 0.0298406997386806,
-			 0.0300151544832519,
-			 0.0301896083135085,
-			 0.0303640612241361,
-			 0.0305385132098224,
-			 0.0307129642652523,
-			 0.0308874143851119,
-			 0.0310618635640862,
-			 0.0312363117968637,
-			 0.0314107590781288,
-			 0.0315852054025657,
-			 0.0317596507648631,
-			 0.0319340951597062,
-			 0.0321085385817820,
-			 0.0322829810257750,
-			 0.0324574224863712,
-			 0.0326318629582595,
-			 0.0328063024361227,
-			 0.0329807409146497,
-			 0.0331551783885258,
-			 0.0333296148524375,
-			 0.0335040503010719,
-			 0.0336784847291128,
-			 0.0338529181312493,
-			 0.0340273505021669,
-			 0.0342017818365522,
-			 0.0343762121290925,
-			 0.0345506413744726,
-			 0.0347250695673800,
-			 0.0348994967025013,
-			 0.0350739227745222,
-			 0.0352483477781313,
-			 0.0354227717080142,
-			 0.0355971945588579,
-			 0.0357716163253498,
-			 0.0359460370021743,
-			 0.0361204565840216,
-			 0.0362948750655752,
-			 0.0364692924415254,
-			 0.0366437087065565,
-			 0.0368181238553564,
-			 0.0369925378826121,
-			 0.0371669507830099,
-			 0.0373413625512393,
-			 0.0375157731819840,
-			 0.0376901826699338,
-			 0.0378645910097758,
-			 0.0380389981961956,
-			 0.0382134042238813,
-			 0.0383878090875191,
-			 0.0385622127817984,
-			 0.0387366153014063,
-			 0.0389110166410286,
-			 0.0390854167953536,
-			 0.0392598157590686,
-			 0.0394342135268605,
-			 0.0396086100934183,
-			 0.0397830054534289,
-			 0.0399573996015799,
-			 0.0401317925325597,
-			 0.0403061842410544,
-			 0.0404805747217524,
-			 0.0406549639693408,
-			 0.0408293519785099,
-			 0.0410037387439459,
-			 0.0411781242603347,
-			 0.0413525085223671,
-			 0.0415268915247300,
-			 0.0417012732621115,
-			 0.0418756537291986,
-			 0.0420500329206822,
-			 0.0422244108312485,
-			 0.0423987874555839,
-			 0.0425731627883794,
-			 0.0427475368243221,
-			 0.0429219095581003,
-			 0.0430962809844034,
-			 0.0432706510979168,
-			 0.0434450198933318,
-			 0.0436193873653358,
-			 0.0437937535086172,
-			 0.0439681183178646,
-			 0.0441424817877657,
-			 0.0443168439130108,
-			 0.0444912046882885,
-			 0.0446655641082857,
-			 0.0448399221676920,
-			 0.0450142788611954,
-			 0.0451886341834871,
-			 0.0453629881292543,
-			 0.0455373406931841,
-			 0.0457116918699690,
-			 0.0458860416542944,
-			 0.0460603900408518,
-			 0.0462347370243296,
-			 0.0464090825994167,
-			 0.0465834267608032,
-			 0.0467577695031757,
-			 0.0469321108212267,
-			 0.0471064507096422,
-			 0.0472807891631140,
-			 0.0474551261763315,
-			 0.0476294617439823,
-			 0.0478037958607568,
-			 0.0479781285213434,
-			 0.0481524597204336,
-			 0.0483267894527160,
-			 0.0485011177128802,
-			 0.0486754444956159,
-			 0.0488497697956136,
-			 0.0490240936075605,
-			 0.0491984159261489,
-			 0.0493727367460680,
-			 0.0495470560620083,
-			 0.0497213738686581,
-			 0.0498956901607074,
-			 0.0500700049328488,
-			 0.0502443181797689,
-			 0.0504186298961604,
-			 0.0505929400767126,
-			 0.0507672487161158,
-			 0.0509415558090610,
-			 0.0511158613502368,
-			 0.0512901653343344,
-			 0.0514644677560433,
-			 0.0516387686100567,
-			 0.0518130678910633,
-			 0.0519873655937517,
-			 0.0521616617128154,
-			 0.0523359562429439,
-			 0.0525102491788281,
-			 0.0526845405151578,
-			 0.0528588302466254,
-			 0.0530331183679210,
-			 0.0532074048737363,
-			 0.0533816897587605,
-			 0.0535559730176855,
-			 0.0537302546452013,
-			 0.0539045346360017,
-			 0.0540788129847753,
-			 0.0542530896862140,
-			 0.0544273647350091,
-			 0.0546016381258509,
-			 0.0547759098534336,
-			 0.0549501799124448,
-			 0.0551244482975787,
-			 0.0552987150035268,
-			 0.0554729800249788,
-			 0.0556472433566272,
-			 0.0558215049931628,
-			 0.0559957649292799,
-			 0.0561700231596684,
-			 0.0563442796790184,
-			 0.0565185344820244,
-			 0.0566927875633773,
-			 0.0568670389177693,
-			 0.0570412885398921,
-			 0.0572155364244379,
-			 0.0573897825660980,
-			 0.0575640269595671,
-			 0.0577382695995347,
-			 0.0579125104806941,
-			 0.0580867495977376,
-			 0.0582609869453583,
-			 0.0584352225182470,
-			 0.0586094563110962,
-			 0.0587836883186001,
-			 0.0589579185354505,
-			 0.0591321469563400,
-			 0.0593063735759604,
-			 0.0594805983890071,
-			 0.0596548213901712,
-			 0.0598290425741438,
-			 0.0600032619356204,
-			 0.0601774794692931,
-			 0.0603516951698549,
-			 0.0605259090319999,
-			 0.0607001210504185,
-			 0.0608743312198074,
-			 0.0610485395348564,
-			 0.0612227459902615,
-			 0.0613969505807150,
-			 0.0615711533009105,
-			 0.0617453541455414,
-			 0.0619195531093022,
-			 0.0620937501868837,
-			 0.0622679453729823,
-			 0.0624421386622909,
-			 0.0626163300495040,
-			 0.0627905195293137,
-			 0.0629647070964149,
-			 0.0631388927455014,
-			 0.0633130764712663,
-			 0.0634872582684056,
-			 0.0636614381316123,
-			 0.0638356160555808,
-			 0.0640097920350061,
-			 0.0641839660645799,
-			 0.0643581381390000,
-			 0.0645323082529573,
-			 0.0647064764011490,
-			 0.0648806425782697,
-			 0.0650548067790120,
-			 0.0652289689980717,
-			 0.0654031292301424,
-			 0.0655772874699216,
-			 0.0657514437121007,
-			 0.0659255979513771,
-			 0.0660997501824450,
-			 0.0662739004000003,
-			 0.0664480485987362,
-			 0.0666221947733488,
-			 0.0667963389185324,
-			 0.0669704810289850,
-			 0.0671446210993991,
-			 0.0673187591244712,
-			 0.0674928950988966,
-			 0.0676670290173699,
-			 0.0678411608745895,
-			 0.0680152906652473,
-			 0.0681894183840418,
-			 0.0683635440256687,
-			 0.0685376675848221,
-			 0.0687117890561988,
-			 0.0688859084344938,
-			 0.0690600257144058,
-			 0.0692341408906291,
-			 0.0694082539578581,
-			 0.0695823649107917,
-			 0.0697564737441252,
-			 0.0699305804525551,
-			 0.0701046850307767,
-			 0.0702787874734893,
-			 0.0704528877753859,
-			 0.0706269859311665,
-			 0.0708010819355253,
-			 0.0709751757831597,
-			 0.0711492674687667,
-			 0.0713233569870440,
-			 0.0714974443326857,
-			 0.0716715295003917,
-			 0.0718456124848580,
-			 0.0720196932807818,
-			 0.0721937718828604,
-			 0.0723678482857899,
-			 0.0725419224842706,
-			 0.0727159944729979,
-			 0.0728900642466676,
-			 0.0730641317999799,
-			 0.0732381971276314,
-			 0.0734122602243199,
-			 0.0735863210847439,
-			 0.0737603797035986,
-			 0.0739344360755855,
-			 0.0741084901953989,
-			 0.0742825420577394,
-			 0.0744565916573044,
-			 0.0746306389887919,
-			 0.0748046840468992,
-			 0.0749787268263273,
-			 0.0751527673217728,
-			 0.0753268055279323,
-			 0.0755008414395070,
-			 0.0756748750511954,
-			 0.0758489063576944,
-			 0.0760229353537037,
-			 0.0761969620339210,
-			 0.0763709863930470,
-			 0.0765450084257797,
-			 0.0767190281268181,
-			 0.0768930454908613,
-			 0.0770670605126093,
-			 0.0772410731867586,
-			 0.0774150835080120,
-			 0.0775890914710654,
-			 0.0777630970706208,
-			 0.0779371003013777,
-			 0.0781111011580338,
-			 0.0782850996352897,
-			 0.0784590957278443,
-			 0.0786330894303999,
-			 0.0788070807376529,
-			 0.0789810696443058,
-			 0.0791550561450577,
-			 0.0793290402346097,
-			 0.0795030219076600,
-			 0.0796770011589088,
-			 0.0798509779830592,
-			 0.0800249523748098,
-			 0.0801989243288591,
-			 0.0803728938399103,
-			 0.0805468609026632,
-			 0.0807208255118185,
-			 0.0808947876620758,
-			 0.0810687473481380,
-			 0.0812427045647049,
-			 0.0814166593064783,
-			 0.0815906115681576,
-			 0.0817645613444448,
-			 0.0819385086300401,
-			 0.0821124534196466,
-			 0.0822863957079656,
-			 0.0824603354896968,
-			 0.0826342727595425,
-			 0.0828082075122043,
-			 0.0829821397423839,
-			 0.0831560694447821,
-			 0.0833299966141033,
-			 0.0835039212450459,
-			 0.0836778433323154,
-			 0.0838517628706111,
-			 0.0840256798546361,
-			 0.0841995942790925,
-			 0.0843735061386835,
-			 0.0845474154281087,
-			 0.0847213221420733,
-			 0.0848952262752788,
-			 0.0850691278224279,
-			 0.0852430267782231,
-			 0.0854169231373673,
-			 0.0855908168945623,
-			 0.0857647080445137,
-			 0.0859385965819218,
-			 0.0861124825014906,
-			 0.0862863657979231,
-			 0.0864602464659227,
-			 0.0866341245001934,
-			 0.0868079998954360,
-			 0.0869818726463566,
-			 0.0871557427476579,
-			 0.0873296101940434,
-			 0.0875034749802169,
-			 0.0876773371008821,
-			 0.0878511965507420,
-			 0.0880250533245032,
-			 0.0881989074168679,
-			 0.0883727588225385,
-			 0.0885466075362218,
-			 0.0887204535526221,
-			 0.0888942968664420,
-			 0.0890681374723867,
-			 0.0892419753651600,
-			 0.0894158105394681,
-			 0.0895896429900148,
-			 0.0897634727115050,
-			 0.0899372996986435,
-			 0.0901111239461360,
-			 0.0902849454486849,
-			 0.0904587642009980,
-			 0.0906325801977796,
-			 0.0908063934337350,
-			 0.0909802039035703,
-			 0.0911540116019892,
-			 0.0913278165236981,
-			 0.0915016186634018,
-			 0.0916754180158077,
-			 0.0918492145756207,
-			 0.0920230083375466,
-			 0.0921967992962904,
-			 0.0923705874465610,
-			 0.0925443727830625,
-			 0.0927181553004995,
-			 0.0928919349935817,
-			 0.0930657118570129,
-			 0.0932394858855004,
-			 0.0934132570737508,
-			 0.0935870254164706,
-			 0.0937607909083666,
-			 0.0939345535441447,
-			 0.0941083133185136,
-			 0.0942820702261793,
-			 0.0944558242618498,
-			 0.0946295754202305,
-			 0.0948033236960295,
-			 0.0949770690839532,
-			 0.0951508115787109,
-			 0.0953245511750100,
-			 0.0954982878675563,
-			 0.0956720216510584,
-			 0.0958457525202232,
-			 0.0960194804697612,
-			 0.0961932054943767,
-			 0.0963669275887806,
-			 0.0965406467476800,
-			 0.0967143629657840,
-			 0.0968880762377992,
-			 0.0970617865584339,
-			 0.0972354939223993,
-			 0.0974091983244022,
-			 0.0975828997591494,
-			 0.0977565982213525,
-			 0.0979302937057192,
-			 0.0981039862069586,
-			 0.0982776757197798,
-			 0.0984513622388917,
-			 0.0986250457590027,
-			 0.0987987262748249,
-			 0.0989724037810648,
-			 0.0991460782724330,
-			 0.0993197497436389,
-			 0.0994934181893922,
-			 0.0996670836044035,
-			 0.0998407459833801,
-			 0.1000144053210346,
-			 0.1001880616120761,
-			 0.1003617148512147,
-			 0.1005353650331597,
-			 0.1007090121526242,
-			 0.1008826562043150,
-			 0.1010562971829461,
-			 0.1012299350832255,
-			 0.1014035698998647,
-			 0.1015772016275745,
-			 0.1017508302610668,
-			 0.1019244557950497,
-			 0.1020980782242380,
-			 0.1022716975433391,
-			 0.1024453137470671,
-			 0.1026189268301324,
-			 0.1027925367872464,
-			 0.1029661436131199,
-			 0.1031397473024670,
-			 0.1033133478499977,
-			 0.1034869452504221,
-			 0.1036605394984548,
-			 0.1038341305888069,
-			 0.1040077185161914,
-			 0.1041813032753187,
-			 0.1043548848609021,
-			 0.1045284632676530,
-			 0.1047020384902857,
-			 0.1048756105235120,
-			 0.1050491793620444,
-			 0.1052227450005950,
-			 0.1053963074338793,
-			 0.1055698666566084,
-			 0.1057434226634938,
-			 0.1059169754492512,
-			 0.1060905250085939,
-			 0.1062640713362335,
-			 0.1064376144268844,
-			 0.1066111542752593,
-			 0.1067846908760745,
-			 0.1069582242240402,
-			 0.1071317543138730,
-			 0.1073052811402860,
-			 0.1074788046979940,
-			 0.1076523249817096,
-			 0.1078258419861469,
-			 0.1079993557060230,
-			 0.1081728661360489,
-			 0.1083463732709426,
-			 0.1085198771054162,
-			 0.1086933776341853,
-			 0.1088668748519647,
-			 0.1090403687534695,
-			 0.1092138593334139,
-			 0.1093873465865147,
-			 0.1095608305074865,
-			 0.1097343110910454,
-			 0.1099077883319051,
-			 0.1100812622247812,
-			 0.1102547327643922,
-			 0.1104281999454519,
-			 0.1106016637626745,
-			 0.1107751242107787,
-			 0.1109485812844796,
-			 0.1111220349784935,
-			 0.1112954852875358,
-			 0.1114689322063254,
-			 0.1116423757295755,
-			 0.1118158158520061,
-			 0.1119892525683313,
-			 0.1121626858732688,
-			 0.1123361157615355,
-			 0.1125095422278475,
-			 0.1126829652669247,
-			 0.1128563848734816,
-			 0.1130298010422364,
-			 0.1132032137679066,
-			 0.1133766230452097,
-			 0.1135500288688634,
-			 0.1137234312335854,
-			 0.1138968301340927,
-			 0.1140702255651059,
-			 0.1142436175213405,
-			 0.1144170059975155,
-			 0.1145903909883492,
-			 0.1147637724885609,
-			 0.1149371504928664,
-			 0.1151105249959878,
-			 0.1152838959926404,
-			 0.1154572634775455,
-			 0.1156306274454213,
-			 0.1158039878909868,
-			 0.1159773448089602,
-			 0.1161506981940634,
-			 0.1163240480410140,
-			 0.1164973943445298,
-			 0.1166707370993328,
-			 0.1168440763001420,
-			 0.1170174119416780,
-			 0.1171907440186588,
-			 0.1173640725258046,
-			 0.1175373974578372,
-			 0.1177107188094760,
-			 0.1178840365754412,
-			 0.1180573507504533,
-			 0.1182306613292319,
-			 0.1184039683065005,
-			 0.1185772716769770,
-			 0.1187505714353833,
-			 0.1189238675764404,
-			 0.1190971600948701,
-			 0.1192704489853920,
-			 0.1194437342427283,
-			 0.1196170158615995,
-			 0.1197902938367298,
-			 0.1199635681628374,
-			 0.1201368388346465,
-			 0.1203101058468783,
-			 0.1204833691942556,
-			 0.1206566288714987,
-			 0.1208298848733298,
-			 0.1210031371944739,
-			 0.1211763858296499,
-			 0.1213496307735839,
-			 0.1215228720209959,
-			 0.1216961095666095,
-			 0.1218693434051477,
-			 0.1220425735313325,
-			 0.1222157999398887,
-			 0.1223890226255389,
-			 0.1225622415830062,
-			 0.1227354568070150,
-			 0.1229086682922871,
-			 0.1230818760335462,
-			 0.1232550800255179,
-			 0.1234282802629260,
-			 0.1236014767404928,
-			 0.1237746694529433,
-			 0.1239478583950009,
-			 0.1241210435613926,
-			 0.1242942249468394,
-			 0.1244674025460693,
-			 0.1246405763538035,
-			 0.1248137463647705,
-			 0.1249869125736924,
-			 0.1251600749752953,
-			 0.1253332335643042,
-			 0.1255063883354437,
-			 0.1256795392834417,
-			 0.1258526864030221,
-			 0.1260258296889086,
-			 0.1261989691358297,
-			 0.1263721047385104,
-			 0.1265452364916766,
-			 0.1267183643900537,
-			 0.1268914884283694,
-			 0.1270646086013504,
-			 0.1272377249037211,
-			 0.1274108373302091,
-			 0.1275839458755410,
-			 0.1277570505344446,
-			 0.1279301513016441,
-			 0.1281032481718693,
-			 0.1282763411398464,
-			 0.1284494302003026,
-			 0.1286225153479646,
-			 0.1287955965775626,
-			 0.1289686738838205,
-			 0.1291417472614697,
-			 0.1293148167052355,
-			 0.1294878822098467,
-			 0.1296609437700315,
-			 0.1298340013805180,
-			 0.1300070550360347,
-			 0.1301801047313109,
-			 0.1303531504610727,
-			 0.1305261922200521,
-			 0.1306992300029746,
-			 0.1308722638045718,
-			 0.1310452936195719,
-			 0.1312183194427041,
-			 0.1313913412686985,
-			 0.1315643590922821,
-			 0.1317373729081870,
-			 0.1319103827111421,
-			 0.1320833884958779,
-			 0.1322563902571229,
-			 0.1324293879896078,
-			 0.1326023816880620,
-			 0.1327753713472175,
-			 0.1329483569618040,
-			 0.1331213385265519,
-			 0.1332943160361910,
-			 0.1334672894854549,
-			 0.1336402588690727,
-			 0.1338132241817736,
-			 0.1339861854182915,
-			 0.1341591425733568,
-			 0.1343320956417018,
-			 0.1345050446180563,
-			 0.1346779894971520,
-			 0.1348509302737233,
-			 0.1350238669424986,
-			 0.1351967994982126,
-			 0.1353697279355965,
-			 0.1355426522493828,
-			 0.1357155724343046,
-			 0.1358884884850928,
-			 0.1360614003964810,
-			 0.1362343081632010,
-			 0.1364072117799885,
-			 0.1365801112415737,
-			 0.1367530065426909,
-			 0.1369258976780733,
-			 0.1370987846424544,
-			 0.1372716674305668,
-			 0.1374445460371459,
-			 0.1376174204569248,
-			 0.1377902906846382,
-			 0.1379631567150184,
-			 0.1381360185427997,
-			 0.1383088761627190,
-			 0.1384817295695073,
-			 0.1386545787579026,
-			 0.1388274237226370,
-			 0.1390002644584463,
-			 0.1391731009600655,
-			 0.1393459332222286,
-			 0.1395187612396737,
-			 0.1396915850071325,
-			 0.1398644045193431,
-			 0.1400372197710413,
-			 0.1402100307569610,
-			 0.1403828374718388,
-			 0.1405556399104110,
-			 0.1407284380674134,
-			 0.1409012319375826,
-			 0.1410740215156547,
-			 0.1412468067963664,
-			 0.1414195877744544,
-			 0.1415923644446554,
-			 0.1417651368017063,
-			 0.1419379048403434,
-			 0.1421106685553063,
-			 0.1422834279413299,
-			 0.1424561829931524,
-			 0.1426289337055114,
-			 0.1428016800731438,
-			 0.1429744220907901,
-			 0.1431471597531864,
-			 0.1433198930550691,
-			 0.1434926219911790,
-			 0.1436653465562538,
-			 0.1438380667450319,
-			 0.1440107825522510,
-			 0.1441834939726526,
-			 0.1443562010009738,
-			 0.1445289036319519,
-			 0.1447016018603287,
-			 0.1448742956808427,
-			 0.1450469850882342,
-			 0.1452196700772409,
-			 0.1453923506426027,
-			 0.1455650267790611,
-			 0.1457376984813552,
-			 0.1459103657442251,
-			 0.1460830285624112,
-			 0.1462556869306529,
-			 0.1464283408436933,
-			 0.1466009902962714,
-			 0.1467736352831262,
-			 0.1469462757990013,
-			 0.1471189118386369,
-			 0.1472915433967750,
-			 0.1474641704681553,
-			 0.1476367930475192,
-			 0.1478094111296110,
-			 0.1479820247091689,
-			 0.1481546337809374,
-			 0.1483272383396577,
-			 0.1484998383800719,
-			 0.1486724338969233,
-			 0.1488450248849516,
-			 0.1490176113389029,
-			 0.1491901932535165,
-			 0.1493627706235387,
-			 0.1495353434437098,
-			 0.1497079117087738,
-			 0.1498804754134742,
-			 0.1500530345525532,
-			 0.1502255891207564,
-			 0.1503981391128264,
-			 0.1505706845235071,
-			 0.1507432253475434,
-			 0.1509157615796776,
-			 0.1510882932146539,
-			 0.1512608202472193,
-			 0.1514333426721150,
-			 0.1516058604840890,
-			 0.1517783736778835,
-			 0.1519508822482444,
-			 0.1521233861899168,
-			 0.1522958854976449,
-			 0.1524683801661768,
-			 0.1526408701902546,
-			 0.1528133555646264,
-			 0.1529858362840381,
-			 0.1531583123432338,
-			 0.1533307837369606,
-			 0.1535032504599638,
-			 0.1536757125069923,
-			 0.1538481698727909,
-			 0.1540206225521045,
-			 0.1541930705396826,
-			 0.1543655138302711,
-			 0.1545379524186171,
-			 0.1547103862994672,
-			 0.1548828154675702,
-			 0.1550552399176737,
-			 0.1552276596445236,
-			 0.1554000746428687,
-			 0.1555724849074568,
-			 0.1557448904330351,
-			 0.1559172912143545,
-			 0.1560896872461608,
-			 0.1562620785232033,
-			 0.1564344650402307,
-			 0.1566068467919918,
-			 0.1567792237732355,
-			 0.1569515959787101,
-			 0.1571239634031675,
-			 0.1572963260413553,
-			 0.1574686838880212,
-			 0.1576410369379176,
-			 0.1578133851857934,
-			 0.1579857286263994,
-			 0.1581580672544841,
-			 0.1583304010647977,
-			 0.1585027300520933,
-			 0.1586750542111178,
-			 0.1588473735366247,
-			 0.1590196880233638,
-			 0.1591919976660863,
-			 0.1593643024595441,
-			 0.1595366023984859,
-			 0.1597088974776658,
-			 0.1598811876918345,
-			 0.1600534730357437,
-			 0.1602257535041461,
-			 0.1603980290917922,
-			 0.1605702997934340,
-			 0.1607425656038256,
-			 0.1609148265177188,
-			 0.1610870825298659,
-			 0.1612593336350200,
-			 0.1614315798279339,
-			 0.1616038211033615,
-			 0.1617760574560535,
-			 0.1619482888807667,
-			 0.1621205153722512,
-			 0.1622927369252642,
-			 0.1624649535345568,
-			 0.1626371651948839,
-			 0.1628093719009997,
-			 0.1629815736476575,
-			 0.1631537704296136,
-			 0.1633259622416216,
-			 0.1634981490784364,
-			 0.1636703309348136,
-			 0.1638425078055065,
-			 0.1640146796852713,
-			 0.1641868465688623,
-			 0.1643590084510368,
-			 0.1645311653265506,
-			 0.1647033171901575,
-			 0.1648754640366146,
-			 0.1650476058606778,
-			 0.1652197426571026,
-			 0.1653918744206470,
-			 0.1655640011460669,
-			 0.1657361228281189,
-			 0.1659082394615608,
-			 0.1660803510411470,
-			 0.1662524575616381,
-			 0.1664245590177881,
-			 0.1665966554043578,
-			 0.1667687467161023,
-			 0.1669408329477803,
-			 0.1671129140941498,
-			 0.1672849901499688,
-			 0.1674570611099955,
-			 0.1676291269689877,
-			 0.1678011877217055,
-			 0.1679732433629077,
-			 0.1681452938873514,
-			 0.1683173392897967,
-			 0.1684893795650025,
-			 0.1686614147077275,
-			 0.1688334447127338,
-			 0.1690054695747784,
-			 0.1691774892886219,
-			 0.1693495038490245,
-			 0.1695215132507462,
-			 0.1696935174885473,
-			 0.1698655165571874,
-			 0.1700375104514288,
-			 0.1702094991660324,
-			 0.1703814826957573,
-			 0.1705534610353653,
-			 0.1707254341796171,
-			 0.1708974021232764,
-			 0.1710693648611032,
-			 0.1712413223878574,
-			 0.1714132746983036,
-			 0.1715852217872028,
-			 0.1717571636493172,
-			 0.1719291002794093,
-			 0.1721010316722414,
-			 0.1722729578225773,
-			 0.1724448787251770,
-			 0.1726167943748062,
-			 0.1727887047662272,
-			 0.1729606098942033,
-			 0.1731325097534987,
-			 0.1733044043388755,
-			 0.1734762936450973,
-			 0.1736481776669300,
-			 0.1738200563991366,
-			 0.1739919298364816,
-			 0.1741637979737285,
-			 0.1743356608056444,
-			 0.1745075183269924,
-			 0.1746793705325357,
-			 0.1748512174170420,
-			 0.1750230589752756,
-			 0.1751948952020028,
-			 0.1753667260919875,
-			 0.1755385516399953,
-			 0.1757103718407949,
-			 0.1758821866891487,
-			 0.1760539961798256,
-			 0.1762258003075911,
-			 0.1763975990672118,
-			 0.1765693924534552,
-			 0.1767411804610856,
-			 0.1769129630848735,
-			 0.1770847403195827,
-			 0.1772565121599831,
-			 0.1774282786008422,
-			 0.1776000396369260,
-			 0.1777717952630033,
-			 0.1779435454738420,
-			 0.1781152902642095,
-			 0.1782870296288758,
-			 0.1784587635626087,
-			 0.1786304920601768,
-			 0.1788022151163498,
-			 0.1789739327258941,
-			 0.1791456448835824,
-			 0.1793173515841806,
-			 0.1794890528224617,
-			 0.1796607485931927,
-			 0.1798324388911443,
-			 0.1800041237110866,
-			 0.1801758030477888,
-			 0.1803474768960240,
-			 0.1805191452505592,
-			 0.1806908081061676,
-			 0.1808624654576201,
-			 0.1810341172996860,
-			 0.1812057636271374,
-			 0.1813774044347446,
-			 0.1815490397172820,
-			 0.1817206694695194,
-			 0.1818922936862268,
-			 0.1820639123621791,
-			 0.1822355254921474,
-			 0.1824071330709042,
-			 0.1825787350932220,
-			 0.1827503315538726,
-			 0.1829219224476306,
-			 0.1830935077692692,
-			 0.1832650875135597,
-			 0.1834366616752764,
-			 0.1836082302491919,
-			 0.1837797932300827,
-			 0.1839513506127209,
-			 0.1841229023918787,
-			 0.1842944485623332,
-			 0.1844659891188576,
-			 0.1846375240562267,
-			 0.1848090533692144,
-			 0.1849805770525981,
-			 0.1851520951011512,
-			 0.1853236075096472,
-			 0.1854951142728642,
-			 0.1856666153855769,
-			 0.1858381108425611,
-			 0.1860096006385936,
-			 0.1861810847684479,
-			 0.1863525632269039,
-			 0.1865240360087343,
-			 0.1866955031087186,
-			 0.1868669645216327,
-			 0.1870384202422535,
-			 0.1872098702653583,
-			 0.1873813145857243,
-			 0.1875527531981290,
-			 0.1877241860973502,
-			 0.1878956132781657,
-			 0.1880670347353544,
-			 0.1882384504636927,
-			 0.1884098604579591,
-			 0.1885812647129347,
-			 0.1887526632233947,
-			 0.1889240559841207,
-			 0.1890954429898908,
-			 0.1892668242354844,
-			 0.1894381997156817,
-			 0.1896095694252597,
-			 0.1897809333590017,
-			 0.1899522915116841,
-			 0.1901236438780897,
-			 0.1902949904529988,
-			 0.1904663312311902,
-			 0.1906376662074453,
-			 0.1908089953765442,
-			 0.1909803187332696,
-			 0.1911516362724018,
-			 0.1913229479887222,
-			 0.1914942538770124,
-			 0.1916655539320549,
-			 0.1918368481486298,
-			 0.1920081365215194,
-			 0.1921794190455075,
-			 0.1923506957153766,
-			 0.1925219665259076,
-			 0.1926932314718842,
-			 0.1928644905480892,
-			 0.1930357437493051,
-			 0.1932069910703177,
-			 0.1933782325059071,
-			 0.1935494680508595,
-			 0.1937206976999589,
-			 0.1938919214479875,
-			 0.1940631392897304,
-			 0.1942343512199712,
-			 0.1944055572334971,
-			 0.1945767573250910,
-			 0.1947479514895362,
-			 0.1949191397216205,
-			 0.1950903220161283,
-			 0.1952614983678450,
-			 0.1954326687715555,
-			 0.1956038332220474,
-			 0.1957749917141057,
-			 0.1959461442425177,
-			 0.1961172908020679,
-			 0.1962884313875438,
-			 0.1964595659937313,
-			 0.1966306946154200,
-			 0.1968018172473943,
-			 0.1969729338844425,
-			 0.1971440445213520,
-			 0.1973151491529105,
-			 0.1974862477739058,
-			 0.1976573403791252,
-			 0.1978284269633594,
-			 0.1979995075213942,
-			 0.1981705820480192,
-			 0.1983416505380231,
-			 0.1985127129861947,
-			 0.1986837693873234,
-			 0.1988548197361992,
-			 0.1990258640276091,
-			 0.1991969022563462,
-			 0.1993679344171969,
-			 0.1995389605049540,
-			 0.1997099805144067,
-			 0.1998809944403456,
-			 0.2000520022775604,
-			 0.2002230040208444,
-			 0.2003939996649861,
-			 0.2005649892047774,
-			 0.2007359726350099,
-			 0.2009069499504758,
-			 0.2010779211459652,
-			 0.2012488862162700,
-			 0.2014198451561840,
-			 0.2015907979604987,
-			 0.2017617446240066,
-			 0.2019326851414993,
-			 0.2021036195077725,
-			 0.2022745477176174,
-			 0.2024454697658255,
-			 0.2026163856471928,
-			 0.2027872953565120,
-			 0.2029581988885771,
-			 0.2031290962381826,
-			 0.2032999874001204,
-			 0.2034708723691881,
-			 0.2036417511401770,
-			 0.2038126237078851,
-			 0.2039834900671039,
-			 0.2041543502126311,
-			 0.2043252041392613,
-			 0.2044960518417906,
-			 0.2046668933150132,
-			 0.2048377285537248,
-			 0.2050085575527233,
-			 0.2051793803068048,
-			 0.2053501968107642,
-			 0.2055210070593988,
-			 0.2056918110475056,
-			 0.2058626087698807,
-			 0.2060334002213230,
-			 0.2062041853966290,
-			 0.2063749642905963,
-			 0.2065457368980236,
-			 0.2067165032137063,
-			 0.2068872632324459,
-			 0.2070580169490374,
-			 0.2072287643582818,
-			 0.2073995054549780,
-			 0.2075702402339231,
-			 0.2077409686899172,
-			 0.2079116908177586,
-			 0.2080824066122494,
-			 0.2082531160681860,
-			 0.2084238191803716,
-			 0.2085945159436030,
-			 0.2087652063526837,
-			 0.2089358904024117,
-			 0.2091065680875886,
-			 0.2092772394030152,
-			 0.2094479043434934,
-			 0.2096185629038218,
-			 0.2097892150788045,
-			 0.2099598608632424,
-			 0.2101305002519371,
-			 0.2103011332396908,
-			 0.2104717598213047,
-			 0.2106423799915831,
-			 0.2108129937453286,
-			 0.2109836010773422,
-			 0.2111542019824278,
-			 0.2113247964553877,
-			 0.2114953844910279,
-			 0.2116659660841503,
-			 0.2118365412295570,
-			 0.2120071099220545,
-			 0.2121776721564461,
-			 0.2123482279275362,
-			 0.2125187772301286,
-			 0.2126893200590305,
-			 0.2128598564090436,
-			 0.2130303862749764,
-			 0.2132009096516316,
-			 0.2133714265338158,
-			 0.2135419369163346,
-			 0.2137124407939950,
-			 0.2138829381616004,
-			 0.2140534290139607,
-			 0.2142239133458789,
-			 0.2143943911521645,
-			 0.2145648624276234,
-			 0.2147353271670629,
-			 0.2149057853652902,
-			 0.2150762370171139,
-			 0.2152466821173390,
-			 0.2154171206607761,
-			 0.2155875526422325,
-			 0.2157579780565165,
-			 0.2159283968984375,
-			 0.2160988091628017,
-			 0.2162692148444214,
-			 0.2164396139381025,
-			 0.2166100064386567,
-			 0.2167803923408928,
-			 0.2169507716396206,
-			 0.2171211443296491,
-			 0.2172915104057910,
-			 0.2174618698628551,
-			 0.2176322226956501,
-			 0.2178025688989893,
-			 0.2179729084676838,
-			 0.2181432413965429,
-			 0.2183135676803789,
-			 0.2184838873140025,
-			 0.2186542002922271,
-			 0.2188245066098640,
-			 0.2189948062617252,
-			 0.2191650992426231,
-			 0.2193353855473713,
-			 0.2195056651707806,
-			 0.2196759381076651,
-			 0.2198462043528369,
-			 0.2200164639011113,
-			 0.2201867167473018,
-			 0.2203569628862204,
-			 0.2205272023126822,
-			 0.2206974350215004,
-			 0.2208676610074920,
-			 0.2210378802654682,
-			 0.2212080927902464,
-			 0.2213782985766408,
-			 0.2215484976194674,
-			 0.2217186899135400,
-			 0.2218888754536743,
-			 0.2220590542346886,
-			 0.2222292262513973,
-			 0.2223993914986150,
-			 0.2225695499711607,
-			 0.2227397016638502,
-			 0.2229098465715004,
-			 0.2230799846889275,
-			 0.2232501160109505,
-			 0.2234202405323862,
-			 0.2235903582480530,
-			 0.2237604691527671,
-			 0.2239305732413476,
-			 0.2241006705086119,
-			 0.2242707609493811,
-			 0.2244408445584715,
-			 0.2246109213307027,
-			 0.2247809912608941,
-			 0.2249510543438649,
-			 0.2251211105744348,
-			 0.2252911599474226,
-			 0.2254612024576510,
-			 0.2256312380999367,
-			 0.2258012668691035,
-			 0.2259712887599697,
-			 0.2261413037673567,
-			 0.2263113118860857,
-			 0.2264813131109788,
-			 0.2266513074368549,
-			 0.2268212948585390,
-			 0.2269912753708497,
-			 0.2271612489686116,
-			 0.2273312156466462,
-			 0.2275011753997760,
-			 0.2276711282228228,
-			 0.2278410741106122,
-			 0.2280110130579647,
-			 0.2281809450597046,
-			 0.2283508701106554,
-			 0.2285207882056410,
-			 0.2286906993394862,
-			 0.2288606035070126,
-			 0.2290305007030472,
-			 0.2292003909224138,
-			 0.2293702741599373,
-			 0.2295401504104427,
-			 0.2297100196687552,
-			 0.2298798819296995,
-			 0.2300497371881040,
-			 0.2302195854387927,
-			 0.2303894266765902,
-			 0.2305592608963252,
-			 0.2307290880928244,
-			 0.2308989082609128,
-			 0.2310687213954182,
-			 0.2312385274911671,
-			 0.2314083265429893,
-			 0.2315781185457091,
-			 0.2317479034941568,
-			 0.2319176813831597,
-			 0.2320874522075470,
-			 0.2322572159621453,
-			 0.2324269726417834,
-			 0.2325967222412919,
-			 0.2327664647554991,
-			 0.2329362001792352,
-			 0.2331059285073279,
-			 0.2332756497346081,
-			 0.2334453638559048,
-			 0.2336150708660499,
-			 0.2337847707598730,
-			 0.2339544635322048,
-			 0.2341241491778761,
-			 0.2342938276917180,
-			 0.2344634990685626,
-			 0.2346331633032389,
-			 0.2348028203905821,
-			 0.2349724703254215,
-			 0.2351421131025902,
-			 0.2353117487169205,
-			 0.2354813771632450,
-			 0.2356509984363966,
-			 0.2358206125312075,
-			 0.2359902194425134,
-			 0.2361598191651445,
-			 0.2363294116939378,
-			 0.2364989970237247,
-			 0.2366685751493403,
-			 0.2368381460656187,
-			 0.2370077097673939,
-			 0.2371772662495030,
-			 0.2373468155067787,
-			 0.2375163575340569,
-			 0.2376858923261731,
-			 0.2378554198779630,
-			 0.2380249401842616,
-			 0.2381944532399068,
-			 0.2383639590397341,
-			 0.2385334575785808,
-			 0.2387029488512820,
-			 0.2388724328526748,
-			 0.2390419095775989,
-			 0.2392113790208900,
-			 0.2393808411773841,
-			 0.2395502960419217,
-			 0.2397197436093400,
-			 0.2398891838744773,
-			 0.2400586168321723,
-			 0.2402280424772635,
-			 0.2403974608045893,
-			 0.2405668718089915,
-			 0.2407362754853068,
-			 0.2409056718283758,
-			 0.2410750608330384,
-			 0.2412444424941348,
-			 0.2414138168065060,
-			 0.2415831837649910,
-			 0.2417525433644306,
-			 0.2419218955996675,
-			 0.2420912404655420,
-			 0.2422605779568956,
-			 0.2424299080685700,
-			 0.2425992307954062,
-			 0.2427685461322491,
-			 0.2429378540739383,
-			 0.2431071546153172,
-			 0.2432764477512288,
-			 0.2434457334765169,
-			 0.2436150117860221,
-			 0.2437842826745915,
-			 0.2439535461370652,
-			 0.2441228021682899,
-			 0.2442920507631087,
-			 0.2444612919163662,
-			 0.2446305256229069,
-			 0.2447997518775756,
-			 0.2449689706752183,
-			 0.2451381820106778,
-			 0.2453073858788021,
-			 0.2454765822744361,
-			 0.2456457711924267,
-			 0.2458149526276183,
-			 0.2459841265748583,
-			 0.2461532930289925,
-			 0.2463224519848694,
-			 0.2464916034373354,
-			 0.2466607473812378,
-			 0.2468298838114242,
-			 0.2469990127227432,
-			 0.2471681341100412,
-			 0.2473372479681663,
-			 0.2475063542919690,
-			 0.2476754530762978,
-			 0.2478445443160001,
-			 0.2480136280059258,
-			 0.2481827041409235,
-			 0.2483517727158454,
-			 0.2485208337255381,
-			 0.2486898871648541,
-			 0.2488589330286429,
-			 0.2490279713117561,
-			 0.2491970020090425,
-			 0.2493660251153534,
-			 0.2495350406255425,
-			 0.2497040485344578,
-			 0.2498730488369546,
-			 0.2500420415278822,
-			 0.2502110266020937,
-			 0.2503800040544414,
-			 0.2505489738797781,
-			 0.2507179360729558,
-			 0.2508868906288293,
-			 0.2510558375422511,
-			 0.2512247768080756,
-			 0.2513937084211549,
-			 0.2515626323763431,
-			 0.2517315486684971,
-			 0.2519004572924695,
-			 0.2520693582431136,
-			 0.2522382515152868,
-			 0.2524071371038434,
-			 0.2525760150036390,
-			 0.2527448852095284,
-			 0.2529137477163700,
-			 0.2530826025190166,
-			 0.2532514496123280,
-			 0.2534202889911582,
-			 0.2535891206503650,
-			 0.2537579445848055,
-			 0.2539267607893361,
-			 0.2540955692588169,
-			 0.2542643699881041,
-			 0.2544331629720540,
-			 0.2546019482055274,
-			 0.2547707256833819,
-			 0.2549394954004764,
-			 0.2551082573516698,
-			 0.2552770115318204,
-			 0.2554457579357903,
-			 0.2556144965584365,
-			 0.2557832273946200,
-			 0.2559519504392008,
-			 0.2561206656870402,
-			 0.2562893731329963,
-			 0.2564580727719334,
-			 0.2566267645987091,
-			 0.2567954486081874,
-			 0.2569641247952291,
-			 0.2571327931546958,
-			 0.2573014536814490,
-			 0.2574701063703534,
-			 0.2576387512162698,
-			 0.2578073882140595,
-			 0.2579760173585878,
-			 0.2581446386447173,
-			 0.2583132520673123,
-			 0.2584818576212348,
-			 0.2586504553013488,
-			 0.2588190451025211,
-			 0.2589876270196128,
-			 0.2591562010474911,
-			 0.2593247671810200,
-			 0.2594933254150649,
-			 0.2596618757444918,
-			 0.2598304181641641,
-			 0.2599989526689501,
-			 0.2601674792537150,
-			 0.2603359979133262,
-			 0.2605045086426486,
-			 0.2606730114365499,
-			 0.2608415062898963,
-			 0.2610099931975579,
-			 0.2611784721543985,
-			 0.2613469431552889,
-			 0.2615154061950962,
-			 0.2616838612686895,
-			 0.2618523083709357,
-			 0.2620207474967036,
-			 0.2621891786408649,
-			 0.2623576017982853,
-			 0.2625260169638379,
-			 0.2626944241323899,
-			 0.2628628232988122,
-			 0.2630312144579749,
-			 0.2631995976047479,
-			 0.2633679727340043,
-			 0.2635363398406118,
-			 0.2637046989194442,
-			 0.2638730499653730,
-			 0.2640413929732682,
-			 0.2642097279380026,
-			 0.2643780548544476,
-			 0.2645463737174782,
-			 0.2647146845219647,
-			 0.2648829872627808,
-			 0.2650512819347996,
-			 0.2652195685328947,
-			 0.2653878470519390,
-			 0.2655561174868087,
-			 0.2657243798323750,
-			 0.2658926340835154,
-			 0.2660608802351022,
-			 0.2662291182820111,
-			 0.2663973482191174,
-			 0.2665655700412955,
-			 0.2667337837434237,
-			 0.2669019893203763,
-			 0.2670701867670277,
-			 0.2672383760782567,
-			 0.2674065572489394,
-			 0.2675747302739525,
-			 0.2677428951481724,
-			 0.2679110518664782,
-			 0.2680792004237476,
-			 0.2682473408148566,
-			 0.2684154730346844,
-			 0.2685835970781093,
-			 0.2687517129400109,
-			 0.2689198206152663,
-			 0.2690879200987547,
-			 0.2692560113853572,
-			 0.2694240944699525,
-			 0.2695921693474206,
-			 0.2697602360126417,
-			 0.2699282944604952,
-			 0.2700963446858644,
-			 0.2702643866836275,
-			 0.2704324204486667,
-			 0.2706004459758633,
-			 0.2707684632600989,
-			 0.2709364722962555,
-			 0.2711044730792161,
-			 0.2712724656038605,
-			 0.2714404498650747,
-			 0.2716084258577383,
-			 0.2717763935767370,
-			 0.2719443530169534,
-			 0.2721123041732710,
-			 0.2722802470405747,
-			 0.2724481816137461,
-			 0.2726161078876722,
-			 0.2727840258572368,
-			 0.2729519355173256,
-			 0.2731198368628222,
-			 0.2732877298886127,
-			 0.2734556145895822,
-			 0.2736234909606181,
-			 0.2737913589966058,
-			 0.2739592186924319,
-			 0.2741270700429830,
-			 0.2742949130431468,
-			 0.2744627476878089,
-			 0.2746305739718569,
-			 0.2747983918901800,
-			 0.2749662014376654,
-			 0.2751340026092022,
-			 0.2753017953996771,
-			 0.2754695798039790,
-			 0.2756373558169994,
-			 0.2758051234336240,
-			 0.2759728826487459,
-			 0.2761406334572514,
-			 0.2763083758540330,
-			 0.2764761098339810,
-			 0.2766438353919842,
-			 0.2768115525229344,
-			 0.2769792612217216,
-			 0.2771469614832398,
-			 0.2773146533023779,
-			 0.2774823366740286,
-			 0.2776500115930840,
-			 0.2778176780544364,
-			 0.2779853360529775,
-			 0.2781529855836020,
-			 0.2783206266412019,
-			 0.2784882592206717,
-			 0.2786558833169031,
-			 0.2788234989247900,
-			 0.2789911060392292,
-			 0.2791587046551117,
-			 0.2793262947673354,
-			 0.2794938763707928,
-			 0.2796614494603799,
-			 0.2798290140309920,
-			 0.2799965700775241,
-			 0.2801641175948746,
-			 0.2803316565779365,
-			 0.2804991870216094,
-			 0.2806667089207877,
-			 0.2808342222703691,
-			 0.2810017270652509,
-			 0.2811692233003306,
-			 0.2813367109705061,
-			 0.2815041900706761,
-			 0.2816716605957363,
-			 0.2818391225405881,
-			 0.2820065759001292,
-			 0.2821740206692588,
-			 0.2823414568428762,
-			 0.2825088844158802,
-			 0.2826763033831732,
-			 0.2828437137396527,
-			 0.2830111154802200,
-			 0.2831785085997757,
-			 0.2833458930932199,
-			 0.2835132689554564,
-			 0.2836806361813849,
-			 0.2838479947659053,
-			 0.2840153447039223,
-			 0.2841826859903371,
-			 0.2843500186200523,
-			 0.2845173425879697,
-			 0.2846846578889950,
-			 0.2848519645180297,
-			 0.2850192624699757,
-			 0.2851865517397394,
-			 0.2853538323222239,
-			 0.2855211042123345,
-			 0.2856883674049740,
-			 0.2858556218950474,
-			 0.2860228676774623,
-			 0.2861901047471206,
-			 0.2863573330989308,
-			 0.2865245527277978,
-			 0.2866917636286279,
-			 0.2868589657963282,
-			 0.2870261592258039,
-			 0.2871933439119621,
-			 0.2873605198497114,
-			 0.2875276870339589,
-			 0.2876948454596130,
-			 0.2878619951215801,
-			 0.2880291360147686,
-			 0.2881962681340896,
-			 0.2883633914744485,
-			 0.2885305060307571,
-			 0.2886976117979239,
-			 0.2888647087708585,
-			 0.2890317969444718,
-			 0.2891988763136714,
-			 0.2893659468733711,
-			 0.2895330086184784,
-			 0.2897000615439076,
-			 0.2898671056445674,
-			 0.2900341409153703,
-			 0.2902011673512280,
-			 0.2903681849470519,
-			 0.2905351936977567,
-			 0.2907021935982517,
-			 0.2908691846434524,
-			 0.2910361668282719,
-			 0.2912031401476220,
-			 0.2913701045964172,
-			 0.2915370601695714,
-			 0.2917040068619981,
-			 0.2918709446686144,
-			 0.2920378735843324,
-			 0.2922047936040680,
-			 0.2923717047227367,
-			 0.2925386069352531,
-			 0.2927055002365357,
-			 0.2928723846214972,
-			 0.2930392600850565,
-			 0.2932061266221304,
-			 0.2933729842276341,
-			 0.2935398328964856,
-			 0.2937066726236017,
-			 0.2938735034039026,
-			 0.2940403252323047,
-			 0.2942071381037246,
-			 0.2943739420130835,
-			 0.2945407369552993,
-			 0.2947075229252912,
-			 0.2948742999179777,
-			 0.2950410679282803,
-			 0.2952078269511189,
-			 0.2953745769814120,
-			 0.2955413180140809,
-			 0.2957080500440465,
-			 0.2958747730662298,
-			 0.2960414870755530,
-			 0.2962081920669351,
-			 0.2963748880353006,
-			 0.2965415749755707,
-			 0.2967082528826679,
-			 0.2968749217515149,
-			 0.2970415815770338,
-			 0.2972082323541504,
-			 0.2973748740777865,
-			 0.2975415067428643,
-			 0.2977081303443103,
-			 0.2978747448770481,
-			 0.2980413503360032,
-			 0.2982079467160987,
-			 0.2983745340122599,
-			 0.2985411122194147,
-			 0.2987076813324855,
-			 0.2988742413464009,
-			 0.2990407922560863,
-			 0.2992073340564682,
-			 0.2993738667424744,
-			 0.2995403903090295,
-			 0.2997069047510633,
-			 0.2998734100635027,
-			 0.3000399062412757,
-			 0.3002063932793115,
-			 0.3003728711725366,
-			 0.3005393399158801,
-			 0.3007057995042726,
-			 0.3008722499326427,
-			 0.3010386911959199,
-			 0.3012051232890342,
-			 0.3013715462069158,
-			 0.3015379599444959,
-			 0.3017043644967030,
-			 0.3018707598584711,
-			 0.3020371460247284,
-			 0.3022035229904099,
-			 0.3023698907504447,
-			 0.3025362492997660,
-			 0.3027025986333062,
-			 0.3028689387459970,
-			 0.3030352696327742,
-			 0.3032015912885674,
-			 0.3033679037083129,
-			 0.3035342068869444,
-			 0.3037005008193945,
-			 0.3038667855005983,
-			 0.3040330609254895,
-			 0.3041993270890051,
-			 0.3043655839860801,
-			 0.3045318316116484,
-			 0.3046980699606466,
-			 0.3048642990280109,
-			 0.3050305188086767,
-			 0.3051967292975825,
-			 0.3053629304896642,
-			 0.3055291223798591,
-			 0.3056953049631057,
-			 0.3058614782343391,
-			 0.3060276421885007,
-			 0.3061937968205256,
-			 0.3063599421253558,
-			 0.3065260780979277,
-			 0.3066922047331813,
-			 0.3068583220260561,
-			 0.3070244299714919,
-			 0.3071905285644287,
-			 0.3073566177998061,
-			 0.3075226976725673,
-			 0.3076887681776513,
-			 0.3078548293099979,
-			 0.3080208810645509,
-			 0.3081869234362514,
-			 0.3083529564200414,
-			 0.3085189800108640,
-			 0.3086849942036594,
-			 0.3088509989933730,
-			 0.3090169943749472,
-			 0.3091829803433255,
-			 0.3093489568934517,
-			 0.3095149240202688,
-			 0.3096808817187232,
-			 0.3098468299837592,
-			 0.3100127688103203,
-			 0.3101786981933524,
-			 0.3103446181278002,
-			 0.3105105286086121,
-			 0.3106764296307323,
-			 0.3108423211891057,
-			 0.3110082032786813,
-			 0.3111740758944054,
-			 0.3113399390312250,
-			 0.3115057926840878,
-			 0.3116716368479415,
-			 0.3118374715177351,
-			 0.3120032966884145,
-			 0.3121691123549316,
-			 0.3123349185122322,
-			 0.3125007151552678,
-			 0.3126665022789882,
-			 0.3128322798783415,
-			 0.3129980479482786,
-			 0.3131638064837491,
-			 0.3133295554797054,
-			 0.3134952949310977,
-			 0.3136610248328772,
-			 0.3138267451799955,
-			 0.3139924559674053,
-			 0.3141581571900563,
-			 0.3143238488429034,
-			 0.3144895309208986,
-			 0.3146552034189957,
-			 0.3148208663321464,
-			 0.3149865196553042,
-			 0.3151521633834257,
-			 0.3153177975114617,
-			 0.3154834220343690,
-			 0.3156490369471019,
-			 0.3158146422446152,
-			 0.3159802379218652,
-			 0.3161458239738051,
-			 0.3163114003953943,
-			 0.3164769671815855,
-			 0.3166425243273378,
-			 0.3168080718276081,
-			 0.3169736096773519,
-			 0.3171391378715274,
-			 0.3173046564050923,
-			 0.3174701652730046,
-			 0.3176356644702220,
-			 0.3178011539917044,
-			 0.3179666338324102,
-			 0.3181321039872993,
-			 0.3182975644513295,
-			 0.3184630152194614,
-			 0.3186284562866544,
-			 0.3187938876478711,
-			 0.3189593092980700,
-			 0.3191247212322127,
-			 0.3192901234452605,
-			 0.3194555159321741,
-			 0.3196208986879179,
-			 0.3197862717074507,
-			 0.3199516349857375,
-			 0.3201169885177411,
-			 0.3202823322984226,
-			 0.3204476663227465,
-			 0.3206129905856754,
-			 0.3207783050821758,
-			 0.3209436098072103,
-			 0.3211089047557416,
-			 0.3212741899227373,
-			 0.3214394653031615,
-			 0.3216047308919796,
-			 0.3217699866841575,
-			 0.3219352326746602,
-			 0.3221004688584558,
-			 0.3222656952305109,
-			 0.3224309117857908,
-			 0.3225961185192633,
-			 0.3227613154258963,
-			 0.3229265025006581,
-			 0.3230916797385154,
-			 0.3232568471344364,
-			 0.3234220046833917,
-			 0.3235871523803492,
-			 0.3237522902202786,
-			 0.3239174181981483,
-			 0.3240825363089310,
-			 0.3242476445475950,
-			 0.3244127429091093,
-			 0.3245778313884473,
-			 0.3247429099805790,
-			 0.3249079786804761,
-			 0.3250730374831111,
-			 0.3252380863834534,
-			 0.3254031253764786,
-			 0.3255681544571563,
-			 0.3257331736204617,
-			 0.3258981828613672,
-			 0.3260631821748464,
-			 0.3262281715558730,
-			 0.3263931509994213,
-			 0.3265581205004657,
-			 0.3267230800539809,
-			 0.3268880296549420,
-			 0.3270529692983251,
-			 0.3272178989791043,
-			 0.3273828186922554,
-			 0.3275477284327573,
-			 0.3277126281955831,
-			 0.3278775179757123,
-			 0.3280423977681211,
-			 0.3282072675677871,
-			 0.3283721273696888,
-			 0.3285369771688019,
-			 0.3287018169601081,
-			 0.3288666467385827,
-			 0.3290314664992072,
-			 0.3291962762369609,
-			 0.3293610759468218,
-			 0.3295258656237706,
-			 0.3296906452627866,
-			 0.3298554148588531,
-			 0.3300201744069473,
-			 0.3301849239020530,
-			 0.3303496633391508,
-			 0.3305143927132232,
-			 0.3306791120192507,
-			 0.3308438212522155,
-			 0.3310085204071021,
-			 0.3311732094788934,
-			 0.3313378884625711,
-			 0.3315025573531195,
-			 0.3316672161455226,
-			 0.3318318648347637,
-			 0.3319965034158298,
-			 0.3321611318837025,
-			 0.3323257502333694,
-			 0.3324903584598158,
-			 0.3326549565580260,
-			 0.3328195445229867,
-			 0.3329841223496834,
-			 0.3331486900331055,
-			 0.3333132475682382,
-			 0.3334777949500671,
-			 0.3336423321735823,
-			 0.3338068592337709,
-			 0.3339713761256211,
-			 0.3341358828441206,
-			 0.3343003793842607,
-			 0.3344648657410273,
-			 0.3346293419094132,
-			 0.3347938078844055,
-			 0.3349582636609953,
-			 0.3351227092341730,
-			 0.3352871445989300,
-			 0.3354515697502549,
-			 0.3356159846831414,
-			 0.3357803893925805,
-			 0.3359447838735640,
-			 0.3361091681210842,
-			 0.3362735421301328,
-			 0.3364379058957053,
-			 0.3366022594127923,
-			 0.3367666026763881,
-			 0.3369309356814865,
-			 0.3370952584230819,
-			 0.3372595708961684,
-			 0.3374238730957417,
-			 0.3375881650167945,
-			 0.3377524466543254,
-			 0.3379167180033267,
-			 0.3380809790587970,
-			 0.3382452298157319,
-			 0.3384094702691278,
-			 0.3385737004139809,
-			 0.3387379202452910,
-			 0.3389021297580541,
-			 0.3390663289472662,
-			 0.3392305178079282,
-			 0.3393946963350385,
-			 0.3395588645235945,
-			 0.3397230223685959,
-			 0.3398871698650414,
-			 0.3400513070079325,
-			 0.3402154337922684,
-			 0.3403795502130497,
-			 0.3405436562652769,
-			 0.3407077519439520,
-			 0.3408718372440738,
-			 0.3410359121606465,
-			 0.3411999766886714,
-			 0.3413640308231505,
-			 0.3415280745590875,
-			 0.3416921078914828,
-			 0.3418561308153429,
-			 0.3420201433256682,
-			 0.3421841454174658,
-			 0.3423481370857366,
-			 0.3425121183254876,
-			 0.3426760891317229,
-			 0.3428400494994485,
-			 0.3430039994236680,
-			 0.3431679388993875,
-			 0.3433318679216146,
-			 0.3434957864853558,
-			 0.3436596945856162,
-			 0.3438235922174037,
-			 0.3439874793757257,
-			 0.3441513560555898,
-			 0.3443152222520033,
-			 0.3444790779599762,
-			 0.3446429231745163,
-			 0.3448067578906335,
-			 0.3449705821033355,
-			 0.3451343958076325,
-			 0.3452981989985339,
-			 0.3454619916710515,
-			 0.3456257738201958,
-			 0.3457895454409762,
-			 0.3459533065284048,
-			 0.3461170570774922,
-			 0.3462807970832528,
-			 0.3464445265406954,
-			 0.3466082454448360,
-			 0.3467719537906839,
-			 0.3469356515732558,
-			 0.3470993387875626,
-			 0.3472630154286189,
-			 0.3474266814914389,
-			 0.3475903369710378,
-			 0.3477539818624279,
-			 0.3479176161606268,
-			 0.3480812398606490,
-			 0.3482448529575105,
-			 0.3484084554462270,
-			 0.3485720473218142,
-			 0.3487356285792906,
-			 0.3488991992136731,
-			 0.3490627592199774,
-			 0.3492263085932220,
-			 0.3493898473284249,
-			 0.3495533754206046,
-			 0.3497168928647802,
-			 0.3498803996559686,
-			 0.3500438957891913,
-			 0.3502073812594672,
-			 0.3503708560618163,
-			 0.3505343201912579,
-			 0.3506977736428152,
-			 0.3508612164115058,
-			 0.3510246484923543,
-			 0.3511880698803796,
-			 0.3513514805706046,
-			 0.3515148805580515,
-			 0.3516782698377437,
-			 0.3518416484047015,
-			 0.3520050162539515,
-			 0.3521683733805138,
-			 0.3523317197794150,
-			 0.3524950554456782,
-			 0.3526583803743280,
-			 0.3528216945603891,
-			 0.3529849979988878,
-			 0.3531482906848469,
-			 0.3533115726132948,
-			 0.3534748437792567,
-			 0.3536381041777591,
-			 0.3538013538038298,
-			 0.3539645926524932,
-			 0.3541278207187802,
-			 0.3542910379977153,
-			 0.3544542444843291,
-			 0.3546174401736492,
-			 0.3547806250607043,
-			 0.3549437991405228,
-			 0.3551069624081365,
-			 0.3552701148585736,
-			 0.3554332564868625,
-			 0.3555963872880361,
-			 0.3557595072571251,
-			 0.3559226163891591,
-			 0.3560857146791702,
-			 0.3562488021221892,
-			 0.3564118787132509,
-			 0.3565749444473843,
-			 0.3567379993196246,
-			 0.3569010433250040,
-			 0.3570640764585568,
-			 0.3572270987153149,
-			 0.3573901100903135,
-			 0.3575531105785859,
-			 0.3577161001751685,
-			 0.3578790788750965,
-			 0.3580420466734036,
-			 0.3582050035651261,
-			 0.3583679495452995,
-			 0.3585308846089626,
-			 0.3586938087511488,
-			 0.3588567219668975,
-			 0.3590196242512454,
-			 0.3591825155992310,
-			 0.3593453960058907,
-			 0.3595082654662629,
-			 0.3596711239753887,
-			 0.3598339715283055,
-			 0.3599968081200512,
-			 0.3601596337456678,
-			 0.3603224484001946,
-			 0.3604852520786720,
-			 0.3606480447761399,
-			 0.3608108264876417,
-			 0.3609735972082156,
-			 0.3611363569329067,
-			 0.3612991056567544,
-			 0.3614618433748020,
-			 0.3616245700820922,
-			 0.3617872857736681,
-			 0.3619499904445731,
-			 0.3621126840898509,
-			 0.3622753667045455,
-			 0.3624380382837015,
-			 0.3626006988223635,
-			 0.3627633483155757,
-			 0.3629259867583861,
-			 0.3630886141458371,
-			 0.3632512304729781,
-			 0.3634138357348531,
-			 0.3635764299265096,
-			 0.3637390130429947,
-			 0.3639015850793568,
-			 0.3640641460306410,
-			 0.3642266958918988,
-			 0.3643892346581753,
-			 0.3645517623245219,
-			 0.3647142788859867,
-			 0.3648767843376193,
-			 0.3650392786744687,
-			 0.3652017618915875,
-			 0.3653642339840244,
-			 0.3655266949468287,
-			 0.3656891447750539,
-			 0.3658515834637509,
-			 0.3660140110079721,
-			 0.3661764274027682,
-			 0.3663388326431916,
-			 0.3665012267242969,
-			 0.3666636096411364,
-			 0.3668259813887637,
-			 0.3669883419622325,
-			 0.3671506913565964,
-			 0.3673130295669124,
-			 0.3674753565882337,
-			 0.3676376724156138,
-			 0.3677999770441109,
-			 0.3679622704687809,
-			 0.3681245526846783,
-			 0.3682868236868606,
-			 0.3684490834703839,
-			 0.3686113320303079,
-			 0.3687735693616870,
-			 0.3689357954595818,
-			 0.3690980103190495,
-			 0.3692602139351497,
-			 0.3694224063029397,
-			 0.3695845874174790,
-			 0.3697467572738287,
-			 0.3699089158670482,
-			 0.3700710631921985,
-			 0.3702331992443388,
-			 0.3703953240185310,
-			 0.3705574375098364,
-			 0.3707195397133159,
-			 0.3708816306240334,
-			 0.3710437102370503,
-			 0.3712057785474295,
-			 0.3713678355502349,
-			 0.3715298812405283,
-			 0.3716919156133736,
-			 0.3718539386638373,
-			 0.3720159503869815,
-			 0.3721779507778717,
-			 0.3723399398315734,
-			 0.3725019175431519,
-			 0.3726638839076731,
-			 0.3728258389202024,
-			 0.3729877825758089,
-			 0.3731497148695562,
-			 0.3733116357965148,
-			 0.3734735453517500,
-			 0.3736354435303303,
-			 0.3737973303273243,
-			 0.3739592057377996,
-			 0.3741210697568277,
-			 0.3742829223794755,
-			 0.3744447636008136,
-			 0.3746065934159120,
-			 0.3747684118198409,
-			 0.3749302188076704,
-			 0.3750920143744732,
-			 0.3752537985153198,
-			 0.3754155712252829,
-			 0.3755773324994330,
-			 0.3757390823328433,
-			 0.3759008207205866,
-			 0.3760625476577369,
-			 0.3762242631393654,
-			 0.3763859671605483,
-			 0.3765476597163590,
-			 0.3767093408018721,
-			 0.3768710104121624,
-			 0.3770326685423053,
-			 0.3771943151873756,
-			 0.3773559503424516,
-			 0.3775175740026080,
-			 0.3776791861629200,
-			 0.3778407868184668,
-			 0.3780023759643251,
-			 0.3781639535955735,
-			 0.3783255197072882,
-			 0.3784870742945478,
-			 0.3786486173524327,
-			 0.3788101488760210,
-			 0.3789716688603924,
-			 0.3791331773006267,
-			 0.3792946741918031,
-			 0.3794561595290047,
-			 0.3796176333073099,
-			 0.3797790955218007,
-			 0.3799405461675587,
-			 0.3801019852396667,
-			 0.3802634127332045,
-			 0.3804248286432580,
-			 0.3805862329649069,
-			 0.3807476256932370,
-			 0.3809090068233312,
-			 0.3810703763502736,
-			 0.3812317342691485,
-			 0.3813930805750407,
-			 0.3815544152630362,
-			 0.3817157383282179,
-			 0.3818770497656749,
-			 0.3820383495704902,
-			 0.3821996377377536,
-			 0.3823609142625493,
-			 0.3825221791399656,
-			 0.3826834323650900,
-			 0.3828446739330096,
-			 0.3830059038388144,
-			 0.3831671220775922,
-			 0.3833283286444321,
-			 0.3834895235344241,
-			 0.3836507067426564,
-			 0.3838118782642192,
-			 0.3839730380942044,
-			 0.3841341862277027,
-			 0.3842953226598039,
-			 0.3844564473856001,
-			 0.3846175604001824,
-			 0.3847786616986455,
-			 0.3849397512760787,
-			 0.3851008291275773,
-			 0.3852618952482338,
-			 0.3854229496331428,
-			 0.3855839922773966,
-			 0.3857450231760894,
-			 0.3859060423243186,
-			 0.3860670497171759,
-			 0.3862280453497600,
-			 0.3863890292171642,
-			 0.3865500013144856,
-			 0.3867109616368206,
-			 0.3868719101792661,
-			 0.3870328469369193,
-			 0.3871937719048770,
-			 0.3873546850782387,
-			 0.3875155864521029,
-			 0.3876764760215665,
-			 0.3878373537817292,
-			 0.3879982197276907,
-			 0.3881590738545513,
-			 0.3883199161574087,
-			 0.3884807466313659,
-			 0.3886415652715229,
-			 0.3888023720729809,
-			 0.3889631670308404,
-			 0.3891239501402061,
-			 0.3892847213961768,
-			 0.3894454807938583,
-			 0.3896062283283513,
-			 0.3897669639947600,
-			 0.3899276877881880,
-			 0.3900883997037387,
-			 0.3902490997365188,
-			 0.3904097878816315,
-			 0.3905704641341804,
-			 0.3907311284892735,
-			 0.3908917809420158,
-			 0.3910524214875135,
-			 0.3912130501208733,
-			 0.3913736668372021,
-			 0.3915342716316081,
-			 0.3916948644991966,
-			 0.3918554454350780,
-			 0.3920160144343600,
-			 0.3921765714921521,
-			 0.3923371166035619,
-			 0.3924976497636998,
-			 0.3926581709676747,
-			 0.3928186802105985,
-			 0.3929791774875812,
-			 0.3931396627937335,
-			 0.3933001361241661,
-			 0.3934605974739931,
-			 0.3936210468383249,
-			 0.3937814842122723,
-			 0.3939419095909507,
-			 0.3941023229694722,
-			 0.3942627243429513,
-			 0.3944231137065003,
-			 0.3945834910552333,
-			 0.3947438563842676,
-			 0.3949042096887146,
-			 0.3950645509636925,
-			 0.3952248802043159,
-			 0.3953851974057010,
-			 0.3955455025629652,
-			 0.3957057956712227,
-			 0.3958660767255932,
-			 0.3960263457211934,
-			 0.3961866026531421,
-			 0.3963468475165559,
-			 0.3965070803065544,
-			 0.3966673010182565,
-			 0.3968275096467818,
-			 0.3969877061872490,
-			 0.3971478906347800,
-			 0.3973080629844944,
-			 0.3974682232315140,
-			 0.3976283713709583,
-			 0.3977885073979490,
-			 0.3979486313076105,
-			 0.3981087430950618,
-			 0.3982688427554291,
-			 0.3984289302838327,
-			 0.3985890056753972,
-			 0.3987490689252463,
-			 0.3989091200285033,
-			 0.3990691589802952,
-			 0.3992291857757438,
-			 0.3993892004099769,
-			 0.3995492028781200,
-			 0.3997091931752976,
-			 0.3998691712966369,
-			 0.4000291372372639,
-			 0.4001890909923082,
-			 0.4003490325568949,
-			 0.4005089619261527,
-			 0.4006688790952099,
-			 0.4008287840591950,
-			 0.4009886768132364,
-			 0.4011485573524659,
-			 0.4013084256720099,
-			 0.4014682817670018,
-			 0.4016281256325698,
-			 0.4017879572638454,
-			 0.4019477766559600,
-			 0.4021075838040444,
-			 0.4022673787032329,
-			 0.4024271613486564,
-			 0.4025869317354459,
-			 0.4027466898587370,
-			 0.4029064357136625,
-			 0.4030661692953560,
-			 0.4032258905989511,
-			 0.4033855996195849,
-			 0.4035452963523906,
-			 0.4037049807925021,
-			 0.4038646529350574,
-			 0.4040243127751919,
-			 0.4041839603080428,
-			 0.4043435955287455,
-			 0.4045032184324371,
-			 0.4046628290142569,
-			 0.4048224272693421,
-			 0.4049820131928309,
-			 0.4051415867798622,
-			 0.4053011480255742,
-			 0.4054606969251089,
-			 0.4056202334736037,
-			 0.4057797576661996,
-			 0.4059392694980373,
-			 0.4060987689642577,
-			 0.4062582560600022,
-			 0.4064177307804134,
-			 0.4065771931206309,
-			 0.4067366430758005,
-			 0.4068960806410620,
-			 0.4070555058115607,
-			 0.4072149185824398,
-			 0.4073743189488431,
-			 0.4075337069059158,
-			 0.4076930824488004,
-			 0.4078524455726451,
-			 0.4080117962725923,
-			 0.4081711345437910,
-			 0.4083304603813852,
-			 0.4084897737805223,
-			 0.4086490747363493,
-			 0.4088083632440129,
-			 0.4089676392986624,
-			 0.4091269028954452,
-			 0.4092861540295100,
-			 0.4094453926960064,
-			 0.4096046188900820,
-			 0.4097638326068867,
-			 0.4099230338415721,
-			 0.4100822225892878,
-			 0.4102413988451856,
-			 0.4104005626044148,
-			 0.4105597138621273,
-			 0.4107188526134774,
-			 0.4108779788536141,
-			 0.4110370925776936,
-			 0.4111961937808655,
-			 0.4113552824582860,
-			 0.4115143586051088,
-			 0.4116734222164867,
-			 0.4118324732875750,
-			 0.4119915118135279,
-			 0.4121505377895035,
-			 0.4123095512106557,
-			 0.4124685520721391,
-			 0.4126275403691128,
-			 0.4127865160967329,
-			 0.4129454792501566,
-			 0.4131044298245409,
-			 0.4132633678150455,
-			 0.4134222932168289,
-			 0.4135812060250483,
-			 0.4137401062348637,
-			 0.4138989938414347,
-			 0.4140578688399207,
-			 0.4142167312254844,
-			 0.4143755809932840,
-			 0.4145344181384817,
-			 0.4146932426562389,
-			 0.4148520545417168,
-			 0.4150108537900801,
-			 0.4151696403964882,
-			 0.4153284143561076,
-			 0.4154871756640992,
-			 0.4156459243156276,
-			 0.4158046603058572,
-			 0.4159633836299526,
-			 0.4161220942830787,
-			 0.4162807922604018,
-			 0.4164394775570852,
-			 0.4165981501682975,
-			 0.4167568100892045,
-			 0.4169154573149731,
-			 0.4170740918407708,
-			 0.4172327136617650,
-			 0.4173913227731248,
-			 0.4175499191700163,
-			 0.4177085028476106,
-			 0.4178670738010764,
-			 0.4180256320255832,
-			 0.4181841775163020,
-			 0.4183427102684014,
-			 0.4185012302770524,
-			 0.4186597375374277,
-			 0.4188182320446981,
-			 0.4189767137940357,
-			 0.4191351827806119,
-			 0.4192936389996020,
-			 0.4194520824461775,
-			 0.4196105131155103,
-			 0.4197689310027767,
-			 0.4199273361031503,
-			 0.4200857284118066,
-			 0.4202441079239190,
-			 0.4204024746346631,
-			 0.4205608285392171,
-			 0.4207191696327541,
-			 0.4208774979104531,
-			 0.4210358133674905,
-			 0.4211941159990436,
-			 0.4213524058002909,
-			 0.4215106827664093,
-			 0.4216689468925772,
-			 0.4218271981739753,
-			 0.4219854366057822,
-			 0.4221436621831784,
-			 0.4223018749013425,
-			 0.4224600747554559,
-			 0.4226182617406996,
-			 0.4227764358522541,
-			 0.4229345970853026,
-			 0.4230927454350267,
-			 0.4232508808966087,
-			 0.4234090034652324,
-			 0.4235671131360788,
-			 0.4237252099043346,
-			 0.4238832937651809,
-			 0.4240413647138053,
-			 0.4241994227453902,
-			 0.4243574678551219,
-			 0.4245155000381859,
-			 0.4246735192897675,
-			 0.4248315256050556,
-			 0.4249895189792338,
-			 0.4251474994074917,
-			 0.4253054668850170,
-			 0.4254634214069962,
-			 0.4256213629686185,
-			 0.4257792915650726,
-			 0.4259372071915471,
-			 0.4260951098432339,
-			 0.4262529995153206,
-			 0.4264108762029984,
-			 0.4265687399014583,
-			 0.4267265906058904,
-			 0.4268844283114889,
-			 0.4270422530134426,
-			 0.4272000647069460,
-			 0.4273578633871923,
-			 0.4275156490493728,
-			 0.4276734216886819,
-			 0.4278311813003128,
-			 0.4279889278794623,
-			 0.4281466614213236,
-			 0.4283043819210901,
-			 0.4284620893739599,
-			 0.4286197837751282,
-			 0.4287774651197911,
-			 0.4289351334031449,
-			 0.4290927886203889,
-			 0.4292504307667191,
-			 0.4294080598373319,
-			 0.4295656758274280,
-			 0.4297232787322053,
-			 0.4298808685468631,
-			 0.4300384452666016,
-			 0.4301960088866184,
-			 0.4303535594021161,
-			 0.4305110968082948,
-			 0.4306686211003556,
-			 0.4308261322735000,
-			 0.4309836303229292,
-			 0.4311411152438479,
-			 0.4312985870314572,
-			 0.4314560456809586,
-			 0.4316134911875582,
-			 0.4317709235464589,
-			 0.4319283427528661,
-			 0.4320857488019827,
-			 0.4322431416890140,
-			 0.4324005214091678,
-			 0.4325578879576470,
-			 0.4327152413296602,
-			 0.4328725815204135,
-			 0.4330299085251139,
-			 0.4331872223389697,
-			 0.4333445229571867,
-			 0.4335018103749761,
-			 0.4336590845875438,
-			 0.4338163455901011,
-			 0.4339735933778577,
-			 0.4341308279460219,
-			 0.4342880492898049,
-			 0.4344452574044165,
-			 0.4346024522850697,
-			 0.4347596339269752,
-			 0.4349168023253449,
-			 0.4350739574753912,
-			 0.4352310993723277,
-			 0.4353882280113652,
-			 0.4355453433877204,
-			 0.4357024454966043,
-			 0.4358595343332343,
-			 0.4360166098928228,
-			 0.4361736721705859,
-			 0.4363307211617393,
-			 0.4364877568614979,
-			 0.4366447792650808,
-			 0.4368017883677015,
-			 0.4369587841645797,
-			 0.4371157666509330,
-			 0.4372727358219778,
-			 0.4374296916729334,
-			 0.4375866341990178,
-			 0.4377435633954527,
-			 0.4379004792574562,
-			 0.4380573817802467,
-			 0.4382142709590470,
-			 0.4383711467890774,
-			 0.4385280092655591,
-			 0.4386848583837129,
-			 0.4388416941387625,
-			 0.4389985165259306,
-			 0.4391553255404383,
-			 0.4393121211775098,
-			 0.4394689034323690,
-			 0.4396256723002390,
-			 0.4397824277763468,
-			 0.4399391698559150,
-			 0.4400958985341698,
-			 0.4402526138063370,
-			 0.4404093156676426,
-			 0.4405660041133133,
-			 0.4407226791385753,
-			 0.4408793407386584,
-			 0.4410359889087888,
-			 0.4411926236441931,
-			 0.4413492449401025,
-			 0.4415058527917450,
-			 0.4416624471943502,
-			 0.4418190281431487,
-			 0.4419755956333685,
-			 0.4421321496602424,
-			 0.4422886902190010,
-			 0.4424452173048757,
-			 0.4426017309130983,
-			 0.4427582310389013,
-			 0.4429147176775181,
-			 0.4430711908241794,
-			 0.4432276504741213,
-			 0.4433840966225769,
-			 0.4435405292647806,
-			 0.4436969483959672,
-			 0.4438533540113727,
-			 0.4440097461062302,
-			 0.4441661246757783,
-			 0.4443224897152525,
-			 0.4444788412198896,
-			 0.4446351791849271,
-			 0.4447915036056025,
-			 0.4449478144771547,
-			 0.4451041117948198,
-			 0.4452603955538399,
-			 0.4454166657494513,
-			 0.4455729223768958,
-			 0.4457291654314139,
-			 0.4458853949082443,
-			 0.4460416108026289,
-			 0.4461978131098083,
-			 0.4463540018250259,
-			 0.4465101769435231,
-			 0.4466663384605424,
-			 0.4468224863713279,
-			 0.4469786206711214,
-			 0.4471347413551666,
-			 0.4472908484187096,
-			 0.4474469418569942,
-			 0.4476030216652655,
-			 0.4477590878387699,
-			 0.4479151403727518,
-			 0.4480711792624582,
-			 0.4482272045031352,
-			 0.4483832160900316,
-			 0.4485392140183942,
-			 0.4486951982834711,
-			 0.4488511688805114,
-			 0.4490071258047617,
-			 0.4491630690514743,
-			 0.4493189986158959,
-			 0.4494749144932798,
-			 0.4496308166788739,
-			 0.4497867051679302,
-			 0.4499425799557000,
-			 0.4500984410374351,
-			 0.4502542884083875,
-			 0.4504101220638094,
-			 0.4505659419989551,
-			 0.4507217482090781,
-			 0.4508775406894308,
-			 0.4510333194352682,
-			 0.4511890844418450,
-			 0.4513448357044156,
-			 0.4515005732182372,
-			 0.4516562969785656,
-			 0.4518120069806556,
-			 0.4519677032197649,
-			 0.4521233856911499,
-			 0.4522790543900705,
-			 0.4524347093117818,
-			 0.4525903504515446,
-			 0.4527459778046176,
-			 0.4529015913662588,
-			 0.4530571911317286,
-			 0.4532127770962863,
-			 0.4533683492551950,
-			 0.4535239076037141,
-			 0.4536794521371034,
-			 0.4538349828506271,
-			 0.4539904997395466,
-			 0.4541460027991248,
-			 0.4543014920246246,
-			 0.4544569674113096,
-			 0.4546124289544445,
-			 0.4547678766492914,
-			 0.4549233104911174,
-			 0.4550787304751870,
-			 0.4552341365967657,
-			 0.4553895288511196,
-			 0.4555449072335160,
-			 0.4557002717392195,
-			 0.4558556223634997,
-			 0.4560109591016236,
-			 0.4561662819488593,
-			 0.4563215909004747,
-			 0.4564768859517412,
-			 0.4566321670979265,
-			 0.4567874343342991,
-			 0.4569426876561316,
-			 0.4570979270586938,
-			 0.4572531525372570,
-			 0.4574083640870933,
-			 0.4575635617034727,
-			 0.4577187453816705,
-			 0.4578739151169564,
-			 0.4580290709046060,
-			 0.4581842127398923,
-			 0.4583393406180894,
-			 0.4584944545344726,
-			 0.4586495544843145,
-			 0.4588046404628936,
-			 0.4589597124654826,
-			 0.4591147704873600,
-			 0.4592698145238018,
-			 0.4594248445700859,
-			 0.4595798606214881,
-			 0.4597348626732872,
-			 0.4598898507207609,
-			 0.4600448247591893,
-			 0.4601997847838511,
-			 0.4603547307900258,
-			 0.4605096627729943,
-			 0.4606645807280347,
-			 0.4608194846504311,
-			 0.4609743745354618,
-			 0.4611292503784107,
-			 0.4612841121745603,
-			 0.4614389599191916,
-			 0.4615937936075883,
-			 0.4617486132350332,
-			 0.4619034187968127,
-			 0.4620582102882079,
-			 0.4622129877045059,
-			 0.4623677510409919,
-			 0.4625225002929500,
-			 0.4626772354556671,
-			 0.4628319565244289,
-			 0.4629866634945247,
-			 0.4631413563612387,
-			 0.4632960351198618,
-			 0.4634506997656798,
-			 0.4636053502939823,
-			 0.4637599867000581,
-			 0.4639146089791971,
-			 0.4640692171266881,
-			 0.4642238111378232,
-			 0.4643783910078931,
-			 0.4645329567321876,
-			 0.4646875083059990,
-			 0.4648420457246188,
-			 0.4649965689833416,
-			 0.4651510780774590,
-			 0.4653055730022628,
-			 0.4654600537530491,
-			 0.4656145203251113,
-			 0.4657689727137442,
-			 0.4659234109142421,
-			 0.4660778349219028,
-			 0.4662322447320209,
-			 0.4663866403398910,
-			 0.4665410217408125,
-			 0.4666953889300818,
-			 0.4668497419029967,
-			 0.4670040806548543,
-			 0.4671584051809558,
-			 0.4673127154765978,
-			 0.4674670115370804,
-			 0.4676212933577035,
-			 0.4677755609337675,
-			 0.4679298142605731,
-			 0.4680840533334215,
-			 0.4682382781476143,
-			 0.4683924886984534,
-			 0.4685466849812415,
-			 0.4687008669912814,
-			 0.4688550347238765,
-			 0.4690091881743312,
-			 0.4691633273379476,
-			 0.4693174522100333,
-			 0.4694715627858904,
-			 0.4696256590608267,
-			 0.4697797410301474,
-			 0.4699338086891588,
-			 0.4700878620331687,
-			 0.4702419010574819,
-			 0.4703959257574091,
-			 0.4705499361282556,
-			 0.4707039321653321,
-			 0.4708579138639470,
-			 0.4710118812194103,
-			 0.4711658342270306,
-			 0.4713197728821180,
-			 0.4714736971799849,
-			 0.4716276071159418,
-			 0.4717815026853002,
-			 0.4719353838833722,
-			 0.4720892507054712,
-			 0.4722431031469077,
-			 0.4723969412029974,
-			 0.4725507648690535,
-			 0.4727045741403901,
-			 0.4728583690123228,
-			 0.4730121494801650,
-			 0.4731659155392333,
-			 0.4733196671848428,
-			 0.4734734044123123,
-			 0.4736271272169557,
-			 0.4737808355940925,
-			 0.4739345295390405,
-			 0.4740882090471164,
-			 0.4742418741136397,
-			 0.4743955247339287,
-			 0.4745491609033051,
-			 0.4747027826170859,
-			 0.4748563898705947,
-			 0.4750099826591499,
-			 0.4751635609780736,
-			 0.4753171248226875,
-			 0.4754706741883131,
-			 0.4756242090702745,
-			 0.4757777294638940,
-			 0.4759312353644959,
-			 0.4760847267674025,
-			 0.4762382036679391,
-			 0.4763916660614297,
-			 0.4765451139432010,
-			 0.4766985473085789,
-			 0.4768519661528879,
-			 0.4770053704714554,
-			 0.4771587602596076,
-			 0.4773121355126744,
-			 0.4774654962259805,
-			 0.4776188423948575,
-			 0.4777721740146317,
-			 0.4779254910806334,
-			 0.4780787935881921,
-			 0.4782320815326379,
-			 0.4783853549093016,
-			 0.4785386137135132,
-			 0.4786918579406066,
-			 0.4788450875859123,
-			 0.4789983026447608,
-			 0.4791515031124876,
-			 0.4793046889844249,
-			 0.4794578602559064,
-			 0.4796110169222657,
-			 0.4797641589788394,
-			 0.4799172864209603,
-			 0.4800703992439648,
-			 0.4802234974431887,
-			 0.4803765810139683,
-			 0.4805296499516413,
-			 0.4806827042515426,
-			 0.4808357439090121,
-			 0.4809887689193874,
-			 0.4811417792780068,
-			 0.4812947749802089,
-			 0.4814477560213352,
-			 0.4816007223967243,
-			 0.4817536741017149,
-			 0.4819066111316503,
-			 0.4820595334818708,
-			 0.4822124411477182,
-			 0.4823653341245347,
-			 0.4825182124076628,
-			 0.4826710759924466,
-			 0.4828239248742270,
-			 0.4829767590483512,
-			 0.4831295785101604,
-			 0.4832823832550019,
-			 0.4834351732782202,
-			 0.4835879485751618,
-			 0.4837407091411713,
-			 0.4838934549715955,
-			 0.4840461860617828,
-			 0.4841989024070802,
-			 0.4843516040028364,
-			 0.4845042908443982,
-			 0.4846569629271154,
-			 0.4848096202463365,
-			 0.4849622627974128,
-			 0.4851148905756939,
-			 0.4852675035765304,
-			 0.4854201017952742,
-			 0.4855726852272746,
-			 0.4857252538678867,
-			 0.4858778077124600,
-			 0.4860303467563497,
-			 0.4861828709949083,
-			 0.4863353804234907,
-			 0.4864878750374494,
-			 0.4866403548321392,
-			 0.4867928198029177,
-			 0.4869452699451375,
-			 0.4870977052541569,
-			 0.4872501257253317,
-			 0.4874025313540196,
-			 0.4875549221355768,
-			 0.4877072980653617,
-			 0.4878596591387327,
-			 0.4880120053510480,
-			 0.4881643366976691,
-			 0.4883166531739533,
-			 0.4884689547752618,
-			 0.4886212414969550,
-			 0.4887735133343940,
-			 0.4889257702829397,
-			 0.4890780123379554,
-			 0.4892302394948039,
-			 0.4893824517488462,
-			 0.4895346490954466,
-			 0.4896868315299681,
-			 0.4898389990477773,
-			 0.4899911516442357,
-			 0.4901432893147117,
-			 0.4902954120545686,
-			 0.4904475198591732,
-			 0.4905996127238920,
-			 0.4907516906440912,
-			 0.4909037536151407,
-			 0.4910558016324052,
-			 0.4912078346912561,
-			 0.4913598527870600,
-			 0.4915118559151869,
-			 0.4916638440710064,
-			 0.4918158172498888,
-			 0.4919677754472048,
-			 0.4921197186583254,
-			 0.4922716468786221,
-			 0.4924235601034669,
-			 0.4925754583282324,
-			 0.4927273415482913,
-			 0.4928792097590172,
-			 0.4930310629557846,
-			 0.4931829011339654,
-			 0.4933347242889368,
-			 0.4934865324160731,
-			 0.4936383255107500,
-			 0.4937901035683429,
-			 0.4939418665842307,
-			 0.4940936145537888,
-			 0.4942453474723931,
-			 0.4943970653354241,
-			 0.4945487681382593,
-			 0.4947004558762775,
-			 0.4948521285448573,
-			 0.4950037861393809,
-			 0.4951554286552269,
-			 0.4953070560877745,
-			 0.4954586684324072,
-			 0.4956102656845057,
-			 0.4957618478394530,
-			 0.4959134148926302,
-			 0.4960649668394201,
-			 0.4962165036752078,
-			 0.4963680253953764,
-			 0.4965195319953103,
-			 0.4966710234703944,
-			 0.4968224998160148,
-			 0.4969739610275548,
-			 0.4971254071004039,
-			 0.4972768380299456,
-			 0.4974282538115694,
-			 0.4975796544406620,
-			 0.4977310399126124,
-			 0.4978824102228076,
-			 0.4980337653666366,
-			 0.4981851053394910,
-			 0.4983364301367579,
-			 0.4984877397538298,
-			 0.4986390341860967,
-			 0.4987903134289510,
-			 0.4989415774777826,
-			 0.4990928263279840,
-			 0.4992440599749500,
-			 0.4993952784140707,
-			 0.4995464816407430,
-			 0.4996976696503584,
-			 0.4998488424383125,
-			 0.5000000000000001,
-			 0.5001511423308159,
-			 0.5003022694261576,
-			 0.5004533812814207,
-			 0.5006044778920027,
-			 0.5007555592532996,
-			 0.5009066253607100,
-			 0.5010576762096312,
-			 0.5012087117954642,
-			 0.5013597321136054,
-			 0.5015107371594574,
-			 0.5016617269284179,
-			 0.5018127014158884,
-			 0.5019636606172699,
-			 0.5021146045279632,
-			 0.5022655331433724,
-			 0.5024164464588972,
-			 0.5025673444699433,
-			 0.5027182271719119,
-			 0.5028690945602078,
-			 0.5030199466302350,
-			 0.5031707833773976,
-			 0.5033216047971032,
-			 0.5034724108847560,
-			 0.5036232016357607,
-			 0.5037739770455262,
-			 0.5039247371094587,
-			 0.5040754818229660,
-			 0.5042262111814553,
-			 0.5043769251803374,
-			 0.5045276238150190,
-			 0.5046783070809104,
-			 0.5048289749734215,
-			 0.5049796274879625,
-			 0.5051302646199438,
-			 0.5052808863647790,
-			 0.5054314927178772,
-			 0.5055820836746520,
-			 0.5057326592305156,
-			 0.5058832193808817,
-			 0.5060337641211635,
-			 0.5061842934467747,
-			 0.5063348073531322,
-			 0.5064853058356494,
-			 0.5066357888897405,
-			 0.5067862565108238,
-			 0.5069367086943147,
-			 0.5070871454356314,
-			 0.5072375667301895,
-			 0.5073879725734070,
-			 0.5075383629607045,
-			 0.5076887378874980,
-			 0.5078390973492088,
-			 0.5079894413412562,
-			 0.5081397698590612,
-			 0.5082900828980428,
-			 0.5084403804536223,
-			 0.5085906625212229,
-			 0.5087409290962660,
-			 0.5088911801741743,
-			 0.5090414157503715,
-			 0.5091916358202798,
-			 0.5093418403793232,
-			 0.5094920294229276,
-			 0.5096422029465173,
-			 0.5097923609455177,
-			 0.5099425034153549,
-			 0.5100926303514550,
-			 0.5102427417492459,
-			 0.5103928376041527,
-			 0.5105429179116059,
-			 0.5106929826670311,
-			 0.5108430318658600,
-			 0.5109930655035195,
-			 0.5111430835754402,
-			 0.5112930860770523,
-			 0.5114430730037854,
-			 0.5115930443510724,
-			 0.5117430001143443,
-			 0.5118929402890336,
-			 0.5120428648705716,
-			 0.5121927738543920,
-			 0.5123426672359284,
-			 0.5124925450106138,
-			 0.5126424071738843,
-			 0.5127922537211750,
-			 0.5129420846479196,
-			 0.5130918999495548,
-			 0.5132416996215170,
-			 0.5133914836592423,
-			 0.5135412520581694,
-			 0.5136910048137354,
-			 0.5138407419213794,
-			 0.5139904633765385,
-			 0.5141401691746522,
-			 0.5142898593111621,
-			 0.5144395337815056,
-			 0.5145891925811263,
-			 0.5147388357054632,
-			 0.5148884631499584,
-			 0.5150380749100542,
-			 0.5151876709811930,
-			 0.5153372513588179,
-			 0.5154868160383719,
-			 0.5156363650153009,
-			 0.5157858982850473,
-			 0.5159354158430568,
-			 0.5160849176847748,
-			 0.5162344038056473,
-			 0.5163838742011199,
-			 0.5165333288666417,
-			 0.5166827677976578,
-			 0.5168321909896167,
-			 0.5169815984379669,
-			 0.5171309901381570,
-			 0.5172803660856363,
-			 0.5174297262758539,
-			 0.5175790707042623,
-			 0.5177283993663099,
-			 0.5178777122574485,
-			 0.5180270093731300,
-			 0.5181762907088056,
-			 0.5183255562599303,
-			 0.5184748060219557,
-			 0.5186240399903339,
-			 0.5187732581605211,
-			 0.5189224605279713,
-			 0.5190716470881395,
-			 0.5192208178364810,
-			 0.5193699727684528,
-			 0.5195191118795097,
-			 0.5196682351651088,
-			 0.5198173426207091,
-			 0.5199664342417676,
-			 0.5201155100237428,
-			 0.5202645699620942,
-			 0.5204136140522799,
-			 0.5205626422897597,
-			 0.5207116546699954,
-			 0.5208606511884470,
-			 0.5210096318405759,
-			 0.5211585966218432,
-			 0.5213075455277132,
-			 0.5214564785536473,
-			 0.5216053956951073,
-			 0.5217542969475591,
-			 0.5219031823064662,
-			 0.5220520517672940,
-			 0.5222009053255061,
-			 0.5223497429765684,
-			 0.5224985647159490,
-			 0.5226473705391118,
-			 0.5227961604415260,
-			 0.5229449344186585,
-			 0.5230936924659781,
-			 0.5232424345789519,
-			 0.5233911607530490,
-			 0.5235398709837411,
-			 0.5236885652664953,
-			 0.5238372435967844,
-			 0.5239859059700792,
-			 0.5241345523818499,
-			 0.5242831828275691,
-			 0.5244317973027094,
-			 0.5245803958027428,
-			 0.5247289783231445,
-			 0.5248775448593873,
-			 0.5250260954069466,
-			 0.5251746299612957,
-			 0.5253231485179101,
-			 0.5254716510722678,
-			 0.5256201376198422,
-			 0.5257686081561131,
-			 0.5259170626765557,
-			 0.5260655011766483,
-			 0.5262139236518695,
-			 0.5263623300976972,
-			 0.5265107205096130,
-			 0.5266590948830936,
-			 0.5268074532136222,
-			 0.5269557954966775,
-			 0.5271041217277412,
-			 0.5272524319022954,
-			 0.5274007260158212,
-			 0.5275490040638038,
-			 0.5276972660417247,
-			 0.5278455119450662,
-			 0.5279937417693148,
-			 0.5281419555099542,
-			 0.5282901531624697,
-			 0.5284383347223470,
-			 0.5285865001850713,
-			 0.5287346495461316,
-			 0.5288827828010126,
-			 0.5290308999452029,
-			 0.5291790009741903,
-			 0.5293270858834630,
-			 0.5294751546685121,
-			 0.5296232073248256,
-			 0.5297712438478922,
-			 0.5299192642332047,
-			 0.5300672684762533,
-			 0.5302152565725295,
-			 0.5303632285175248,
-			 0.5305111843067337,
-			 0.5306591239356480,
-			 0.5308070473997594,
-			 0.5309549546945642,
-			 0.5311028458155563,
-			 0.5312507207582305,
-			 0.5313985795180832,
-			 0.5315464220906081,
-			 0.5316942484713045,
-			 0.5318420586556664,
-			 0.5319898526391935,
-			 0.5321376304173832,
-			 0.5322853919857335,
-			 0.5324331373397445,
-			 0.5325808664749131,
-			 0.5327285793867416,
-			 0.5328762760707295,
-			 0.5330239565223780,
-			 0.5331716207371889,
-			 0.5333192687106628,
-			 0.5334669004383020,
-			 0.5336145159156118,
-			 0.5337621151380924,
-			 0.5339096981012499,
-			 0.5340572648005879,
-			 0.5342048152316122,
-			 0.5343523493898266,
-			 0.5344998672707368,
-			 0.5346473688698515,
-			 0.5347948541826746,
-			 0.5349423232047156,
-			 0.5350897759314823,
-			 0.5352372123584818,
-			 0.5353846324812233,
-			 0.5355320362952156,
-			 0.5356794237959700,
-			 0.5358267949789960,
-			 0.5359741498398045,
-			 0.5361214883739075,
-			 0.5362688105768154,
-			 0.5364161164440412,
-			 0.5365634059710970,
-			 0.5367106791534975,
-			 0.5368579359867565,
-			 0.5370051764663869,
-			 0.5371524005879043,
-			 0.5372996083468239,
-			 0.5374467997386607,
-			 0.5375939747589333,
-			 0.5377411334031555,
-			 0.5378882756668476,
-			 0.5380354015455251,
-			 0.5381825110347072,
-			 0.5383296041299124,
-			 0.5384766808266594,
-			 0.5386237411204703,
-			 0.5387707850068637,
-			 0.5389178124813592,
-			 0.5390648235394799,
-			 0.5392118181767472,
-			 0.5393587963886833,
-			 0.5395057581708101,
-			 0.5396527035186526,
-			 0.5397996324277344,
-			 0.5399465448935784,
-			 0.5400934409117102,
-			 0.5402403204776549,
-			 0.5403871835869376,
-			 0.5405340302350869,
-			 0.5406808604176274,
-			 0.5408276741300871,
-			 0.5409744713679937,
-			 0.5411212521268757,
-			 0.5412680164022616,
-			 0.5414147641896803,
-			 0.5415614954846636,
-			 0.5417082102827404,
-			 0.5418549085794400,
-			 0.5420015903702960,
-			 0.5421482556508395,
-			 0.5422949044166027,
-			 0.5424415366631192,
-			 0.5425881523859202,
-			 0.5427347515805424,
-			 0.5428813342425172,
-			 0.5430279003673816,
-			 0.5431744499506703,
-			 0.5433209829879191,
-			 0.5434674994746651,
-			 0.5436139994064429,
-			 0.5437604827787921,
-			 0.5439069495872498,
-			 0.5440533998273545,
-			 0.5441998334946455,
-			 0.5443462505846610,
-			 0.5444926510929408,
-			 0.5446390350150266,
-			 0.5447854023464589,
-			 0.5449317530827786,
-			 0.5450780872195274,
-			 0.5452244047522495,
-			 0.5453707056764866,
-			 0.5455169899877805,
-			 0.5456632576816774,
-			 0.5458095087537210,
-			 0.5459557431994563,
-			 0.5461019610144293,
-			 0.5462481621941846,
-			 0.5463943467342693,
-			 0.5465405146302298,
-			 0.5466866658776156,
-			 0.5468328004719718,
-			 0.5469789184088492,
-			 0.5471250196837966,
-			 0.5472711042923621,
-			 0.5474171722300966,
-			 0.5475632234925496,
-			 0.5477092580752738,
-			 0.5478552759738208,
-			 0.5480012771837409,
-			 0.5481472617005876,
-			 0.5482932295199139,
-			 0.5484391806372726,
-			 0.5485851150482193,
-			 0.5487310327483078,
-			 0.5488769337330939,
-			 0.5490228179981318,
-			 0.5491686855389776,
-			 0.5493145363511901,
-			 0.5494603704303235,
-			 0.5496061877719376,
-			 0.5497519883715907,
-			 0.5498977722248398,
-			 0.5500435393272449,
-			 0.5501892896743650,
-			 0.5503350232617623,
-			 0.5504807400849948,
-			 0.5506264401396265,
-			 0.5507721234212177,
-			 0.5509177899253291,
-			 0.5510634396475259,
-			 0.5512090725833703,
-			 0.5513546887284262,
-			 0.5515002880782586,
-			 0.5516458706284302,
-			 0.5517914363745082,
-			 0.5519369853120580,
-			 0.5520825174366458,
-			 0.5522280327438385,
-			 0.5523735312292026,
-			 0.5525190128883083,
-			 0.5526644777167216,
-			 0.5528099257100123,
-			 0.5529553568637496,
-			 0.5531007711735030,
-			 0.5532461686348448,
-			 0.5533915492433445,
-			 0.5535369129945724,
-			 0.5536822598841024,
-			 0.5538275899075062,
-			 0.5539729030603571,
-			 0.5541181993382275,
-			 0.5542634787366938,
-			 0.5544087412513291,
-			 0.5545539868777070,
-			 0.5546992156114051,
-			 0.5548444274479990,
-			 0.5549896223830650,
-			 0.5551348004121812,
-			 0.5552799615309236,
-			 0.5554251057348712,
-			 0.5555702330196018,
-			 0.5557153433806962,
-			 0.5558604368137331,
-			 0.5560055133142929,
-			 0.5561505728779570,
-			 0.5562956155003052,
-			 0.5564406411769190,
-			 0.5565856499033826,
-			 0.5567306416752776,
-			 0.5568756164881876,
-			 0.5570205743376969,
-			 0.5571655152193880,
-			 0.5573104391288481,
-			 0.5574553460616603,
-			 0.5576002360134122,
-			 0.5577451089796897,
-			 0.5578899649560796,
-			 0.5580348039381701,
-			 0.5581796259215469,
-			 0.5583244309018016,
-			 0.5584692188745201,
-			 0.5586139898352941,
-			 0.5587587437797136,
-			 0.5589034807033678,
-			 0.5590482006018483,
-			 0.5591929034707462,
-			 0.5593375893056549,
-			 0.5594822581021663,
-			 0.5596269098558736,
-			 0.5597715445623712,
-			 0.5599161622172516,
-			 0.5600607628161105,
-			 0.5602053463545430,
-			 0.5603499128281439,
-			 0.5604944622325113,
-			 0.5606389945632418,
-			 0.5607835098159312,
-			 0.5609280079861779,
-			 0.5610724890695798,
-			 0.5612169530617379,
-			 0.5613613999582484,
-			 0.5615058297547136,
-			 0.5616502424467339,
-			 0.5617946380299087,
-			 0.5619390164998403,
-			 0.5620833778521298,
-			 0.5622277220823820,
-			 0.5623720491861985,
-			 0.5625163591591813,
-			 0.5626606519969367,
-			 0.5628049276950685,
-			 0.5629491862491819,
-			 0.5630934276548817,
-			 0.5632376519077755,
-			 0.5633818590034702,
-			 0.5635260489375713,
-			 0.5636702217056874,
-			 0.5638143773034267,
-			 0.5639585157263971,
-			 0.5641026369702103,
-			 0.5642467410304746,
-			 0.5643908279027988,
-			 0.5645348975827961,
-			 0.5646789500660768,
-			 0.5648229853482533,
-			 0.5649670034249370,
-			 0.5651110042917431,
-			 0.5652549879442836,
-			 0.5653989543781712,
-			 0.5655429035890225,
-			 0.5656868355724518,
-			 0.5658307503240747,
-			 0.5659746478395080,
-			 0.5661185281143664,
-			 0.5662623911442696,
-			 0.5664062369248325,
-			 0.5665500654516756,
-			 0.5666938767204168,
-			 0.5668376707266755,
-			 0.5669814474660720,
-			 0.5671252069342245,
-			 0.5672689491267562,
-			 0.5674126740392874,
-			 0.5675563816674403,
-			 0.5677000720068371,
-			 0.5678437450531016,
-			 0.5679874008018551,
-			 0.5681310392487243,
-			 0.5682746603893311,
-			 0.5684182642193025,
-			 0.5685618507342636,
-			 0.5687054199298401,
-			 0.5688489718016598,
-			 0.5689925063453474,
-			 0.5691360235565336,
-			 0.5692795234308438,
-			 0.5694230059639086,
-			 0.5695664711513576,
-			 0.5697099189888191,
-			 0.5698533494719240,
-			 0.5699967625963025,
-			 0.5701401583575882,
-			 0.5702835367514102,
-			 0.5704268977734029,
-			 0.5705702414191994,
-			 0.5707135676844318,
-			 0.5708568765647348,
-			 0.5710001680557423,
-			 0.5711434421530907,
-			 0.5712866988524149,
-			 0.5714299381493519,
-			 0.5715731600395370,
-			 0.5717163645186079,
-			 0.5718595515822018,
-			 0.5720027212259583,
-			 0.5721458734455156,
-			 0.5722890082365130,
-			 0.5724321255945910,
-			 0.5725752255153885,
-			 0.5727183079945475,
-			 0.5728613730277083,
-			 0.5730044206105154,
-			 0.5731474507386096,
-			 0.5732904634076327,
-			 0.5734334586132304,
-			 0.5735764363510460,
-			 0.5737193966167244,
-			 0.5738623394059098,
-			 0.5740052647142502,
-			 0.5741481725373904,
-			 0.5742910628709756,
-			 0.5744339357106555,
-			 0.5745767910520770,
-			 0.5747196288908887,
-			 0.5748624492227387,
-			 0.5750052520432785,
-			 0.5751480373481560,
-			 0.5752908051330224,
-			 0.5754335553935288,
-			 0.5755762881253268,
-			 0.5757190033240678,
-			 0.5758617009854058,
-			 0.5760043811049940,
-			 0.5761470436784846,
-			 0.5762896887015327,
-			 0.5764323161697923,
-			 0.5765749260789210,
-			 0.5767175184245731,
-			 0.5768600932024035,
-			 0.5770026504080721,
-			 0.5771451900372334,
-			 0.5772877120855476,
-			 0.5774302165486727,
-			 0.5775727034222673,
-			 0.5777151727019921,
-			 0.5778576243835051,
-			 0.5780000584624689,
-			 0.5781424749345441,
-			 0.5782848737953925,
-			 0.5784272550406763,
-			 0.5785696186660590,
-			 0.5787119646672026,
-			 0.5788542930397711,
-			 0.5789966037794302,
-			 0.5791388968818441,
-			 0.5792811723426785,
-			 0.5794234301575992,
-			 0.5795656703222738,
-			 0.5797078928323670,
-			 0.5798500976835488,
-			 0.5799922848714865,
-			 0.5801344543918490,
-			 0.5802766062403061,
-			 0.5804187404125256,
-			 0.5805608569041807,
-			 0.5807029557109393,
-			 0.5808450368284759,
-			 0.5809871002524594,
-			 0.5811291459785645,
-			 0.5812711740024642,
-			 0.5814131843198308,
-			 0.5815551769263391,
-			 0.5816971518176628,
-			 0.5818391089894789,
-			 0.5819810484374621,
-			 0.5821229701572896,
-			 0.5822648741446367,
-			 0.5824067603951815,
-			 0.5825486289046011,
-			 0.5826904796685755,
-			 0.5828323126827829,
-			 0.5829741279429028,
-			 0.5831159254446160,
-			 0.5832577051836016,
-			 0.5833994671555416,
-			 0.5835412113561169,
-			 0.5836829377810111,
-			 0.5838246464259070,
-			 0.5839663372864866,
-			 0.5841080103584343,
-			 0.5842496656374337,
-			 0.5843913031191722,
-			 0.5845329227993321,
-			 0.5846745246736018,
-			 0.5848161087376677,
-			 0.5849576749872154,
-			 0.5850992234179335,
-			 0.5852407540255101,
-			 0.5853822668056339,
-			 0.5855237617539933,
-			 0.5856652388662806,
-			 0.5858066981381838,
-			 0.5859481395653945,
-			 0.5860895631436042,
-			 0.5862309688685049,
-			 0.5863723567357885,
-			 0.5865137267411493,
-			 0.5866550788802812,
-			 0.5867964131488766,
-			 0.5869377295426313,
-			 0.5870790280572395,
-			 0.5872203086883995,
-			 0.5873615714318059,
-			 0.5875028162831543,
-			 0.5876440432381442,
-			 0.5877852522924729,
-			 0.5879264434418391,
-			 0.5880676166819409,
-			 0.5882087720084802,
-			 0.5883499094171557,
-			 0.5884910289036667,
-			 0.5886321304637165,
-			 0.5887732140930063,
-			 0.5889142797872384,
-			 0.5890553275421151,
-			 0.5891963573533419,
-			 0.5893373692166212,
-			 0.5894783631276562,
-			 0.5896193390821542,
-			 0.5897602970758202,
-			 0.5899012371043602,
-			 0.5900421591634808,
-			 0.5901830632488904,
-			 0.5903239493562942,
-			 0.5904648174814030,
-			 0.5906056676199251,
-			 0.5907464997675695,
-			 0.5908873139200475,
-			 0.5910281100730670,
-			 0.5911688882223423,
-			 0.5913096483635820,
-			 0.5914503904925006,
-			 0.5915911146048100,
-			 0.5917318206962235,
-			 0.5918725087624559,
-			 0.5920131787992191,
-			 0.5921538308022312,
-			 0.5922944647672046,
-			 0.5924350806898576,
-			 0.5925756785659062,
-			 0.5927162583910680,
-			 0.5928568201610595,
-			 0.5929973638715987,
-			 0.5931378895184068,
-			 0.5932783970972002,
-			 0.5934188866037009,
-			 0.5935593580336286,
-			 0.5936998113827050,
-			 0.5938402466466504,
-			 0.5939806638211873,
-			 0.5941210629020379,
-			 0.5942614438849269,
-			 0.5944018067655776,
-			 0.5945421515397133,
-			 0.5946824782030594,
-			 0.5948227867513407,
-			 0.5949630771802852,
-			 0.5951033494856165,
-			 0.5952436036630639,
-			 0.5953838397083550,
-			 0.5955240576172165,
-			 0.5956642573853780,
-			 0.5958044390085677,
-			 0.5959446024825179,
-			 0.5960847478029561,
-			 0.5962248749656158,
-			 0.5963649839662266,
-			 0.5965050748005213,
-			 0.5966451474642323,
-			 0.5967852019530919,
-			 0.5969252382628364,
-			 0.5970652563891968,
-			 0.5972052563279109,
-			 0.5973452380747120,
-			 0.5974852016253365,
-			 0.5976251469755210,
-			 0.5977650741210019,
-			 0.5979049830575188,
-			 0.5980448737808077,
-			 0.5981847462866080,
-			 0.5983246005706589,
-			 0.5984644366287003,
-			 0.5986042544564718,
-			 0.5987440540497164,
-			 0.5988838354041741,
-			 0.5990235985155857,
-			 0.5991633433796957,
-			 0.5993030699922465,
-			 0.5994427783489820,
-			 0.5995824684456454,
-			 0.5997221402779840,
-			 0.5998617938417414,
-			 0.6000014291326623,
-			 0.6001410461464953,
-			 0.6002806448789866,
-			 0.6004202253258838,
-			 0.6005597874829344,
-			 0.6006993313458892,
-			 0.6008388569104952,
-			 0.6009783641725031,
-			 0.6011178531276631,
-			 0.6012573237717262,
-			 0.6013967761004447,
-			 0.6015362101095691,
-			 0.6016756257948520,
-			 0.6018150231520479,
-			 0.6019544021769100,
-			 0.6020937628651925,
-			 0.6022331052126501,
-			 0.6023724292150390,
-			 0.6025117348681130,
-			 0.6026510221676316,
-			 0.6027902911093487,
-			 0.6029295416890244,
-			 0.6030687739024159,
-			 0.6032079877452827,
-			 0.6033471832133829,
-			 0.6034863603024762,
-			 0.6036255190083252,
-			 0.6037646593266879,
-			 0.6039037812533281,
-			 0.6040428847840073,
-			 0.6041819699144887,
-			 0.6043210366405342,
-			 0.6044600849579075,
-			 0.6045991148623744,
-			 0.6047381263496990,
-			 0.6048771194156478,
-			 0.6050160940559851,
-			 0.6051550502664783,
-			 0.6052939880428938,
-			 0.6054329073810009,
-			 0.6055718082765669,
-			 0.6057106907253609,
-			 0.6058495547231527,
-			 0.6059884002657111,
-			 0.6061272273488073,
-			 0.6062660359682116,
-			 0.6064048261196979,
-			 0.6065435977990354,
-			 0.6066823510019997,
-			 0.6068210857243622,
-			 0.6069598019618975,
-			 0.6070984997103799,
-			 0.6072371789655837,
-			 0.6073758397232867,
-			 0.6075144819792623,
-			 0.6076531057292899,
-			 0.6077917109691447,
-			 0.6079302976946054,
-			 0.6080688659014502,
-			 0.6082074155854574,
-			 0.6083459467424088,
-			 0.6084844593680822,
-			 0.6086229534582590,
-			 0.6087614290087205,
-			 0.6088998860152486,
-			 0.6090383244736247,
-			 0.6091767443796333,
-			 0.6093151457290579,
-			 0.6094535285176810,
-			 0.6095918927412880,
-			 0.6097302383956634,
-			 0.6098685654765952,
-			 0.6100068739798666,
-			 0.6101451639012675,
-			 0.6102834352365831,
-			 0.6104216879816023,
-			 0.6105599221321136,
-			 0.6106981376839062,
-			 0.6108363346327697,
-			 0.6109745129744937,
-			 0.6111126727048711,
-			 0.6112508138196922,
-			 0.6113889363147472,
-			 0.6115270401858309,
-			 0.6116651254287359,
-			 0.6118031920392563,
-			 0.6119412400131851,
-			 0.6120792693463171,
-			 0.6122172800344490,
-			 0.6123552720733763,
-			 0.6124932454588952,
-			 0.6126312001868029,
-			 0.6127691362528979,
-			 0.6129070536529762,
-			 0.6130449523828387,
-			 0.6131828324382841,
-			 0.6133206938151123,
-			 0.6134585365091232,
-			 0.6135963605161199,
-			 0.6137341658319025,
-			 0.6138719524522720,
-			 0.6140097203730333,
-			 0.6141474695899889,
-			 0.6142852000989428,
-			 0.6144229118956989,
-			 0.6145606049760640,
-			 0.6146982793358428,
-			 0.6148359349708398,
-			 0.6149735718768645,
-			 0.6151111900497217,
-			 0.6152487894852220,
-			 0.6153863701791717,
-			 0.6155239321273807,
-			 0.6156614753256585,
-			 0.6157989997698147,
-			 0.6159365054556614,
-			 0.6160739923790091,
-			 0.6162114605356707,
-			 0.6163489099214571,
-			 0.6164863405321820,
-			 0.6166237523636585,
-			 0.6167611454117020,
-			 0.6168985196721268,
-			 0.6170358751407488,
-			 0.6171732118133825,
-			 0.6173105296858444,
-			 0.6174478287539537,
-			 0.6175851090135251,
-			 0.6177223704603791,
-			 0.6178596130903338,
-			 0.6179968368992089,
-			 0.6181340418828233,
-			 0.6182712280369973,
-			 0.6184083953575542,
-			 0.6185455438403127,
-			 0.6186826734810980,
-			 0.6188197842757305,
-			 0.6189568762200346,
-			 0.6190939493098340,
-			 0.6192310035409533,
-			 0.6193680389092177,
-			 0.6195050554104520,
-			 0.6196420530404845,
-			 0.6197790317951402,
-			 0.6199159916702468,
-			 0.6200529326616325,
-			 0.6201898547651259,
-			 0.6203267579765552,
-			 0.6204636422917524,
-			 0.6206005077065455,
-			 0.6207373542167662,
-			 0.6208741818182457,
-			 0.6210109905068155,
-			 0.6211477802783103,
-			 0.6212845511285602,
-			 0.6214213030534018,
-			 0.6215580360486674,
-			 0.6216947501101926,
-			 0.6218314452338127,
-			 0.6219681214153632,
-			 0.6221047786506827,
-			 0.6222414169356070,
-			 0.6223780362659723,
-			 0.6225146366376193,
-			 0.6226512180463861,
-			 0.6227877804881122,
-			 0.6229243239586377,
-			 0.6230608484538033,
-			 0.6231973539694501,
-			 0.6233338405014198,
-			 0.6234703080455550,
-			 0.6236067565976987,
-			 0.6237431861536943,
-			 0.6238795967093866,
-			 0.6240159882606190,
-			 0.6241523608032367,
-			 0.6242887143330869,
-			 0.6244250488460155,
-			 0.6245613643378694,
-			 0.6246976608044955,
-			 0.6248339382417442,
-			 0.6249701966454626,
-			 0.6251064360114988,
-			 0.6252426563357047,
-			 0.6253788576139304,
-			 0.6255150398420273,
-			 0.6256512030158459,
-			 0.6257873471312383,
-			 0.6259234721840593,
-			 0.6260595781701598,
-			 0.6261956650853957,
-			 0.6263317329256208,
-			 0.6264677816866910,
-			 0.6266038113644607,
-			 0.6267398219547862,
-			 0.6268758134535255,
-			 0.6270117858565357,
-			 0.6271477391596747,
-			 0.6272836733588019,
-			 0.6274195884497749,
-			 0.6275554844284537,
-			 0.6276913612907007,
-			 0.6278272190323740,
-			 0.6279630576493374,
-			 0.6280988771374522,
-			 0.6282346774925817,
-			 0.6283704587105879,
-			 0.6285062207873349,
-			 0.6286419637186889,
-			 0.6287776875005121,
-			 0.6289133921286733,
-			 0.6290490775990362,
-			 0.6291847439074685,
-			 0.6293203910498375,
-			 0.6294560190220105,
-			 0.6295916278198581,
-			 0.6297272174392468,
-			 0.6298627878760487,
-			 0.6299983391261323,
-			 0.6301338711853691,
-			 0.6302693840496306,
-			 0.6304048777147880,
-			 0.6305403521767156,
-			 0.6306758074312863,
-			 0.6308112434743726,
-			 0.6309466603018496,
-			 0.6310820579095924,
-			 0.6312174362934756,
-			 0.6313527954493776,
-			 0.6314881353731724,
-			 0.6316234560607399,
-			 0.6317587575079561,
-			 0.6318940397107000,
-			 0.6320293026648508,
-			 0.6321645463662874,
-			 0.6322997708108921,
-			 0.6324349759945445,
-			 0.6325701619131243,
-			 0.6327053285625159,
-			 0.6328404759386012,
-			 0.6329756040372631,
-			 0.6331107128543848,
-			 0.6332458023858528,
-			 0.6333808726275507,
-			 0.6335159235753625,
-			 0.6336509552251763,
-			 0.6337859675728784,
-			 0.6339209606143559,
-			 0.6340559343454975,
-			 0.6341908887621893,
-			 0.6343258238603228,
-			 0.6344607396357866,
-			 0.6345956360844712,
-			 0.6347305132022674,
-			 0.6348653709850657,
-			 0.6350002094287603,
-			 0.6351350285292419,
-			 0.6352698282824040,
-			 0.6354046086841406,
-			 0.6355393697303461,
-			 0.6356741114169152,
-			 0.6358088337397444,
-			 0.6359435366947276,
-			 0.6360782202777643,
-			 0.6362128844847490,
-			 0.6363475293115818,
-			 0.6364821547541603,
-			 0.6366167608083844,
-			 0.6367513474701524,
-			 0.6368859147353645,
-			 0.6370204625999235,
-			 0.6371549910597284,
-			 0.6372895001106830,
-			 0.6374239897486900,
-			 0.6375584599696512,
-			 0.6376929107694712,
-			 0.6378273421440537,
-			 0.6379617540893050,
-			 0.6380961466011300,
-			 0.6382305196754349,
-			 0.6383648733081271,
-			 0.6384992074951126,
-			 0.6386335222322993,
-			 0.6387678175155972,
-			 0.6389020933409146,
-			 0.6390363497041622,
-			 0.6391705866012487,
-			 0.6393048040280851,
-			 0.6394390019805849,
-			 0.6395731804546575,
-			 0.6397073394462183,
-			 0.6398414789511778,
-			 0.6399755989654528,
-			 0.6401096994849556,
-			 0.6402437805056018,
-			 0.6403778420233074,
-			 0.6405118840339876,
-			 0.6406459065335609,
-			 0.6407799095179446,
-			 0.6409138929830553,
-			 0.6410478569248126,
-			 0.6411818013391354,
-			 0.6413157262219437,
-			 0.6414496315691571,
-			 0.6415835173766982,
-			 0.6417173836404885,
-			 0.6418512303564486,
-			 0.6419850575205024,
-			 0.6421188651285729,
-			 0.6422526531765836,
-			 0.6423864216604612,
-			 0.6425201705761286,
-			 0.6426538999195126,
-			 0.6427876096865393,
-			 0.6429212998731350,
-			 0.6430549704752293,
-			 0.6431886214887478,
-			 0.6433222529096219,
-			 0.6434558647337788,
-			 0.6435894569571493,
-			 0.6437230295756639,
-			 0.6438565825852536,
-			 0.6439901159818503,
-			 0.6441236297613870,
-			 0.6442571239197946,
-			 0.6443905984530086,
-			 0.6445240533569626,
-			 0.6446574886275912,
-			 0.6447909042608297,
-			 0.6449243002526135,
-			 0.6450576765988810,
-			 0.6451910332955674,
-			 0.6453243703386110,
-			 0.6454576877239503,
-			 0.6455909854475240,
-			 0.6457242635052726,
-			 0.6458575218931345,
-			 0.6459907606070506,
-			 0.6461239796429635,
-			 0.6462571789968147,
-			 0.6463903586645463,
-			 0.6465235186421011,
-			 0.6466566589254246,
-			 0.6467897795104599,
-			 0.6469228803931505,
-			 0.6470559615694440,
-			 0.6471890230352857,
-			 0.6473220647866226,
-			 0.6474550868194023,
-			 0.6475880891295711,
-			 0.6477210717130799,
-			 0.6478540345658752,
-			 0.6479869776839089,
-			 0.6481199010631304,
-			 0.6482528046994909,
-			 0.6483856885889424,
-			 0.6485185527274357,
-			 0.6486513971109236,
-			 0.6487842217353607,
-			 0.6489170265967003,
-			 0.6490498116908975,
-			 0.6491825770139062,
-			 0.6493153225616822,
-			 0.6494480483301839,
-			 0.6495807543153652,
-			 0.6497134405131860,
-			 0.6498461069196036,
-			 0.6499787535305775,
-			 0.6501113803420658,
-			 0.6502439873500283,
-			 0.6503765745504276,
-			 0.6505091419392222,
-			 0.6506416895123759,
-			 0.6507742172658511,
-			 0.6509067251956093,
-			 0.6510392132976148,
-			 0.6511716815678312,
-			 0.6513041300022253,
-			 0.6514365585967598,
-			 0.6515689673474026,
-			 0.6517013562501203,
-			 0.6518337253008788,
-			 0.6519660744956466,
-			 0.6520984038303922,
-			 0.6522307133010838,
-			 0.6523630029036931,
-			 0.6524952726341883,
-			 0.6526275224885409,
-			 0.6527597524627224,
-			 0.6528919625527041,
-			 0.6530241527544607,
-			 0.6531563230639628,
-			 0.6532884734771869,
-			 0.6534206039901054,
-			 0.6535527145986941,
-			 0.6536848052989287,
-			 0.6538168760867848,
-			 0.6539489269582414,
-			 0.6540809579092746,
-			 0.6542129689358609,
-			 0.6543449600339815,
-			 0.6544769311996147,
-			 0.6546088824287406,
-			 0.6547408137173389,
-			 0.6548727250613929,
-			 0.6550046164568830,
-			 0.6551364878997903,
-			 0.6552683393860995,
-			 0.6554001709117937,
-			 0.6555319824728572,
-			 0.6556637740652751,
-			 0.6557955456850311,
-			 0.6559272973281131,
-			 0.6560590289905071,
-			 0.6561907406682002,
-			 0.6563224323571804,
-			 0.6564541040534354,
-			 0.6565857557529562,
-			 0.6567173874517311,
-			 0.6568489991457492,
-			 0.6569805908310034,
-			 0.6571121625034843,
-			 0.6572437141591840,
-			 0.6573752457940961,
-			 0.6575067574042118,
-			 0.6576382489855277,
-			 0.6577697205340356,
-			 0.6579011720457327,
-			 0.6580326035166142,
-			 0.6581640149426763,
-			 0.6582954063199167,
-			 0.6584267776443310,
-			 0.6585581289119201,
-			 0.6586894601186801,
-			 0.6588207712606124,
-			 0.6589520623337172,
-			 0.6590833333339936,
-			 0.6592145842574436,
-			 0.6593458151000684,
-			 0.6594770258578719,
-			 0.6596082165268564,
-			 0.6597393871030256,
-			 0.6598705375823847,
-			 0.6600016679609370,
-			 0.6601327782346881,
-			 0.6602638683996463,
-			 0.6603949384518156,
-			 0.6605259883872054,
-			 0.6606570182018238,
-			 0.6607880278916779,
-			 0.6609190174527776,
-			 0.6610499868811321,
-			 0.6611809361727539,
-			 0.6613118653236513,
-			 0.6614427743298380,
-			 0.6615736631873264,
-			 0.6617045318921279,
-			 0.6618353804402566,
-			 0.6619662088277263,
-			 0.6620970170505527,
-			 0.6622278051047514,
-			 0.6623585729863369,
-			 0.6624893206913266,
-			 0.6626200482157375,
-			 0.6627507555555876,
-			 0.6628814427068945,
-			 0.6630121096656787,
-			 0.6631427564279597,
-			 0.6632733829897567,
-			 0.6634039893470910,
-			 0.6635345754959843,
-			 0.6636651414324578,
-			 0.6637956871525365,
-			 0.6639262126522415,
-			 0.6640567179275977,
-			 0.6641872029746295,
-			 0.6643176677893622,
-			 0.6644481123678215,
-			 0.6645785367060333,
-			 0.6647089408000265,
-			 0.6648393246458275,
-			 0.6649696882394633,
-			 0.6651000315769647,
-			 0.6652303546543608,
-			 0.6653606574676812,
-			 0.6654909400129578,
-			 0.6656212022862199,
-			 0.6657514442835014,
-			 0.6658816660008341,
-			 0.6660118674342514,
-			 0.6661420485797871,
-			 0.6662722094334750,
-			 0.6664023499913522,
-			 0.6665324702494523,
-			 0.6666625702038123,
-			 0.6667926498504692,
-			 0.6669227091854604,
-			 0.6670527482048243,
-			 0.6671827669046001,
-			 0.6673127652808253,
-			 0.6674427433295420,
-			 0.6675727010467901,
-			 0.6677026384286110,
-			 0.6678325554710464,
-			 0.6679624521701387,
-			 0.6680923285219320,
-			 0.6682221845224680,
-			 0.6683520201677934,
-			 0.6684818354539508,
-			 0.6686116303769878,
-			 0.6687414049329504,
-			 0.6688711591178844,
-			 0.6690008929278377,
-			 0.6691306063588578,
-			 0.6692602994069948,
-			 0.6693899720682973,
-			 0.6695196243388152,
-			 0.6696492562145997,
-			 0.6697788676917008,
-			 0.6699084587661703,
-			 0.6700380294340619,
-			 0.6701675796914278,
-			 0.6702971095343220,
-			 0.6704266189587993,
-			 0.6705561079609127,
-			 0.6706855765367202,
-			 0.6708150246822755,
-			 0.6709444523936374,
-			 0.6710738596668625,
-			 0.6712032464980089,
-			 0.6713326128831358,
-			 0.6714619588183007,
-			 0.6715912842995660,
-			 0.6717205893229896,
-			 0.6718498738846355,
-			 0.6719791379805631,
-			 0.6721083816068355,
-			 0.6722376047595161,
-			 0.6723668074346681,
-			 0.6724959896283561,
-			 0.6726251513366441,
-			 0.6727542925555990,
-			 0.6728834132812870,
-			 0.6730125135097733,
-			 0.6731415932371263,
-			 0.6732706524594138,
-			 0.6733996911727037,
-			 0.6735287093730667,
-			 0.6736577070565728,
-			 0.6737866842192909,
-			 0.6739156408572929,
-			 0.6740445769666500,
-			 0.6741734925434365,
-			 0.6743023875837227,
-			 0.6744312620835843,
-			 0.6745601160390955,
-			 0.6746889494463298,
-			 0.6748177623013636,
-			 0.6749465546002722,
-			 0.6750753263391344,
-			 0.6752040775140262,
-			 0.6753328081210244,
-			 0.6754615181562095,
-			 0.6755902076156601,
-			 0.6757188764954563,
-			 0.6758475247916784,
-			 0.6759761525004077,
-			 0.6761047596177265,
-			 0.6762333461397153,
-			 0.6763619120624591,
-			 0.6764904573820409,
-			 0.6766189820945452,
-			 0.6767474861960565,
-			 0.6768759696826612,
-			 0.6770044325504435,
-			 0.6771328747954922,
-			 0.6772612964138940,
-			 0.6773896974017370,
-			 0.6775180777551093,
-			 0.6776464374701020,
-			 0.6777747765428038,
-			 0.6779030949693041,
-			 0.6780313927456959,
-			 0.6781596698680703,
-			 0.6782879263325200,
-			 0.6784161621351386,
-			 0.6785443772720178,
-			 0.6786725717392547,
-			 0.6788007455329415,
-			 0.6789288986491757,
-			 0.6790570310840532,
-			 0.6791851428336707,
-			 0.6793132338941263,
-			 0.6794413042615162,
-			 0.6795693539319417,
-			 0.6796973829014996,
-			 0.6798253911662920,
-			 0.6799533787224188,
-			 0.6800813455659819,
-			 0.6802092916930820,
-			 0.6803372170998221,
-			 0.6804651217823048,
-			 0.6805930057366354,
-			 0.6807208689589174,
-			 0.6808487114452559,
-			 0.6809765331917575,
-			 0.6811043341945264,
-			 0.6812321144496721,
-			 0.6813598739532997,
-			 0.6814876127015193,
-			 0.6816153306904397,
-			 0.6817430279161693,
-			 0.6818707043748187,
-			 0.6819983600624979,
-			 0.6821259949753206,
-			 0.6822536091093959,
-			 0.6823812024608384,
-			 0.6825087750257617,
-			 0.6826363268002781,
-			 0.6827638577805029,
-			 0.6828913679625506,
-			 0.6830188573425383,
-			 0.6831463259165820,
-			 0.6832737736807992,
-			 0.6834012006313064,
-			 0.6835286067642227,
-			 0.6836559920756669,
-			 0.6837833565617587,
-			 0.6839107002186178,
-			 0.6840380230423664,
-			 0.6841653250291257,
-			 0.6842926061750170,
-			 0.6844198664761635,
-			 0.6845471059286881,
-			 0.6846743245287166,
-			 0.6848015222723726,
-			 0.6849286991557800,
-			 0.6850558551750668,
-			 0.6851829903263591,
-			 0.6853101046057839,
-			 0.6854371980094685,
-			 0.6855642705335434,
-			 0.6856913221741364,
-			 0.6858183529273761,
-			 0.6859453627893948,
-			 0.6860723517563229,
-			 0.6861993198242919,
-			 0.6863262669894339,
-			 0.6864531932478836,
-			 0.6865800985957725,
-			 0.6867069830292357,
-			 0.6868338465444080,
-			 0.6869606891374250,
-			 0.6870875108044222,
-			 0.6872143115415381,
-			 0.6873410913449085,
-			 0.6874678502106719,
-			 0.6875945881349672,
-			 0.6877213051139335,
-			 0.6878480011437109,
-			 0.6879746762204407,
-			 0.6881013303402623,
-			 0.6882279634993199,
-			 0.6883545756937537,
-			 0.6884811669197087,
-			 0.6886077371733281,
-			 0.6887342864507564,
-			 0.6888608147481391,
-			 0.6889873220616203,
-			 0.6891138083873488,
-			 0.6892402737214690,
-			 0.6893667180601306,
-			 0.6894931413994810,
-			 0.6896195437356700,
-			 0.6897459250648459,
-			 0.6898722853831587,
-			 0.6899986246867608,
-			 0.6901249429718027,
-			 0.6902512402344367,
-			 0.6903775164708157,
-			 0.6905037716770935,
-			 0.6906300058494225,
-			 0.6907562189839590,
-			 0.6908824110768580,
-			 0.6910085821242752,
-			 0.6911347321223680,
-			 0.6912608610672916,
-			 0.6913869689552066,
-			 0.6915130557822690,
-			 0.6916391215446402,
-			 0.6917651662384779,
-			 0.6918911898599444,
-			 0.6920171924052005,
-			 0.6921431738704069,
-			 0.6922691342517266,
-			 0.6923950735453220,
-			 0.6925209917473587,
-			 0.6926468888539983,
-			 0.6927727648614084,
-			 0.6928986197657527,
-			 0.6930244535631982,
-			 0.6931502662499116,
-			 0.6932760578220598,
-			 0.6934018282758124,
-			 0.6935275776073374,
-			 0.6936533058128050,
-			 0.6937790128883840,
-			 0.6939046988302457,
-			 0.6940303636345611,
-			 0.6941560072975032,
-			 0.6942816298152448,
-			 0.6944072311839579,
-			 0.6945328113998173,
-			 0.6946583704589966,
-			 0.6947839083576733,
-			 0.6949094250920207,
-			 0.6950349206582178,
-			 0.6951603950524399,
-			 0.6952858482708654,
-			 0.6954112803096728,
-			 0.6955366911650414,
-			 0.6956620808331507,
-			 0.6957874493101807,
-			 0.6959127965923142,
-			 0.6960381226757317,
-			 0.6961634275566144,
-			 0.6962887112311470,
-			 0.6964139736955126,
-			 0.6965392149458955,
-			 0.6966644349784800,
-			 0.6967896337894535,
-			 0.6969148113750003,
-			 0.6970399677313082,
-			 0.6971651028545643,
-			 0.6972902167409571,
-			 0.6974153093866760,
-			 0.6975403807879083,
-			 0.6976654309408463,
-			 0.6977904598416800,
-			 0.6979154674866007,
-			 0.6980404538718000,
-			 0.6981654189934724,
-			 0.6982903628478101,
-			 0.6984152854310056,
-			 0.6985401867392557,
-			 0.6986650667687548,
-			 0.6987899255156991,
-			 0.6989147629762849,
-			 0.6990395791467097,
-			 0.6991643740231718,
-			 0.6992891476018679,
-			 0.6994138998789992,
-			 0.6995386308507647,
-			 0.6996633405133651,
-			 0.6997880288630013,
-			 0.6999126958958759,
-			 0.7000373416081900,
-			 0.7001619659961464,
-			 0.7002865690559505,
-			 0.7004111507838060,
-			 0.7005357111759183,
-			 0.7006602502284920,
-			 0.7007847679377339,
-			 0.7009092642998505,
-			 0.7010337393110506,
-			 0.7011581929675419,
-			 0.7012826252655333,
-			 0.7014070362012350,
-			 0.7015314257708553,
-			 0.7016557939706076,
-			 0.7017801407967010,
-			 0.7019044662453495,
-			 0.7020287703127653,
-			 0.7021530529951625,
-			 0.7022773142887541,
-			 0.7024015541897547,
-			 0.7025257726943817,
-			 0.7026499697988486,
-			 0.7027741454993743,
-			 0.7028982997921752,
-			 0.7030224326734702,
-			 0.7031465441394766,
-			 0.7032706341864146,
-			 0.7033947028105033,
-			 0.7035187500079648,
-			 0.7036427757750203,
-			 0.7037667801078906,
-			 0.7038907630027988,
-			 0.7040147244559684,
-			 0.7041386644636231,
-			 0.7042625830219869,
-			 0.7043864801272862,
-			 0.7045103557757471,
-			 0.7046342099635947,
-			 0.7047580426870568,
-			 0.7048818539423608,
-			 0.7050056437257368,
-			 0.7051294120334117,
-			 0.7052531588616177,
-			 0.7053768842065833,
-			 0.7055005880645404,
-			 0.7056242704317206,
-			 0.7057479313043558,
-			 0.7058715706786809,
-			 0.7059951885509271,
-			 0.7061187849173315,
-			 0.7062423597741270,
-			 0.7063659131175499,
-			 0.7064894449438368,
-			 0.7066129552492246,
-			 0.7067364440299508,
-			 0.7068599112822540,
-			 0.7069833570023729,
-			 0.7071067811865474,
-			 0.7072301838310175,
-			 0.7073535649320237,
-			 0.7074769244858093,
-			 0.7076002624886156,
-			 0.7077235789366840,
-			 0.7078468738262601,
-			 0.7079701471535874,
-			 0.7080933989149107,
-			 0.7082166291064752,
-			 0.7083398377245286,
-			 0.7084630247653168,
-			 0.7085861902250860,
-			 0.7087093341000860,
-			 0.7088324563865652,
-			 0.7089555570807732,
-			 0.7090786361789593,
-			 0.7092016936773763,
-			 0.7093247295722742,
-			 0.7094477438599042,
-			 0.7095707365365206,
-			 0.7096937075983765,
-			 0.7098166570417264,
-			 0.7099395848628238,
-			 0.7100624910579243,
-			 0.7101853756232850,
-			 0.7103082385551621,
-			 0.7104310798498131,
-			 0.7105538995034958,
-			 0.7106766975124696,
-			 0.7107994738729921,
-			 0.7109222285813257,
-			 0.7110449616337285,
-			 0.7111676730264640,
-			 0.7112903627557934,
-			 0.7114130308179798,
-			 0.7115356772092856,
-			 0.7116583019259746,
-			 0.7117809049643132,
-			 0.7119034863205644,
-			 0.7120260459909961,
-			 0.7121485839718740,
-			 0.7122711002594662,
-			 0.7123935948500394,
-			 0.7125160677398621,
-			 0.7126385189252056,
-			 0.7127609484023371,
-			 0.7128833561675298,
-			 0.7130057422170532,
-			 0.7131281065471795,
-			 0.7132504491541817,
-			 0.7133727700343321,
-			 0.7134950691839058,
-			 0.7136173465991771,
-			 0.7137396022764214,
-			 0.7138618362119136,
-			 0.7139840484019307,
-			 0.7141062388427495,
-			 0.7142284075306495,
-			 0.7143505544619070,
-			 0.7144726796328034,
-			 0.7145947830396169,
-			 0.7147168646786284,
-			 0.7148389245461193,
-			 0.7149609626383708,
-			 0.7150829789516673,
-			 0.7152049734822893,
-			 0.7153269462265233,
-			 0.7154488971806519,
-			 0.7155708263409607,
-			 0.7156927337037358,
-			 0.7158146192652629,
-			 0.7159364830218311,
-			 0.7160583249697269,
-			 0.7161801451052376,
-			 0.7163019434246541,
-			 0.7164237199242658,
-			 0.7165454746003630,
-			 0.7166672074492363,
-			 0.7167889184671793,
-			 0.7169106076504826,
-			 0.7170322749954401,
-			 0.7171539204983455,
-			 0.7172755441554932,
-			 0.7173971459631778,
-			 0.7175187259176969,
-			 0.7176402840153453,
-			 0.7177618202524204,
-			 0.7178833346252204,
-			 0.7180048271300433,
-			 0.7181262977631886,
-			 0.7182477465209554,
-			 0.7183691733996459,
-			 0.7184905783955600,
-			 0.7186119615049983,
-			 0.7187333227242652,
-			 0.7188546620496631,
-			 0.7189759794774965,
-			 0.7190972750040684,
-			 0.7192185486256842,
-			 0.7193398003386509,
-			 0.7194610301392741,
-			 0.7195822380238612,
-			 0.7197034239887199,
-			 0.7198245880301591,
-			 0.7199457301444870,
-			 0.7200668503280133,
-			 0.7201879485770497,
-			 0.7203090248879066,
-			 0.7204300792568958,
-			 0.7205511116803307,
-			 0.7206721221545228,
-			 0.7207931106757862,
-			 0.7209140772404365,
-			 0.7210350218447883,
-			 0.7211559444851573,
-			 0.7212768451578601,
-			 0.7213977238592137,
-			 0.7215185805855368,
-			 0.7216394153331458,
-			 0.7217602280983624,
-			 0.7218810188775040,
-			 0.7220017876668935,
-			 0.7221225344628504,
-			 0.7222432592616970,
-			 0.7223639620597557,
-			 0.7224846428533493,
-			 0.7226053016388029,
-			 0.7227259384124403,
-			 0.7228465531705871,
-			 0.7229671459095683,
-			 0.7230877166257109,
-			 0.7232082653153414,
-			 0.7233287919747892,
-			 0.7234492966003818,
-			 0.7235697791884494,
-			 0.7236902397353205,
-			 0.7238106782373263,
-			 0.7239310946907980,
-			 0.7240514890920670,
-			 0.7241718614374669,
-			 0.7242922117233306,
-			 0.7244125399459924,
-			 0.7245328461017858,
-			 0.7246531301870460,
-			 0.7247733921981109,
-			 0.7248936321313144,
-			 0.7250138499829966,
-			 0.7251340457494933,
-			 0.7252542194271439,
-			 0.7253743710122875,
-			 0.7254945005012645,
-			 0.7256146078904151,
-			 0.7257346931760802,
-			 0.7258547563546036,
-			 0.7259747974223262,
-			 0.7260948163755918,
-			 0.7262148132107447,
-			 0.7263347879241291,
-			 0.7264547405120902,
-			 0.7265746709709758,
-			 0.7266945792971307,
-			 0.7268144654869026,
-			 0.7269343295366402,
-			 0.7270541714426910,
-			 0.7271739912014066,
-			 0.7272937888091346,
-			 0.7274135642622280,
-			 0.7275333175570367,
-			 0.7276530486899132,
-			 0.7277727576572103,
-			 0.7278924444552809,
-			 0.7280121090804810,
-			 0.7281317515291640,
-			 0.7282513717976844,
-			 0.7283709698824000,
-			 0.7284905457796672,
-			 0.7286100994858433,
-			 0.7287296309972867,
-			 0.7288491403103562,
-			 0.7289686274214119,
-			 0.7290880923268122,
-			 0.7292075350229197,
-			 0.7293269555060955,
-			 0.7294463537727019,
-			 0.7295657298191023,
-			 0.7296850836416592,
-			 0.7298044152367367,
-			 0.7299237246007012,
-			 0.7300430117299175,
-			 0.7301622766207519,
-			 0.7302815192695711,
-			 0.7304007396727443,
-			 0.7305199378266386,
-			 0.7306391137276219,
-			 0.7307582673720657,
-			 0.7308773987563398,
-			 0.7309965078768159,
-			 0.7311155947298643,
-			 0.7312346593118576,
-			 0.7313537016191707,
-			 0.7314727216481748,
-			 0.7315917193952464,
-			 0.7317106948567597,
-			 0.7318296480290913,
-			 0.7319485789086165,
-			 0.7320674874917124,
-			 0.7321863737747586,
-			 0.7323052377541313,
-			 0.7324240794262115,
-			 0.7325428987873789,
-			 0.7326616958340131,
-			 0.7327804705624957,
-			 0.7328992229692088,
-			 0.7330179530505343,
-			 0.7331366608028568,
-			 0.7332553462225595,
-			 0.7333740093060277,
-			 0.7334926500496455,
-			 0.7336112684497990,
-			 0.7337298645028765,
-			 0.7338484382052629,
-			 0.7339669895533489,
-			 0.7340855185435214,
-			 0.7342040251721702,
-			 0.7343225094356856,
-			 0.7344409713304575,
-			 0.7345594108528793,
-			 0.7346778279993408,
-			 0.7347962227662370,
-			 0.7349145951499598,
-			 0.7350329451469040,
-			 0.7351512727534641,
-			 0.7352695779660354,
-			 0.7353878607810158,
-			 0.7355061211948010,
-			 0.7356243592037873,
-			 0.7357425748043749,
-			 0.7358607679929620,
-			 0.7359789387659483,
-			 0.7360970871197342,
-			 0.7362152130507200,
-			 0.7363333165553092,
-			 0.7364513976299023,
-			 0.7365694562709031,
-			 0.7366874924747152,
-			 0.7368055062377424,
-			 0.7369234975563916,
-			 0.7370414664270676,
-			 0.7371594128461753,
-			 0.7372773368101239,
-			 0.7373952383153205,
-			 0.7375131173581737,
-			 0.7376309739350921,
-			 0.7377488080424873,
-			 0.7378666196767688,
-			 0.7379844088343465,
-			 0.7381021755116343,
-			 0.7382199197050440,
-			 0.7383376414109891,
-			 0.7384553406258841,
-			 0.7385730173461420,
-			 0.7386906715681798,
-			 0.7388083032884131,
-			 0.7389259125032585,
-			 0.7390434992091334,
-			 0.7391610634024560,
-			 0.7392786050796457,
-			 0.7393961242371202,
-			 0.7395136208713012,
-			 0.7396310949786093,
-			 0.7397485465554660,
-			 0.7398659755982938,
-			 0.7399833821035147,
-			 0.7401007660675522,
-			 0.7402181274868324,
-			 0.7403354663577777,
-			 0.7404527826768158,
-			 0.7405700764403724,
-			 0.7406873476448750,
-			 0.7408045962867502,
-			 0.7409218223624264,
-			 0.7410390258683346,
-			 0.7411562068009019,
-			 0.7412733651565607,
-			 0.7413905009317423,
-			 0.7415076141228771,
-			 0.7416247047263984,
-			 0.7417417727387388,
-			 0.7418588181563333,
-			 0.7419758409756160,
-			 0.7420928411930220,
-			 0.7422098188049880,
-			 0.7423267738079496,
-			 0.7424437061983441,
-			 0.7425606159726105,
-			 0.7426775031271871,
-			 0.7427943676585138,
-			 0.7429112095630297,
-			 0.7430280288371760,
-			 0.7431448254773942,
-			 0.7432615994801262,
-			 0.7433783508418161,
-			 0.7434950795589055,
-			 0.7436117856278408,
-			 0.7437284690450653,
-			 0.7438451298070251,
-			 0.7439617679101664,
-			 0.7440783833509360,
-			 0.7441949761257829,
-			 0.7443115462311547,
-			 0.7444280936634989,
-			 0.7445446184192674,
-			 0.7446611204949098,
-			 0.7447775998868774,
-			 0.7448940565916213,
-			 0.7450104906055954,
-			 0.7451269019252529,
-			 0.7452432905470463,
-			 0.7453596564674310,
-			 0.7454759996828620,
-			 0.7455923201897952,
-			 0.7457086179846886,
-			 0.7458248930639980,
-			 0.7459411454241820,
-			 0.7460573750616993,
-			 0.7461735819730089,
-			 0.7462897661545727,
-			 0.7464059276028489,
-			 0.7465220663143016,
-			 0.7466381822853911,
-			 0.7467542755125812,
-			 0.7468703459923351,
-			 0.7469863937211175,
-			 0.7471024186953931,
-			 0.7472184209116282,
-			 0.7473344003662874,
-			 0.7474503570558402,
-			 0.7475662909767520,
-			 0.7476822021254930,
-			 0.7477980904985316,
-			 0.7479139560923379,
-			 0.7480297989033828,
-			 0.7481456189281359,
-			 0.7482614161630708,
-			 0.7483771906046597,
-			 0.7484929422493757,
-			 0.7486086710936934,
-			 0.7487243771340865,
-			 0.7488400603670302,
-			 0.7489557207890019,
-			 0.7490713583964776,
-			 0.7491869731859351,
-			 0.7493025651538516,
-			 0.7494181342967081,
-			 0.7495336806109828,
-			 0.7496492040931547,
-			 0.7497647047397067,
-			 0.7498801825471197,
-			 0.7499956375118763,
-			 0.7501110696304598,
-			 0.7502264788993522,
-			 0.7503418653150407,
-			 0.7504572288740076,
-			 0.7505725695727413,
-			 0.7506878874077260,
-			 0.7508031823754505,
-			 0.7509184544724029,
-			 0.7510337036950705,
-			 0.7511489300399433,
-			 0.7512641335035106,
-			 0.7513793140822644,
-			 0.7514944717726961,
-			 0.7516096065712966,
-			 0.7517247184745592,
-			 0.7518398074789775,
-			 0.7519548735810451,
-			 0.7520699167772578,
-			 0.7521849370641109,
-			 0.7522999344381012,
-			 0.7524149088957245,
-			 0.7525298604334784,
-			 0.7526447890478631,
-			 0.7527596947353753,
-			 0.7528745774925166,
-			 0.7529894373157874,
-			 0.7531042742016877,
-			 0.7532190881467200,
-			 0.7533338791473863,
-			 0.7534486472001914,
-			 0.7535633923016373,
-			 0.7536781144482301,
-			 0.7537928136364753,
-			 0.7539074898628779,
-			 0.7540221431239450,
-			 0.7541367734161843,
-			 0.7542513807361038,
-			 0.7543659650802129,
-			 0.7544805264450196,
-			 0.7545950648270359,
-			 0.7547095802227719,
-			 0.7548240726287396,
-			 0.7549385420414512,
-			 0.7550529884574191,
-			 0.7551674118731589,
-			 0.7552818122851835,
-			 0.7553961896900084,
-			 0.7555105440841495,
-			 0.7556248754641228,
-			 0.7557391838264473,
-			 0.7558534691676400,
-			 0.7559677314842181,
-			 0.7560819707727029,
-			 0.7561961870296139,
-			 0.7563103802514717,
-			 0.7564245504347975,
-			 0.7565386975761149,
-			 0.7566528216719458,
-			 0.7567669227188125,
-			 0.7568810007132413,
-			 0.7569950556517562,
-			 0.7571090875308832,
-			 0.7572230963471491,
-			 0.7573370820970794,
-			 0.7574510447772035,
-			 0.7575649843840493,
-			 0.7576789009141462,
-			 0.7577927943640239,
-			 0.7579066647302131,
-			 0.7580205120092457,
-			 0.7581343361976525,
-			 0.7582481372919663,
-			 0.7583619152887215,
-			 0.7584756701844519,
-			 0.7585894019756921,
-			 0.7587031106589784,
-			 0.7588167962308452,
-			 0.7589304586878317,
-			 0.7590440980264732,
-			 0.7591577142433100,
-			 0.7592713073348805,
-			 0.7593848772977243,
-			 0.7594984241283825,
-			 0.7596119478233947,
-			 0.7597254483793049,
-			 0.7598389257926534,
-			 0.7599523800599852,
-			 0.7600658111778444,
-			 0.7601792191427744,
-			 0.7602926039513213,
-			 0.7604059656000305,
-			 0.7605193040854500,
-			 0.7606326194041269,
-			 0.7607459115526090,
-			 0.7608591805274462,
-			 0.7609724263251868,
-			 0.7610856489423813,
-			 0.7611988483755823,
-			 0.7613120246213392,
-			 0.7614251776762063,
-			 0.7615383075367368,
-			 0.7616514141994833,
-			 0.7617644976610011,
-			 0.7618775579178447,
-			 0.7619905949665720,
-			 0.7621036088037372,
-			 0.7622165994258997,
-			 0.7623295668296173,
-			 0.7624425110114479,
-			 0.7625554319679515,
-			 0.7626683296956878,
-			 0.7627812041912193,
-			 0.7628940554511068,
-			 0.7630068834719113,
-			 0.7631196882501975,
-			 0.7632324697825288,
-			 0.7633452280654697,
-			 0.7634579630955846,
-			 0.7635706748694406,
-			 0.7636833633836044,
-			 0.7637960286346421,
-			 0.7639086706191224,
-			 0.7640212893336138,
-			 0.7641338847746854,
-			 0.7642464569389089,
-			 0.7643590058228537,
-			 0.7644715314230914,
-			 0.7645840337361949,
-			 0.7646965127587368,
-			 0.7648089684872910,
-			 0.7649214009184311,
-			 0.7650338100487341,
-			 0.7651461958747746,
-			 0.7652585583931281,
-			 0.7653708976003735,
-			 0.7654832134930880,
-			 0.7655955060678505,
-			 0.7657077753212409,
-			 0.7658200212498375,
-			 0.7659322438502234,
-			 0.7660444431189778,
-			 0.7661566190526847,
-			 0.7662687716479265,
-			 0.7663809009012866,
-			 0.7664930068093502,
-			 0.7666050893687004,
-			 0.7667171485759249,
-			 0.7668291844276095,
-			 0.7669411969203414,
-			 0.7670531860507084,
-			 0.7671651518152999,
-			 0.7672770942107033,
-			 0.7673890132335106,
-			 0.7675009088803117,
-			 0.7676127811476984,
-			 0.7677246300322625,
-			 0.7678364555305971,
-			 0.7679482576392964,
-			 0.7680600363549529,
-			 0.7681717916741639,
-			 0.7682835235935230,
-			 0.7683952321096282,
-			 0.7685069172190768,
-			 0.7686185789184654,
-			 0.7687302172043933,
-			 0.7688418320734591,
-			 0.7689534235222646,
-			 0.7690649915474083,
-			 0.7691765361454932,
-			 0.7692880573131217,
-			 0.7693995550468952,
-			 0.7695110293434181,
-			 0.7696224801992941,
-			 0.7697339076111293,
-			 0.7698453115755288,
-			 0.7699566920890998,
-			 0.7700680491484482,
-			 0.7701793827501823,
-			 0.7702906928909103,
-			 0.7704019795672427,
-			 0.7705132427757888,
-			 0.7706244825131593,
-			 0.7707356987759663,
-			 0.7708468915608202,
-			 0.7709580608643363,
-			 0.7710692066831257,
-			 0.7711803290138051,
-			 0.7712914278529879,
-			 0.7714025031972901,
-			 0.7715135550433284,
-			 0.7716245833877200,
-			 0.7717355882270827,
-			 0.7718465695580344,
-			 0.7719575273771957,
-			 0.7720684616811867,
-			 0.7721793724666268,
-			 0.7722902597301383,
-			 0.7724011234683432,
-			 0.7725119636778643,
-			 0.7726227803553249,
-			 0.7727335734973509,
-			 0.7728443431005657,
-			 0.7729550891615956,
-			 0.7730658116770670,
-			 0.7731765106436072,
-			 0.7732871860578435,
-			 0.7733978379164057,
-			 0.7735084662159232,
-			 0.7736190709530247,
-			 0.7737296521243419,
-			 0.7738402097265055,
-			 0.7739507437561495,
-			 0.7740612542099057,
-			 0.7741717410844067,
-			 0.7742822043762884,
-			 0.7743926440821854,
-			 0.7745030601987336,
-			 0.7746134527225695,
-			 0.7747238216503304,
-			 0.7748341669786547,
-			 0.7749444887041794,
-			 0.7750547868235457,
-			 0.7751650613333931,
-			 0.7752753122303626,
-			 0.7753855395110955,
-			 0.7754957431722348,
-			 0.7756059232104218,
-			 0.7757160796223019,
-			 0.7758262124045191,
-			 0.7759363215537184,
-			 0.7760464070665457,
-			 0.7761564689396476,
-			 0.7762665071696722,
-			 0.7763765217532655,
-			 0.7764865126870784,
-			 0.7765964799677593,
-			 0.7767064235919587,
-			 0.7768163435563282,
-			 0.7769262398575175,
-			 0.7770361124921813,
-			 0.7771459614569706,
-			 0.7772557867485407,
-			 0.7773655883635455,
-			 0.7774753662986406,
-			 0.7775851205504821,
-			 0.7776948511157254,
-			 0.7778045579910300,
-			 0.7779142411730517,
-			 0.7780239006584512,
-			 0.7781335364438873,
-			 0.7782431485260212,
-			 0.7783527369015124,
-			 0.7784623015670236,
-			 0.7785718425192164,
-			 0.7786813597547554,
-			 0.7787908532703036,
-			 0.7789003230625260,
-			 0.7790097691280883,
-			 0.7791191914636549,
-			 0.7792285900658950,
-			 0.7793379649314737,
-			 0.7794473160570610,
-			 0.7795566434393260,
-			 0.7796659470749371,
-			 0.7797752269605653,
-			 0.7798844830928813,
-			 0.7799937154685586,
-			 0.7801029240842675,
-			 0.7802121089366830,
-			 0.7803212700224793,
-			 0.7804304073383298,
-			 0.7805395208809106,
-			 0.7806486106468975,
-			 0.7807576766329690,
-			 0.7808667188358006,
-			 0.7809757372520729,
-			 0.7810847318784632,
-			 0.7811937027116520,
-			 0.7813026497483200,
-			 0.7814115729851482,
-			 0.7815204724188182,
-			 0.7816293480460138,
-			 0.7817381998634185,
-			 0.7818470278677154,
-			 0.7819558320555899,
-			 0.7820646124237273,
-			 0.7821733689688152,
-			 0.7822821016875399,
-			 0.7823908105765880,
-			 0.7824994956326498,
-			 0.7826081568524138,
-			 0.7827167942325701,
-			 0.7828254077698090,
-			 0.7829339974608235,
-			 0.7830425633023045,
-			 0.7831511052909440,
-			 0.7832596234234372,
-			 0.7833681176964780,
-			 0.7834765881067614,
-			 0.7835850346509824,
-			 0.7836934573258396,
-			 0.7838018561280290,
-			 0.7839102310542474,
-			 0.7840185821011951,
-			 0.7841269092655713,
-			 0.7842352125440759,
-			 0.7843434919334098,
-			 0.7844517474302748,
-			 0.7845599790313731,
-			 0.7846681867334078,
-			 0.7847763705330827,
-			 0.7848845304271024,
-			 0.7849926664121726,
-			 0.7851007784849977,
-			 0.7852088666422866,
-			 0.7853169308807446,
-			 0.7854249711970815,
-			 0.7855329875880057,
-			 0.7856409800502268,
-			 0.7857489485804555,
-			 0.7858568931754015,
-			 0.7859648138317789,
-			 0.7860727105462978,
-			 0.7861805833156732,
-			 0.7862884321366186,
-			 0.7863962570058493,
-			 0.7865040579200795,
-			 0.7866118348760257,
-			 0.7867195878704062,
-			 0.7868273168999367,
-			 0.7869350219613369,
-			 0.7870427030513257,
-			 0.7871503601666233,
-			 0.7872579933039494,
-			 0.7873656024600250,
-			 0.7874731876315735,
-			 0.7875807488153168,
-			 0.7876882860079792,
-			 0.7877957992062840,
-			 0.7879032884069563,
-			 0.7880107536067216,
-			 0.7881181948023076,
-			 0.7882256119904396,
-			 0.7883330051678469,
-			 0.7884403743312584,
-			 0.7885477194774019,
-			 0.7886550406030085,
-			 0.7887623377048082,
-			 0.7888696107795342,
-			 0.7889768598239166,
-			 0.7890840848346907,
-			 0.7891912858085885,
-			 0.7892984627423451,
-			 0.7894056156326955,
-			 0.7895127444763753,
-			 0.7896198492701223,
-			 0.7897269300106732,
-			 0.7898339866947667,
-			 0.7899410193191405,
-			 0.7900480278805350,
-			 0.7901550123756903,
-			 0.7902619728013471,
-			 0.7903689091542487,
-			 0.7904758214311360,
-			 0.7905827096287529,
-			 0.7906895737438433,
-			 0.7907964137731520,
-			 0.7909032297134240,
-			 0.7910100215614069,
-			 0.7911167893138461,
-			 0.7912235329674899,
-			 0.7913302525190867,
-			 0.7914369479653857,
-			 0.7915436193031364,
-			 0.7916502665290893,
-			 0.7917568896399971,
-			 0.7918634886326110,
-			 0.7919700635036825,
-			 0.7920766142499669,
-			 0.7921831408682179,
-			 0.7922896433551906,
-			 0.7923961217076400,
-			 0.7925025759223244,
-			 0.7926090059959994,
-			 0.7927154119254234,
-			 0.7928217937073551,
-			 0.7929281513385539,
-			 0.7930344848157805,
-			 0.7931407941357944,
-			 0.7932470792953585,
-			 0.7933533402912349,
-			 0.7934595771201867,
-			 0.7935657897789775,
-			 0.7936719782643721,
-			 0.7937781425731363,
-			 0.7938842827020345,
-			 0.7939903986478350,
-			 0.7940964904073051,
-			 0.7942025579772127,
-			 0.7943086013543271,
-			 0.7944146205354178,
-			 0.7945206155172559,
-			 0.7946265862966111,
-			 0.7947325328702574,
-			 0.7948384552349652,
-			 0.7949443533875097,
-			 0.7950502273246646,
-			 0.7951560770432050,
-			 0.7952619025399058,
-			 0.7953677038115433,
-			 0.7954734808548956,
-			 0.7955792336667399,
-			 0.7956849622438555,
-			 0.7957906665830208,
-			 0.7958963466810161,
-			 0.7960020025346217,
-			 0.7961076341406202,
-			 0.7962132414957936,
-			 0.7963188245969247,
-			 0.7964243834407978,
-			 0.7965299180241958,
-			 0.7966354283439062,
-			 0.7967409143967127,
-			 0.7968463761794035,
-			 0.7969518136887658,
-			 0.7970572269215881,
-			 0.7971626158746583,
-			 0.7972679805447662,
-			 0.7973733209287037,
-			 0.7974786370232598,
-			 0.7975839288252285,
-			 0.7976891963314005,
-			 0.7977944395385710,
-			 0.7978996584435327,
-			 0.7980048530430810,
-			 0.7981100233340115,
-			 0.7982151693131198,
-			 0.7983202909772047,
-			 0.7984253883230624,
-			 0.7985304613474921,
-			 0.7986355100472928,
-			 0.7987405344192648,
-			 0.7988455344602083,
-			 0.7989505101669259,
-			 0.7990554615362198,
-			 0.7991603885648918,
-			 0.7992652912497463,
-			 0.7993701695875873,
-			 0.7994750235752217,
-			 0.7995798532094531,
-			 0.7996846584870905,
-			 0.7997894394049396,
-			 0.7998941959598093,
-			 0.7999989281485085,
-			 0.8001036359678462,
-			 0.8002083194146346,
-			 0.8003129784856825,
-			 0.8004176131778041,
-			 0.8005222234878105,
-			 0.8006268094125155,
-			 0.8007313709487334,
-			 0.8008359080932788,
-			 0.8009404208429675,
-			 0.8010449091946164,
-			 0.8011493731450409,
-			 0.8012538126910604,
-			 0.8013582278294933,
-			 0.8014626185571585,
-			 0.8015669848708764,
-			 0.8016713267674681,
-			 0.8017756442437538,
-			 0.8018799372965573,
-			 0.8019842059227010,
-			 0.8020884501190089,
-			 0.8021926698823049,
-			 0.8022968652094159,
-			 0.8024010360971668,
-			 0.8025051825423835,
-			 0.8026093045418948,
-			 0.8027134020925288,
-			 0.8028174751911142,
-			 0.8029215238344805,
-			 0.8030255480194595,
-			 0.8031295477428816,
-			 0.8032335230015776,
-			 0.8033374737923819,
-			 0.8034414001121273,
-			 0.8035453019576487,
-			 0.8036491793257801,
-			 0.8037530322133570,
-			 0.8038568606172175,
-			 0.8039606645341968,
-			 0.8040644439611343,
-			 0.8041681988948683,
-			 0.8042719293322387,
-			 0.8043756352700846,
-			 0.8044793167052475,
-			 0.8045829736345687,
-			 0.8046866060548914,
-			 0.8047902139630585,
-			 0.8048937973559143,
-			 0.8049973562303023,
-			 0.8051008905830683,
-			 0.8052044004110598,
-			 0.8053078857111216,
-			 0.8054113464801028,
-			 0.8055147827148517,
-			 0.8056181944122175,
-			 0.8057215815690494,
-			 0.8058249441821979,
-			 0.8059282822485159,
-			 0.8060315957648535,
-			 0.8061348847280658,
-			 0.8062381491350048,
-			 0.8063413889825253,
-			 0.8064446042674827,
-			 0.8065477949867320,
-			 0.8066509611371311,
-			 0.8067541027155368,
-			 0.8068572197188079,
-			 0.8069603121438019,
-			 0.8070633799873793,
-			 0.8071664232464003,
-			 0.8072694419177260,
-			 0.8073724359982178,
-			 0.8074754054847398,
-			 0.8075783503741540,
-			 0.8076812706633250,
-			 0.8077841663491174,
-			 0.8078870374283966,
-			 0.8079898838980304,
-			 0.8080927057548839,
-			 0.8081955029958270,
-			 0.8082982756177267,
-			 0.8084010236174530,
-			 0.8085037469918760,
-			 0.8086064457378659,
-			 0.8087091198522961,
-			 0.8088117693320377,
-			 0.8089143941739630,
-			 0.8090169943749473,
-			 0.8091195699318647,
-			 0.8092221208415906,
-			 0.8093246471010006,
-			 0.8094271487069732,
-			 0.8095296256563843,
-			 0.8096320779461128,
-			 0.8097345055730381,
-			 0.8098369085340398,
-			 0.8099392868259980,
-			 0.8100416404457959,
-			 0.8101439693903137,
-			 0.8102462736564351,
-			 0.8103485532410437,
-			 0.8104508081410238,
-			 0.8105530383532604,
-			 0.8106552438746392,
-			 0.8107574247020481,
-			 0.8108595808323737,
-			 0.8109617122625030,
-			 0.8110638189893264,
-			 0.8111659010097331,
-			 0.8112679583206139,
-			 0.8113699909188592,
-			 0.8114719988013607,
-			 0.8115739819650125,
-			 0.8116759404067062,
-			 0.8117778741233374,
-			 0.8118797831118005,
-			 0.8119816673689917,
-			 0.8120835268918064,
-			 0.8121853616771418,
-			 0.8122871717218969,
-			 0.8123889570229698,
-			 0.8124907175772600,
-			 0.8125924533816681,
-			 0.8126941644330941,
-			 0.8127958507284397,
-			 0.8128975122646085,
-			 0.8129991490385030,
-			 0.8131007610470272,
-			 0.8132023482870860,
-			 0.8133039107555847,
-			 0.8134054484494301,
-			 0.8135069613655277,
-			 0.8136084495007871,
-			 0.8137099128521149,
-			 0.8138113514164225,
-			 0.8139127651906182,
-			 0.8140141541716133,
-			 0.8141155183563193,
-			 0.8142168577416480,
-			 0.8143181723245140,
-			 0.8144194621018289,
-			 0.8145207270705094,
-			 0.8146219672274693,
-			 0.8147231825696249,
-			 0.8148243730938934,
-			 0.8149255387971915,
-			 0.8150266796764388,
-			 0.8151277957285542,
-			 0.8152288869504566,
-			 0.8153299533390670,
-			 0.8154309948913068,
-			 0.8155320116040976,
-			 0.8156330034743633,
-			 0.8157339704990269,
-			 0.8158349126750133,
-			 0.8159358299992467,
-			 0.8160367224686530,
-			 0.8161375900801602,
-			 0.8162384328306937,
-			 0.8163392507171838,
-			 0.8164400437365580,
-			 0.8165408118857461,
-			 0.8166415551616788,
-			 0.8167422735612873,
-			 0.8168429670815034,
-			 0.8169436357192593,
-			 0.8170442794714901,
-			 0.8171448983351289,
-			 0.8172454923071097,
-			 0.8173460613843698,
-			 0.8174466055638451,
-			 0.8175471248424728,
-			 0.8176476192171916,
-			 0.8177480886849386,
-			 0.8178485332426549,
-			 0.8179489528872803,
-			 0.8180493476157559,
-			 0.8181497174250233,
-			 0.8182500623120246,
-			 0.8183503822737048,
-			 0.8184506773070063,
-			 0.8185509474088746,
-			 0.8186511925762551,
-			 0.8187514128060938,
-			 0.8188516080953393,
-			 0.8189517784409385,
-			 0.8190519238398389,
-			 0.8191520442889916,
-			 0.8192521397853461,
-			 0.8193522103258533,
-			 0.8194522559074650,
-			 0.8195522765271336,
-			 0.8196522721818127,
-			 0.8197522428684549,
-			 0.8198521885840163,
-			 0.8199521093254520,
-			 0.8200520050897182,
-			 0.8201518758737724,
-			 0.8202517216745712,
-			 0.8203515424890738,
-			 0.8204513383142390,
-			 0.8205511091470278,
-			 0.8206508549844004,
-			 0.8207505758233186,
-			 0.8208502716607450,
-			 0.8209499424936417,
-			 0.8210495883189728,
-			 0.8211492091337037,
-			 0.8212488049347992,
-			 0.8213483757192263,
-			 0.8214479214839505,
-			 0.8215474422259397,
-			 0.8216469379421638,
-			 0.8217464086295898,
-			 0.8218458542851894,
-			 0.8219452749059327,
-			 0.8220446704887917,
-			 0.8221440410307376,
-			 0.8222433865287433,
-			 0.8223427069797843,
-			 0.8224420023808330,
-			 0.8225412727288661,
-			 0.8226405180208598,
-			 0.8227397382537900,
-			 0.8228389334246344,
-			 0.8229381035303718,
-			 0.8230372485679804,
-			 0.8231363685344414,
-			 0.8232354634267347,
-			 0.8233345332418424,
-			 0.8234335779767454,
-			 0.8235325976284275,
-			 0.8236315921938719,
-			 0.8237305616700630,
-			 0.8238295060539873,
-			 0.8239284253426292,
-			 0.8240273195329761,
-			 0.8241261886220156,
-			 0.8242250326067353,
-			 0.8243238514841258,
-			 0.8244226452511748,
-			 0.8245214139048750,
-			 0.8246201574422163,
-			 0.8247188758601910,
-			 0.8248175691557923,
-			 0.8249162373260132,
-			 0.8250148803678495,
-			 0.8251134982782955,
-			 0.8252120910543461,
-			 0.8253106586929995,
-			 0.8254092011912525,
-			 0.8255077185461036,
-			 0.8256062107545515,
-			 0.8257046778135957,
-			 0.8258031197202381,
-			 0.8259015364714785,
-			 0.8259999280643194,
-			 0.8260982944957638,
-			 0.8261966357628145,
-			 0.8262949518624776,
-			 0.8263932427917572,
-			 0.8264915085476581,
-			 0.8265897491271884,
-			 0.8266879645273553,
-			 0.8267861547451666,
-			 0.8268843197776310,
-			 0.8269824596217596,
-			 0.8270805742745621,
-			 0.8271786637330485,
-			 0.8272767279942326,
-			 0.8273747670551264,
-			 0.8274727809127436,
-			 0.8275707695640990,
-			 0.8276687330062062,
-			 0.8277666712360832,
-			 0.8278645842507444,
-			 0.8279624720472089,
-			 0.8280603346224942,
-			 0.8281581719736192,
-			 0.8282559840976044,
-			 0.8283537709914685,
-			 0.8284515326522343,
-			 0.8285492690769238,
-			 0.8286469802625585,
-			 0.8287446662061636,
-			 0.8288423269047621,
-			 0.8289399623553790,
-			 0.8290375725550414,
-			 0.8291351575007750,
-			 0.8292327171896081,
-			 0.8293302516185672,
-			 0.8294277607846832,
-			 0.8295252446849842,
-			 0.8296227033165010,
-			 0.8297201366762655,
-			 0.8298175447613099,
-			 0.8299149275686659,
-			 0.8300122850953681,
-			 0.8301096173384492,
-			 0.8302069242949460,
-			 0.8303042059618932,
-			 0.8304014623363285,
-			 0.8304986934152893,
-			 0.8305958991958122,
-			 0.8306930796749382,
-			 0.8307902348497055,
-			 0.8308873647171552,
-			 0.8309844692743278,
-			 0.8310815485182665,
-			 0.8311786024460142,
-			 0.8312756310546137,
-			 0.8313726343411085,
-			 0.8314696123025452,
-			 0.8315665649359687,
-			 0.8316634922384266,
-			 0.8317603942069659,
-			 0.8318572708386351,
-			 0.8319541221304830,
-			 0.8320509480795580,
-			 0.8321477486829124,
-			 0.8322445239375964,
-			 0.8323412738406629,
-			 0.8324379983891649,
-			 0.8325346975801544,
-			 0.8326313714106878,
-			 0.8327280198778187,
-			 0.8328246429786037,
-			 0.8329212407100989,
-			 0.8330178130693627,
-			 0.8331143600534534,
-			 0.8332108816594294,
-			 0.8333073778843497,
-			 0.8334038487252762,
-			 0.8335002941792696,
-			 0.8335967142433929,
-			 0.8336931089147070,
-			 0.8337894781902775,
-			 0.8338858220671685,
-			 0.8339821405424439,
-			 0.8340784336131710,
-			 0.8341747012764157,
-			 0.8342709435292469,
-			 0.8343671603687315,
-			 0.8344633517919390,
-			 0.8345595177959396,
-			 0.8346556583778028,
-			 0.8347517735346011,
-			 0.8348478632634069,
-			 0.8349439275612914,
-			 0.8350399664253302,
-			 0.8351359798525965,
-			 0.8352319678401671,
-			 0.8353279303851165,
-			 0.8354238674845221,
-			 0.8355197791354620,
-			 0.8356156653350132,
-			 0.8357115260802560,
-			 0.8358073613682705,
-			 0.8359031711961359,
-			 0.8359989555609356,
-			 0.8360947144597505,
-			 0.8361904478896639,
-			 0.8362861558477592,
-			 0.8363818383311220,
-			 0.8364774953368376,
-			 0.8365731268619906,
-			 0.8366687329036699,
-			 0.8367643134589619,
-			 0.8368598685249546,
-			 0.8369553980987386,
-			 0.8370509021774033,
-			 0.8371463807580399,
-			 0.8372418338377395,
-			 0.8373372614135935,
-			 0.8374326634826965,
-			 0.8375280400421413,
-			 0.8376233910890236,
-			 0.8377187166204380,
-			 0.8378140166334819,
-			 0.8379092911252514,
-			 0.8380045400928440,
-			 0.8380997635333585,
-			 0.8381949614438938,
-			 0.8382901338215510,
-			 0.8383852806634311,
-			 0.8384804019666341,
-			 0.8385754977282646,
-			 0.8386705679454241,
-			 0.8387656126152168,
-			 0.8388606317347483,
-			 0.8389556253011239,
-			 0.8390505933114502,
-			 0.8391455357628338,
-			 0.8392404526523817,
-			 0.8393353439772041,
-			 0.8394302097344093,
-			 0.8395250499211088,
-			 0.8396198645344132,
-			 0.8397146535714336,
-			 0.8398094170292834,
-			 0.8399041549050745,
-			 0.8399988671959225,
-			 0.8400935538989414,
-			 0.8401882150112476,
-			 0.8402828505299580,
-			 0.8403774604521879,
-			 0.8404720447750575,
-			 0.8405666034956841,
-			 0.8406611366111879,
-			 0.8407556441186895,
-			 0.8408501260153087,
-			 0.8409445822981690,
-			 0.8410390129643919,
-			 0.8411334180111024,
-			 0.8412277974354233,
-			 0.8413221512344797,
-			 0.8414164794053990,
-			 0.8415107819453060,
-			 0.8416050588513289,
-			 0.8416993101205961,
-			 0.8417935357502351,
-			 0.8418877357373773,
-			 0.8419819100791530,
-			 0.8420760587726921,
-			 0.8421701818151281,
-			 0.8422642792035936,
-			 0.8423583509352223,
-			 0.8424523970071474,
-			 0.8425464174165055,
-			 0.8426404121604325,
-			 0.8427343812360638,
-			 0.8428283246405385,
-			 0.8429222423709938,
-			 0.8430161344245701,
-			 0.8431100007984067,
-			 0.8432038414896434,
-			 0.8432976564954224,
-			 0.8433914458128855,
-			 0.8434852094391764,
-			 0.8435789473714380,
-			 0.8436726596068165,
-			 0.8437663461424562,
-			 0.8438600069755027,
-			 0.8439536421031030,
-			 0.8440472515224058,
-			 0.8441408352305589,
-			 0.8442343932247125,
-			 0.8443279255020147,
-			 0.8444214320596187,
-			 0.8445149128946744,
-			 0.8446083680043344,
-			 0.8447017973857527,
-			 0.8447952010360824,
-			 0.8448885789524796,
-			 0.8449819311320991,
-			 0.8450752575720966,
-			 0.8451685582696297,
-			 0.8452618332218558,
-			 0.8453550824259346,
-			 0.8454483058790255,
-			 0.8455415035782874,
-			 0.8456346755208832,
-			 0.8457278217039733,
-			 0.8458209421247208,
-			 0.8459140367802885,
-			 0.8460071056678418,
-			 0.8461001487845453,
-			 0.8461931661275636,
-			 0.8462861576940650,
-			 0.8463791234812154,
-			 0.8464720634861829,
-			 0.8465649777061374,
-			 0.8466578661382484,
-			 0.8467507287796856,
-			 0.8468435656276202,
-			 0.8469363766792256,
-			 0.8470291619316732,
-			 0.8471219213821367,
-			 0.8472146550277913,
-			 0.8473073628658121,
-			 0.8474000448933738,
-			 0.8474927011076551,
-			 0.8475853315058319,
-			 0.8476779360850832,
-			 0.8477705148425884,
-			 0.8478630677755260,
-			 0.8479555948810782,
-			 0.8480480961564254,
-			 0.8481405715987513,
-			 0.8482330212052377,
-			 0.8483254449730686,
-			 0.8484178428994292,
-			 0.8485102149815036,
-			 0.8486025612164793,
-			 0.8486948816015422,
-			 0.8487871761338817,
-			 0.8488794448106848,
-			 0.8489716876291419,
-			 0.8490639045864415,
-			 0.8491560956797761,
-			 0.8492482609063370,
-			 0.8493404002633159,
-			 0.8494325137479078,
-			 0.8495246013573057,
-			 0.8496166630887040,
-			 0.8497086989392982,
-			 0.8498007089062859,
-			 0.8498926929868633,
-			 0.8499846511782297,
-			 0.8500765834775826,
-			 0.8501684898821225,
-			 0.8502603703890488,
-			 0.8503522249955626,
-			 0.8504440536988670,
-			 0.8505358564961636,
-			 0.8506276333846574,
-			 0.8507193843615518,
-			 0.8508111094240515,
-			 0.8509028085693622,
-			 0.8509944817946916,
-			 0.8510861290972468,
-			 0.8511777504742355,
-			 0.8512693459228682,
-			 0.8513609154403539,
-			 0.8514524590239024,
-			 0.8515439766707256,
-			 0.8516354683780364,
-			 0.8517269341430473,
-			 0.8518183739629727,
-			 0.8519097878350257,
-			 0.8520011757564235,
-			 0.8520925377243810,
-			 0.8521838737361150,
-			 0.8522751837888443,
-			 0.8523664678797873,
-			 0.8524577260061621,
-			 0.8525489581651902,
-			 0.8526401643540923,
-			 0.8527313445700894,
-			 0.8528224988104038,
-			 0.8529136270722600,
-			 0.8530047293528819,
-			 0.8530958056494927,
-			 0.8531868559593204,
-			 0.8532778802795898,
-			 0.8533688786075281,
-			 0.8534598509403645,
-			 0.8535507972753275,
-			 0.8536417176096460,
-			 0.8537326119405504,
-			 0.8538234802652731,
-			 0.8539143225810450,
-			 0.8540051388850988,
-			 0.8540959291746691,
-			 0.8541866934469895,
-			 0.8542774316992952,
-			 0.8543681439288218,
-			 0.8544588301328074,
-			 0.8545494903084883,
-			 0.8546401244531034,
-			 0.8547307325638910,
-			 0.8548213146380919,
-			 0.8549118706729462,
-			 0.8550024006656960,
-			 0.8550929046135840,
-			 0.8551833825138521,
-			 0.8552738343637452,
-			 0.8553642601605066,
-			 0.8554546599013831,
-			 0.8555450335836201,
-			 0.8556353812044660,
-			 0.8557257027611673,
-			 0.8558159982509737,
-			 0.8559062676711329,
-			 0.8559965110188968,
-			 0.8560867282915160,
-			 0.8561769194862417,
-			 0.8562670846003281,
-			 0.8563572236310275,
-			 0.8564473365755937,
-			 0.8565374234312817,
-			 0.8566274841953483,
-			 0.8567175188650491,
-			 0.8568075274376423,
-			 0.8568975099103864,
-			 0.8569874662805396,
-			 0.8570773965453613,
-			 0.8571673007021121,
-			 0.8572571787480543,
-			 0.8573470306804492,
-			 0.8574368564965605,
-			 0.8575266561936521,
-			 0.8576164297689880,
-			 0.8577061772198330,
-			 0.8577958985434535,
-			 0.8578855937371171,
-			 0.8579752627980908,
-			 0.8580649057236444,
-			 0.8581545225110457,
-			 0.8582441131575660,
-			 0.8583336776604746,
-			 0.8584232160170449,
-			 0.8585127282245486,
-			 0.8586022142802597,
-			 0.8586916741814508,
-			 0.8587811079253986,
-			 0.8588705155093777,
-			 0.8589598969306641,
-			 0.8590492521865364,
-			 0.8591385812742726,
-			 0.8592278841911500,
-			 0.8593171609344500,
-			 0.8594064115014528,
-			 0.8594956358894389,
-			 0.8595848340956903,
-			 0.8596740061174908,
-			 0.8597631519521239,
-			 0.8598522715968731,
-			 0.8599413650490246,
-			 0.8600304323058648,
-			 0.8601194733646794,
-			 0.8602084882227562,
-			 0.8602974768773849,
-			 0.8603864393258535,
-			 0.8604753755654519,
-			 0.8605642855934721,
-			 0.8606531694072055,
-			 0.8607420270039433,
-			 0.8608308583809805,
-			 0.8609196635356098,
-			 0.8610084424651265,
-			 0.8610971951668259,
-			 0.8611859216380057,
-			 0.8612746218759617,
-			 0.8613632958779930,
-			 0.8614519436413969,
-			 0.8615405651634744,
-			 0.8616291604415253,
-			 0.8617177294728515,
-			 0.8618062722547550,
-			 0.8618947887845380,
-			 0.8619832790595047,
-			 0.8620717430769583,
-			 0.8621601808342055,
-			 0.8622485923285513,
-			 0.8623369775573035,
-			 0.8624253365177696,
-			 0.8625136692072578,
-			 0.8626019756230764,
-			 0.8626902557625366,
-			 0.8627785096229489,
-			 0.8628667372016244,
-			 0.8629549384958767,
-			 0.8630431135030187,
-			 0.8631312622203641,
-			 0.8632193846452270,
-			 0.8633074807749240,
-			 0.8633955506067715,
-			 0.8634835941380862,
-			 0.8635716113661873,
-			 0.8636596022883924,
-			 0.8637475669020223,
-			 0.8638355052043956,
-			 0.8639234171928352,
-			 0.8640113028646622,
-			 0.8640991622172003,
-			 0.8641869952477733,
-			 0.8642748019537050,
-			 0.8643625823323203,
-			 0.8644503363809453,
-			 0.8645380640969077,
-			 0.8646257654775343,
-			 0.8647134405201549,
-			 0.8648010892220974,
-			 0.8648887115806927,
-			 0.8649763075932705,
-			 0.8650638772571636,
-			 0.8651514205697043,
-			 0.8652389375282260,
-			 0.8653264281300618,
-			 0.8654138923725475,
-			 0.8655013302530192,
-			 0.8655887417688118,
-			 0.8656761269172640,
-			 0.8657634856957139,
-			 0.8658508181014996,
-			 0.8659381241319606,
-			 0.8660254037844384,
-			 0.8661126570562744,
-			 0.8661998839448092,
-			 0.8662870844473871,
-			 0.8663742585613520,
-			 0.8664614062840469,
-			 0.8665485276128185,
-			 0.8666356225450130,
-			 0.8667226910779764,
-			 0.8668097332090564,
-			 0.8668967489356029,
-			 0.8669837382549640,
-			 0.8670707011644897,
-			 0.8671576376615320,
-			 0.8672445477434426,
-			 0.8673314314075727,
-			 0.8674182886512776,
-			 0.8675051194719099,
-			 0.8675919238668252,
-			 0.8676787018333787,
-			 0.8677654533689281,
-			 0.8678521784708306,
-			 0.8679388771364440,
-			 0.8680255493631266,
-			 0.8681121951482392,
-			 0.8681988144891419,
-			 0.8682854073831967,
-			 0.8683719738277657,
-			 0.8684585138202120,
-			 0.8685450273578993,
-			 0.8686315144381913,
-			 0.8687179750584546,
-			 0.8688044092160548,
-			 0.8688908169083599,
-			 0.8689771981327374,
-			 0.8690635528865555,
-			 0.8691498811671844,
-			 0.8692361829719929,
-			 0.8693224582983538,
-			 0.8694087071436377,
-			 0.8694949295052186,
-			 0.8695811253804696,
-			 0.8696672947667650,
-			 0.8697534376614787,
-			 0.8698395540619881,
-			 0.8699256439656696,
-			 0.8700117073699002,
-			 0.8700977442720595,
-			 0.8701837546695256,
-			 0.8702697385596792,
-			 0.8703556959398996,
-			 0.8704416268075700,
-			 0.8705275311600716,
-			 0.8706134089947889,
-			 0.8706992603091056,
-			 0.8707850851004056,
-			 0.8708708833660757,
-			 0.8709566551035007,
-			 0.8710424003100694,
-			 0.8711281189831689,
-			 0.8712138111201893,
-			 0.8712994767185190,
-			 0.8713851157755489,
-			 0.8714707282886708,
-			 0.8715563142552754,
-			 0.8716418736727569,
-			 0.8717274065385091,
-			 0.8718129128499252,
-			 0.8718983926044017,
-			 0.8719838457993350,
-			 0.8720692724321204,
-			 0.8721546725001572,
-			 0.8722400460008439,
-			 0.8723253929315791,
-			 0.8724107132897627,
-			 0.8724960070727970,
-			 0.8725812742780833,
-			 0.8726665149030233,
-			 0.8727517289450216,
-			 0.8728369164014823,
-			 0.8729220772698094,
-			 0.8730072115474099,
-			 0.8730923192316901,
-			 0.8731774003200576,
-			 0.8732624548099199,
-			 0.8733474826986874,
-			 0.8734324839837689,
-			 0.8735174586625751,
-			 0.8736024067325184,
-			 0.8736873281910101,
-			 0.8737722230354649,
-			 0.8738570912632957,
-			 0.8739419328719169,
-			 0.8740267478587446,
-			 0.8741115362211945,
-			 0.8741962979566849,
-			 0.8742810330626337,
-			 0.8743657415364585,
-			 0.8744504233755807,
-			 0.8745350785774192,
-			 0.8746197071393959,
-			 0.8747043090589324,
-			 0.8747888843334524,
-			 0.8748734329603797,
-			 0.8749579549371382,
-			 0.8750424502611525,
-			 0.8751269189298500,
-			 0.8752113609406567,
-			 0.8752957762910011,
-			 0.8753801649783116,
-			 0.8754645270000179,
-			 0.8755488623535497,
-			 0.8756331710363372,
-			 0.8757174530458134,
-			 0.8758017083794102,
-			 0.8758859370345619,
-			 0.8759701390087026,
-			 0.8760543142992661,
-			 0.8761384629036901,
-			 0.8762225848194100,
-			 0.8763066800438636,
-			 0.8763907485744888,
-			 0.8764747904087262,
-			 0.8765588055440142,
-			 0.8766427939777938,
-			 0.8767267557075077,
-			 0.8768106907305969,
-			 0.8768945990445053,
-			 0.8769784806466763,
-			 0.8770623355345559,
-			 0.8771461637055887,
-			 0.8772299651572218,
-			 0.8773137398869013,
-			 0.8773974878920765,
-			 0.8774812091701955,
-			 0.8775649037187092,
-			 0.8776485715350668,
-			 0.8777322126167203,
-			 0.8778158269611220,
-			 0.8778994145657237,
-			 0.8779829754279804,
-			 0.8780665095453468,
-			 0.8781500169152769,
-			 0.8782334975352284,
-			 0.8783169514026572,
-			 0.8784003785150226,
-			 0.8784837788697820,
-			 0.8785671524643957,
-			 0.8786504992963231,
-			 0.8787338193630253,
-			 0.8788171126619652,
-			 0.8789003791906046,
-			 0.8789836189464083,
-			 0.8790668319268394,
-			 0.8791500181293641,
-			 0.8792331775514469,
-			 0.8793163101905560,
-			 0.8793994160441587,
-			 0.8794824951097238,
-			 0.8795655473847191,
-			 0.8796485728666167,
-			 0.8797315715528861,
-			 0.8798145434409989,
-			 0.8798974885284286,
-			 0.8799804068126482,
-			 0.8800632982911321,
-			 0.8801461629613549,
-			 0.8802290008207918,
-			 0.8803118118669203,
-			 0.8803945960972173,
-			 0.8804773535091617,
-			 0.8805600841002318,
-			 0.8806427878679087,
-			 0.8807254648096723,
-			 0.8808081149230037,
-			 0.8808907382053857,
-			 0.8809733346543008,
-			 0.8810559042672341,
-			 0.8811384470416694,
-			 0.8812209629750937,
-			 0.8813034520649923,
-			 0.8813859143088523,
-			 0.8814683497041615,
-			 0.8815507582484099,
-			 0.8816331399390865,
-			 0.8817154947736825,
-			 0.8817978227496878,
-			 0.8818801238645962,
-			 0.8819623981158995,
-			 0.8820446455010914,
-			 0.8821268660176674,
-			 0.8822090596631229,
-			 0.8822912264349533,
-			 0.8823733663306566,
-			 0.8824554793477292,
-			 0.8825375654836711,
-			 0.8826196247359812,
-			 0.8827016571021609,
-			 0.8827836625797100,
-			 0.8828656411661306,
-			 0.8829475928589270,
-			 0.8830295176556010,
-			 0.8831114155536579,
-			 0.8831932865506024,
-			 0.8832751306439417,
-			 0.8833569478311816,
-			 0.8834387381098296,
-			 0.8835205014773957,
-			 0.8836022379313879,
-			 0.8836839474693164,
-			 0.8837656300886934,
-			 0.8838472857870294,
-			 0.8839289145618375,
-			 0.8840105164106308,
-			 0.8840920913309247,
-			 0.8841736393202331,
-			 0.8842551603760727,
-			 0.8843366544959590,
-			 0.8844181216774107,
-			 0.8844995619179455,
-			 0.8845809752150838,
-			 0.8846623615663444,
-			 0.8847437209692487,
-			 0.8848250534213179,
-			 0.8849063589200742,
-			 0.8849876374630418,
-			 0.8850688890477439,
-			 0.8851501136717068,
-			 0.8852313113324550,
-			 0.8853124820275160,
-			 0.8853936257544162,
-			 0.8854747425106838,
-			 0.8855558322938487,
-			 0.8856368951014402,
-			 0.8857179309309898,
-			 0.8857989397800284,
-			 0.8858799216460881,
-			 0.8859608765267016,
-			 0.8860418044194042,
-			 0.8861227053217299,
-			 0.8862035792312141,
-			 0.8862844261453944,
-			 0.8863652460618072,
-			 0.8864460389779903,
-			 0.8865268048914826,
-			 0.8866075437998244,
-			 0.8866882557005559,
-			 0.8867689405912192,
-			 0.8868495984693556,
-			 0.8869302293325088,
-			 0.8870108331782218,
-			 0.8870914100040395,
-			 0.8871719598075078,
-			 0.8872524825861726,
-			 0.8873329783375821,
-			 0.8874134470592834,
-			 0.8874938887488248,
-			 0.8875743034037565,
-			 0.8876546910216285,
-			 0.8877350515999928,
-			 0.8878153851364015,
-			 0.8878956916284061,
-			 0.8879759710735623,
-			 0.8880562234694231,
-			 0.8881364488135441,
-			 0.8882166471034824,
-			 0.8882968183367946,
-			 0.8883769625110381,
-			 0.8884570796237714,
-			 0.8885371696725552,
-			 0.8886172326549489,
-			 0.8886972685685132,
-			 0.8887772774108116,
-			 0.8888572591794055,
-			 0.8889372138718585,
-			 0.8890171414857361,
-			 0.8890970420186033,
-			 0.8891769154680254,
-			 0.8892567618315695,
-			 0.8893365811068044,
-			 0.8894163732912975,
-			 0.8894961383826182,
-			 0.8895758763783379,
-			 0.8896555872760266,
-			 0.8897352710732558,
-			 0.8898149277675997,
-			 0.8898945573566306,
-			 0.8899741598379231,
-			 0.8900537352090521,
-			 0.8901332834675946,
-			 0.8902128046111265,
-			 0.8902922986372260,
-			 0.8903717655434705,
-			 0.8904512053274406,
-			 0.8905306179867158,
-			 0.8906100035188769,
-			 0.8906893619215066,
-			 0.8907686931921869,
-			 0.8908479973285007,
-			 0.8909272743280323,
-			 0.8910065241883678,
-			 0.8910857469070920,
-			 0.8911649424817926,
-			 0.8912441109100571,
-			 0.8913232521894735,
-			 0.8914023663176307,
-			 0.8914814532921187,
-			 0.8915605131105291,
-			 0.8916395457704529,
-			 0.8917185512694839,
-			 0.8917975296052140,
-			 0.8918764807752383,
-			 0.8919554047771506,
-			 0.8920343016085481,
-			 0.8921131712670269,
-			 0.8921920137501841,
-			 0.8922708290556193,
-			 0.8923496171809308,
-			 0.8924283781237181,
-			 0.8925071118815822,
-			 0.8925858184521253,
-			 0.8926644978329497,
-			 0.8927431500216587,
-			 0.8928217750158557,
-			 0.8929003728131470,
-			 0.8929789434111371,
-			 0.8930574868074329,
-			 0.8931360029996422,
-			 0.8932144919853729,
-			 0.8932929537622349,
-			 0.8933713883278372,
-			 0.8934497956797913,
-			 0.8935281758157079,
-			 0.8936065287331993,
-			 0.8936848544298799,
-			 0.8937631529033633,
-			 0.8938414241512636,
-			 0.8939196681711973,
-			 0.8939978849607814,
-			 0.8940760745176317,
-			 0.8941542368393679,
-			 0.8942323719236088,
-			 0.8943104797679737,
-			 0.8943885603700832,
-			 0.8944666137275600,
-			 0.8945446398380251,
-			 0.8946226386991021,
-			 0.8947006103084159,
-			 0.8947785546635901,
-			 0.8948564717622507,
-			 0.8949343616020247,
-			 0.8950122241805396,
-			 0.8950900594954228,
-			 0.8951678675443031,
-			 0.8952456483248117,
-			 0.8953234018345780,
-			 0.8954011280712336,
-			 0.8954788270324114,
-			 0.8955564987157448,
-			 0.8956341431188669,
-			 0.8957117602394132,
-			 0.8957893500750184,
-			 0.8958669126233199,
-			 0.8959444478819544,
-			 0.8960219558485607,
-			 0.8960994365207778,
-			 0.8961768898962452,
-			 0.8962543159726027,
-			 0.8963317147474930,
-			 0.8964090862185579,
-			 0.8964864303834401,
-			 0.8965637472397848,
-			 0.8966410367852358,
-			 0.8967182990174393,
-			 0.8967955339340407,
-			 0.8968727415326883,
-			 0.8969499218110295,
-			 0.8970270747667142,
-			 0.8971042003973919,
-			 0.8971812987007131,
-			 0.8972583696743287,
-			 0.8973354133158911,
-			 0.8974124296230541,
-			 0.8974894185934709,
-			 0.8975663802247971,
-			 0.8976433145146882,
-			 0.8977202214608003,
-			 0.8977971010607905,
-			 0.8978739533123166,
-			 0.8979507782130385,
-			 0.8980275757606151,
-			 0.8981043459527083,
-			 0.8981810887869783,
-			 0.8982578042610883,
-			 0.8983344923727000,
-			 0.8984111531194786,
-			 0.8984877864990887,
-			 0.8985643925091961,
-			 0.8986409711474660,
-			 0.8987175224115670,
-			 0.8987940462991671,
-			 0.8988705428079343,
-			 0.8989470119355394,
-			 0.8990234536796523,
-			 0.8990998680379455,
-			 0.8991762550080902,
-			 0.8992526145877602,
-			 0.8993289467746288,
-			 0.8994052515663709,
-			 0.8994815289606626,
-			 0.8995577789551805,
-			 0.8996340015476008,
-			 0.8997101967356027,
-			 0.8997863645168651,
-			 0.8998625048890668,
-			 0.8999386178498896,
-			 0.9000147033970148,
-			 0.9000907615281241,
-			 0.9001667922409003,
-			 0.9002427955330287,
-			 0.9003187714021936,
-			 0.9003947198460798,
-			 0.9004706408623752,
-			 0.9005465344487659,
-			 0.9006224006029404,
-			 0.9006982393225875,
-			 0.9007740506053977,
-			 0.9008498344490617,
-			 0.9009255908512698,
-			 0.9010013198097158,
-			 0.9010770213220917,
-			 0.9011526953860916,
-			 0.9012283419994110,
-			 0.9013039611597456,
-			 0.9013795528647913,
-			 0.9014551171122461,
-			 0.9015306538998070,
-			 0.9016061632251742,
-			 0.9016816450860466,
-			 0.9017570994801261,
-			 0.9018325264051138,
-			 0.9019079258587119,
-			 0.9019832978386227,
-			 0.9020586423425515,
-			 0.9021339593682028,
-			 0.9022092489132819,
-			 0.9022845109754960,
-			 0.9023597455525527,
-			 0.9024349526421597,
-			 0.9025101322420253,
-			 0.9025852843498606,
-			 0.9026604089633758,
-			 0.9027355060802824,
-			 0.9028105756982933,
-			 0.9028856178151219,
-			 0.9029606324284818,
-			 0.9030356195360871,
-			 0.9031105791356550,
-			 0.9031855112249010,
-			 0.9032604158015435,
-			 0.9033352928633007,
-			 0.9034101424078911,
-			 0.9034849644330352,
-			 0.9035597589364527,
-			 0.9036345259158665,
-			 0.9037092653689981,
-			 0.9037839772935721,
-			 0.9038586616873115,
-			 0.9039333185479420,
-			 0.9040079478731884,
-			 0.9040825496607783,
-			 0.9041571239084388,
-			 0.9042316706138989,
-			 0.9043061897748864,
-			 0.9043806813891326,
-			 0.9044551454543682,
-			 0.9045295819683239,
-			 0.9046039909287332,
-			 0.9046783723333290,
-			 0.9047527261798464,
-			 0.9048270524660194,
-			 0.9049013511895841,
-			 0.9049756223482780,
-			 0.9050498659398373,
-			 0.9051240819620014,
-			 0.9051982704125098,
-			 0.9052724312891013,
-			 0.9053465645895181,
-			 0.9054206703115015,
-			 0.9054947484527944,
-			 0.9055687990111394,
-			 0.9056428219842820,
-			 0.9057168173699663,
-			 0.9057907851659385,
-			 0.9058647253699458,
-			 0.9059386379797360,
-			 0.9060125229930566,
-			 0.9060863804076582,
-			 0.9061602102212900,
-			 0.9062340124317033,
-			 0.9063077870366497,
-			 0.9063815340338826,
-			 0.9064552534211555,
-			 0.9065289451962216,
-			 0.9066026093568378,
-			 0.9066762459007589,
-			 0.9067498548257418,
-			 0.9068234361295451,
-			 0.9068969898099268,
-			 0.9069705158646471,
-			 0.9070440142914654,
-			 0.9071174850881424,
-			 0.9071909282524410,
-			 0.9072643437821234,
-			 0.9073377316749538,
-			 0.9074110919286964,
-			 0.9074844245411170,
-			 0.9075577295099811,
-			 0.9076310068330553,
-			 0.9077042565081084,
-			 0.9077774785329084,
-			 0.9078506729052254,
-			 0.9079238396228299,
-			 0.9079969786834919,
-			 0.9080700900849852,
-			 0.9081431738250813,
-			 0.9082162299015545,
-			 0.9082892583121789,
-			 0.9083622590547307,
-			 0.9084352321269862,
-			 0.9085081775267222,
-			 0.9085810952517157,
-			 0.9086539852997468,
-			 0.9087268476685945,
-			 0.9087996823560397,
-			 0.9088724893598640,
-			 0.9089452686778486,
-			 0.9090180203077776,
-			 0.9090907442474334,
-			 0.9091634404946020,
-			 0.9092361090470681,
-			 0.9093087499026193,
-			 0.9093813630590417,
-			 0.9094539485141233,
-			 0.9095265062656542,
-			 0.9095990363114231,
-			 0.9096715386492209,
-			 0.9097440132768395,
-			 0.9098164601920700,
-			 0.9098888793927067,
-			 0.9099612708765428,
-			 0.9100336346413742,
-			 0.9101059706849955,
-			 0.9101782790052038,
-			 0.9102505595997965,
-			 0.9103228124665709,
-			 0.9103950376033271,
-			 0.9104672350078651,
-			 0.9105394046779843,
-			 0.9106115466114876,
-			 0.9106836608061774,
-			 0.9107557472598558,
-			 0.9108278059703280,
-			 0.9108998369353987,
-			 0.9109718401528740,
-			 0.9110438156205595,
-			 0.9111157633362642,
-			 0.9111876832977953,
-			 0.9112595755029620,
-			 0.9113314399495751,
-			 0.9114032766354446,
-			 0.9114750855583836,
-			 0.9115468667162038,
-			 0.9116186201067181,
-			 0.9116903457277414,
-			 0.9117620435770883,
-			 0.9118337136525756,
-			 0.9119053559520192,
-			 0.9119769704732379,
-			 0.9120485572140495,
-			 0.9121201161722732,
-			 0.9121916473457291,
-			 0.9122631507322382,
-			 0.9123346263296230,
-			 0.9124060741357063,
-			 0.9124774941483105,
-			 0.9125488863652614,
-			 0.9126202507843835,
-			 0.9126915874035025,
-			 0.9127628962204464,
-			 0.9128341772330425,
-			 0.9129054304391199,
-			 0.9129766558365077,
-			 0.9130478534230355,
-			 0.9131190231965356,
-			 0.9131901651548393,
-			 0.9132612792957803,
-			 0.9133323656171923,
-			 0.9134034241169088,
-			 0.9134744547927666,
-			 0.9135454576426010,
-			 0.9136164326642493,
-			 0.9136873798555495,
-			 0.9137582992143408,
-			 0.9138291907384630,
-			 0.9139000544257555,
-			 0.9139708902740612,
-			 0.9140416982812212,
-			 0.9141124784450785,
-			 0.9141832307634777,
-			 0.9142539552342637,
-			 0.9143246518552813,
-			 0.9143953206243770,
-			 0.9144659615393992,
-			 0.9145365745981949,
-			 0.9146071597986132,
-			 0.9146777171385049,
-			 0.9147482466157197,
-			 0.9148187482281096,
-			 0.9148892219735272,
-			 0.9149596678498247,
-			 0.9150300858548573,
-			 0.9151004759864800,
-			 0.9151708382425475,
-			 0.9152411726209175,
-			 0.9153114791194467,
-			 0.9153817577359946,
-			 0.9154520084684193,
-			 0.9155222313145812,
-			 0.9155924262723415,
-			 0.9156625933395609,
-			 0.9157327325141031,
-			 0.9158028437938308,
-			 0.9158729271766094,
-			 0.9159429826603029,
-			 0.9160130102427780,
-			 0.9160830099219005,
-			 0.9161529816955392,
-			 0.9162229255615622,
-			 0.9162928415178384,
-			 0.9163627295622394,
-			 0.9164325896926355,
-			 0.9165024219068981,
-			 0.9165722262029002,
-			 0.9166420025785161,
-			 0.9167117510316198,
-			 0.9167814715600872,
-			 0.9168511641617932,
-			 0.9169208288346166,
-			 0.9169904655764338,
-			 0.9170600743851238,
-			 0.9171296552585669,
-			 0.9171992081946428,
-			 0.9172687331912339,
-			 0.9173382302462215,
-			 0.9174076993574884,
-			 0.9174771405229187,
-			 0.9175465537403968,
-			 0.9176159390078090,
-			 0.9176852963230410,
-			 0.9177546256839809,
-			 0.9178239270885163,
-			 0.9178932005345358,
-			 0.9179624460199293,
-			 0.9180316635425879,
-			 0.9181008531004029,
-			 0.9181700146912671,
-			 0.9182391483130725,
-			 0.9183082539637147,
-			 0.9183773316410877,
-			 0.9184463813430869,
-			 0.9185154030676099,
-			 0.9185843968125541,
-			 0.9186533625758168,
-			 0.9187223003552982,
-			 0.9187912101488983,
-			 0.9188600919545175,
-			 0.9189289457700572,
-			 0.9189977715934210,
-			 0.9190665694225122,
-			 0.9191353392552342,
-			 0.9192040810894933,
-			 0.9192727949231945,
-			 0.9193414807542452,
-			 0.9194101385805525,
-			 0.9194787684000263,
-			 0.9195473702105748,
-			 0.9196159440101083,
-			 0.9196844897965389,
-			 0.9197530075677777,
-			 0.9198214973217372,
-			 0.9198899590563325,
-			 0.9199583927694770,
-			 0.9200267984590863,
-			 0.9200951761230765,
-			 0.9201635257593654,
-			 0.9202318473658703,
-			 0.9203001409405105,
-			 0.9203684064812045,
-			 0.9204366439858742,
-			 0.9205048534524399,
-			 0.9205730348788248,
-			 0.9206411882629518,
-			 0.9207093136027442,
-			 0.9207774108961274,
-			 0.9208454801410262,
-			 0.9209135213353679,
-			 0.9209815344770793,
-			 0.9210495195640895,
-			 0.9211174765943267,
-			 0.9211854055657215,
-			 0.9212533064762037,
-			 0.9213211793237053,
-			 0.9213890241061591,
-			 0.9214568408214980,
-			 0.9215246294676571,
-			 0.9215923900425708,
-			 0.9216601225441746,
-			 0.9217278269704053,
-			 0.9217955033192012,
-			 0.9218631515885004,
-			 0.9219307717762418,
-			 0.9219983638803667,
-			 0.9220659278988155,
-			 0.9221334638295295,
-			 0.9222009716704517,
-			 0.9222684514195262,
-			 0.9223359030746968,
-			 0.9224033266339096,
-			 0.9224707220951105,
-			 0.9225380894562465,
-			 0.9226054287152650,
-			 0.9226727398701147,
-			 0.9227400229187458,
-			 0.9228072778591082,
-			 0.9228745046891541,
-			 0.9229417034068348,
-			 0.9230088740101038,
-			 0.9230760164969141,
-			 0.9231431308652213,
-			 0.9232102171129807,
-			 0.9232772752381491,
-			 0.9233443052386827,
-			 0.9234113071125412,
-			 0.9234782808576824,
-			 0.9235452264720662,
-			 0.9236121439536540,
-			 0.9236790333004075,
-			 0.9237458945102882,
-			 0.9238127275812597,
-			 0.9238795325112868,
-			 0.9239463092983339,
-			 0.9240130579403665,
-			 0.9240797784353523,
-			 0.9241464707812586,
-			 0.9242131349760530,
-			 0.9242797710177058,
-			 0.9243463789041870,
-			 0.9244129586334671,
-			 0.9244795102035179,
-			 0.9245460336123131,
-			 0.9246125288578254,
-			 0.9246789959380292,
-			 0.9247454348509003,
-			 0.9248118455944150,
-			 0.9248782281665493,
-			 0.9249445825652824,
-			 0.9250109087885920,
-			 0.9250772068344580,
-			 0.9251434767008606,
-			 0.9252097183857821,
-			 0.9252759318872036,
-			 0.9253421172031088,
-			 0.9254082743314805,
-			 0.9254744032703046,
-			 0.9255405040175664,
-			 0.9256065765712518,
-			 0.9256726209293492,
-			 0.9257386370898458,
-			 0.9258046250507314,
-			 0.9258705848099947,
-			 0.9259365163656276,
-			 0.9260024197156209,
-			 0.9260682948579679,
-			 0.9261341417906619,
-			 0.9261999605116966,
-			 0.9262657510190669,
-			 0.9263315133107686,
-			 0.9263972473847992,
-			 0.9264629532391555,
-			 0.9265286308718369,
-			 0.9265942802808426,
-			 0.9266599014641724,
-			 0.9267254944198269,
-			 0.9267910591458088,
-			 0.9268565956401207,
-			 0.9269221039007659,
-			 0.9269875839257499,
-			 0.9270530357130770,
-			 0.9271184592607541,
-			 0.9271838545667873,
-			 0.9272492216291855,
-			 0.9273145604459571,
-			 0.9273798710151121,
-			 0.9274451533346612,
-			 0.9275104074026154,
-			 0.9275756332169866,
-			 0.9276408307757880,
-			 0.9277060000770341,
-			 0.9277711411187392,
-			 0.9278362538989198,
-			 0.9279013384155916,
-			 0.9279663946667728,
-			 0.9280314226504808,
-			 0.9280964223647347,
-			 0.9281613938075554,
-			 0.9282263369769634,
-			 0.9282912518709798,
-			 0.9283561384876280,
-			 0.9284209968249314,
-			 0.9284858268809133,
-			 0.9285506286536001,
-			 0.9286154021410175,
-			 0.9286801473411919,
-			 0.9287448642521510,
-			 0.9288095528719240,
-			 0.9288742131985406,
-			 0.9289388452300299,
-			 0.9290034489644242,
-			 0.9290680243997556,
-			 0.9291325715340559,
-			 0.9291970903653600,
-			 0.9292615808917024,
-			 0.9293260431111181,
-			 0.9293904770216435,
-			 0.9294548826213166,
-			 0.9295192599081746,
-			 0.9295836088802566,
-			 0.9296479295356028,
-			 0.9297122218722542,
-			 0.9297764858882515,
-			 0.9298407215816377,
-			 0.9299049289504552,
-			 0.9299691079927491,
-			 0.9300332587065637,
-			 0.9300973810899457,
-			 0.9301614751409415,
-			 0.9302255408575986,
-			 0.9302895782379647,
-			 0.9303535872800900,
-			 0.9304175679820246,
-			 0.9304815203418190,
-			 0.9305454443575257,
-			 0.9306093400271976,
-			 0.9306732073488881,
-			 0.9307370463206508,
-			 0.9308008569405423,
-			 0.9308646392066179,
-			 0.9309283931169354,
-			 0.9309921186695528,
-			 0.9310558158625283,
-			 0.9311194846939221,
-			 0.9311831251617939,
-			 0.9312467372642059,
-			 0.9313103209992198,
-			 0.9313738763648995,
-			 0.9314374033593089,
-			 0.9315009019805125,
-			 0.9315643722265754,
-			 0.9316278140955652,
-			 0.9316912275855489,
-			 0.9317546126945946,
-			 0.9318179694207723,
-			 0.9318812977621513,
-			 0.9319445977168032,
-			 0.9320078692827984,
-			 0.9320711124582108,
-			 0.9321343272411137,
-			 0.9321975136295808,
-			 0.9322606716216886,
-			 0.9323238012155121,
-			 0.9323869024091289,
-			 0.9324499752006159,
-			 0.9325130195880527,
-			 0.9325760355695183,
-			 0.9326390231430940,
-			 0.9327019823068602,
-			 0.9327649130588993,
-			 0.9328278153972948,
-			 0.9328906893201294,
-			 0.9329535348254889,
-			 0.9330163519114590,
-			 0.9330791405761252,
-			 0.9331419008175756,
-			 0.9332046326338987,
-			 0.9332673360231826,
-			 0.9333300109835179,
-			 0.9333926575129957,
-			 0.9334552756097070,
-			 0.9335178652717443,
-			 0.9335804264972015,
-			 0.9336429592841732,
-			 0.9337054636307534,
-			 0.9337679395350389,
-			 0.9338303869951269,
-			 0.9338928060091143,
-			 0.9339551965750998,
-			 0.9340175586911834,
-			 0.9340798923554656,
-			 0.9341421975660466,
-			 0.9342044743210296,
-			 0.9342667226185167,
-			 0.9343289424566118,
-			 0.9343911338334201,
-			 0.9344532967470468,
-			 0.9345154311955988,
-			 0.9345775371771827,
-			 0.9346396146899064,
-			 0.9347016637318797,
-			 0.9347636843012118,
-			 0.9348256763960142,
-			 0.9348876400143984,
-			 0.9349495751544760,
-			 0.9350114818143614,
-			 0.9350733599921682,
-			 0.9351352096860117,
-			 0.9351970308940075,
-			 0.9352588236142729,
-			 0.9353205878449258,
-			 0.9353823235840844,
-			 0.9354440308298674,
-			 0.9355057095803960,
-			 0.9355673598337909,
-			 0.9356289815881746,
-			 0.9356905748416698,
-			 0.9357521395924006,
-			 0.9358136758384912,
-			 0.9358751835780664,
-			 0.9359366628092537,
-			 0.9359981135301797,
-			 0.9360595357389729,
-			 0.9361209294337626,
-			 0.9361822946126777,
-			 0.9362436312738498,
-			 0.9363049394154094,
-			 0.9363662190354898,
-			 0.9364274701322238,
-			 0.9364886927037467,
-			 0.9365498867481923,
-			 0.9366110522636967,
-			 0.9366721892483976,
-			 0.9367332977004317,
-			 0.9367943776179378,
-			 0.9368554289990551,
-			 0.9369164518419247,
-			 0.9369774461446869,
-			 0.9370384119054842,
-			 0.9370993491224587,
-			 0.9371602577937550,
-			 0.9372211379175172,
-			 0.9372819894918915,
-			 0.9373428125150234,
-			 0.9374036069850604,
-			 0.9374643729001512,
-			 0.9375251102584434,
-			 0.9375858190580881,
-			 0.9376464992972359,
-			 0.9377071509740373,
-			 0.9377677740866459,
-			 0.9378283686332145,
-			 0.9378889346118978,
-			 0.9379494720208498,
-			 0.9380099808582277,
-			 0.9380704611221873,
-			 0.9381309128108863,
-			 0.9381913359224839,
-			 0.9382517304551390,
-			 0.9383120964070125,
-			 0.9383724337762649,
-			 0.9384327425610586,
-			 0.9384930227595560,
-			 0.9385532743699210,
-			 0.9386134973903186,
-			 0.9386736918189145,
-			 0.9387338576538738,
-			 0.9387939948933655,
-			 0.9388541035355564,
-			 0.9389141835786157,
-			 0.9389742350207136,
-			 0.9390342578600209,
-			 0.9390942520947092,
-			 0.9391542177229508,
-			 0.9392141547429184,
-			 0.9392740631527872,
-			 0.9393339429507315,
-			 0.9393937941349280,
-			 0.9394536167035529,
-			 0.9395134106547848,
-			 0.9395731759868017,
-			 0.9396329126977827,
-			 0.9396926207859084,
-			 0.9397523002493597,
-			 0.9398119510863194,
-			 0.9398715732949696,
-			 0.9399311668734952,
-			 0.9399907318200802,
-			 0.9400502681329097,
-			 0.9401097758101706,
-			 0.9401692548500500,
-			 0.9402287052507363,
-			 0.9402881270104190,
-			 0.9403475201272866,
-			 0.9404068845995315,
-			 0.9404662204253442,
-			 0.9405255276029174,
-			 0.9405848061304450,
-			 0.9406440560061214,
-			 0.9407032772281410,
-			 0.9407624697947004,
-			 0.9408216337039956,
-			 0.9408807689542255,
-			 0.9409398755435878,
-			 0.9409989534702832,
-			 0.9410580027325109,
-			 0.9411170233284724,
-			 0.9411760152563706,
-			 0.9412349785144076,
-			 0.9412939131007877,
-			 0.9413528190137153,
-			 0.9414116962513968,
-			 0.9414705448120378,
-			 0.9415293646938460,
-			 0.9415881558950301,
-			 0.9416469184137986,
-			 0.9417056522483617,
-			 0.9417643573969305,
-			 0.9418230338577160,
-			 0.9418816816289316,
-			 0.9419403007087902,
-			 0.9419988910955072,
-			 0.9420574527872967,
-			 0.9421159857823754,
-			 0.9421744900789597,
-			 0.9422329656752680,
-			 0.9422914125695190,
-			 0.9423498307599325,
-			 0.9424082202447280,
-			 0.9424665810221281,
-			 0.9425249130903542,
-			 0.9425832164476294,
-			 0.9426414910921783,
-			 0.9426997370222250,
-			 0.9427579542359962,
-			 0.9428161427317177,
-			 0.9428743025076174,
-			 0.9429324335619232,
-			 0.9429905358928643,
-			 0.9430486094986714,
-			 0.9431066543775748,
-			 0.9431646705278074,
-			 0.9432226579476011,
-			 0.9432806166351894,
-			 0.9433385465888068,
-			 0.9433964478066891,
-			 0.9434543202870722,
-			 0.9435121640281932,
-			 0.9435699790282905,
-			 0.9436277652856029,
-			 0.9436855227983694,
-			 0.9437432515648309,
-			 0.9438009515832292,
-			 0.9438586228518067,
-			 0.9439162653688066,
-			 0.9439738791324722,
-			 0.9440314641410498,
-			 0.9440890203927843,
-			 0.9441465478859224,
-			 0.9442040466187124,
-			 0.9442615165894022,
-			 0.9443189577962418,
-			 0.9443763702374811,
-			 0.9444337539113709,
-			 0.9444911088161634,
-			 0.9445484349501113,
-			 0.9446057323114687,
-			 0.9446630008984905,
-			 0.9447202407094312,
-			 0.9447774517425483,
-			 0.9448346339960982,
-			 0.9448917874683391,
-			 0.9449489121575306,
-			 0.9450060080619325,
-			 0.9450630751798048,
-			 0.9451201135094095,
-			 0.9451771230490098,
-			 0.9452341037968682,
-			 0.9452910557512491,
-			 0.9453479789104183,
-			 0.9454048732726411,
-			 0.9454617388361847,
-			 0.9455185755993165,
-			 0.9455753835603061,
-			 0.9456321627174221,
-			 0.9456889130689350,
-			 0.9457456346131168,
-			 0.9458023273482389,
-			 0.9458589912725743,
-			 0.9459156263843980,
-			 0.9459722326819835,
-			 0.9460288101636071,
-			 0.9460853588275455,
-			 0.9461418786720754,
-			 0.9461983696954759,
-			 0.9462548318960254,
-			 0.9463112652720052,
-			 0.9463676698216951,
-			 0.9464240455433776,
-			 0.9464803924353345,
-			 0.9465367104958503,
-			 0.9465929997232091,
-			 0.9466492601156959,
-			 0.9467054916715980,
-			 0.9467616943892017,
-			 0.9468178682667947,
-			 0.9468740133026659,
-			 0.9469301294951056,
-			 0.9469862168424038,
-			 0.9470422753428525,
-			 0.9470983049947441,
-			 0.9471543057963717,
-			 0.9472102777460290,
-			 0.9472662208420110,
-			 0.9473221350826141,
-			 0.9473780204661345,
-			 0.9474338769908708,
-			 0.9474897046551206,
-			 0.9475455034571838,
-			 0.9476012733953603,
-			 0.9476570144679509,
-			 0.9477127266732585,
-			 0.9477684100095852,
-			 0.9478240644752359,
-			 0.9478796900685146,
-			 0.9479352867877265,
-			 0.9479908546311782,
-			 0.9480463935971772,
-			 0.9481019036840318,
-			 0.9481573848900512,
-			 0.9482128372135444,
-			 0.9482682606528235,
-			 0.9483236552061994,
-			 0.9483790208719846,
-			 0.9484343576484930,
-			 0.9484896655340386,
-			 0.9485449445269373,
-			 0.9486001946255045,
-			 0.9486554158280576,
-			 0.9487106081329140,
-			 0.9487657715383925,
-			 0.9488209060428132,
-			 0.9488760116444966,
-			 0.9489310883417633,
-			 0.9489861361329364,
-			 0.9490411550163390,
-			 0.9490961449902946,
-			 0.9491511060531281,
-			 0.9492060382031663,
-			 0.9492609414387347,
-			 0.9493158157581610,
-			 0.9493706611597746,
-			 0.9494254776419039,
-			 0.9494802652028790,
-			 0.9495350238410318,
-			 0.9495897535546937,
-			 0.9496444543421975,
-			 0.9496991262018767,
-			 0.9497537691320669,
-			 0.9498083831311025,
-			 0.9498629681973201,
-			 0.9499175243290577,
-			 0.9499720515246525,
-			 0.9500265497824436,
-			 0.9500810191007715,
-			 0.9501354594779767,
-			 0.9501898709124006,
-			 0.9502442534023862,
-			 0.9502986069462760,
-			 0.9503529315424153,
-			 0.9504072271891485,
-			 0.9504614938848223,
-			 0.9505157316277837,
-			 0.9505699404163802,
-			 0.9506241202489599,
-			 0.9506782711238734,
-			 0.9507323930394708,
-			 0.9507864859941030,
-			 0.9508405499861233,
-			 0.9508945850138839,
-			 0.9509485910757393,
-			 0.9510025681700437,
-			 0.9510565162951535,
-			 0.9511104354494252,
-			 0.9511643256312160,
-			 0.9512181868388853,
-			 0.9512720190707915,
-			 0.9513258223252948,
-			 0.9513795966007561,
-			 0.9514333418955381,
-			 0.9514870582080028,
-			 0.9515407455365146,
-			 0.9515944038794381,
-			 0.9516480332351385,
-			 0.9517016336019818,
-			 0.9517552049783353,
-			 0.9518087473625677,
-			 0.9518622607530474,
-			 0.9519157451481451,
-			 0.9519692005462308,
-			 0.9520226269456767,
-			 0.9520760243448546,
-			 0.9521293927421386,
-			 0.9521827321359028,
-			 0.9522360425245225,
-			 0.9522893239063732,
-			 0.9523425762798325,
-			 0.9523957996432785,
-			 0.9524489939950888,
-			 0.9525021593336439,
-			 0.9525552956573241,
-			 0.9526084029645110,
-			 0.9526614812535861,
-			 0.9527145305229335,
-			 0.9527675507709366,
-			 0.9528205419959801,
-			 0.9528735041964506,
-			 0.9529264373707345,
-			 0.9529793415172186,
-			 0.9530322166342924,
-			 0.9530850627203449,
-			 0.9531378797737661,
-			 0.9531906677929468,
-			 0.9532434267762799,
-			 0.9532961567221577,
-			 0.9533488576289736,
-			 0.9534015294951230,
-			 0.9534541723190013,
-			 0.9535067860990042,
-			 0.9535593708335299,
-			 0.9536119265209760,
-			 0.9536644531597417,
-			 0.9537169507482267,
-			 0.9537694192848324,
-			 0.9538218587679604,
-			 0.9538742691960126,
-			 0.9539266505673936,
-			 0.9539790028805069,
-			 0.9540313261337577,
-			 0.9540836203255528,
-			 0.9541358854542992,
-			 0.9541881215184042,
-			 0.9542403285162772,
-			 0.9542925064463270,
-			 0.9543446553069651,
-			 0.9543967750966024,
-			 0.9544488658136516,
-			 0.9545009274565261,
-			 0.9545529600236399,
-			 0.9546049635134073,
-			 0.9546569379242446,
-			 0.9547088832545688,
-			 0.9547607995027971,
-			 0.9548126866673488,
-			 0.9548645447466430,
-			 0.9549163737390998,
-			 0.9549681736431401,
-			 0.9550199444571866,
-			 0.9550716861796620,
-			 0.9551233988089900,
-			 0.9551750823435957,
-			 0.9552267367819050,
-			 0.9552783621223438,
-			 0.9553299583633393,
-			 0.9553815255033205,
-			 0.9554330635407158,
-			 0.9554845724739561,
-			 0.9555360523014722,
-			 0.9555875030216954,
-			 0.9556389246330590,
-			 0.9556903171339959,
-			 0.9557416805229412,
-			 0.9557930147983298,
-			 0.9558443199585989,
-			 0.9558955960021847,
-			 0.9559468429275257,
-			 0.9559980607330606,
-			 0.9560492494172290,
-			 0.9561004089784723,
-			 0.9561515394152318,
-			 0.9562026407259494,
-			 0.9562537129090694,
-			 0.9563047559630357,
-			 0.9563557698862928,
-			 0.9564067546772875,
-			 0.9564577103344666,
-			 0.9565086368562780,
-			 0.9565595342411697,
-			 0.9566104024875920,
-			 0.9566612415939953,
-			 0.9567120515588303,
-			 0.9567628323805500,
-			 0.9568135840576075,
-			 0.9568643065884560,
-			 0.9569149999715513,
-			 0.9569656642053488,
-			 0.9570162992883054,
-			 0.9570669052188781,
-			 0.9571174819955262,
-			 0.9571680296167083,
-			 0.9572185480808848,
-			 0.9572690373865171,
-			 0.9573194975320674,
-			 0.9573699285159976,
-			 0.9574203303367728,
-			 0.9574707029928566,
-			 0.9575210464827151,
-			 0.9575713608048142,
-			 0.9576216459576220,
-			 0.9576719019396067,
-			 0.9577221287492366,
-			 0.9577723263849826,
-			 0.9578224948453149,
-			 0.9578726341287057,
-			 0.9579227442336272,
-			 0.9579728251585536,
-			 0.9580228769019593,
-			 0.9580728994623194,
-			 0.9581228928381097,
-			 0.9581728570278079,
-			 0.9582227920298915,
-			 0.9582726978428401,
-			 0.9583225744651330,
-			 0.9583724218952513,
-			 0.9584222401316762,
-			 0.9584720291728897,
-			 0.9585217890173758,
-			 0.9585715196636184,
-			 0.9586212211101031,
-			 0.9586708933553157,
-			 0.9587205363977426,
-			 0.9587701502358723,
-			 0.9588197348681931,
-			 0.9588692902931945,
-			 0.9589188165093667,
-			 0.9589683135152017,
-			 0.9590177813091918,
-			 0.9590672198898297,
-			 0.9591166292556090,
-			 0.9591660094050254,
-			 0.9592153603365743,
-			 0.9592646820487521,
-			 0.9593139745400575,
-			 0.9593632378089878,
-			 0.9594124718540430,
-			 0.9594616766737226,
-			 0.9595108522665285,
-			 0.9595599986309623,
-			 0.9596091157655275,
-			 0.9596582036687273,
-			 0.9597072623390666,
-			 0.9597562917750512,
-			 0.9598052919751868,
-			 0.9598542629379816,
-			 0.9599032046619439,
-			 0.9599521171455819,
-			 0.9600010003874065,
-			 0.9600498543859284,
-			 0.9600986791396597,
-			 0.9601474746471126,
-			 0.9601962409068010,
-			 0.9602449779172396,
-			 0.9602936856769430,
-			 0.9603423641844282,
-			 0.9603910134382124,
-			 0.9604396334368130,
-			 0.9604882241787496,
-			 0.9605367856625421,
-			 0.9605853178867104,
-			 0.9606338208497769,
-			 0.9606822945502640,
-			 0.9607307389866951,
-			 0.9607791541575940,
-			 0.9608275400614867,
-			 0.9608758966968987,
-			 0.9609242240623568,
-			 0.9609725221563895,
-			 0.9610207909775252,
-			 0.9610690305242939,
-			 0.9611172407952259,
-			 0.9611654217888520,
-			 0.9612135735037054,
-			 0.9612616959383187,
-			 0.9613097890912266,
-			 0.9613578529609635,
-			 0.9614058875460663,
-			 0.9614538928450709,
-			 0.9615018688565149,
-			 0.9615498155789373,
-			 0.9615977330108770,
-			 0.9616456211508750,
-			 0.9616934799974727,
-			 0.9617413095492111,
-			 0.9617891098046346,
-			 0.9618368807622861,
-			 0.9618846224207107,
-			 0.9619323347784544,
-			 0.9619800178340635,
-			 0.9620276715860859,
-			 0.9620752960330696,
-			 0.9621228911735635,
-			 0.9621704570061185,
-			 0.9622179935292852,
-			 0.9622655007416158,
-			 0.9623129786416633,
-			 0.9623604272279811,
-			 0.9624078464991241,
-			 0.9624552364536473,
-			 0.9625025970901077,
-			 0.9625499284070621,
-			 0.9625972304030693,
-			 0.9626445030766884,
-			 0.9626917464264785,
-			 0.9627389604510017,
-			 0.9627861451488189,
-			 0.9628333005184929,
-			 0.9628804265585873,
-			 0.9629275232676672,
-			 0.9629745906442970,
-			 0.9630216286870432,
-			 0.9630686373944737,
-			 0.9631156167651556,
-			 0.9631625667976579,
-			 0.9632094874905511,
-			 0.9632563788424053,
-			 0.9633032408517924,
-			 0.9633500735172850,
-			 0.9633968768374558,
-			 0.9634436508108798,
-			 0.9634903954361322,
-			 0.9635371107117885,
-			 0.9635837966364261,
-			 0.9636304532086226,
-			 0.9636770804269575,
-			 0.9637236782900096,
-			 0.9637702467963598,
-			 0.9638167859445896,
-			 0.9638632957332809,
-			 0.9639097761610174,
-			 0.9639562272263829,
-			 0.9640026489279631,
-			 0.9640490412643431,
-			 0.9640954042341102,
-			 0.9641417378358519,
-			 0.9641880420681564,
-			 0.9642343169296139,
-			 0.9642805624188143,
-			 0.9643267785343496,
-			 0.9643729652748114,
-			 0.9644191226387926,
-			 0.9644652506248872,
-			 0.9645113492316905,
-			 0.9645574184577980,
-			 0.9646034583018066,
-			 0.9646494687623131,
-			 0.9646954498379170,
-			 0.9647414015272169,
-			 0.9647873238288128,
-			 0.9648332167413066,
-			 0.9648790802632998,
-			 0.9649249143933959,
-			 0.9649707191301984,
-			 0.9650164944723115,
-			 0.9650622404183413,
-			 0.9651079569668940,
-			 0.9651536441165774,
-			 0.9651993018659994,
-			 0.9652449302137699,
-			 0.9652905291584983,
-			 0.9653360986987957,
-			 0.9653816388332739,
-			 0.9654271495605456,
-			 0.9654726308792249,
-			 0.9655180827879263,
-			 0.9655635052852646,
-			 0.9656088983698570,
-			 0.9656542620403202,
-			 0.9656995962952722,
-			 0.9657449011333327,
-			 0.9657901765531215,
-			 0.9658354225532589,
-			 0.9658806391323668,
-			 0.9659258262890683,
-			 0.9659709840219864,
-			 0.9660161123297455,
-			 0.9660612112109713,
-			 0.9661062806642902,
-			 0.9661513206883283,
-			 0.9661963312817148,
-			 0.9662413124430776,
-			 0.9662862641710471,
-			 0.9663311864642536,
-			 0.9663760793213293,
-			 0.9664209427409061,
-			 0.9664657767216174,
-			 0.9665105812620980,
-			 0.9665553563609826,
-			 0.9666001020169070,
-			 0.9666448182285092,
-			 0.9666895049944262,
-			 0.9667341623132969,
-			 0.9667787901837609,
-			 0.9668233886044594,
-			 0.9668679575740331,
-			 0.9669124970911248,
-			 0.9669570071543772,
-			 0.9670014877624350,
-			 0.9670459389139431,
-			 0.9670903606075472,
-			 0.9671347528418947,
-			 0.9671791156156327,
-			 0.9672234489274105,
-			 0.9672677527758767,
-			 0.9673120271596826,
-			 0.9673562720774788,
-			 0.9674004875279184,
-			 0.9674446735096539,
-			 0.9674888300213396,
-			 0.9675329570616301,
-			 0.9675770546291811,
-			 0.9676211227226499,
-			 0.9676651613406935,
-			 0.9677091704819711,
-			 0.9677531501451418,
-			 0.9677971003288656,
-			 0.9678410210318037,
-			 0.9678849122526185,
-			 0.9679287739899731,
-			 0.9679726062425309,
-			 0.9680164090089575,
-			 0.9680601822879180,
-			 0.9681039260780789,
-			 0.9681476403781076,
-			 0.9681913251866731,
-			 0.9682349805024443,
-			 0.9682786063240911,
-			 0.9683222026502855,
-			 0.9683657694796988,
-			 0.9684093068110037,
-			 0.9684528146428741,
-			 0.9684962929739850,
-			 0.9685397418030116,
-			 0.9685831611286310,
-			 0.9686265509495199,
-			 0.9686699112643570,
-			 0.9687132420718211,
-			 0.9687565433705921,
-			 0.9687998151593518,
-			 0.9688430574367816,
-			 0.9688862702015638,
-			 0.9689294534523830,
-			 0.9689726071879230,
-			 0.9690157314068694,
-			 0.9690588261079088,
-			 0.9691018912897286,
-			 0.9691449269510165,
-			 0.9691879330904616,
-			 0.9692309097067544,
-			 0.9692738567985852,
-			 0.9693167743646457,
-			 0.9693596624036291,
-			 0.9694025209142288,
-			 0.9694453498951386,
-			 0.9694881493450548,
-			 0.9695309192626732,
-			 0.9695736596466910,
-			 0.9696163704958057,
-			 0.9696590518087175,
-			 0.9697017035841251,
-			 0.9697443258207296,
-			 0.9697869185172330,
-			 0.9698294816723376,
-			 0.9698720152847468,
-			 0.9699145193531651,
-			 0.9699569938762973,
-			 0.9699994388528501,
-			 0.9700418542815301,
-			 0.9700842401610459,
-			 0.9701265964901058,
-			 0.9701689232674199,
-			 0.9702112204916983,
-			 0.9702534881616530,
-			 0.9702957262759965,
-			 0.9703379348334417,
-			 0.9703801138327036,
-			 0.9704222632724967,
-			 0.9704643831515376,
-			 0.9705064734685425,
-			 0.9705485342222298,
-			 0.9705905654113179,
-			 0.9706325670345270,
-			 0.9706745390905777,
-			 0.9707164815781909,
-			 0.9707583944960891,
-			 0.9708002778429954,
-			 0.9708421316176343,
-			 0.9708839558187308,
-			 0.9709257504450108,
-			 0.9709675154952014,
-			 0.9710092509680303,
-			 0.9710509568622258,
-			 0.9710926331765173,
-			 0.9711342799096360,
-			 0.9711758970603126,
-			 0.9712174846272802,
-			 0.9712590426092712,
-			 0.9713005710050201,
-			 0.9713420698132613,
-			 0.9713835390327313,
-			 0.9714249786621667,
-			 0.9714663887003048,
-			 0.9715077691458850,
-			 0.9715491199976463,
-			 0.9715904412543288,
-			 0.9716317329146739,
-			 0.9716729949774240,
-			 0.9717142274413220,
-			 0.9717554303051124,
-			 0.9717966035675395,
-			 0.9718377472273495,
-			 0.9718788612832886,
-			 0.9719199457341046,
-			 0.9719610005785461,
-			 0.9720020258153628,
-			 0.9720430214433041,
-			 0.9720839874611221,
-			 0.9721249238675688,
-			 0.9721658306613965,
-			 0.9722067078413598,
-			 0.9722475554062134,
-			 0.9722883733547129,
-			 0.9723291616856145,
-			 0.9723699203976764,
-			 0.9724106494896571,
-			 0.9724513489603150,
-			 0.9724920188084112,
-			 0.9725326590327066,
-			 0.9725732696319631,
-			 0.9726138506049433,
-			 0.9726544019504120,
-			 0.9726949236671331,
-			 0.9727354157538722,
-			 0.9727758782093966,
-			 0.9728163110324730,
-			 0.9728567142218699,
-			 0.9728970877763569,
-			 0.9729374316947040,
-			 0.9729777459756820,
-			 0.9730180306180632,
-			 0.9730582856206200,
-			 0.9730985109821265,
-			 0.9731387067013573,
-			 0.9731788727770880,
-			 0.9732190092080953,
-			 0.9732591159931564,
-			 0.9732991931310491,
-			 0.9733392406205531,
-			 0.9733792584604485,
-			 0.9734192466495158,
-			 0.9734592051865375,
-			 0.9734991340702964,
-			 0.9735390332995759,
-			 0.9735789028731603,
-			 0.9736187427898355,
-			 0.9736585530483879,
-			 0.9736983336476046,
-			 0.9737380845862743,
-			 0.9737778058631857,
-			 0.9738174974771291,
-			 0.9738571594268948,
-			 0.9738967917112752,
-			 0.9739363943290626,
-			 0.9739759672790513,
-			 0.9740155105600357,
-			 0.9740550241708109,
-			 0.9740945081101732,
-			 0.9741339623769198,
-			 0.9741733869698492,
-			 0.9742127818877603,
-			 0.9742521471294533,
-			 0.9742914826937287,
-			 0.9743307885793886,
-			 0.9743700647852351,
-			 0.9744093113100725,
-			 0.9744485281527048,
-			 0.9744877153119373,
-			 0.9745268727865770,
-			 0.9745660005754305,
-			 0.9746050986773062,
-			 0.9746441670910124,
-			 0.9746832058153598,
-			 0.9747222148491589,
-			 0.9747611941912216,
-			 0.9748001438403604,
-			 0.9748390637953888,
-			 0.9748779540551213,
-			 0.9749168146183729,
-			 0.9749556454839603,
-			 0.9749944466507006,
-			 0.9750332181174113,
-			 0.9750719598829121,
-			 0.9751106719460226,
-			 0.9751493543055633,
-			 0.9751880069603559,
-			 0.9752266299092235,
-			 0.9752652231509890,
-			 0.9753037866844768,
-			 0.9753423205085126,
-			 0.9753808246219224,
-			 0.9754192990235331,
-			 0.9754577437121730,
-			 0.9754961586866711,
-			 0.9755345439458566,
-			 0.9755728994885606,
-			 0.9756112253136149,
-			 0.9756495214198520,
-			 0.9756877878061048,
-			 0.9757260244712085,
-			 0.9757642314139976,
-			 0.9758024086333084,
-			 0.9758405561279782,
-			 0.9758786738968448,
-			 0.9759167619387474,
-			 0.9759548202525254,
-			 0.9759928488370193,
-			 0.9760308476910711,
-			 0.9760688168135229,
-			 0.9761067562032185,
-			 0.9761446658590023,
-			 0.9761825457797190,
-			 0.9762203959642151,
-			 0.9762582164113370,
-			 0.9762960071199334,
-			 0.9763337680888525,
-			 0.9763714993169447,
-			 0.9764092008030604,
-			 0.9764468725460510,
-			 0.9764845145447686,
-			 0.9765221267980672,
-			 0.9765597093048008,
-			 0.9765972620638244,
-			 0.9766347850739944,
-			 0.9766722783341679,
-			 0.9767097418432025,
-			 0.9767471755999566,
-			 0.9767845796032906,
-			 0.9768219538520646,
-			 0.9768592983451406,
-			 0.9768966130813810,
-			 0.9769338980596487,
-			 0.9769711532788082,
-			 0.9770083787377244,
-			 0.9770455744352636,
-			 0.9770827403702925,
-			 0.9771198765416795,
-			 0.9771569829482929,
-			 0.9771940595890023,
-			 0.9772311064626789,
-			 0.9772681235681934,
-			 0.9773051109044186,
-			 0.9773420684702276,
-			 0.9773789962644952,
-			 0.9774158942860958,
-			 0.9774527625339059,
-			 0.9774896010068019,
-			 0.9775264097036621,
-			 0.9775631886233651,
-			 0.9775999377647908,
-			 0.9776366571268191,
-			 0.9776733467083321,
-			 0.9777100065082120,
-			 0.9777466365253419,
-			 0.9777832367586061,
-			 0.9778198072068900,
-			 0.9778563478690788,
-			 0.9778928587440602,
-			 0.9779293398307217,
-			 0.9779657911279522,
-			 0.9780022126346409,
-			 0.9780386043496790,
-			 0.9780749662719573,
-			 0.9781112984003683,
-			 0.9781476007338056,
-			 0.9781838732711629,
-			 0.9782201160113358,
-			 0.9782563289532199,
-			 0.9782925120957123,
-			 0.9783286654377107,
-			 0.9783647889781134,
-			 0.9784008827158207,
-			 0.9784369466497330,
-			 0.9784729807787513,
-			 0.9785089851017784,
-			 0.9785449596177173,
-			 0.9785809043254722,
-			 0.9786168192239478,
-			 0.9786527043120509,
-			 0.9786885595886878,
-			 0.9787243850527666,
-			 0.9787601807031954,
-			 0.9787959465388842,
-			 0.9788316825587435,
-			 0.9788673887616849,
-			 0.9789030651466205,
-			 0.9789387117124637,
-			 0.9789743284581286,
-			 0.9790099153825298,
-			 0.9790454724845838,
-			 0.9790809997632072,
-			 0.9791164972173181,
-			 0.9791519648458347,
-			 0.9791874026476772,
-			 0.9792228106217657,
-			 0.9792581887670216,
-			 0.9792935370823674,
-			 0.9793288555667259,
-			 0.9793641442190218,
-			 0.9793994030381801,
-			 0.9794346320231262,
-			 0.9794698311727877,
-			 0.9795050004860918,
-			 0.9795401399619672,
-			 0.9795752495993438,
-			 0.9796103293971523,
-			 0.9796453793543235,
-			 0.9796803994697902,
-			 0.9797153897424851,
-			 0.9797503501713427,
-			 0.9797852807552980,
-			 0.9798201814932872,
-			 0.9798550523842469,
-			 0.9798898934271147,
-			 0.9799247046208297,
-			 0.9799594859643310,
-			 0.9799942374565594,
-			 0.9800289590964563,
-			 0.9800636508829642,
-			 0.9800983128150260,
-			 0.9801329448915858,
-			 0.9801675471115890,
-			 0.9802021194739814,
-			 0.9802366619777096,
-			 0.9802711746217220,
-			 0.9803056574049663,
-			 0.9803401103263931,
-			 0.9803745333849522,
-			 0.9804089265795957,
-			 0.9804432899092752,
-			 0.9804776233729445,
-			 0.9805119269695571,
-			 0.9805462006980687,
-			 0.9805804445574351,
-			 0.9806146585466131,
-			 0.9806488426645602,
-			 0.9806829969102356,
-			 0.9807171212825987,
-			 0.9807512157806096,
-			 0.9807852804032303,
-			 0.9808193151494230,
-			 0.9808533200181511,
-			 0.9808872950083780,
-			 0.9809212401190698,
-			 0.9809551553491916,
-			 0.9809890406977106,
-			 0.9810228961635948,
-			 0.9810567217458125,
-			 0.9810905174433340,
-			 0.9811242832551292,
-			 0.9811580191801698,
-			 0.9811917252174278,
-			 0.9812254013658767,
-			 0.9812590476244908,
-			 0.9812926639922449,
-			 0.9813262504681154,
-			 0.9813598070510791,
-			 0.9813933337401133,
-			 0.9814268305341970,
-			 0.9814602974323100,
-			 0.9814937344334328,
-			 0.9815271415365469,
-			 0.9815605187406342,
-			 0.9815938660446787,
-			 0.9816271834476640,
-			 0.9816604709485752,
-			 0.9816937285463987,
-			 0.9817269562401211,
-			 0.9817601540287306,
-			 0.9817933219112157,
-			 0.9818264598865659,
-			 0.9818595679537718,
-			 0.9818926461118249,
-			 0.9819256943597177,
-			 0.9819587126964436,
-			 0.9819917011209964,
-			 0.9820246596323717,
-			 0.9820575882295652,
-			 0.9820904869115739,
-			 0.9821233556773954,
-			 0.9821561945260291,
-			 0.9821890034564742,
-			 0.9822217824677312,
-			 0.9822545315588020,
-			 0.9822872507286887,
-			 0.9823199399763944,
-			 0.9823525993009241,
-			 0.9823852287012823,
-			 0.9824178281764752,
-			 0.9824503977255096,
-			 0.9824829373473938,
-			 0.9825154470411362,
-			 0.9825479268057465,
-			 0.9825803766402359,
-			 0.9826127965436152,
-			 0.9826451865148970,
-			 0.9826775465530949,
-			 0.9827098766572230,
-			 0.9827421768262964,
-			 0.9827744470593315,
-			 0.9828066873553446,
-			 0.9828388977133543,
-			 0.9828710781323790,
-			 0.9829032286114389,
-			 0.9829353491495542,
-			 0.9829674397457467,
-			 0.9829995003990386,
-			 0.9830315311084533,
-			 0.9830635318730154,
-			 0.9830955026917497,
-			 0.9831274435636829,
-			 0.9831593544878416,
-			 0.9831912354632537,
-			 0.9832230864889480,
-			 0.9832549075639545,
-			 0.9832866986873038,
-			 0.9833184598580273,
-			 0.9833501910751581,
-			 0.9833818923377291,
-			 0.9834135636447745,
-			 0.9834452049953296,
-			 0.9834768163884309,
-			 0.9835083978231151,
-			 0.9835399492984206,
-			 0.9835714708133859,
-			 0.9836029623670509,
-			 0.9836344239584563,
-			 0.9836658555866437,
-			 0.9836972572506557,
-			 0.9837286289495356,
-			 0.9837599706823282,
-			 0.9837912824480786,
-			 0.9838225642458327,
-			 0.9838538160746375,
-			 0.9838850379335415,
-			 0.9839162298215934,
-			 0.9839473917378433,
-			 0.9839785236813413,
-			 0.9840096256511398,
-			 0.9840406976462909,
-			 0.9840717396658480,
-			 0.9841027517088661,
-			 0.9841337337744001,
-			 0.9841646858615064,
-			 0.9841956079692418,
-			 0.9842265000966649,
-			 0.9842573622428342,
-			 0.9842881944068097,
-			 0.9843189965876523,
-			 0.9843497687844239,
-			 0.9843805109961866,
-			 0.9844112232220044,
-			 0.9844419054609417,
-			 0.9844725577120637,
-			 0.9845031799744365,
-			 0.9845337722471279,
-			 0.9845643345292054,
-			 0.9845948668197382,
-			 0.9846253691177965,
-			 0.9846558414224508,
-			 0.9846862837327729,
-			 0.9847166960478358,
-			 0.9847470783667127,
-			 0.9847774306884783,
-			 0.9848077530122079,
-			 0.9848380453369782,
-			 0.9848683076618658,
-			 0.9848985399859492,
-			 0.9849287423083078,
-			 0.9849589146280211,
-			 0.9849890569441702,
-			 0.9850191692558367,
-			 0.9850492515621037,
-			 0.9850793038620546,
-			 0.9851093261547741,
-			 0.9851393184393472,
-			 0.9851692807148609,
-			 0.9851992129804020,
-			 0.9852291152350592,
-			 0.9852589874779214,
-			 0.9852888297080787,
-			 0.9853186419246218,
-			 0.9853484241266426,
-			 0.9853781763132342,
-			 0.9854078984834900,
-			 0.9854375906365049,
-			 0.9854672527713744,
-			 0.9854968848871944,
-			 0.9855264869830628,
-			 0.9855560590580776,
-			 0.9855856011113383,
-			 0.9856151131419446,
-			 0.9856445951489979,
-			 0.9856740471316001,
-			 0.9857034690888536,
-			 0.9857328610198623,
-			 0.9857622229237313,
-			 0.9857915547995656,
-			 0.9858208566464721,
-			 0.9858501284635584,
-			 0.9858793702499324,
-			 0.9859085820047034,
-			 0.9859377637269815,
-			 0.9859669154158780,
-			 0.9859960370705046,
-			 0.9860251286899748,
-			 0.9860541902734019,
-			 0.9860832218199009,
-			 0.9861122233285871,
-			 0.9861411947985771,
-			 0.9861701362289887,
-			 0.9861990476189404,
-			 0.9862279289675508,
-			 0.9862567802739408,
-			 0.9862856015372314,
-			 0.9863143927565444,
-			 0.9863431539310029,
-			 0.9863718850597309,
-			 0.9864005861418533,
-			 0.9864292571764953,
-			 0.9864578981627843,
-			 0.9864865090998471,
-			 0.9865150899868124,
-			 0.9865436408228097,
-			 0.9865721616069695,
-			 0.9866006523384223,
-			 0.9866291130163010,
-			 0.9866575436397383,
-			 0.9866859442078681,
-			 0.9867143147198252,
-			 0.9867426551747457,
-			 0.9867709655717660,
-			 0.9867992459100238,
-			 0.9868274961886577,
-			 0.9868557164068072,
-			 0.9868839065636126,
-			 0.9869120666582152,
-			 0.9869401966897569,
-			 0.9869682966573812,
-			 0.9869963665602318,
-			 0.9870244063974539,
-			 0.9870524161681935,
-			 0.9870803958715969,
-			 0.9871083455068123,
-			 0.9871362650729879,
-			 0.9871641545692734,
-			 0.9871920139948190,
-			 0.9872198433487767,
-			 0.9872476426302981,
-			 0.9872754118385366,
-			 0.9873031509726462,
-			 0.9873308600317822,
-			 0.9873585390151002,
-			 0.9873861879217574,
-			 0.9874138067509114,
-			 0.9874413955017209,
-			 0.9874689541733455,
-			 0.9874964827649453,
-			 0.9875239812756824,
-			 0.9875514497047186,
-			 0.9875788880512177,
-			 0.9876062963143437,
-			 0.9876336744932617,
-			 0.9876610225871372,
-			 0.9876883405951377,
-			 0.9877156285164309,
-			 0.9877428863501854,
-			 0.9877701140955712,
-			 0.9877973117517589,
-			 0.9878244793179197,
-			 0.9878516167932261,
-			 0.9878787241768515,
-			 0.9879058014679701,
-			 0.9879328486657573,
-			 0.9879598657693891,
-			 0.9879868527780424,
-			 0.9880138096908953,
-			 0.9880407365071262,
-			 0.9880676332259154,
-			 0.9880944998464432,
-			 0.9881213363678917,
-			 0.9881481427894429,
-			 0.9881749191102805,
-			 0.9882016653295888,
-			 0.9882283814465528,
-			 0.9882550674603590,
-			 0.9882817233701945,
-			 0.9883083491752470,
-			 0.9883349448747059,
-			 0.9883615104677608,
-			 0.9883880459536022,
-			 0.9884145513314222,
-			 0.9884410266004132,
-			 0.9884674717597690,
-			 0.9884938868086834,
-			 0.9885202717463524,
-			 0.9885466265719721,
-			 0.9885729512847393,
-			 0.9885992458838526,
-			 0.9886255103685110,
-			 0.9886517447379141,
-			 0.9886779489912627,
-			 0.9887041231277590,
-			 0.9887302671466056,
-			 0.9887563810470058,
-			 0.9887824648281645,
-			 0.9888085184892869,
-			 0.9888345420295791,
-			 0.9888605354482490,
-			 0.9888864987445046,
-			 0.9889124319175547,
-			 0.9889383349666098,
-			 0.9889642078908802,
-			 0.9889900506895783,
-			 0.9890158633619167,
-			 0.9890416459071092,
-			 0.9890673983243705,
-			 0.9890931206129157,
-			 0.9891188127719618,
-			 0.9891444748007259,
-			 0.9891701066984261,
-			 0.9891957084642818,
-			 0.9892212800975133,
-			 0.9892468215973416,
-			 0.9892723329629884,
-			 0.9892978141936767,
-			 0.9893232652886302,
-			 0.9893486862470738,
-			 0.9893740770682331,
-			 0.9893994377513347,
-			 0.9894247682956060,
-			 0.9894500687002755,
-			 0.9894753389645721,
-			 0.9895005790877264,
-			 0.9895257890689693,
-			 0.9895509689075331,
-			 0.9895761186026509,
-			 0.9896012381535564,
-			 0.9896263275594842,
-			 0.9896513868196702,
-			 0.9896764159333511,
-			 0.9897014148997644,
-			 0.9897263837181488,
-			 0.9897513223877435,
-			 0.9897762309077891,
-			 0.9898011092775262,
-			 0.9898259574961975,
-			 0.9898507755630460,
-			 0.9898755634773155,
-			 0.9899003212382514,
-			 0.9899250488450990,
-			 0.9899497462971055,
-			 0.9899744135935180,
-			 0.9899990507335855,
-			 0.9900236577165574,
-			 0.9900482345416843,
-			 0.9900727812082174,
-			 0.9900972977154090,
-			 0.9901217840625123,
-			 0.9901462402487811,
-			 0.9901706662734708,
-			 0.9901950621358374,
-			 0.9902194278351374,
-			 0.9902437633706288,
-			 0.9902680687415703,
-			 0.9902923439472215,
-			 0.9903165889868428,
-			 0.9903408038596958,
-			 0.9903649885650430,
-			 0.9903891431021473,
-			 0.9904132674702733,
-			 0.9904373616686859,
-			 0.9904614256966512,
-			 0.9904854595534361,
-			 0.9905094632383089,
-			 0.9905334367505378,
-			 0.9905573800893928,
-			 0.9905812932541447,
-			 0.9906051762440649,
-			 0.9906290290584256,
-			 0.9906528516965010,
-			 0.9906766441575646,
-			 0.9907004064408919,
-			 0.9907241385457592,
-			 0.9907478404714435,
-			 0.9907715122172229,
-			 0.9907951537823763,
-			 0.9908187651661832,
-			 0.9908423463679247,
-			 0.9908658973868821,
-			 0.9908894182223386,
-			 0.9909129088735772,
-			 0.9909363693398827,
-			 0.9909597996205404,
-			 0.9909831997148363,
-			 0.9910065696220577,
-			 0.9910299093414926,
-			 0.9910532188724304,
-			 0.9910764982141609,
-			 0.9910997473659749,
-			 0.9911229663271640,
-			 0.9911461550970212,
-			 0.9911693136748401,
-			 0.9911924420599150,
-			 0.9912155402515416,
-			 0.9912386082490164,
-			 0.9912616460516367,
-			 0.9912846536587002,
-			 0.9913076310695066,
-			 0.9913305782833556,
-			 0.9913534952995486,
-			 0.9913763821173873,
-			 0.9913992387361745,
-			 0.9914220651552141,
-			 0.9914448613738104,
-			 0.9914676273912693,
-			 0.9914903632068971,
-			 0.9915130688200016,
-			 0.9915357442298909,
-			 0.9915583894358740,
-			 0.9915810044372617,
-			 0.9916035892333646,
-			 0.9916261438234949,
-			 0.9916486682069654,
-			 0.9916711623830904,
-			 0.9916936263511843,
-			 0.9917160601105629,
-			 0.9917384636605427,
-			 0.9917608370004415,
-			 0.9917831801295777,
-			 0.9918054930472707,
-			 0.9918277757528405,
-			 0.9918500282456088,
-			 0.9918722505248976,
-			 0.9918944425900296,
-			 0.9919166044403293,
-			 0.9919387360751215,
-			 0.9919608374937317,
-			 0.9919829086954870,
-			 0.9920049496797150,
-			 0.9920269604457443,
-			 0.9920489409929042,
-			 0.9920708913205254,
-			 0.9920928114279393,
-			 0.9921147013144778,
-			 0.9921365609794744,
-			 0.9921583904222631,
-			 0.9921801896421791,
-			 0.9922019586385583,
-			 0.9922236974107376,
-			 0.9922454059580545,
-			 0.9922670842798479,
-			 0.9922887323754576,
-			 0.9923103502442239,
-			 0.9923319378854887,
-			 0.9923534952985941,
-			 0.9923750224828832,
-			 0.9923965194377006,
-			 0.9924179861623914,
-			 0.9924394226563016,
-			 0.9924608289187784,
-			 0.9924822049491696,
-			 0.9925035507468237,
-			 0.9925248663110910,
-			 0.9925461516413220,
-			 0.9925674067368683,
-			 0.9925886315970824,
-			 0.9926098262213179,
-			 0.9926309906089291,
-			 0.9926521247592710,
-			 0.9926732286717003,
-			 0.9926943023455738,
-			 0.9927153457802497,
-			 0.9927363589750868,
-			 0.9927573419294454,
-			 0.9927782946426862,
-			 0.9927992171141706,
-			 0.9928201093432615,
-			 0.9928409713293224,
-			 0.9928618030717180,
-			 0.9928826045698137,
-			 0.9929033758229755,
-			 0.9929241168305712,
-			 0.9929448275919687,
-			 0.9929655081065368,
-			 0.9929861583736462,
-			 0.9930067783926676,
-			 0.9930273681629727,
-			 0.9930479276839344,
-			 0.9930684569549263,
-			 0.9930889559753233,
-			 0.9931094247445007,
-			 0.9931298632618353,
-			 0.9931502715267043,
-			 0.9931706495384860,
-			 0.9931909972965599,
-			 0.9932113148003057,
-			 0.9932316020491049,
-			 0.9932518590423393,
-			 0.9932720857793921,
-			 0.9932922822596469,
-			 0.9933124484824885,
-			 0.9933325844473028,
-			 0.9933526901534763,
-			 0.9933727656003964,
-			 0.9933928107874519,
-			 0.9934128257140317,
-			 0.9934328103795266,
-			 0.9934527647833274,
-			 0.9934726889248269,
-			 0.9934925828034175,
-			 0.9935124464184936,
-			 0.9935322797694498,
-			 0.9935520828556822,
-			 0.9935718556765875,
-			 0.9935915982315634,
-			 0.9936113105200084,
-			 0.9936309925413221,
-			 0.9936506442949051,
-			 0.9936702657801585,
-			 0.9936898569964847,
-			 0.9937094179432869,
-			 0.9937289486199696,
-			 0.9937484490259374,
-			 0.9937679191605965,
-			 0.9937873590233536,
-			 0.9938067686136165,
-			 0.9938261479307944,
-			 0.9938454969742965,
-			 0.9938648157435337,
-			 0.9938841042379175,
-			 0.9939033624568601,
-			 0.9939225903997749,
-			 0.9939417880660764,
-			 0.9939609554551796,
-			 0.9939800925665008,
-			 0.9939991993994570,
-			 0.9940182759534661,
-			 0.9940373222279471,
-			 0.9940563382223195,
-			 0.9940753239360045,
-			 0.9940942793684235,
-			 0.9941132045189991,
-			 0.9941320993871550,
-			 0.9941509639723154,
-			 0.9941697982739057,
-			 0.9941886022913521,
-			 0.9942073760240820,
-			 0.9942261194715233,
-			 0.9942448326331054,
-			 0.9942635155082580,
-			 0.9942821680964118,
-			 0.9943007903969989,
-			 0.9943193824094518,
-			 0.9943379441332045,
-			 0.9943564755676915,
-			 0.9943749767123479,
-			 0.9943934475666106,
-			 0.9944118881299168,
-			 0.9944302984017045,
-			 0.9944486783814132,
-			 0.9944670280684830,
-			 0.9944853474623548,
-			 0.9945036365624705,
-			 0.9945218953682733,
-			 0.9945401238792068,
-			 0.9945583220947155,
-			 0.9945764900142455,
-			 0.9945946276372433,
-			 0.9946127349631561,
-			 0.9946308119914322,
-			 0.9946488587215216,
-			 0.9946668751528741,
-			 0.9946848612849408,
-			 0.9947028171171742,
-			 0.9947207426490270,
-			 0.9947386378799532,
-			 0.9947565028094080,
-			 0.9947743374368467,
-			 0.9947921417617265,
-			 0.9948099157835048,
-			 0.9948276595016400,
-			 0.9948453729155919,
-			 0.9948630560248208,
-			 0.9948807088287882,
-			 0.9948983313269562,
-			 0.9949159235187879,
-			 0.9949334854037475,
-			 0.9949510169813002,
-			 0.9949685182509117,
-			 0.9949859892120489,
-			 0.9950034298641800,
-			 0.9950208402067732,
-			 0.9950382202392986,
-			 0.9950555699612262,
-			 0.9950728893720281,
-			 0.9950901784711764,
-			 0.9951074372581444,
-			 0.9951246657324068,
-			 0.9951418638934384,
-			 0.9951590317407153,
-			 0.9951761692737144,
-			 0.9951932764919141,
-			 0.9952103533947930,
-			 0.9952273999818311,
-			 0.9952444162525090,
-			 0.9952614022063084,
-			 0.9952783578427117,
-			 0.9952952831612025,
-			 0.9953121781612654,
-			 0.9953290428423854,
-			 0.9953458772040493,
-			 0.9953626812457440,
-			 0.9953794549669575,
-			 0.9953961983671787,
-			 0.9954129114458981,
-			 0.9954295942026062,
-			 0.9954462466367949,
-			 0.9954628687479571,
-			 0.9954794605355863,
-			 0.9954960219991770,
-			 0.9955125531382247,
-			 0.9955290539522261,
-			 0.9955455244406785,
-			 0.9955619646030800,
-			 0.9955783744389298,
-			 0.9955947539477283,
-			 0.9956111031289763,
-			 0.9956274219821757,
-			 0.9956437105068295,
-			 0.9956599687024419,
-			 0.9956761965685170,
-			 0.9956923941045609,
-			 0.9957085613100801,
-			 0.9957246981845821,
-			 0.9957408047275752,
-			 0.9957568809385692,
-			 0.9957729268170739,
-			 0.9957889423626006,
-			 0.9958049275746618,
-			 0.9958208824527701,
-			 0.9958368069964397,
-			 0.9958527012051857,
-			 0.9958685650785236,
-			 0.9958843986159703,
-			 0.9959002018170435,
-			 0.9959159746812619,
-			 0.9959317172081449,
-			 0.9959474293972128,
-			 0.9959631112479873,
-			 0.9959787627599905,
-			 0.9959943839327458,
-			 0.9960099747657771,
-			 0.9960255352586098,
-			 0.9960410654107695,
-			 0.9960565652217837,
-			 0.9960720346911794,
-			 0.9960874738184862,
-			 0.9961028826032332,
-			 0.9961182610449515,
-			 0.9961336091431725,
-			 0.9961489268974285,
-			 0.9961642143072530,
-			 0.9961794713721802,
-			 0.9961946980917455,
-			 0.9962098944654850,
-			 0.9962250604929359,
-			 0.9962401961736361,
-			 0.9962553015071247,
-			 0.9962703764929413,
-			 0.9962854211306268,
-			 0.9963004354197230,
-			 0.9963154193597724,
-			 0.9963303729503188,
-			 0.9963452961909065,
-			 0.9963601890810808,
-			 0.9963750516203882,
-			 0.9963898838083760,
-			 0.9964046856445923,
-			 0.9964194571285863,
-			 0.9964341982599080,
-			 0.9964489090381083,
-			 0.9964635894627392,
-			 0.9964782395333531,
-			 0.9964928592495043,
-			 0.9965074486107471,
-			 0.9965220076166373,
-			 0.9965365362667313,
-			 0.9965510345605867,
-			 0.9965655024977614,
-			 0.9965799400778150,
-			 0.9965943473003078,
-			 0.9966087241648007,
-			 0.9966230706708561,
-			 0.9966373868180366,
-			 0.9966516726059063,
-			 0.9966659280340299,
-			 0.9966801531019732,
-			 0.9966943478093030,
-			 0.9967085121555869,
-			 0.9967226461403932,
-			 0.9967367497632916,
-			 0.9967508230238524,
-			 0.9967648659216467,
-			 0.9967788784562471,
-			 0.9967928606272266,
-			 0.9968068124341591,
-			 0.9968207338766198,
-			 0.9968346249541847,
-			 0.9968484856664306,
-			 0.9968623160129350,
-			 0.9968761159932769,
-			 0.9968898856070358,
-			 0.9969036248537924,
-			 0.9969173337331280,
-			 0.9969310122446251,
-			 0.9969446603878669,
-			 0.9969582781624379,
-			 0.9969718655679232,
-			 0.9969854226039088,
-			 0.9969989492699817,
-			 0.9970124455657300,
-			 0.9970259114907425,
-			 0.9970393470446089,
-			 0.9970527522269202,
-			 0.9970661270372679,
-			 0.9970794714752446,
-			 0.9970927855404436,
-			 0.9971060692324597,
-			 0.9971193225508880,
-			 0.9971325454953249,
-			 0.9971457380653674,
-			 0.9971589002606139,
-			 0.9971720320806633,
-			 0.9971851335251157,
-			 0.9971982045935720,
-			 0.9972112452856339,
-			 0.9972242556009042,
-			 0.9972372355389866,
-			 0.9972501850994857,
-			 0.9972631042820069,
-			 0.9972759930861570,
-			 0.9972888515115433,
-			 0.9973016795577739,
-			 0.9973144772244581,
-			 0.9973272445112061,
-			 0.9973399814176290,
-			 0.9973526879433388,
-			 0.9973653640879484,
-			 0.9973780098510718,
-			 0.9973906252323237,
-			 0.9974032102313196,
-			 0.9974157648476766,
-			 0.9974282890810118,
-			 0.9974407829309438,
-			 0.9974532463970924,
-			 0.9974656794790775,
-			 0.9974780821765207,
-			 0.9974904544890437,
-			 0.9975027964162700,
-			 0.9975151079578236,
-			 0.9975273891133296,
-			 0.9975396398824136,
-			 0.9975518602647027,
-			 0.9975640502598243,
-			 0.9975762098674072,
-			 0.9975883390870812,
-			 0.9976004379184766,
-			 0.9976125063612252,
-			 0.9976245444149590,
-			 0.9976365520793113,
-			 0.9976485293539165,
-			 0.9976604762384097,
-			 0.9976723927324269,
-			 0.9976842788356053,
-			 0.9976961345475825,
-			 0.9977079598679978,
-			 0.9977197547964907,
-			 0.9977315193327018,
-			 0.9977432534762729,
-			 0.9977549572268466,
-			 0.9977666305840662,
-			 0.9977782735475763,
-			 0.9977898861170221,
-			 0.9978014682920501,
-			 0.9978130200723070,
-			 0.9978245414574415,
-			 0.9978360324471022,
-			 0.9978474930409392,
-			 0.9978589232386035,
-			 0.9978703230397468,
-			 0.9978816924440219,
-			 0.9978930314510823,
-			 0.9979043400605829,
-			 0.9979156182721790,
-			 0.9979268660855271,
-			 0.9979380835002845,
-			 0.9979492705161096,
-			 0.9979604271326615,
-			 0.9979715533496006,
-			 0.9979826491665879,
-			 0.9979937145832851,
-			 0.9980047495993554,
-			 0.9980157542144626,
-			 0.9980267284282716,
-			 0.9980376722404479,
-			 0.9980485856506582,
-			 0.9980594686585701,
-			 0.9980703212638520,
-			 0.9980811434661734,
-			 0.9980919352652047,
-			 0.9981026966606170,
-			 0.9981134276520827,
-			 0.9981241282392745,
-			 0.9981347984218669,
-			 0.9981454381995347,
-			 0.9981560475719538,
-			 0.9981666265388009,
-			 0.9981771750997539,
-			 0.9981876932544915,
-			 0.9981981810026931,
-			 0.9982086383440394,
-			 0.9982190652782117,
-			 0.9982294618048926,
-			 0.9982398279237653,
-			 0.9982501636345139,
-			 0.9982604689368237,
-			 0.9982707438303807,
-			 0.9982809883148720,
-			 0.9982912023899855,
-			 0.9983013860554101,
-			 0.9983115393108354,
-			 0.9983216621559524,
-			 0.9983317545904524,
-			 0.9983418166140283,
-			 0.9983518482263735,
-			 0.9983618494271823,
-			 0.9983718202161501,
-			 0.9983817605929732,
-			 0.9983916705573489,
-			 0.9984015501089750,
-			 0.9984113992475510,
-			 0.9984212179727764,
-			 0.9984310062843526,
-			 0.9984407641819810,
-			 0.9984504916653645,
-			 0.9984601887342069,
-			 0.9984698553882129,
-			 0.9984794916270877,
-			 0.9984890974505379,
-			 0.9984986728582710,
-			 0.9985082178499952,
-			 0.9985177324254199,
-			 0.9985272165842549,
-			 0.9985366703262117,
-			 0.9985460936510022,
-			 0.9985554865583394,
-			 0.9985648490479369,
-			 0.9985741811195097,
-			 0.9985834827727736,
-			 0.9985927540074452,
-			 0.9986019948232421,
-			 0.9986112052198827,
-			 0.9986203851970865,
-			 0.9986295347545738,
-			 0.9986386538920661,
-			 0.9986477426092855,
-			 0.9986568009059550,
-			 0.9986658287817988,
-			 0.9986748262365419,
-			 0.9986837932699101,
-			 0.9986927298816305,
-			 0.9987016360714306,
-			 0.9987105118390394,
-			 0.9987193571841863,
-			 0.9987281721066018,
-			 0.9987369566060175,
-			 0.9987457106821658,
-			 0.9987544343347801,
-			 0.9987631275635946,
-			 0.9987717903683444,
-			 0.9987804227487659,
-			 0.9987890247045957,
-			 0.9987975962355722,
-			 0.9988061373414340,
-			 0.9988146480219211,
-			 0.9988231282767742,
-			 0.9988315781057350,
-			 0.9988399975085459,
-			 0.9988483864849507,
-			 0.9988567450346937,
-			 0.9988650731575204,
-			 0.9988733708531770,
-			 0.9988816381214108,
-			 0.9988898749619700,
-			 0.9988980813746036,
-			 0.9989062573590616,
-			 0.9989144029150950,
-			 0.9989225180424558,
-			 0.9989306027408966,
-			 0.9989386570101713,
-			 0.9989466808500344,
-			 0.9989546742602414,
-			 0.9989626372405491,
-			 0.9989705697907146,
-			 0.9989784719104966,
-			 0.9989863435996542,
-			 0.9989941848579477,
-			 0.9990019956851380,
-			 0.9990097760809875,
-			 0.9990175260452590,
-			 0.9990252455777164,
-			 0.9990329346781247,
-			 0.9990405933462496,
-			 0.9990482215818578,
-			 0.9990558193847169,
-			 0.9990633867545954,
-			 0.9990709236912629,
-			 0.9990784301944899,
-			 0.9990859062640476,
-			 0.9990933518997082,
-			 0.9991007671012451,
-			 0.9991081518684320,
-			 0.9991155062010446,
-			 0.9991228300988584,
-			 0.9991301235616503,
-			 0.9991373865891984,
-			 0.9991446191812812,
-			 0.9991518213376785,
-			 0.9991589930581710,
-			 0.9991661343425402,
-			 0.9991732451905683,
-			 0.9991803256020390,
-			 0.9991873755767364,
-			 0.9991943951144460,
-			 0.9992013842149537,
-			 0.9992083428780468,
-			 0.9992152711035133,
-			 0.9992221688911420,
-			 0.9992290362407229,
-			 0.9992358731520469,
-			 0.9992426796249055,
-			 0.9992494556590916,
-			 0.9992562012543986,
-			 0.9992629164106213,
-			 0.9992696011275547,
-			 0.9992762554049955,
-			 0.9992828792427410,
-			 0.9992894726405892,
-			 0.9992960355983396,
-			 0.9993025681157919,
-			 0.9993090701927474,
-			 0.9993155418290078,
-			 0.9993219830243761,
-			 0.9993283937786562,
-			 0.9993347740916527,
-			 0.9993411239631712,
-			 0.9993474433930183,
-			 0.9993537323810014,
-			 0.9993599909269292,
-			 0.9993662190306107,
-			 0.9993724166918566,
-			 0.9993785839104777,
-			 0.9993847206862865,
-			 0.9993908270190958,
-			 0.9993969029087195,
-			 0.9994029483549729,
-			 0.9994089633576715,
-			 0.9994149479166323,
-			 0.9994209020316729,
-			 0.9994268257026119,
-			 0.9994327189292689,
-			 0.9994385817114643,
-			 0.9994444140490196,
-			 0.9994502159417572,
-			 0.9994559873895001,
-			 0.9994617283920728,
-			 0.9994674389493003,
-			 0.9994731190610087,
-			 0.9994787687270248,
-			 0.9994843879471766,
-			 0.9994899767212930,
-			 0.9994955350492036,
-			 0.9995010629307393,
-			 0.9995065603657316,
-			 0.9995120273540129,
-			 0.9995174638954170,
-			 0.9995228699897778,
-			 0.9995282456369311,
-			 0.9995335908367129,
-			 0.9995389055889605,
-			 0.9995441898935119,
-			 0.9995494437502062,
-			 0.9995546671588833,
-			 0.9995598601193840,
-			 0.9995650226315503,
-			 0.9995701546952249,
-			 0.9995752563102516,
-			 0.9995803274764746,
-			 0.9995853681937398,
-			 0.9995903784618934,
-			 0.9995953582807828,
-			 0.9996003076502565,
-			 0.9996052265701637,
-			 0.9996101150403544,
-			 0.9996149730606798,
-			 0.9996198006309919,
-			 0.9996245977511435,
-			 0.9996293644209887,
-			 0.9996341006403823,
-			 0.9996388064091798,
-			 0.9996434817272380,
-			 0.9996481265944145,
-			 0.9996527410105678,
-			 0.9996573249755573,
-			 0.9996618784892434,
-			 0.9996664015514872,
-			 0.9996708941621513,
-			 0.9996753563210986,
-			 0.9996797880281931,
-			 0.9996841892832999,
-			 0.9996885600862850,
-			 0.9996929004370153,
-			 0.9996972103353584,
-			 0.9997014897811831,
-			 0.9997057387743591,
-			 0.9997099573147569,
-			 0.9997141454022479,
-			 0.9997183030367047,
-			 0.9997224302180006,
-			 0.9997265269460097,
-			 0.9997305932206075,
-			 0.9997346290416701,
-			 0.9997386344090743,
-			 0.9997426093226983,
-			 0.9997465537824209,
-			 0.9997504677881222,
-			 0.9997543513396826,
-			 0.9997582044369840,
-			 0.9997620270799091,
-			 0.9997658192683413,
-			 0.9997695810021652,
-			 0.9997733122812661,
-			 0.9997770131055305,
-			 0.9997806834748455,
-			 0.9997843233890994,
-			 0.9997879328481812,
-			 0.9997915118519811,
-			 0.9997950604003900,
-			 0.9997985784932998,
-			 0.9998020661306034,
-			 0.9998055233121944,
-			 0.9998089500379678,
-			 0.9998123463078188,
-			 0.9998157121216442,
-			 0.9998190474793415,
-			 0.9998223523808090,
-			 0.9998256268259460,
-			 0.9998288708146529,
-			 0.9998320843468308,
-			 0.9998352674223817,
-			 0.9998384200412088,
-			 0.9998415422032160,
-			 0.9998446339083082,
-			 0.9998476951563913,
-			 0.9998507259473718,
-			 0.9998537262811577,
-			 0.9998566961576574,
-			 0.9998596355767804,
-			 0.9998625445384374,
-			 0.9998654230425394,
-			 0.9998682710889991,
-			 0.9998710886777297,
-			 0.9998738758086451,
-			 0.9998766324816606,
-			 0.9998793586966922,
-			 0.9998820544536569,
-			 0.9998847197524724,
-			 0.9998873545930577,
-			 0.9998899589753325,
-			 0.9998925328992174,
-			 0.9998950763646340,
-			 0.9998975893715050,
-			 0.9999000719197535,
-			 0.9999025240093042,
-			 0.9999049456400823,
-			 0.9999073368120139,
-			 0.9999096975250265,
-			 0.9999120277790479,
-			 0.9999143275740070,
-			 0.9999165969098341,
-			 0.9999188357864598,
-			 0.9999210442038161,
-			 0.9999232221618356,
-			 0.9999253696604520,
-			 0.9999274866995999,
-			 0.9999295732792146,
-			 0.9999316293992330,
-			 0.9999336550595920,
-			 0.9999356502602300,
-			 0.9999376150010865,
-			 0.9999395492821014,
-			 0.9999414531032158,
-			 0.9999433264643717,
-			 0.9999451693655121,
-			 0.9999469818065809,
-			 0.9999487637875227,
-			 0.9999505153082835,
-			 0.9999522363688097,
-			 0.9999539269690489,
-			 0.9999555871089498,
-			 0.9999572167884616,
-			 0.9999588160075348,
-			 0.9999603847661206,
-			 0.9999619230641713,
-			 0.9999634309016400,
-			 0.9999649082784806,
-			 0.9999663551946484,
-			 0.9999677716500991,
-			 0.9999691576447897,
-			 0.9999705131786779,
-			 0.9999718382517224,
-			 0.9999731328638828,
-			 0.9999743970151198,
-			 0.9999756307053947,
-			 0.9999768339346702,
-			 0.9999780067029094,
-			 0.9999791490100767,
-			 0.9999802608561371,
-			 0.9999813422410571,
-			 0.9999823931648033,
-			 0.9999834136273441,
-			 0.9999844036286483,
-			 0.9999853631686855,
-			 0.9999862922474267,
-			 0.9999871908648437,
-			 0.9999880590209089,
-			 0.9999888967155960,
-			 0.9999897039488793,
-			 0.9999904807207345,
-			 0.9999912270311376,
-			 0.9999919428800662,
-			 0.9999926282674982,
-			 0.9999932831934130,
-			 0.9999939076577904,
-			 0.9999945016606114,
-			 0.9999950652018582,
-			 0.9999955982815133,
-			 0.9999961008995606,
-			 0.9999965730559848,
-			 0.9999970147507714,
-			 0.9999974259839071,
-			 0.9999978067553793,
-			 0.9999981570651764,
-			 0.9999984769132877,
-			 0.9999987662997035,
-			 0.9999990252244151,
-			 0.9999992536874144,
-			 0.9999994516886945,
-			 0.9999996192282494,
-			 0.9999997563060741,
-			 0.9999998629221643,
-			 0.9999999390765166,
-			 0.9999999847691291};
-
-/*
-  This material is based upon work supported by the Defense Advanced Research
-  Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
-  findings, conclusions or recommendations expressed in this material are those
-  of the author(s) and do not necessarily reflect the views of the Defense
-  Advanced Research Projects Agency.
-
-  © 2019 Massachusetts Institute of Technology.
-
-
-  This program is free software; you can redistribute it and/or modify
-  it under the terms of the GNU General Public License version 2 as
-  published by the Free Software Foundation;
-
-  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
-  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
-  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
-  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
-  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
-  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
-  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
-  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
-  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
-  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
-  POSSIBILITY OF SUCH DAMAGE.
-*/
@@ -1,4 +1,5 @@
-function h = jakes4(starttime, Nsamples, chanstates, Plot)
+function h = jakes4(starttime, Nsamples, chanstates, Plot, tol, cosTol, ...
+                   lutSize, lutInterp)
 % [h, chanstate] = jakes(method, f, Nsamples, starttime, chanstates, Plot)
 %
 % NSAMPLES is the number of samples you want.
@@ -9,6 +10,20 @@ function h = jakes4(starttime, Nsamples, chanstates, Plot)
 %
 % PLOT is an argument (1 or 0) which enables plotting of
 %   the time autocorrelation function of each tap.
+%
+% TOL (optional) lets 'zheng' taps be evaluated at a decimated rate and
+%   interpolated, within TOL of their rms amplitude.  0 (the default)
+%   evaluates every sample.
+%
+% COSTOL (optional) lets 'zheng' taps evaluate their cosines with a
+%   polynomial within COSTOL of cos instead of the cosine table.  0 (the
+%   default) uses the table.
+%
+% LUTSIZE and LUTINTERP (optional) set the number of entries of that
+%   table, 1024 by default, and its interpolation, 'linear' (the default)
+%   or 'nearest'.
+%
+% 'bank' chanstates read their taps from the sequences of FadingBank.
 
 %
 % This material is based upon work supported by the Defense Advanced Research
@@ -43,9 +58,21 @@ function h = jakes4(starttime, Nsamples, chanstates, Plot)
 % specifically authorized by the U.S. Government may violate any copyrights
 % that exist in this work.
 
-if nargin < 4
+if nargin < 4 || isempty(Plot)
   Plot = 0;
 end
+if nargin < 5
+  tol = 0;
+end
+if nargin < 6
+  cosTol = 0;
+end
+if nargin < 7
+  lutSize = 1024;
+end
+if nargin < 8
+  lutInterp = 'linear';
+end
 
 % Check the dimension of Nsamples, and work accordingly.
 Ni = length(chanstates);
@@ -59,12 +86,15 @@ for ii = 1:Ni
   switch(lower(methodfun))
     case 'zheng'
       try
-          h(ii, :) = zhengFunLUT(f, t, chanstates(ii));
+          h(ii, :) = zhengFunLUT(f, t, chanstates(ii), tol, cosTol, ...
+                                 lutSize, lutInterp);
       catch ME; %#ok
           h(ii, :)    = zheng(f, t, chanstates(ii));
       end
     case 'constant'
       h(ii, :) = chanstates(ii).coeff;
+    case 'bank'
+      h(ii, :) = FadingBank('tap', chanstates(ii), t);
 
     otherwise
       h(ii, :)    = eval([methodfun, '(f, t, chanstates(ii));']);
@@ -0,0 +1,244 @@
+/*
+  This material is based upon work supported by the Defense Advanced Research
+  Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+  findings, conclusions or recommendations expressed in this material are those
+  of the author(s) and do not necessarily reflect the views of the Defense
+  Advanced Research Projects Agency.
+
+  © 2019 Massachusetts Institute of Technology.
+
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License version 2 as
+  published by the Free Software Foundation;
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+  POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  Decimated evaluation of Jakes fading taps, shared by the channel MEX
+  functions.
+
+  A 'zheng' tap is a sum of M sinusoids no faster than doppf cycles per
+  sample, and doppf is tiny at simulation sample rates, so the tap can
+  be evaluated every decim samples only and the samples in between
+  interpolated.  The interpolator is a polyphase filter in Farrow form:
+  within each interval between two coarse samples the tap is the
+  Newton polynomial through the order nearest coarse samples, evaluated
+  at the phase of each output, so no table of per-phase coefficients is
+  needed for any decim.
+
+  The coarse samples lie at the times j*decim for integer j, so the
+  output at a time does not depend on where a block or a frame starts.
+
+  Everything is static so that each MEX file can still be built on its
+  own with "mex <file>.c".
+*/
+
+#ifndef JAKESINTERP_H
+#define JAKESINTERP_H
+
+#include <math.h>
+
+#define JAKESINTERP_MAX_ORDER 8               /* Most coarse samples per output */
+#define JAKESINTERP_MAX_DECIM 65536
+
+/*
+  Choose the decimation of a tap of M sinusoids at Doppler frequency
+  doppf (over the sample rate) such that interpolating it changes the
+  tap by at most tol times its rms amplitude.
+
+  Lagrange interpolation through T points at a spacing of decim samples
+  is off by at most |d^T h/dt^T| W_T / T!, with W_T the largest product
+  of the distances to the points, which the center interval attains at
+  its middle.  With |d^T h/dt^T| <= sqrt(M) (2 pi doppf decim)^T for a
+  unit-power tap, this gives the largest decim for each T; the T with
+  the fewest operations per output wins.
+
+  Returns decim, 1 to evaluate every sample, and sets *pOrder to T.
+*/
+static int jakesInterpPlan(double doppf, int M, double tol, int *pOrder)
+{
+  static const double fact[4] = {2., 24., 720., 40320.};
+  static const double width[4] = {0.25, 0.5625, 3.515625, 43.06640625};
+  double w;                                   /* Largest coarse angular step */
+  double cost;
+  double bestCost = 6.*M;                     /* Per output at full rate */
+  int decim, bestDecim = 1;
+  int ii, order;
+
+  *pOrder = 2;
+  if ((tol <= 0.) || (M < 1))
+    {
+      return(1);
+    }
+
+  for (ii = 0; ii < 4; ii++)
+    {
+      order = 2*(ii + 1);
+      w = pow(tol*fact[ii]/(sqrt((double)M)*width[ii]), 1./order);
+      w = (w < 1.) ? w : 1.;
+      if (fabs(doppf)*JAKESINTERP_MAX_DECIM*6.283185307179586 <= w)
+	{
+	  decim = JAKESINTERP_MAX_DECIM;
+	}
+      else
+	{
+	  decim = (int)(w/(6.283185307179586*fabs(doppf)));
+	}
+      if (decim < 2)
+	{
+	  continue;
+	}
+
+      /* Coarse samples and their differences, then Horner per output */
+      cost = (6.*M + order*order/2)/decim + 2.*(order - 1) + 1.;
+      if (cost < bestCost)
+	{
+	  bestCost = cost;
+	  bestDecim = decim;
+	  *pOrder = order;
+	}
+    }
+
+  return(bestDecim);
+}
+
+/*
+  Coarse samples needed to interpolate the outputs at times t0 + k,
+  k < len: those at the times (*pJ0 + i)*decim, i < the returned count.
+*/
+static int jakesInterpSpan(double t0, int len, int decim, int order, double *pJ0)
+{
+  double jLast;
+
+  *pJ0 = floor(t0/decim) - (order/2 - 1);
+  jLast = floor((t0 + (len - 1))/decim) + order/2;
+  return((int)(jLast - *pJ0) + 1);
+}
+
+/* Outputs [k, kEnd) from the monomial coefficients b of a T-point interval */
+#define JAKESINTERP_HORNER(T)						\
+  for (; k < kEnd; k++)							\
+    {									\
+      x = x0 + (k - kStart)*invDecim;					\
+      r = b[(T) - 1];							\
+      for (q = (T) - 2; q >= 0; q--)					\
+	{								\
+	  r = r*x + b[q];						\
+	}								\
+      pOut[k*(size_t)outStep] = r;					\
+    }
+
+/*
+  Interpolate pOut[k*outStep] at the times t0 + k, k < len, from the
+  coarse samples pCoarse[i] at the times (j0 + i)*decim, as laid out by
+  jakesInterpSpan().
+*/
+static void jakesInterpRun(double *pOut, int outStep, int len, double t0,
+			   const double *pCoarse, double j0, int decim, int order)
+{
+  double a[JAKESINTERP_MAX_ORDER];            /* Newton coefficients */
+  double b[JAKESINTERP_MAX_ORDER];            /* The same polynomial in powers of x */
+  double invDecim = 1./decim;
+  double j, x, x0, r;
+  int k, kStart, kEnd, i, q;
+  int half = order/2 - 1;                     /* Points before the interval */
+
+  for (k = 0; k < len; k = kEnd)
+    {
+      /* Interval [j, j+1) of coarse times holding output k */
+      j = floor((t0 + k)*invDecim);
+      kEnd = (int)ceil((j + 1.)*decim - t0);
+      kEnd = (kEnd > len) ? len : kEnd;
+      kEnd = (kEnd > k) ? kEnd : k + 1;
+
+      /* Forward differences of the points j-half, ..., j-half+order-1 */
+      i = (int)(j - j0) - half;
+      for (q = 0; q < order; q++)
+	{
+	  a[q] = pCoarse[i + q];
+	}
+      for (i = 1; i < order; i++)
+	{
+	  for (q = order - 1; q >= i; q--)
+	    {
+	      a[q] = (a[q] - a[q - 1])/i;
+	    }
+	}
+
+      /*
+	Expand the Newton form, whose points are at x = q - half, into
+	powers of the phase x in [0, 1) of the interval
+      */
+      b[0] = a[order - 1];
+      for (i = order - 2; i >= 0; i--)
+	{
+	  b[order - 1 - i] = b[order - 2 - i];
+	  for (q = order - 2 - i; q > 0; q--)
+	    {
+	      b[q] = b[q - 1] + (half - i)*b[q];
+	    }
+	  b[0] = a[i] + (half - i)*b[0];
+	}
+
+      kStart = k;
+      x0 = (t0 + k - j*decim)*invDecim;
+      switch (order)
+	{
+	case 2:
+	  JAKESINTERP_HORNER(2);
+	  break;
+	case 4:
+	  JAKESINTERP_HORNER(4);
+	  break;
+	case 6:
+	  JAKESINTERP_HORNER(6);
+	  break;
+	default:
+	  JAKESINTERP_HORNER(JAKESINTERP_MAX_ORDER);
+	  break;
+	}
+    }
+}
+
+#undef JAKESINTERP_HORNER
+
+#endif /* JAKESINTERP_H */
+
+/*
+  This material is based upon work supported by the Defense Advanced Research
+  Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+  findings, conclusions or recommendations expressed in this material are those
+  of the author(s) and do not necessarily reflect the views of the Defense
+  Advanced Research Projects Agency.
+
+  © 2019 Massachusetts Institute of Technology.
+
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License version 2 as
+  published by the Free Software Foundation;
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+  POSSIBILITY OF SUCH DAMAGE.
+*/
@@ -0,0 +1,246 @@
+/*
+  This material is based upon work supported by the Defense Advanced Research
+  Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+  findings, conclusions or recommendations expressed in this material are those
+  of the author(s) and do not necessarily reflect the views of the Defense
+  Advanced Research Projects Agency.
+
+  © 2019 Massachusetts Institute of Technology.
+
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License version 2 as
+  published by the Free Software Foundation;
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+  POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  libllamachan: the native kernels of the channel MEX functions, built
+  without MATLAB.
+
+  Each kernel lives in the source file of its MEX function (TVConv.c,
+  Stackzs.c, StackzsCov.c, StackzsApply.c, StfcsFilter.c, zhengFunLUT.c,
+  zhengBatch.c).
+  The MEX gateway in each is compiled only with MATLAB_MEX_FILE defined,
+  so the same files build either a MEX function with "mex <file>.c" or,
+  together, this library.
+  Arrays are column-major as in MATLAB, and the functions return 0 on
+  success or a positive error code.  Each function is documented where
+  it is defined.
+
+  The functions keep no state between calls beyond the instruction set
+  they select once and the cosine tables of the zheng generators, each
+  built once and never changed (see cosLut.h), so they may run
+  concurrently.
+*/
+
+#ifndef LLAMACHAN_H
+#define LLAMACHAN_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*---------------------------------------------------------------------*/
+/* tvconv(): time-varying convolution, TVConv.c                        */
+/*---------------------------------------------------------------------*/
+
+/* Instruction sets for the bulk of the tvconv() loop */
+#define TVCONV_ISA_AUTO   -1
+#define TVCONV_ISA_SCALAR  0
+#define TVCONV_ISA_AVX2    1
+#define TVCONV_ISA_AVX512  2
+
+/* Memory layouts of the channel matrix H */
+#define TVCONV_H_SAMPLE_MAJOR 0               /* nS x nLags, one column per lag */
+#define TVCONV_H_LAG_MAJOR    1               /* nLags x nS, one column per sample, as jakes4 returns it */
+#define TVCONV_H_JAKES        2               /* Generated from Jakes chanstates, see tvconvJakesMimo() */
+
+/* Storage of complex arrays */
+#define TVCONV_CPLX_SPLIT       0             /* Separate real and imaginary arrays */
+#define TVCONV_CPLX_INTERLEAVED 1             /* (re, im) pairs, as the R2018a MEX API */
+
+/*
+  One tap of a Jakes channel, as described by a jakes4 chanstate: either
+  a 'zheng' sum of M sinusoids,
+
+    h(t) = gain*sqrt(1/(4M))*sum_m [2 cos(2 pi doppf cos(alph_m) t + phi_m)
+                                 + 2j cos(2 pi doppf sin(alph_m) t + sphi_m)]
+
+  or, for M = 0, the 'constant' gain*coeff, or a 'bank' tap
+  gain*coeff*seq(t + seqOffset), read cyclically from a FadingBank
+  sequence, plus a fixed offset (e.g. a Rice component folded into the
+  tap).
+
+  A 'zheng' tap with decim > 1 is evaluated every decim samples only
+  and interpolated in between, as planned by tvconvJakesTapPlan().  A
+  'bank' sequence is stored every decim samples and interpolated the
+  same way.
+*/
+typedef struct {
+  int M;                                      /* Sinusoids, 0 for a constant tap */
+  double gain;                                /* Amplitude of the tap (sqrt of its power) */
+  double doppf;                               /* Doppler frequency over the sample rate */
+  const double *pAlph;                        /* M arrival angles */
+  const double *pPhi;                         /* M phases of the real part */
+  const double *pSphi;                        /* M phases of the imaginary part */
+  double coeff_re;                            /* Value of a constant tap, rotation of a bank tap */
+  double coeff_im;
+  const double *pSeq_re;                      /* Bank tap: stored sequence, NULL otherwise */
+  const double *pSeq_im;
+  int seqEl;                                  /* Doubles between stored samples */
+  int seqLen;                                 /* Stored samples, one every decim */
+  double seqOffset;                           /* Sample of the sequence at time 0 */
+  double offset_re;                           /* Added to the tap */
+  double offset_im;
+  int decim;                                  /* Samples per evaluation, 0 or 1 for all */
+  int order;                                  /* Evaluations each interpolated output reads */
+} tvconvJakesTap;
+
+/* Scratch memory that tvconv() calls can keep between them */
+typedef struct tvconvWorkspace tvconvWorkspace;
+
+int tvconvSelectIsa(int isa);
+
+tvconvWorkspace *tvconvWorkspaceCreate(void);
+void tvconvWorkspaceDestroy(tvconvWorkspace *ws);
+
+void tvconvJakesTapPlan(tvconvJakesTap *tap, double tol);
+
+int tvconv(double *pOut_re, double *pOut_im,
+	   int nS, int nLags, double *pH_re, double *pH_im,
+	   int hLayout, int cplxLayout,
+	   double *pLags_re,
+	   double *pSource_re, double *pSource_im,
+	   int longestLag, double scale, int accumulate,
+	   tvconvWorkspace *ws, int nThreads);
+
+int tvconvMimo(double *pOut_re, double *pOut_im,
+	       int nR, int nT, int nS, int *pNLags,
+	       double **pH_re, double **pH_im, int hLayout, int cplxLayout,
+	       double **pLags_re,
+	       double **pSource_re, double **pSource_im,
+	       int longestLag, double scale, int accumulate,
+	       tvconvWorkspace *ws, int nThreads);
+
+int tvconvJakesMimo(double *pOut_re, double *pOut_im,
+		    int nR, int nT, int nS, int *pNLags,
+		    const tvconvJakesTap *pTaps, double tStart, int cplxLayout,
+		    double **pLags_re,
+		    double **pSource_re, double **pSource_im,
+		    int longestLag, double scale, int accumulate,
+		    tvconvWorkspace *ws, int nThreads);
+
+/*---------------------------------------------------------------------*/
+/* Stackzs(): stacked circular shifts, Stackzs.c                       */
+/*---------------------------------------------------------------------*/
+
+/* Output layouts of stackzsCopy() */
+#define STACKZS_LAYOUT_STACKED     0           /* nrIn*nShifts x ncIn, as Stackzs.m */
+#define STACKZS_LAYOUT_SHIFT_MAJOR 1           /* nrIn x ncIn x nShifts */
+
+int stackzsCopy(void *pOut_re, void *pOut_im, const void *pIn_re, const void *pIn_im,
+		size_t elSize, int nrIn, int ncIn, int nShifts, const double *shifts,
+		int layout, int nThreads);
+
+int Stackzs(double *ptrOut,
+	    double *ptrIn,
+	    int nrIn,
+	    int ncIn,
+	    int nShifts,
+	    double *shifts);
+
+/*---------------------------------------------------------------------*/
+/* stackzsCov(): covariances of stacked circular shifts, StackzsCov.c  */
+/*---------------------------------------------------------------------*/
+
+int stackzsCov(double *pR_re, double *pR_im, int rStep,
+	       double *pC_re, double *pC_im, int cStep,
+	       const double *pZ_re, const double *pZ_im, int zStep,
+	       int nr, int nc, int nShifts, const double *shifts,
+	       const double *pRef_re, const double *pRef_im, int refStep, int nRef,
+	       int nThreads);
+
+/*---------------------------------------------------------------------*/
+/* stackzsApply(): weights applied to stacked shifts, StackzsApply.c   */
+/*---------------------------------------------------------------------*/
+
+int stackzsApply(double *pY_re, double *pY_im, int yStep,
+		 const double *pW_re, const double *pW_im, int wStep, int nW,
+		 const double *pZ_re, const double *pZ_im, int zStep,
+		 int nr, int nc, int nShifts, const double *shifts,
+		 int nThreads);
+
+/*---------------------------------------------------------------------*/
+/* stfcsFilter(): the sampled 'stfcs' channel, StfcsFilter.c           */
+/*---------------------------------------------------------------------*/
+
+int stfcsFilter(double *pY_re, double *pY_im, int yStep,
+		const double *pH_re, const double *pH_im, int hStep,
+		int nR, int nT, int nDop, int nDelay,
+		const double *freqOffs, const double *phiOffs, double startSamp,
+		const double *pS_re, const double *pS_im, int sStep, int nSamp,
+		int nThreads);
+
+/*---------------------------------------------------------------------*/
+/* 'zheng' Jakes taps, zhengFunLUT.c and zhengBatch.c                  */
+/*---------------------------------------------------------------------*/
+
+int zhengFunLUT(double *hr, double *hi, int hStep,
+		const double *t, int nSamp, double f,
+		const double *alphr, const double *phir, const double *sphir, int m,
+		double tol, double cosTol, int lutSize, const char *lutInterp);
+
+int zhengBatch(double *hr, double *hi, int hStep,
+	       double start, int nSamples, double f, int m,
+	       const double *alph, const double *phi, const double *sphi,
+	       int nLags, int nPairs, const double *pLagsPair,
+	       double tol, double cosTol, int lutSize, const char *lutInterp,
+	       int nThreads);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LLAMACHAN_H */
+
+
+/*
+  This material is based upon work supported by the Defense Advanced Research
+  Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+  findings, conclusions or recommendations expressed in this material are those
+  of the author(s) and do not necessarily reflect the views of the Defense
+  Advanced Research Projects Agency.
+
+  © 2019 Massachusetts Institute of Technology.
+
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License version 2 as
+  published by the Free Software Foundation;
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+  POSSIBILITY OF SUCH DAMAGE.
+*/
@@ -0,0 +1,899 @@
+/*
+  This material is based upon work supported by the Defense Advanced Research
+  Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+  findings, conclusions or recommendations expressed in this material are those
+  of the author(s) and do not necessarily reflect the views of the Defense
+  Advanced Research Projects Agency.
+
+  © 2019 Massachusetts Institute of Technology.
+
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License version 2 as
+  published by the Free Software Foundation;
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+  POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  Microbenchmarks of libllamachan, the kernels of the channel MEX
+  functions (see llamachan.h).  Not a MEX function: built by
+  CMakeLists.txt, or by hand with
+
+    cc -O2 llamachanBench.c TVConv.c Stackzs.c StackzsCov.c StackzsApply.c \
+       StfcsFilter.c zhengFunLUT.c zhengBatch.c -o llamachanBench -lm -lpthread
+
+  and run as
+
+    ./llamachanBench [--quick] [--threads n] [--label text] [--json file]
+
+  It sweeps
+    tvconv       nS, nLags, real or complex, H layout, instruction set
+    zhengFunLUT  M, cosine table size and interpolation, cosine
+                 polynomial, decimation
+    Stackzs      shift count, rows, columns, real or complex, layout,
+                 float32, threads
+    stfcsFilter  antennas, Doppler taps, delays, threads
+  and times the production case: 8 x 8 MIMO with 20 lags at
+  12.5 MS/s, as tvconvMimo of given taps, as tvconvJakesMimo generating
+  its taps, and as zhengBatch, on one thread and on --threads threads.
+
+  Each case reports ns per output sample, GB/s and Gop/s.  GB/s counts
+  the bytes a kernel has to move at least (each input read once, each
+  output written once).  The ops are flops for tvconv and stfcsFilter
+  (8 per complex tap, 2 per real one) and sinusoid evaluations for the
+  zheng generators; Stackzs only moves data.  --json writes every case, and
+  the --label (e.g. a commit hash), to a file for tracking across
+  commits.  --quick runs small sizes briefly, as a smoke test.
+*/
+
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 199309L               /* clock_gettime() */
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "llamachan.h"
+
+#define BENCH_TWOPI (6.283185307179586)
+#define BENCH_MAX_RESULTS 512
+
+/* Largest H (elements per part) a sweep allocates */
+#define BENCH_MAX_H_EL (1 << 23)
+
+/* Production case */
+#define BENCH_PROD_FS    12.5e6               /* Samples per second */
+#define BENCH_PROD_NR    8
+#define BENCH_PROD_NT    8
+#define BENCH_PROD_LAGS  20
+#define BENCH_PROD_M     8
+#define BENCH_PROD_DOPPF (100./BENCH_PROD_FS) /* 100 Hz Doppler spread */
+
+typedef struct {
+  char kernel[32];
+  char params[200];                           /* JSON members, "name": value, ... */
+  double nS;                                  /* Output samples per call */
+  double bytes;                               /* Bytes moved per call */
+  double ops;                                 /* Flops or sinusoid evaluations per call */
+  const char *opName;                         /* "flop", "sin" or NULL */
+  double secs;                                /* Seconds per call */
+  long reps;
+} benchResult;
+
+static benchResult benchResults[BENCH_MAX_RESULTS];
+static int benchNResults = 0;
+static double benchMinSecs = 0.2;             /* Time each case for at least this long */
+
+typedef void (*benchFn)(void *arg);
+
+static double benchNow(void)
+{
+#if defined(_WIN32) || defined(_WIN32_) || defined (__WIN32__)
+  return((double)clock()/CLOCKS_PER_SEC);
+#else
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return(ts.tv_sec + 1e-9*ts.tv_nsec);
+#endif
+}
+
+/* Uniform in [-1, 1) */
+static double benchRand(void)
+{
+  return(2.*rand()/((double)RAND_MAX + 1.) - 1.);
+}
+
+static double *benchAlloc(size_t n)
+{
+  double *p = (double *)malloc((n > 0 ? n : 1)*sizeof(double));
+  size_t ii;
+
+  if (NULL == p)
+    {
+      fprintf(stderr, "llamachanBench: out of memory\n");
+      exit(1);
+    }
+  for (ii = 0; ii < n; ii++)
+    {
+      p[ii] = benchRand();
+    }
+  return(p);
+}
+
+/*
+  Time fn(arg): one warm-up call, then calls until benchMinSecs have
+  passed.  Returns the seconds per call.
+*/
+static double benchTime(benchFn fn, void *arg, long *pReps)
+{
+  double t0, t;
+  long reps = 0;
+
+  fn(arg);
+  t0 = benchNow();
+  do
+    {
+      fn(arg);
+      reps++;
+    }
+  while ((t = benchNow() - t0) < benchMinSecs);
+  *pReps = reps;
+  return(t/reps);
+}
+
+static void benchRecord(const char *kernel, const char *params,
+			double nS, double bytes, double ops, const char *opName,
+			benchFn fn, void *arg)
+{
+  benchResult *r = benchResults + benchNResults;
+  char shown[200];
+  int ii, jj;
+
+  if (benchNResults >= BENCH_MAX_RESULTS)
+    {
+      return;
+    }
+  snprintf(r->kernel, sizeof r->kernel, "%s", kernel);
+  snprintf(r->params, sizeof r->params, "%s", params);
+  r->nS = nS;
+  r->bytes = bytes;
+  r->ops = ops;
+  r->opName = opName;
+  r->secs = benchTime(fn, arg, &r->reps);
+  benchNResults++;
+
+  for (ii = jj = 0; (params[ii] != '\0') && (jj < (int)sizeof(shown) - 1); ii++)
+    {
+      if (params[ii] != '"')
+	{
+	  shown[jj++] = params[ii];
+	}
+    }
+  shown[jj] = '\0';
+  printf("%-16s %-80s %10.3f %8.2f", kernel, shown, r->secs*1e9/nS, bytes/r->secs*1e-9);
+  if (opName != NULL)
+    {
+      printf(" %8.2f G%s/s\n", ops/r->secs*1e-9, opName);
+    }
+  else
+    {
+      printf("\n");
+    }
+  fflush(stdout);
+}
+
+static const char *benchIsaName(int isa)
+{
+  static const char *names[3] = {"scalar", "avx2", "avx512"};
+
+  return(((isa >= 0) && (isa <= 2)) ? names[isa] : "?");
+}
+
+/*---------------------------------------------------------------------*/
+/* tvconv                                                              */
+/*---------------------------------------------------------------------*/
+
+typedef struct {
+  int nS, nLags, longestLag, hLayout, cplxLayout, nThreads;
+  double *pOut_re, *pOut_im;
+  double *pH_re, *pH_im;
+  double *pLags;
+  double *pSrc_re, *pSrc_im;
+  tvconvWorkspace *ws;
+} benchTvconvArg;
+
+static void benchTvconvRun(void *arg)
+{
+  benchTvconvArg *a = (benchTvconvArg *)arg;
+
+  (void)tvconv(a->pOut_re, a->pOut_im, a->nS, a->nLags, a->pH_re, a->pH_im,
+	       a->hLayout, a->cplxLayout, a->pLags, a->pSrc_re, a->pSrc_im,
+	       a->longestLag, 1., 0, a->ws, a->nThreads);
+}
+
+/* layout: 0 sample-major split, 1 lag-major split, 2 lag-major interleaved */
+static void benchTvconvCase(int nS, int nLags, int isComplex, int layout, int isa)
+{
+  static const char *layoutName[3] = {"sampleMajor", "lagMajor", "interleaved"};
+  benchTvconvArg a;
+  char params[200];
+  size_t nH = (size_t)nS*nLags;
+  int interleaved = (layout == 2);
+  int el = isComplex ? 2 : 1;                 /* Doubles per complex-or-real element */
+  double *pH, *pSrc, *pOut;
+  int ii;
+
+  a.nS = nS;
+  a.nLags = nLags;
+  a.longestLag = 2*nLags - 2;
+  a.hLayout = (layout == 0) ? TVCONV_H_SAMPLE_MAJOR : TVCONV_H_LAG_MAJOR;
+  a.cplxLayout = interleaved ? TVCONV_CPLX_INTERLEAVED : TVCONV_CPLX_SPLIT;
+  a.nThreads = 1;
+  a.ws = tvconvWorkspaceCreate();
+
+  /* Every other lag, so that the taps are not all contiguous */
+  a.pLags = benchAlloc(nLags);
+  for (ii = 0; ii < nLags; ii++)
+    {
+      a.pLags[ii] = 2.*ii;
+    }
+  pH = benchAlloc(el*nH);
+  pSrc = benchAlloc((size_t)el*nS);
+  pOut = benchAlloc((size_t)el*nS);
+  a.pH_re = pH;
+  a.pSrc_re = pSrc;
+  a.pOut_re = pOut;
+  if (interleaved)
+    {
+      a.pH_im = pH + 1;
+      a.pSrc_im = pSrc + 1;
+      a.pOut_im = pOut + 1;
+    }
+  else
+    {
+      a.pH_im = isComplex ? pH + nH : NULL;
+      a.pSrc_im = isComplex ? pSrc + nS : NULL;
+      a.pOut_im = isComplex ? pOut + nS : NULL;
+    }
+
+  (void)tvconvSelectIsa(isa);
+  sprintf(params, "\"nS\": %d, \"nLags\": %d, \"complex\": %s, \"layout\": \"%s\", \"isa\": \"%s\"",
+	  nS, nLags, isComplex ? "true" : "false", layoutName[layout],
+	  benchIsaName(tvconvSelectIsa(isa)));
+  benchRecord("tvconv", params, nS,
+	      8.*el*((double)nH + (nS + a.longestLag) + nS),
+	      (isComplex ? 8. : 2.)*(double)nH, "flop",
+	      benchTvconvRun, &a);
+  (void)tvconvSelectIsa(TVCONV_ISA_AUTO);
+
+  tvconvWorkspaceDestroy(a.ws);
+  free(a.pLags);
+  free(pH);
+  free(pSrc);
+  free(pOut);
+}
+
+static void benchTvconv(int quick)
+{
+  static const int nSs[3] = {4096, 65536, 1048576};
+  static const int nLagss[4] = {1, 5, 20, 64};
+  int iS, iL, isComplex, layout, isa;
+
+  for (iS = 0; iS < (quick ? 1 : 3); iS++)
+    {
+      for (iL = 0; iL < 4; iL++)
+	{
+	  if ((size_t)nSs[iS]*nLagss[iL] > BENCH_MAX_H_EL)
+	    {
+	      continue;
+	    }
+	  for (isComplex = 0; isComplex <= 1; isComplex++)
+	    {
+	      for (layout = 0; layout <= (isComplex ? 2 : 1); layout++)
+		{
+		  benchTvconvCase(nSs[iS], nLagss[iL], isComplex, layout, TVCONV_ISA_AUTO);
+		}
+	    }
+	}
+    }
+
+  /* Each instruction set, on complex sample-major channels */
+  for (isa = TVCONV_ISA_SCALAR; isa <= TVCONV_ISA_AVX512; isa++)
+    {
+      if (tvconvSelectIsa(isa) != isa)
+	{
+	  continue;
+	}
+      for (iL = 0; iL < 4; iL++)
+	{
+	  benchTvconvCase(quick ? 4096 : 65536, nLagss[iL], 1, 0, isa);
+	}
+    }
+  (void)tvconvSelectIsa(TVCONV_ISA_AUTO);
+}
+
+/*---------------------------------------------------------------------*/
+/* zheng generators                                                    */
+/*---------------------------------------------------------------------*/
+
+typedef struct {
+  int nS, m, lutSize;
+  const char *lutInterp;
+  double f, tol, cosTol;
+  double *t, *hr, *hi;
+  double *pAlph, *pPhi, *pSphi;
+} benchZhengArg;
+
+static void benchZhengRun(void *arg)
+{
+  benchZhengArg *a = (benchZhengArg *)arg;
+
+  (void)zhengFunLUT(a->hr, a->hi, 1, a->t, a->nS, a->f, a->pAlph, a->pPhi, a->pSphi, a->m,
+		    a->tol, a->cosTol, a->lutSize, a->lutInterp);
+}
+
+/* Random 'zheng' chanstates of m sinusoids each, as GetWssusChannel.m makes them */
+static void benchZhengStates(double *pAlph, double *pPhi, double *pSphi, int m, size_t nStates)
+{
+  double theta;
+  size_t s;
+  int ii;
+
+  for (s = 0; s < nStates; s++)
+    {
+      theta = BENCH_TWOPI*(benchRand() + 1.)/2.;
+      for (ii = 0; ii < m; ii++)
+	{
+	  pAlph[s*m + ii] = (BENCH_TWOPI*(ii + 1) - BENCH_TWOPI/2. + theta)/(4.*m);
+	  pPhi[s*m + ii] = BENCH_TWOPI*(benchRand() + 1.)/2.;
+	  pSphi[s*m + ii] = BENCH_TWOPI*(benchRand() + 1.)/2.;
+	}
+    }
+}
+
+static void benchZhengCase(benchZhengArg *a, const char *mode)
+{
+  char params[200];
+
+  sprintf(params, "\"nS\": %d, \"M\": %d, \"mode\": \"%s\", \"lutSize\": %d, "
+	  "\"cosTol\": %g, \"tol\": %g, \"doppf\": %g",
+	  a->nS, a->m, mode, a->lutSize, a->cosTol, a->tol, a->f);
+  benchRecord("zhengFunLUT", params, a->nS, 16.*a->nS, 2.*a->m*(double)a->nS, "sin",
+	      benchZhengRun, a);
+}
+
+static void benchZheng(int quick)
+{
+  static const int ms[3] = {4, 8, 16};
+  static const int lutSizes[4] = {256, 1024, 4096, 65536};
+  static const double cosTols[3] = {1e-6, 1e-9, 1e-12};
+  static const double doppfs[2] = {1e-4, 1e-2};
+  benchZhengArg a;
+  int iM, ii, k;
+
+  a.nS = quick ? 4096 : 65536;
+  a.t = benchAlloc(a.nS);
+  a.hr = benchAlloc(a.nS);
+  a.hi = benchAlloc(a.nS);
+  a.pAlph = benchAlloc(16);
+  a.pPhi = benchAlloc(16);
+  a.pSphi = benchAlloc(16);
+  for (k = 0; k < a.nS; k++)
+    {
+      a.t[k] = 1e6 + k;
+    }
+
+  for (iM = 0; iM < 3; iM++)
+    {
+      a.m = ms[iM];
+      benchZhengStates(a.pAlph, a.pPhi, a.pSphi, a.m, 1);
+      a.f = 1e-3;
+      a.tol = 0.;
+      a.cosTol = 0.;
+      for (ii = 0; ii < 4; ii++)
+	{
+	  a.lutSize = lutSizes[ii];
+	  a.lutInterp = "nearest";
+	  benchZhengCase(&a, "nearest");
+	  a.lutInterp = "linear";
+	  benchZhengCase(&a, "linear");
+	}
+      a.lutSize = 1024;
+      a.lutInterp = "linear";
+      for (ii = 0; ii < 3; ii++)
+	{
+	  a.cosTol = cosTols[ii];
+	  benchZhengCase(&a, "polynomial");
+	}
+      a.tol = 1e-6;
+      a.cosTol = 1e-9;
+      for (ii = 0; ii < 2; ii++)
+	{
+	  a.f = doppfs[ii];
+	  benchZhengCase(&a, "decimated");
+	}
+    }
+
+  free(a.t);
+  free(a.hr);
+  free(a.hi);
+  free(a.pAlph);
+  free(a.pPhi);
+  free(a.pSphi);
+}
+
+/*---------------------------------------------------------------------*/
+/* Stackzs                                                             */
+/*---------------------------------------------------------------------*/
+
+typedef struct {
+  int nr, nc, nShifts, isComplex;
+  int layout, isSingle, nThreads;
+  double *pIn, *pOut, *pShifts;               /* pIn and pOut hold floats when isSingle */
+} benchStackzsArg;
+
+/* Split complex data is stacked in one pass, as the MEX function does */
+static void benchStackzsRun(void *arg)
+{
+  benchStackzsArg *a = (benchStackzsArg *)arg;
+  size_t elSize = a->isSingle ? sizeof(float) : sizeof(double);
+  size_t nIn = (size_t)a->nr*a->nc;
+
+  (void)stackzsCopy(a->pOut, a->isComplex ? (char *)a->pOut + elSize*nIn*a->nShifts : NULL,
+		    a->pIn, a->isComplex ? (char *)a->pIn + elSize*nIn : NULL,
+		    elSize, a->nr, a->nc, a->nShifts, a->pShifts, a->layout, a->nThreads);
+}
+
+static void benchStackzsCase(benchStackzsArg *a)
+{
+  static const char *layoutNames[2] = {"stacked", "shiftMajor"};
+  char params[200];
+  size_t nOut = (size_t)a->nr*a->nc*a->nShifts*(a->isComplex ? 2 : 1);
+  int ii;
+
+  /* Doubles enough for either type; only copied, so any bits do */
+  a->pIn = benchAlloc((size_t)a->nr*a->nc*(a->isComplex ? 2 : 1));
+  a->pOut = benchAlloc(nOut);
+  a->pShifts = benchAlloc(a->nShifts);
+  for (ii = 0; ii < a->nShifts; ii++)
+    {
+      a->pShifts[ii] = ii - a->nShifts/2;
+    }
+  sprintf(params, "\"nr\": %d, \"nc\": %d, \"nShifts\": %d, \"complex\": %s, "
+	  "\"layout\": \"%s\", \"single\": %s, \"threads\": %d",
+	  a->nr, a->nc, a->nShifts, a->isComplex ? "true" : "false",
+	  layoutNames[a->layout], a->isSingle ? "true" : "false", a->nThreads);
+  benchRecord("Stackzs", params, a->nc, (a->isSingle ? 8. : 16.)*(double)nOut, 0., NULL,
+	      benchStackzsRun, a);
+  free(a->pIn);
+  free(a->pOut);
+  free(a->pShifts);
+}
+
+/*
+  The stacked double sweep on one thread, as Stackzs.m returns it, then
+  the shift-major layout, float32 and nThreads threads on the wide
+  stackings.
+*/
+static void benchStackzs(int quick, int nThreads)
+{
+  static const int nrs[2] = {4, 8};
+  static const int ncs[2] = {4096, 65536};
+  static const int nShiftss[4] = {1, 5, 21, 65};
+  benchStackzsArg a;
+  int iR, iC, iN;
+
+  a.layout = STACKZS_LAYOUT_STACKED;
+  a.isSingle = 0;
+  a.nThreads = 1;
+  for (iC = 0; iC < (quick ? 1 : 2); iC++)
+    {
+      for (iR = 0; iR < 2; iR++)
+	{
+	  for (iN = 0; iN < 4; iN++)
+	    {
+	      for (a.isComplex = 0; a.isComplex <= 1; a.isComplex++)
+		{
+		  a.nr = nrs[iR];
+		  a.nc = ncs[iC];
+		  a.nShifts = nShiftss[iN];
+		  benchStackzsCase(&a);
+		}
+	    }
+	}
+    }
+
+  a.nr = nrs[1];
+  a.nc = ncs[quick ? 0 : 1];
+  a.isComplex = 1;
+  for (iN = 2; iN < 4; iN++)
+    {
+      a.nShifts = nShiftss[iN];
+      for (a.layout = STACKZS_LAYOUT_STACKED; a.layout <= STACKZS_LAYOUT_SHIFT_MAJOR; a.layout++)
+	{
+	  for (a.isSingle = 0; a.isSingle <= 1; a.isSingle++)
+	    {
+	      a.nThreads = 1;
+	      benchStackzsCase(&a);
+	      if (nThreads != 1)
+		{
+		  a.nThreads = nThreads;
+		  benchStackzsCase(&a);
+		}
+	    }
+	}
+    }
+}
+
+/*---------------------------------------------------------------------*/
+/* stfcsFilter                                                         */
+/*---------------------------------------------------------------------*/
+
+typedef struct {
+  int nR, nT, nDop, nDelay, nS, nThreads;
+  double *pH_re, *pH_im, *pFreq, *pPhi;
+  double *pS_re, *pS_im, *pY_re, *pY_im;
+} benchStfcsArg;
+
+static void benchStfcsRun(void *arg)
+{
+  benchStfcsArg *a = (benchStfcsArg *)arg;
+
+  (void)stfcsFilter(a->pY_re, a->pY_im, 1, a->pH_re, a->pH_im, 1,
+		    a->nR, a->nT, a->nDop, a->nDelay, a->pFreq, a->pPhi, 1e6,
+		    a->pS_re, a->pS_im, 1, a->nS + a->nDelay - 1, a->nThreads);
+}
+
+static void benchStfcsCase(int nAnt, int nDop, int nDelay, int nS, int nThreads)
+{
+  benchStfcsArg a;
+  char params[200];
+  size_t nH = (size_t)nAnt*nAnt*nDop*nDelay, nSrc = (size_t)nAnt*(nS + nDelay - 1);
+  int ii;
+
+  a.nR = a.nT = nAnt;
+  a.nDop = nDop;
+  a.nDelay = nDelay;
+  a.nS = nS;
+  a.nThreads = nThreads;
+  a.pH_re = benchAlloc(nH);
+  a.pH_im = benchAlloc(nH);
+  a.pS_re = benchAlloc(nSrc);
+  a.pS_im = benchAlloc(nSrc);
+  a.pY_re = benchAlloc((size_t)nAnt*nS);
+  a.pY_im = benchAlloc((size_t)nAnt*nS);
+  /* Doppler taps spread over +-1e-3 cycles per sample, as GetSampledChannel.m */
+  a.pFreq = benchAlloc(nDop);
+  a.pPhi = benchAlloc(nDop);
+  for (ii = 0; ii < nDop; ii++)
+    {
+      a.pFreq[ii] = (nDop > 1) ? 2e-3*ii/(nDop - 1) - 1e-3 : 0.;
+    }
+
+  sprintf(params, "\"nR\": %d, \"nT\": %d, \"nDop\": %d, \"nDelay\": %d, \"nS\": %d, \"threads\": %d",
+	  nAnt, nAnt, nDop, nDelay, nS, nThreads);
+  benchRecord("stfcsFilter", params, nS,
+	      16.*((double)nH + nSrc + (double)nAnt*nS),
+	      8.*(double)nH*nS, "flop",
+	      benchStfcsRun, &a);
+
+  free(a.pH_re);
+  free(a.pH_im);
+  free(a.pS_re);
+  free(a.pS_im);
+  free(a.pY_re);
+  free(a.pY_im);
+  free(a.pFreq);
+  free(a.pPhi);
+}
+
+/*
+  Antennas, Doppler taps and delays of the sampled channel, then the
+  8 x 8 case on nThreads threads
+*/
+static void benchStfcs(int quick, int nThreads)
+{
+  static const int nAnts[2] = {1, 8};
+  static const int nDops[2] = {1, 5};
+  static const int nDelays[2] = {4, 20};
+  int nS = quick ? 4096 : 65536;
+  int iA, iD, iL;
+
+  for (iA = 0; iA < 2; iA++)
+    {
+      for (iD = 0; iD < 2; iD++)
+	{
+	  for (iL = 0; iL < 2; iL++)
+	    {
+	      benchStfcsCase(nAnts[iA], nDops[iD], nDelays[iL], nS, 1);
+	    }
+	}
+    }
+  if (nThreads != 1)
+    {
+      for (iD = 0; iD < 2; iD++)
+	{
+	  benchStfcsCase(nAnts[1], nDops[iD], nDelays[1], nS, nThreads);
+	}
+    }
+}
+
+/*---------------------------------------------------------------------*/
+/* Production case: 8 x 8 MIMO, 20 lags, 12.5 MS/s                     */
+/*---------------------------------------------------------------------*/
+
+typedef struct {
+  int nS, nThreads;
+  int pNLags[BENCH_PROD_NR*BENCH_PROD_NT];
+  double *pH_re[BENCH_PROD_NR*BENCH_PROD_NT], *pH_im[BENCH_PROD_NR*BENCH_PROD_NT];
+  double *pLags[BENCH_PROD_NR*BENCH_PROD_NT];
+  double *pSrc_re[BENCH_PROD_NR*BENCH_PROD_NT], *pSrc_im[BENCH_PROD_NR*BENCH_PROD_NT];
+  double *pOut_re, *pOut_im;
+  double *pAlph, *pPhi, *pSphi;               /* M x lags x pairs */
+  double *Hr, *Hi;                            /* zhengBatch output */
+  tvconvJakesTap *pTaps;
+  tvconvWorkspace *ws;
+  double tol;
+} benchProdArg;
+
+static void benchProdMimoRun(void *arg)
+{
+  benchProdArg *a = (benchProdArg *)arg;
+
+  (void)tvconvMimo(a->pOut_re, a->pOut_im, BENCH_PROD_NR, BENCH_PROD_NT, a->nS, a->pNLags,
+		   a->pH_re, a->pH_im, TVCONV_H_LAG_MAJOR, TVCONV_CPLX_SPLIT, a->pLags,
+		   a->pSrc_re, a->pSrc_im, BENCH_PROD_LAGS - 1, 1., 0, a->ws, a->nThreads);
+}
+
+static void benchProdJakesRun(void *arg)
+{
+  benchProdArg *a = (benchProdArg *)arg;
+
+  (void)tvconvJakesMimo(a->pOut_re, a->pOut_im, BENCH_PROD_NR, BENCH_PROD_NT, a->nS, a->pNLags,
+			a->pTaps, 1e6, TVCONV_CPLX_SPLIT, a->pLags,
+			a->pSrc_re, a->pSrc_im, BENCH_PROD_LAGS - 1, 1., 0, a->ws, a->nThreads);
+}
+
+static void benchProdBatchRun(void *arg)
+{
+  benchProdArg *a = (benchProdArg *)arg;
+
+  (void)zhengBatch(a->Hr, a->Hi, 1, 1e6, a->nS, BENCH_PROD_DOPPF, BENCH_PROD_M,
+		   a->pAlph, a->pPhi, a->pSphi, BENCH_PROD_LAGS, BENCH_PROD_NR*BENCH_PROD_NT,
+		   NULL, a->tol, 1e-9, 0, NULL, a->nThreads);
+}
+
+static void benchProd(int quick, int nThreads)
+{
+  int nPairs = BENCH_PROD_NR*BENCH_PROD_NT;
+  int nTaps = nPairs*BENCH_PROD_LAGS;
+  size_t nH;
+  benchProdArg a;
+  char params[200];
+  double bytes, nSOut;
+  int p, ii, iThreads, iTol;
+  int threads[2];
+
+  a.nS = quick ? 1250 : 125000;               /* 0.1 or 10 ms of signal */
+  nH = (size_t)a.nS*BENCH_PROD_LAGS;
+  a.ws = tvconvWorkspaceCreate();
+  a.pOut_re = benchAlloc((size_t)BENCH_PROD_NR*a.nS);
+  a.pOut_im = benchAlloc((size_t)BENCH_PROD_NR*a.nS);
+  a.pAlph = benchAlloc((size_t)BENCH_PROD_M*nTaps);
+  a.pPhi = benchAlloc((size_t)BENCH_PROD_M*nTaps);
+  a.pSphi = benchAlloc((size_t)BENCH_PROD_M*nTaps);
+  a.Hr = benchAlloc(nH*nPairs);
+  a.Hi = benchAlloc(nH*nPairs);
+  a.pTaps = (tvconvJakesTap *)calloc(nTaps, sizeof(tvconvJakesTap));
+  benchZhengStates(a.pAlph, a.pPhi, a.pSphi, BENCH_PROD_M, nTaps);
+  for (p = 0; p < nPairs; p++)
+    {
+      a.pNLags[p] = BENCH_PROD_LAGS;
+      a.pLags[p] = benchAlloc(BENCH_PROD_LAGS);
+      for (ii = 0; ii < BENCH_PROD_LAGS; ii++)
+	{
+	  a.pLags[p][ii] = ii;
+	}
+      /* The pairs' H are views of the zhengBatch output, lag-major */
+      a.pH_re[p] = a.Hr + nH*p;
+      a.pH_im[p] = a.Hi + nH*p;
+      a.pSrc_re[p] = benchAlloc(a.nS + BENCH_PROD_LAGS);
+      a.pSrc_im[p] = benchAlloc(a.nS + BENCH_PROD_LAGS);
+    }
+  for (ii = 0; ii < nTaps; ii++)
+    {
+      a.pTaps[ii].M = BENCH_PROD_M;
+      a.pTaps[ii].gain = 1./sqrt((double)BENCH_PROD_LAGS);
+      a.pTaps[ii].doppf = BENCH_PROD_DOPPF;
+      a.pTaps[ii].pAlph = a.pAlph + (size_t)BENCH_PROD_M*ii;
+      a.pTaps[ii].pPhi = a.pPhi + (size_t)BENCH_PROD_M*ii;
+      a.pTaps[ii].pSphi = a.pSphi + (size_t)BENCH_PROD_M*ii;
+    }
+
+  /* Bytes of H and sources read and of outputs written, per call */
+  nSOut = (double)BENCH_PROD_NR*a.nS;
+  bytes = 16.*((double)nH*nPairs + (double)(a.nS + BENCH_PROD_LAGS)*nPairs + nSOut);
+
+  threads[0] = 1;
+  threads[1] = nThreads;
+  for (iThreads = 0; iThreads < ((nThreads != 1) ? 2 : 1); iThreads++)
+    {
+      a.nThreads = threads[iThreads];
+      sprintf(params, "\"nR\": %d, \"nT\": %d, \"nLags\": %d, \"nS\": %d, "
+	      "\"fs_msps\": %g, \"threads\": %d",
+	      BENCH_PROD_NR, BENCH_PROD_NT, BENCH_PROD_LAGS, a.nS, BENCH_PROD_FS*1e-6, a.nThreads);
+      benchRecord("tvconvMimo", params, nSOut, bytes, 8.*(double)nH*nPairs, "flop",
+		  benchProdMimoRun, &a);
+
+      for (iTol = 0; iTol < 2; iTol++)
+	{
+	  a.tol = iTol ? 1e-6 : 0.;
+	  for (ii = 0; ii < nTaps; ii++)
+	    {
+	      tvconvJakesTapPlan(a.pTaps + ii, a.tol);
+	    }
+	  sprintf(params, "\"nR\": %d, \"nT\": %d, \"nLags\": %d, \"nS\": %d, "
+		  "\"fs_msps\": %g, \"threads\": %d, \"tol\": %g",
+		  BENCH_PROD_NR, BENCH_PROD_NT, BENCH_PROD_LAGS, a.nS, BENCH_PROD_FS*1e-6,
+		  a.nThreads, a.tol);
+	  benchRecord("tvconvJakesMimo", params, nSOut,
+		      16.*((double)(a.nS + BENCH_PROD_LAGS)*nPairs + nSOut),
+		      8.*(double)nH*nPairs, "flop", benchProdJakesRun, &a);
+	  benchRecord("zhengBatch", params, nSOut, 16.*(double)nH*nPairs,
+		      2.*BENCH_PROD_M*(double)nH*nPairs/((a.pTaps[0].decim > 1) ? a.pTaps[0].decim : 1),
+		      "sin", benchProdBatchRun, &a);
+	}
+    }
+
+  for (p = 0; p < nPairs; p++)
+    {
+      free(a.pLags[p]);
+      free(a.pSrc_re[p]);
+      free(a.pSrc_im[p]);
+    }
+  tvconvWorkspaceDestroy(a.ws);
+  free(a.pOut_re);
+  free(a.pOut_im);
+  free(a.pAlph);
+  free(a.pPhi);
+  free(a.pSphi);
+  free(a.Hr);
+  free(a.Hi);
+  free(a.pTaps);
+}
+
+/*---------------------------------------------------------------------*/
+
+static int benchWriteJson(const char *path, const char *label, int nThreads, int quick)
+{
+  FILE *fp = fopen(path, "w");
+  benchResult *r;
+  int ii;
+
+  if (NULL == fp)
+    {
+      fprintf(stderr, "llamachanBench: cannot write %s\n", path);
+      return(1);
+    }
+  fprintf(fp, "{\n  \"suite\": \"llamachanBench\",\n  \"label\": \"");
+  for (ii = 0; label[ii] != '\0'; ii++)
+    {
+      if ((label[ii] == '"') || (label[ii] == '\\'))
+	{
+	  fputc('\\', fp);
+	}
+      if ((unsigned char)label[ii] >= ' ')
+	{
+	  fputc(label[ii], fp);
+	}
+    }
+  fprintf(fp, "\",\n  \"tvconvIsa\": \"%s\",\n  \"threads\": %d,\n  \"quick\": %s,\n"
+	  "  \"results\": [\n", benchIsaName(tvconvSelectIsa(TVCONV_ISA_AUTO)), nThreads,
+	  quick ? "true" : "false");
+  for (ii = 0; ii < benchNResults; ii++)
+    {
+      r = benchResults + ii;
+      fprintf(fp, "    {\"kernel\": \"%s\", %s, \"reps\": %ld, \"seconds\": %.6e, "
+	      "\"ns_per_sample\": %.6g, \"gb_per_s\": %.6g, ",
+	      r->kernel, r->params, r->reps, r->secs, r->secs*1e9/r->nS, r->bytes/r->secs*1e-9);
+      if (r->opName != NULL)
+	{
+	  fprintf(fp, "\"g%s_per_s\": %.6g}", r->opName, r->ops/r->secs*1e-9);
+	}
+      else
+	{
+	  fprintf(fp, "\"gflop_per_s\": null}");
+	}
+      fprintf(fp, "%s\n", (ii + 1 < benchNResults) ? "," : "");
+    }
+  fprintf(fp, "  ]\n}\n");
+  return(fclose(fp) != 0);
+}
+
+int main(int argc, char *argv[])
+{
+  const char *jsonPath = NULL;
+  const char *label = "";
+  int quick = 0, nThreads = 0;
+  int ii;
+
+  for (ii = 1; ii < argc; ii++)
+    {
+      if (0 == strcmp(argv[ii], "--quick"))
+	{
+	  quick = 1;
+	}
+      else if ((0 == strcmp(argv[ii], "--json")) && (ii + 1 < argc))
+	{
+	  jsonPath = argv[++ii];
+	}
+      else if ((0 == strcmp(argv[ii], "--label")) && (ii + 1 < argc))
+	{
+	  label = argv[++ii];
+	}
+      else if ((0 == strcmp(argv[ii], "--threads")) && (ii + 1 < argc))
+	{
+	  nThreads = atoi(argv[++ii]);
+	}
+      else
+	{
+	  fprintf(stderr, "usage: %s [--quick] [--threads n] [--label text] [--json file]\n",
+		  argv[0]);
+	  return(2);
+	}
+    }
+  benchMinSecs = quick ? 0.01 : 0.2;
+
+  srand(1);
+  printf("%-16s %-80s %10s %8s %14s\n", "kernel", "parameters", "ns/sample", "GB/s", "ops");
+  benchTvconv(quick);
+  benchZheng(quick);
+  benchStackzs(quick, nThreads);
+  benchStfcs(quick, nThreads);
+  benchProd(quick, nThreads);
+
+  return((jsonPath != NULL) ? benchWriteJson(jsonPath, label, nThreads, quick) : 0);
+}
+
+
+/*
+  This material is based upon work supported by the Defense Advanced Research
+  Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+  findings, conclusions or recommendations expressed in this material are those
+  of the author(s) and do not necessarily reflect the views of the Defense
+  Advanced Research Projects Agency.
+
+  © 2019 Massachusetts Institute of Technology.
+
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License version 2 as
+  published by the Free Software Foundation;
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+  POSSIBILITY OF SUCH DAMAGE.
+*/
@@ -0,0 +1,1213 @@
+/*
+  This material is based upon work supported by the Defense Advanced Research
+  Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+  findings, conclusions or recommendations expressed in this material are those
+  of the author(s) and do not necessarily reflect the views of the Defense
+  Advanced Research Projects Agency.
+
+  © 2019 Massachusetts Institute of Technology.
+
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License version 2 as
+  published by the Free Software Foundation;
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+  POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  Golden-vector harness of libllamachan (see llamachan.h): checks every
+  variant of the native kernels against outputs of their references,
+  TVConv.m, Stackzs.m and the zheng subfunction of jakes4.m, stored once
+  in a fixture file.  Not a MEX function: built by
+  CMakeLists.txt, or by hand with
+
+    cc -O2 llamachanGolden.c TVConv.c Stackzs.c StackzsCov.c StackzsApply.c \
+       StfcsFilter.c zhengFunLUT.c zhengBatch.c -o llamachanGolden -lm -lpthread
+
+  and run as
+
+    ./llamachanGolden [fixture]            check, llamachanGolden.bin by default
+    ./llamachanGolden --export [fixture]   write a fixture
+
+  The fixture is written by ExportGoldenVectors.m, which runs the MATLAB
+  references themselves, or by --export, which runs a line-by-line C
+  port of them for machines without MATLAB.  Its first 8 bytes say
+  which: GOLDEN_MAGIC_MATLAB or GOLDEN_MAGIC_CPORT, and the harness
+  prints it.  The checked-in llamachanGolden.bin comes from the C port,
+  so it pins the kernels to that port, not to MATLAB, until
+  ExportGoldenVectors.m is run again.  The rest of the file is
+  little-endian records, each
+    int32 kind, int32 nInts, int32 nArrays,
+    nInts int32 values,
+    nArrays times: int32 length, length float64 values
+  with these ints and arrays (an empty imaginary part is a real array):
+    GOLDEN_TVCONV   nS, nLags, longestLag;
+                    lags, H (nS x nLags) re, im, source re, im, output re, im
+    GOLDEN_STACKZS  nr, nc, nShifts;
+                    shifts, z (nr x nc) re, im, output re, im
+    GOLDEN_ZHENG    M, nS, nTaps;
+                    [doppf start], alph, phi, sphi (M x nTaps),
+                    jakes4 output (nTaps x nS) re, im
+    GOLDEN_JAKES    nS, nLags, longestLag, M;
+                    [doppf start], lags, gains, alph, phi, sphi (M x nLags),
+                    source re, im, output of TVConv.m for the Jakes
+                    channel struct re, im
+
+  Each variant of a kernel (instruction set, H or output layout, complex
+  storage, accumulation into pairs, float32, cosine table or polynomial,
+  decimation, batching) has an error budget: the largest
+  |output - reference| over the rms of the reference it may reach.
+  Threaded runs must be bit-identical to the single-threaded run they
+  split up, which the fixture's small records cannot show, so that is
+  checked on larger generated inputs.  The exit status is the number
+  of failures.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "llamachan.h"
+
+#define GOLDEN_PI (3.141592653589793)
+#define GOLDEN_MAGIC_MATLAB "LLCGOLD1"      /* Written by ExportGoldenVectors.m */
+#define GOLDEN_MAGIC_CPORT  "LLCCREF1"      /* Written by --export */
+#define GOLDEN_DEFAULT_FILE "llamachanGolden.bin"
+
+/* Record kinds */
+#define GOLDEN_TVCONV  1
+#define GOLDEN_STACKZS 2
+#define GOLDEN_ZHENG   3
+#define GOLDEN_JAKES   4
+
+#define GOLDEN_MAX_INTS   8
+#define GOLDEN_MAX_ARRAYS 12
+
+/* H layouts of the tvconv variants, output layouts of the Stackzs ones */
+#define GOLDEN_SAMPLE_MAJOR 0
+#define GOLDEN_LAG_MAJOR    1
+#define GOLDEN_INTERLEAVED  2                 /* Lag-major or stacked, complex arrays as (re, im) pairs */
+#define GOLDEN_ADDED_PAIRS  3                 /* Lag-major, added into a complex interleaved output */
+#define GOLDEN_STACKED      0
+#define GOLDEN_SHIFT_MAJOR  1
+
+typedef struct {
+  int kind;
+  int nInts;
+  int ints[GOLDEN_MAX_INTS];
+  int nArrays;
+  int lens[GOLDEN_MAX_ARRAYS];
+  double *arrays[GOLDEN_MAX_ARRAYS];
+} goldenRecord;
+
+typedef struct {
+  const char *name;
+  int kind;
+  double budget;                              /* Largest max|error|/rms(reference) */
+  int isa;                                    /* tvconv instruction set */
+  int layout;                                 /* tvconv H layout or Stackzs output layout */
+  double tol;                                 /* Decimation tolerance of the Jakes taps */
+  double cosTol;                              /* 0 for the cosine table */
+  int lutSize;
+  const char *lutInterp;
+  int batch;                                  /* zheng taps by zhengBatch, not zhengFunLUT */
+  int single;                                 /* Stackzs of float32 data */
+} goldenVariant;
+
+/*
+  The budgets: a tvconv output is a sum of up to 20 products, off by a
+  few rounding errors of each.  A 'zheng' tap is a sum of 2M <= 32
+  cosines scaled by 1/sqrt(4M), so an error e of each cosine (pi/N for a
+  nearest N-entry table, (2 pi/N)^2/8 for a linear one, cosTol for a
+  polynomial) moves it by up to sqrt(2M) e, times 1.5 for margin, on top
+  of the rounding of the reference's own phases (1e-11).  The fixture's
+  taps have M <= 16.  Decimated taps
+  are within tol of their rms amplitude, and the Jakes taps of tvconv are
+  run as exact rotations.  Stackzs only moves data, exactly, but float32
+  data is rounded first, by up to 2^-24 of the largest input: the
+  fixture's inputs are uniform, so about 2^-24 sqrt(3) = 1e-7 of their
+  rms, with some margin for the shortest records.
+*/
+static const goldenVariant goldenVariants[] = {
+  {"tvconv scalar",              GOLDEN_TVCONV,  1e-13,  TVCONV_ISA_SCALAR, GOLDEN_SAMPLE_MAJOR, 0.,   0.,    0,     NULL,      0, 0},
+  {"tvconv scalar lagMajor",     GOLDEN_TVCONV,  1e-13,  TVCONV_ISA_SCALAR, GOLDEN_LAG_MAJOR,    0.,   0.,    0,     NULL,      0, 0},
+  {"tvconv scalar interleaved",  GOLDEN_TVCONV,  1e-13,  TVCONV_ISA_SCALAR, GOLDEN_INTERLEAVED,  0.,   0.,    0,     NULL,      0, 0},
+  {"tvconv scalar added pairs",  GOLDEN_TVCONV,  1e-13,  TVCONV_ISA_SCALAR, GOLDEN_ADDED_PAIRS,  0.,   0.,    0,     NULL,      0, 0},
+  {"tvconv avx2",                GOLDEN_TVCONV,  1e-13,  TVCONV_ISA_AVX2,   GOLDEN_SAMPLE_MAJOR, 0.,   0.,    0,     NULL,      0, 0},
+  {"tvconv avx2 lagMajor",       GOLDEN_TVCONV,  1e-13,  TVCONV_ISA_AVX2,   GOLDEN_LAG_MAJOR,    0.,   0.,    0,     NULL,      0, 0},
+  {"tvconv avx2 interleaved",    GOLDEN_TVCONV,  1e-13,  TVCONV_ISA_AVX2,   GOLDEN_INTERLEAVED,  0.,   0.,    0,     NULL,      0, 0},
+  {"tvconv avx2 added pairs",    GOLDEN_TVCONV,  1e-13,  TVCONV_ISA_AVX2,   GOLDEN_ADDED_PAIRS,  0.,   0.,    0,     NULL,      0, 0},
+  {"tvconv avx512",              GOLDEN_TVCONV,  1e-13,  TVCONV_ISA_AVX512, GOLDEN_SAMPLE_MAJOR, 0.,   0.,    0,     NULL,      0, 0},
+  {"tvconv avx512 lagMajor",     GOLDEN_TVCONV,  1e-13,  TVCONV_ISA_AVX512, GOLDEN_LAG_MAJOR,    0.,   0.,    0,     NULL,      0, 0},
+  {"tvconv avx512 interleaved",  GOLDEN_TVCONV,  1e-13,  TVCONV_ISA_AVX512, GOLDEN_INTERLEAVED,  0.,   0.,    0,     NULL,      0, 0},
+  {"tvconv avx512 added pairs",  GOLDEN_TVCONV,  1e-13,  TVCONV_ISA_AVX512, GOLDEN_ADDED_PAIRS,  0.,   0.,    0,     NULL,      0, 0},
+  {"Stackzs",                    GOLDEN_STACKZS, 0.,     0,                 0,                   0.,   0.,    0,     NULL,      0, 0},
+  {"stackzsCopy shiftMajor",     GOLDEN_STACKZS, 0.,     0,                 GOLDEN_SHIFT_MAJOR,  0.,   0.,    0,     NULL,      0, 0},
+  {"stackzsCopy interleaved",    GOLDEN_STACKZS, 0.,     0,                 GOLDEN_INTERLEAVED,  0.,   0.,    0,     NULL,      0, 0},
+  {"stackzsCopy float32",        GOLDEN_STACKZS, 1.2e-7, 0,                 GOLDEN_STACKED,      0.,   0.,    0,     NULL,      0, 1},
+  {"zheng table linear 1024",    GOLDEN_ZHENG,   4e-5,   0,                 0,                   0.,   0.,    1024,  "linear",  0, 0},
+  {"zheng table linear 65536",   GOLDEN_ZHENG,   1e-8,   0,                 0,                   0.,   0.,    65536, "linear",  0, 0},
+  {"zheng table nearest 4096",   GOLDEN_ZHENG,   6.5e-3, 0,                 0,                   0.,   0.,    4096,  "nearest", 0, 0},
+  {"zheng polynomial 1e-6",      GOLDEN_ZHENG,   8.5e-6, 0,                 0,                   0.,   1e-6,  0,     NULL,      0, 0},
+  {"zheng polynomial 1e-9",      GOLDEN_ZHENG,   8.5e-9, 0,                 0,                   0.,   1e-9,  0,     NULL,      0, 0},
+  {"zheng polynomial 1e-12",     GOLDEN_ZHENG,   2e-11,  0,                 0,                   0.,   1e-12, 0,     NULL,      0, 0},
+  {"zheng decimated 1e-6",       GOLDEN_ZHENG,   1e-6,   0,                 0,                   1e-6, 1e-12, 0,     NULL,      0, 0},
+  {"zhengBatch polynomial 1e-9", GOLDEN_ZHENG,   8.5e-9, 0,                 0,                   0.,   1e-9,  0,     NULL,      1, 0},
+  {"zhengBatch decimated 1e-6",  GOLDEN_ZHENG,   1e-6,   0,                 0,                   1e-6, 1e-12, 0,     NULL,      1, 0},
+  {"tvconvJakesMimo",            GOLDEN_JAKES,   1e-10,  TVCONV_ISA_AUTO,   0,                   0.,   0.,    0,     NULL,      0, 0},
+  {"tvconvJakesMimo decimated",  GOLDEN_JAKES,   1e-6,   TVCONV_ISA_AUTO,   0,                   1e-6, 0.,    0,     NULL,      0, 0}
+};
+
+#define GOLDEN_N_VARIANTS ((int)(sizeof(goldenVariants)/sizeof(goldenVariants[0])))
+
+static int goldenFailures = 0;
+
+static void goldenCheck(const char *name, const char *record, double err, double budget)
+{
+  int pass = (err <= budget);
+
+  printf("%-4s %-30s %-34s error %.3e budget %.1e\n", pass ? "ok" : "FAIL",
+	 name, record, err, budget);
+  goldenFailures += !pass;
+}
+
+static double *goldenAlloc(size_t n)
+{
+  double *p = (double *)calloc(n > 0 ? n : 1, sizeof(double));
+
+  if (NULL == p)
+    {
+      fprintf(stderr, "llamachanGolden: out of memory\n");
+      exit(1);
+    }
+  return(p);
+}
+
+/* Uniform in [0, 1) */
+static double goldenRand(void)
+{
+  return(rand()/((double)RAND_MAX + 1.));
+}
+
+/*---------------------------------------------------------------------*/
+/* Fixture file                                                        */
+/*---------------------------------------------------------------------*/
+
+static void goldenPutInt(FILE *fp, int v)
+{
+  unsigned long u = (unsigned long)v & 0xffffffffUL;
+  int ii;
+
+  for (ii = 0; ii < 4; ii++)
+    {
+      fputc((int)((u >> (8*ii)) & 0xff), fp);
+    }
+}
+
+static int goldenGetInt(FILE *fp, int *pV)
+{
+  unsigned long u = 0;
+  int ii, c;
+
+  for (ii = 0; ii < 4; ii++)
+    {
+      if (EOF == (c = fgetc(fp)))
+	{
+	  return(1);
+	}
+      u |= (unsigned long)c << (8*ii);
+    }
+  *pV = (u & 0x80000000UL) ? -(int)(0xffffffffUL - u) - 1 : (int)u;
+  return(0);
+}
+
+/* Doubles are written as their IEEE bytes, least significant first */
+static int goldenBigEndian(void)
+{
+  double one = 1.;
+  unsigned char b[sizeof(double)];
+
+  memcpy(b, &one, sizeof(double));
+  return(b[0] != 0);
+}
+
+static void goldenPutDoubles(FILE *fp, const double *p, int n)
+{
+  unsigned char b[sizeof(double)], c;
+  int ii, jj;
+
+  for (ii = 0; ii < n; ii++)
+    {
+      memcpy(b, p + ii, sizeof(double));
+      for (jj = 0; goldenBigEndian() && (jj < 4); jj++)
+	{
+	  c = b[jj]; b[jj] = b[7 - jj]; b[7 - jj] = c;
+	}
+      fwrite(b, 1, sizeof(double), fp);
+    }
+}
+
+static int goldenGetDoubles(FILE *fp, double *p, int n)
+{
+  unsigned char b[sizeof(double)], c;
+  int ii, jj;
+
+  for (ii = 0; ii < n; ii++)
+    {
+      if (fread(b, 1, sizeof(double), fp) != sizeof(double))
+	{
+	  return(1);
+	}
+      for (jj = 0; goldenBigEndian() && (jj < 4); jj++)
+	{
+	  c = b[jj]; b[jj] = b[7 - jj]; b[7 - jj] = c;
+	}
+      memcpy(p + ii, b, sizeof(double));
+    }
+  return(0);
+}
+
+static void goldenWriteRecord(FILE *fp, const goldenRecord *rec)
+{
+  int ii;
+
+  goldenPutInt(fp, rec->kind);
+  goldenPutInt(fp, rec->nInts);
+  goldenPutInt(fp, rec->nArrays);
+  for (ii = 0; ii < rec->nInts; ii++)
+    {
+      goldenPutInt(fp, rec->ints[ii]);
+    }
+  for (ii = 0; ii < rec->nArrays; ii++)
+    {
+      goldenPutInt(fp, rec->lens[ii]);
+      goldenPutDoubles(fp, rec->arrays[ii], rec->lens[ii]);
+    }
+}
+
+static void goldenFreeRecord(goldenRecord *rec)
+{
+  int ii;
+
+  for (ii = 0; ii < rec->nArrays; ii++)
+    {
+      free(rec->arrays[ii]);
+    }
+  memset(rec, 0, sizeof(*rec));
+}
+
+/* Returns 0 for a record, -1 at the end of the file and 1 for a bad record */
+static int goldenReadRecord(FILE *fp, goldenRecord *rec)
+{
+  int ii;
+
+  memset(rec, 0, sizeof(*rec));
+  if (goldenGetInt(fp, &rec->kind))
+    {
+      return(-1);
+    }
+  if (goldenGetInt(fp, &rec->nInts) || goldenGetInt(fp, &rec->nArrays) ||
+      (rec->nInts < 0) || (rec->nInts > GOLDEN_MAX_INTS) ||
+      (rec->nArrays < 0) || (rec->nArrays > GOLDEN_MAX_ARRAYS))
+    {
+      rec->nArrays = 0;
+      return(1);
+    }
+  for (ii = 0; ii < rec->nInts; ii++)
+    {
+      if (goldenGetInt(fp, rec->ints + ii))
+	{
+	  return(1);
+	}
+    }
+  for (ii = 0; ii < rec->nArrays; ii++)
+    {
+      if (goldenGetInt(fp, rec->lens + ii) || (rec->lens[ii] < 0))
+	{
+	  return(1);
+	}
+      rec->arrays[ii] = goldenAlloc(rec->lens[ii]);
+      if (goldenGetDoubles(fp, rec->arrays[ii], rec->lens[ii]))
+	{
+	  return(1);
+	}
+    }
+  return(0);
+}
+
+/* Does the record have the ints and array lengths of its kind? */
+static int goldenValid(const goldenRecord *rec)
+{
+  const int *n = rec->ints;
+  const int *len = rec->lens;
+
+  switch (rec->kind)
+    {
+    case GOLDEN_TVCONV:
+      return((rec->nInts == 3) && (rec->nArrays == 7) && (n[0] > 0) && (n[1] > 0) &&
+	     (len[0] == n[1]) && (len[1] == n[0]*n[1]) && ((len[2] == 0) || (len[2] == len[1])) &&
+	     (len[3] >= n[0]) && ((len[4] == 0) || (len[4] == len[3])) &&
+	     (len[5] == n[0]) && ((len[6] == 0) || (len[6] == n[0])));
+    case GOLDEN_STACKZS:
+      return((rec->nInts == 3) && (rec->nArrays == 5) && (n[0] > 0) && (n[1] > 0) &&
+	     (len[0] == n[2]) && (len[1] == n[0]*n[1]) && ((len[2] == 0) || (len[2] == len[1])) &&
+	     (len[3] == len[1]*n[2]) && ((len[4] == 0) || (len[4] == len[3])));
+    case GOLDEN_ZHENG:
+      return((rec->nInts == 3) && (rec->nArrays == 6) && (n[0] > 0) && (n[1] > 0) &&
+	     (len[0] == 2) && (len[1] == n[0]*n[2]) && (len[2] == len[1]) && (len[3] == len[1]) &&
+	     (len[4] == n[1]*n[2]) && (len[5] == len[4]));
+    case GOLDEN_JAKES:
+      return((rec->nInts == 4) && (rec->nArrays == 10) && (n[0] > 0) && (n[1] > 0) &&
+	     (len[0] == 2) && (len[1] == n[1]) && (len[2] == n[1]) &&
+	     (len[3] == n[3]*n[1]) && (len[4] == len[3]) && (len[5] == len[3]) &&
+	     (len[6] >= n[0]) && ((len[7] == 0) || (len[7] == len[6])) &&
+	     (len[8] == n[0]) && (len[9] == n[0]));
+    }
+  return(0);
+}
+
+/*---------------------------------------------------------------------*/
+/* Running the variants                                                */
+/*---------------------------------------------------------------------*/
+
+/* Interleave re and im (or zeros) of n elements into pairs */
+static double *goldenInterleave(const double *re, const double *im, int n)
+{
+  double *p = goldenAlloc(2*(size_t)n);
+  int ii;
+
+  for (ii = 0; ii < n; ii++)
+    {
+      p[2*ii] = re[ii];
+      p[2*ii + 1] = (im != NULL) ? im[ii] : 0.;
+    }
+  return(p);
+}
+
+/* nR x nC column-major re (and im) to nC x nR */
+static double *goldenTranspose(const double *p, int nR, int nC)
+{
+  double *t = goldenAlloc((size_t)nR*nC);
+  int r, c;
+
+  for (r = 0; r < nR; r++)
+    {
+      for (c = 0; c < nC; c++)
+	{
+	  t[c + (size_t)r*nC] = p[r + (size_t)c*nR];
+	}
+    }
+  return(t);
+}
+
+static int goldenRunTvconv(const goldenRecord *rec, const goldenVariant *v,
+			   double *out_re, double *out_im)
+{
+  int nS = rec->ints[0], nLags = rec->ints[1], longestLag = rec->ints[2];
+  double *H_re = rec->arrays[1], *H_im = rec->lens[2] ? rec->arrays[2] : NULL;
+  double *src_re = rec->arrays[3], *src_im = rec->lens[4] ? rec->arrays[4] : NULL;
+  int cplx = (H_im != NULL) || (src_im != NULL);
+  double *Hl_re = NULL, *Hl_im = NULL, *Hx = NULL, *srcx = NULL, *outx = NULL;
+  int added = (v->layout == GOLDEN_ADDED_PAIRS);
+  int status, ii;
+
+  if (v->layout == GOLDEN_SAMPLE_MAJOR)
+    {
+      return(tvconv(out_re, cplx ? out_im : NULL, nS, nLags, H_re, H_im,
+		    TVCONV_H_SAMPLE_MAJOR, TVCONV_CPLX_SPLIT, rec->arrays[0], src_re, src_im,
+		    longestLag, 1., 0, NULL, 1));
+    }
+
+  Hl_re = goldenTranspose(H_re, nS, nLags);
+  Hl_im = (H_im != NULL) ? goldenTranspose(H_im, nS, nLags) : NULL;
+  if ((v->layout == GOLDEN_LAG_MAJOR) || (!cplx && !added))
+    {
+      status = tvconv(out_re, cplx ? out_im : NULL, nS, nLags, Hl_re, Hl_im,
+		      TVCONV_H_LAG_MAJOR, TVCONV_CPLX_SPLIT, rec->arrays[0], src_re, src_im,
+		      longestLag, 1., 0, NULL, 1);
+    }
+  else
+    {
+      /*
+	Real arrays stay plain, complex ones become pairs.  Added pairs
+	go onto a constant, taken off again, and always have a complex
+	output, even for a real H and source.
+      */
+      Hx = (H_im != NULL) ? goldenInterleave(Hl_re, Hl_im, nS*nLags) : NULL;
+      srcx = (src_im != NULL) ? goldenInterleave(src_re, src_im, rec->lens[3]) : NULL;
+      outx = goldenAlloc(2*(size_t)nS);
+      for (ii = 0; added && (ii < nS); ii++)
+	{
+	  outx[2*ii] = 0.25;
+	  outx[2*ii + 1] = -0.5;
+	}
+      status = tvconv(outx, outx + 1, nS, nLags,
+		      (Hx != NULL) ? Hx : Hl_re, (Hx != NULL) ? Hx + 1 : NULL,
+		      TVCONV_H_LAG_MAJOR, TVCONV_CPLX_INTERLEAVED, rec->arrays[0],
+		      (srcx != NULL) ? srcx : src_re, (srcx != NULL) ? srcx + 1 : NULL,
+		      longestLag, 1., added, NULL, 1);
+      for (ii = 0; ii < nS; ii++)
+	{
+	  out_re[ii] = outx[2*ii] - (added ? 0.25 : 0.);
+	  out_im[ii] = outx[2*ii + 1] + (added ? 0.5 : 0.);
+	}
+    }
+  free(Hl_re);
+  free(Hl_im);
+  free(Hx);
+  free(srcx);
+  free(outx);
+  return(status);
+}
+
+/*
+  Stackzs() on each part, or stackzsCopy() in the variant's layout and
+  type, both parts in one pass, put back in the stacked order of the
+  reference
+*/
+static int goldenRunStackzs(const goldenRecord *rec, const goldenVariant *v,
+			    double *out_re, double *out_im)
+{
+  int nr = rec->ints[0], nc = rec->ints[1], nShifts = rec->ints[2];
+  size_t nIn = (size_t)nr*nc, nOut = nIn*nShifts, ii;
+  const double *in_im = rec->lens[2] ? rec->arrays[2] : NULL;
+  double *x, *y;
+  float *xf, *yf;
+  int status, r, j, a;
+
+  if (!v->single && (v->layout == GOLDEN_STACKED))
+    {
+      return(Stackzs(out_re, rec->arrays[1], nr, nc, nShifts, rec->arrays[0]) ||
+	     (rec->lens[2] && Stackzs(out_im, rec->arrays[2], nr, nc, nShifts, rec->arrays[0])));
+    }
+
+  x = goldenAlloc(2*nIn);
+  y = goldenAlloc(2*nOut);
+  if (v->single)
+    {
+      /* Doubles enough for the floats */
+      xf = (float *)x;
+      yf = (float *)y;
+      for (ii = 0; ii < nIn; ii++)
+	{
+	  xf[ii] = (float)rec->arrays[1][ii];
+	  xf[nIn + ii] = (in_im != NULL) ? (float)in_im[ii] : 0.f;
+	}
+      status = stackzsCopy(yf, (in_im != NULL) ? yf + nOut : NULL,
+			   xf, (in_im != NULL) ? xf + nIn : NULL, sizeof(float),
+			   nr, nc, nShifts, rec->arrays[0], STACKZS_LAYOUT_STACKED, 1);
+      for (ii = 0; ii < nOut; ii++)
+	{
+	  out_re[ii] = yf[ii];
+	  out_im[ii] = yf[nOut + ii];
+	}
+    }
+  else if (v->layout == GOLDEN_INTERLEAVED)
+    {
+      for (ii = 0; ii < nIn; ii++)
+	{
+	  x[2*ii] = rec->arrays[1][ii];
+	  x[2*ii + 1] = (in_im != NULL) ? in_im[ii] : 0.;
+	}
+      status = stackzsCopy(y, NULL, x, NULL, 2*sizeof(double), nr, nc, nShifts, rec->arrays[0],
+			   STACKZS_LAYOUT_STACKED, 1);
+      for (ii = 0; ii < nOut; ii++)
+	{
+	  out_re[ii] = y[2*ii];
+	  out_im[ii] = y[2*ii + 1];
+	}
+    }
+  else
+    {
+      /* Page a of nr x nc is row block a of the stack */
+      status = stackzsCopy(y, (in_im != NULL) ? y + nOut : NULL, rec->arrays[1], in_im,
+			   sizeof(double), nr, nc, nShifts, rec->arrays[0],
+			   STACKZS_LAYOUT_SHIFT_MAJOR, 1);
+      for (a = 0; a < nShifts; a++)
+	{
+	  for (j = 0; j < nc; j++)
+	    {
+	      for (r = 0; r < nr; r++)
+		{
+		  ii = (size_t)a*nr + r + (size_t)j*nr*nShifts;
+		  out_re[ii] = y[r + (size_t)j*nr + a*nIn];
+		  out_im[ii] = y[nOut + r + (size_t)j*nr + a*nIn];
+		}
+	    }
+	}
+    }
+
+  free(x);
+  free(y);
+  return(status);
+}
+
+static int goldenRunZheng(const goldenRecord *rec, const goldenVariant *v,
+			  double *out_re, double *out_im)
+{
+  int m = rec->ints[0], nS = rec->ints[1], nTaps = rec->ints[2];
+  double f = rec->arrays[0][0], start = rec->arrays[0][1];
+  double *t;
+  int status = 0, tap, k;
+
+  if (v->batch)
+    {
+      /* All the taps as the lags of one pair, in jakes4's nTaps x nS layout */
+      return(zhengBatch(out_re, out_im, 1, start, nS, f, m,
+			rec->arrays[1], rec->arrays[2], rec->arrays[3], nTaps, 1, NULL,
+			v->tol, v->cosTol, v->lutSize, v->lutInterp, 0));
+    }
+  t = goldenAlloc(nS);
+  for (k = 0; k < nS; k++)
+    {
+      t[k] = start + k;
+    }
+  for (tap = 0; (tap < nTaps) && (0 == status); tap++)
+    {
+      status = zhengFunLUT(out_re + tap, out_im + tap, nTaps, t, nS, f,
+			   rec->arrays[1] + (size_t)m*tap, rec->arrays[2] + (size_t)m*tap,
+			   rec->arrays[3] + (size_t)m*tap, m,
+			   v->tol, v->cosTol, v->lutSize, v->lutInterp);
+    }
+  free(t);
+  return(status);
+}
+
+static int goldenRunJakes(const goldenRecord *rec, const goldenVariant *v,
+			  double *out_re, double *out_im)
+{
+  int nS = rec->ints[0], nLags = rec->ints[1], longestLag = rec->ints[2], m = rec->ints[3];
+  tvconvJakesTap *pTaps = (tvconvJakesTap *)calloc(nLags, sizeof(tvconvJakesTap));
+  double *pLags = rec->arrays[1];
+  double *src_re = rec->arrays[6], *src_im = rec->lens[7] ? rec->arrays[7] : NULL;
+  int status, lag;
+
+  if (NULL == pTaps)
+    {
+      return(2);
+    }
+  for (lag = 0; lag < nLags; lag++)
+    {
+      pTaps[lag].M = m;
+      pTaps[lag].gain = rec->arrays[2][lag];
+      pTaps[lag].doppf = rec->arrays[0][0];
+      pTaps[lag].pAlph = rec->arrays[3] + (size_t)m*lag;
+      pTaps[lag].pPhi = rec->arrays[4] + (size_t)m*lag;
+      pTaps[lag].pSphi = rec->arrays[5] + (size_t)m*lag;
+      tvconvJakesTapPlan(pTaps + lag, v->tol);
+    }
+  status = tvconvJakesMimo(out_re, out_im, 1, 1, nS, &nLags, pTaps, rec->arrays[0][1],
+			   TVCONV_CPLX_SPLIT, &pLags, &src_re, &src_im,
+			   longestLag, 1., 0, NULL, 1);
+  free(pTaps);
+  return(status);
+}
+
+/* max|out - ref|/rms(ref) over n complex (or, for NULL imaginary parts, real) elements */
+static double goldenError(const double *out_re, const double *out_im,
+			  const double *ref_re, const double *ref_im, size_t n)
+{
+  double maxErr = 0., sumSq = 0., d_re, d_im, r_im, o_im, e;
+  size_t ii;
+
+  for (ii = 0; ii < n; ii++)
+    {
+      r_im = (ref_im != NULL) ? ref_im[ii] : 0.;
+      o_im = (out_im != NULL) ? out_im[ii] : 0.;
+      d_re = out_re[ii] - ref_re[ii];
+      d_im = o_im - r_im;
+      e = sqrt(d_re*d_re + d_im*d_im);
+      maxErr = (e > maxErr) ? e : maxErr;
+      sumSq += ref_re[ii]*ref_re[ii] + r_im*r_im;
+      if (e != e)
+	{
+	  return(e);                              /* NaN */
+	}
+    }
+  return((sumSq > 0.) ? maxErr/sqrt(sumSq/n) : maxErr);
+}
+
+static void goldenCheckRecord(const goldenRecord *rec, int iRec)
+{
+  const goldenVariant *v;
+  double *out_re, *out_im, *ref_re, *ref_im;
+  size_t nOut;
+  char desc[64];
+  int iVar, status, isa, iOut;
+
+  switch (rec->kind)
+    {
+    case GOLDEN_TVCONV:
+      sprintf(desc, "#%d nS %d nLags %d%s", iRec, rec->ints[0], rec->ints[1],
+	      (rec->lens[2] || rec->lens[4]) ? "" : " real");
+      iOut = 5;
+      break;
+    case GOLDEN_STACKZS:
+      sprintf(desc, "#%d %dx%d shifts %d", iRec, rec->ints[0], rec->ints[1], rec->ints[2]);
+      iOut = 3;
+      break;
+    case GOLDEN_ZHENG:
+      sprintf(desc, "#%d M %d nS %d f %g", iRec, rec->ints[0], rec->ints[1], rec->arrays[0][0]);
+      iOut = 4;
+      break;
+    default:
+      sprintf(desc, "#%d nS %d nLags %d f %g", iRec, rec->ints[0], rec->ints[1], rec->arrays[0][0]);
+      iOut = 8;
+      break;
+    }
+  nOut = rec->lens[iOut];
+  ref_re = rec->arrays[iOut];
+  ref_im = rec->lens[iOut + 1] ? rec->arrays[iOut + 1] : NULL;
+  out_re = goldenAlloc(nOut);
+  out_im = goldenAlloc(nOut);
+
+  for (iVar = 0; iVar < GOLDEN_N_VARIANTS; iVar++)
+    {
+      v = goldenVariants + iVar;
+      if (v->kind != rec->kind)
+	{
+	  continue;
+	}
+      isa = TVCONV_ISA_AUTO;
+      if ((v->kind == GOLDEN_TVCONV) && ((isa = tvconvSelectIsa(v->isa)) != v->isa))
+	{
+	  printf("%-4s %-30s %-34s not supported by this CPU\n", "skip", v->name, desc);
+	  continue;
+	}
+      memset(out_re, 0, nOut*sizeof(double));
+      memset(out_im, 0, nOut*sizeof(double));
+      switch (rec->kind)
+	{
+	case GOLDEN_TVCONV:
+	  status = goldenRunTvconv(rec, v, out_re, out_im);
+	  break;
+	case GOLDEN_STACKZS:
+	  status = goldenRunStackzs(rec, v, out_re, out_im);
+	  break;
+	case GOLDEN_ZHENG:
+	  status = goldenRunZheng(rec, v, out_re, out_im);
+	  break;
+	default:
+	  status = goldenRunJakes(rec, v, out_re, out_im);
+	  break;
+	}
+      goldenCheck(v->name, desc,
+		  status ? HUGE_VAL : goldenError(out_re, out_im, ref_re, ref_im, nOut),
+		  v->budget);
+    }
+  (void)tvconvSelectIsa(TVCONV_ISA_AUTO);
+
+  free(out_re);
+  free(out_im);
+}
+
+/*---------------------------------------------------------------------*/
+/* Threaded runs against single-threaded ones                          */
+/*---------------------------------------------------------------------*/
+
+#define GOLDEN_MT_NS    65536
+#define GOLDEN_MT_LAGS  20
+#define GOLDEN_MT_M     8
+#define GOLDEN_MT_THREADS 4
+#define GOLDEN_MT_BATCH_NS 4096
+#define GOLDEN_MT_STACK_NR 4                  /* Rows of H stacked with 5 shifts */
+
+/* Random 'zheng' sinusoids of nTaps taps, as GetWssusChannel.m makes them */
+static void goldenZhengStates(double *alph, double *phi, double *sphi, int m, int nTaps)
+{
+  double theta;
+  int tap, ii;
+
+  for (tap = 0; tap < nTaps; tap++)
+    {
+      theta = 2.*GOLDEN_PI*goldenRand();
+      for (ii = 0; ii < m; ii++)
+	{
+	  alph[ii + m*tap] = (2.*GOLDEN_PI*(ii + 1) - GOLDEN_PI + theta)/(4.*m);
+	  phi[ii + m*tap] = 2.*GOLDEN_PI*goldenRand();
+	  sphi[ii + m*tap] = 2.*GOLDEN_PI*goldenRand();
+	}
+    }
+}
+
+static void goldenCheckThreads(void)
+{
+  size_t nH = (size_t)GOLDEN_MT_NS*GOLDEN_MT_LAGS;
+  int nLags = GOLDEN_MT_LAGS, nPairs = 4;
+  double *H_re = goldenAlloc(nH), *H_im = goldenAlloc(nH);
+  double *src_re = goldenAlloc(GOLDEN_MT_NS), *src_im = goldenAlloc(GOLDEN_MT_NS);
+  double *out1_re = goldenAlloc(GOLDEN_MT_NS), *out1_im = goldenAlloc(GOLDEN_MT_NS);
+  double *outN_re = goldenAlloc(GOLDEN_MT_NS), *outN_im = goldenAlloc(GOLDEN_MT_NS);
+  double *alph = goldenAlloc((size_t)GOLDEN_MT_M*nLags*nPairs);
+  double *phi = goldenAlloc((size_t)GOLDEN_MT_M*nLags*nPairs);
+  double *sphi = goldenAlloc((size_t)GOLDEN_MT_M*nLags*nPairs);
+  size_t nHb = (size_t)GOLDEN_MT_BATCH_NS*nLags*nPairs;
+  double *Hb1_re = goldenAlloc(nHb), *Hb1_im = goldenAlloc(nHb);
+  double *HbN_re = goldenAlloc(nHb), *HbN_im = goldenAlloc(nHb);
+  double lags[GOLDEN_MT_LAGS], *pLags = lags;
+  tvconvJakesTap taps[GOLDEN_MT_LAGS];
+  double shifts[5] = {0., 1., -7., 300., -65537.};
+  size_t nSt = (size_t)GOLDEN_MT_STACK_NR*GOLDEN_MT_NS*5;
+  double *st1 = goldenAlloc(2*nSt), *stN = goldenAlloc(2*nSt);
+  char desc[64];
+  int isa, lag, tol, status, layout;
+  size_t ii;
+
+  for (ii = 0; ii < nH; ii++)
+    {
+      H_re[ii] = goldenRand() - 0.5;
+      H_im[ii] = goldenRand() - 0.5;
+    }
+  for (ii = 0; ii < GOLDEN_MT_NS; ii++)
+    {
+      src_re[ii] = goldenRand() - 0.5;
+      src_im[ii] = goldenRand() - 0.5;
+    }
+  for (lag = 0; lag < nLags; lag++)
+    {
+      lags[lag] = 2*lag;
+    }
+  goldenZhengStates(alph, phi, sphi, GOLDEN_MT_M, nLags*nPairs);
+
+  sprintf(desc, "nS %d nLags %d, %d threads", GOLDEN_MT_NS, nLags, GOLDEN_MT_THREADS);
+  for (isa = TVCONV_ISA_SCALAR; isa <= TVCONV_ISA_AVX512; isa++)
+    {
+      if (tvconvSelectIsa(isa) != isa)
+	{
+	  continue;
+	}
+      status = tvconv(out1_re, out1_im, GOLDEN_MT_NS, nLags, H_re, H_im, TVCONV_H_SAMPLE_MAJOR,
+		      TVCONV_CPLX_SPLIT, lags, src_re, src_im, 2*(nLags - 1), 1., 0, NULL, 1);
+      status |= tvconv(outN_re, outN_im, GOLDEN_MT_NS, nLags, H_re, H_im, TVCONV_H_SAMPLE_MAJOR,
+		       TVCONV_CPLX_SPLIT, lags, src_re, src_im, 2*(nLags - 1), 1., 0, NULL,
+		       GOLDEN_MT_THREADS);
+      goldenCheck(isa == TVCONV_ISA_SCALAR ? "tvconv scalar threaded" :
+		  (isa == TVCONV_ISA_AVX2 ? "tvconv avx2 threaded" : "tvconv avx512 threaded"), desc,
+		  status ? HUGE_VAL : goldenError(outN_re, outN_im, out1_re, out1_im, GOLDEN_MT_NS), 0.);
+    }
+  (void)tvconvSelectIsa(TVCONV_ISA_AUTO);
+
+  for (tol = 0; tol <= 1; tol++)
+    {
+      memset(taps, 0, sizeof(taps));
+      for (lag = 0; lag < nLags; lag++)
+	{
+	  taps[lag].M = GOLDEN_MT_M;
+	  taps[lag].gain = 1./sqrt((double)nLags);
+	  taps[lag].doppf = 1e-3;
+	  taps[lag].pAlph = alph + GOLDEN_MT_M*lag;
+	  taps[lag].pPhi = phi + GOLDEN_MT_M*lag;
+	  taps[lag].pSphi = sphi + GOLDEN_MT_M*lag;
+	  tvconvJakesTapPlan(taps + lag, tol ? 1e-6 : 0.);
+	}
+      status = tvconvJakesMimo(out1_re, out1_im, 1, 1, GOLDEN_MT_NS, &nLags, taps, 1e5,
+			       TVCONV_CPLX_SPLIT, &pLags, &src_re, &src_im,
+			       2*(nLags - 1), 1., 0, NULL, 1);
+      status |= tvconvJakesMimo(outN_re, outN_im, 1, 1, GOLDEN_MT_NS, &nLags, taps, 1e5,
+				TVCONV_CPLX_SPLIT, &pLags, &src_re, &src_im,
+				2*(nLags - 1), 1., 0, NULL, GOLDEN_MT_THREADS);
+      goldenCheck(tol ? "tvconvJakesMimo decim threaded" : "tvconvJakesMimo threaded", desc,
+		  status ? HUGE_VAL : goldenError(outN_re, outN_im, out1_re, out1_im, GOLDEN_MT_NS), 0.);
+
+      status = zhengBatch(Hb1_re, Hb1_im, 1, 1e5, GOLDEN_MT_BATCH_NS, 1e-3, GOLDEN_MT_M, alph, phi, sphi,
+			  nLags, nPairs, NULL, tol ? 1e-6 : 0., 1e-9, 0, NULL, 1);
+      status |= zhengBatch(HbN_re, HbN_im, 1, 1e5, GOLDEN_MT_BATCH_NS, 1e-3, GOLDEN_MT_M, alph, phi, sphi,
+			   nLags, nPairs, NULL, tol ? 1e-6 : 0., 1e-9, 0, NULL, GOLDEN_MT_THREADS);
+      sprintf(desc, "nS %d nLags %d pairs %d, %d threads", GOLDEN_MT_BATCH_NS, nLags, nPairs,
+	      GOLDEN_MT_THREADS);
+      goldenCheck(tol ? "zhengBatch decim threaded" : "zhengBatch threaded", desc,
+		  status ? HUGE_VAL : goldenError(HbN_re, HbN_im, Hb1_re, Hb1_im, nHb), 0.);
+      sprintf(desc, "nS %d nLags %d, %d threads", GOLDEN_MT_NS, nLags, GOLDEN_MT_THREADS);
+    }
+
+  /* Complex in one pass, real and imaginary parts of nSt elements each */
+  sprintf(desc, "%dx%d shifts 5, %d threads", GOLDEN_MT_STACK_NR, GOLDEN_MT_NS, GOLDEN_MT_THREADS);
+  for (layout = STACKZS_LAYOUT_STACKED; layout <= STACKZS_LAYOUT_SHIFT_MAJOR; layout++)
+    {
+      status = stackzsCopy(st1, st1 + nSt, H_re, H_im, sizeof(double), GOLDEN_MT_STACK_NR,
+			   GOLDEN_MT_NS, 5, shifts, layout, 1);
+      status |= stackzsCopy(stN, stN + nSt, H_re, H_im, sizeof(double), GOLDEN_MT_STACK_NR,
+			    GOLDEN_MT_NS, 5, shifts, layout, GOLDEN_MT_THREADS);
+      goldenCheck(layout ? "stackzsCopy shiftMajor threaded" : "stackzsCopy threaded", desc,
+		  status ? HUGE_VAL : goldenError(stN, stN + nSt, st1, st1 + nSt, nSt), 0.);
+    }
+
+  free(H_re); free(H_im);
+  free(src_re); free(src_im);
+  free(out1_re); free(out1_im);
+  free(outN_re); free(outN_im);
+  free(alph); free(phi); free(sphi);
+  free(Hb1_re); free(Hb1_im);
+  free(HbN_re); free(HbN_im);
+  free(st1); free(stN);
+}
+
+/*---------------------------------------------------------------------*/
+/* --export: C ports of the MATLAB references                          */
+/*---------------------------------------------------------------------*/
+
+/* TVConv.m: lag by lag, source samples from nS on counting as zero */
+static void goldenRefTvconv(double *out_re, double *out_im, int nS, int nLags,
+			    const double *lags, const double *H_re, const double *H_im,
+			    const double *src_re, const double *src_im, int nSrc, int longestLag)
+{
+  double h_im, s_im;
+  int lag, n, idx;
+
+  nSrc = (nSrc < nS) ? nSrc : nS;
+  for (n = 0; n < nS; n++)
+    {
+      out_re[n] = out_im[n] = 0.;
+    }
+  for (lag = 0; lag < nLags; lag++)
+    {
+      for (n = 0; n < nS; n++)
+	{
+	  idx = n + longestLag - (int)lags[lag];
+	  if ((idx < 0) || (idx >= nSrc))
+	    {
+	      continue;
+	    }
+	  h_im = (H_im != NULL) ? H_im[n + (size_t)lag*nS] : 0.;
+	  s_im = (src_im != NULL) ? src_im[idx] : 0.;
+	  out_re[n] += H_re[n + (size_t)lag*nS]*src_re[idx] - h_im*s_im;
+	  out_im[n] += H_re[n + (size_t)lag*nS]*s_im + h_im*src_re[idx];
+	}
+    }
+}
+
+/* Stackzs.m: row block s of the output is z with its columns cycled by -shifts[s] */
+static void goldenRefStackzs(double *out, const double *in, int nr, int nc,
+			     int nShifts, const double *shifts)
+{
+  int s, r, j, cyc;
+
+  for (s = 0; s < nShifts; s++)
+    {
+      cyc = (-(int)shifts[s]) % nc;             /* rem() in cycle.m */
+      for (j = 0; j < nc; j++)
+	{
+	  for (r = 0; r < nr; r++)
+	    {
+	      out[(s*nr + r) + (size_t)j*nr*nShifts] = in[r + (size_t)((j + cyc + nc) % nc)*nr];
+	    }
+	}
+    }
+}
+
+/* The zheng subfunction of jakes4.m, in its order of operations */
+static void goldenRefZheng(double *h_re, double *h_im, int hStep, double f, double start, int nS,
+			   int m, const double *alph, const double *phi, const double *sphi)
+{
+  double t, re, im;
+  int k, ii;
+
+  for (k = 0; k < nS; k++)
+    {
+      t = start + k;
+      re = im = 0.;
+      for (ii = 0; ii < m; ii++)
+	{
+	  re = re + 2*cos(2*GOLDEN_PI*f*cos(alph[ii])*t + phi[ii]);
+	  im = im + 2*cos(2*GOLDEN_PI*f*sin(alph[ii])*t + sphi[ii]);
+	}
+      h_re[k*hStep] = sqrt(1./(4*m))*re;
+      h_im[k*hStep] = sqrt(1./(4*m))*im;
+    }
+}
+
+static void goldenRecordInit(goldenRecord *rec, int kind, int nInts, const int *ints,
+			     int nArrays, const int *lens)
+{
+  int ii;
+
+  memset(rec, 0, sizeof(*rec));
+  rec->kind = kind;
+  rec->nInts = nInts;
+  rec->nArrays = nArrays;
+  for (ii = 0; ii < nInts; ii++)
+    {
+      rec->ints[ii] = ints[ii];
+    }
+  for (ii = 0; ii < nArrays; ii++)
+    {
+      rec->lens[ii] = lens[ii];
+      rec->arrays[ii] = goldenAlloc(lens[ii]);
+    }
+}
+
+/* Sorted distinct lags in [0, longestLag], including longestLag */
+static void goldenLags(double *lags, int nLags, int longestLag)
+{
+  int ii, jj, lag, dup;
+
+  lags[nLags - 1] = longestLag;
+  for (ii = 0; ii < nLags - 1; )
+    {
+      lag = (int)(goldenRand()*longestLag);
+      for (jj = 0, dup = 0; jj < ii; jj++)
+	{
+	  dup |= ((int)lags[jj] == lag);
+	}
+      if (!dup)
+	{
+	  lags[ii++] = lag;
+	}
+    }
+  for (ii = 1; ii < nLags; ii++)               /* Insertion sort */
+    {
+      for (jj = ii; (jj > 0) && (lags[jj - 1] > lags[jj]); jj--)
+	{
+	  double tmp = lags[jj]; lags[jj] = lags[jj - 1]; lags[jj - 1] = tmp;
+	}
+    }
+}
+
+static void goldenFillRand(double *p, int n)
+{
+  int ii;
+
+  for (ii = 0; ii < n; ii++)
+    {
+      p[ii] = 2.*goldenRand() - 1.;
+    }
+}
+
+static int goldenExport(const char *path)
+{
+  /* nS, nLags, longestLag, complex H, complex source */
+  static const int tvCases[7][5] = {
+    {256, 1, 0, 1, 1}, {300, 4, 6, 0, 1}, {300, 4, 6, 1, 0}, {300, 4, 6, 0, 0},
+    {600, 5, 9, 1, 1}, {256, 20, 24, 1, 1}, {400, 12, 40, 1, 1}};
+  /* nr, nc, nShifts, complex, largest |shift| */
+  static const int szCases[5][5] = {
+    {1, 64, 1, 0, 10}, {4, 100, 5, 1, 99}, {4, 24, 21, 1, 20}, {2, 20, 65, 0, 19}, {2, 16, 7, 1, 40}};
+  /* M, nS, nTaps; doppf, start */
+  static const int zhCases[4][3] = {{8, 1024, 3}, {4, 600, 2}, {16, 1024, 2}, {8, 1024, 2}};
+  static const double zhF[4][2] = {{1e-2, 0.}, {5e-2, 12345.}, {1e-3, 1e5}, {1e-4, 1000.}};
+  /* nS, nLags, longestLag, M; doppf, start */
+  static const int jkCases[2][4] = {{1000, 5, 9, 8}, {2000, 3, 4, 8}};
+  static const double jkF[2][2] = {{1e-2, 500.}, {1e-4, 0.}};
+  goldenRecord rec;
+  FILE *fp = fopen(path, "wb");
+  int ints[4], lens[10];
+  int c, ii, nS, nLags, n, m, nTaps;
+  double *H_re, *H_im, *out_im;
+
+  if (NULL == fp)
+    {
+      fprintf(stderr, "llamachanGolden: cannot write %s\n", path);
+      return(1);
+    }
+  fwrite(GOLDEN_MAGIC_CPORT, 1, 8, fp);
+  srand(19);
+
+  for (c = 0; c < 7; c++)
+    {
+      nS = tvCases[c][0];
+      nLags = tvCases[c][1];
+      n = nS + tvCases[c][2];                   /* Source of nS + longestLag samples */
+      ints[0] = nS; ints[1] = nLags; ints[2] = tvCases[c][2];
+      lens[0] = nLags; lens[1] = nS*nLags; lens[2] = tvCases[c][3] ? nS*nLags : 0;
+      lens[3] = n; lens[4] = tvCases[c][4] ? n : 0;
+      lens[5] = nS; lens[6] = (lens[2] || lens[4]) ? nS : 0;
+      goldenRecordInit(&rec, GOLDEN_TVCONV, 3, ints, 7, lens);
+      goldenLags(rec.arrays[0], nLags, ints[2]);
+      for (ii = 1; ii <= 4; ii++)
+	{
+	  goldenFillRand(rec.arrays[ii], lens[ii]);
+	}
+      out_im = lens[6] ? rec.arrays[6] : goldenAlloc(nS);
+      goldenRefTvconv(rec.arrays[5], out_im, nS, nLags,
+		      rec.arrays[0], rec.arrays[1], lens[2] ? rec.arrays[2] : NULL,
+		      rec.arrays[3], lens[4] ? rec.arrays[4] : NULL, n, ints[2]);
+      if (0 == lens[6])
+	{
+	  free(out_im);
+	}
+      goldenWriteRecord(fp, &rec);
+      goldenFreeRecord(&rec);
+    }
+
+  for (c = 0; c < 5; c++)
+    {
+      ints[0] = szCases[c][0]; ints[1] = szCases[c][1]; ints[2] = szCases[c][2];
+      n = ints[0]*ints[1];
+      lens[0] = ints[2]; lens[1] = n; lens[2] = szCases[c][3] ? n : 0;
+      lens[3] = n*ints[2]; lens[4] = szCases[c][3] ? n*ints[2] : 0;
+      goldenRecordInit(&rec, GOLDEN_STACKZS, 3, ints, 5, lens);
+      for (ii = 0; ii < ints[2]; ii++)
+	{
+	  rec.arrays[0][ii] = floor((2.*goldenRand() - 1.)*(szCases[c][4] + 1));
+	}
+      goldenFillRand(rec.arrays[1], lens[1]);
+      goldenFillRand(rec.arrays[2], lens[2]);
+      goldenRefStackzs(rec.arrays[3], rec.arrays[1], ints[0], ints[1], ints[2], rec.arrays[0]);
+      if (lens[4])
+	{
+	  goldenRefStackzs(rec.arrays[4], rec.arrays[2], ints[0], ints[1], ints[2], rec.arrays[0]);
+	}
+      goldenWriteRecord(fp, &rec);
+      goldenFreeRecord(&rec);
+    }
+
+  for (c = 0; c < 4; c++)
+    {
+      m = zhCases[c][0]; nS = zhCases[c][1]; nTaps = zhCases[c][2];
+      ints[0] = m; ints[1] = nS; ints[2] = nTaps;
+      lens[0] = 2; lens[1] = lens[2] = lens[3] = m*nTaps; lens[4] = lens[5] = nS*nTaps;
+      goldenRecordInit(&rec, GOLDEN_ZHENG, 3, ints, 6, lens);
+      rec.arrays[0][0] = zhF[c][0];
+      rec.arrays[0][1] = zhF[c][1];
+      goldenZhengStates(rec.arrays[1], rec.arrays[2], rec.arrays[3], m, nTaps);
+      for (ii = 0; ii < nTaps; ii++)
+	{
+	  goldenRefZheng(rec.arrays[4] + ii, rec.arrays[5] + ii, nTaps, zhF[c][0], zhF[c][1], nS, m,
+			 rec.arrays[1] + m*ii, rec.arrays[2] + m*ii, rec.arrays[3] + m*ii);
+	}
+      goldenWriteRecord(fp, &rec);
+      goldenFreeRecord(&rec);
+    }
+
+  for (c = 0; c < 2; c++)
+    {
+      nS = jkCases[c][0]; nLags = jkCases[c][1]; m = jkCases[c][3];
+      n = nS + jkCases[c][2];
+      ints[0] = nS; ints[1] = nLags; ints[2] = jkCases[c][2]; ints[3] = m;
+      lens[0] = 2; lens[1] = lens[2] = nLags; lens[3] = lens[4] = lens[5] = m*nLags;
+      lens[6] = lens[7] = n; lens[8] = lens[9] = nS;
+      goldenRecordInit(&rec, GOLDEN_JAKES, 4, ints, 10, lens);
+      rec.arrays[0][0] = jkF[c][0];
+      rec.arrays[0][1] = jkF[c][1];
+      goldenLags(rec.arrays[1], nLags, ints[2]);
+      for (ii = 0; ii < nLags; ii++)
+	{
+	  rec.arrays[2][ii] = sqrt(goldenRand()/nLags);
+	}
+      goldenZhengStates(rec.arrays[3], rec.arrays[4], rec.arrays[5], m, nLags);
+      goldenFillRand(rec.arrays[6], n);
+      goldenFillRand(rec.arrays[7], n);
+
+      /* JakesMatrix in TVConv.m: gains times jakes4's taps, then convolved */
+      H_re = goldenAlloc((size_t)nS*nLags);
+      H_im = goldenAlloc((size_t)nS*nLags);
+      for (ii = 0; ii < nLags; ii++)
+	{
+	  goldenRefZheng(H_re + (size_t)ii*nS, H_im + (size_t)ii*nS, 1, jkF[c][0], jkF[c][1], nS, m,
+			 rec.arrays[3] + m*ii, rec.arrays[4] + m*ii, rec.arrays[5] + m*ii);
+	}
+      for (ii = 0; ii < nS*nLags; ii++)
+	{
+	  H_re[ii] *= rec.arrays[2][ii/nS];
+	  H_im[ii] *= rec.arrays[2][ii/nS];
+	}
+      goldenRefTvconv(rec.arrays[8], rec.arrays[9], nS, nLags, rec.arrays[1], H_re, H_im,
+		      rec.arrays[6], rec.arrays[7], n, ints[2]);
+      free(H_re);
+      free(H_im);
+      goldenWriteRecord(fp, &rec);
+      goldenFreeRecord(&rec);
+    }
+
+  return(fclose(fp) != 0);
+}
+
+/*---------------------------------------------------------------------*/
+
+int main(int argc, char *argv[])
+{
+  const char *path = GOLDEN_DEFAULT_FILE;
+  goldenRecord rec;
+  char magic[8];
+  FILE *fp;
+  int exportFixture = 0, iRec, status;
+  int ii;
+
+  for (ii = 1; ii < argc; ii++)
+    {
+      if (0 == strcmp(argv[ii], "--export"))
+	{
+	  exportFixture = 1;
+	}
+      else
+	{
+	  path = argv[ii];
+	}
+    }
+  if (exportFixture)
+    {
+      return(goldenExport(path));
+    }
+
+  if ((NULL == (fp = fopen(path, "rb"))) ||
+      (fread(magic, 1, 8, fp) != 8) ||
+      ((0 != memcmp(magic, GOLDEN_MAGIC_MATLAB, 8)) && (0 != memcmp(magic, GOLDEN_MAGIC_CPORT, 8))))
+    {
+      fprintf(stderr, "llamachanGolden: %s is not a golden-vector fixture\n", path);
+      return(1);
+    }
+  printf("reference outputs from %s\n", (0 == memcmp(magic, GOLDEN_MAGIC_MATLAB, 8)) ?
+	 "MATLAB (ExportGoldenVectors.m)" : "the C port of the .m references (--export), not MATLAB");
+  for (iRec = 0; 0 == (status = goldenReadRecord(fp, &rec)); iRec++)
+    {
+      if (!goldenValid(&rec))
+	{
+	  status = 1;
+	  break;
+	}
+      goldenCheckRecord(&rec, iRec);
+      goldenFreeRecord(&rec);
+    }
+  goldenFreeRecord(&rec);
+  fclose(fp);
+  if (status > 0)
+    {
+      fprintf(stderr, "llamachanGolden: bad record %d in %s\n", iRec, path);
+      return(1);
+    }
+
+  goldenCheckThreads();
+
+  printf("%d records, %d failures\n", iRec, goldenFailures);
+  return(goldenFailures);
+}
+
+
+/*
+  This material is based upon work supported by the Defense Advanced Research
+  Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+  findings, conclusions or recommendations expressed in this material are those
+  of the author(s) and do not necessarily reflect the views of the Defense
+  Advanced Research Projects Agency.
+
+  © 2019 Massachusetts Institute of Technology.
+
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License version 2 as
+  published by the Free Software Foundation;
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+  POSSIBILITY OF SUCH DAMAGE.
+*/
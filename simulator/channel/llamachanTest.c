@@ -0,0 +1,1307 @@
+/*
+  This material is based upon work supported by the Defense Advanced Research
+  Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+  findings, conclusions or recommendations expressed in this material are those
+  of the author(s) and do not necessarily reflect the views of the Defense
+  Advanced Research Projects Agency.
+
+  © 2019 Massachusetts Institute of Technology.
+
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License version 2 as
+  published by the Free Software Foundation;
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+  POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  Native tests of libllamachan, the kernels of the channel MEX functions
+  built without MATLAB (see llamachan.h).  Not a MEX function: built by
+  CMakeLists.txt and run by ctest, or by hand with
+
+    cc -O2 llamachanTest.c TVConv.c Stackzs.c StackzsCov.c StackzsApply.c \
+       StfcsFilter.c zhengFunLUT.c zhengBatch.c -o llamachanTest -lm -lpthread
+    ./llamachanTest [samples]
+
+  Each kernel is checked against a plain reference loop, and its
+  variants (layouts, instruction sets, threads) against each other.
+  The time per output sample of each kernel is printed as well.
+  Returns the number of failed checks.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "llamachan.h"
+#include "parallelFor.h"
+
+#define TEST_TWOPI (6.283185307179586)
+#define TEST_M     8                          /* Sinusoids per 'zheng' tap */
+#define TEST_TVCONV_MT_NS (1<<18)             /* 6 lags of this is over TVCONV_MT_MIN_WORK */
+
+static int testFailures = 0;
+
+/* Uniform in [-1, 1) */
+static double testRand(void)
+{
+  return(2.*rand()/((double)RAND_MAX + 1.) - 1.);
+}
+
+static double testMaxDiff(const double *pA, const double *pB, size_t n)
+{
+  double d = 0.;
+  size_t ii;
+
+  for (ii = 0; ii < n; ii++)
+    {
+      d = (fabs(pA[ii] - pB[ii]) > d) ? fabs(pA[ii] - pB[ii]) : d;
+    }
+  return(d);
+}
+
+/* Report a check that passes when err <= tol */
+static void testCheck(const char *name, double err, double tol)
+{
+  int pass = (err <= tol);
+
+  printf("%-4s %-44s %10.2e (tol %.0e)\n", pass ? "ok" : "FAIL", name, err, tol);
+  testFailures += !pass;
+}
+
+static double testSeconds(clock_t c0)
+{
+  return((double)(clock() - c0)/CLOCKS_PER_SEC);
+}
+
+/*---------------------------------------------------------------------*/
+
+static void testStackzs(int nc)
+{
+  double shifts[5] = {0., 1., -3., 7., 0.};
+  int nr = 4, nShifts = 5;
+  size_t nIn = (size_t)nr*nc, nOut = nIn*nShifts;
+  double *pIn = (double *)malloc(nIn*sizeof(double));
+  double *pIn_im = (double *)malloc(nIn*sizeof(double));
+  double *pOut = (double *)malloc(nOut*sizeof(double));
+  double *pOut_im = (double *)malloc(nOut*sizeof(double));
+  double *pRef = (double *)malloc(nOut*sizeof(double));
+  double *pRef_im = (double *)malloc(nOut*sizeof(double));
+  double *pPairs = (double *)malloc(2*(nIn + nOut)*sizeof(double));
+  float *pF = (float *)malloc(nOut*sizeof(float));
+  float *pOutF = (float *)malloc(nOut*sizeof(float));
+  double errIm, errF;
+  size_t el, ii;
+  int s, r, j, col;
+  clock_t c0;
+
+  shifts[4] = 2.*nc + 1.;                     /* More than a whole cycle */
+  for (ii = 0; ii < nIn; ii++)
+    {
+      pIn[ii] = testRand();
+      pIn_im[ii] = testRand();
+    }
+  /* Row block s is z(:, cycle(nc, -shifts(s))), as in Stackzs.m */
+  for (s = 0; s < nShifts; s++)
+    {
+      for (j = 0; j < nc; j++)
+	{
+	  col = (int)((j - (long)shifts[s]) % nc);
+	  col += (col < 0) ? nc : 0;
+	  for (r = 0; r < nr; r++)
+	    {
+	      pRef[(s*nr + r) + (size_t)j*nr*nShifts] = pIn[r + (size_t)col*nr];
+	      pRef_im[(s*nr + r) + (size_t)j*nr*nShifts] = pIn_im[r + (size_t)col*nr];
+	    }
+	}
+    }
+
+  c0 = clock();
+  testCheck("Stackzs return", (double)Stackzs(pOut, pIn, nr, nc, nShifts, shifts), 0.);
+  printf("     Stackzs %.2f ns/output element\n", testSeconds(c0)*1e9/((double)nOut));
+  testCheck("Stackzs vs reference", testMaxDiff(pOut, pRef, nOut), 0.);
+
+  /* Split complex in one pass, 4 threads */
+  memset(pOut, 0, nOut*sizeof(double));
+  testCheck("stackzsCopy complex, 4 threads, return",
+	    (double)stackzsCopy(pOut, pOut_im, pIn, pIn_im, sizeof(double), nr, nc, nShifts, shifts,
+				STACKZS_LAYOUT_STACKED, 4), 0.);
+  errIm = testMaxDiff(pOut_im, pRef_im, nOut);
+  testCheck("stackzsCopy complex, 4 threads, vs reference",
+	    (testMaxDiff(pOut, pRef, nOut) > errIm) ? testMaxDiff(pOut, pRef, nOut) : errIm, 0.);
+
+  /* Interleaved (re, im) pairs as elements of twice the size */
+  for (ii = 0; ii < nIn; ii++)
+    {
+      pPairs[2*ii] = pIn[ii];
+      pPairs[2*ii + 1] = pIn_im[ii];
+    }
+  (void)stackzsCopy(pPairs + 2*nIn, NULL, pPairs, NULL, 2*sizeof(double), nr, nc, nShifts, shifts,
+		    STACKZS_LAYOUT_STACKED, 1);
+  for (ii = 0, errIm = 0.; ii < nOut; ii++)
+    {
+      errIm += fabs(pPairs[2*nIn + 2*ii] - pRef[ii]) + fabs(pPairs[2*nIn + 2*ii + 1] - pRef_im[ii]);
+    }
+  testCheck("stackzsCopy interleaved vs reference", errIm, 0.);
+
+  /* Shift-major: page s of nr x nc is row block s of the stack */
+  c0 = clock();
+  (void)stackzsCopy(pOut, NULL, pIn, NULL, sizeof(double), nr, nc, nShifts, shifts,
+		    STACKZS_LAYOUT_SHIFT_MAJOR, 1);
+  printf("     stackzsCopy shiftMajor %.2f ns/output element\n",
+	 testSeconds(c0)*1e9/((double)nOut));
+  for (s = 0, errIm = 0.; s < nShifts; s++)
+    {
+      for (j = 0; j < nc; j++)
+	{
+	  for (r = 0; r < nr; r++)
+	    {
+	      el = (s*nr + r) + (size_t)j*nr*nShifts;
+	      errIm += fabs(pOut[r + (size_t)j*nr + (size_t)s*nIn] - pRef[el]);
+	    }
+	}
+    }
+  testCheck("stackzsCopy shiftMajor vs reference", errIm, 0.);
+
+  /* float32 */
+  for (ii = 0; ii < nIn; ii++)
+    {
+      pF[ii] = (float)pIn[ii];
+    }
+  (void)stackzsCopy(pOutF, NULL, pF, NULL, sizeof(float), nr, nc, nShifts, shifts,
+		    STACKZS_LAYOUT_STACKED, 4);
+  for (ii = 0, errF = 0.; ii < nOut; ii++)
+    {
+      errF += fabs((double)pOutF[ii] - (double)(float)pRef[ii]);
+    }
+  testCheck("stackzsCopy float32 vs reference", errF, 0.);
+
+  free(pIn);
+  free(pIn_im);
+  free(pOut);
+  free(pOut_im);
+  free(pRef);
+  free(pRef_im);
+  free(pPairs);
+  free(pF);
+  free(pOutF);
+}
+
+/*---------------------------------------------------------------------*/
+
+/*
+  R = Z*Z' and C = Z*ref' of Z = Stackzs(z, shifts), z and ref complex,
+  against the product of the stack
+*/
+static void testStackzsCov(int nc)
+{
+  double shifts[6] = {-2., -1., 0., 1., 2., 0.};
+  int nr = 3, nShifts = 6, nRef = 2;
+  int nRows = nr*nShifts;
+  size_t nZ = (size_t)nr*nc, nSt = (size_t)nRows*nc;
+  size_t nR = (size_t)nRows*nRows, nC = (size_t)nRows*nRef;
+  double *pZ_re = (double *)malloc(nZ*sizeof(double));
+  double *pZ_im = (double *)malloc(nZ*sizeof(double));
+  double *pZx = (double *)malloc(2*nZ*sizeof(double));
+  double *pRef_re = (double *)malloc((size_t)nRef*nc*sizeof(double));
+  double *pRef_im = (double *)malloc((size_t)nRef*nc*sizeof(double));
+  double *pSt_re = (double *)malloc(nSt*sizeof(double));
+  double *pSt_im = (double *)malloc(nSt*sizeof(double));
+  double *pRr_re = (double *)calloc(nR, sizeof(double));
+  double *pRr_im = (double *)calloc(nR, sizeof(double));
+  double *pCr_re = (double *)calloc(nC, sizeof(double));
+  double *pCr_im = (double *)calloc(nC, sizeof(double));
+  double *pRrr = (double *)calloc(nR, sizeof(double));
+  double *pCrr = (double *)calloc(nC, sizeof(double));
+  double *pR_re = (double *)malloc(nR*sizeof(double));
+  double *pR_im = (double *)malloc(nR*sizeof(double));
+  double *pC_re = (double *)malloc(nC*sizeof(double));
+  double *pC_im = (double *)malloc(nC*sizeof(double));
+  double *pRx = (double *)malloc(2*nR*sizeof(double));
+  double *pR1_re = (double *)malloc(nR*sizeof(double));
+  double *pR1_im = (double *)malloc(nR*sizeof(double));
+  double *pC1_re = (double *)malloc(nC*sizeof(double));
+  double *pC1_im = (double *)malloc(nC*sizeof(double));
+  double scale = 0., err;
+  size_t ii;
+  int a, b, j, status;
+  clock_t c0;
+
+  shifts[5] = 3.*nc - 3.;                     /* Several cycles, as -3 */
+  for (ii = 0; ii < nZ; ii++)
+    {
+      pZ_re[ii] = pZx[2*ii] = testRand();
+      pZ_im[ii] = pZx[2*ii + 1] = testRand();
+    }
+  for (ii = 0; ii < (size_t)nRef*nc; ii++)
+    {
+      pRef_re[ii] = testRand();
+      pRef_im[ii] = testRand();
+    }
+
+  c0 = clock();
+  (void)Stackzs(pSt_re, pZ_re, nr, nc, nShifts, shifts);
+  (void)Stackzs(pSt_im, pZ_im, nr, nc, nShifts, shifts);
+  for (j = 0; j < nc; j++)
+    {
+      for (b = 0; b < nRows; b++)
+	{
+	  for (a = 0; a < nRows; a++)
+	    {
+	      pRr_re[a + (size_t)b*nRows] += pSt_re[a + (size_t)j*nRows]*pSt_re[b + (size_t)j*nRows]
+		+ pSt_im[a + (size_t)j*nRows]*pSt_im[b + (size_t)j*nRows];
+	      pRr_im[a + (size_t)b*nRows] += pSt_im[a + (size_t)j*nRows]*pSt_re[b + (size_t)j*nRows]
+		- pSt_re[a + (size_t)j*nRows]*pSt_im[b + (size_t)j*nRows];
+	      pRrr[a + (size_t)b*nRows] += pSt_re[a + (size_t)j*nRows]*pSt_re[b + (size_t)j*nRows];
+	    }
+	}
+      for (b = 0; b < nRef; b++)
+	{
+	  for (a = 0; a < nRows; a++)
+	    {
+	      pCr_re[a + (size_t)b*nRows] += pSt_re[a + (size_t)j*nRows]*pRef_re[b + (size_t)j*nRef]
+		+ pSt_im[a + (size_t)j*nRows]*pRef_im[b + (size_t)j*nRef];
+	      pCr_im[a + (size_t)b*nRows] += pSt_im[a + (size_t)j*nRows]*pRef_re[b + (size_t)j*nRef]
+		- pSt_re[a + (size_t)j*nRows]*pRef_im[b + (size_t)j*nRef];
+	      pCrr[a + (size_t)b*nRows] += pSt_re[a + (size_t)j*nRows]*pRef_re[b + (size_t)j*nRef];
+	    }
+	}
+    }
+  printf("     Stackzs and product %.2f ns/sample\n", testSeconds(c0)*1e9/nc);
+  for (ii = 0; ii < nR; ii++)
+    {
+      scale = (fabs(pRr_re[ii]) > scale) ? fabs(pRr_re[ii]) : scale;
+    }
+
+  c0 = clock();
+  status = stackzsCov(pR_re, pR_im, 1, pC_re, pC_im, 1, pZ_re, pZ_im, 1,
+		      nr, nc, nShifts, shifts, pRef_re, pRef_im, 1, nRef, 1);
+  printf("     stackzsCov %.2f ns/sample\n", testSeconds(c0)*1e9/nc);
+  testCheck("stackzsCov R vs Stackzs product",
+	    status ? 1. : (testMaxDiff(pR_re, pRr_re, nR) + testMaxDiff(pR_im, pRr_im, nR))/scale, 1e-12);
+  testCheck("stackzsCov C vs Stackzs product",
+	    status ? 1. : (testMaxDiff(pC_re, pCr_re, nC) + testMaxDiff(pC_im, pCr_im, nC))/scale, 1e-12);
+  for (b = 0, err = 0.; b < nRows; b++)
+    {
+      for (a = 0; a < nRows; a++)
+	{
+	  err += fabs(pR_re[a + (size_t)b*nRows] - pR_re[b + (size_t)a*nRows]);
+	  err += fabs(pR_im[a + (size_t)b*nRows] + pR_im[b + (size_t)a*nRows]);
+	}
+    }
+  testCheck("stackzsCov R Hermitian", err, 0.);
+  memcpy(pR1_re, pR_re, nR*sizeof(double));
+  memcpy(pR1_im, pR_im, nR*sizeof(double));
+  memcpy(pC1_re, pC_re, nC*sizeof(double));
+  memcpy(pC1_im, pC_im, nC*sizeof(double));
+
+  status = stackzsCov(pRx, pRx + 1, 2, NULL, NULL, 1, pZx, pZx + 1, 2,
+		      nr, nc, nShifts, shifts, NULL, NULL, 1, 0, 1);
+  for (ii = 0, err = 0.; ii < nR; ii++)
+    {
+      err += fabs(pRx[2*ii] - pR1_re[ii]) + fabs(pRx[2*ii + 1] - pR1_im[ii]);
+    }
+  testCheck("stackzsCov interleaved vs split", status ? 1. : err, 0.);
+
+  /* The real parts alone */
+  status = stackzsCov(pR_re, NULL, 1, pC_re, NULL, 1, pZ_re, NULL, 1,
+		      nr, nc, nShifts, shifts, pRef_re, NULL, 1, nRef, 1);
+  testCheck("stackzsCov real vs Stackzs product",
+	    status ? 1. : (testMaxDiff(pR_re, pRrr, nR) + testMaxDiff(pC_re, pCrr, nC))/scale, 1e-12);
+
+  status = stackzsCov(pR_re, pR_im, 1, pC_re, pC_im, 1, pZ_re, pZ_im, 1,
+		      nr, nc, nShifts, shifts, pRef_re, pRef_im, 1, nRef, 4);
+  testCheck("stackzsCov 4 threads vs 1",
+	    status ? 1. : testMaxDiff(pR_re, pR1_re, nR) + testMaxDiff(pR_im, pR1_im, nR)
+	    + testMaxDiff(pC_re, pC1_re, nC) + testMaxDiff(pC_im, pC1_im, nC), 0.);
+
+  free(pZ_re);
+  free(pZ_im);
+  free(pZx);
+  free(pRef_re);
+  free(pRef_im);
+  free(pSt_re);
+  free(pSt_im);
+  free(pRr_re);
+  free(pRr_im);
+  free(pCr_re);
+  free(pCr_im);
+  free(pRrr);
+  free(pCrr);
+  free(pR_re);
+  free(pR_im);
+  free(pC_re);
+  free(pC_im);
+  free(pRx);
+  free(pR1_re);
+  free(pR1_im);
+  free(pC1_re);
+  free(pC1_im);
+}
+
+/*---------------------------------------------------------------------*/
+
+/*
+  y = w'*Z of Z = Stackzs(z, shifts), z and w complex, against the
+  product of the stack
+*/
+static void testStackzsApply(int nc)
+{
+  double shifts[4] = {0., 1., 2., 0.};
+  int nr = 4, nShifts = 4, nW = 2;
+  int nRows = nr*nShifts;
+  size_t nZ = (size_t)nr*nc, nY = (size_t)nW*nc, nWts = (size_t)nRows*nW;
+  double *pZ_re = (double *)malloc(nZ*sizeof(double));
+  double *pZ_im = (double *)malloc(nZ*sizeof(double));
+  double *pZx = (double *)malloc(2*nZ*sizeof(double));
+  double *pW_re = (double *)malloc(nWts*sizeof(double));
+  double *pW_im = (double *)malloc(nWts*sizeof(double));
+  double *pWx = (double *)malloc(2*nWts*sizeof(double));
+  double *pSt_re = (double *)malloc((size_t)nRows*nc*sizeof(double));
+  double *pSt_im = (double *)malloc((size_t)nRows*nc*sizeof(double));
+  double *pYr_re = (double *)calloc(nY, sizeof(double));
+  double *pYr_im = (double *)calloc(nY, sizeof(double));
+  double *pYrr = (double *)calloc(nY, sizeof(double));
+  double *pY_re = (double *)malloc(nY*sizeof(double));
+  double *pY_im = (double *)malloc(nY*sizeof(double));
+  double *pYx = (double *)malloc(2*nY*sizeof(double));
+  double err;
+  size_t ii, q;
+  int r, j, status;
+  clock_t c0;
+
+  shifts[3] = -2.*nc - 1.;                    /* Several cycles, as -1 */
+  for (ii = 0; ii < nZ; ii++)
+    {
+      pZ_re[ii] = pZx[2*ii] = testRand();
+      pZ_im[ii] = pZx[2*ii + 1] = testRand();
+    }
+  for (ii = 0; ii < nWts; ii++)
+    {
+      pW_re[ii] = pWx[2*ii] = testRand();
+      pW_im[ii] = pWx[2*ii + 1] = testRand();
+    }
+
+  c0 = clock();
+  (void)Stackzs(pSt_re, pZ_re, nr, nc, nShifts, shifts);
+  (void)Stackzs(pSt_im, pZ_im, nr, nc, nShifts, shifts);
+  for (j = 0; j < nc; j++)
+    {
+      for (r = 0; r < nW; r++)
+	{
+	  for (q = 0; q < (size_t)nRows; q++)
+	    {
+	      pYr_re[r + (size_t)j*nW] += pW_re[q + (size_t)r*nRows]*pSt_re[q + (size_t)j*nRows]
+		+ pW_im[q + (size_t)r*nRows]*pSt_im[q + (size_t)j*nRows];
+	      pYr_im[r + (size_t)j*nW] += pW_re[q + (size_t)r*nRows]*pSt_im[q + (size_t)j*nRows]
+		- pW_im[q + (size_t)r*nRows]*pSt_re[q + (size_t)j*nRows];
+	      pYrr[r + (size_t)j*nW] += pW_re[q + (size_t)r*nRows]*pSt_re[q + (size_t)j*nRows];
+	    }
+	}
+    }
+  printf("     Stackzs and product %.2f ns/sample\n", testSeconds(c0)*1e9/nc);
+
+  c0 = clock();
+  status = stackzsApply(pY_re, pY_im, 1, pW_re, pW_im, 1, nW, pZ_re, pZ_im, 1,
+			nr, nc, nShifts, shifts, 1);
+  printf("     stackzsApply %.2f ns/sample\n", testSeconds(c0)*1e9/nc);
+  testCheck("stackzsApply vs Stackzs product",
+	    status ? 1. : testMaxDiff(pY_re, pYr_re, nY) + testMaxDiff(pY_im, pYr_im, nY), 1e-12);
+
+  status = stackzsApply(pYx, pYx + 1, 2, pWx, pWx + 1, 2, nW, pZx, pZx + 1, 2,
+			nr, nc, nShifts, shifts, 1);
+  for (ii = 0, err = 0.; ii < nY; ii++)
+    {
+      err += fabs(pYx[2*ii] - pY_re[ii]) + fabs(pYx[2*ii + 1] - pY_im[ii]);
+    }
+  testCheck("stackzsApply interleaved vs split", status ? 1. : err, 0.);
+
+  /* The real parts alone */
+  status = stackzsApply(pYx, NULL, 1, pW_re, NULL, 1, nW, pZ_re, NULL, 1,
+			nr, nc, nShifts, shifts, 1);
+  testCheck("stackzsApply real vs Stackzs product",
+	    status ? 1. : testMaxDiff(pYx, pYrr, nY), 1e-12);
+
+  memcpy(pYr_re, pY_re, nY*sizeof(double));
+  memcpy(pYr_im, pY_im, nY*sizeof(double));
+  status = stackzsApply(pY_re, pY_im, 1, pW_re, pW_im, 1, nW, pZ_re, pZ_im, 1,
+			nr, nc, nShifts, shifts, 4);
+  testCheck("stackzsApply 4 threads vs 1",
+	    status ? 1. : testMaxDiff(pY_re, pYr_re, nY) + testMaxDiff(pY_im, pYr_im, nY), 0.);
+
+  free(pZ_re);
+  free(pZ_im);
+  free(pZx);
+  free(pW_re);
+  free(pW_im);
+  free(pWx);
+  free(pSt_re);
+  free(pSt_im);
+  free(pYr_re);
+  free(pYr_im);
+  free(pYrr);
+  free(pY_re);
+  free(pY_im);
+  free(pYx);
+}
+
+/*---------------------------------------------------------------------*/
+
+/*
+  ProcessSampledChannel.m on nT x nS complex sources, one sample at a
+  time: modulate by exp(1j*(2 pi f (startSamp + m) + phi)) unless f is
+  0, filter by each tap of H, keep the outputs from the nDelay-th on
+*/
+static void testStfcsRef(double *pY_re, double *pY_im, const double *pH_re, const double *pH_im,
+			 int nR, int nT, int nDop, int nDelay, const double *freqOffs,
+			 const double *phiOffs, double startSamp, const double *pS_re,
+			 const double *pS_im, int nS)
+{
+  double phase, c, sn, z_re, z_im;
+  int nOut = nS - nDelay + 1;
+  int r, t, d, k, n, m;
+  size_t q, el;
+
+  for (n = 0; n < nR*nOut; n++)
+    {
+      pY_re[n] = pY_im[n] = 0.;
+    }
+  for (r = 0; r < nR; r++)
+    {
+      for (t = 0; t < nT; t++)
+	{
+	  for (d = 0; d < nDop; d++)
+	    {
+	      for (n = 0; n < nOut; n++)
+		{
+		  for (k = 0; k < nDelay; k++)
+		    {
+		      m = n + nDelay - 1 - k;
+		      el = t + (size_t)m*nT;
+		      phase = TEST_TWOPI*freqOffs[d]*(startSamp + m) + phiOffs[d];
+		      c = (freqOffs[d] != 0.) ? cos(phase) : 1.;
+		      sn = (freqOffs[d] != 0.) ? sin(phase) : 0.;
+		      z_re = c*pS_re[el] - sn*pS_im[el];
+		      z_im = c*pS_im[el] + sn*pS_re[el];
+		      q = r + (size_t)nR*(t + (size_t)nT*(d + (size_t)nDop*k));
+		      pY_re[r + (size_t)n*nR] += pH_re[q]*z_re - pH_im[q]*z_im;
+		      pY_im[r + (size_t)n*nR] += pH_re[q]*z_im + pH_im[q]*z_re;
+		    }
+		}
+	    }
+	}
+    }
+}
+
+/*
+  stfcsFilter() against testStfcsRef(), and its interleaved, real
+  source and threaded variants
+*/
+static void testStfcs(int nS)
+{
+  double freqOffs[3] = {-1.25e-3, 0., 3e-4};
+  double phiOffs[3] = {0.3, 1.1, -2.};
+  double startSamp = 123456.;
+  int nR = 3, nT = 2, nDop = 3, nDelay = 7;
+  int nOut = nS - nDelay + 1;
+  size_t nH = (size_t)nR*nT*nDop*nDelay, nSrc = (size_t)nT*nS, nY = (size_t)nR*nOut, ii;
+  double *pH_re = (double *)malloc(nH*sizeof(double));
+  double *pH_im = (double *)malloc(nH*sizeof(double));
+  double *pHx = (double *)malloc(2*nH*sizeof(double));
+  double *pS_re = (double *)malloc(nSrc*sizeof(double));
+  double *pS_im = (double *)malloc(nSrc*sizeof(double));
+  double *pSx = (double *)malloc(2*nSrc*sizeof(double));
+  double *pZero = (double *)calloc(nSrc, sizeof(double));
+  double *pRef_re = (double *)malloc(nY*sizeof(double));
+  double *pRef_im = (double *)malloc(nY*sizeof(double));
+  double *pY_re = (double *)malloc(nY*sizeof(double));
+  double *pY_im = (double *)malloc(nY*sizeof(double));
+  double *pY1_re = (double *)malloc(nY*sizeof(double));
+  double *pY1_im = (double *)malloc(nY*sizeof(double));
+  double *pYx = (double *)malloc(2*nY*sizeof(double));
+  double err;
+  int status;
+  clock_t c0;
+
+  for (ii = 0; ii < nH; ii++)
+    {
+      pH_re[ii] = pHx[2*ii] = testRand();
+      pH_im[ii] = pHx[2*ii + 1] = testRand();
+    }
+  pH_re[1] = pH_im[1] = pHx[2] = pHx[3] = 0.; /* A zero tap */
+  for (ii = 0; ii < nSrc; ii++)
+    {
+      pS_re[ii] = pSx[2*ii] = testRand();
+      pS_im[ii] = pSx[2*ii + 1] = testRand();
+    }
+
+  c0 = clock();
+  testStfcsRef(pRef_re, pRef_im, pH_re, pH_im, nR, nT, nDop, nDelay, freqOffs, phiOffs,
+	       startSamp, pS_re, pS_im, nS);
+  printf("     ProcessSampledChannel loop %.2f ns/sample\n", testSeconds(c0)*1e9/nOut);
+
+  c0 = clock();
+  status = stfcsFilter(pY1_re, pY1_im, 1, pH_re, pH_im, 1, nR, nT, nDop, nDelay,
+		       freqOffs, phiOffs, startSamp, pS_re, pS_im, 1, nS, 1);
+  printf("     stfcsFilter %.2f ns/sample\n", testSeconds(c0)*1e9/nOut);
+  testCheck("stfcsFilter vs reference",
+	    status ? 1. : testMaxDiff(pY1_re, pRef_re, nY) + testMaxDiff(pY1_im, pRef_im, nY), 1e-11);
+
+  status = stfcsFilter(pYx, pYx + 1, 2, pHx, pHx + 1, 2, nR, nT, nDop, nDelay,
+		       freqOffs, phiOffs, startSamp, pSx, pSx + 1, 2, nS, 1);
+  for (ii = 0, err = 0.; ii < nY; ii++)
+    {
+      err += fabs(pYx[2*ii] - pY1_re[ii]) + fabs(pYx[2*ii + 1] - pY1_im[ii]);
+    }
+  testCheck("stfcsFilter interleaved vs split", status ? 1. : err, 0.);
+
+  status = stfcsFilter(pY_re, pY_im, 1, pH_re, pH_im, 1, nR, nT, nDop, nDelay,
+		       freqOffs, phiOffs, startSamp, pS_re, NULL, 1, nS, 1);
+  testStfcsRef(pRef_re, pRef_im, pH_re, pH_im, nR, nT, nDop, nDelay, freqOffs, phiOffs,
+	       startSamp, pS_re, pZero, nS);
+  testCheck("stfcsFilter real source vs reference",
+	    status ? 1. : testMaxDiff(pY_re, pRef_re, nY) + testMaxDiff(pY_im, pRef_im, nY), 1e-11);
+
+  status = stfcsFilter(pY_re, pY_im, 1, pH_re, pH_im, 1, nR, nT, nDop, nDelay,
+		       freqOffs, phiOffs, startSamp, pS_re, pS_im, 1, nS, 4);
+  testCheck("stfcsFilter 4 threads vs 1",
+	    status ? 1. : testMaxDiff(pY_re, pY1_re, nY) + testMaxDiff(pY_im, pY1_im, nY), 0.);
+
+  free(pH_re);
+  free(pH_im);
+  free(pHx);
+  free(pS_re);
+  free(pS_im);
+  free(pSx);
+  free(pZero);
+  free(pRef_re);
+  free(pRef_im);
+  free(pY_re);
+  free(pY_im);
+  free(pY1_re);
+  free(pY1_im);
+  free(pYx);
+}
+
+/*---------------------------------------------------------------------*/
+
+/* out(n) = sum over lags of H(n, lag) source(n + longestLag - lags(lag)) */
+static void testTvconvRef(double *pOut_re, double *pOut_im, int nS, int nLags,
+			  const double *pH_re, const double *pH_im, const double *pLags,
+			  const double *pSrc_re, const double *pSrc_im, int longestLag)
+{
+  int n, col, idx;
+
+  for (n = 0; n < nS; n++)
+    {
+      pOut_re[n] = pOut_im[n] = 0.;
+      for (col = 0; col < nLags; col++)
+	{
+	  idx = n + longestLag - (int)pLags[col];
+	  if ((idx < 0) || (idx >= nS))
+	    {
+	      continue;
+	    }
+	  pOut_re[n] += pH_re[n + (size_t)col*nS]*pSrc_re[idx] - pH_im[n + (size_t)col*nS]*pSrc_im[idx];
+	  pOut_im[n] += pH_re[n + (size_t)col*nS]*pSrc_im[idx] + pH_im[n + (size_t)col*nS]*pSrc_re[idx];
+	}
+    }
+}
+
+static void testTvconv(int nS)
+{
+  double lags[6] = {0., 1., 2., 4., 7., 12.};
+  int nLags = 6, longestLag = 12;
+  size_t nH = (size_t)nS*nLags;
+  double *pH_re = (double *)malloc(nH*sizeof(double));
+  double *pH_im = (double *)malloc(nH*sizeof(double));
+  double *pHl_re = (double *)malloc(nH*sizeof(double));
+  double *pHl_im = (double *)malloc(nH*sizeof(double));
+  double *pHx = (double *)malloc(2*nH*sizeof(double));
+  double *pSrc_re = (double *)malloc(nS*sizeof(double));
+  double *pSrc_im = (double *)malloc(nS*sizeof(double));
+  double *pSrcx = (double *)malloc(2*nS*sizeof(double));
+  double *pRef_re = (double *)malloc(nS*sizeof(double));
+  double *pRef_im = (double *)malloc(nS*sizeof(double));
+  double *pOut_re = (double *)malloc(nS*sizeof(double));
+  double *pOut_im = (double *)malloc(nS*sizeof(double));
+  double *pOutx = (double *)malloc(2*nS*sizeof(double));
+  double *pOut1_re = (double *)malloc(nS*sizeof(double));
+  double *pOut1_im = (double *)malloc(nS*sizeof(double));
+  tvconvWorkspace *ws = tvconvWorkspaceCreate();
+  static const char *isaName[3] = {"scalar", "avx2", "avx512"};
+  char name[64];
+  double err;
+  size_t ii;
+  int n, col, isa, status;
+  clock_t c0;
+
+  for (ii = 0; ii < nH; ii++)
+    {
+      pH_re[ii] = testRand();
+      pH_im[ii] = testRand();
+    }
+  for (n = 0; n < nS; n++)
+    {
+      pSrc_re[n] = pSrcx[2*n] = testRand();
+      pSrc_im[n] = pSrcx[2*n + 1] = testRand();
+      for (col = 0; col < nLags; col++)
+	{
+	  pHl_re[col + (size_t)n*nLags] = pH_re[n + (size_t)col*nS];
+	  pHl_im[col + (size_t)n*nLags] = pH_im[n + (size_t)col*nS];
+	  pHx[2*(col + (size_t)n*nLags)] = pH_re[n + (size_t)col*nS];
+	  pHx[2*(col + (size_t)n*nLags) + 1] = pH_im[n + (size_t)col*nS];
+	}
+    }
+  testTvconvRef(pRef_re, pRef_im, nS, nLags, pH_re, pH_im, lags, pSrc_re, pSrc_im, longestLag);
+
+  /* Every instruction set gives the same bits as the scalar kernel */
+  for (isa = TVCONV_ISA_SCALAR; isa <= TVCONV_ISA_AVX512; isa++)
+    {
+      if (tvconvSelectIsa(isa) != isa)
+	{
+	  continue;
+	}
+      c0 = clock();
+      status = tvconv(pOut_re, pOut_im, nS, nLags, pH_re, pH_im,
+		      TVCONV_H_SAMPLE_MAJOR, TVCONV_CPLX_SPLIT, lags,
+		      pSrc_re, pSrc_im, longestLag, 1., 0, ws, 1);
+      printf("     tvconv %s, %d lags: %.2f ns/sample\n", isaName[isa], nLags,
+	     testSeconds(c0)*1e9/nS);
+      err = testMaxDiff(pOut_re, pRef_re, nS) + testMaxDiff(pOut_im, pRef_im, nS);
+      sprintf(name, "tvconv %s vs reference", isaName[isa]);
+      testCheck(name, status ? 1. : err, 1e-12);
+      if (isa == TVCONV_ISA_SCALAR)
+	{
+	  memcpy(pOut1_re, pOut_re, nS*sizeof(double));
+	  memcpy(pOut1_im, pOut_im, nS*sizeof(double));
+	}
+      else
+	{
+	  sprintf(name, "tvconv %s vs scalar", isaName[isa]);
+	  testCheck(name, testMaxDiff(pOut_re, pOut1_re, nS) + testMaxDiff(pOut_im, pOut1_im, nS), 0.);
+	}
+    }
+  (void)tvconvSelectIsa(TVCONV_ISA_AUTO);
+
+  status = tvconv(pOut_re, pOut_im, nS, nLags, pHl_re, pHl_im,
+		  TVCONV_H_LAG_MAJOR, TVCONV_CPLX_SPLIT, lags,
+		  pSrc_re, pSrc_im, longestLag, 1., 0, ws, 1);
+  testCheck("tvconv lag-major vs sample-major",
+	    status ? 1. : testMaxDiff(pOut_re, pOut1_re, nS) + testMaxDiff(pOut_im, pOut1_im, nS), 0.);
+
+  status = tvconv(pOutx, pOutx + 1, nS, nLags, pHx, pHx + 1,
+		  TVCONV_H_LAG_MAJOR, TVCONV_CPLX_INTERLEAVED, lags,
+		  pSrcx, pSrcx + 1, longestLag, 1., 0, ws, 1);
+  for (n = 0, err = 0.; n < nS; n++)
+    {
+      err = (fabs(pOutx[2*n] - pOut1_re[n]) > err) ? fabs(pOutx[2*n] - pOut1_re[n]) : err;
+      err = (fabs(pOutx[2*n + 1] - pOut1_im[n]) > err) ? fabs(pOutx[2*n + 1] - pOut1_im[n]) : err;
+    }
+  testCheck("tvconv interleaved vs split", status ? 1. : err, 0.);
+
+  /*
+    Real H and source added into a complex output: the interleaved
+    kernels store pairs with a zero imaginary part
+  */
+  for (isa = TVCONV_ISA_SCALAR; isa <= TVCONV_ISA_AVX512; isa++)
+    {
+      if (tvconvSelectIsa(isa) != isa)
+	{
+	  continue;
+	}
+      memcpy(pOut_re, pOut1_re, nS*sizeof(double));
+      memcpy(pOut_im, pOut1_im, nS*sizeof(double));
+      for (n = 0; n < nS; n++)
+	{
+	  pOutx[2*n] = pOut1_re[n];
+	  pOutx[2*n + 1] = pOut1_im[n];
+	}
+      status = tvconv(pOut_re, pOut_im, nS, nLags, pH_re, NULL,
+		      TVCONV_H_SAMPLE_MAJOR, TVCONV_CPLX_SPLIT, lags,
+		      pSrc_re, NULL, longestLag, 1., 1, ws, 1);
+      status += tvconv(pOutx, pOutx + 1, nS, nLags, pH_re, NULL,
+		       TVCONV_H_SAMPLE_MAJOR, TVCONV_CPLX_INTERLEAVED, lags,
+		       pSrc_re, NULL, longestLag, 1., 1, ws, 1);
+      for (n = 0, err = 0.; n < nS; n++)
+	{
+	  err = (fabs(pOutx[2*n] - pOut_re[n]) > err) ? fabs(pOutx[2*n] - pOut_re[n]) : err;
+	  err = (fabs(pOutx[2*n + 1] - pOut_im[n]) > err) ? fabs(pOutx[2*n + 1] - pOut_im[n]) : err;
+	}
+      err += testMaxDiff(pOut_im, pOut1_im, nS);
+      sprintf(name, "tvconv %s real added interleaved vs split", isaName[isa]);
+      testCheck(name, status ? 1. : err, 0.);
+    }
+  (void)tvconvSelectIsa(TVCONV_ISA_AUTO);
+
+  /* Scaled and accumulated onto the first result: 3 times it */
+  memcpy(pOut_re, pOut1_re, nS*sizeof(double));
+  memcpy(pOut_im, pOut1_im, nS*sizeof(double));
+  status = tvconv(pOut_re, pOut_im, nS, nLags, pH_re, pH_im,
+		  TVCONV_H_SAMPLE_MAJOR, TVCONV_CPLX_SPLIT, lags,
+		  pSrc_re, pSrc_im, longestLag, 2., 1, NULL, 1);
+  for (n = 0, err = 0.; n < nS; n++)
+    {
+      err = (fabs(pOut_re[n] - 3.*pOut1_re[n]) > err) ? fabs(pOut_re[n] - 3.*pOut1_re[n]) : err;
+      err = (fabs(pOut_im[n] - 3.*pOut1_im[n]) > err) ? fabs(pOut_im[n] - 3.*pOut1_im[n]) : err;
+    }
+  testCheck("tvconv scale and accumulate", status ? 1. : err, 1e-12);
+
+  tvconvWorkspaceDestroy(ws);
+  free(pH_re);
+  free(pH_im);
+  free(pHl_re);
+  free(pHl_im);
+  free(pHx);
+  free(pSrc_re);
+  free(pSrc_im);
+  free(pSrcx);
+  free(pRef_re);
+  free(pRef_im);
+  free(pOut_re);
+  free(pOut_im);
+  free(pOutx);
+  free(pOut1_re);
+  free(pOut1_im);
+}
+
+/*---------------------------------------------------------------------*/
+
+/* Random 'zheng' chanstate, as GetWssusChannel.m makes them */
+/*
+  Threaded tvconv against single-threaded, on a call big enough
+  (TEST_TVCONV_MT_NS samples of 6 lags) to pass TVCONV_MT_MIN_WORK
+*/
+static void testTvconvThreads(void)
+{
+  double lags[6] = {0., 1., 2., 4., 7., 12.};
+  int nS = TEST_TVCONV_MT_NS, nLags = 6, longestLag = 12;
+  size_t nH = (size_t)nS*nLags;
+  double *pH_re = (double *)malloc(nH*sizeof(double));
+  double *pH_im = (double *)malloc(nH*sizeof(double));
+  double *pSrc_re = (double *)malloc(nS*sizeof(double));
+  double *pSrc_im = (double *)malloc(nS*sizeof(double));
+  double *pOut_re = (double *)malloc(nS*sizeof(double));
+  double *pOut_im = (double *)malloc(nS*sizeof(double));
+  double *pOut1_re = (double *)malloc(nS*sizeof(double));
+  double *pOut1_im = (double *)malloc(nS*sizeof(double));
+  size_t ii;
+  int n, status;
+
+  for (ii = 0; ii < nH; ii++)
+    {
+      pH_re[ii] = testRand();
+      pH_im[ii] = testRand();
+    }
+  for (n = 0; n < nS; n++)
+    {
+      pSrc_re[n] = testRand();
+      pSrc_im[n] = testRand();
+    }
+
+  status = tvconv(pOut1_re, pOut1_im, nS, nLags, pH_re, pH_im,
+		  TVCONV_H_SAMPLE_MAJOR, TVCONV_CPLX_SPLIT, lags,
+		  pSrc_re, pSrc_im, longestLag, 1., 0, NULL, 1);
+  status |= tvconv(pOut_re, pOut_im, nS, nLags, pH_re, pH_im,
+		   TVCONV_H_SAMPLE_MAJOR, TVCONV_CPLX_SPLIT, lags,
+		   pSrc_re, pSrc_im, longestLag, 1., 0, NULL, 4);
+  testCheck("tvconv 4 threads vs 1",
+	    status ? 1. : testMaxDiff(pOut_re, pOut1_re, nS) + testMaxDiff(pOut_im, pOut1_im, nS), 0.);
+
+  free(pH_re);
+  free(pH_im);
+  free(pSrc_re);
+  free(pSrc_im);
+  free(pOut_re);
+  free(pOut_im);
+  free(pOut1_re);
+  free(pOut1_im);
+}
+
+static void testZhengState(double *pAlph, double *pPhi, double *pSphi)
+{
+  double theta = TEST_TWOPI*(testRand() + 1.)/2.;
+  int m;
+
+  for (m = 0; m < TEST_M; m++)
+    {
+      pAlph[m] = (TEST_TWOPI*(m + 1) - TEST_TWOPI/2. + theta)/(4.*TEST_M);
+      pPhi[m] = TEST_TWOPI*(testRand() + 1.)/2.;
+      pSphi[m] = TEST_TWOPI*(testRand() + 1.)/2.;
+    }
+}
+
+/* The zheng subfunction of jakes4.m, with libm cos */
+static void testZhengRef(double *hr, double *hi, double t0, int nSamp, double f,
+			 const double *alph, const double *phi, const double *sphi)
+{
+  int k, m;
+
+  for (k = 0; k < nSamp; k++)
+    {
+      hr[k] = hi[k] = 0.;
+      for (m = 0; m < TEST_M; m++)
+	{
+	  hr[k] += 2.*cos(TEST_TWOPI*f*cos(alph[m])*(t0 + k) + phi[m]);
+	  hi[k] += 2.*cos(TEST_TWOPI*f*sin(alph[m])*(t0 + k) + sphi[m]);
+	}
+      hr[k] *= sqrt(1./(4.*TEST_M));
+      hi[k] *= sqrt(1./(4.*TEST_M));
+    }
+}
+
+static void testZheng(int nS)
+{
+  int nLags = 3, nPairs = 2;
+  size_t nSin = (size_t)TEST_M*nLags*nPairs;
+  double *pAlph = (double *)malloc(nSin*sizeof(double));
+  double *pPhi = (double *)malloc(nSin*sizeof(double));
+  double *pSphi = (double *)malloc(nSin*sizeof(double));
+  double *t = (double *)malloc(nS*sizeof(double));
+  double *hr = (double *)malloc(nS*sizeof(double));
+  double *hi = (double *)malloc(nS*sizeof(double));
+  double *refr = (double *)malloc(nS*sizeof(double));
+  double *refi = (double *)malloc(nS*sizeof(double));
+  double *Hr = (double *)malloc(nS*nLags*nPairs*sizeof(double));
+  double *Hi = (double *)malloc(nS*nLags*nPairs*sizeof(double));
+  double *H1r = (double *)malloc(nS*nLags*nPairs*sizeof(double));
+  double *H1i = (double *)malloc(nS*nLags*nPairs*sizeof(double));
+  double lagsPair[2] = {3., 2.};
+  double f = 1e-3, t0 = 123456.;
+  double err;
+  int k, lag, p, status;
+  size_t ii;
+  clock_t c0;
+
+  for (ii = 0; ii < nSin; ii += TEST_M)
+    {
+      testZhengState(pAlph + ii, pPhi + ii, pSphi + ii);
+    }
+  for (k = 0; k < nS; k++)
+    {
+      t[k] = t0 + k;
+    }
+  testZhengRef(refr, refi, t0, nS, f, pAlph, pPhi, pSphi);
+
+  /* Polynomial cosines, then the linear and the nearest table */
+  c0 = clock();
+  status = zhengFunLUT(hr, hi, 1, t, nS, f, pAlph, pPhi, pSphi, TEST_M,
+		       0., 1e-12, 0, NULL);
+  printf("     zhengFunLUT polynomial: %.2f ns/sample\n", testSeconds(c0)*1e9/nS);
+  testCheck("zhengFunLUT polynomial vs libm",
+	    status ? 1. : testMaxDiff(hr, refr, nS) + testMaxDiff(hi, refi, nS), 1e-9);
+  c0 = clock();
+  status = zhengFunLUT(hr, hi, 1, t, nS, f, pAlph, pPhi, pSphi, TEST_M,
+		       0., 0., 1024, "linear");
+  printf("     zhengFunLUT linear table: %.2f ns/sample\n", testSeconds(c0)*1e9/nS);
+  testCheck("zhengFunLUT linear 1024 vs libm",
+	    status ? 1. : testMaxDiff(hr, refr, nS) + testMaxDiff(hi, refi, nS), 1e-4);
+  status = zhengFunLUT(hr, hi, 1, t, nS, f, pAlph, pPhi, pSphi, TEST_M,
+		       0., 0., 65536, "nearest");
+  testCheck("zhengFunLUT nearest 65536 vs libm",
+	    status ? 1. : testMaxDiff(hr, refr, nS) + testMaxDiff(hi, refi, nS), 1e-3);
+  c0 = clock();
+  status = zhengFunLUT(hr, hi, 1, t, nS, f, pAlph, pPhi, pSphi, TEST_M,
+		       1e-6, 1e-12, 0, NULL);
+  printf("     zhengFunLUT decimated: %.2f ns/sample\n", testSeconds(c0)*1e9/nS);
+  testCheck("zhengFunLUT decimated vs libm",
+	    status ? 1. : testMaxDiff(hr, refr, nS) + testMaxDiff(hi, refi, nS), 1e-5);
+
+  /* The batch is every tap of the link, lag-fastest within each pair */
+  c0 = clock();
+  status = zhengBatch(Hr, Hi, 1, t0, nS, f, TEST_M, pAlph, pPhi, pSphi,
+		      nLags, nPairs, lagsPair, 1e-6, 1e-12, 0, NULL, 1);
+  printf("     zhengBatch %d taps: %.2f ns/sample/tap\n", nLags*nPairs,
+	 testSeconds(c0)*1e9/((double)nS*nLags*nPairs));
+  for (p = 0, err = status ? 1. : 0.; p < nPairs; p++)
+    {
+      for (lag = 0; lag < nLags; lag++)
+	{
+	  ii = (size_t)TEST_M*(lag + (size_t)p*nLags);
+	  if (lag < (int)lagsPair[p])
+	    {
+	      (void)zhengFunLUT(hr, hi, 1, t, nS, f, pAlph + ii, pPhi + ii, pSphi + ii,
+				TEST_M, 1e-6, 1e-12, 0, NULL);
+	    }
+	  else
+	    {
+	      memset(hr, 0, nS*sizeof(double));
+	      memset(hi, 0, nS*sizeof(double));
+	    }
+	  for (k = 0; k < nS; k++)
+	    {
+	      ii = lag + (size_t)k*nLags + (size_t)p*nLags*nS;
+	      err = (fabs(Hr[ii] - hr[k]) > err) ? fabs(Hr[ii] - hr[k]) : err;
+	      err = (fabs(Hi[ii] - hi[k]) > err) ? fabs(Hi[ii] - hi[k]) : err;
+	    }
+	}
+    }
+  testCheck("zhengBatch vs zhengFunLUT", err, 0.);
+
+  memcpy(H1r, Hr, nS*nLags*nPairs*sizeof(double));
+  memcpy(H1i, Hi, nS*nLags*nPairs*sizeof(double));
+  status = zhengBatch(Hr, Hi, 1, t0, nS, f, TEST_M, pAlph, pPhi, pSphi,
+		      nLags, nPairs, lagsPair, 1e-6, 1e-12, 0, NULL, 4);
+  testCheck("zhengBatch 4 threads vs 1",
+	    status ? 1. : testMaxDiff(Hr, H1r, nS*nLags*nPairs) + testMaxDiff(Hi, H1i, nS*nLags*nPairs), 0.);
+
+  free(pAlph);
+  free(pPhi);
+  free(pSphi);
+  free(t);
+  free(hr);
+  free(hi);
+  free(refr);
+  free(refi);
+  free(Hr);
+  free(Hi);
+  free(H1r);
+  free(H1i);
+}
+
+/*---------------------------------------------------------------------*/
+
+/*
+  zhengFunLUT calls on worker threads, each asking for a different cosine
+  table, against the same calls run one after another
+*/
+#define TEST_LUT_TASKS 8
+
+typedef struct {
+  const double *t, *pAlph, *pPhi, *pSphi;
+  double f;
+  int nS;
+  double *hr, *hi;                            /* nS per task */
+  int status;
+} testLutJob;
+
+static void testLutTask(void *arg, int iTask)
+{
+  static const int lutSize[4] = {1024, 4096, 256, 65536};
+  static const char *lutInterp[4] = {"linear", "nearest", "linear", "nearest"};
+  testLutJob *job = (testLutJob *)arg;
+  size_t off = (size_t)iTask*job->nS;
+
+  if (0 != zhengFunLUT(job->hr + off, job->hi + off, 1, job->t, job->nS, job->f,
+		       job->pAlph, job->pPhi, job->pSphi, TEST_M,
+		       0., 0., lutSize[iTask % 4], lutInterp[iTask % 4]))
+    {
+      job->status = 1;
+    }
+}
+
+static void testZhengThreads(int nS)
+{
+  size_t nOut = (size_t)TEST_LUT_TASKS*nS;
+  double *t = (double *)malloc(nS*sizeof(double));
+  double *hr1 = (double *)malloc(nOut*sizeof(double));
+  double *hi1 = (double *)malloc(nOut*sizeof(double));
+  double pAlph[TEST_M], pPhi[TEST_M], pSphi[TEST_M];
+  testLutJob job;
+  int k, iTask;
+
+  testZhengState(pAlph, pPhi, pSphi);
+  for (k = 0; k < nS; k++)
+    {
+      t[k] = 1000.5*k;                        /* Uneven steps go through cosLutTurns() */
+      t[k] = (k % 3) ? t[k] + 0.25 : t[k];
+    }
+  job.t = t;
+  job.pAlph = pAlph;
+  job.pPhi = pPhi;
+  job.pSphi = pSphi;
+  job.f = 1e-3;
+  job.nS = nS;
+  job.status = 0;
+
+  job.hr = hr1;
+  job.hi = hi1;
+  for (iTask = 0; iTask < TEST_LUT_TASKS; iTask++)
+    {
+      testLutTask(&job, iTask);
+    }
+  job.hr = (double *)malloc(nOut*sizeof(double));
+  job.hi = (double *)malloc(nOut*sizeof(double));
+  (void)parallelFor(TEST_LUT_TASKS, 4, testLutTask, &job);
+  testCheck("zhengFunLUT mixed tables, 4 threads vs 1",
+	    job.status ? 1. : testMaxDiff(job.hr, hr1, nOut) + testMaxDiff(job.hi, hi1, nOut), 0.);
+
+  free(t);
+  free(hr1);
+  free(hi1);
+  free(job.hr);
+  free(job.hi);
+}
+
+/*
+  A 2 x 2 Jakes channel generated inside tvconvJakesMimo() against
+  tvconvMimo() of the same taps made by zhengFunLUT()
+*/
+static void testJakesMimo(int nS)
+{
+  double lags[3] = {0., 2., 5.};
+  double gains[3] = {1., 0.5, 0.25};
+  int nR = 2, nT = 2, nLags = 3, longestLag = 5;
+  int pNLags[4];
+  tvconvJakesTap taps[12];
+  double state[12][3][TEST_M];
+  double *pH_re[4], *pH_im[4], *pLags[4], *pSrc_re[4], *pSrc_im[4];
+  double *t = (double *)malloc(nS*sizeof(double));
+  double *hr = (double *)malloc(nS*sizeof(double));
+  double *hi = (double *)malloc(nS*sizeof(double));
+  double *pOut_re = (double *)malloc(nR*(size_t)nS*sizeof(double));
+  double *pOut_im = (double *)malloc(nR*(size_t)nS*sizeof(double));
+  double *pRef_re = (double *)malloc(nR*(size_t)nS*sizeof(double));
+  double *pRef_im = (double *)malloc(nR*(size_t)nS*sizeof(double));
+  double t0 = 1000., f = 2e-3;
+  int p, lag, k, status;
+  clock_t c0;
+
+  for (k = 0; k < nS; k++)
+    {
+      t[k] = t0 + k;
+    }
+  for (p = 0; p < nR*nT; p++)
+    {
+      pNLags[p] = nLags;
+      pLags[p] = lags;
+      pH_re[p] = (double *)malloc(nS*nLags*sizeof(double));
+      pH_im[p] = (double *)malloc(nS*nLags*sizeof(double));
+      pSrc_re[p] = (double *)malloc(nS*sizeof(double));
+      pSrc_im[p] = (double *)malloc(nS*sizeof(double));
+      for (k = 0; k < nS; k++)
+	{
+	  pSrc_re[p][k] = testRand();
+	  pSrc_im[p][k] = testRand();
+	}
+      for (lag = 0; lag < nLags; lag++)
+	{
+	  testZhengState(state[p*nLags + lag][0], state[p*nLags + lag][1], state[p*nLags + lag][2]);
+	  memset(&taps[p*nLags + lag], 0, sizeof(tvconvJakesTap));
+	  taps[p*nLags + lag].M = TEST_M;
+	  taps[p*nLags + lag].gain = gains[lag];
+	  taps[p*nLags + lag].doppf = f;
+	  taps[p*nLags + lag].pAlph = state[p*nLags + lag][0];
+	  taps[p*nLags + lag].pPhi = state[p*nLags + lag][1];
+	  taps[p*nLags + lag].pSphi = state[p*nLags + lag][2];
+	  tvconvJakesTapPlan(&taps[p*nLags + lag], 0.);
+
+	  (void)zhengFunLUT(hr, hi, 1, t, nS, f, state[p*nLags + lag][0], state[p*nLags + lag][1],
+			    state[p*nLags + lag][2], TEST_M, 0., 1e-12, 0, NULL);
+	  for (k = 0; k < nS; k++)
+	    {
+	      pH_re[p][k + (size_t)lag*nS] = gains[lag]*hr[k];
+	      pH_im[p][k + (size_t)lag*nS] = gains[lag]*hi[k];
+	    }
+	}
+    }
+
+  status = tvconvMimo(pRef_re, pRef_im, nR, nT, nS, pNLags, pH_re, pH_im,
+		      TVCONV_H_SAMPLE_MAJOR, TVCONV_CPLX_SPLIT, pLags,
+		      pSrc_re, pSrc_im, longestLag, 1., 0, NULL, 1);
+  c0 = clock();
+  status |= tvconvJakesMimo(pOut_re, pOut_im, nR, nT, nS, pNLags, taps, t0,
+			    TVCONV_CPLX_SPLIT, pLags, pSrc_re, pSrc_im,
+			    longestLag, 1., 0, NULL, 1);
+  printf("     tvconvJakesMimo %dx%d, %d lags: %.2f ns/sample\n", nR, nT, nLags,
+	 testSeconds(c0)*1e9/nS);
+  testCheck("tvconvJakesMimo vs tvconvMimo of zhengFunLUT",
+	    status ? 1. : testMaxDiff(pOut_re, pRef_re, nR*(size_t)nS) +
+	    testMaxDiff(pOut_im, pRef_im, nR*(size_t)nS), 1e-8);
+
+  for (p = 0; p < nR*nT; p++)
+    {
+      free(pH_re[p]);
+      free(pH_im[p]);
+      free(pSrc_re[p]);
+      free(pSrc_im[p]);
+    }
+  free(t);
+  free(hr);
+  free(hi);
+  free(pOut_re);
+  free(pOut_im);
+  free(pRef_re);
+  free(pRef_im);
+}
+
+/*
+  'bank' taps generated inside tvconvJakesMimo() against tvconvMimo() of
+  the taps they interpolate: a sum of sinusoids periodic in the sequence,
+  stored every 64 samples as interleaved pairs, and a sequence stored at
+  every sample, both read across the end of their period
+*/
+static void testBankTaps(int nS)
+{
+  double lags[2] = {0., 3.};
+  double freqs[3] = {3., -7., 8.};            /* Cycles per period */
+  double amps[3] = {0.9, 0.6, -0.4};
+  int nLags = 2, longestLag = 3, decim = 64, nSeq0 = 256, nSeq1 = 100;
+  tvconvJakesTap taps[2];
+  double *seq0 = (double *)malloc(2*nSeq0*sizeof(double));
+  double seq1_re[100], seq1_im[100];
+  double *pH_re = (double *)malloc(nLags*(size_t)nS*sizeof(double));
+  double *pH_im = (double *)malloc(nLags*(size_t)nS*sizeof(double));
+  double *pSrc_re = (double *)malloc(nS*sizeof(double));
+  double *pSrc_im = (double *)malloc(nS*sizeof(double));
+  double *pOut_re = (double *)malloc(nS*sizeof(double));
+  double *pOut_im = (double *)malloc(nS*sizeof(double));
+  double *pRef_re = (double *)malloc(nS*sizeof(double));
+  double *pRef_im = (double *)malloc(nS*sizeof(double));
+  double *pH_reP[1], *pH_imP[1], *pLags[1], *pSrc_reP[1], *pSrc_imP[1];
+  double t0 = 1000., period = (double)nSeq0*decim;
+  double ph, s_re, s_im, rot_re, rot_im;
+  int pNLags[1];
+  int j, k, q, status;
+
+  for (j = 0; j < nSeq0; j++)
+    {
+      for (q = 0, s_re = s_im = 0.; q < 3; q++)
+	{
+	  ph = TEST_TWOPI*freqs[q]*j/nSeq0;
+	  s_re += amps[q]*cos(ph);
+	  s_im += amps[q]*sin(ph);
+	}
+      seq0[2*j] = s_re;
+      seq0[2*j + 1] = s_im;
+    }
+  for (j = 0; j < nSeq1; j++)
+    {
+      seq1_re[j] = testRand();
+      seq1_im[j] = testRand();
+    }
+
+  memset(taps, 0, sizeof(taps));
+  taps[0].gain = 0.8;
+  taps[0].coeff_re = cos(1.);
+  taps[0].coeff_im = sin(1.);
+  taps[0].offset_re = 0.25;
+  taps[0].pSeq_re = seq0;
+  taps[0].pSeq_im = seq0 + 1;
+  taps[0].seqEl = 2;
+  taps[0].seqLen = nSeq0;
+  taps[0].seqOffset = period - 1500.;
+  taps[0].decim = decim;
+  taps[1].gain = 0.5;
+  taps[1].coeff_re = cos(-2.);
+  taps[1].coeff_im = sin(-2.);
+  taps[1].offset_im = -0.5;
+  taps[1].pSeq_re = seq1_re;
+  taps[1].pSeq_im = seq1_im;
+  taps[1].seqEl = 1;
+  taps[1].seqLen = nSeq1;
+  taps[1].seqOffset = 37.;
+  taps[1].decim = 1;
+  tvconvJakesTapPlan(&taps[0], 1e-3);
+  tvconvJakesTapPlan(&taps[1], 1e-3);
+
+  for (k = 0; k < nS; k++)
+    {
+      pSrc_re[k] = testRand();
+      pSrc_im[k] = testRand();
+
+      for (q = 0, s_re = s_im = 0.; q < 3; q++)
+	{
+	  ph = TEST_TWOPI*freqs[q]*fmod(t0 + k + taps[0].seqOffset, period)/period;
+	  s_re += amps[q]*cos(ph);
+	  s_im += amps[q]*sin(ph);
+	}
+      rot_re = taps[0].gain*taps[0].coeff_re;
+      rot_im = taps[0].gain*taps[0].coeff_im;
+      pH_re[k] = rot_re*s_re - rot_im*s_im + taps[0].offset_re;
+      pH_im[k] = rot_re*s_im + rot_im*s_re + taps[0].offset_im;
+
+      j = (int)fmod(t0 + k + taps[1].seqOffset, (double)nSeq1);
+      rot_re = taps[1].gain*taps[1].coeff_re;
+      rot_im = taps[1].gain*taps[1].coeff_im;
+      pH_re[k + (size_t)nS] = rot_re*seq1_re[j] - rot_im*seq1_im[j] + taps[1].offset_re;
+      pH_im[k + (size_t)nS] = rot_re*seq1_im[j] + rot_im*seq1_re[j] + taps[1].offset_im;
+    }
+
+  pNLags[0] = nLags;
+  pLags[0] = lags;
+  pH_reP[0] = pH_re;
+  pH_imP[0] = pH_im;
+  pSrc_reP[0] = pSrc_re;
+  pSrc_imP[0] = pSrc_im;
+  status = tvconvMimo(pRef_re, pRef_im, 1, 1, nS, pNLags, pH_reP, pH_imP,
+		      TVCONV_H_SAMPLE_MAJOR, TVCONV_CPLX_SPLIT, pLags,
+		      pSrc_reP, pSrc_imP, longestLag, 1., 0, NULL, 1);
+  status |= tvconvJakesMimo(pOut_re, pOut_im, 1, 1, nS, pNLags, taps, t0,
+			    TVCONV_CPLX_SPLIT, pLags, pSrc_reP, pSrc_imP,
+			    longestLag, 1., 0, NULL, 1);
+  testCheck("tvconvJakesMimo of bank taps vs their sums",
+	    status ? 1. : testMaxDiff(pOut_re, pRef_re, nS) +
+	    testMaxDiff(pOut_im, pRef_im, nS), 1e-3);
+
+  free(seq0);
+  free(pH_re);
+  free(pH_im);
+  free(pSrc_re);
+  free(pSrc_im);
+  free(pOut_re);
+  free(pOut_im);
+  free(pRef_re);
+  free(pRef_im);
+}
+
+int main(int argc, char *argv[])
+{
+  int nS = (argc > 1) ? atoi(argv[1]) : 50000;
+
+  srand(1);
+  testStackzs(nS);
+  testStackzsCov(nS);
+  testStackzsApply(nS);
+  testStfcs(nS);
+  testTvconv(nS);
+  testTvconvThreads();
+  testZheng(nS);
+  testZhengThreads(nS);
+  testJakesMimo(nS);
+  testBankTaps(nS);
+
+  printf("%d failed\n", testFailures);
+  return(testFailures);
+}
+
+
+/*
+  This material is based upon work supported by the Defense Advanced Research
+  Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+  findings, conclusions or recommendations expressed in this material are those
+  of the author(s) and do not necessarily reflect the views of the Defense
+  Advanced Research Projects Agency.
+
+  © 2019 Massachusetts Institute of Technology.
+
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License version 2 as
+  published by the Free Software Foundation;
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+  POSSIBILITY OF SUCH DAMAGE.
+*/
@@ -0,0 +1,210 @@
+/*
+  This material is based upon work supported by the Defense Advanced Research
+  Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+  findings, conclusions or recommendations expressed in this material are those
+  of the author(s) and do not necessarily reflect the views of the Defense
+  Advanced Research Projects Agency.
+
+  © 2019 Massachusetts Institute of Technology.
+
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License version 2 as
+  published by the Free Software Foundation;
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+  POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  Minimal fork/join helper shared by the channel MEX functions.
+
+  parallelFor(nTasks, nThreads, fn, arg) calls fn(arg, iTask) once for
+  every iTask in [0, nTasks).  Tasks are dealt round-robin to nThreads
+  workers, the calling thread being worker 0, and the call returns once
+  all of them are done.  The callback must not call into the MEX API.
+
+  Everything is static so that each MEX file can still be built on its
+  own with "mex <file>.c".
+*/
+
+#ifndef PARALLELFOR_H
+#define PARALLELFOR_H
+
+#if defined(_WIN32) || defined(_WIN32_) || defined (__WIN32__)
+#include <windows.h>
+#define PARALLELFOR_WIN32
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#define PARALLELFOR_MAX_THREADS 64
+
+typedef void (*parallelForFn)(void *arg, int iTask);
+
+typedef struct {
+  parallelForFn fn;
+  void *arg;
+  int nTasks;
+  int nThreads;
+  int worker;
+} parallelForWorker;
+
+/* Number of online processors (at least 1) */
+static int parallelForNumCores(void)
+{
+#ifdef PARALLELFOR_WIN32
+  SYSTEM_INFO sysInfo;
+  GetSystemInfo(&sysInfo);
+  return((sysInfo.dwNumberOfProcessors > 0) ? (int)sysInfo.dwNumberOfProcessors : 1);
+#else
+  long nCores = sysconf(_SC_NPROCESSORS_ONLN);
+  return((nCores > 0) ? (int)nCores : 1);
+#endif
+}
+
+/*
+  Resolve a requested thread count: 0 (or less) means one per core, and
+  the result is clamped to [1, min(nTasks, PARALLELFOR_MAX_THREADS)].
+*/
+static int parallelForThreads(int nThreads, int nTasks)
+{
+  if (nThreads <= 0)
+    {
+      nThreads = parallelForNumCores();
+    }
+  if (nThreads > PARALLELFOR_MAX_THREADS)
+    {
+      nThreads = PARALLELFOR_MAX_THREADS;
+    }
+  if (nThreads > nTasks)
+    {
+      nThreads = nTasks;
+    }
+  return((nThreads < 1) ? 1 : nThreads);
+}
+
+static void parallelForRun(parallelForWorker *w)
+{
+  int iTask;
+  for (iTask = w->worker; iTask < w->nTasks; iTask += w->nThreads)
+    {
+      w->fn(w->arg, iTask);
+    }
+}
+
+#ifdef PARALLELFOR_WIN32
+static DWORD WINAPI parallelForEntry(LPVOID w)
+{
+  parallelForRun((parallelForWorker *)w);
+  return(0);
+}
+#else
+static void *parallelForEntry(void *w)
+{
+  parallelForRun((parallelForWorker *)w);
+  return(NULL);
+}
+#endif
+
+/*
+  Returns the number of threads actually used.  If a worker thread cannot
+  be started its tasks are run by the calling thread instead.
+*/
+static int parallelFor(int nTasks, int nThreads, parallelForFn fn, void *arg)
+{
+  parallelForWorker workers[PARALLELFOR_MAX_THREADS];
+  int started[PARALLELFOR_MAX_THREADS];
+#ifdef PARALLELFOR_WIN32
+  HANDLE threads[PARALLELFOR_MAX_THREADS];
+#else
+  pthread_t threads[PARALLELFOR_MAX_THREADS];
+#endif
+  int ii;
+
+  if (nTasks < 1)
+    {
+      return(0);
+    }
+  nThreads = parallelForThreads(nThreads, nTasks);
+
+  for (ii = 0; ii < nThreads; ii++)
+    {
+      workers[ii].fn = fn;
+      workers[ii].arg = arg;
+      workers[ii].nTasks = nTasks;
+      workers[ii].nThreads = nThreads;
+      workers[ii].worker = ii;
+      started[ii] = 0;
+    }
+
+  for (ii = 1; ii < nThreads; ii++)
+    {
+#ifdef PARALLELFOR_WIN32
+      threads[ii] = CreateThread(NULL, 0, parallelForEntry, &workers[ii], 0, NULL);
+      started[ii] = (threads[ii] != NULL);
+#else
+      started[ii] = (0 == pthread_create(&threads[ii], NULL, parallelForEntry, &workers[ii]));
+#endif
+    }
+
+  parallelForRun(&workers[0]);
+
+  for (ii = 1; ii < nThreads; ii++)
+    {
+      if (started[ii])
+	{
+#ifdef PARALLELFOR_WIN32
+	  WaitForSingleObject(threads[ii], INFINITE);
+	  CloseHandle(threads[ii]);
+#else
+	  pthread_join(threads[ii], NULL);
+#endif
+	}
+      else
+	{
+	  parallelForRun(&workers[ii]);
+	}
+    }
+
+  return(nThreads);
+}
+
+#endif /* PARALLELFOR_H */
+
+/*
+  This material is based upon work supported by the Defense Advanced Research
+  Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+  findings, conclusions or recommendations expressed in this material are those
+  of the author(s) and do not necessarily reflect the views of the Defense
+  Advanced Research Projects Agency.
+
+  © 2019 Massachusetts Institute of Technology.
+
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License version 2 as
+  published by the Free Software Foundation;
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+  POSSIBILITY OF SUCH DAMAGE.
+*/
@@ -0,0 +1,334 @@
+/*
+  This material is based upon work supported by the Defense Advanced Research
+  Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+  findings, conclusions or recommendations expressed in this material are those
+  of the author(s) and do not necessarily reflect the views of the Defense
+  Advanced Research Projects Agency.
+
+  © 2019 Massachusetts Institute of Technology.
+
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License version 2 as
+  published by the Free Software Foundation;
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+  POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#if defined(_WIN32) || defined(_WIN32_) || defined (__WIN32__)
+/* Remap Microsoft Visual C internal types */
+typedef unsigned __int64 uint64_t;
+typedef __int64 int64_t;
+#else
+#include <stdint.h>
+#endif
+
+#include "llamachan.h"
+#include "parallelFor.h"
+#include "jakesInterp.h"
+#include "cosPoly.h"
+#include "cosLut.h"
+#include "zhengSum.h"
+
+/* Below this many sinusoid evaluations zhengBatch stays single-threaded */
+#define ZHENGBATCH_MT_MIN_WORK (1<<20)
+
+/*
+  One zhengBatch() call.  A task is one block of ZHENG_BLOCK_LEN samples
+  of one pair, with all of the pair's lags, so the tasks write disjoint
+  runs of the output.
+*/
+typedef struct {
+  double *hr, *hi;                            /* Output, nLags*nSamples x nPairs */
+  int hStep;                                  /* Doubles between output elements */
+  const double *alph, *phi, *sphi;            /* M x nLags x nPairs */
+  const double *pLagsPair;                    /* Lags of each pair, NULL if all nLags */
+  double start;
+  double f;
+  int m;
+  int nLags;
+  int nSamples;
+  int nBlocks;                                /* Blocks per pair */
+  int decim, order;
+  zhengCos zc;                                /* Cosine table or polynomial */
+} zhengBatchJob;
+
+static void zhengBatchTask(void *arg, int iTask)
+{
+  const zhengBatchJob *job = (const zhengBatchJob *)arg;
+  int p = iTask/job->nBlocks;                 /* Pair */
+  int k0 = (iTask % job->nBlocks)*ZHENG_BLOCK_LEN;
+  int len = (job->nSamples - k0 < ZHENG_BLOCK_LEN) ? job->nSamples - k0 : ZHENG_BLOCK_LEN;
+  int nLags = job->nLags;
+  int nLagsPair = (NULL != job->pLagsPair) ? (int)job->pLagsPair[p] : nLags;
+  size_t col = (size_t)p*nLags*job->nSamples;
+  size_t sin0, el;
+  int lag, k;
+
+  nLagsPair = (nLagsPair < nLags) ? nLagsPair : nLags;
+  nLagsPair = (nLagsPair > 0) ? nLagsPair : 0;
+  for (lag = nLagsPair; lag < nLags; lag++)
+    {
+      for (k = 0, el = job->hStep*(col + lag + (size_t)k0*nLags); k < len; k++, el += job->hStep*nLags)
+	{
+	  job->hr[el] = job->hi[el] = 0.;
+	}
+    }
+  for (lag = 0; lag < nLagsPair; lag++)
+    {
+      sin0 = ((size_t)p*nLags + lag)*job->m;
+      zhengTap(job->hr + job->hStep*(col + lag + (size_t)k0*nLags),
+	       job->hi + job->hStep*(col + lag + (size_t)k0*nLags),
+	       job->hStep*nLags, job->start + k0, len, job->f,
+	       job->alph + sin0, job->phi + sin0, job->sphi + sin0, job->m,
+	       job->decim, job->order, &job->zc);
+    }
+}
+
+/*
+  H = zhengBatch(zs, start, nSamples, tol, cosTol, lutSize, lutInterp, nThreads)
+
+  Every 'zheng' Jakes tap of a link in one call: the taps of the packed
+  chanstates (m, alph, phi, sphi) at Doppler f, alph, phi and sphi being
+  m x nLags x nPairs, of which pair p uses the first pLagsPair[p] lags
+  (all nLags for pLagsPair NULL).
+
+  Column p of the nLags*nSamples x nPairs output, elements hStep doubles
+  apart in hr and hi, is the nLags x nSamples tap matrix of pair p from
+  time start on, with zeros for the lags it does not use.  tol, cosTol,
+  lutSize and lutInterp are as for zhengFunLUT().
+
+  nThreads: 1 runs on the calling thread only, 0 uses one thread per
+  core.  Calls of fewer than ZHENGBATCH_MT_MIN_WORK sinusoid evaluations
+  always run on the calling thread.
+
+  Returns 0 on success, 1 for a missing array and 2 if the cosine table
+  could not be allocated.
+*/
+int zhengBatch(double *hr, double *hi, int hStep,
+	       double start, int nSamples, double f, int m,
+	       const double *alph, const double *phi, const double *sphi,
+	       int nLags, int nPairs, const double *pLagsPair,
+	       double tol, double cosTol, int lutSize, const char *lutInterp,
+	       int nThreads)
+{
+  zhengBatchJob job;
+  double work;
+  int nTasks, iTask;
+
+  if ((nSamples < 1) || (nLags < 1) || (nPairs < 1))
+    {
+      return(0);
+    }
+  if ((NULL == hr) || (NULL == hi) || (m < 1) ||
+      (NULL == alph) || (NULL == phi) || (NULL == sphi))
+    {
+      return(1);
+    }
+
+  job.hr = hr;
+  job.hi = hi;
+  job.hStep = hStep;
+  job.alph = alph;
+  job.phi = phi;
+  job.sphi = sphi;
+  job.pLagsPair = pLagsPair;
+  job.start = start;
+  job.f = f;
+  job.m = m;
+  job.nLags = nLags;
+  job.nSamples = nSamples;
+
+  /* The tables and kernels are set up here, before any worker runs */
+  if (0 != zhengCosInit(cosTol, lutSize, lutInterp, &job.zc))
+    {
+      return(2);
+    }
+  job.decim = jakesInterpPlan(f, m, tol, &job.order);
+
+  job.nBlocks = (nSamples + ZHENG_BLOCK_LEN - 1)/ZHENG_BLOCK_LEN;
+  nTasks = nPairs*job.nBlocks;
+  work = (double)m*nLags*nPairs*nSamples/job.decim;
+  if ((nThreads != 1) && (nTasks > 1) && (work >= (double)ZHENGBATCH_MT_MIN_WORK))
+    {
+      (void)parallelFor(nTasks, nThreads, zhengBatchTask, &job);
+    }
+  else
+    {
+      for (iTask = 0; iTask < nTasks; iTask++)
+	{
+	  zhengBatchTask(&job, iTask);
+	}
+    }
+  return(0);
+}
+
+#ifdef MATLAB_MEX_FILE
+#include <mex.h>
+
+/*
+  Built with "mex -R2018a" complex arrays are interleaved (re, im) pairs:
+  the output is then written in place as pairs, HSTEP doubles apart.
+*/
+#if MX_HAS_INTERLEAVED_COMPLEX
+#define GETDOUBLES mxGetDoubles
+#define HSTEP 2
+#else
+#define GETDOUBLES mxGetPr
+#define HSTEP 1
+#endif
+
+/* A field of zs, which must be a nonempty real double array */
+static const mxArray *zhengBatchField(const mxArray *zs, const char *name)
+{
+  const mxArray *a = mxGetField(zs, 0, name);
+
+  if ((NULL == a) || !mxIsDouble(a) || mxIsComplex(a) || mxIsEmpty(a))
+    {
+      mexErrMsgTxt("zhengBatch: zs needs real double fields M, doppf, alph, phi and sphi");
+    }
+  return(a);
+}
+
+/*
+  H = zhengBatch(zs, start, nSamples, tol, cosTol, lutSize, lutInterp, nThreads)
+
+  Every 'zheng' Jakes tap of a link in one call, from the packed
+  chanstates zs of PackZhengStates.m:
+
+    M, doppf          shared by all the chanstates
+    alph, phi, sphi   M x nLags x nPairs, nPairs being nR*nT
+    nLags             nR x nT (optional), the lags actually used by each
+                      pair, the rest of the nLags being padding
+
+  Column p of H, nLags*nSamples x nPairs, is the nLags x nSamples matrix
+  jakes4(start, nSamples, chanstates{p}) of pair p, in MATLAB order, with
+  zeros for padded lags.  tol, cosTol, lutSize and lutInterp (all
+  optional) are as in zhengFunLUT.
+
+  nThreads (optional): 1 (the default) runs on the calling thread only,
+  0 uses one thread per core, see zhengBatch() above.
+*/
+void mexFunction(int nlhs, mxArray *plhs[],
+		 int nrhs, const mxArray *prhs[])
+{
+  const mxArray *Alph, *Phi, *Sphi, *LagsPair;
+  const mwSize *dims;
+  const double *pLagsPair;
+  double *hr, *hi;
+  double f, start, tol, cosTol;
+  size_t nSin;
+  int m, nLags, nSamples, nPairs, nThreads, lutSize;
+  char interpName[8];
+
+  (void)nlhs;
+  if ((nrhs < 3) || !mxIsStruct(prhs[0]))
+    {
+      mexErrMsgTxt("zhengBatch: usage H = zhengBatch(zs, start, nSamples, ...)");
+    }
+
+  m = (int)mxGetScalar(zhengBatchField(prhs[0], "M"));
+  f = mxGetScalar(zhengBatchField(prhs[0], "doppf"));
+  Alph = zhengBatchField(prhs[0], "alph");
+  Phi  = zhengBatchField(prhs[0], "phi");
+  Sphi = zhengBatchField(prhs[0], "sphi");
+  nSin = mxGetNumberOfElements(Alph);
+  if ((m < 1) || (nSin % m) ||
+      (mxGetNumberOfElements(Phi) != nSin) || (mxGetNumberOfElements(Sphi) != nSin))
+    {
+      mexErrMsgTxt("zhengBatch: alph, phi and sphi must all be M x nLags x nPairs");
+    }
+  dims = mxGetDimensions(Alph);
+  nLags = (int)dims[1];
+  nPairs = (int)(nSin/((size_t)m*nLags));
+
+  LagsPair = mxGetField(prhs[0], 0, "nLags");
+  pLagsPair = NULL;
+  if ((NULL != LagsPair) && !mxIsEmpty(LagsPair))
+    {
+      if (!mxIsDouble(LagsPair) || ((int)mxGetNumberOfElements(LagsPair) != nPairs))
+	{
+	  mexErrMsgTxt("zhengBatch: nLags must hold one count per pair");
+	}
+      pLagsPair = GETDOUBLES(LagsPair);
+    }
+
+  start = mxGetScalar(prhs[1]);
+  nSamples = (int)mxGetScalar(prhs[2]);
+  nSamples = (nSamples > 0) ? nSamples : 0;
+
+  tol = ((nrhs > 3) && !mxIsEmpty(prhs[3])) ? mxGetScalar(prhs[3]) : 0.;
+  cosTol = ((nrhs > 4) && !mxIsEmpty(prhs[4])) ? mxGetScalar(prhs[4]) : 0.;
+  lutSize = ((nrhs > 5) && !mxIsEmpty(prhs[5])) ? (int)mxGetScalar(prhs[5]) : 0;
+  if ((nrhs <= 6) || !mxIsChar(prhs[6]) || mxGetString(prhs[6], interpName, sizeof(interpName)))
+    {
+      interpName[0] = '\0';
+    }
+  nThreads = ((nrhs > 7) && !mxIsEmpty(prhs[7])) ? (int)mxGetScalar(prhs[7]) : 1;
+
+  plhs[0] = mxCreateNumericMatrix((mwSize)nLags*nSamples, (mwSize)nPairs,
+				  mxDOUBLE_CLASS, mxCOMPLEX);
+#if MX_HAS_INTERLEAVED_COMPLEX
+  hr = (double *)mxGetComplexDoubles(plhs[0]);
+  hi = hr + 1;
+#else
+  hr = mxGetPr(plhs[0]);
+  hi = mxGetPi(plhs[0]);
+#endif
+
+  if (0 != zhengBatch(hr, hi, HSTEP, start, nSamples, f, m,
+		      GETDOUBLES(Alph), GETDOUBLES(Phi), GETDOUBLES(Sphi),
+		      nLags, nPairs, pLagsPair,
+		      tol, cosTol, lutSize, interpName, nThreads))
+    {
+      mexErrMsgTxt("zhengBatch: could not allocate the cosine table");
+    }
+}
+
+#undef GETDOUBLES
+#undef HSTEP
+#endif /* MATLAB_MEX_FILE */
+
+#undef ZHENGBATCH_MT_MIN_WORK
+
+/*
+  This material is based upon work supported by the Defense Advanced Research
+  Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+  findings, conclusions or recommendations expressed in this material are those
+  of the author(s) and do not necessarily reflect the views of the Defense
+  Advanced Research Projects Agency.
+
+  © 2019 Massachusetts Institute of Technology.
+
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License version 2 as
+  published by the Free Software Foundation;
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+  POSSIBILITY OF SUCH DAMAGE.
+*/
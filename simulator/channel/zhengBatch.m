@@ -0,0 +1,124 @@
+function H = zhengBatch(zs, start, nSamples, tol, cosTol, lutSize, lutInterp, nThreads) %#ok nThreads only used by the MEX
+
+% Function simulator/channel/zhengBatch.m:
+% Makes every Jakes tap of a link from the packed chanstates of
+% PackZhengStates.  This is the slow version of zhengBatch.c, which does
+% it in one native call, optionally multithreaded.
+%
+% USAGE: H = zhengBatch(zs, start, nSamples, tol, cosTol, lutSize, lutInterp, nThreads)
+%
+% Input arguments:
+%  zs        (struct) Packed chanstates, see PackZhengStates
+%  start     (int) Sample number of the first tap sample
+%  nSamples  (int) Number of samples
+%  tol, cosTol, lutSize, lutInterp  (optional) As in jakes4
+%  nThreads  (optional) Threads of the MEX function, 0 for one per core
+%
+% Output argument:
+%  H         (maxLags*nSamples x nR*nT complex) Column p is the
+%            maxLags x nSamples matrix of jakes4 for pair p, zero past the
+%            pair's lags.
+
+%
+% This material is based upon work supported by the Defense Advanced Research
+% Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+% findings, conclusions or recommendations expressed in this material are those
+% of the author(s) and do not necessarily reflect the views of the Defense
+% Advanced Research Projects Agency.
+%
+% © 2019 Massachusetts Institute of Technology.
+%
+%
+% This program is free software; you can redistribute it and/or modify
+% it under the terms of the GNU General Public License version 2 as
+% published by the Free Software Foundation;
+%
+% THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+% AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+% IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+% ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+% LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+% CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+% SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+% INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+% CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+% ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+% POSSIBILITY OF SUCH DAMAGE.
+%
+% Delivered to the U.S. Government with Unlimited Rights, as defined in DFARS
+% Part 252.227-7013 or 7014 (Feb 2014). Notwithstanding any copyright notice,
+% U.S. Government rights in this work are defined by DFARS 252.227-7013 or
+% DFARS 252.227-7014 as detailed above. Use of this work other than as
+% specifically authorized by the U.S. Government may violate any copyrights
+% that exist in this work.
+
+persistent calledBefore
+if isempty(calledBefore)
+  fprintf(1, ['\n   WARNING Missing MEX function: zhengBatch.%s', ...
+              '.\n   You can create the mex function by changing', ...
+              ' the\n   working directory to', ...
+              ' /simulator/channel/\n   and typing "mex', ...
+              ' zhengBatch.c"\n\n'], mexext);
+  calledBefore = true;
+end
+
+if nargin < 4
+  tol = 0;
+end
+if nargin < 5
+  cosTol = 0;
+end
+if nargin < 6
+  lutSize = 1024;
+end
+if nargin < 7
+  lutInterp = 'linear';
+end
+
+[M, maxLags, nPairs] = size(zs.alph);
+t = (start:start+nSamples-1);
+H = complex(zeros(maxLags*nSamples, nPairs));
+for pairLoop = 1:nPairs
+    for lLoop = 1:zs.nLags(pairLoop)
+        cs.M    = M;
+        cs.alph = zs.alph(:, lLoop, pairLoop);
+        cs.phi  = zs.phi(:, lLoop, pairLoop);
+        cs.sphi = zs.sphi(:, lLoop, pairLoop);
+        h = zhengFunLUT(zs.doppf, t, cs, tol, cosTol, lutSize, lutInterp);
+        H(lLoop:maxLags:end, pairLoop) = h.';
+    end
+end
+
+%
+% This material is based upon work supported by the Defense Advanced Research
+% Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+% findings, conclusions or recommendations expressed in this material are those
+% of the author(s) and do not necessarily reflect the views of the Defense
+% Advanced Research Projects Agency.
+%
+% © 2019 Massachusetts Institute of Technology.
+%
+%
+% This program is free software; you can redistribute it and/or modify
+% it under the terms of the GNU General Public License version 2 as
+% published by the Free Software Foundation;
+%
+% THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+% AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+% IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+% ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+% LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+% CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+% SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+% INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+% CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+% ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+% POSSIBILITY OF SUCH DAMAGE.
+%
+% Delivered to the U.S. Government with Unlimited Rights, as defined in DFARS
+% Part 252.227-7013 or 7014 (Feb 2014). Notwithstanding any copyright notice,
+% U.S. Government rights in this work are defined by DFARS 252.227-7013 or
+% DFARS 252.227-7014 as detailed above. Use of this work other than as
+% specifically authorized by the U.S. Government may violate any copyrights
+% that exist in this work.
+
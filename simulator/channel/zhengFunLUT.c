@@ -27,6 +27,7 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include <math.h>
 
 #if defined(_WIN32) || defined(_WIN32_) || defined (__WIN32__)
@@ -44,42 +45,163 @@ typedef __int64 int64_t;
 #include <stdint.h>
 #endif
 
-#include <mex.h>
+#include "llamachan.h"
+#include "jakesInterp.h"
+#include "cosPoly.h"
+#include "cosLut.h"
+#include "zhengSum.h"
 
-#include "coslut65536.h"
+/*
+  Add sum_m 2 cos(2 pi f cos(alph_m) t[k] + phi_m) to hr[k*hStep] and
+  sum_m 2 cos(2 pi f sin(alph_m) t[k] + sphi_m) to hi[k*hStep], k < nSamp,
+  with the cosines read from the cosLut.h table lut, for times t that
+  are not evenly spaced.
+*/
+static void zhengLUTSum(double *hr, double *hi, int hStep,
+			const double *t, int nSamp, double f,
+			const double *alphr, const double *phir, const double *sphir, int m,
+			const cosLut *lut)
+{
+  double fr, fi;                              /* Doppler of each part, cycles per sample */
+  double pr, pi;                              /* Phase of each part, turns */
+  int ii, k;
 
-/* Make adjustments based on included LUT definition */
-#if LUTSIZE == 256
-#define INDEXVAR_T uint8_t
-#elif LUTSIZE == 65536
-#define INDEXVAR_T uint16_t
-#else
-#define INDEXVAR_T int
-#define AWKWARD_LUT_SIZE
-#if defined(_WIN32) || defined(_WIN32_) || defined (__WIN32__)
-#pragma message("Note: The included LUT size cannot be indexed efficiently")
+  for (ii = 0; ii < m; ii++)
+    {
+      fr = f*cos(alphr[ii]);
+      fi = f*sin(alphr[ii]);
+      pr = phir[ii]/ZHENG_TWOPI;
+      pi = sphir[ii]/ZHENG_TWOPI;
+      for (k = 0; k < nSamp; k++)
+	{
+	  hr[k*hStep] += 2.*cosLutTurns(fr*t[k] + pr, lut);
+	  hi[k*hStep] += 2.*cosLutTurns(fi*t[k] + pi, lut);
+	}
+    }
+}
+
+/*
+  h = zhengFunLUT(f, t, chanstate, tol, cosTol, lutSize, lutInterp)
+
+  Write the tap h(t[k]), k < nSamp, of the 'zheng' chanstate (m, alphr,
+  phir, sphir) at Doppler f to hr[k*hStep] and hi[k*hStep].
+
+  Evenly spaced times t, as jakes4 passes them, run each sinusoid as an
+  NCO (see zhengNcoSum()); other times are evaluated one by one.  With
+  cosTol > 0 the NCO cosines come from the fastest cosPoly.h polynomial
+  within cosTol of cos rather than from the table.
+
+  The cosine table has lutSize entries (0 for 1024, rounded up to a
+  power of two) and lutInterp is "linear" (or NULL or "", the default)
+  or "nearest"; see cosLut.h.  Each table is generated by the first call
+  that asks for it and shared, unchanged, by all later ones.
+
+  With tol > 0 and unit-spaced times, slow taps are evaluated at a
+  decimated rate and interpolated, within tol of their rms amplitude,
+  see jakesInterpPlan().
+
+  Returns 0 on success, 1 for a missing array and 2 if the cosine table
+  could not be allocated.
+*/
+int zhengFunLUT(double *hr, double *hi, int hStep,
+		const double *t, int nSamp, double f,
+		const double *alphr, const double *phir, const double *sphir, int m,
+		double tol, double cosTol, int lutSize, const char *lutInterp)
+{
+  double *hrPtr, *hrPtrEnd;
+  double *hiPtr;
+  double tempd1;
+  double dt;                                  /* Spacing of evenly spaced times */
+  int uniform;
+  int decim, order, k;
+  zhengCos zc;                                /* Cosine table or polynomial */
+
+  if (nSamp < 1)
+    {
+      return(0);
+    }
+  if ((NULL == hr) || (NULL == hi) || (NULL == t) || (m < 1) ||
+      (NULL == alphr) || (NULL == phir) || (NULL == sphir))
+    {
+      return(1);
+    }
+
+  if (0 != zhengCosInit(cosTol, lutSize, lutInterp, &zc))
+    {
+      return(2);
+    }
+
+  hrPtrEnd = hr + hStep*(size_t)nSamp;
+
+  dt = (nSamp > 1) ? t[1] - t[0] : 1.;
+  for (k = 1, uniform = 1; uniform && (k < nSamp); k++)
+    {
+      uniform = (fabs(t[k] - (t[0] + k*dt)) <= 1e-6);
+    }
+
+  if (uniform && (dt == 1.))
+    {
+      decim = jakesInterpPlan(f, m, tol, &order);
+      zhengTap(hr, hi, hStep, t[0], nSamp, f, alphr, phir, sphir, m, decim, order, &zc);
+      return(0);
+    }
+
+  for (hrPtr = hr, hiPtr = hi; hrPtr < hrPtrEnd; hrPtr += hStep, hiPtr += hStep)
+    {
+      *hrPtr = *hiPtr = 0.;
+    }
+  if (uniform)
+    {
+      zhengNcoSum(hr, hi, hStep, t[0], dt, nSamp, f, alphr, phir, sphir, m, &zc);
+    }
+  else
+    {
+      zhengLUTSum(hr, hi, hStep, t, nSamp, f, alphr, phir, sphir, m, &zc.lut);
+    }
+
+  tempd1 = sqrt(1./(4.*m));
+  for (hrPtr = hr, hiPtr = hi; hrPtr < hrPtrEnd; hrPtr += hStep, hiPtr += hStep)
+    {
+      *hrPtr *= tempd1;
+      *hiPtr *= tempd1;
+    }
+
+  return(0);
+}
+
+#ifdef MATLAB_MEX_FILE
+#include <mex.h>
+
+/*
+  Built with "mex -R2018a" complex arrays are interleaved (re, im) pairs:
+  the output is then written in place as pairs, HSTEP doubles apart.
+*/
+#if MX_HAS_INTERLEAVED_COMPLEX
+#define GETDOUBLES mxGetDoubles
+#define HSTEP 2
 #else
-#warning "Note: The included LUT size cannot be indexed efficiently"
-#endif
+#define GETDOUBLES mxGetPr
+#define HSTEP 1
 #endif
 
-#define TWOPI (6.283185307179586)
-#define R2D (57.295779513082323)
+/*
+  h = zhengFunLUT(f, t, chanstate, tol, cosTol, lutSize, lutInterp)
 
+  tol, cosTol, lutSize and lutInterp are optional, see zhengFunLUT()
+  above.
+*/
 void mexFunction(int nlhs, mxArray *plhs[],
 		 int nrhs, const mxArray *prhs[])
 {
 
-  double f, twopif, theta;
+  double f;
   double *alphr, *phir, *sphir;
-  double *hr, *hrPtr, *hrPtrEnd;
-  double *hi, *hiPtr;
-  double *t, *tPtr;
-  double tempd1, tempd2, tempd3, tempd4;
-  double r2dscale;
+  double *hr, *hi;
+  double *t;
+  double tol, cosTol;
   int m, nSamp;
-  INDEXVAR_T lutIndx;
-  double *alphrPtr, *alphrPtrEnd, *phirPtr, *sphirPtr;
+  int lutSize;
+  char interpName[8];
 
   mxArray *M, *Alph, *Phi, *Sphi;
 
@@ -87,7 +209,7 @@ void mexFunction(int nlhs, mxArray *plhs[],
 
   f = (double)mxGetScalar(prhs[0]);
 
-  t = mxGetPr(prhs[1]);
+  t = GETDOUBLES(prhs[1]);
   nSamp = mxGetNumberOfElements(prhs[1]);
 
   M     = mxGetField(prhs[2], 0, "M");
@@ -96,85 +218,39 @@ void mexFunction(int nlhs, mxArray *plhs[],
   Sphi  = mxGetField(prhs[2], 0, "sphi");
 
   m     = (int)mxGetScalar(M);
-  alphr = mxGetPr(Alph);
-  phir  = mxGetPr(Phi);
-  sphir = mxGetPr(Sphi);
-
-  plhs[0] = mxCreateNumericMatrix(1, nSamp, mxDOUBLE_CLASS, mxCOMPLEX);
-  hr = mxGetPr(plhs[0]);
-  hi = mxGetPi(plhs[0]);
-
-  r2dscale = R2D * STEPSIZE;
-  twopif = f * TWOPI;
-
-  hrPtrEnd = hr + nSamp;
-
-
-  alphrPtrEnd = alphr + m;
-#ifdef AWKWARD_LUT_SIZE
-  for(alphrPtr = alphr, phirPtr = phir, sphirPtr = sphir;
-      alphrPtr < alphrPtrEnd ;
-      alphrPtr++, phirPtr++, sphirPtr++)
+  alphr = GETDOUBLES(Alph);
+  phir  = GETDOUBLES(Phi);
+  sphir = GETDOUBLES(Sphi);
+
+  tol = (nrhs > 3) ? mxGetScalar(prhs[3]) : 0.;
+  cosTol = (nrhs > 4) ? mxGetScalar(prhs[4]) : 0.;
+  lutSize = ((nrhs > 5) && !mxIsEmpty(prhs[5])) ? (int)mxGetScalar(prhs[5]) : 0;
+  if ((nrhs <= 6) || !mxIsChar(prhs[6]) || mxGetString(prhs[6], interpName, sizeof(interpName)))
     {
-
-      lutIndx = ((INDEXVAR_T)(*alphrPtr*r2dscale))%LUTSIZE;
-      lutIndx = lutIndx<0 ? lutIndx+LUTSIZE : lutIndx;
-      tempd1 = twopif*coslut[lutIndx];
-
-      lutIndx = ((INDEXVAR_T)((*alphrPtr*R2D-90.)*STEPSIZE))%LUTSIZE;
-      lutIndx = lutIndx<0 ? lutIndx+LUTSIZE : lutIndx;
-
-      tempd2 = twopif*coslut[lutIndx];
-      tempd3 = *phirPtr;
-      tempd4 = *sphirPtr;
-
-      for(hrPtr = hr, hiPtr = hi, tPtr = t; hrPtr < hrPtrEnd; hrPtr++, hiPtr++, tPtr++) 
-	{
-	  lutIndx = ((INDEXVAR_T)((tempd1**tPtr+tempd3)*r2dscale))%LUTSIZE;
-	  lutIndx = lutIndx<0 ? lutIndx+LUTSIZE : lutIndx;
-	  *hrPtr += 2.*coslut[lutIndx];
-
-	  lutIndx = ((INDEXVAR_T)((tempd2**tPtr+tempd4)*r2dscale))%LUTSIZE;
-	  lutIndx = lutIndx<0 ? lutIndx+LUTSIZE : lutIndx;
-	  *hiPtr += 2.*coslut[lutIndx];
-	}
+      interpName[0] = '\0';
     }
 
+  plhs[0] = mxCreateNumericMatrix(1, nSamp, mxDOUBLE_CLASS, mxCOMPLEX);
+#if MX_HAS_INTERLEAVED_COMPLEX
+  hr = (double *)mxGetComplexDoubles(plhs[0]);
+  hi = hr + 1;
 #else
-  for(alphrPtr = alphr, phirPtr = phir, sphirPtr = sphir;
-      alphrPtr < alphrPtrEnd ;
-      alphrPtr++, phirPtr++, sphirPtr++)
-    {
-
-      lutIndx = (INDEXVAR_T)(*alphrPtr*r2dscale);
-      tempd1 = twopif*coslut[lutIndx];
-      lutIndx = (INDEXVAR_T)((*alphrPtr*R2D-90.)*STEPSIZE);
-
-      tempd2 = twopif*coslut[lutIndx];
-      tempd3 = *phirPtr;
-      tempd4 = *sphirPtr;
-      for(hrPtr = hr, hiPtr = hi, tPtr = t; hrPtr < hrPtrEnd; hrPtr++, hiPtr++, tPtr++) 
-	{
-
-	  lutIndx = (INDEXVAR_T)((tempd1**tPtr+tempd3)*r2dscale);
-	  *hrPtr += 2.*coslut[lutIndx];
-
-	  lutIndx = (INDEXVAR_T)((tempd2**tPtr+tempd4)*r2dscale);
-	  *hiPtr += 2.*coslut[lutIndx];
-	}
-    }
+  hr = mxGetPr(plhs[0]);
+  hi = mxGetPi(plhs[0]);
 #endif
-  tempd1 = sqrt(1./(4.*m));
-  for (hrPtr = hr, hiPtr = hi; hrPtr < hrPtrEnd; hrPtr++, hiPtr++)
+
+  if (0 != zhengFunLUT(hr, hi, HSTEP, t, nSamp, f, alphr, phir, sphir, m,
+		       tol, cosTol, lutSize, interpName))
     {
-      *hrPtr *= tempd1;
-      *hiPtr *= tempd1;
+      mexErrMsgTxt("zhengFunLUT: could not allocate the cosine table");
     }
 
   return;
 } /*--- end of mexFunction ---*/
 
-#undef AWKWARD_LUT_SIZE
+#undef GETDOUBLES
+#undef HSTEP
+#endif /* MATLAB_MEX_FILE */
 /*
   This material is based upon work supported by the Defense Advanced Research
   Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
@@ -1,4 +1,4 @@
-function h = zhengFunLUT(f, t, chanstates)
+function h = zhengFunLUT(f, t, chanstates, tol, cosTol, lutSize, lutInterp) %#ok tol onwards only used by the MEX
 %
 % This material is based upon work supported by the Defense Advanced Research
 % Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
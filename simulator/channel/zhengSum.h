@@ -0,0 +1,237 @@
+/*
+  This material is based upon work supported by the Defense Advanced Research
+  Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+  findings, conclusions or recommendations expressed in this material are those
+  of the author(s) and do not necessarily reflect the views of the Defense
+  Advanced Research Projects Agency.
+
+  © 2019 Massachusetts Institute of Technology.
+
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License version 2 as
+  published by the Free Software Foundation;
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+  POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  Sums of sinusoids of the 'zheng' Jakes chanstates, shared by the MEX
+  functions that generate them (zhengFunLUT, zhengBatch).
+
+  A chanstate's tap is
+
+    h(t) = sqrt(1/(4M)) sum_m [2 cos(2 pi f cos(alph_m) t + phi_m)
+                               + 2j cos(2 pi f sin(alph_m) t + sphi_m)]
+
+  uint64_t and int64_t must be defined, and jakesInterp.h, cosPoly.h and
+  cosLut.h included, before this file.  Everything is static so that
+  each MEX file can still be built on its own with "mex <file>.c".
+*/
+
+#ifndef ZHENGSUM_H
+#define ZHENGSUM_H
+
+#include <string.h>
+#include <math.h>
+
+#define ZHENG_TWOPI (6.283185307179586)
+
+/* NCO phase word of a phase of turns cycles */
+static uint64_t zhengNcoWord(double turns)
+{
+  double hi, lo;
+
+  turns -= floor(turns);
+  turns = (turns < 1.) ? turns : 0.;
+  hi = floor(turns*4294967296.);
+  lo = floor((turns*4294967296. - hi)*4294967296.);
+  return(((uint64_t)hi << 32) + (uint64_t)lo);
+}
+
+/*
+  NCO mode: the phase of each sinusoid is a 64-bit fraction of a turn,
+  advanced by a fixed increment per sample, and its top bits index the
+  cosine table.  The increment is exact to 2^-64 turns, so the phase
+  does not drift however large t grows.
+*/
+
+/* Sinusoids advanced together by the NCO loop */
+#define ZHENG_NCO_CHUNK 8
+
+/* Samples per pass of the sum kernels */
+#define ZHENG_NCO_LEN 512
+
+/* How the cosines of a call are evaluated, set up by zhengCosInit() */
+typedef struct {
+  int level;                                  /* cosPoly.h level, -1 for the table */
+  cosLut lut;                                 /* The table, also for uneven times */
+} zhengCos;
+
+/*
+  Add sum_m 2 cos(2 pi f cos(alph_m) t + phi_m) to hr[k*hStep] and
+  sum_m 2 cos(2 pi f sin(alph_m) t + sphi_m) to hi[k*hStep], k < nSamp,
+  at the evenly spaced times t = t0 + k*dt, with each sinusoid run as
+  an NCO seeded at t0 and its cosines read from the table zc->lut.
+
+  With zc->level >= 0 the cosines are instead evaluated by the cosPoly.h
+  polynomial of that accuracy level, a vector of samples at a time.
+*/
+static void zhengNcoSum(double *hr, double *hi, int hStep,
+			double t0, double dt, int nSamp, double f,
+			const double *alphr, const double *phir, const double *sphir, int m,
+			const zhengCos *zc)
+{
+  uint64_t accr[ZHENG_NCO_CHUNK], acci[ZHENG_NCO_CHUNK]; /* Phases */
+  uint64_t incr[ZHENG_NCO_CHUNK], inci[ZHENG_NCO_CHUNK]; /* Phase increments per time step */
+  double sumr[ZHENG_NCO_LEN], sumi[ZHENG_NCO_LEN];
+  double fr, fi;                              /* Doppler of each part, cycles per sample */
+  int m0, nm, ii, k, k0, len;
+
+  for (m0 = 0; m0 < m; m0 += ZHENG_NCO_CHUNK)
+    {
+      nm = (m - m0 < ZHENG_NCO_CHUNK) ? m - m0 : ZHENG_NCO_CHUNK;
+      for (ii = 0; ii < nm; ii++)
+	{
+	  fr = f*cos(alphr[m0 + ii]);
+	  fi = f*sin(alphr[m0 + ii]);
+	  accr[ii] = zhengNcoWord(fr*t0 + phir[m0 + ii]/ZHENG_TWOPI);
+	  acci[ii] = zhengNcoWord(fi*t0 + sphir[m0 + ii]/ZHENG_TWOPI);
+	  incr[ii] = zhengNcoWord(fr*dt);
+	  inci[ii] = zhengNcoWord(fi*dt);
+	}
+      for (k0 = 0; k0 < nSamp; k0 += len)
+	{
+	  len = (nSamp - k0 < ZHENG_NCO_LEN) ? nSamp - k0 : ZHENG_NCO_LEN;
+	  memset(sumr, 0, len*sizeof(double));
+	  memset(sumi, 0, len*sizeof(double));
+	  if (zc->level >= 0)
+	    {
+	      cosPolySum(sumr, len, accr, incr, nm, zc->level);
+	      cosPolySum(sumi, len, acci, inci, nm, zc->level);
+	    }
+	  else
+	    {
+	      cosLutSum(sumr, len, accr, incr, nm, &zc->lut);
+	      cosLutSum(sumi, len, acci, inci, nm, &zc->lut);
+	    }
+	  for (k = 0; k < len; k++)
+	    {
+	      hr[(k0 + k)*hStep] += 2.*sumr[k];
+	      hi[(k0 + k)*hStep] += 2.*sumi[k];
+	    }
+	}
+    }
+}
+
+/*
+  Set up the cosines of the sums in zc: the cosLut.h table of lutSize
+  entries (COSLUT_DEFAULT_SIZE if 0) with lutInterp "nearest" or
+  "linear" (the default, also for NULL), and with cosTol > 0 the
+  cosPoly.h kernel.  Returns 0, or 2 if the table could not be
+  allocated.
+*/
+static int zhengCosInit(double cosTol, int lutSize, const char *lutInterp, zhengCos *zc)
+{
+  zc->level = (cosTol > 0.) ? cosPolyLevel(cosTol) : -1;
+  if (zc->level >= 0)
+    {
+      cosPolyInitIsa();
+    }
+  return((0 == cosLutInit((lutSize > 0) ? lutSize : COSLUT_DEFAULT_SIZE,
+			  ((NULL != lutInterp) && (0 == strcmp(lutInterp, "nearest"))) ?
+			  COSLUT_NEAREST : COSLUT_LINEAR, &zc->lut)) ? 2 : 0);
+}
+
+/* Samples per block of zhengTap() */
+#define ZHENG_BLOCK_LEN 4096
+
+/*
+  Write the tap h(t0 + k), k < nSamp, of one chanstate to hr[k*hStep]
+  and hi[k*hStep].  The sinusoids run as NCOs (see zhengNcoSum()), and
+  with decim > 1 they are evaluated at the times j*decim only and
+  interpolated with the given order (see jakesInterpPlan()).
+
+  The tap is made ZHENG_BLOCK_LEN samples at a time, in scratch on the
+  stack, so that this can run on worker threads.  Decimated samples sit
+  at absolute times, so the blocks join up exactly.
+*/
+static void zhengTap(double *hr, double *hi, int hStep, double t0, int nSamp, double f,
+		     const double *alphr, const double *phir, const double *sphir, int m,
+		     int decim, int order, const zhengCos *zc)
+{
+  double coarse[2*(ZHENG_BLOCK_LEN/2 + JAKESINTERP_MAX_ORDER + 2)];
+  double scale = sqrt(1./(4.*m));
+  double *pr, *pi;
+  double j0;
+  int k0, k, len, nCoarse;
+
+  for (k0 = 0; k0 < nSamp; k0 += len)
+    {
+      len = (nSamp - k0 < ZHENG_BLOCK_LEN) ? nSamp - k0 : ZHENG_BLOCK_LEN;
+      pr = hr + (size_t)k0*hStep;
+      pi = hi + (size_t)k0*hStep;
+      if (decim > 1)
+	{
+	  nCoarse = jakesInterpSpan(t0 + k0, len, decim, order, &j0);
+	  memset(coarse, 0, 2*nCoarse*sizeof(double));
+	  zhengNcoSum(coarse, coarse + nCoarse, 1, j0*decim, decim, nCoarse, f,
+		      alphr, phir, sphir, m, zc);
+	  jakesInterpRun(pr, hStep, len, t0 + k0, coarse, j0, decim, order);
+	  jakesInterpRun(pi, hStep, len, t0 + k0, coarse + nCoarse, j0, decim, order);
+	}
+      else
+	{
+	  for (k = 0; k < len; k++)
+	    {
+	      pr[k*hStep] = pi[k*hStep] = 0.;
+	    }
+	  zhengNcoSum(pr, pi, hStep, t0 + k0, 1., len, f, alphr, phir, sphir, m, zc);
+	}
+      for (k = 0; k < len; k++)
+	{
+	  pr[k*hStep] *= scale;
+	  pi[k*hStep] *= scale;
+	}
+    }
+}
+
+#endif /* ZHENGSUM_H */
+
+
+/*
+  This material is based upon work supported by the Defense Advanced Research
+  Projects Agency under Air Force Contract No. FA8702-15-D-0001. Any opinions,
+  findings, conclusions or recommendations expressed in this material are those
+  of the author(s) and do not necessarily reflect the views of the Defense
+  Advanced Research Projects Agency.
+
+  © 2019 Massachusetts Institute of Technology.
+
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License version 2 as
+  published by the Free Software Foundation;
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+  POSSIBILITY OF SUCH DAMAGE.
+*/
@@ -52,6 +52,16 @@ global timingDiagramShowExecOrder;
 global addGaussianNoiseFlag;
 global DisplayLLAMACommWarnings;
 global heightLimitDiffuseScattering;
+global channelKernelThreads;
+global jakesInterpTol;
+global jakesCosTol;
+global jakesLutSize;
+global jakesLutInterp;
+global fadingBankMode;
+global fadingBankLength;
+global fadingBankSize;
+global fadingBankMaxUses;
+global fadingBankBinRes;
 
 % Initialize global variables
 %------------------------------------------------------------------------
@@ -125,6 +135,65 @@ addGaussianNoiseFlag = 1;
 % the channel)
 heightLimitDiffuseScattering = 50;
 
+%------------------------------------------------------------------------
+% Number of threads used by the channel MEX functions (e.g. TVConv) on
+% long receive blocks.  1, the default, stays single-threaded, leaving
+% the cores to MATLAB's own threads and to parfor workers; 0 uses all
+% cores (one thread per core).  Short blocks always run single-threaded.
+channelKernelThreads = 1;
+
+%------------------------------------------------------------------------
+% Error allowed in the Jakes fading taps of the 'wssus' channels, relative
+% to each tap's rms amplitude.  0, the default, evaluates every sample
+% exactly as before.  A tolerance such as 1e-6 opts in to an approximate
+% mode: slowly fading taps are evaluated every few (up to thousands of)
+% samples and interpolated in between, which is much cheaper at typical
+% Doppler spreads but changes the fading samples slightly.
+jakesInterpTol = 0;
+
+%------------------------------------------------------------------------
+% Error allowed in each cosine of the Jakes taps built for spatially
+% correlated 'wssus' channels.  0, the default, keeps the cosine table
+% below.  A tolerance such as 1e-9 opts in to evaluating the cosines
+% with a polynomial, 4 to 8 samples per instruction on CPUs with AVX2 or
+% AVX-512, which is both faster and more accurate than the table (the
+% table is faster on CPUs without AVX2), but changes the fading samples.
+jakesCosTol = 0;
+
+%------------------------------------------------------------------------
+% Cosine table of those Jakes taps when jakesCosTol is 0: its number of
+% entries (a power of two, at most 65536) and whether lookups are
+% 'linear'ly interpolated or rounded to the 'nearest' entry.  The table
+% is built when first used.  A 1024-entry linear table stays in the L1
+% cache and is accurate to 4.7e-6; a 65536-entry nearest one takes half
+% the time per lookup but is only accurate to 4.8e-5.
+jakesLutSize = 1024;
+jakesLutInterp = 'linear';
+
+%------------------------------------------------------------------------
+% Set fadingBankMode to 1 to read the Jakes fading of the 'wssus' and
+% 'iid' channels from a bank of precomputed sequences (see
+% simulator/channel/FadingBank.m) instead of generating every tap.  Each
+% tap reads a sequence from a random offset, rotated by a random phase,
+% which costs almost nothing per sample in scenarios with hundreds of
+% links.  The price is memory, and fading that repeats after 1000 to
+% 2000 Doppler cycles (for the default fadingBankLength) and is shared
+% (at different offsets) by up to fadingBankMaxUses taps.
+%
+% Each sequence stores fadingBankLength samples, 32 to 64 per Doppler
+% cycle, and is interpolated in between, so its period grows as the
+% Doppler falls.  Links share the sequences of Doppler bins
+% fadingBankBinRes wide (relative to their Doppler), which hold up to
+% fadingBankSize sequences, each 16*fadingBankLength bytes.  A link
+% whose taps do not all fit in its bin, or whose Doppler is too slow to
+% fade 64 times in a period (below about 1e-8), generates its taps as
+% usual.
+fadingBankMode = 0;
+fadingBankLength = 2^16;
+fadingBankSize = 16;
+fadingBankMaxUses = 32;
+fadingBankBinRes = 0.05;
+
 %------------------------------------------------------------------------
 % LLAMAComm warnings are printed to the command window if this flag is set.
 DisplayLLAMACommWarnings = 1;
@@ -83,15 +83,15 @@ vals            = abs(diag(s)) ;
 vec             = v(:,maxIn) ; %what tx should use...
 
 % Demodulate bits
-stTrainData = Stackzs(trainData,p.lagRange) ;
-rST         = stTrainData*stTrainData' ;
-wUn = inv(rST+p.epsilon*trace(rST)*eye(length(rST))) ...
-    *stTrainData*trainRef' ;
+% Covariance of the stacked training data and its cross-covariance with
+% the reference, without forming the stack
+[rST, cST] = StackzsCov(trainData,p.lagRange,trainRef) ;
+wUn = inv(rST+p.epsilon*trace(rST)*eye(length(rST)))*cST ;
 w   = wUn / norm(wUn) ;
 rxInfoData = sig(:,...
     (1+p.noiseLen + p.trainingLen + p.hTrainingLen):end) ;
-rxST = Stackzs(rxInfoData,p.lagRange) ;
-y   = w'*rxST ;
+% Apply the weights to the stacked payload without forming the stack
+y   = StackzsApply(rxInfoData,p.lagRange,w) ;
 y2  = sum(reshape(y,p.spreadRatio,length(y)/p.spreadRatio)) ;
 
 demodBits = y2 < 0 ;
@@ -84,16 +84,16 @@ sig = resample(sig.', 1, p.nOversamp).';
 % STAP receiver
 trainData = sig(:, (1:p.trainingLen)+p.noiseLen+p.hTrainingLen);
 trainRef  = 1-2*p.trainingSeq;
-stTrainData = Stackzs(trainData, p.lagRange) ;
-rST         = stTrainData*stTrainData' ;
+% Covariance of the stacked training data and its cross-covariance with
+% the reference, without forming the stack
+[rST, cST] = StackzsCov(trainData, p.lagRange, trainRef) ;
 
-wUn = inv(rST+p.epsilon*trace(rST)*eye(length(rST))) ...
-    *stTrainData*trainRef' ;
+wUn = inv(rST+p.epsilon*trace(rST)*eye(length(rST)))*cST ;
 w   = wUn / norm(wUn) ;
 rxInfoData = sig(:, (1+p.noiseLen + p.trainingLen + p.hTrainingLen):end);
-rxST = Stackzs(rxInfoData, p.lagRange) ;
 
-y = w'*rxST ;
+% Apply the weights to the stacked payload without forming the stack
+y = StackzsApply(rxInfoData, p.lagRange, w) ;
 
 
 % Plot receiver output